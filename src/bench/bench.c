@@ -0,0 +1,668 @@
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * bench.c - bench command: throughput of the I/O paths
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ * MIT License
+ *
+ * Copyright (c) 2018-2021 Frank Meyer - frank(at)fli4l.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "stm32f4xx.h"
+#include "boot.h"
+#include "tft.h"
+#include "ff.h"
+#include "diskio.h"
+#include "w25qxx.h"
+#include "uart.h"
+#include "i2c.h"
+#include "nic.h"
+#include "bench.h"
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Every test counts DWT cycles (see boot.c), so a single test must not take longer than 2^32 / 168 MHz = 25 seconds.
+ *
+ * The SD card tests through diskio rewrite the sectors they have just read, the FatFs tests use the temporary file BENCH.TMP.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#define BENCH_BUFSIZE               4096                                        // transfer size of sequential tests
+#define BENCH_SECTOR_SIZE           512
+#define BENCH_FNAME                 "0:/bench.tmp"
+#define BENCH_UART_WINDOW           16                                          // bytes in flight on UART loopback
+
+#if defined (SSD1963) || defined (ILI9341)
+#define BENCH_TFT_PIXELS            (TFT_WIDTH * TFT_HEIGHT)                    // default: one screen
+#else
+#define BENCH_TFT_PIXELS            0
+#endif
+
+static uint32_t                     bench_seed = 1;
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * bench_rand () - pseudo random number
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint32_t
+bench_rand (void)
+{
+    bench_seed = bench_seed * 1103515245 + 12345;
+    return bench_seed >> 8;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * bench_result () - print count of operations per second and, if bytes is not 0, MB/s
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+bench_result (const char * name, uint32_t count, uint32_t bytes, uint32_t cycles)
+{
+    uint32_t    per_sec;
+    uint32_t    kb_per_sec;
+
+    if (cycles == 0)
+    {
+        cycles = 1;
+    }
+
+    per_sec = ((uint64_t) count * SystemCoreClock) / cycles;
+
+    printf ("%-20s %10lu %10lu %10lu", name, count, boot_usec (cycles), per_sec);
+
+    if (bytes)
+    {
+        kb_per_sec = ((uint64_t) bytes * SystemCoreClock) / cycles / 1000;
+        printf (" %6lu.%03lu", kb_per_sec / 1000, kb_per_sec % 1000);
+    }
+
+    printf ("\n");
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * bench_header () - print header of result table
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+bench_header (void)
+{
+    printf ("%-20s %10s %10s %10s %10s\n", "test", "count", "usec", "per sec", "MB/s");
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * bench_tft () - FSMC pixel writes by CPU and DMA, overwrites the display
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+bench_tft (uint32_t pixels)
+{
+#if defined (SSD1963) || defined (ILI9341)
+    uint16_t *  line;
+    uint32_t    start;
+    uint32_t    n;
+    uint32_t    i;
+
+    line = malloc (TFT_WIDTH * sizeof (uint16_t));
+
+    if (! line)
+    {
+        fprintf (stderr, "bench: out of memory\n");
+        return EXIT_FAILURE;
+    }
+
+    for (i = 0; i < TFT_WIDTH; i++)
+    {
+        line[i] = tft_rgb256_to_color565 (i, 255 - i, 128);
+    }
+
+    if (! tft_term_active ())
+    {
+        tft_init (0);
+    }
+
+    bench_header ();
+
+    tft_set_area (0, TFT_WIDTH - 1, 0, TFT_HEIGHT - 1);
+    start = boot_cycles ();
+
+    for (i = 0; i < pixels; i++)
+    {
+        tft_write_data (BLUE565);
+    }
+
+    bench_result ("tft cpu fill", pixels, 2 * pixels, boot_cycles () - start);
+
+    tft_set_area (0, TFT_WIDTH - 1, 0, TFT_HEIGHT - 1);
+    start = boot_cycles ();
+    tft_dma_fill (GREEN565, pixels);
+    tft_dma_wait ();
+    bench_result ("tft dma fill", pixels, 2 * pixels, boot_cycles () - start);
+
+    tft_set_area (0, TFT_WIDTH - 1, 0, TFT_HEIGHT - 1);
+    start = boot_cycles ();
+
+    for (i = 0; i < pixels; i += n)
+    {
+        n = (pixels - i < TFT_WIDTH) ? pixels - i : TFT_WIDTH;
+        tft_dma_write (line, n);
+    }
+
+    tft_dma_wait ();
+    bench_result ("tft dma image", pixels, 2 * pixels, boot_cycles () - start);
+
+    free (line);
+    return EXIT_SUCCESS;
+#else
+    (void) pixels;
+    fprintf (stderr, "bench: no TFT\n");
+    return EXIT_FAILURE;
+#endif
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * bench_diskio () - SD card through diskio, sequential and random, writes rewrite the data read before
+ *
+ * The STM32 SD card driver does not answer GET_SECTOR_COUNT, so only the sectors up to the end of the mounted volume are used.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+bench_diskio (uint8_t * buf, uint32_t kb, const FATFS * fsp)
+{
+    const uint32_t  chunk = BENCH_BUFSIZE / BENCH_SECTOR_SIZE;
+    DWORD           disk_sectors = 0;
+    uint32_t        sectors = kb * 1024 / BENCH_SECTOR_SIZE;
+    uint32_t        first;
+    uint32_t        sector;
+    uint32_t        cycles;
+    uint32_t        start;
+    uint32_t        i;
+
+    if (fsp->n_fatent > 2)
+    {
+        disk_sectors = fsp->database + (fsp->n_fatent - 2) * fsp->csize;        // end of the data area
+    }
+
+    if (disk_sectors == 0 || disk_sectors < 2 * sectors)
+    {
+        fprintf (stderr, "bench: SD card too small\n");
+        return EXIT_FAILURE;
+    }
+
+    first = disk_sectors / 2;
+    start = boot_cycles ();
+
+    for (i = 0; i < sectors; i += chunk)
+    {
+        if (disk_read (0, buf, first + i, chunk) != RES_OK)
+        {
+            fprintf (stderr, "bench: read error\n");
+            return EXIT_FAILURE;
+        }
+    }
+
+    bench_result ("sd seq read", sectors, sectors * BENCH_SECTOR_SIZE, boot_cycles () - start);
+
+    cycles = 0;
+
+    for (i = 0; i < sectors; i += chunk)
+    {
+        if (disk_read (0, buf, first + i, chunk) != RES_OK)
+        {
+            fprintf (stderr, "bench: read error\n");
+            return EXIT_FAILURE;
+        }
+
+        start = boot_cycles ();
+
+        if (disk_write (0, buf, first + i, chunk) != RES_OK)
+        {
+            fprintf (stderr, "bench: write error\n");
+            return EXIT_FAILURE;
+        }
+
+        cycles += boot_cycles () - start;
+    }
+
+    bench_result ("sd seq write", sectors, sectors * BENCH_SECTOR_SIZE, cycles);
+
+    start = boot_cycles ();
+
+    for (i = 0; i < sectors; i++)
+    {
+        if (disk_read (0, buf, bench_rand () % disk_sectors, 1) != RES_OK)
+        {
+            fprintf (stderr, "bench: read error\n");
+            return EXIT_FAILURE;
+        }
+    }
+
+    bench_result ("sd rand read", sectors, sectors * BENCH_SECTOR_SIZE, boot_cycles () - start);
+
+    cycles = 0;
+
+    for (i = 0; i < sectors; i++)
+    {
+        sector = bench_rand () % disk_sectors;
+
+        if (disk_read (0, buf, sector, 1) != RES_OK)
+        {
+            fprintf (stderr, "bench: read error\n");
+            return EXIT_FAILURE;
+        }
+
+        start = boot_cycles ();
+
+        if (disk_write (0, buf, sector, 1) != RES_OK)
+        {
+            fprintf (stderr, "bench: write error\n");
+            return EXIT_FAILURE;
+        }
+
+        cycles += boot_cycles () - start;
+    }
+
+    bench_result ("sd rand write", sectors, sectors * BENCH_SECTOR_SIZE, cycles);
+    return EXIT_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * bench_fatfs () - SD card through FatFs: write and read a file, then random reads and writes of single sectors
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+bench_fatfs (uint8_t * buf, uint32_t kb)
+{
+    FIL             fil;
+    FRESULT         res;
+    UINT            n;
+    uint32_t        bytes = kb * 1024;
+    uint32_t        ops = bytes / BENCH_SECTOR_SIZE;
+    uint32_t        start;
+    uint32_t        i;
+
+    res = f_open (&fil, BENCH_FNAME, FA_CREATE_ALWAYS | FA_READ | FA_WRITE);
+
+    if (res != FR_OK)
+    {
+        fprintf (stderr, "bench: cannot create %s, error %d\n", BENCH_FNAME, res);
+        return EXIT_FAILURE;
+    }
+
+    for (i = 0; i < BENCH_BUFSIZE; i++)
+    {
+        buf[i] = i;
+    }
+
+    start = boot_cycles ();
+
+    for (i = 0; res == FR_OK && i < bytes; i += BENCH_BUFSIZE)
+    {
+        res = f_write (&fil, buf, BENCH_BUFSIZE, &n);
+    }
+
+    if (res == FR_OK)
+    {
+        res = f_sync (&fil);
+    }
+
+    if (res == FR_OK)
+    {
+        bench_result ("fatfs seq write", bytes / BENCH_BUFSIZE, bytes, boot_cycles () - start);
+        res = f_lseek (&fil, 0);
+    }
+
+    start = boot_cycles ();
+
+    for (i = 0; res == FR_OK && i < bytes; i += BENCH_BUFSIZE)
+    {
+        res = f_read (&fil, buf, BENCH_BUFSIZE, &n);
+    }
+
+    if (res == FR_OK)
+    {
+        bench_result ("fatfs seq read", bytes / BENCH_BUFSIZE, bytes, boot_cycles () - start);
+    }
+
+    start = boot_cycles ();
+
+    for (i = 0; res == FR_OK && i < ops; i++)
+    {
+        res = f_lseek (&fil, (bench_rand () % ops) * BENCH_SECTOR_SIZE);
+
+        if (res == FR_OK)
+        {
+            res = f_read (&fil, buf, BENCH_SECTOR_SIZE, &n);
+        }
+    }
+
+    if (res == FR_OK)
+    {
+        bench_result ("fatfs rand read", ops, ops * BENCH_SECTOR_SIZE, boot_cycles () - start);
+    }
+
+    start = boot_cycles ();
+
+    for (i = 0; res == FR_OK && i < ops; i++)
+    {
+        res = f_lseek (&fil, (bench_rand () % ops) * BENCH_SECTOR_SIZE);
+
+        if (res == FR_OK)
+        {
+            res = f_write (&fil, buf, BENCH_SECTOR_SIZE, &n);
+        }
+    }
+
+    if (res == FR_OK)
+    {
+        res = f_sync (&fil);
+    }
+
+    if (res == FR_OK)
+    {
+        bench_result ("fatfs rand write", ops, ops * BENCH_SECTOR_SIZE, boot_cycles () - start);
+    }
+
+    f_close (&fil);
+    f_unlink (BENCH_FNAME);
+
+    if (res != FR_OK)
+    {
+        fprintf (stderr, "bench: %s: error %d\n", BENCH_FNAME, res);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * bench_sd () - SD card through diskio and FatFs
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+bench_sd (uint32_t kb)
+{
+    FATFS *     fsp;
+    DWORD       free_clusters;
+    uint8_t *   buf;
+    int         rtc;
+
+    if (f_getfree ("0:", &free_clusters, &fsp) != FR_OK)                        // mounts the card on first access
+    {
+        fprintf (stderr, "bench: SD card not mounted\n");
+        return EXIT_FAILURE;
+    }
+
+    buf = malloc (BENCH_BUFSIZE);
+
+    if (! buf)
+    {
+        fprintf (stderr, "bench: out of memory\n");
+        return EXIT_FAILURE;
+    }
+
+    kb = (kb + BENCH_BUFSIZE / 1024 - 1) & ~(BENCH_BUFSIZE / 1024 - 1);         // whole buffers
+
+    bench_header ();
+    rtc = bench_diskio (buf, kb, fsp);
+
+    if (rtc == EXIT_SUCCESS)
+    {
+        rtc = bench_fatfs (buf, kb);
+    }
+
+    free (buf);
+    return rtc;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * bench_flash () - W25Qxx fast read with DMA
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+bench_flash (uint32_t kb)
+{
+    uint8_t *   buf;
+    uint32_t    capacity = w25qxx_capacity ();
+    uint32_t    bytes = kb * 1024;
+    uint32_t    addr;
+    uint32_t    start;
+    uint32_t    i;
+
+    if (capacity == 0)
+    {
+        fprintf (stderr, "bench: no W25Qxx flash\n");
+        return EXIT_FAILURE;
+    }
+
+    buf = malloc (BENCH_BUFSIZE);
+
+    if (! buf)
+    {
+        fprintf (stderr, "bench: out of memory\n");
+        return EXIT_FAILURE;
+    }
+
+    bench_header ();
+
+    addr    = 0;
+    start   = boot_cycles ();
+
+    for (i = 0; i < bytes; i += BENCH_BUFSIZE)
+    {
+        w25qxx_read (addr, buf, BENCH_BUFSIZE);
+        addr = (addr + BENCH_BUFSIZE) % capacity;
+    }
+
+    bench_result ("flash seq read", bytes / BENCH_BUFSIZE, bytes, boot_cycles () - start);
+
+    start = boot_cycles ();
+
+    for (i = 0; i < bytes; i += BENCH_SECTOR_SIZE)
+    {
+        w25qxx_read ((bench_rand () % (capacity / BENCH_SECTOR_SIZE)) * BENCH_SECTOR_SIZE, buf, BENCH_SECTOR_SIZE);
+    }
+
+    bench_result ("flash rand read", bytes / BENCH_SECTOR_SIZE, bytes, boot_cycles () - start);
+
+    free (buf);
+    return EXIT_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * bench_uart () - UART loopback, TX must be connected to RX
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+bench_uart (uint_fast8_t uart_number, uint32_t bytes, uint32_t baudrate)
+{
+    uint_fast8_t    ch;
+    uint32_t        sent        = 0;
+    uint32_t        received    = 0;
+    uint32_t        errors      = 0;
+    uint32_t        start;
+    uint32_t        last;
+
+    uart_init (uart_number, 0, baudrate);
+
+    while (uart_poll (uart_number, &ch))                                        // flush input
+    {
+        ;
+    }
+
+    bench_header ();
+
+    start   = boot_cycles ();
+    last    = start;
+
+    while (received < bytes)
+    {
+        if (sent < bytes && sent - received < BENCH_UART_WINDOW)
+        {
+            uart_putc (uart_number, sent & 0xFF);
+            sent++;
+        }
+
+        if (uart_poll (uart_number, &ch))
+        {
+            if (ch != (received & 0xFF))
+            {
+                errors++;
+            }
+
+            received++;
+            last = boot_cycles ();
+        }
+        else if (boot_cycles () - last > SystemCoreClock / 10)                  // nothing received for 100 msec
+        {
+            break;
+        }
+    }
+
+    bench_result ("uart loopback", received, received, last - start);
+
+    if (received < bytes)
+    {
+        printf ("%lu bytes lost, TX not connected to RX?\n", bytes - received);
+    }
+
+    if (errors)
+    {
+        printf ("%lu bytes corrupted\n", errors);
+    }
+
+    return (received == bytes && errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * bench_i2c () - I2C transactions: read one byte from slave
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+bench_i2c (uint_fast8_t channel, uint_fast8_t addr, uint32_t count, uint32_t clockspeed)
+{
+    I2C_TypeDef *   i2c_channel;
+    uint8_t         data;
+    uint32_t        errors = 0;
+    uint32_t        start;
+    uint32_t        i;
+
+    switch (channel)
+    {
+        case 1:     i2c_channel = I2C1;     break;
+        case 2:     i2c_channel = I2C2;     break;
+        case 3:     i2c_channel = I2C3;     break;
+        default:    fprintf (stderr, "bench: invalid I2C channel\n");
+                    return EXIT_FAILURE;
+    }
+
+    i2c_init (i2c_channel, 0, clockspeed);
+
+    bench_header ();
+
+    start = boot_cycles ();
+
+    for (i = 0; i < count; i++)
+    {
+        if (i2c_read (i2c_channel, addr << 1, &data, 1) != I2C_OK)
+        {
+            errors++;
+        }
+    }
+
+    bench_result ("i2c read 1 byte", count, 0, boot_cycles () - start);
+
+    if (errors)
+    {
+        printf ("%lu transactions failed, no slave at address 0x%02x?\n", errors, addr);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * bench_nic () - run NIC program, count statements
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+bench_nic (int argc, const char ** argv)
+{
+    uint32_t    start;
+    uint32_t    cycles;
+    int         rtc;
+
+    nic_statements  = 0;
+    start           = boot_cycles ();
+    rtc             = cmd_nic (argc, argv);
+    cycles          = boot_cycles () - start;
+
+    bench_header ();
+    bench_result ("nic statements", nic_statements, 0, cycles);
+    return rtc;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * cmd_bench () - command: bench
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+int
+cmd_bench (int argc, const char ** argv)
+{
+    int     rtc = EXIT_FAILURE;
+
+    if (argc >= 2 && argc <= 3 && ! strcmp (argv[1], "tft"))
+    {
+        rtc = bench_tft ((argc == 3) ? atoi (argv[2]) : BENCH_TFT_PIXELS);
+    }
+    else if (argc >= 2 && argc <= 3 && ! strcmp (argv[1], "sd"))
+    {
+        rtc = bench_sd ((argc == 3) ? atoi (argv[2]) : 256);
+    }
+    else if (argc >= 2 && argc <= 3 && ! strcmp (argv[1], "flash"))
+    {
+        rtc = bench_flash ((argc == 3) ? atoi (argv[2]) : 256);
+    }
+    else if (argc >= 3 && argc <= 5 && ! strcmp (argv[1], "uart") && atoi (argv[2]) >= 2 && atoi (argv[2]) <= N_UARTS)
+    {
+        rtc = bench_uart (atoi (argv[2]) - 1, (argc >= 4) ? atoi (argv[3]) : 1024, (argc == 5) ? atoi (argv[4]) : 115200);
+    }
+    else if (argc >= 4 && argc <= 6 && ! strcmp (argv[1], "i2c"))
+    {
+        rtc = bench_i2c (atoi (argv[2]), strtol (argv[3], NULL, 0), (argc >= 5) ? atoi (argv[4]) : 1000,
+                         (argc == 6) ? atoi (argv[5]) : 100000);
+    }
+    else if (argc >= 3 && ! strcmp (argv[1], "nic"))
+    {
+        rtc = bench_nic (argc - 1, argv + 1);
+    }
+    else
+    {
+        fprintf (stderr, "usage: %s tft [pixels]\n", argv[0]);
+        fprintf (stderr, "       %s sd [KiB]\n", argv[0]);
+        fprintf (stderr, "       %s flash [KiB]\n", argv[0]);
+        fprintf (stderr, "       %s uart number [bytes [baudrate]]    (number 2-6, TX connected to RX)\n", argv[0]);
+        fprintf (stderr, "       %s i2c channel addr [count [clockspeed]]\n", argv[0]);
+        fprintf (stderr, "       %s nic file [args ...]\n", argv[0]);
+    }
+
+    return rtc;
+}
@@ -0,0 +1,294 @@
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * boot.c - boot sequencer: timed init stages, slow stages in coroutines
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ * MIT License
+ *
+ * Copyright (c) 2018-2021 Frank Meyer - frank(at)fli4l.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#include <stdio.h>
+
+#include "stm32f4xx.h"
+#include "coro.h"
+#include "boot.h"
+
+#define DWT_CTRL                    (*(volatile uint32_t *) 0xE0001000)         // not defined in our CMSIS core_cm4.h
+#define DWT_CYCCNT                  (*(volatile uint32_t *) 0xE0001004)
+#define DWT_CTRL_CYCCNTENA          0x00000001
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Every init stage in main() is timed with the DWT cycle counter. A synchronous stage runs between boot_begin() and boot_end().
+ * A slow stage is started with boot_start() in a coroutine instead: it calls coro_yield() while it waits for the hardware, and the
+ * shell resumes it with boot_poll() while it waits for console input. boot_finish() runs all async stages to completion, e.g. before
+ * a driver uses a device which is still being initialized.
+ *
+ * Times are counted from boot_init(), the cycle counter wraps after 2^32 / 168 MHz = 25 seconds.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+typedef struct
+{
+    const char *                name;
+    uint32_t                    start;                                          // cycles since boot_init()
+    uint32_t                    end;
+    uint32_t                    busy;                                           // cycles spent in the stage itself
+    uint_fast8_t                async;
+    CORO *                      coro;                                           // running async stage, else NULL
+} BOOT_STAGE;
+
+static BOOT_STAGE               boot_stages[BOOT_MAX_STAGES];
+static uint_fast8_t             boot_n_stages;
+static uint_fast8_t             boot_cur_stage = BOOT_MAX_STAGES;               // stage between boot_begin() and boot_end()
+static uint_fast8_t             boot_polling;                                   // set while an async stage runs
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * boot_init () - start cycle counter, must be called first
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+boot_init (void)
+{
+    CoreDebug->DEMCR   |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT_CYCCNT          = 0;
+    DWT_CTRL           |= DWT_CTRL_CYCCNTENA;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * boot_cycles () - get cycle counter
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint32_t
+boot_cycles (void)
+{
+    return DWT_CYCCNT;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * boot_usec () - convert cycles to microseconds
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint32_t
+boot_usec (uint32_t cycles)
+{
+    return cycles / (SystemCoreClock / 1000000);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * boot_new_stage () - allocate stage, returns BOOT_MAX_STAGES if table is full
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast8_t
+boot_new_stage (const char * name, uint_fast8_t async)
+{
+    BOOT_STAGE *    sp;
+
+    if (boot_n_stages == BOOT_MAX_STAGES)
+    {
+        return BOOT_MAX_STAGES;
+    }
+
+    sp          = boot_stages + boot_n_stages;
+    sp->name    = name;
+    sp->start   = boot_cycles ();
+    sp->end     = sp->start;
+    sp->busy    = 0;
+    sp->async   = async;
+    sp->coro    = (CORO *) NULL;
+
+    return boot_n_stages++;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * boot_begin () - begin synchronous stage
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+boot_begin (const char * name)
+{
+    boot_cur_stage = boot_new_stage (name, 0);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * boot_end () - end synchronous stage
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+boot_end (void)
+{
+    BOOT_STAGE *    sp;
+
+    if (boot_cur_stage < BOOT_MAX_STAGES)
+    {
+        sp          = boot_stages + boot_cur_stage;
+        sp->end     = boot_cycles ();
+        sp->busy    = sp->end - sp->start;
+        boot_cur_stage = BOOT_MAX_STAGES;
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * boot_resume () - resume async stage until it yields, returns 1 if it is still running
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast8_t
+boot_resume (BOOT_STAGE * sp)
+{
+    uint32_t    start = boot_cycles ();
+
+    boot_polling = 1;
+    coro_resume (sp->coro);
+    boot_polling = 0;
+
+    sp->end     = boot_cycles ();
+    sp->busy   += sp->end - start;
+
+    if (coro_done (sp->coro))
+    {
+        coro_destroy (sp->coro);
+        sp->coro = (CORO *) NULL;
+        return 0;
+    }
+
+    return 1;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * boot_start () - start async stage, func (arg) runs until its first coro_yield(). Without memory for the coroutine, the stage
+ * runs synchronously.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+boot_start (const char * name, void (*func) (void *), void * arg)
+{
+    uint_fast8_t    idx = boot_new_stage (name, 1);
+
+    if (idx < BOOT_MAX_STAGES)
+    {
+        boot_stages[idx].coro = coro_create (func, arg, BOOT_STACK_SIZE);
+
+        if (boot_stages[idx].coro)
+        {
+            boot_resume (boot_stages + idx);
+            return;
+        }
+    }
+
+    (*func) (arg);
+
+    if (idx < BOOT_MAX_STAGES)
+    {
+        boot_stages[idx].end    = boot_cycles ();
+        boot_stages[idx].busy   = boot_stages[idx].end - boot_stages[idx].start;
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * boot_mark () - record a point in time, e.g. the first prompt
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+boot_mark (const char * name)
+{
+    (void) boot_new_stage (name, 0);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * boot_poll () - resume every running async stage once, returns number of stages still running
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast8_t
+boot_poll (void)
+{
+    uint_fast8_t    idx;
+    uint_fast8_t    running = 0;
+
+    if (boot_polling)                                                           // called by an async stage: it would resume itself
+    {
+        return 0;
+    }
+
+    for (idx = 0; idx < boot_n_stages; idx++)
+    {
+        if (boot_stages[idx].coro)
+        {
+            running += boot_resume (boot_stages + idx);
+        }
+    }
+
+    return running;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * boot_finish () - run all async stages to completion
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+boot_finish (void)
+{
+    while (boot_poll ())
+    {
+        ;
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * boot_print_msec () - print cycles as milliseconds with one decimal
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+boot_print_msec (uint32_t cycles)
+{
+    uint32_t    usec = boot_usec (cycles);
+
+    printf (" %7lu.%lu", usec / 1000, (usec % 1000) / 100);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * boot_report () - print start, end and busy time of every stage in milliseconds
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+boot_report (void)
+{
+    BOOT_STAGE *    sp;
+    uint_fast8_t    idx;
+
+    printf ("%-18s %9s %9s %9s\n", "stage", "start", "end", "busy");
+
+    for (idx = 0; idx < boot_n_stages; idx++)
+    {
+        sp = boot_stages + idx;
+
+        printf ("%-12s %5s", sp->name, sp->async ? "async" : "");
+        boot_print_msec (sp->start);
+
+        if (sp->coro)
+        {
+            printf ("   running");
+        }
+        else
+        {
+            boot_print_msec (sp->end);
+        }
+
+        boot_print_msec (sp->busy);
+        printf ("\n");
+    }
+}
@@ -0,0 +1,46 @@
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * boot.h - boot sequencer: timed init stages, slow stages in coroutines
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ * MIT License
+ *
+ * Copyright (c) 2018-2021 Frank Meyer - frank(at)fli4l.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#ifndef BOOT_H
+#define BOOT_H
+
+#include <stdint.h>
+
+#define BOOT_MAX_STAGES             16
+#define BOOT_STACK_SIZE             4096                                        // stack of an async stage
+
+extern void                     boot_init (void);
+extern uint32_t                 boot_cycles (void);
+extern uint32_t                 boot_usec (uint32_t);
+extern void                     boot_begin (const char *);
+extern void                     boot_end (void);
+extern void                     boot_start (const char *, void (*) (void *), void *);
+extern void                     boot_mark (const char *);
+extern uint_fast8_t             boot_poll (void);
+extern void                     boot_finish (void);
+extern void                     boot_report (void);
+
+#endif // BOOT_H
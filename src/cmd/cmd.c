@@ -24,6 +24,7 @@
  * SOFTWARE.
  *---------------------------------------------------------------------------------------------------------------------------------------------------
  */
+#define _GNU_SOURCE                                                                             // fopencookie()
 
 #include "board-led.h"
 #include "button.h"
@@ -36,19 +37,36 @@
 #include "fs.h"
 #include "cmd.h"
 #include "timer2.h"
+#include "tft.h"
 
 #include "nic.h"
 #include "nicc.h"
 #include "nic.h"
 #include "fe.h"
+#include "ring.h"
+#include "coro.h"
+#include "boot.h"
+#include "bench.h"
 
 static uint_fast8_t     mounted;
 static char             curwd[FS_MAX_PATH_LEN]  = "/";
 static FATFS            fs;                                                             // must be static!
+static uint_fast8_t     boot_script_pending;                                            // boot script waits for async boot stages
 
 
 #define MAXARGS         32
 
+#define PIPE_SIZE           1024                                                                // size of pipe buffer, must be a power of 2
+#define PIPE_STACK_SIZE     8192                                                                // stack of left command of pipeline
+#define PIPE_FILE_BUFSIZE   128                                                                 // stdio buffer of pipe ends
+
+RING_DEFINE (pipe_ring, PIPE_SIZE);
+static CORO *           pipe_writer;                                                            // left command of pipeline
+static FILE *           pipe_in_fp;                                                             // stdin of right command
+static FILE *           pipe_out_fp;                                                            // stdout of left command
+static FILE *           pipe_saved_stdin;                                                       // stdin of left command
+static uint_fast8_t     pipe_reader_done;                                                       // right command has finished
+
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
  * date_time_print () - print date/time
  *---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -120,19 +138,47 @@ cmd_cat (int argc, const char ** argv)
         argv++;
     }
 
-    if (argc == 1)
+    if (argc == 1 && pipe_in_fp && stdin == pipe_in_fp)                        // right command of pipeline: copy pipe
+    {
+        char    buf[64];
+        size_t  n;
+
+        while ((n = fread (buf, 1, sizeof (buf), stdin)) > 0)
+        {
+            fwrite (buf, 1, n, stdout);
+        }
+
+        rtc = EXIT_SUCCESS;
+    }
+    else if (argc == 1)
     {
-        int     local_echo = 0;
-        int     ch;
-        int     last_ch = -1;
+        char            buf[64];
+        uint_fast16_t   n = 0;
+        uint_fast16_t   i = 0;
+        int             local_echo = 0;
+        int             ch;
+        int             last_ch = -1;
 
         if (! do_not_echo && ! isatty (fileno (stdout)))
         {
             local_echo = 1;
         }
 
-        while ((ch = console_getc ()) != KEY_CTRL('D'))
+        while (1)
         {
+            if (i == n)                                                         // read all characters received so far
+            {
+                n = console_read (buf, sizeof (buf));
+                i = 0;
+            }
+
+            ch = (unsigned char) buf[i++];
+
+            if (ch == KEY_CTRL('D'))
+            {
+                break;
+            }
+
             if (local_echo)
             {
                 console_putc (ch);
@@ -221,7 +267,19 @@ cmd_cd (int argc, const char ** argv)
 
         // console_printf ("chdir vorher: '%s'\r\n", name);
 
-        res = f_chdir(name);
+        if (name[0] && name[1] == ':')                                              // drive prefix, e.g. "1:/tmp"
+        {
+            res = f_chdrive (name);
+
+            if (res == FR_OK && name[2])
+            {
+                res = f_chdir(name);
+            }
+        }
+        else
+        {
+            res = f_chdir(name);
+        }
 
         // console_printf ("chdir '%s', res=%d\r\n", name, res);
 
@@ -252,6 +310,28 @@ cmd_cd (int argc, const char ** argv)
     return rtc;
 }
 
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * cmd_boottime () - command: boottime
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+cmd_boottime (int argc, const char ** argv)
+{
+    int         rtc = EXIT_FAILURE;
+
+    if (argc == 1)
+    {
+        boot_report ();
+        rtc = EXIT_SUCCESS;
+    }
+    else
+    {
+        fprintf (stderr, "usage: %s\n", argv[0]);
+    }
+
+    return rtc;
+}
+
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
  * cmd_clocks () - command: clocks
  *---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -281,6 +361,47 @@ cmd_clocks (int argc, const char ** argv)
     return rtc;
 }
 
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * cmd_console () - command: console
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+cmd_console (int argc, const char ** argv)
+{
+    int         rtc = EXIT_FAILURE;
+
+    if (argc >= 2 && argc <= 4 && ! strcmp (argv[1], "tft"))
+    {
+        int font        = (argc >= 3) ? atoi (argv[2]) : -1;                            // -1: choose font for 80 columns
+        int orientation = (argc == 4) ? atoi (argv[3]) : 0;
+
+        tft_term_stop ();
+        tft_init (orientation);
+        tft_term_start (font);
+
+        if (tft_term_active ())
+        {
+            printf ("TFT console: %d lines, %d columns\n", tft_term_get_rows (), tft_term_get_cols ());
+            rtc = EXIT_SUCCESS;
+        }
+        else
+        {
+            fprintf (stderr, "%s: no TFT\n", argv[0]);
+        }
+    }
+    else if (argc == 2 && ! strcmp (argv[1], "uart"))
+    {
+        tft_term_stop ();
+        rtc = EXIT_SUCCESS;
+    }
+    else
+    {
+        fprintf (stderr, "usage: %s tft [font [orientation]] | uart\n", argv[0]);
+    }
+
+    return rtc;
+}
+
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
  * cmd_cp () - command: cp
  *---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -430,9 +551,9 @@ cmd_df (int argc, const char ** argv)
     FRESULT     res;
     int         rtc = EXIT_FAILURE;
 
-    if (argc == 1)
+    if (argc == 1 || argc == 2)
     {
-        res = fs_df ();
+        res = fs_df (argc == 2 ? argv[1] : "0:");
 
         if (res == FR_OK)
         {
@@ -445,7 +566,7 @@ cmd_df (int argc, const char ** argv)
     }
     else
     {
-        fprintf (stderr, "usage: %s\n", argv[0]);
+        fprintf (stderr, "usage: %s [drive:]\n", argv[0]);
     }
 
     return rtc;
@@ -933,9 +1054,35 @@ cmd_mount (int argc, const char ** argv)
     {
         rtc = do_mount ();
     }
+    else if ((argc == 2 || argc == 3) && ! strcmp (argv[1], "ram"))
+    {
+        uint32_t kb = (argc == 3) ? atoi (argv[2]) : 0;                             // 0: use CCM RAM
+
+        if (fs_ram_mount (kb * 1024) == 0)
+        {
+            printf ("RAM disk mounted as 1:\n");
+            rtc = EXIT_SUCCESS;
+        }
+        else
+        {
+            rtc = EXIT_FAILURE;
+        }
+    }
+    else if (argc == 2 && ! strcmp (argv[1], "flash"))
+    {
+        if (fs_flash_mount () == 0)
+        {
+            printf ("flash mounted as 2:\n");
+            rtc = EXIT_SUCCESS;
+        }
+        else
+        {
+            rtc = EXIT_FAILURE;
+        }
+    }
     else
     {
-        fprintf (stderr, "usage: %s\n", argv[0]);
+        fprintf (stderr, "usage: %s [ram [KiB] | flash]\n", argv[0]);
         rtc = EXIT_FAILURE;
     }
 
@@ -952,9 +1099,21 @@ cmd_umount (int argc, const char ** argv)
         do_umount ();
         rtc = EXIT_SUCCESS;
     }
+    else if (argc == 2 && ! strcmp (argv[1], "ram"))
+    {
+        fs_ram_umount ();
+        printf ("RAM disk umounted\n");
+        rtc = EXIT_SUCCESS;
+    }
+    else if (argc == 2 && ! strcmp (argv[1], "flash"))
+    {
+        fs_flash_umount ();
+        printf ("flash umounted\n");
+        rtc = EXIT_SUCCESS;
+    }
     else
     {
-        fprintf (stderr, "usage: %s\n", argv[0]);
+        fprintf (stderr, "usage: %s [ram | flash]\n", argv[0]);
         rtc = EXIT_FAILURE;
     }
 
@@ -1026,7 +1185,15 @@ cmd_start (int argc, const char ** argv, const char * stdout_file, int stdout_ap
     }
 #endif
 
-    if (! strcmp (command, "cat"))
+    if (! strcmp (command, "bench"))
+    {
+        rtc = cmd_bench (argc, argv);
+    }
+    else if (! strcmp (command, "boottime"))
+    {
+        rtc = cmd_boottime (argc, argv);
+    }
+    else if (! strcmp (command, "cat"))
     {
         rtc = cmd_cat (argc, argv);
     }
@@ -1038,6 +1205,10 @@ cmd_start (int argc, const char ** argv, const char * stdout_file, int stdout_ap
     {
         rtc = cmd_clocks (argc, argv);
     }
+    else if (! strcmp (command, "console"))
+    {
+        rtc = cmd_console (argc, argv);
+    }
     else if (! strcmp (command, "cp"))
     {
         rtc = cmd_cp (argc, argv);
@@ -1200,6 +1371,155 @@ cmd_start (int argc, const char ** argv, const char * stdout_file, int stdout_ap
     return rtc;
 }
 
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Pipeline "a | b":
+ *
+ * The right command b runs as usual, the left command a runs as coroutine on its own stack. a writes into pipe_out_fp, b reads from
+ * pipe_in_fp, both are stdio streams on pipe_ring. If the ring is full, the writer yields to the reader, if it is empty, the reader
+ * resumes the writer. When b has finished, a is run to its end and its output is discarded. Each side has its own stdio stream, so
+ * a coroutine suspended within a stdio function does not share buffers with the other side.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+typedef struct
+{
+    int             argc;
+    const char **   argv;
+    int             rtc;
+} PIPE_CMD;
+
+static void
+pipe_run_writer (void)
+{
+    FILE *  in  = stdin;
+    FILE *  out = stdout;
+
+    stdin   = pipe_saved_stdin;
+    stdout  = pipe_out_fp;
+    coro_resume (pipe_writer);
+    stdin   = in;
+    stdout  = out;
+}
+
+static ssize_t
+pipe_read (void * cookie, char * buf, size_t n)
+{
+    uint_fast16_t   len;
+
+    (void) cookie;
+
+    if (n > PIPE_SIZE)
+    {
+        n = PIPE_SIZE;
+    }
+
+    while ((len = ring_read (&pipe_ring, (uint8_t *) buf, n)) == 0)
+    {
+        if (coro_done (pipe_writer))
+        {
+            return 0;                                                                           // EOF
+        }
+
+        pipe_run_writer ();
+    }
+
+    return len;
+}
+
+static ssize_t
+pipe_write (void * cookie, const char * buf, size_t n)
+{
+    size_t  done = 0;
+
+    (void) cookie;
+
+    while (done < n && ! pipe_reader_done)                                                      // nobody reads: discard
+    {
+        done += ring_write (&pipe_ring, (const uint8_t *) buf + done, n - done);
+
+        if (done < n)
+        {
+            coro_yield ();                                                                      // pipe full
+        }
+    }
+
+    return n;
+}
+
+static void
+pipe_writer_start (void * arg)
+{
+    PIPE_CMD *  pc = arg;
+
+    pc->rtc = cmd_start (pc->argc, pc->argv, (char *) NULL, 0, (char *) NULL, 0);
+    fflush (stdout);                                                                            // stdout is pipe_out_fp here
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * cmd_start_pipe () - start pipeline, redirections apply to the right command, returns exit code of right command
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+cmd_start_pipe (int argc1, const char ** argv1, int argc2, const char ** argv2,
+                const char * stdout_file, int stdout_append, const char * stderr_file, int stderr_append)
+{
+    static char                     in_buf[PIPE_FILE_BUFSIZE];
+    static char                     out_buf[PIPE_FILE_BUFSIZE];
+    static cookie_io_functions_t    in_functions    = { pipe_read, NULL, NULL, NULL };
+    static cookie_io_functions_t    out_functions   = { NULL, pipe_write, NULL, NULL };
+    PIPE_CMD                        left            = { argc1, argv1, EXIT_FAILURE };
+    int                             rtc             = EXIT_FAILURE;
+
+    if (pipe_writer)
+    {
+        fputs ("pipe: nested pipelines are not supported\n", stderr);
+        return EXIT_FAILURE;
+    }
+
+    ring_reset (&pipe_ring);
+    pipe_reader_done    = 0;
+    pipe_in_fp          = fopencookie (NULL, "r", in_functions);
+    pipe_out_fp         = fopencookie (NULL, "w", out_functions);
+    pipe_writer         = coro_create (pipe_writer_start, &left, PIPE_STACK_SIZE);
+
+    if (pipe_in_fp && pipe_out_fp && pipe_writer)
+    {
+        setvbuf (pipe_in_fp, in_buf, _IOFBF, PIPE_FILE_BUFSIZE);
+        setvbuf (pipe_out_fp, out_buf, _IOFBF, PIPE_FILE_BUFSIZE);
+
+        pipe_saved_stdin    = stdin;
+        stdin               = pipe_in_fp;
+        rtc                 = cmd_start (argc2, argv2, stdout_file, stdout_append, stderr_file, stderr_append);
+        stdin               = pipe_saved_stdin;
+
+        pipe_reader_done = 1;
+
+        while (! coro_done (pipe_writer))
+        {
+            pipe_run_writer ();
+        }
+    }
+    else
+    {
+        fputs ("pipe: not enough memory\n", stderr);
+    }
+
+    if (pipe_in_fp)
+    {
+        fclose (pipe_in_fp);
+        pipe_in_fp = (FILE *) NULL;
+    }
+
+    if (pipe_out_fp)
+    {
+        fclose (pipe_out_fp);
+        pipe_out_fp = (FILE *) NULL;
+    }
+
+    coro_destroy (pipe_writer);
+    pipe_writer = (CORO *) NULL;
+    return rtc;
+}
+
 #define MAX_HISTORY         16
 #define MAX_HISTORY_BUFLEN  80
 static char                 history[MAX_HISTORY][MAX_HISTORY_BUFLEN];
@@ -1242,6 +1562,29 @@ cmd_arg_identical (const char * pattern, const char *s2, int minlen)
     return n;
 }
 
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * cmd_getch () - get key, run async boot stages while waiting. Returns KEY_CR when they are done and the input line is empty,
+ * so that cmd() can start the boot script.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast8_t
+cmd_getch (uint_fast8_t empty)
+{
+    while (boot_script_pending && console_get_rxsize () == 0)
+    {
+        if (boot_poll () == 0)
+        {
+            if (empty)
+            {
+                return KEY_CR;
+            }
+            break;
+        }
+    }
+
+    return getch ();
+}
+
 static void
 cmd_getnstr (const char * prompt, char * str, uint_fast8_t maxlen)
 {
@@ -1260,7 +1603,7 @@ cmd_getnstr (const char * prompt, char * str, uint_fast8_t maxlen)
 
     console_puts (prompt);
 
-    while ((ch = getch ()) != KEY_CR)
+    while ((ch = cmd_getch (curlen == 0)) != KEY_CR)
     {
         if (ch == KEY_TAB && last_ch == KEY_TAB)
         {
@@ -1602,6 +1945,7 @@ cmd (char * cmdline)
     int             idx;
     int             stdout_append = 0;
     int             stderr_append = 0;
+    int             pipe_idx = 0;
     char *          stdout_file  = (char *) NULL;
     char *          stderr_file  = (char *) NULL;
     char *          p = strchr (buf, '\n');
@@ -1609,9 +1953,15 @@ cmd (char * cmdline)
     if (! already_called)
     {
         already_called = 1;
+        f_mount (&fs, "", 0);                                                       // lazy: FatFs mounts on first file access
+        boot_script_pending = 1;
+        boot_mark ("prompt");
+    }
 
-        do_mount ();
-
+    if (boot_script_pending && boot_poll () == 0)                                   // SD card identified?
+    {
+        boot_script_pending = 0;
+        boot_report ();
         fp_boot = fopen ("boot", "r");
     }
 
@@ -1861,6 +2211,18 @@ cmd (char * cmdline)
                             valid = 0;
                         }
                     }
+                    else if (*p == '|' && (*(p + 1) == ' ' || *(p + 1) == '\0'))
+                    {
+                        if (pipe_idx == 0 && argc > 0)
+                        {
+                            pipe_idx = argc;                                                    // right command starts at argv[pipe_idx]
+                        }
+                        else
+                        {
+                            console_puts ("only one pipe allowed\r\n");
+                            valid = 0;
+                        }
+                    }
                     else
                     {
                         if (argc < MAXARGS - 1)
@@ -1882,7 +2244,19 @@ cmd (char * cmdline)
 
     if (valid)
     {
-        if (argv[0][0])
+        if (pipe_idx > 0)
+        {
+            if (argv[0][0] && pipe_idx < argc)
+            {
+                cmd_start_pipe (pipe_idx, (const char **) argv, argc - pipe_idx, (const char **) argv + pipe_idx,
+                                stdout_file, stdout_append, stderr_file, stderr_append);
+            }
+            else
+            {
+                console_puts ("missing command in pipe\r\n");
+            }
+        }
+        else if (argv[0][0])
         {
             cmd_start (argc, (const char **) argv, stdout_file, stdout_append, stderr_file, stderr_append);
         }
@@ -30,3 +30,95 @@
 #include "console-uart.h"
 
 #include "mcurses.h"
+#include "tft.h"
+
+#define CONSOLE_STRBUF_SIZE     256                                             // console_printf buffer size
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * console_putc () - put a character on UART and TFT terminal
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+console_putc (uint_fast8_t ch)
+{
+    uart_putc (UART_NUMBER_1, ch);
+
+    if (tft_term_active ())
+    {
+        tft_term_putc (ch);
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * console_puts () - put a string on UART and TFT terminal
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+console_puts (const char * s)
+{
+    uart_puts (UART_NUMBER_1, s);
+
+    if (tft_term_active ())
+    {
+        while (*s)
+        {
+            tft_term_putc ((uint_fast8_t) *s++);
+        }
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * console_printf () - print a formatted message on UART and TFT terminal
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+int
+console_printf (const char * fmt, ...)
+{
+    static char str_buf[CONSOLE_STRBUF_SIZE];
+    int         len;
+    va_list     ap;
+
+    va_start (ap, fmt);
+    len = vsnprintf (str_buf, CONSOLE_STRBUF_SIZE, fmt, ap);
+    va_end (ap);
+
+    console_puts (str_buf);
+    return len;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * console_write () - write a buffer to UART and TFT terminal
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast16_t
+console_write (char * buf, uint_fast16_t n)
+{
+    uint_fast16_t   rtc = uart_write (UART_NUMBER_1, buf, n);
+    uint_fast16_t   i;
+
+    if (tft_term_active ())
+    {
+        for (i = 0; i < n; i++)
+        {
+            tft_term_putc ((uint_fast8_t) buf[i]);
+        }
+    }
+
+    return rtc;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * console_get_size () - get size of TFT terminal, returns 0 if TFT terminal is not started
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast8_t
+console_get_size (uint_fast8_t * linesp, uint_fast8_t * colsp)
+{
+    if (tft_term_active ())
+    {
+        *linesp = tft_term_get_rows ();
+        *colsp  = tft_term_get_cols ();
+        return 1;
+    }
+    return 0;
+}
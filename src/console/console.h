@@ -29,9 +29,6 @@
 #include "uart.h"
 
 #define console_init(b)             uart_init           (UART_NUMBER_1, 0, (b))
-#define console_putc(ch)            uart_putc           (UART_NUMBER_1, (ch))
-#define console_puts(s)             uart_puts           (UART_NUMBER_1, (s))
-#define console_printf(fmt, ...)    uart_printf         (UART_NUMBER_1, (fmt), __VA_ARGS__)
 #define console_getc()              uart_getc           (UART_NUMBER_1)
 #define console_poll(p)             uart_poll           (UART_NUMBER_1, (p))
 #define console_interrupted()       uart_interrupted    (UART_NUMBER_1)
@@ -39,5 +36,10 @@
 #define console_get_rxsize()        uart_get_rxsize     (UART_NUMBER_1)
 #define console_flush()             uart_flush          (UART_NUMBER_1)
 #define console_read(buf,n)         uart_read           (UART_NUMBER_1, (buf), (n))
-#define console_write(buf,n)        uart_write          (UART_NUMBER_1, (buf), (n))
+
+extern void                 console_putc        (uint_fast8_t);                 // output also goes to TFT terminal, if started
+extern void                 console_puts        (const char *);
+extern int                  console_printf      (const char *, ...);
+extern uint_fast16_t        console_write       (char *, uint_fast16_t);
+extern uint_fast8_t         console_get_size    (uint_fast8_t *, uint_fast8_t *);
 
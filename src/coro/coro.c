@@ -0,0 +1,220 @@
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * coro.c - coroutines with own stack
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ * MIT License
+ *
+ * Copyright (c) 2018-2021 Frank Meyer - frank(at)fli4l.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#include <stdlib.h>
+#include "coro.h"
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * A coroutine runs a function on its own stack. coro_resume() switches to the coroutine until it calls coro_yield() or its function
+ * returns, coro_yield() switches back to the caller of coro_resume(). Nothing is preemptive, so no locking is needed between caller
+ * and coroutine. A coroutine may resume another one, e.g. boot_finish() called by a pipeline stage: coro_yield() of the inner one
+ * returns to the outer one, which is the current coroutine again afterwards.
+ *
+ * STM32: coro_switch() saves the callee saved registers (and FPU registers if used) on the current stack, exchanges the stack pointer
+ * and restores the registers from the new stack. Interrupts use the stack of the running coroutine, too.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static CORO *                   coro_current;
+
+#ifdef unix
+
+static void
+coro_entry (void)
+{
+    CORO *  c = coro_current;
+
+    (*c->func) (c->arg);
+    c->state = CORO_STATE_DONE;                                                 // back to caller_ctx via uc_link
+}
+
+#else // STM32
+
+#if defined (__VFP_FP__) && ! defined (__SOFTFP__)
+#define CORO_FPU_REGS               16                                          // s16 - s31
+#else
+#define CORO_FPU_REGS               0
+#endif
+
+#define CORO_FRAME_REGS             (CORO_FPU_REGS + 9)                         // [s16 - s31,] r4 - r11, lr
+
+static CORO *                   coro_main;                                      // coroutine resumed outside of coroutines, see coro_main_sp()
+
+static void __attribute__((naked, noinline))
+coro_switch (void ** save_sp __attribute__((unused)), void * new_sp __attribute__((unused)))
+{
+    __asm volatile
+    (
+        "push   {r4-r11, lr}        \n"
+#if CORO_FPU_REGS > 0
+        "vpush  {s16-s31}           \n"
+#endif
+        "mov    r2, sp              \n"
+        "str    r2, [r0]            \n"
+        "mov    sp, r1              \n"
+#if CORO_FPU_REGS > 0
+        "vpop   {s16-s31}           \n"
+#endif
+        "pop    {r4-r11, pc}        \n"
+    );
+}
+
+static void
+coro_entry (void)
+{
+    CORO *  c = coro_current;
+
+    (*c->func) (c->arg);
+    c->state = CORO_STATE_DONE;
+    coro_switch (&c->sp, c->caller_sp);                                         // never returns
+}
+
+#endif // unix
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * coro_create () - create coroutine, func (arg) is called by first coro_resume(), returns NULL if out of memory
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+CORO *
+coro_create (void (*func) (void *), void * arg, uint32_t stacksize)
+{
+    CORO *  c = malloc (sizeof (CORO));
+
+    if (c)
+    {
+        c->func     = func;
+        c->arg      = arg;
+        c->state    = CORO_STATE_NEW;
+        c->stack    = malloc (stacksize);
+
+        if (! c->stack)
+        {
+            free (c);
+            return (CORO *) NULL;
+        }
+
+#ifdef unix
+        getcontext (&c->ctx);
+        c->ctx.uc_stack.ss_sp   = c->stack;
+        c->ctx.uc_stack.ss_size = stacksize;
+        c->ctx.uc_link          = &c->caller_ctx;
+        makecontext (&c->ctx, coro_entry, 0);
+#else
+        uint32_t *  sp = (uint32_t *) (((uintptr_t) c->stack + stacksize) & ~(uintptr_t) 7);     // AAPCS: 8 byte aligned
+        int         i;
+
+        *--sp = (uint32_t) coro_entry;                                          // lr, popped into pc
+
+        for (i = 0; i < CORO_FRAME_REGS - 1; i++)
+        {
+            *--sp = 0;
+        }
+
+        c->sp = sp;
+#endif
+    }
+
+    return c;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * coro_resume () - run coroutine until it yields or returns
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+coro_resume (CORO * c)
+{
+    CORO *  caller = coro_current;                                              // NULL if not called by a coroutine
+
+    if (c->state == CORO_STATE_NEW || c->state == CORO_STATE_SUSPENDED)
+    {
+        coro_current    = c;
+        c->state        = CORO_STATE_RUNNING;
+#ifdef unix
+        swapcontext (&c->caller_ctx, &c->ctx);
+#else
+        if (! caller)
+        {
+            coro_main = c;
+        }
+
+        coro_switch (&c->caller_sp, c->sp);
+
+        if (! caller)
+        {
+            coro_main = (CORO *) NULL;
+        }
+#endif
+        coro_current    = caller;
+    }
+}
+
+#ifndef unix
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * coro_main_sp () - stack pointer of the main stack while a coroutine runs, NULL if no coroutine runs
+ *
+ * The stacks of the coroutines are allocated on the heap, so _sbrk() must limit the heap by this one instead of the current one.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void *
+coro_main_sp (void)
+{
+    return coro_main ? coro_main->caller_sp : (void *) NULL;
+}
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * coro_yield () - back to caller of coro_resume(), returns when resumed again. Does nothing outside of a coroutine.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+coro_yield (void)
+{
+    CORO *  c = coro_current;
+
+    if (c)
+    {
+        c->state = CORO_STATE_SUSPENDED;
+#ifdef unix
+        swapcontext (&c->ctx, &c->caller_ctx);
+#else
+        coro_switch (&c->sp, c->caller_sp);
+#endif
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * coro_destroy () - free coroutine, must not be suspended: its function would never return
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+coro_destroy (CORO * c)
+{
+    if (c)
+    {
+        free (c->stack);
+        free (c);
+    }
+}
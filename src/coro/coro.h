@@ -0,0 +1,66 @@
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * coro.h - coroutines with own stack
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ * MIT License
+ *
+ * Copyright (c) 2018-2021 Frank Meyer - frank(at)fli4l.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#ifndef CORO_H
+#define CORO_H
+
+#include <stdint.h>
+
+#ifdef unix
+#include <ucontext.h>
+#endif
+
+#define CORO_STATE_NEW              0
+#define CORO_STATE_SUSPENDED        1                                           // waiting in coro_yield()
+#define CORO_STATE_RUNNING          2
+#define CORO_STATE_DONE             3                                           // function has returned
+
+typedef struct
+{
+    void                        (*func) (void *);
+    void *                      arg;
+    uint8_t *                   stack;
+    uint_fast8_t                state;
+#ifdef unix
+    ucontext_t                  ctx;
+    ucontext_t                  caller_ctx;
+#else
+    void *                      sp;                                             // stack pointer of coroutine while not running
+    void *                      caller_sp;                                      // stack pointer of caller while coroutine runs
+#endif
+} CORO;
+
+#define coro_done(c)                ((c)->state == CORO_STATE_DONE)
+
+extern CORO *                   coro_create (void (*) (void *), void *, uint32_t);
+extern void                     coro_resume (CORO *);
+extern void                     coro_yield (void);
+extern void                     coro_destroy (CORO *);
+#ifndef unix
+extern void *                   coro_main_sp (void);
+#endif
+
+#endif // CORO_H
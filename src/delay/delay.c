@@ -27,6 +27,8 @@
 #include <stdint.h>
 #include "delay.h"
 
+#ifndef unix
+
 static uint_fast8_t         resolution  = DELAY_DEFAULT_RESOLUTION;             // resolution in usec, see delay.h for default
 static uint32_t             msec_factor = 1000 / DELAY_DEFAULT_RESOLUTION;      // factor for msec delays
 
@@ -133,3 +135,60 @@ delay_init (uint_fast8_t res)
     SysTick_Config (SystemCoreClock / divider);
     resolution = res;
 }
+
+#else // unix
+
+#include <unistd.h>
+#include <sys/time.h>
+
+volatile uint32_t           delay_counter;                                      // unused on host
+static struct timeval       timeout;
+
+void
+delay_usec (uint32_t usec)
+{
+    usleep (usec);
+}
+
+void
+delay_msec (uint32_t msec)
+{
+    usleep (msec * 1000);
+}
+
+void
+delay_set_timout (uint32_t msec)
+{
+    gettimeofday (&timeout, (struct timezone *) 0);
+    timeout.tv_sec  += msec / 1000;
+    timeout.tv_usec += (msec % 1000) * 1000;
+
+    if (timeout.tv_usec >= 1000000)
+    {
+        timeout.tv_sec++;
+        timeout.tv_usec -= 1000000;
+    }
+}
+
+int
+delay_got_timeout (void)
+{
+    struct timeval  now;
+
+    gettimeofday (&now, (struct timezone *) 0);
+    return timercmp (&now, &timeout, <) ? 0 : 1;
+}
+
+void
+delay_sec (uint32_t sec)
+{
+    sleep (sec);
+}
+
+void
+delay_init (uint_fast8_t res)
+{
+    (void) res;
+}
+
+#endif // unix
@@ -27,8 +27,12 @@
 #ifndef DELAY_H
 #define DELAY_H
 
+#ifdef unix
+#include <stdint.h>
+#else
 #include "stm32f4xx.h"
 #include "stm32f4xx_rcc.h"
+#endif
 
 // resolution of delay functions
 #define DELAY_RESOLUTION_1_US             1
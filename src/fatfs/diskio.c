@@ -7,15 +7,25 @@
 /* storage control modules to the FatFs module with a defined API.       */
 /*-----------------------------------------------------------------------*/
 
+#include "ff.h"			/* FF_MAX_SS */
 #include "diskio.h"		/* FatFs lower layer API */
 
 /* Definitions of physical drive number for each drive */
 #define DEV_MMC		0	/* Map MMC/SD card to physical drive 0 */
 #define DEV_RAM		1	/* Map Ramdisk to physical drive 1 */
-#define DEV_USB		2	/* Map USB MSD to physical drive 2 */
+#define DEV_FLASH	2	/* Map W25Qxx SPI flash to physical drive 2 */
+#define DEV_USB		3	/* Map USB MSD to physical drive 3 */
 
+#include <string.h>
+#include "w25qxx_ftl.h"
+
+#ifdef unix
+#include <stdio.h>
+#include <time.h>
+#else
 #include "stm32_sdcard.h"
 #include "stm32f4-rtc.h"
+#endif
 
 #ifdef __GNUC__
 #  define UNUSED(x)         UNUSED_ ## x __attribute__((__unused__))
@@ -28,8 +38,14 @@ get_fattime (void)
 {
     struct tm   tm;
     DWORD       rtc = 0;
+#ifdef unix
+    time_t      now = time ((time_t *) NULL);
+    int         ok  = (localtime_r (&now, &tm) != NULL);
+#else
+    int         ok  = (stm32f4_rtc_get (&tm) == SUCCESS);
+#endif
 
-    if (stm32f4_rtc_get (&tm) == SUCCESS)
+    if (ok)
     {
         rtc = ((tm.tm_year - 80)    << 25) |                   // year since 1980
               ((tm.tm_mon + 1)      << 21) |
@@ -51,6 +67,152 @@ get_fattime (void)
     return rtc;
 }
 
+#ifdef unix
+/*-----------------------------------------------------------------------*/
+/* Disk image (unix)                                                     */
+/*-----------------------------------------------------------------------*/
+/* Replaces the SD card on the host. Every command is charged with a     */
+/* simulated latency plus a cost per sector, see DISKIO_SIM in diskio.h. */
+/*-----------------------------------------------------------------------*/
+
+DISKIO_SIM      diskio_sim =
+{
+    DISKIO_SIM_CMD_USEC, DISKIO_SIM_WCMD_USEC, DISKIO_SIM_SECTOR_USEC, 0,
+    0, 0, 0, 0, 0
+};
+
+static FILE *   image_fp;
+
+int
+diskio_image_open (const char * fname)
+{
+    if (image_fp)
+    {
+        fclose (image_fp);
+    }
+
+    image_fp = fopen (fname, "r+b");
+    return image_fp ? 0 : -1;
+}
+
+void
+diskio_image_close (void)
+{
+    if (image_fp)
+    {
+        fclose (image_fp);
+        image_fp = (FILE *) NULL;
+    }
+}
+
+static void
+diskio_sim_charge (unsigned long cmd_usec, UINT count)
+{
+    unsigned long   usec = cmd_usec + count * diskio_sim.sector_usec;
+
+    diskio_sim.busy_usec += usec;
+
+    if (diskio_sim.sleep && usec > 0)
+    {
+        struct timespec ts;
+
+        ts.tv_sec   = usec / 1000000;
+        ts.tv_nsec  = (usec % 1000000) * 1000;
+        nanosleep (&ts, (struct timespec *) NULL);
+    }
+}
+
+static int
+MMC_disk_initialize (void)
+{
+    return image_fp ? 0 : -1;
+}
+
+static int
+MMC_disk_status (void)
+{
+    return image_fp ? 0 : -1;
+}
+
+static int
+MMC_disk_read (BYTE * buff, DWORD sector, UINT count)
+{
+    if (! image_fp || fseek (image_fp, (long) sector * FF_MAX_SS, SEEK_SET) != 0)
+    {
+        return -1;
+    }
+
+    if (fread (buff, FF_MAX_SS, count, image_fp) != count)
+    {
+        memset (buff, 0, count * FF_MAX_SS);                        // beyond end of a sparse image
+    }
+
+    diskio_sim.read_cmds++;
+    diskio_sim.sectors_read += count;
+    diskio_sim_charge (diskio_sim.cmd_usec, count);
+    return 0;
+}
+
+static int
+MMC_disk_write (const BYTE * buff, DWORD sector, UINT count)
+{
+    if (! image_fp || fseek (image_fp, (long) sector * FF_MAX_SS, SEEK_SET) != 0 ||
+        fwrite (buff, FF_MAX_SS, count, image_fp) != count)
+    {
+        return -1;
+    }
+
+    diskio_sim.write_cmds++;
+    diskio_sim.sectors_written += count;
+    diskio_sim_charge (diskio_sim.wcmd_usec, count);
+    return 0;
+}
+#endif // unix
+
+/*-----------------------------------------------------------------------*/
+/* RAM disk                                                              */
+/*-----------------------------------------------------------------------*/
+
+static BYTE *   ram_disk_mem;
+static DWORD    ram_disk_sectors;
+
+void
+ram_disk_init (BYTE * mem, DWORD sectors)
+{
+    ram_disk_mem        = mem;
+    ram_disk_sectors    = sectors;
+}
+
+static int
+RAM_disk_status (void)
+{
+    return ram_disk_mem ? 0 : -1;
+}
+
+static int
+RAM_disk_read (BYTE * buff, DWORD sector, UINT count)
+{
+    if (! ram_disk_mem || sector + count > ram_disk_sectors)
+    {
+        return -1;
+    }
+
+    memcpy (buff, ram_disk_mem + sector * FF_MAX_SS, count * FF_MAX_SS);
+    return 0;
+}
+
+static int
+RAM_disk_write (const BYTE * buff, DWORD sector, UINT count)
+{
+    if (! ram_disk_mem || sector + count > ram_disk_sectors)
+    {
+        return -1;
+    }
+
+    memcpy (ram_disk_mem + sector * FF_MAX_SS, buff, count * FF_MAX_SS);
+    return 0;
+}
+
 /*-----------------------------------------------------------------------*/
 /* Get Drive Status                                                      */
 /*-----------------------------------------------------------------------*/
@@ -63,14 +225,35 @@ DSTATUS disk_status (
 	int result;
 
 	switch (pdrv) {
-#if 0
 	case DEV_RAM :
 		result = RAM_disk_status();
 
-		// translate the reslut code here
+        // translate the result code here
+        if(result == 0)
+        {
+            stat = 0;
+        }
+        else
+        {
+            stat = STA_NODISK | STA_NOINIT;
+        }
+
+		return stat;
+
+	case DEV_FLASH :
+		result = w25qxx_ftl_sectors() ? 0 : -1;
+
+        // translate the result code here
+        if(result == 0)
+        {
+            stat = 0;
+        }
+        else
+        {
+            stat = STA_NOINIT;
+        }
 
 		return stat;
-#endif
 
 	case DEV_MMC :
 		result = MMC_disk_status();
@@ -112,14 +295,36 @@ DSTATUS disk_initialize (
 	int result;
 
 	switch (pdrv) {
-#if 0
 	case DEV_RAM :
-		result = RAM_disk_initialize();
+		result = RAM_disk_status();                     // nothing to initialize, memory is assigned by ram_disk_init()
 
-		// translate the reslut code here
+        // translate the result code here
+        if(result == 0)
+        {
+            stat = 0;
+        }
+        else
+        {
+            stat = STA_NOINIT;
+        }
 
 		return stat;
-#endif
+
+	case DEV_FLASH :
+		result = w25qxx_ftl_sectors() ? 0 : w25qxx_ftl_mount();            // scan flash only once
+
+        // translate the result code here
+        if(result == 0)
+        {
+            stat = 0;
+        }
+        else
+        {
+            stat = STA_NOINIT;
+        }
+
+		return stat;
+
 	case DEV_MMC :
 		result = MMC_disk_initialize();
 
@@ -164,16 +369,35 @@ DRESULT disk_read (
 	int result;
 
 	switch (pdrv) {
-#if 0
 	case DEV_RAM :
-		// translate the arguments here
-
 		result = RAM_disk_read(buff, sector, count);
 
-		// translate the reslut code here
+        // translate the result code here
+        if (result == 0)
+        {
+            res = RES_OK;
+        }
+        else
+        {
+            res = RES_ERROR;
+        }
+
+		return res;
+
+	case DEV_FLASH :
+		result = w25qxx_ftl_read(buff, sector, count);
+
+        // translate the result code here
+        if (result == 0)
+        {
+            res = RES_OK;
+        }
+        else
+        {
+            res = RES_ERROR;
+        }
 
 		return res;
-#endif
 
 	case DEV_MMC :
 		// translate the arguments here
@@ -224,16 +448,35 @@ DRESULT disk_write (
 	int result;
 
 	switch (pdrv) {
-#if 0
 	case DEV_RAM :
-		// translate the arguments here
-
 		result = RAM_disk_write(buff, sector, count);
 
-		// translate the reslut code here
+        // translate the result code here
+        if (result == 0)
+        {
+            res = RES_OK;
+        }
+        else
+        {
+            res = RES_ERROR;
+        }
+
+		return res;
+
+	case DEV_FLASH :
+		result = w25qxx_ftl_write(buff, sector, count);
+
+        // translate the result code here
+        if (result == 0)
+        {
+            res = RES_OK;
+        }
+        else
+        {
+            res = RES_ERROR;
+        }
 
 		return res;
-#endif
 
 	case DEV_MMC :
 		// translate the arguments here
@@ -275,20 +518,63 @@ DRESULT disk_write (
 
 DRESULT disk_ioctl (
 	BYTE pdrv,		                                                /* Physical drive nmuber (0..) */
-    BYTE UNUSED(cmd),		                                        /* Control code */
-	void * UNUSED(buff)		                                        /* Buffer to send/receive control data */
+    BYTE cmd,		                                                /* Control code */
+	void * buff		                                                /* Buffer to send/receive control data */
 )
 {
 	DRESULT res = 0;
 
 	switch (pdrv) {
 	case DEV_RAM :
+        switch (cmd)
+        {
+            case GET_SECTOR_COUNT:  *(DWORD *) buff = ram_disk_sectors; break;
+            case GET_SECTOR_SIZE:   *(WORD *) buff  = FF_MAX_SS;        break;
+            case GET_BLOCK_SIZE:    *(DWORD *) buff = 1;                break;
+            case CTRL_SYNC:                                             break;
+            default:                res = RES_PARERR;                   break;
+        }
 
-		// Process of the command for the RAM drive
+		return res;
+
+	case DEV_FLASH :
+        switch (cmd)
+        {
+            case GET_SECTOR_COUNT:  *(DWORD *) buff = w25qxx_ftl_sectors (); break;
+            case GET_SECTOR_SIZE:   *(WORD *) buff  = FF_MAX_SS;        break;
+            case GET_BLOCK_SIZE:    *(DWORD *) buff = 1;                break;
+            case CTRL_SYNC:                                             break;     // FTL has no write cache
+            case CTRL_TRIM:
+                if (w25qxx_ftl_trim (((DWORD *) buff)[0], ((DWORD *) buff)[1]) != 0)
+                {
+                    res = RES_PARERR;
+                }
+                break;
+            default:                res = RES_PARERR;                   break;
+        }
 
 		return res;
 
 	case DEV_MMC :
+#ifdef unix
+        switch (cmd)
+        {
+            case GET_SECTOR_COUNT:
+                if (! image_fp || fseek (image_fp, 0, SEEK_END) != 0)
+                {
+                    res = RES_NOTRDY;
+                }
+                else
+                {
+                    *(DWORD *) buff = ftell (image_fp) / FF_MAX_SS;
+                }
+                break;
+            case GET_SECTOR_SIZE:   *(WORD *) buff  = FF_MAX_SS;        break;
+            case GET_BLOCK_SIZE:    *(DWORD *) buff = 1;                break;
+            case CTRL_SYNC:         fflush (image_fp);                  break;
+            default:                res = RES_PARERR;                   break;
+        }
+#endif
 
         // translate the result code here
 
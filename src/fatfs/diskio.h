@@ -35,6 +35,33 @@ DRESULT disk_read (BYTE pdrv, BYTE* buff, DWORD sector, UINT count);
 DRESULT disk_write (BYTE pdrv, const BYTE* buff, DWORD sector, UINT count);
 DRESULT disk_ioctl (BYTE pdrv, BYTE cmd, void* buff);
 
+void ram_disk_init (BYTE * mem, DWORD sectors);
+
+#ifdef unix
+/* Disk image backend for host builds: simulated timing and counters */
+
+#define DISKIO_SIM_CMD_USEC		250	/* default latency of a read command (CMD17/CMD18) */
+#define DISKIO_SIM_WCMD_USEC	1000	/* default latency of a write command incl. programming */
+#define DISKIO_SIM_SECTOR_USEC	43	/* default cost per sector, 4 bit bus at 24 MHz */
+
+typedef struct {
+	unsigned long	cmd_usec;			/* latency per read command */
+	unsigned long	wcmd_usec;			/* latency per write command */
+	unsigned long	sector_usec;		/* cost per sector */
+	int				sleep;				/* 1: really wait, 0: only account */
+	unsigned long	read_cmds;			/* counters */
+	unsigned long	write_cmds;
+	unsigned long	sectors_read;
+	unsigned long	sectors_written;
+	unsigned long	busy_usec;			/* simulated device time */
+} DISKIO_SIM;
+
+extern DISKIO_SIM diskio_sim;
+
+int diskio_image_open (const char * fname);
+void diskio_image_close (void);
+#endif
+
 
 /* Disk Status Bits (DSTATUS) */
 
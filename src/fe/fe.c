@@ -28,6 +28,7 @@
 #include <string.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <limits.h>
 
 #include "mcurses.h"
 
@@ -38,6 +39,16 @@
 #endif
 
 #define BUFFER_CHUNK_SIZE   1024
+#define LINE_INDEX_CHUNK_SIZE   64
+#define LINE_INDEX_STEP     64                                                  // lines between checkpoints of line index
+#define PIECE_CHUNK_SIZE    64
+
+#define PAGE_SIZE           512                                                 // one sector
+#define PAGE_CACHE_SIZE     8                                                   // number of cached pages of original file
+
+#define ORIG_TEMP_FNAME     "fe_orig.tmp"                                       // converted copy of file, see load_file()
+#define SAVE_TEMP_FNAME     "fe_save.tmp"                                       // new file while saving, see save_buffer()
+#define TEMP_FNAME_LEN      80
 
 #define EOB_STRING          "*EOB*"
 #define WINDOW_LINES        (LINES - 2)
@@ -51,19 +62,57 @@
 #define STATUS_LINE         (LINES - 2)
 #define PROMPT_LINE         (LINES - 1)
 
+typedef struct
+{
+    uint8_t         in_add;                                                     // TRUE: text is in add buffer, FALSE: in original
+    int             start;                                                      // offset in add buffer or original
+    int             len;
+} PIECE;
+
+typedef struct
+{
+    int             page_no;                                                    // -1: unused
+    int             len;
+    uint32_t        used;                                                       // time of last use, see orig_page()
+    char            data[PAGE_SIZE];
+} PAGE;
+
+typedef struct
+{
+    int             line;                                                       // line number
+    int             pos;                                                        // position of first character of line
+} LINE_MARK;
+
 typedef struct
 {
     const char *    fname;
-    char *          buf;
+    FILE *          orig_fp;                                                    // original text, read only
+    char            orig_fname[TEMP_FNAME_LEN];
+    PAGE            pages[PAGE_CACHE_SIZE];
+    uint32_t        page_clock;
+    char *          add;                                                        // add buffer, append only
+    int             add_len;
+    int             allocated_add;
+    PIECE *         pieces;
+    int             n_pieces;
+    int             allocated_pieces;
+    int             cur_piece;                                                  // last piece found by find_piece()
+    int             cur_start;                                                  // position of cur_piece
     int             pos;
     int             size;
-    int             gap_pos;
-    int             gap_size;
-    int             window_start;
-    int             window_end;
     int             modified;
     int             select_pos;
     int             line;                                                       // line number
+    LINE_MARK *     marks;                                                      // line index, see line_of()
+    int             n_marks;                                                    // number of checkpoints in line index
+    int             allocated_marks;                                            // allocated checkpoints of line index
+    LINE_MARK       last_mark;                                                  // line found last time by line_seek()
+    int             n_lines;                                                    // number of lines
+    int             top_line;                                                   // first line of window
+    int             dirty_first;                                                // first line to repaint
+    int             dirty_last;                                                 // last line to repaint
+    int             hl_pos;                                                     // highlighted text, see display_highlight()
+    int             hl_len;
 } BUFFER;
 
 static int          wish_x = -1;
@@ -73,110 +122,632 @@ static int          allocated_paste_buffer_len;
 static int          used_paste_buffer_len;
 static char *       paste_buffer;
 
-static int
-move_gap (BUFFER * bp, int pos)
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Piece table:
+ *
+ * The text is a list of pieces, each referring either to the original text or to the add buffer. The original text is a copy of
+ * the file with CRs removed and tabs expanded (see load_file()), it is never changed and read in pages of PAGE_SIZE bytes on demand.
+ * Only the last PAGE_CACHE_SIZE pages used are held in memory. Inserted characters are appended to the add buffer, typing extends the
+ * last piece. So memory depends on the size of the edits, not on the size of the file.
+ *
+ * find_piece() starts at the piece found last time, so walking through the text character by character is cheap.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static char *
+orig_page (BUFFER * bp, int page_no)
 {
-    if (bp->gap_pos < pos)
+    PAGE *  pg  = bp->pages;
+    int     i;
+
+    for (i = 0; i < PAGE_CACHE_SIZE; i++)
     {
-        int n = pos - bp->gap_pos;
+        if (bp->pages[i].page_no == page_no)
+        {
+            pg = bp->pages + i;
+            break;
+        }
 
-        while (n--)
+        if (bp->pages[i].used < pg->used)                                       // least recently used page
         {
-            bp->buf[bp->gap_pos] = bp->buf[bp->gap_pos + bp->gap_size];
-            bp->gap_pos++;
+            pg = bp->pages + i;
         }
     }
-    else if (bp->gap_pos > pos)
+
+    if (pg->page_no != page_no)
     {
-        int n = bp->gap_pos - pos;
+        pg->page_no = page_no;
+        pg->len     = 0;
 
-        while (n--)
+        if (fseek (bp->orig_fp, (long) page_no * PAGE_SIZE, SEEK_SET) == 0)
         {
-            bp->buf[bp->gap_pos + bp->gap_size - 1] = bp->buf[bp->gap_pos - 1];
-            bp->gap_pos--;
+            pg->len = fread (pg->data, 1, PAGE_SIZE, bp->orig_fp);
+        }
+
+        if (pg->len < PAGE_SIZE)                                                // read error or last page
+        {
+            memset (pg->data + pg->len, '\n', PAGE_SIZE - pg->len);
         }
     }
-    return 1;
+
+    pg->used = ++bp->page_clock;
+    return pg->data;
+}
+
+static int
+find_piece (BUFFER * bp, int pos)                                               // pos must be less than bp->size
+{
+    int     i       = bp->cur_piece;
+    int     start   = bp->cur_start;
+
+    while (pos < start)
+    {
+        i--;
+        start -= bp->pieces[i].len;
+    }
+
+    while (pos >= start + bp->pieces[i].len)
+    {
+        start += bp->pieces[i].len;
+        i++;
+    }
+
+    bp->cur_piece = i;
+    bp->cur_start = start;
+    return i;
 }
 
 static int
 char_at (BUFFER * bp, int pos)
 {
-    int ch;
+    PIECE * pp  = bp->pieces + find_piece (bp, pos);
+    int     off = pp->start + pos - bp->cur_start;
+    int     ch;
+
+    if (pp->in_add)
+    {
+        ch = bp->add[off];
+    }
+    else
+    {
+        ch = orig_page (bp, off / PAGE_SIZE)[off % PAGE_SIZE];
+    }
+
+    return (unsigned char) ch;
+}
 
-    if (pos < bp->gap_pos)
+static const char *
+text_chunk (BUFFER * bp, int pos, int * startp, int * endp)                     // contiguous text around pos, pos must be less than bp->size
+{
+    PIECE *         pp      = bp->pieces + find_piece (bp, pos);
+    int             start   = bp->cur_start;
+    int             end     = start + pp->len;
+    int             off     = pp->start + pos - start;
+    int             page_off;
+    const char *    p;
+
+    if (pp->in_add)
     {
-        ch = bp->buf[pos];
+        p = bp->add + off;
     }
     else
     {
-        ch = bp->buf[pos + bp->gap_size];
+        page_off    = off % PAGE_SIZE;
+        p           = orig_page (bp, off / PAGE_SIZE) + page_off;
+
+        if (start < pos - page_off)
+        {
+            start = pos - page_off;
+        }
+
+        if (end > pos - page_off + PAGE_SIZE)
+        {
+            end = pos - page_off + PAGE_SIZE;
+        }
+    }
+
+    *startp = start;                                                            // p[k - pos] is the character at position k,
+    *endp   = end;                                                              // start <= k < end
+    return p;
+}
+
+static int
+grow_pieces (BUFFER * bp, int n)
+{
+    PIECE * p;
+
+    if (bp->n_pieces + n <= bp->allocated_pieces)
+    {
+        return 1;
     }
 
-    return ch;
+    p = realloc (bp->pieces, (bp->allocated_pieces + PIECE_CHUNK_SIZE) * sizeof (PIECE));
+
+    if (! p)
+    {
+        return 0;
+    }
+
+    bp->pieces = p;
+    bp->allocated_pieces += PIECE_CHUNK_SIZE;
+    return 1;
 }
 
 static int
-search_backward (BUFFER * bp, int pos, int ch)
+split_piece (BUFFER * bp, int pos)                                              // returns index of piece starting at pos, needs 1 free piece
 {
-    while (pos >= 0 && char_at (bp, pos) != ch)
+    PIECE * pp;
+    int     i;
+    int     n;
+
+    if (pos >= bp->size)
     {
-        pos--;
+        return bp->n_pieces;
     }
 
-    return pos; // negative, if not found
+    i = find_piece (bp, pos);
+    n = pos - bp->cur_start;
+
+    if (n == 0)
+    {
+        return i;
+    }
+
+    pp = bp->pieces + i;
+    memmove (pp + 1, pp, (bp->n_pieces - i) * sizeof (PIECE));
+    bp->n_pieces++;
+
+    pp->len      = n;
+    pp[1].start += n;
+    pp[1].len   -= n;
+    return i + 1;
 }
 
 static int
-search_forward (BUFFER * bp, int pos, int ch)
+piece_insert_ch (BUFFER * bp, int pos, int ch)
 {
-    while (pos < bp->size && char_at (bp, pos) != ch)
+    PIECE * pp;
+    int     i;
+
+    if (bp->add_len == bp->allocated_add)
     {
-        pos++;
+        char * p = realloc (bp->add, bp->allocated_add + BUFFER_CHUNK_SIZE);
+
+        if (! p)
+        {
+            return 0;
+        }
+
+        bp->add = p;
+        bp->allocated_add += BUFFER_CHUNK_SIZE;
+    }
+
+    if (! grow_pieces (bp, 2))
+    {
+        return 0;
     }
 
-    return pos; // == size, if not found
+    i   = split_piece (bp, pos);
+    pp  = bp->pieces + i;
+
+    if (i > 0 && pp[-1].in_add && pp[-1].start + pp[-1].len == bp->add_len)   // typing: extend last piece
+    {
+        pp[-1].len++;
+        bp->cur_piece = i - 1;
+        bp->cur_start = pos - pp[-1].len + 1;
+    }
+    else
+    {
+        memmove (pp + 1, pp, (bp->n_pieces - i) * sizeof (PIECE));
+        bp->n_pieces++;
+
+        pp->in_add  = TRUE;
+        pp->start   = bp->add_len;
+        pp->len     = 1;
+        bp->cur_piece = i;
+        bp->cur_start = pos;
+    }
+
+    bp->add[bp->add_len++] = ch;
+    bp->size++;
+    return 1;
 }
 
 static int
-display_buffer (BUFFER * bp, int pos)
+piece_del_ch (BUFFER * bp, int pos, int n)
 {
-    uint_fast8_t    lines       = 0;
-    int             ch;
-    int             y           = 0;
-    int             x           = 0;
+    int     i;
+    int     j;
+
+    if (! grow_pieces (bp, 2))
+    {
+        return 0;
+    }
+
+    i = split_piece (bp, pos);
+    j = split_piece (bp, pos + n);
+
+    memmove (bp->pieces + i, bp->pieces + j, (bp->n_pieces - j) * sizeof (PIECE));
+    bp->n_pieces    -= j - i;
+    bp->size        -= n;
+    bp->cur_piece   = 0;
+    bp->cur_start   = 0;
+    return 1;
+}
 
-    move (TOP_LINE, 0);
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Line index:
+ *
+ * A line ends with its '\n' or at the end of the buffer, so there is always one line more than newlines. Storing the start of every
+ * line would need 4 bytes per line, 100 KB for a file of 25000 lines. So marks[] only holds checkpoints: line number and position of
+ * the first character of about every LINE_INDEX_STEP-th line, marks[0] is always line 0 at position 0. line_seek() finds a line by
+ * its number or by a position: it starts at the nearest checkpoint before (or at the line found last time, if that is nearer) and
+ * counts the newlines up to it in contiguous chunks as returned by text_chunk(). If it has to count more than LINE_INDEX_STEP lines,
+ * it inserts a new checkpoint, so after large inserts the index grows again where it is used.
+ *
+ * bp_insert_ch() and bp_del_ch() keep the checkpoints up to date: following checkpoints are shifted, checkpoints of lines joined by
+ * deleting their newline are removed. The line of the cursor is kept in bp->line, moving to another line needs no search in the
+ * buffer from its start.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+grow_line_index (BUFFER * bp)
+{
+    LINE_MARK * p;
 
-    for (pos = 0; pos < bp->size; pos++)
+    if (bp->n_marks < bp->allocated_marks)
     {
-        if (pos == bp->pos)
+        return 1;
+    }
+
+    p = realloc (bp->marks, (bp->allocated_marks + LINE_INDEX_CHUNK_SIZE) * sizeof (LINE_MARK));
+
+    if (! p)
+    {
+        return 0;
+    }
+
+    bp->marks = p;
+    bp->allocated_marks += LINE_INDEX_CHUNK_SIZE;
+    return 1;
+}
+
+static int
+next_newline (BUFFER * bp, int pos)                                             // position of next '\n' at or after pos, else bp->size
+{
+    const char *    p;
+    const char *    q;
+    int             start;
+    int             end;
+
+    while (pos < bp->size)
+    {
+        p = text_chunk (bp, pos, &start, &end);
+        q = memchr (p, '\n', end - pos);
+
+        if (q)
         {
-            bp->line = lines;                       // sets current line!
-            getyx (y, x);                           // saves cursor position
+            return pos + (q - p);
         }
 
-        ch = char_at (bp, pos);
+        pos = end;
+    }
 
-        if (ch == '\n')
+    return bp->size;
+}
+
+static LINE_MARK *
+line_seek (BUFFER * bp, int line, int pos)                                      // line with number line or containing position pos
+{
+    LINE_MARK * mp;
+    int         lo = 0;
+    int         hi = bp->n_marks - 1;
+    int         mid;
+    int         i;
+    int         nl;
+
+    while (lo < hi)                                                             // last checkpoint before
+    {
+        mid = (lo + hi + 1) / 2;
+
+        if (bp->marks[mid].line <= line && bp->marks[mid].pos <= pos)
         {
-            clrtoeol ();
-            lines++;
+            lo = mid;
+        }
+        else
+        {
+            hi = mid - 1;
+        }
+    }
+
+    i   = lo;
+    mp  = &bp->last_mark;
+
+    if (mp->line < bp->marks[i].line || mp->line > line || mp->pos > pos)
+    {
+        *mp = bp->marks[i];
+    }
+
+    while (mp->line < line)
+    {
+        nl = next_newline (bp, mp->pos);
+
+        if (nl >= pos || nl >= bp->size)
+        {
+            break;
+        }
+
+        mp->line++;
+        mp->pos = nl + 1;
+
+        if (mp->line - bp->marks[i].line >= LINE_INDEX_STEP && grow_line_index (bp))
+        {
+            i++;
+            memmove (bp->marks + i + 1, bp->marks + i, (bp->n_marks - i) * sizeof (LINE_MARK));
+            bp->marks[i] = *mp;
+            bp->n_marks++;
+        }
+    }
+
+    return mp;
+}
+
+static int
+line_of (BUFFER * bp, int pos)
+{
+    return line_seek (bp, INT_MAX, pos)->line;
+}
+
+static int
+line_start (BUFFER * bp, int line)
+{
+    return line_seek (bp, line, INT_MAX)->pos;
+}
+
+static int
+line_end (BUFFER * bp, int line)                                                // position of '\n' or bp->size
+{
+    return next_newline (bp, line_start (bp, line));
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Redisplay:
+ *
+ * Editing functions only change the buffer and mark the changed lines dirty. display_update() scrolls the window so that the cursor
+ * line is between TOP_EDIT_LINE and BOTTOM_EDIT_LINE, repaints the dirty lines within the window and moves the cursor. Inserted and
+ * deleted lines and scrolling by less than a window are done by the terminal within its scrolling region (see setscrreg() in cmd_fe()),
+ * so only the line(s) uncovered have to be repainted.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+display_mark (BUFFER * bp, int first, int last)
+{
+    if (bp->dirty_first > first)
+    {
+        bp->dirty_first = first;
+    }
 
-            if (lines > BOTTOM_LINE)
+    if (bp->dirty_last < last)
+    {
+        bp->dirty_last = last;
+    }
+}
+
+static void
+display_mark_window (BUFFER * bp)
+{
+    display_mark (bp, bp->top_line, bp->top_line + WINDOW_LINES - 1);
+}
+
+static void
+display_lines_inserted (BUFFER * bp, int line, int n)                          // lines line ... line + n - 1 are new
+{
+    int     row = line - bp->top_line;
+    int     i;
+
+    if (bp->dirty_first <= bp->dirty_last)                                      // following dirty lines have moved
+    {
+        if (bp->dirty_first >= line)
+        {
+            bp->dirty_first += n;
+        }
+
+        if (bp->dirty_last >= line)
+        {
+            bp->dirty_last += n;
+        }
+    }
+
+    if (row < 0)                                                                // above window: window shows the same lines
+    {
+        bp->top_line += n;
+    }
+    else if (row < WINDOW_LINES)
+    {
+        if (n < WINDOW_LINES - row)
+        {
+            move (TOP_LINE + row, 0);
+
+            for (i = 0; i < n; i++)
             {
-                break;
+                insertln ();
             }
 
-            addch ('\r');
+            display_mark (bp, line, line + n - 1);
+        }
+        else
+        {
+            display_mark (bp, line, bp->top_line + WINDOW_LINES - 1);
+        }
+    }
+}
+
+static void
+display_lines_deleted (BUFFER * bp, int line, int n)                           // lines line ... line + n - 1 are removed
+{
+    int     row = line - bp->top_line;
+    int     i;
+
+    if (bp->dirty_first <= bp->dirty_last)                                      // following dirty lines have moved
+    {
+        if (bp->dirty_first >= line)
+        {
+            bp->dirty_first = (bp->dirty_first >= line + n) ? bp->dirty_first - n : line;
         }
 
-        addch (ch);
+        if (bp->dirty_last >= line)
+        {
+            bp->dirty_last = (bp->dirty_last >= line + n) ? bp->dirty_last - n : line;
+        }
     }
 
-    move (y, x);
+    if (line + n <= bp->top_line)                                               // above window: window shows the same lines
+    {
+        bp->top_line -= n;
+    }
+    else if (row < 0)                                                           // top of window removed
+    {
+        bp->top_line = line;
+        display_mark_window (bp);
+    }
+    else if (row < WINDOW_LINES)
+    {
+        if (n < WINDOW_LINES - row)
+        {
+            move (TOP_LINE + row, 0);
+
+            for (i = 0; i < n; i++)
+            {
+                deleteln ();
+            }
+
+            display_mark (bp, bp->top_line + WINDOW_LINES - n, bp->top_line + WINDOW_LINES - 1);
+        }
+        else
+        {
+            display_mark (bp, line, bp->top_line + WINDOW_LINES - 1);
+        }
+    }
+}
 
-    return pos;
+static void
+display_highlight (BUFFER * bp, int pos, int len)                               // highlight text, len = 0: no highlight
+{
+    if (bp->hl_len > 0)
+    {
+        display_mark (bp, line_of (bp, bp->hl_pos), line_of (bp, bp->hl_pos + bp->hl_len - 1));
+    }
+
+    bp->hl_pos = pos;
+    bp->hl_len = len;
+
+    if (len > 0)
+    {
+        display_mark (bp, line_of (bp, pos), line_of (bp, pos + len - 1));
+    }
+}
+
+static void
+display_line (BUFFER * bp, int line)
+{
+    int     pos;
+    int     end;
+    int     x;
+    int     reverse = FALSE;
+    int     hl;
+
+    move (TOP_LINE + line - bp->top_line, 0);
+
+    if (line < bp->n_lines)
+    {
+        end = line_end (bp, line);
+
+        for (pos = line_start (bp, line), x = 0; pos < end && x < COLS; pos++, x++)
+        {
+            hl = (pos >= bp->hl_pos && pos < bp->hl_pos + bp->hl_len);
+
+            if (hl != reverse)
+            {
+                attrset (hl ? A_REVERSE : A_NORMAL);
+                reverse = hl;
+            }
+
+            addch (char_at (bp, pos));
+        }
+
+        if (reverse)
+        {
+            attrset (A_NORMAL);
+        }
+    }
+
+    clrtoeol ();
+}
+
+static void
+display_update (BUFFER * bp)
+{
+    int     top = bp->top_line;
+    int     first;
+    int     last;
+    int     line;
+    int     n;
+
+    bp->line = line_of (bp, bp->pos);
+
+    if (bp->line < top + (TOP_EDIT_LINE - TOP_LINE))
+    {
+        top = bp->line - (TOP_EDIT_LINE - TOP_LINE);
+
+        if (top < 0)
+        {
+            top = 0;
+        }
+    }
+    else if (bp->line > top + (BOTTOM_EDIT_LINE - TOP_LINE))
+    {
+        top = bp->line - (BOTTOM_EDIT_LINE - TOP_LINE);
+    }
+
+    if (top > bp->top_line && top - bp->top_line < WINDOW_LINES)               // scroll up
+    {
+        for (n = top - bp->top_line; n > 0; n--)
+        {
+            scroll ();
+        }
+
+        display_mark (bp, bp->top_line + WINDOW_LINES, top + WINDOW_LINES - 1);
+        bp->top_line = top;
+    }
+    else if (top < bp->top_line && bp->top_line - top < WINDOW_LINES)          // scroll down
+    {
+        move (TOP_LINE, 0);
+
+        for (n = bp->top_line - top; n > 0; n--)
+        {
+            insertln ();
+        }
+
+        display_mark (bp, top, bp->top_line - 1);
+        bp->top_line = top;
+    }
+    else if (top != bp->top_line)
+    {
+        bp->top_line = top;
+        display_mark_window (bp);
+    }
+
+    first   = (bp->dirty_first > top) ? bp->dirty_first : top;
+    last    = (bp->dirty_last < top + WINDOW_LINES - 1) ? bp->dirty_last : top + WINDOW_LINES - 1;
+
+    for (line = first; line <= last; line++)
+    {
+        display_line (bp, line);
+    }
+
+    bp->dirty_first = INT_MAX;
+    bp->dirty_last  = -1;
+
+    move (TOP_LINE + bp->line - top, bp->pos - line_start (bp, bp->line));
 }
 
 static void
@@ -255,25 +826,6 @@ show_buffer_status_line (BUFFER * bp, int total_update)
 }
 
 
-static int
-calculate_window_end (BUFFER * bp, int lines)
-{
-    int idx;
-    int window_end = bp->window_start + 1;
-
-    for (idx = 0; idx < lines && window_end < bp->size; idx++)
-    {
-        window_end = search_forward (bp, window_end, '\n');
-
-        if (window_end < bp->size)
-        {
-            window_end++;
-        }
-    }
-
-    return (window_end);
-}
-
 #if 000
 
 static int  reverse = 0;
@@ -323,175 +875,131 @@ bp_insch (BUFFER * bp, int pos)
 
 #endif // 000
 
-static int
-realloc_buffer (BUFFER * bp)
-{
-    move_gap (bp, bp->size);
-    bp->buf = realloc (bp->buf, bp->size + bp->gap_size + BUFFER_CHUNK_SIZE);
-    bp->gap_size += BUFFER_CHUNK_SIZE;
-    return 1;
-}
-
 static void
-bp_insert_ch (BUFFER * bp, int pos, int ch)
+line_mark_inserted (LINE_MARK * mp, int pos, int ch)
 {
-    if (bp->gap_size == 0)
+    if (mp->pos > pos)
     {
-        realloc_buffer (bp);
-    }
+        mp->pos++;
 
-    move_gap (bp, pos);
-    bp->buf[pos] = ch;
-    bp->size++;
-    bp->gap_size--;
-    bp->gap_pos++;
-}
-
-static void
-bp_del_ch (BUFFER * bp, int pos, int n)
-{
-    move_gap (bp, pos);
-    bp->gap_size += n;
-    bp->size -= n;
+        if (ch == '\n')
+        {
+            mp->line++;
+        }
+    }
 }
 
-static void
-bp_scroll_up (BUFFER * bp)
+static int
+bp_insert_ch (BUFFER * bp, int pos, int ch)
 {
-    int y;
-    int x;
-    int ch;
-    int pos;
-    int window_end  = bp->window_end;
-    int size        = bp->size;
-
-    getyx (y, x);
+    int     line = line_of (bp, pos);
+    int     i;
 
-    scroll ();
-
-    move (BOTTOM_LINE, 0);
-
-    while (window_end < size && (ch = char_at (bp, window_end)) != '\n')
+    if (! piece_insert_ch (bp, pos, ch))
     {
-#if 000
-        bp_addch (bp, window_end);
-#else
-        addch (ch);
-#endif
-        window_end++;
+        return 0;
     }
 
-    if (window_end < bp->size)
+    if (bp->select_pos > pos)                                                   // keep mark on the same text
     {
-        bp->window_end = window_end + 1;
+        bp->select_pos++;
     }
-    else
+
+    for (i = bp->n_marks - 1; i > 0 && bp->marks[i].pos > pos; i--)             // shift following checkpoints
     {
-        bp->window_end = bp->size;
+        line_mark_inserted (bp->marks + i, pos, ch);
     }
 
-    pos = search_forward (bp, bp->window_start, '\n');
+    line_mark_inserted (&bp->last_mark, pos, ch);
 
-    if (pos < bp->size)
+    if (ch == '\n')
     {
-        bp->window_start = pos + 1;
+        bp->n_lines++;
+        display_lines_inserted (bp, line + 1, 1);
+        display_mark (bp, line, line + 1);
     }
     else
     {
-        bp->window_start = bp->size;
+        display_mark (bp, line, line);
     }
 
-    move (y, x);
+    bp->modified = TRUE;
+    return 1;
 }
 
-static void
-bp_scroll_down (BUFFER * bp)
+static int
+bp_del_ch (BUFFER * bp, int pos, int n)
 {
-    int y;
-    int x;
-    int ch;
+    int     line = line_of (bp, pos);
+    int     last = line_of (bp, pos + n);                                       // lines line + 1 ... last are joined with line
+    int     i;
+    int     j;
 
-    if (bp->window_start > 0)
+    if (! piece_del_ch (bp, pos, n))
     {
-        int window_start    = bp->window_start;
-        int size            = bp->size;
+        return 0;
+    }
 
-        window_start = search_backward (bp, window_start - 2, '\n');
+    if (bp->select_pos > pos)                                                   // keep mark on the same text
+    {
+        bp->select_pos = (bp->select_pos - n > pos) ? bp->select_pos - n : pos;
+    }
 
-        if (window_start < 0)
+    for (i = 1, j = 1; i < bp->n_marks; i++)                                    // remove checkpoints of joined lines, shift following
+    {
+        if (bp->marks[i].pos > pos + n)
         {
-            window_start = -1;
+            bp->marks[j].line   = bp->marks[i].line - (last - line);
+            bp->marks[j].pos    = bp->marks[i].pos - n;
+            j++;
         }
-
-        window_start++;
-
-        bp->window_start = window_start;
-
-        bp->window_end = calculate_window_end (bp, WINDOW_LINES);
-
-        getyx (y, x);
-        move (0, 0);
-        insertln ();
-
-        while (window_start < size && (ch = char_at (bp, window_start)) != '\n')
+        else if (bp->marks[i].pos <= pos)
         {
-#if 000
-            bp_addch (bp, window_start);
-#else
-            addch (ch);
-#endif
-            window_start++;
+            j++;
         }
+    }
+
+    bp->n_marks = j;
 
-        move (y, x);
+    if (bp->last_mark.pos > pos + n)
+    {
+        bp->last_mark.line -= last - line;
+        bp->last_mark.pos  -= n;
+    }
+    else if (bp->last_mark.pos > pos)
+    {
+        bp->last_mark = bp->marks[0];
     }
-}
 
+    bp->n_lines -= last - line;
 
-static void
-bp_insertln (BUFFER * bp)
-{
-    insertln ();
+    if (last > line)
+    {
+        display_lines_deleted (bp, line + 1, last - line);
+    }
 
-    bp->window_end = calculate_window_end (bp, WINDOW_LINES);
+    display_mark (bp, line, line);
+    bp->modified = TRUE;
+    return 1;
 }
 
 static void
-bp_deleteln (BUFFER * bp)
+move_to_line (BUFFER * bp, int line)
 {
-    int y;
-    int x;
-    int ch;
-    int window_end;
-    int size        = bp->size;
-
-    getyx (y, x);
-    deleteln ();
-
-    window_end = calculate_window_end (bp, WINDOW_LINES - 1);                                   // one line less, because we have to print it
+    int     x = bp->pos - line_start (bp, line_of (bp, bp->pos));
+    int     len;
 
-    move (BOTTOM_LINE, 0);
-
-    while (window_end < size && (ch = char_at (bp, window_end)) != '\n')
-    {
-#if 000
-        bp_addch (bp, window_end);
-#else
-        addch (ch);
-#endif
-        window_end++;
-    }
-
-    if (window_end < bp->size)
+    if (wish_x >= 0)
     {
-        bp->window_end = window_end + 1;
+        x = wish_x;
     }
     else
     {
-        bp->window_end = size;
+        wish_x = x;
     }
 
-    move (y, x);
+    len     = line_end (bp, line) - line_start (bp, line);
+    bp->pos = line_start (bp, line) + ((x < len) ? x : len);
 }
 
 static int
@@ -499,32 +1007,7 @@ cmd_move_left (BUFFER * bp)
 {
     if (bp->pos > 0)
     {
-        int y;
-        int x;
-
         bp->pos--;
-        getyx (y, x);
-
-        if (char_at (bp, bp->pos) == '\n')
-        {
-            int new_pos = search_backward (bp, bp->pos - 1, '\n') + 1;
-            int new_x = 0;
-
-            y--;
-
-            while (new_pos < bp->size && char_at (bp, new_pos) != '\n')
-            {
-                new_pos++;
-                new_x++;
-            }
-
-            move (y, new_x);
-            bp->line--;
-        }
-        else
-        {
-            move (y, x - 1);
-        }
     }
     return 1;
 }
@@ -534,161 +1017,48 @@ cmd_move_right (BUFFER * bp)
 {
     if (bp->pos < bp->size)
     {
-        int y;
-        int x;
-        int ch;
-
-        getyx (y, x);
-        ch = char_at (bp, bp->pos);
-
-        if (ch == '\n')
-        {
-            move (y + 1, 0);
-            bp->line++;
-        }
-        else
-        {
-            move (y, x + 1);
-        }
-
         bp->pos++;
     }
     return 1;
 }
 
-static int
-cmd_move_up (BUFFER * bp)
-{
-    if (bp->pos > 0)
-    {
-        int new_pos = search_backward (bp, bp->pos - 1, '\n');
-
-        if (new_pos >= 0)
-        {
-            int y;
-            int x;
-            int new_x;
-
-            new_pos = search_backward (bp, new_pos - 1, '\n') + 1;
-            getyx (y, x);
-
-            if (y > TOP_EDIT_LINE || bp->window_start == 0)
-            {
-                y--;
-            }
-            else
-            {
-                bp_scroll_down (bp);
-            }
-
-            new_x = 0;
-
-            if (wish_x >= 0)
-            {
-                x = wish_x;
-            }
-            else
-            {
-                wish_x = x;
-            }
-
-            while (new_pos < bp->size && char_at (bp, new_pos) != '\n' && new_x < x)
-            {
-                new_pos++;
-                new_x++;
-            }
-
-            move (y, new_x);
-            bp->pos = new_pos;
-            bp->line--;
-        }
-        return 1;
-    }
-    return 0;
-}
-
-static int
-cmd_move_down (BUFFER * bp)
-{
-    if (bp->pos < bp->size)
-    {
-        int new_pos = search_forward (bp, bp->pos, '\n');
-
-        if (new_pos < bp->size)
-        {
-            uint_fast8_t y;
-            uint_fast8_t x;
-            uint_fast8_t new_x = 0;
-
-            new_pos++;
-            getyx (y, x);
-
-            if (y < BOTTOM_EDIT_LINE)
-            {
-                y++;
-            }
-            else
-            {
-                bp_scroll_up (bp);
-            }
-
-            if (wish_x >= 0)
-            {
-                x = wish_x;
-            }
-            else
-            {
-                wish_x = x;
-            }
-
-            while (new_pos < bp->size && char_at (bp, new_pos) != '\n' && new_x < x)
-            {
-                new_pos++;
-                new_x++;
-            }
-
-            move (y, new_x);
-            bp->pos = new_pos;
-            bp->line++;
-        }
+static int
+cmd_move_up (BUFFER * bp)
+{
+    int     line = line_of (bp, bp->pos);
+
+    if (line > 0)
+    {
+        move_to_line (bp, line - 1);
         return 1;
     }
     return 0;
 }
 
 static int
-cmd_move_bol (BUFFER * bp)
+cmd_move_down (BUFFER * bp)
 {
-    if (bp->pos > 0)
-    {
-        int y;
-        int x;
-        int new_pos = search_backward (bp, bp->pos - 1, '\n') + 1;
-
-        getyx (y, x);
-
-        if (x > 0)
-        {
-            move (y, 0);
-        }
+    int     line = line_of (bp, bp->pos);
 
-        bp->pos = new_pos;
+    if (line + 1 < bp->n_lines)
+    {
+        move_to_line (bp, line + 1);
+        return 1;
     }
+    return 0;
+}
+
+static int
+cmd_move_bol (BUFFER * bp)
+{
+    bp->pos = line_start (bp, line_of (bp, bp->pos));
     return 1;
 }
 
 static int
 cmd_move_eol (BUFFER * bp)
 {
-    int y;
-    int x;
-    int new_pos = search_forward (bp, bp->pos, '\n');
-
-    getyx (y, x);
-    x += new_pos - bp->pos;
-    bp->pos = new_pos;
-    move (y, x);
-
+    bp->pos = line_end (bp, line_of (bp, bp->pos));
     return 1;
 }
 
@@ -697,57 +1067,7 @@ cmd_delete_ch (BUFFER * bp)
 {
     if (bp->pos < bp->size)
     {
-        int ch;
-        int y;
-        int x;
-        int new_pos;
-
-        move_gap (bp, bp->pos);
-        ch = char_at (bp, bp->pos);
-
-        bp->gap_size++;
-        bp->size--;
-        bp->window_end--;
-        bp->modified = TRUE;
-
-        if (ch == '\n')
-        {
-            new_pos = bp->pos;
-
-            getyx (y, x);
-
-            while (new_pos < bp->size && (ch = char_at (bp, new_pos)) != '\n')
-            {
-#if 000
-                bp_addch (bp, new_pos);
-#else
-                addch (ch);
-#endif
-                new_pos++;
-            }
-
-            move (y + 1, 0);
-            bp_deleteln (bp);
-            move (y, x);
-        }
-        else
-        {
-            uint_fast8_t xx;
-
-            getyx (y, x);
-            delch ();
-
-            for (xx = x, new_pos = bp->pos; new_pos < bp->size && (ch = char_at (bp, new_pos)) != '\n'; xx++, new_pos++)
-            {
-                if (xx == COLS - 1)
-                {
-                    move (y, COLS - 1);
-                    addch (ch);
-                    move (y, x);
-                    break;
-                }
-            }
-        }
+        bp_del_ch (bp, bp->pos, 1);
     }
     return 1;
 }
@@ -755,58 +1075,25 @@ cmd_delete_ch (BUFFER * bp)
 static int
 cmd_delete_to_eol (BUFFER * bp)
 {
-    int new_pos;
-    int n;
-
-    new_pos = search_forward (bp, bp->pos, '\n');
-
-    n = new_pos - bp->pos;
-
-    bp_del_ch (bp, bp->pos, n);
-
-    bp->modified = TRUE;
-    clrtoeol ();
+    int n = line_end (bp, line_of (bp, bp->pos)) - bp->pos;
 
+    if (n > 0)
+    {
+        bp_del_ch (bp, bp->pos, n);
+    }
     return 1;
 }
 
 static int
 cmd_delete_to_bol (BUFFER * bp)
 {
-    int new_pos;
-    int n;
+    int new_pos = line_start (bp, line_of (bp, bp->pos));
+    int n       = bp->pos - new_pos;
 
-    if (bp->pos > 0)
+    if (n > 0)
     {
-        int y;
-        int x;
-        int ch;
-
-        getyx (y, x);
-
-        new_pos = search_backward (bp, bp->pos - 1, '\n') + 1;
-
-        n = bp->pos - new_pos;
         bp->pos = new_pos;
-
         bp_del_ch (bp, new_pos, n);
-        bp->modified = TRUE;
-
-        x = 0;
-        move (y, x);
-
-        while (new_pos < bp->size && (ch = char_at (bp, new_pos)) != '\n')
-        {
-#if 000
-            bp_addch (bp, new_pos);
-#else
-            addch (ch);
-#endif
-            new_pos++;
-        }
-
-        clrtoeol ();
-        move (y, x);
     }
     return 1;
 }
@@ -816,86 +1103,8 @@ cmd_delete_back (BUFFER * bp)
 {
     if (bp->pos > 0)
     {
-        int y;
-        int x;
-
         bp->pos--;
-        move_gap (bp, bp->pos);
-        bp->gap_size++;
-        bp->size--;
-        bp->window_end--;
-        bp->modified = TRUE;
-
-        getyx (y, x);
-
-        if (x > 0)
-        {
-            int             ch;
-            int             new_pos;
-            uint_fast8_t    xx;
-
-            x--;
-
-            move (y, x);
-            delch ();
-
-            for (xx = x, new_pos = bp->pos; new_pos < bp->size && (ch = char_at (bp, new_pos)) != '\n'; xx++, new_pos++)
-            {
-                if (xx == COLS - 1)
-                {
-                    move (y, COLS - 1);
-                    addch (ch);
-                    move (y, x);
-                    break;
-                }
-            }
-        }
-        else
-        {
-            int ch;
-            int len = 0;
-            int pos = bp->pos;
-            int new_pos;
-
-            bp_deleteln (bp);
-
-            if (y > TOP_EDIT_LINE)
-            {
-                move (y - 1, 0);
-            }
-            else
-            {
-                if (bp->window_start > 0)
-                {
-                    bp_scroll_down (bp);
-                    y++;
-                }
-                else
-                {
-                    move (y - 1, 0);
-                }
-            }
-
-            new_pos = search_backward (bp, pos - 1, '\n') + 1;
-
-            if (new_pos >= 0)
-            {
-                len = pos - new_pos;
-
-                while (new_pos < bp->size && (ch = char_at (bp, new_pos)) != '\n')
-                {
-#if 000
-                    bp_addch (bp, new_pos);
-#else
-                    addch (ch);
-#endif
-                    new_pos++;
-                }
-            }
-
-            move (y - 1, len);
-            bp->line--;
-        }
+        bp_del_ch (bp, bp->pos, 1);
     }
     return 1;
 }
@@ -908,60 +1117,12 @@ insert_ch (BUFFER * bp, int ch)
         ch = '\n';
     }
 
-    bp_insert_ch (bp, bp->pos, ch);
-
-    bp->window_end++;
-    bp->modified = TRUE;
-    bp->pos++;
-
-    if (ch == '\n')
-    {
-        uint_fast8_t    y;
-        uint_fast8_t    x;
-        int             new_pos;
-
-        getyx (y, x);
-
-        if (y < BOTTOM_EDIT_LINE)
-        {
-            y++;
-        }
-        else
-        {
-            bp_scroll_up (bp);
-            move (y - 1, x);
-        }
-
-        clrtoeol ();
-        x = 0;
-        move (y, x);
-        bp_insertln (bp);
-
-        new_pos = bp->pos;
-
-        while (new_pos < bp->size && (ch = char_at (bp, new_pos)) != '\n')
-        {
-#if 000
-            bp_addch (bp, new_pos);
-#else
-            addch (ch);
-#endif
-            new_pos++;
-        }
-
-        move (y, x);
-        bp->line++;
-    }
-    else
+    if (bp_insert_ch (bp, bp->pos, ch))
     {
-#if 000
-        bp_insch (bp, bp->pos - 1);
-#else
-        insch (ch);
-#endif
+        bp->pos++;
+        return 1;
     }
-
-    return 1;
+    return 0;
 }
 
 static int
@@ -971,9 +1132,8 @@ cmd_next_page (BUFFER * bp)
     {
         int l = LINES * 3 / 4;
 
-        while (l > 0)
+        while (l > 0 && cmd_move_down (bp))
         {
-            cmd_move_down (bp);
             l--;
         }
 
@@ -989,9 +1149,8 @@ cmd_prev_page (BUFFER * bp)
     {
         int l = LINES * 3 / 4;
 
-        while (l > 0)
+        while (l > 0 && cmd_move_up (bp))
         {
-            cmd_move_up (bp);
             l--;
         }
 
@@ -1008,7 +1167,7 @@ cmd_tabulate (BUFFER * bp)
         int     x;
         int     new_tab_pos;
 
-        x = getx ();
+        x = bp->pos - line_start (bp, line_of (bp, bp->pos));
         new_tab_pos = ((x + 4) / 4) * 4;
 
         while (x < new_tab_pos)
@@ -1091,48 +1250,312 @@ cmd_cut_region (BUFFER * bp)
 {
     if (bp->select_pos >= 0)
     {
-        int     len;
+        if (bp->pos > bp->select_pos)
+        {
+            fill_paste_buffer (bp, bp->select_pos, bp->pos);
+            bp_del_ch (bp, bp->select_pos, bp->pos - bp->select_pos);
+            bp->pos = bp->select_pos;
+        }
+        else if (bp->pos < bp->select_pos)
+        {
+            fill_paste_buffer (bp, bp->pos, bp->select_pos);
+            bp_del_ch (bp, bp->pos, bp->select_pos - bp->pos);
+        }
+        else
+        {
+            used_paste_buffer_len = 0;
+        }
+
+        bp->select_pos = -1;
+    }
+}
+
+static void
+cmd_paste_region (BUFFER * bp)
+{
+    int idx;
+
+    for (idx = 0; idx < used_paste_buffer_len; idx++)
+    {
+        insert_ch (bp, paste_buffer[idx]);
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Search:
+ *
+ * Boyer-Moore-Horspool: the pattern is compared with the text from its last (forward) or first (backward) character, on mismatch the
+ * window is shifted by the distance of the character in the text under that end of the window to its next occurrence in the pattern.
+ * The text is scanned in contiguous chunks as returned by text_chunk(), so the inner loop works on memory and the pieces are not
+ * touched. Only windows crossing the end of a chunk are compared by char_at(). With case folding, pattern and text characters are
+ * mapped by search_fold[] before comparing.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#define SEARCH_MAX_LEN      64
+
+static uint8_t      search_pattern[SEARCH_MAX_LEN];                             // folded pattern
+static int          search_len;
+static uint8_t      search_fold[256];
+static uint8_t      search_skip[256];                                           // forward shifts
+static uint8_t      search_bskip[256];                                          // backward shifts
+
+static void
+search_prepare (const char * pattern, int len, int ignore_case)
+{
+    int     last = len - 1;
+    int     i;
+
+    for (i = 0; i < 256; i++)
+    {
+        search_fold[i] = (ignore_case && i >= 'A' && i <= 'Z') ? i - 'A' + 'a' : i;
+    }
+
+    for (i = 0; i < len; i++)
+    {
+        search_pattern[i] = search_fold[(uint8_t) pattern[i]];
+    }
+
+    search_len = len;
+
+    memset (search_skip, len, 256);
+    memset (search_bskip, len, 256);
+
+    for (i = 0; i < last; i++)
+    {
+        search_skip[search_pattern[i]] = last - i;                              // rightmost occurrence before last character
+    }
+
+    for (i = last; i > 0; i--)
+    {
+        search_bskip[search_pattern[i]] = i;                                    // leftmost occurrence after first character
+    }
+}
+
+static int
+search_forward (BUFFER * bp, int pos)                                           // returns position of first match at or after pos, else -1
+{
+    const uint8_t * p;
+    int             last = search_len - 1;
+    int             start;
+    int             end;
+    int             k;
+    int             j;
+
+    while (pos >= 0 && pos + search_len <= bp->size)
+    {
+        p = (const uint8_t *) text_chunk (bp, pos, &start, &end);
+
+        if (pos + search_len <= end)                                            // windows within chunk
+        {
+            for (k = 0; pos + k + search_len <= end; k += search_skip[search_fold[p[k + last]]])
+            {
+                for (j = last; j >= 0 && search_fold[p[k + j]] == search_pattern[j]; j--)
+                {
+                    ;
+                }
+
+                if (j < 0)
+                {
+                    return pos + k;
+                }
+            }
+            pos += k;
+        }
+        else                                                                    // window crosses end of chunk
+        {
+            for (j = last; j >= 0 && search_fold[char_at (bp, pos + j)] == search_pattern[j]; j--)
+            {
+                ;
+            }
+
+            if (j < 0)
+            {
+                return pos;
+            }
+
+            pos += search_skip[search_fold[char_at (bp, pos + last)]];
+        }
+    }
+    return -1;
+}
+
+static int
+search_backward (BUFFER * bp, int pos)                                          // returns position of last match at or before pos, else -1
+{
+    const uint8_t * p;
+    int             start;
+    int             end;
+    int             k;
+    int             j;
+
+    if (pos > bp->size - search_len)
+    {
+        pos = bp->size - search_len;
+    }
+
+    while (pos >= 0)
+    {
+        p = (const uint8_t *) text_chunk (bp, pos, &start, &end);
+
+        if (pos + search_len <= end)                                            // windows within chunk
+        {
+            for (k = 0; pos + k >= start; k -= search_bskip[search_fold[p[k]]])
+            {
+                for (j = 0; j < search_len && search_fold[p[k + j]] == search_pattern[j]; j++)
+                {
+                    ;
+                }
+
+                if (j == search_len)
+                {
+                    return pos + k;
+                }
+            }
+            pos += k;
+        }
+        else                                                                    // window crosses end of chunk
+        {
+            for (j = 0; j < search_len && search_fold[char_at (bp, pos + j)] == search_pattern[j]; j++)
+            {
+                ;
+            }
+
+            if (j == search_len)
+            {
+                return pos;
+            }
+
+            pos -= search_bskip[search_fold[char_at (bp, pos)]];
+        }
+    }
+    return -1;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * cmd_search () - incremental search
+ *
+ * Every typed character extends the pattern and searches again from the current match. CTRL-F/CTRL-R: next match forward/backward,
+ * with an empty pattern the last pattern is used again. CTRL-T: toggle case folding. RETURN: stay at match, ESC: back to start.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+cmd_search (BUFFER * bp, int backward)
+{
+    static char     last_pattern[SEARCH_MAX_LEN + 1];
+    static int      ignore_case;
+    char            pattern[SEARCH_MAX_LEN + 1];
+    int             origin  = bp->pos;
+    int             match   = bp->pos;
+    int             from    = 0;
+    int             search;
+    int             len     = 0;
+    int             found   = TRUE;
+    int             done    = FALSE;
+    int             ch;
+
+    while (! done)
+    {
+        move (PROMPT_LINE, 0);
+        addstr (backward ? "Search backward" : "Search");
+        addstr (ignore_case ? " (ignore case): " : ": ");
+        pattern[len] = '\0';
+        addstr (pattern);
 
-        if (bp->pos > bp->select_pos)
+        if (! found)
         {
-            fill_paste_buffer (bp, bp->select_pos, bp->pos);
+            addstr (" [not found]");
+        }
+
+        clrtoeol ();
+        display_update (bp);
 
-            len = bp->pos - bp->select_pos;
+        ch      = getch ();
+        search  = FALSE;
 
-            while (len--)
-            {
-                cmd_delete_back (bp);
-            }
+        switch (ch)
+        {
+            case KEY_CTRL('F'):
+            case KEY_CTRL('R'):
+                backward = (ch == KEY_CTRL('R'));
+
+                if (len == 0)
+                {
+                    strcpy (pattern, last_pattern);
+                    len     = strlen (pattern);
+                    from    = match;
+                }
+                else
+                {
+                    from = backward ? match - 1 : match + 1;
+                }
+                search = TRUE;
+                break;
+            case KEY_CTRL('T'):
+                ignore_case = ! ignore_case;
+                from        = match;
+                search      = TRUE;
+                break;
+            case KEY_BACKSPACE:
+                if (len > 0)
+                {
+                    len--;
+                    from    = match;
+                    search  = TRUE;
+                }
+                break;
+            case KEY_CR:
+                done = TRUE;
+                break;
+            case KEY_ESCAPE:
+                bp->pos = origin;
+                done    = TRUE;
+                break;
+            default:
+                if (((ch >= 32 && ch < 127) || (ch >= 128 + 32 && ch < 256)) && len < SEARCH_MAX_LEN)
+                {
+                    pattern[len++]  = ch;
+                    from            = match;
+                    search          = TRUE;
+                }
+                break;
         }
-        else if (bp->pos < bp->select_pos)
+
+        if (search)
         {
-            fill_paste_buffer (bp, bp->pos, bp->select_pos);
+            int     pos = -1;
+
+            if (len > 0)
+            {
+                search_prepare (pattern, len, ignore_case);
+                pos = backward ? search_backward (bp, from) : search_forward (bp, from);
+            }
 
-            len = bp->select_pos - bp->pos;
+            found = (pos >= 0 || len == 0);
 
-            while (len--)
+            if (pos >= 0)
             {
-                cmd_delete_ch (bp);
+                match = pos;
+                display_highlight (bp, pos, len);
+            }
+            else if (len == 0)
+            {
+                match = origin;
+                display_highlight (bp, 0, 0);
             }
-        }
-        else
-        {
-            used_paste_buffer_len = 0;
-        }
 
-        bp->select_pos = -1;
+            bp->pos = match;
+        }
     }
-}
-
-static void
-cmd_paste_region (BUFFER * bp)
-{
-    int idx;
 
-    for (idx = 0; idx < used_paste_buffer_len; idx++)
+    if (len > 0)
     {
-        insert_ch (bp, paste_buffer[idx]);
+        memcpy (last_pattern, pattern, len);
+        last_pattern[len] = '\0';
     }
+
+    display_highlight (bp, 0, 0);
+    move (PROMPT_LINE, 0);
+    clrtoeol ();
 }
 
 static void
@@ -1158,60 +1581,212 @@ cmd_goto_line (BUFFER * bp)
 
         if (line > 0)
         {
-            int     curline;
-
             line--;
 
-            if (line < bp->line)
-            {
-                while (line < bp->line)
-                {
-                    curline = bp->line;
-                    cmd_move_up (bp);
-
-                    if (bp->line == curline)
-                    {
-                        break;      // cmd_move_up() had no effect
-                    }
-                }
-            }
-            else if (line > bp->line)
+            if (line >= bp->n_lines)
             {
-                while (line > bp->line)
-                {
-                    curline = bp->line;
-                    cmd_move_down (bp);
-
-                    if (bp->line == curline)
-                    {
-                        break;      // cmd_move_up() had no effect
-                    }
-                }
+                line = bp->n_lines - 1;
             }
 
+            move_to_line (bp, line);
         }
     }
 }
 
+static int
+temp_fname (char * buf, const char * fname, const char * tname)                 // temp file in directory of fname
+{
+    const char *    p = strrchr (fname, '/');
+    int             len = p ? p - fname + 1 : 0;
+
+    if (len + (int) strlen (tname) >= TEMP_FNAME_LEN)
+    {
+        return 0;
+    }
+
+    memcpy (buf, fname, len);
+    strcpy (buf + len, tname);
+    return 1;
+}
+
+static void
+remove_file (const char * fname)
+{
+#ifdef unix
+    (void) remove (fname);
+#else
+    (void) f_unlink (fname);
+#endif
+}
+
+static int
+replace_file (const char * tmp_fname, const char * fname)
+{
+#ifdef unix
+    return rename (tmp_fname, fname) == 0;
+#else
+    (void) f_unlink (fname);                                                    // f_rename() fails if fname exists
+    return f_rename (tmp_fname, fname) == FR_OK;
+#endif
+}
+
 static void
 free_buffer (BUFFER * bp)
 {
     if (bp)
     {
-        if (bp->buf)
+        if (bp->orig_fp)
+        {
+            fclose (bp->orig_fp);
+        }
+
+        if (bp->orig_fname[0])
+        {
+            remove_file (bp->orig_fname);
+        }
+
+        if (bp->add)
+        {
+            free (bp->add);
+        }
+
+        if (bp->pieces)
+        {
+            free (bp->pieces);
+        }
+
+        if (bp->marks)
         {
-            free (bp->buf);
-            bp->buf = 0;
+            free (bp->marks);
         }
         free (bp);
     }
 }
 
+static int
+load_new_line (BUFFER * bp, int pos)                                            // line starts at pos, add checkpoint every LINE_INDEX_STEP lines
+{
+    if (bp->n_lines % LINE_INDEX_STEP == 0)
+    {
+        if (! grow_line_index (bp))
+        {
+            return 0;
+        }
+
+        bp->marks[bp->n_marks].line = bp->n_lines;
+        bp->marks[bp->n_marks].pos  = pos;
+        bp->n_marks++;
+    }
+
+    bp->n_lines++;
+    return 1;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * load_file () - copy file to the original text, remove CRs, expand tabs and build the line index
+ *
+ * The original text is a converted copy ORIG_TEMP_FNAME in the directory of the file, so that a position in the text is an offset in a
+ * file and orig_page() can read any page directly. Loading therefore needs free space for a second copy of the file on the same drive,
+ * more if it contains tabs. If the copy cannot be written completely, the file is not loaded.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+load_file (BUFFER * bp, const char * fname)
+{
+    FILE *  fp;
+    FILE *  tp;
+    int     ch;
+    int     last_ch = '\n';
+    int     col     = 0;
+    int     pos     = 0;
+    int     write_error;
+    int     rtc     = 1;
+
+    fp = fopen (fname, "r");
+
+    if (! fp)
+    {
+        fprintf (stderr, "%s: cannot open", fname);
+        return 0;
+    }
+
+    if (! temp_fname (bp->orig_fname, fname, ORIG_TEMP_FNAME) || (tp = fopen (bp->orig_fname, "w")) == (FILE *) 0)
+    {
+        fprintf (stderr, "%s: cannot create temp file", fname);
+        bp->orig_fname[0] = '\0';
+        fclose (fp);
+        return 0;
+    }
+
+    while (rtc && (ch = getc (fp)) != EOF)
+    {
+        if (ch == '\t')
+        {
+            int new_tab_pos = ((col + 4) / 4) * 4;
+
+            while (col < new_tab_pos)
+            {
+                putc (' ', tp);
+                col++;
+                pos++;
+            }
+        }
+        else if (ch != '\r')
+        {
+            putc (ch, tp);
+            col++;
+            pos++;
+
+            if (ch == '\n')
+            {
+                col = 0;
+                rtc = load_new_line (bp, pos);
+            }
+        }
+        last_ch = ch;
+    }
+
+    if (rtc && pos > 0 && last_ch != '\n')
+    {
+        putc ('\n', tp);
+        pos++;
+        rtc = load_new_line (bp, pos);
+    }
+
+    fclose (fp);
+
+    write_error = ferror (tp);
+
+    if (fclose (tp) != 0 || write_error)
+    {
+        fprintf (stderr, "%s: cannot write temp file %s, drive full?", fname, bp->orig_fname);
+        rtc = 0;
+    }
+
+    if (rtc)
+    {
+        bp->orig_fp = fopen (bp->orig_fname, "r");
+        rtc = (bp->orig_fp && grow_pieces (bp, 1));
+    }
+
+    if (rtc && pos > 0)
+    {
+        bp->pieces[0].in_add    = FALSE;
+        bp->pieces[0].start     = 0;
+        bp->pieces[0].len       = pos;
+        bp->n_pieces            = 1;
+        bp->size                = pos;
+    }
+
+    return rtc;
+}
+
 static BUFFER *
 new_buffer (const char * fname)
 {
     BUFFER *    bp = (BUFFER *) NULL;
     int         buffersize = 0;
+    int         i;
 
     if (fname)
     {
@@ -1242,98 +1817,55 @@ new_buffer (const char * fname)
 
     if (bp)
     {
-        bp->fname = fname;
-
-        bp->buf = malloc (buffersize + BUFFER_CHUNK_SIZE);
+        bp->fname               = fname;
+        bp->orig_fp             = (FILE *) 0;
+        bp->orig_fname[0]       = '\0';
+        bp->page_clock          = 0;
+        bp->add                 = (char *) 0;
+        bp->add_len             = 0;
+        bp->allocated_add       = 0;
+        bp->pieces              = (PIECE *) 0;
+        bp->n_pieces            = 0;
+        bp->allocated_pieces    = 0;
+        bp->cur_piece           = 0;
+        bp->cur_start           = 0;
+        bp->size                = 0;
+        bp->pos                 = 0;
+        bp->modified            = 0;
+        bp->select_pos          = -1;
+        bp->line                = 0;
+        bp->marks               = (LINE_MARK *) 0;
+        bp->n_marks             = 0;
+        bp->allocated_marks     = 0;
+        bp->last_mark.line      = 0;
+        bp->last_mark.pos       = 0;
+        bp->n_lines             = 1;
+        bp->top_line            = 0;
+        bp->dirty_first         = INT_MAX;
+        bp->dirty_last          = -1;
+        bp->hl_pos              = 0;
+        bp->hl_len              = 0;
+
+        for (i = 0; i < PAGE_CACHE_SIZE; i++)
+        {
+            bp->pages[i].page_no    = -1;
+            bp->pages[i].used       = 0;
+        }
 
-        if (bp->buf)
+        if (grow_line_index (bp))
         {
-            bp->size        = buffersize;
-            bp->gap_pos     = 0;
-            bp->gap_size    = BUFFER_CHUNK_SIZE;
-            bp->pos         = 0;
-            bp->modified    = 0;
-            bp->select_pos  = -1;
-            bp->line        = 0;
+            bp->marks[0]        = bp->last_mark;
+            bp->n_marks         = 1;
 
-            if (buffersize)
+            if (buffersize && ! load_file (bp, fname))
             {
-                char *  p   = bp->buf;
-                int     pos = 0;
-                int     col;
-                int     ch;
-                int     last_ch = '\n';
-                FILE *  fp  = fopen (fname, "r");
-
-                if (fp)
-                {
-                    while ((ch = getc (fp)) != EOF)
-                    {
-                        if (ch != '\r')
-                        {
-                            *p++ = ch;
-                            pos++;
-                        }
-                        last_ch = ch;
-                    }
-
-                    if (pos > 0 && last_ch != '\n')
-                    {
-                        *p++ = '\n';
-                        pos++;
-                    }
-
-                    fclose (fp);
-                }
-                else
-                {
-                    fprintf (stderr, "%s: cannot open", fname);
-                    free_buffer (bp);
-                    bp = 0;
-                    return bp;
-                }
-
-                /* correct positions and sizes */
-                bp->size        = pos;
-                bp->gap_pos     = pos;
-                bp->gap_size    = BUFFER_CHUNK_SIZE + (buffersize - pos);           // correct gap size, because CR ignored above
-                bp->pos         = 0;
-
-                pos = 0;
-                col = 0;
-
-                while (pos < bp->size)
-                {
-                    ch = char_at (bp, pos);
-
-                    if (ch == '\n')
-                    {
-                        col = 0;
-                        pos++;
-                    }
-                    else if (ch == '\t')
-                    {
-                        int new_tab_pos = ((col + 4) / 4) * 4;
-
-                        bp_del_ch (bp, pos, 1);
-
-                        while (col < new_tab_pos)
-                        {
-                            bp_insert_ch (bp, pos, ' ');
-                            col++;
-                            pos++;
-                        }
-                    }
-                    else
-                    {
-                        pos++;
-                    }
-                }
+                free_buffer (bp);
+                bp = 0;
             }
         }
         else
         {
-            free (bp);
+            free_buffer (bp);
             bp = 0;
         }
     }
@@ -1345,37 +1877,18 @@ static int
 edit (BUFFER * bp)
 {
     int             ch;
-    int             pos;
     int             line            = -1;
     int             modified        = -1;
     int             selecting       = -1;
     int             total_update    = 1;
     int             do_exit         = FALSE;
 
-    pos = display_buffer (bp, 0);
-
-#if 0
-    if (lines < BOTTOM_LINE)
-    {
-        addstr (EOB_STRING);
-    }
-#endif
-
-    bp->window_start    = 0;
-
-    if (pos < bp->size)
-    {
-        bp->window_end = pos + 1;
-    }
-    else
-    {
-        bp->window_end = pos;
-    }
-
-    move (TOP_LINE, 0);
+    display_mark_window (bp);
 
     while (! do_exit)
     {
+        display_update (bp);
+
         if (line != bp->line || modified != bp->modified || selecting != (bp->select_pos >= 0))
         {
             show_buffer_status_line (bp, total_update);
@@ -1395,6 +1908,8 @@ edit (BUFFER * bp)
             case KEY_CTRL('X'):                         cmd_cut_region (bp);    break;
             case KEY_CTRL('V'):                         cmd_paste_region (bp);  break;
             case KEY_CTRL('G'):                         cmd_goto_line (bp);     break;
+            case KEY_CTRL('F'):                         cmd_search (bp, FALSE); break;
+            case KEY_CTRL('R'):                         cmd_search (bp, TRUE);  break;
             case KEY_LEFT:                              cmd_move_left (bp);     break;
             case KEY_RIGHT:                             cmd_move_right (bp);    break;
             case KEY_UP:                                cmd_move_up (bp);       break;
@@ -1434,38 +1949,93 @@ edit (BUFFER * bp)
     return 1;
 }
 
-static void
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * save_buffer () - write text with CRLF to a temp file, then replace file by temp file
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
 save_buffer (BUFFER * bp, const char * fname)
 {
-    FILE *  fp;
-    int     pos;
-
-    fp = fopen (fname, "w");
+    char            tmp_fname[TEMP_FNAME_LEN];
+    FILE *          fp;
+    PIECE *         pp;
+    const char *    p;
+    int             ch = '\n';                                                  // tricky for bp->size == 0
+    int             off;
+    int             end;
+    int             n;
+    int             i;
+    int             k;
+    int             rtc = 1;
+
+    if (! temp_fname (tmp_fname, fname, SAVE_TEMP_FNAME) || (fp = fopen (tmp_fname, "w")) == (FILE *) 0)
+    {
+        return 0;
+    }
 
-    if (fp)
+    for (i = 0; i < bp->n_pieces; i++)
     {
-        int ch = '\n';                                                                  // tricky for bp->size == 0
+        pp  = bp->pieces + i;
+        end = pp->start + pp->len;
 
-        for (pos = 0; pos < bp->size; pos++)
+        for (off = pp->start; off < end; off += n)                              // piece in chunks of at most one page
         {
-            ch = char_at (bp, pos);
-
-            if (ch == '\n')
+            if (pp->in_add)
+            {
+                p = bp->add + off;
+                n = end - off;
+            }
+            else
             {
-                fputc ('\r', fp);
+                p = orig_page (bp, off / PAGE_SIZE) + off % PAGE_SIZE;
+                n = PAGE_SIZE - off % PAGE_SIZE;
+
+                if (n > end - off)
+                {
+                    n = end - off;
+                }
             }
 
-            fputc (ch, fp);
-        }
+            for (k = 0; k < n; k++)
+            {
+                ch = p[k];
 
-        if (ch != '\n')
-        {
-            fputc ('\r', fp);
-            fputc ('\n', fp);
+                if (ch == '\n')
+                {
+                    fputc ('\r', fp);
+                }
+
+                fputc (ch, fp);
+            }
         }
+    }
 
-        fclose (fp);
+    if (ch != '\n')
+    {
+        fputc ('\r', fp);
+        fputc ('\n', fp);
+    }
+
+    if (ferror (fp))
+    {
+        rtc = 0;
+    }
+
+    if (fclose (fp) != 0)
+    {
+        rtc = 0;
+    }
+
+    if (rtc)
+    {
+        rtc = replace_file (tmp_fname, fname);
     }
+    else
+    {
+        remove_file (tmp_fname);
+    }
+
+    return rtc;
 }
 
 #ifdef unix
@@ -1475,11 +2045,13 @@ save_buffer (BUFFER * bp, const char * fname)
 int
 cmd_fe (int argc, const char ** argv)
 {
-    BUFFER * bp;
+    BUFFER *    bp;
+    int         rtc = EXIT_SUCCESS;
 
     if (argc == 2 && argv[1][0])
     {
         const char *    fname;
+        char            buf[64];
 
         fname = argv[1];
 
@@ -1487,39 +2059,44 @@ cmd_fe (int argc, const char ** argv)
 
         if (bp)
         {
-            if (bp->buf)
+            initscr ();
+            setscrreg (TOP_LINE, BOTTOM_LINE);
+            edit (bp);
+
+            buf[0] = '\0';
+
+            if (bp->modified)
             {
-                initscr ();
-                setscrreg (TOP_LINE, BOTTOM_LINE);
-                edit (bp);
+                move (PROMPT_LINE, 0);
+                clrtoeol ();
+                addstr ("Save file (y/n)? ");
+
+                while (buf[0] != 'y' && buf[0] != 'n')
+                {
+                    getnstr (buf, 2);
+                }
 
-                if (bp->modified)
+                if (buf[0] == 'y')
                 {
-                    char buf[64];
                     move (PROMPT_LINE, 0);
                     clrtoeol ();
-                    addstr ("Save file (y/n)? ");
-
-                    buf[0] = '\0';
+                    addstr ("Save file as: ");
 
-                    while (buf[0] != 'y' && buf[0] != 'n')
-                    {
-                        getnstr (buf, 2);
-                    }
+                    strcpy (buf, fname);
+                    getnstr (buf, 64);
 
-                    if (buf[0] == 'y')
+                    if (! save_buffer (bp, buf))
                     {
-                        move (PROMPT_LINE, 0);
-                        clrtoeol ();
-                        addstr ("Save file as: ");
-
-                        strcpy (buf, fname);
-                        getnstr (buf, 64);
-                        save_buffer (bp, buf);
+                        rtc = EXIT_FAILURE;
                     }
                 }
+            }
 
-                endwin ();
+            endwin ();
+
+            if (rtc != EXIT_SUCCESS)
+            {
+                fprintf (stderr, "%s: cannot save", buf);
             }
 
             if (paste_buffer)
@@ -1535,5 +2112,5 @@ cmd_fe (int argc, const char ** argv)
             return EXIT_FAILURE;
         }
     }
-    return EXIT_SUCCESS;
+    return rtc;
 }
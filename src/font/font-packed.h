@@ -0,0 +1,3191 @@
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * font-packed.h - compressed fonts, generated by fontgen.c - do not edit
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+
+static const FONT_RANGE font_ranges_05x08[6] =
+{
+    { 0x21, 0x81,   0 },
+    { 0x8A, 0x8E,  97 },
+    { 0x91, 0x91, 102 },
+    { 0x94, 0x95, 103 },
+    { 0x97, 0x98, 105 },
+    { 0xA1, 0xFF, 107 },
+};
+
+static const uint8_t font_data_05x08[1616] =
+{
+    0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x50,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xF8,0x50,0xF8,0xA0,0x00,0x00,
+    0x20,0x70,0x60,0x20,0x30,0x70,0x20,0x00,0x48,0xA8,0x70,0x70,0xA8,0x90,0x00,0x00,0x20,0x50,0x60,0xA8,0x90,0x68,0x00,0x00,
+    0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x20,0x40,0x40,0x40,0x20,0x18,0x00,0xC0,0x20,0x10,0x10,0x10,0x20,0xC0,0x00,
+    0x20,0x50,0x20,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x70,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x40,
+    0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x08,0x10,0x10,0x20,0x20,0x40,0x40,0x00,
+    0x30,0x48,0x48,0x48,0x48,0x30,0x00,0x00,0x20,0x60,0x20,0x20,0x20,0x70,0x00,0x00,0x60,0x10,0x10,0x20,0x40,0x70,0x00,0x00,
+    0x60,0x10,0x60,0x10,0x10,0x60,0x00,0x00,0x10,0x30,0x50,0x78,0x10,0x10,0x00,0x00,0x70,0x40,0x60,0x10,0x10,0x60,0x00,0x00,
+    0x30,0x40,0x70,0x48,0x48,0x30,0x00,0x00,0x78,0x08,0x10,0x20,0x20,0x20,0x00,0x00,0x30,0x48,0x30,0x48,0x48,0x30,0x00,0x00,
+    0x30,0x48,0x48,0x38,0x08,0x30,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x20,0x20,0x40,
+    0x00,0x08,0x10,0x60,0x10,0x08,0x00,0x00,0x00,0x00,0x78,0x00,0x78,0x00,0x00,0x00,0x00,0x40,0x20,0x18,0x20,0x40,0x00,0x00,
+    0x70,0x08,0x10,0x20,0x00,0x20,0x00,0x00,0x30,0x48,0x98,0xA8,0xB8,0x80,0x78,0x00,0x00,0x20,0x50,0x50,0xF8,0x88,0x00,0x00,
+    0x00,0x70,0x50,0x60,0x50,0x70,0x00,0x00,0x00,0x38,0x40,0x40,0x40,0x38,0x00,0x00,0x00,0x70,0x48,0x48,0x48,0x70,0x00,0x00,
+    0x00,0x70,0x40,0x70,0x40,0x70,0x00,0x00,0x00,0x70,0x40,0x70,0x40,0x40,0x00,0x00,0x00,0x38,0x40,0x58,0x48,0x38,0x00,0x00,
+    0x00,0x48,0x48,0x78,0x48,0x48,0x00,0x00,0x00,0x70,0x20,0x20,0x20,0x70,0x00,0x00,0x00,0x70,0x10,0x10,0x10,0x60,0x00,0x00,
+    0x00,0x48,0x50,0x60,0x50,0x48,0x00,0x00,0x00,0x40,0x40,0x40,0x40,0x78,0x00,0x00,0x00,0x88,0xD8,0xA8,0xA8,0x88,0x00,0x00,
+    0x00,0x48,0x68,0x58,0x48,0x48,0x00,0x00,0x00,0x70,0x88,0x88,0x88,0x70,0x00,0x00,0x00,0x70,0x48,0x70,0x40,0x40,0x00,0x00,
+    0x00,0x70,0x88,0x88,0x88,0x70,0x10,0x08,0x00,0x60,0x50,0x60,0x50,0x48,0x00,0x00,0x00,0x30,0x40,0x20,0x10,0x60,0x00,0x00,
+    0x00,0xF8,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x48,0x48,0x48,0x48,0x30,0x00,0x00,0x00,0x48,0x48,0x48,0x30,0x30,0x00,0x00,
+    0x00,0x88,0xA8,0xA8,0x50,0x50,0x00,0x00,0x00,0x88,0x50,0x20,0x50,0x88,0x00,0x00,0x00,0x88,0x50,0x20,0x20,0x20,0x00,0x00,
+    0x00,0x78,0x08,0x30,0x40,0x78,0x00,0x00,0x30,0x20,0x20,0x20,0x20,0x20,0x30,0x00,0x80,0x40,0x40,0x20,0x20,0x10,0x10,0x00,
+    0x60,0x20,0x20,0x20,0x20,0x20,0x60,0x00,0x20,0x50,0x50,0x88,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,
+    0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10,0x70,0x78,0x00,0x00,0x40,0x40,0x70,0x48,0x48,0x70,0x00,0x00,
+    0x00,0x00,0x30,0x40,0x40,0x30,0x00,0x00,0x10,0x10,0x70,0x90,0x90,0x70,0x00,0x00,0x00,0x00,0x20,0x70,0x40,0x30,0x00,0x00,
+    0x18,0x20,0x78,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x38,0x48,0x78,0x08,0x70,0x00,0x40,0x40,0x50,0x68,0x48,0x48,0x00,0x00,
+    0x20,0x00,0x60,0x20,0x20,0x20,0x00,0x00,0x10,0x00,0x70,0x10,0x10,0x10,0x60,0x00,0x40,0x40,0x50,0x60,0x50,0x48,0x00,0x00,
+    0x60,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0xA8,0xF8,0xA8,0xA8,0x00,0x00,0x00,0x00,0x50,0x68,0x48,0x48,0x00,0x00,
+    0x00,0x00,0x30,0x48,0x48,0x30,0x00,0x00,0x00,0x00,0x70,0x48,0x48,0x70,0x40,0x00,0x00,0x00,0x70,0x90,0x90,0x70,0x10,0x00,
+    0x00,0x00,0x50,0x60,0x40,0x40,0x00,0x00,0x00,0x00,0x30,0x60,0x10,0x60,0x00,0x00,0x00,0x20,0x78,0x20,0x20,0x10,0x00,0x00,
+    0x00,0x00,0x48,0x48,0x58,0x28,0x00,0x00,0x00,0x00,0x48,0x48,0x30,0x30,0x00,0x00,0x00,0x00,0xA8,0xA8,0x70,0x50,0x00,0x00,
+    0x00,0x00,0x48,0x30,0x30,0x48,0x00,0x00,0x00,0x00,0x48,0x48,0x30,0x30,0xE0,0x00,0x00,0x00,0x70,0x30,0x40,0x70,0x00,0x00,
+    0x10,0x20,0x20,0x40,0x20,0x20,0x10,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x40,0x20,0x20,0x10,0x20,0x20,0x40,0x00,
+    0x00,0x00,0x00,0x68,0x90,0x00,0x00,0x00,0x00,0x20,0x50,0x50,0x50,0x70,0x00,0x00,0x20,0x20,0x70,0xF8,0x70,0x20,0x20,0x00,
+    0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0x20,0x20,0x20,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x20,0x20,0x20,0x20,
+    0x00,0x00,0x00,0x38,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x38,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0xF8,0x20,0x20,0x20,0x20,
+    0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x38,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0xE0,0x20,0x20,0x20,0x20,
+    0x00,0x00,0x00,0xF8,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x20,0x00,0x20,0x20,0x20,0x00,
+    0x00,0x20,0x70,0x40,0x70,0x20,0x00,0x00,0x00,0x20,0x40,0x60,0xC0,0x70,0x00,0x00,0x00,0x88,0x70,0x50,0x70,0x88,0x00,0x00,
+    0x00,0x88,0x50,0x20,0x70,0x20,0x00,0x00,0x20,0x20,0x20,0x00,0x00,0x20,0x20,0x20,0x30,0x40,0x20,0x50,0x20,0x10,0x60,0x00,
+    0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x88,0xB8,0xA8,0xB8,0x88,0x70,0x00,0x60,0x10,0x70,0x50,0x70,0x00,0x00,0x00,
+    0x00,0x28,0x50,0xA0,0x50,0x28,0x00,0x00,0x00,0x00,0x00,0x70,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,
+    0x70,0xB8,0xB8,0xA8,0xB8,0x70,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x48,0x48,0x30,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x20,0x70,0x20,0x70,0x00,0x00,0x60,0x10,0x20,0x40,0x70,0x00,0x00,0x00,0x60,0x10,0x60,0x10,0x60,0x00,0x00,0x00,
+    0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x48,0x58,0x68,0x40,0x00,0x70,0xD0,0xD0,0x50,0x50,0x50,0x50,0x00,
+    0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x60,0x20,0x20,0x20,0x70,0x00,0x00,0x00,
+    0x20,0x50,0x50,0x50,0x20,0x00,0x00,0x00,0x00,0xA0,0x50,0x28,0x50,0xA0,0x00,0x00,0xC8,0x50,0x50,0x28,0x58,0x88,0x00,0x00,
+    0xC8,0x50,0x78,0x28,0x50,0x98,0x00,0x00,0xC8,0xD0,0x50,0xE8,0x58,0x88,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x10,0x60,0x00,
+    0x40,0x20,0x50,0x50,0xF8,0x88,0x00,0x00,0x10,0x20,0x50,0x50,0xF8,0x88,0x00,0x00,0x30,0x48,0x20,0x50,0xF8,0x88,0x00,0x00,
+    0x68,0x90,0x20,0x50,0xF8,0x88,0x00,0x00,0x50,0x20,0x50,0x50,0xF8,0x88,0x00,0x00,0x20,0x50,0x20,0x50,0xF8,0x88,0x00,0x00,
+    0x00,0x38,0x50,0x58,0xF0,0x98,0x00,0x00,0x00,0x38,0x40,0x40,0x40,0x38,0x10,0x20,0x80,0x70,0x40,0x70,0x40,0x70,0x00,0x00,
+    0x08,0x70,0x40,0x70,0x40,0x70,0x00,0x00,0x70,0x70,0x40,0x70,0x40,0x70,0x00,0x00,0x88,0x70,0x40,0x70,0x40,0x70,0x00,0x00,
+    0x80,0x70,0x20,0x20,0x20,0x70,0x00,0x00,0x08,0x70,0x20,0x20,0x20,0x70,0x00,0x00,0x70,0x70,0x20,0x20,0x20,0x70,0x00,0x00,
+    0x88,0x70,0x20,0x20,0x20,0x70,0x00,0x00,0x00,0x70,0x48,0xE8,0x48,0x70,0x00,0x00,0xF8,0x48,0x68,0x58,0x48,0x48,0x00,0x00,
+    0x80,0x70,0x88,0x88,0x88,0x70,0x00,0x00,0x08,0x70,0x88,0x88,0x88,0x70,0x00,0x00,0x70,0x70,0x88,0x88,0x88,0x70,0x00,0x00,
+    0xF0,0x70,0x88,0x88,0x88,0x70,0x00,0x00,0x88,0x70,0x88,0x88,0x88,0x70,0x00,0x00,0x00,0x00,0x48,0x30,0x30,0x48,0x00,0x00,
+    0x08,0x70,0x98,0xA8,0xC8,0x70,0x80,0x00,0x80,0x48,0x48,0x48,0x48,0x30,0x00,0x00,0x08,0x90,0x90,0x90,0x90,0x60,0x00,0x00,
+    0x78,0x48,0x48,0x48,0x48,0x30,0x00,0x00,0x90,0x48,0x48,0x48,0x48,0x30,0x00,0x00,0x10,0xA8,0x50,0x20,0x20,0x20,0x00,0x00,
+    0x00,0x40,0x70,0x48,0x70,0x40,0x00,0x00,0x20,0x50,0x50,0x50,0x48,0x50,0x00,0x00,0x80,0x40,0x60,0x10,0x70,0x78,0x00,0x00,
+    0x08,0x10,0x60,0x10,0x70,0x78,0x00,0x00,0x30,0x48,0x60,0x10,0x70,0x78,0x00,0x00,0x68,0x90,0x60,0x10,0x70,0x78,0x00,0x00,
+    0x50,0x00,0x60,0x10,0x70,0x78,0x00,0x00,0x20,0x50,0x60,0x10,0x70,0x78,0x00,0x00,0x00,0x00,0xD0,0x38,0xE0,0x98,0x00,0x00,
+    0x00,0x00,0x30,0x40,0x40,0x30,0x10,0x20,0x80,0x40,0x20,0x70,0x40,0x30,0x00,0x00,0x08,0x10,0x20,0x70,0x40,0x30,0x00,0x00,
+    0x30,0x48,0x20,0x70,0x40,0x30,0x00,0x00,0x50,0x00,0x20,0x70,0x40,0x30,0x00,0x00,0x80,0x40,0x60,0x20,0x20,0x20,0x00,0x00,
+    0x08,0x10,0x60,0x20,0x20,0x20,0x00,0x00,0x30,0x48,0x60,0x20,0x20,0x20,0x00,0x00,0x50,0x00,0x60,0x20,0x20,0x20,0x00,0x00,
+    0xF0,0x20,0x70,0x90,0x90,0x60,0x00,0x00,0x78,0x00,0x50,0x68,0x48,0x48,0x00,0x00,0x80,0x40,0x30,0x48,0x48,0x30,0x00,0x00,
+    0x08,0x10,0x30,0x48,0x48,0x30,0x00,0x00,0x60,0x90,0x30,0x48,0x48,0x30,0x00,0x00,0x68,0x90,0x30,0x48,0x48,0x30,0x00,0x00,
+    0x48,0x00,0x30,0x48,0x48,0x30,0x00,0x00,0x00,0x20,0x00,0x70,0x00,0x20,0x00,0x00,0x00,0x08,0x30,0x58,0x68,0x30,0x40,0x00,
+    0x40,0x20,0x48,0x48,0x58,0x28,0x00,0x00,0x08,0x10,0x48,0x48,0x58,0x28,0x00,0x00,0x60,0x90,0x48,0x48,0x58,0x28,0x00,0x00,
+    0x48,0x00,0x48,0x48,0x58,0x28,0x00,0x00,0x08,0x10,0x48,0x48,0x30,0x30,0xC0,0x00,0x40,0x40,0x70,0x48,0x48,0x70,0x40,0x00,
+    0x48,0x00,0x48,0x48,0x30,0x30,0xE0,0x00,
+};
+
+static const FONT_PACKED font_05x08 = { 5, 8, 6, font_ranges_05x08, (const uint16_t *) 0, font_data_05x08 };
+
+static const FONT_RANGE font_ranges_05x12[6] =
+{
+    { 0x21, 0x81,   0 },
+    { 0x8A, 0x8E,  97 },
+    { 0x91, 0x91, 102 },
+    { 0x94, 0x95, 103 },
+    { 0x97, 0x98, 105 },
+    { 0xA1, 0xFF, 107 },
+};
+
+static const uint8_t font_data_05x12[2424] =
+{
+    0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x20,0x00,0x00,0x50,0x50,0x50,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x50,0x50,0xF8,0x50,0x50,0xF8,0x50,0x50,0x00,0x00,0x00,0x00,0x40,0x60,0x90,0x80,0x40,0x20,0x10,0x90,0x60,0x20,0x00,
+    0x00,0xD0,0xD0,0x20,0x20,0x40,0x40,0x40,0xB0,0xB0,0x00,0x00,0x00,0x40,0xA0,0xA0,0xA0,0x40,0xA8,0x90,0x90,0x68,0x00,0x00,
+    0x30,0x30,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x20,0x00,0x00,
+    0x00,0x40,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x40,0x00,0x00,0x00,0x00,0x20,0xA8,0x70,0x70,0xA8,0x20,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x20,0x20,0xF8,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x60,0x20,0x40,
+    0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x60,0x00,0x00,
+    0x00,0x10,0x10,0x20,0x20,0x40,0x40,0x40,0x80,0x80,0x00,0x00,0x00,0x70,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0xE0,0x00,0x00,
+    0x00,0x20,0x60,0xA0,0x20,0x20,0x20,0x20,0x20,0xF0,0x00,0x00,0x00,0x60,0x90,0x90,0x10,0x20,0x40,0x80,0x80,0xF0,0x00,0x00,
+    0x00,0x60,0x90,0x10,0x10,0x60,0x10,0x10,0x90,0x60,0x00,0x00,0x00,0x10,0x30,0x50,0x50,0x90,0xF0,0x10,0x10,0x10,0x00,0x00,
+    0x00,0xF0,0x80,0x80,0x80,0xE0,0x10,0x10,0x90,0x60,0x00,0x00,0x00,0x30,0x40,0x80,0xE0,0x90,0x90,0x90,0x90,0x60,0x00,0x00,
+    0x00,0xF0,0x10,0x10,0x10,0x20,0x20,0x40,0x40,0x40,0x00,0x00,0x00,0x60,0x90,0x90,0x90,0x60,0x90,0x90,0x90,0x60,0x00,0x00,
+    0x00,0x60,0x90,0x90,0x90,0x90,0x70,0x10,0x20,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x60,0x00,0x00,0x60,0x60,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x60,0x60,0x00,0x00,0x60,0x60,0x20,0x40,0x00,0x00,0x10,0x20,0x40,0x80,0x80,0x40,0x20,0x10,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x40,0x20,0x10,0x10,0x20,0x40,0x80,0x00,0x00,
+    0x00,0x60,0x90,0x90,0x10,0x20,0x20,0x00,0x20,0x20,0x00,0x00,0x00,0x60,0x90,0x90,0x90,0xB0,0xB0,0x80,0x80,0x70,0x00,0x00,
+    0x00,0x60,0x90,0x90,0x90,0xF0,0x90,0x90,0x90,0x90,0x00,0x00,0x00,0xE0,0x90,0x90,0x90,0xE0,0x90,0x90,0x90,0xE0,0x00,0x00,
+    0x00,0x60,0x90,0x90,0x80,0x80,0x80,0x80,0x90,0x60,0x00,0x00,0x00,0xE0,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0xE0,0x00,0x00,
+    0x00,0xF0,0x80,0x80,0x80,0xF0,0x80,0x80,0x80,0xF0,0x00,0x00,0x00,0xF0,0x80,0x80,0x80,0xF0,0x80,0x80,0x80,0x80,0x00,0x00,
+    0x00,0x60,0x90,0x90,0x80,0x80,0xB0,0x90,0x90,0x60,0x00,0x00,0x00,0x90,0x90,0x90,0x90,0xF0,0x90,0x90,0x90,0x90,0x00,0x00,
+    0x00,0x70,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x00,0x00,0x00,0x70,0x20,0x20,0x20,0x20,0x20,0xA0,0xA0,0x40,0x00,0x00,
+    0x00,0x90,0x90,0xA0,0xA0,0xC0,0xA0,0xA0,0x90,0x90,0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0xF0,0x00,0x00,
+    0x00,0x90,0x90,0xF0,0xF0,0x90,0x90,0x90,0x90,0x90,0x00,0x00,0x00,0x90,0x90,0xD0,0xD0,0xB0,0xB0,0x90,0x90,0x90,0x00,0x00,
+    0x00,0x60,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x60,0x00,0x00,0x00,0xE0,0x90,0x90,0x90,0xE0,0x80,0x80,0x80,0x80,0x00,0x00,
+    0x00,0x60,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x60,0x20,0x10,0x00,0xE0,0x90,0x90,0x90,0xE0,0xC0,0xA0,0x90,0x90,0x00,0x00,
+    0x00,0x60,0x90,0x90,0x80,0x60,0x10,0x90,0x90,0x60,0x00,0x00,0x00,0xF8,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,
+    0x00,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x60,0x00,0x00,0x00,0x90,0x90,0x90,0x90,0x90,0x50,0x50,0x20,0x20,0x00,0x00,
+    0x00,0x90,0x90,0x90,0x90,0x90,0x90,0xF0,0x90,0x90,0x00,0x00,0x00,0x90,0x90,0x90,0x60,0x60,0x60,0x90,0x90,0x90,0x00,0x00,
+    0x00,0x88,0x88,0x88,0x50,0x50,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0xF0,0x10,0x20,0x20,0x40,0x40,0x80,0x80,0xF0,0x00,0x00,
+    0x00,0x60,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x60,0x00,0x00,0x00,0x80,0x80,0x40,0x40,0x20,0x20,0x20,0x10,0x10,0x00,0x00,
+    0x00,0x60,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x60,0x00,0x00,0x00,0x20,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x60,0x60,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x60,0x10,0x70,0x90,0x90,0x70,0x00,0x00,0x00,0x80,0x80,0x80,0xE0,0x90,0x90,0x90,0x90,0xE0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x70,0x80,0x80,0x80,0x80,0x70,0x00,0x00,0x00,0x10,0x10,0x10,0x70,0x90,0x90,0x90,0x90,0x70,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x60,0x90,0x90,0xF0,0x80,0x70,0x00,0x00,0x00,0x20,0x40,0x40,0xE0,0x40,0x40,0x40,0x40,0x40,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x70,0x90,0x90,0x90,0x90,0x70,0x10,0x60,0x00,0x80,0x80,0x80,0xE0,0x90,0x90,0x90,0x90,0x90,0x00,0x00,
+    0x00,0x00,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x70,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0xA0,0x40,
+    0x00,0x80,0x80,0x80,0x90,0xA0,0xC0,0xC0,0xA0,0x90,0x00,0x00,0x00,0x60,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x90,0xF0,0x90,0x90,0x90,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xD0,0x90,0x90,0x90,0x90,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x60,0x90,0x90,0x90,0x90,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x90,0x90,0x90,0x90,0xE0,0x80,0x80,
+    0x00,0x00,0x00,0x00,0x70,0x90,0x90,0x90,0x90,0x70,0x10,0x10,0x00,0x00,0x00,0x00,0xB0,0x50,0x40,0x40,0x40,0x40,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x60,0x90,0x40,0x20,0x90,0x60,0x00,0x00,0x00,0x00,0x40,0x40,0xE0,0x40,0x40,0x40,0x40,0x60,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x90,0x90,0x90,0x90,0x90,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x90,0x50,0x50,0x20,0x20,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x90,0x90,0x90,0x90,0xF0,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x90,0x60,0x60,0x90,0x90,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x90,0x90,0x90,0x90,0x90,0x70,0x10,0xE0,0x00,0x00,0x00,0x00,0xF0,0x10,0x20,0x40,0x80,0xF0,0x00,0x00,
+    0x00,0x20,0x40,0x40,0x40,0x80,0x40,0x40,0x40,0x20,0x00,0x00,0x20,0x20,0x20,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x00,0x00,
+    0x00,0x40,0x20,0x20,0x20,0x10,0x20,0x20,0x20,0x40,0x00,0x00,0x00,0x50,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x20,0x20,0x50,0x50,0x88,0x88,0x88,0x88,0xF8,0x00,0x00,0x20,0x20,0x70,0x70,0xF8,0xF8,0xF8,0x70,0x70,0x20,0x20,0x00,
+    0x00,0x00,0xA8,0x00,0x00,0x50,0x00,0x00,0xA8,0x00,0x00,0x50,0x20,0x20,0x20,0x20,0x20,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xE0,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x38,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0xF8,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x38,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0xE0,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0xF8,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,
+    0x00,0x00,0x00,0x20,0x70,0x88,0x80,0x88,0x70,0x20,0x00,0x00,0x00,0x20,0x50,0x40,0x40,0xE0,0x40,0x40,0xD0,0xF0,0x00,0x00,
+    0x00,0x90,0x60,0x90,0x90,0x90,0x90,0x90,0x60,0x90,0x00,0x00,0x00,0x88,0x50,0x50,0xF8,0x20,0xF8,0x20,0x20,0x20,0x00,0x00,
+    0x20,0x20,0x20,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x60,0x90,0x80,0x60,0x90,0x60,0x10,0x90,0x60,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x50,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x88,0xA8,0xC8,0xC8,0xA8,0x88,0x70,0x00,0x00,
+    0x00,0x60,0x10,0x70,0x90,0x70,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x50,0xA0,0xA0,0x50,0x50,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x70,0x88,0xE8,0xD8,0xE8,0xD8,0x88,0x70,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x60,0x90,0x90,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0xF8,0x20,0x20,0x00,0xF8,0x00,0x00,
+    0x60,0x90,0x10,0x60,0x80,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x10,0x60,0x10,0x90,0x60,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x60,0x60,0x20,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x90,0x90,0x90,0x90,0xE0,0x80,0x80,
+    0x00,0x70,0xD0,0xD0,0xD0,0xD0,0x50,0x50,0x50,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xB0,0x70,0x00,0x00,0x00,0x00,0x00,0x20,0x60,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x60,0x90,0x90,0x90,0x60,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xA0,0x50,0x50,0xA0,0xA0,0x00,0x00,0x00,
+    0x00,0x40,0x50,0x50,0x20,0x40,0x50,0xB0,0xB0,0x10,0x00,0x00,0x00,0x40,0x50,0x50,0x20,0x40,0x70,0x90,0xA0,0x30,0x00,0x00,
+    0xE0,0x40,0x30,0xD0,0x20,0x40,0x50,0xB0,0xB0,0x10,0x00,0x00,0x00,0x40,0x40,0x00,0x40,0x40,0x80,0x80,0x90,0x60,0x00,0x00,
+    0xC0,0x20,0x00,0x60,0x90,0x90,0xF0,0x90,0x90,0x90,0x00,0x00,0x30,0x40,0x00,0x60,0x90,0x90,0xF0,0x90,0x90,0x90,0x00,0x00,
+    0x20,0x50,0x00,0x60,0x90,0x90,0xF0,0x90,0x90,0x90,0x00,0x00,0x50,0xA0,0x00,0x60,0x90,0x90,0xF0,0x90,0x90,0x90,0x00,0x00,
+    0x50,0x00,0x60,0x90,0x90,0x90,0xF0,0x90,0x90,0x90,0x00,0x00,0x20,0x50,0x20,0x60,0x90,0x90,0xF0,0x90,0x90,0x90,0x00,0x00,
+    0x00,0x00,0x70,0xE0,0xA0,0xA0,0xF0,0xA0,0xA0,0xB0,0x00,0x00,0x00,0x60,0x90,0x90,0x80,0x80,0x80,0x80,0x90,0x60,0x20,0x40,
+    0x60,0x10,0x00,0xF0,0x80,0x80,0xF0,0x80,0x80,0xF0,0x00,0x00,0x30,0x40,0x00,0xF0,0x80,0x80,0xF0,0x80,0x80,0xF0,0x00,0x00,
+    0x20,0x50,0x00,0xF0,0x80,0x80,0xF0,0x80,0x80,0xF0,0x00,0x00,0x00,0x50,0x00,0xF0,0x80,0x80,0xF0,0x80,0x80,0xF0,0x00,0x00,
+    0x60,0x10,0x00,0x70,0x20,0x20,0x20,0x20,0x20,0x70,0x00,0x00,0x30,0x40,0x00,0x70,0x20,0x20,0x20,0x20,0x20,0x70,0x00,0x00,
+    0x20,0x50,0x00,0x70,0x20,0x20,0x20,0x20,0x20,0x70,0x00,0x00,0x00,0x50,0x00,0x70,0x20,0x20,0x20,0x20,0x20,0x70,0x00,0x00,
+    0x00,0x60,0x50,0x50,0x50,0xF0,0x50,0x50,0x50,0x60,0x00,0x00,0x50,0xA0,0x00,0x90,0xD0,0xF0,0xB0,0x90,0x90,0x90,0x00,0x00,
+    0x60,0x10,0x00,0x60,0x90,0x90,0x90,0x90,0x90,0x60,0x00,0x00,0x30,0x40,0x00,0x60,0x90,0x90,0x90,0x90,0x90,0x60,0x00,0x00,
+    0x20,0x50,0x00,0x60,0x90,0x90,0x90,0x90,0x90,0x60,0x00,0x00,0x50,0xA0,0x00,0x60,0x90,0x90,0x90,0x90,0x90,0x60,0x00,0x00,
+    0x50,0x00,0x60,0x90,0x90,0x90,0x90,0x90,0x90,0x60,0x00,0x00,0x00,0x00,0x00,0x88,0x50,0x20,0x50,0x88,0x00,0x00,0x00,0x00,
+    0x70,0x90,0xB0,0xB0,0xB0,0xD0,0xD0,0xD0,0xD0,0xE0,0x00,0x00,0x60,0x10,0x00,0x90,0x90,0x90,0x90,0x90,0x90,0x60,0x00,0x00,
+    0x30,0x40,0x00,0x90,0x90,0x90,0x90,0x90,0x90,0x60,0x00,0x00,0x20,0x50,0x00,0x90,0x90,0x90,0x90,0x90,0x90,0x60,0x00,0x00,
+    0x50,0x00,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x70,0x00,0x00,0x30,0x40,0x00,0x88,0x88,0x50,0x50,0x20,0x20,0x20,0x00,0x00,
+    0x00,0xC0,0x80,0xE0,0x90,0x90,0x90,0xE0,0x80,0xC0,0x00,0x00,0x00,0x60,0x90,0x90,0xA0,0xE0,0x90,0x90,0x90,0xE0,0x80,0x80,
+    0x00,0xC0,0x20,0x00,0x60,0x90,0x10,0x70,0x90,0x70,0x00,0x00,0x00,0x30,0x40,0x00,0x60,0x90,0x10,0x70,0x90,0x70,0x00,0x00,
+    0x00,0x60,0x90,0x00,0x60,0x90,0x10,0x70,0x90,0x70,0x00,0x00,0x00,0x50,0xA0,0x00,0x60,0x90,0x10,0x70,0x90,0x70,0x00,0x00,
+    0x00,0x50,0x50,0x00,0x60,0x90,0x10,0x70,0x90,0x70,0x00,0x00,0x00,0x20,0x50,0x20,0x60,0x90,0x10,0x70,0x90,0x70,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x70,0x28,0x28,0x70,0xA0,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x80,0x80,0x80,0x80,0x70,0x20,0xC0,
+    0x00,0xC0,0x20,0x00,0x60,0x90,0x90,0xF0,0x80,0x70,0x00,0x00,0x00,0x30,0x40,0x00,0x60,0x90,0x90,0xF0,0x80,0x70,0x00,0x00,
+    0x00,0x60,0x90,0x00,0x60,0x90,0x90,0xF0,0x80,0x70,0x00,0x00,0x00,0x50,0x50,0x00,0x60,0x90,0x90,0xF0,0x80,0x70,0x00,0x00,
+    0x00,0x60,0x10,0x00,0x60,0x20,0x20,0x20,0x20,0x70,0x00,0x00,0x00,0x30,0x40,0x00,0x60,0x20,0x20,0x20,0x20,0x70,0x00,0x00,
+    0x00,0x60,0x90,0x00,0x60,0x20,0x20,0x20,0x20,0x70,0x00,0x00,0x00,0x50,0x50,0x00,0x60,0x20,0x20,0x20,0x20,0x70,0x00,0x00,
+    0x00,0x00,0x30,0x40,0x40,0x20,0x70,0x90,0x90,0x60,0x00,0x00,0x00,0x50,0xA0,0x00,0xA0,0xD0,0x90,0x90,0x90,0x90,0x00,0x00,
+    0x00,0x60,0x10,0x00,0x60,0x90,0x90,0x90,0x90,0x60,0x00,0x00,0x00,0x30,0x40,0x00,0x60,0x90,0x90,0x90,0x90,0x60,0x00,0x00,
+    0x00,0x60,0x90,0x00,0x60,0x90,0x90,0x90,0x90,0x60,0x00,0x00,0x00,0x50,0xA0,0x00,0x60,0x90,0x90,0x90,0x90,0x60,0x00,0x00,
+    0x00,0x50,0x50,0x00,0x60,0x90,0x90,0x90,0x90,0x60,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xF8,0x00,0x20,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x10,0x70,0xB0,0xB0,0xD0,0xE0,0x80,0x00,0x00,0x00,0xC0,0x20,0x00,0x90,0x90,0x90,0x90,0x90,0x70,0x00,0x00,
+    0x00,0x30,0x40,0x00,0x90,0x90,0x90,0x90,0x90,0x70,0x00,0x00,0x00,0x60,0x90,0x00,0x90,0x90,0x90,0x90,0x90,0x70,0x00,0x00,
+    0x00,0x50,0x50,0x00,0x90,0x90,0x90,0x90,0x90,0x70,0x00,0x00,0x00,0x30,0x40,0x00,0x90,0x90,0x90,0x90,0x90,0x70,0x10,0xE0,
+    0x00,0x00,0x00,0xC0,0x80,0xE0,0x90,0xE0,0x80,0xC0,0x00,0x00,0x00,0x50,0x50,0x00,0x90,0x90,0x90,0x90,0x90,0x70,0x10,0xE0,
+};
+
+static const FONT_PACKED font_05x12 = { 5, 12, 6, font_ranges_05x12, (const uint16_t *) 0, font_data_05x12 };
+
+static const FONT_RANGE font_ranges_06x08[6] =
+{
+    { 0x21, 0x81,   0 },
+    { 0x8A, 0x8E,  97 },
+    { 0x91, 0x91, 102 },
+    { 0x94, 0x95, 103 },
+    { 0x97, 0x98, 105 },
+    { 0xA1, 0xFF, 107 },
+};
+
+static const uint8_t font_data_06x08[1616] =
+{
+    0x10,0x38,0x38,0x10,0x10,0x00,0x10,0x00,0x6C,0x6C,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x7C,0x28,0x28,0x7C,0x28,0x00,
+    0x20,0x38,0x40,0x30,0x08,0x70,0x10,0x00,0x64,0x64,0x08,0x10,0x20,0x4C,0x4C,0x00,0x20,0x50,0x50,0x20,0x54,0x48,0x34,0x00,
+    0x30,0x30,0x20,0x00,0x00,0x00,0x00,0x00,0x10,0x20,0x20,0x20,0x20,0x20,0x10,0x00,0x20,0x10,0x10,0x10,0x10,0x10,0x20,0x00,
+    0x00,0x28,0x38,0x7C,0x38,0x28,0x00,0x00,0x00,0x10,0x10,0x7C,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x20,
+    0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x00,0x00,0x04,0x08,0x10,0x20,0x40,0x00,0x00,
+    0x38,0x44,0x4C,0x54,0x64,0x44,0x38,0x00,0x10,0x30,0x10,0x10,0x10,0x10,0x38,0x00,0x38,0x44,0x04,0x18,0x20,0x40,0x7C,0x00,
+    0x38,0x44,0x04,0x38,0x04,0x44,0x38,0x00,0x08,0x18,0x28,0x48,0x7C,0x08,0x08,0x00,0x7C,0x40,0x40,0x78,0x04,0x44,0x38,0x00,
+    0x18,0x20,0x40,0x78,0x44,0x44,0x38,0x00,0x7C,0x04,0x08,0x10,0x20,0x20,0x20,0x00,0x38,0x44,0x44,0x38,0x44,0x44,0x38,0x00,
+    0x38,0x44,0x44,0x3C,0x04,0x08,0x30,0x00,0x00,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x00,0x00,0x30,0x30,0x00,0x30,0x30,0x20,
+    0x08,0x10,0x20,0x40,0x20,0x10,0x08,0x00,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0x20,0x10,0x08,0x04,0x08,0x10,0x20,0x00,
+    0x38,0x44,0x04,0x18,0x10,0x00,0x10,0x00,0x38,0x44,0x5C,0x54,0x5C,0x40,0x38,0x00,0x38,0x44,0x44,0x44,0x7C,0x44,0x44,0x00,
+    0x78,0x44,0x44,0x78,0x44,0x44,0x78,0x00,0x38,0x44,0x40,0x40,0x40,0x44,0x38,0x00,0x78,0x44,0x44,0x44,0x44,0x44,0x78,0x00,
+    0x7C,0x40,0x40,0x78,0x40,0x40,0x7C,0x00,0x7C,0x40,0x40,0x78,0x40,0x40,0x40,0x00,0x38,0x44,0x40,0x5C,0x44,0x44,0x3C,0x00,
+    0x44,0x44,0x44,0x7C,0x44,0x44,0x44,0x00,0x38,0x10,0x10,0x10,0x10,0x10,0x38,0x00,0x04,0x04,0x04,0x04,0x44,0x44,0x38,0x00,
+    0x44,0x48,0x50,0x60,0x50,0x48,0x44,0x00,0x40,0x40,0x40,0x40,0x40,0x40,0x7C,0x00,0x44,0x6C,0x54,0x44,0x44,0x44,0x44,0x00,
+    0x44,0x64,0x54,0x4C,0x44,0x44,0x44,0x00,0x38,0x44,0x44,0x44,0x44,0x44,0x38,0x00,0x78,0x44,0x44,0x78,0x40,0x40,0x40,0x00,
+    0x38,0x44,0x44,0x44,0x54,0x48,0x34,0x00,0x78,0x44,0x44,0x78,0x48,0x44,0x44,0x00,0x38,0x44,0x40,0x38,0x04,0x44,0x38,0x00,
+    0x7C,0x10,0x10,0x10,0x10,0x10,0x10,0x00,0x44,0x44,0x44,0x44,0x44,0x44,0x38,0x00,0x44,0x44,0x44,0x44,0x44,0x28,0x10,0x00,
+    0x44,0x44,0x54,0x54,0x54,0x54,0x28,0x00,0x44,0x44,0x28,0x10,0x28,0x44,0x44,0x00,0x44,0x44,0x44,0x28,0x10,0x10,0x10,0x00,
+    0x78,0x08,0x10,0x20,0x40,0x40,0x78,0x00,0x38,0x20,0x20,0x20,0x20,0x20,0x38,0x00,0x00,0x40,0x20,0x10,0x08,0x04,0x00,0x00,
+    0x38,0x08,0x08,0x08,0x08,0x08,0x38,0x00,0x10,0x28,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,
+    0x30,0x30,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x04,0x3C,0x44,0x3C,0x00,0x40,0x40,0x78,0x44,0x44,0x44,0x78,0x00,
+    0x00,0x00,0x38,0x44,0x40,0x44,0x38,0x00,0x04,0x04,0x3C,0x44,0x44,0x44,0x3C,0x00,0x00,0x00,0x38,0x44,0x78,0x40,0x38,0x00,
+    0x18,0x20,0x20,0x78,0x20,0x20,0x20,0x00,0x00,0x00,0x3C,0x44,0x44,0x3C,0x04,0x38,0x40,0x40,0x70,0x48,0x48,0x48,0x48,0x00,
+    0x10,0x00,0x10,0x10,0x10,0x10,0x18,0x00,0x08,0x00,0x18,0x08,0x08,0x08,0x48,0x30,0x40,0x40,0x48,0x50,0x60,0x50,0x48,0x00,
+    0x10,0x10,0x10,0x10,0x10,0x10,0x18,0x00,0x00,0x00,0x68,0x54,0x54,0x44,0x44,0x00,0x00,0x00,0x70,0x48,0x48,0x48,0x48,0x00,
+    0x00,0x00,0x38,0x44,0x44,0x44,0x38,0x00,0x00,0x00,0x78,0x44,0x44,0x44,0x78,0x40,0x00,0x00,0x3C,0x44,0x44,0x44,0x3C,0x04,
+    0x00,0x00,0x58,0x24,0x20,0x20,0x70,0x00,0x00,0x00,0x38,0x40,0x38,0x04,0x38,0x00,0x00,0x20,0x78,0x20,0x20,0x28,0x10,0x00,
+    0x00,0x00,0x48,0x48,0x48,0x58,0x28,0x00,0x00,0x00,0x44,0x44,0x44,0x28,0x10,0x00,0x00,0x00,0x44,0x44,0x54,0x7C,0x28,0x00,
+    0x00,0x00,0x48,0x48,0x30,0x48,0x48,0x00,0x00,0x00,0x48,0x48,0x48,0x38,0x10,0x60,0x00,0x00,0x78,0x08,0x30,0x40,0x78,0x00,
+    0x18,0x20,0x20,0x60,0x20,0x20,0x18,0x00,0x10,0x10,0x10,0x00,0x10,0x10,0x10,0x00,0x30,0x08,0x08,0x0C,0x08,0x08,0x30,0x00,
+    0x28,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x38,0x6C,0x44,0x44,0x7C,0x00,0x00,0x00,0x10,0x38,0x7C,0x7C,0x38,0x10,0x00,
+    0x54,0x00,0xA8,0x00,0x54,0x00,0xA8,0x00,0x10,0x10,0x10,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x10,0x10,0x10,0x10,
+    0x00,0x00,0x00,0x1C,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x1C,0x00,0x00,0x00,0x00,0x10,0x10,0x10,0xFC,0x10,0x10,0x10,0x10,
+    0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x1C,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xF0,0x10,0x10,0x10,0x10,
+    0x00,0x00,0x00,0xFC,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x00,0x10,0x10,0x38,0x38,0x10,0x00,
+    0x00,0x10,0x38,0x40,0x40,0x38,0x10,0x00,0x18,0x24,0x20,0x78,0x20,0x24,0x5C,0x00,0x44,0x38,0x44,0x44,0x44,0x38,0x44,0x00,
+    0x44,0x28,0x10,0x7C,0x10,0x7C,0x10,0x00,0x10,0x10,0x10,0x00,0x10,0x10,0x10,0x00,0x38,0x44,0x30,0x28,0x18,0x44,0x38,0x00,
+    0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x78,0x84,0xB4,0xA4,0xB4,0x84,0x78,0x00,0x38,0x04,0x3C,0x44,0x3C,0x00,0x3C,0x00,
+    0x00,0x00,0x24,0x48,0x24,0x00,0x00,0x00,0x00,0x00,0xFC,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,
+    0x78,0x94,0xAC,0xB4,0xAC,0x84,0x78,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x48,0x48,0x30,0x00,0x00,0x00,0x00,
+    0x00,0x10,0x38,0x10,0x00,0x38,0x00,0x00,0x60,0x10,0x20,0x70,0x00,0x00,0x00,0x00,0x70,0x20,0x30,0x60,0x00,0x00,0x00,0x00,
+    0x30,0x30,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x48,0x48,0x70,0x40,0x40,0x3C,0x54,0x54,0x34,0x14,0x14,0x14,0x00,
+    0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x18,0x00,0x00,0x00,0x20,0x60,0x20,0x20,0x00,0x00,0x00,0x00,
+    0x30,0x48,0x48,0x48,0x30,0x00,0x78,0x00,0x00,0x00,0x48,0x24,0x48,0x00,0x00,0x00,0x40,0x48,0x50,0x2C,0x54,0x1C,0x04,0x00,
+    0x40,0x48,0x50,0x38,0x44,0x08,0x1C,0x00,0xC0,0x68,0xD0,0x2C,0x54,0x1C,0x04,0x00,0x10,0x00,0x10,0x30,0x40,0x44,0x38,0x00,
+    0x30,0x00,0x10,0x28,0x44,0x7C,0x44,0x00,0x18,0x00,0x10,0x28,0x44,0x7C,0x44,0x00,0x38,0x00,0x10,0x28,0x44,0x7C,0x44,0x00,
+    0x14,0x28,0x10,0x28,0x44,0x7C,0x44,0x00,0x28,0x00,0x10,0x28,0x44,0x7C,0x44,0x00,0x38,0x28,0x38,0x6C,0x44,0x7C,0x44,0x00,
+    0x3C,0x50,0x50,0x7C,0x50,0x50,0x5C,0x00,0x38,0x44,0x40,0x40,0x44,0x38,0x10,0x30,0x30,0x00,0x7C,0x40,0x78,0x40,0x7C,0x00,
+    0x0C,0x00,0x7C,0x40,0x78,0x40,0x7C,0x00,0x38,0x00,0x7C,0x40,0x78,0x40,0x7C,0x00,0x28,0x00,0x7C,0x40,0x78,0x40,0x7C,0x00,
+    0x30,0x00,0x38,0x10,0x10,0x10,0x38,0x00,0x18,0x00,0x38,0x10,0x10,0x10,0x38,0x00,0x38,0x00,0x38,0x10,0x10,0x10,0x38,0x00,
+    0x28,0x00,0x38,0x10,0x10,0x10,0x38,0x00,0x38,0x24,0x24,0x74,0x24,0x24,0x38,0x00,0x28,0x50,0x00,0x48,0x68,0x58,0x48,0x00,
+    0x60,0x30,0x48,0x48,0x48,0x48,0x30,0x00,0x18,0x30,0x48,0x48,0x48,0x48,0x30,0x00,0x38,0x30,0x48,0x48,0x48,0x48,0x30,0x00,
+    0x28,0x50,0x30,0x48,0x48,0x48,0x30,0x00,0x48,0x30,0x48,0x48,0x48,0x48,0x30,0x00,0x00,0x44,0x28,0x10,0x28,0x44,0x00,0x00,
+    0x3C,0x4C,0x54,0x54,0x54,0x64,0x78,0x00,0x60,0x00,0x48,0x48,0x48,0x48,0x30,0x00,0x18,0x00,0x48,0x48,0x48,0x48,0x30,0x00,
+    0x38,0x00,0x48,0x48,0x48,0x48,0x30,0x00,0x28,0x00,0x48,0x48,0x48,0x48,0x30,0x00,0x18,0x00,0x44,0x28,0x10,0x10,0x10,0x00,
+    0x60,0x40,0x70,0x48,0x48,0x70,0x40,0x60,0x00,0x70,0x48,0x70,0x48,0x48,0x70,0x40,0x30,0x00,0x38,0x04,0x3C,0x44,0x3C,0x00,
+    0x18,0x00,0x38,0x04,0x3C,0x44,0x3C,0x00,0x38,0x00,0x38,0x04,0x3C,0x44,0x3C,0x00,0x14,0x28,0x38,0x04,0x3C,0x44,0x3C,0x00,
+    0x28,0x00,0x38,0x04,0x3C,0x44,0x3C,0x00,0x38,0x28,0x38,0x04,0x3C,0x44,0x3C,0x00,0x00,0x00,0x78,0x14,0x7C,0x50,0x3C,0x00,
+    0x00,0x38,0x44,0x40,0x44,0x38,0x10,0x30,0x30,0x00,0x38,0x44,0x78,0x40,0x38,0x00,0x0C,0x00,0x38,0x44,0x78,0x40,0x38,0x00,
+    0x38,0x00,0x38,0x44,0x78,0x40,0x38,0x00,0x28,0x00,0x38,0x44,0x78,0x40,0x38,0x00,0x20,0x00,0x10,0x10,0x10,0x10,0x18,0x00,
+    0x18,0x00,0x10,0x10,0x10,0x10,0x18,0x00,0x38,0x00,0x10,0x10,0x10,0x10,0x18,0x00,0x28,0x00,0x10,0x10,0x10,0x10,0x18,0x00,
+    0x30,0x40,0x20,0x10,0x38,0x48,0x30,0x00,0x28,0x50,0x00,0x70,0x48,0x48,0x48,0x00,0x60,0x00,0x30,0x48,0x48,0x48,0x30,0x00,
+    0x18,0x00,0x30,0x48,0x48,0x48,0x30,0x00,0x38,0x00,0x30,0x48,0x48,0x48,0x30,0x00,0x28,0x50,0x00,0x30,0x48,0x48,0x30,0x00,
+    0x28,0x00,0x30,0x48,0x48,0x48,0x30,0x00,0x00,0x10,0x00,0x7C,0x00,0x10,0x00,0x00,0x00,0x00,0x04,0x38,0x58,0x68,0x70,0x80,
+    0x60,0x00,0x48,0x48,0x48,0x58,0x28,0x00,0x18,0x00,0x48,0x48,0x48,0x58,0x28,0x00,0x38,0x00,0x48,0x48,0x48,0x58,0x28,0x00,
+    0x48,0x00,0x48,0x48,0x48,0x58,0x28,0x00,0x18,0x00,0x48,0x48,0x48,0x38,0x10,0x60,0x00,0x60,0x40,0x70,0x48,0x70,0x40,0x60,
+    0x28,0x00,0x48,0x48,0x48,0x38,0x10,0x60,
+};
+
+static const FONT_PACKED font_06x08 = { 6, 8, 6, font_ranges_06x08, (const uint16_t *) 0, font_data_06x08 };
+
+static const FONT_RANGE font_ranges_06x10[6] =
+{
+    { 0x21, 0x81,   0 },
+    { 0x8A, 0x8E,  97 },
+    { 0x91, 0x91, 102 },
+    { 0x94, 0x95, 103 },
+    { 0x97, 0x98, 105 },
+    { 0xA1, 0xFF, 107 },
+};
+
+static const uint8_t font_data_06x10[2020] =
+{
+    0x00,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x50,0x50,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x28,0x7C,
+    0x50,0xF8,0xA0,0xA0,0x00,0x00,0x20,0x78,0xA0,0xE0,0x30,0x28,0x28,0xF0,0x20,0x00,0x00,0x44,0xA8,0x50,0x30,0x28,0x54,0x88,
+    0x00,0x00,0x00,0x20,0x50,0x70,0x64,0xB4,0x98,0x78,0x00,0x00,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x10,
+    0x20,0x20,0x20,0x20,0x20,0x10,0x0C,0x00,0xC0,0x20,0x10,0x10,0x10,0x10,0x10,0x20,0xC0,0x00,0x00,0x20,0xD8,0x60,0x50,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0xF8,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x10,0x20,
+    0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x00,0x00,0x04,0x08,0x08,0x10,
+    0x30,0x20,0x40,0x40,0x80,0x00,0x00,0x70,0x88,0x88,0x88,0x88,0x88,0x70,0x00,0x00,0x00,0x60,0xA0,0x20,0x20,0x20,0x20,0xF8,
+    0x00,0x00,0x00,0x70,0x08,0x08,0x10,0x20,0x40,0x78,0x00,0x00,0x00,0x78,0x08,0x08,0x30,0x08,0x08,0x70,0x00,0x00,0x00,0x10,
+    0x30,0x50,0x90,0xF8,0x10,0x10,0x00,0x00,0x00,0x78,0x40,0x40,0x70,0x08,0x08,0x70,0x00,0x00,0x00,0x38,0x40,0x80,0xB0,0xC8,
+    0x88,0x70,0x00,0x00,0x00,0x78,0x08,0x10,0x20,0x20,0x40,0x40,0x00,0x00,0x00,0x70,0x88,0x90,0x70,0x88,0x88,0x70,0x00,0x00,
+    0x00,0x70,0x88,0x88,0x78,0x08,0x10,0xE0,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x00,0x00,0x00,0x00,0x30,
+    0x30,0x00,0x30,0x30,0x10,0x20,0x00,0x00,0x00,0x08,0x30,0xC0,0x30,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x80,0x60,0x18,0x60,0x80,0x00,0x00,0x00,0x78,0x48,0x08,0x10,0x20,0x00,0x20,0x00,0x00,0x00,0x78,
+    0x88,0xB8,0xA8,0xBC,0x80,0x78,0x00,0x00,0x00,0x30,0x30,0x50,0x48,0x78,0x48,0x84,0x00,0x00,0x00,0xF0,0x88,0x88,0xF0,0x88,
+    0x88,0xF0,0x00,0x00,0x00,0x38,0x40,0x80,0x80,0x80,0x40,0x38,0x00,0x00,0x00,0xF0,0x88,0x88,0x88,0x88,0x88,0xF0,0x00,0x00,
+    0x00,0x78,0x40,0x40,0x70,0x40,0x40,0x78,0x00,0x00,0x00,0x78,0x40,0x40,0x70,0x40,0x40,0x40,0x00,0x00,0x00,0x38,0x40,0x80,
+    0x98,0x88,0x48,0x38,0x00,0x00,0x00,0x88,0x88,0x88,0xF8,0x88,0x88,0x88,0x00,0x00,0x00,0xF8,0x20,0x20,0x20,0x20,0x20,0xF8,
+    0x00,0x00,0x00,0x70,0x10,0x10,0x10,0x10,0x10,0x60,0x00,0x00,0x00,0x88,0x90,0xA0,0xC0,0xA0,0x90,0x88,0x00,0x00,0x00,0x40,
+    0x40,0x40,0x40,0x40,0x40,0x78,0x00,0x00,0x00,0x88,0xD8,0xD8,0xE8,0xA8,0xA8,0x88,0x00,0x00,0x00,0x88,0xC8,0xE8,0xA8,0x98,
+    0x98,0x88,0x00,0x00,0x00,0x70,0x88,0x88,0x88,0x88,0x88,0x70,0x00,0x00,0x00,0xF0,0x88,0x88,0xF0,0x80,0x80,0x80,0x00,0x00,
+    0x00,0x70,0x88,0x88,0x88,0x88,0x88,0x70,0x0C,0x00,0x00,0xE0,0x90,0x90,0xE0,0xA0,0x90,0x88,0x00,0x00,0x00,0x38,0x40,0x40,
+    0x30,0x08,0x08,0x70,0x00,0x00,0x00,0xF8,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x88,0x88,0x88,0x88,0x88,0x88,0x70,
+    0x00,0x00,0x00,0x84,0x88,0x48,0x48,0x50,0x30,0x20,0x00,0x00,0x00,0x88,0xA8,0xA8,0xA8,0xF0,0x50,0x50,0x00,0x00,0x00,0x84,
+    0x48,0x30,0x10,0x30,0x48,0x84,0x00,0x00,0x00,0x88,0x50,0x50,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0xF8,0x08,0x10,0x20,0x40,
+    0x80,0xF8,0x00,0x00,0x38,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x38,0x00,0x80,0x40,0x40,0x20,0x20,0x10,0x08,0x08,0x04,0x00,
+    0x70,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x70,0x00,0x00,0x20,0x20,0x50,0x50,0x50,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xFC,0x00,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x08,0x38,0x48,0x7C,
+    0x00,0x00,0x80,0x80,0x80,0xB0,0xC8,0x88,0x88,0xF0,0x00,0x00,0x00,0x00,0x00,0x78,0x80,0x80,0x80,0x78,0x00,0x00,0x08,0x08,
+    0x08,0x78,0x88,0x88,0x98,0x68,0x00,0x00,0x00,0x00,0x00,0x70,0x88,0xF8,0x80,0x78,0x00,0x00,0x18,0x20,0x20,0x78,0x20,0x20,
+    0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x78,0x88,0x88,0x98,0x68,0x08,0x70,0x80,0x80,0x80,0xB8,0xC8,0x88,0x88,0x88,0x00,0x00,
+    0x10,0x00,0x00,0x70,0x10,0x10,0x10,0x10,0x00,0x00,0x10,0x00,0x00,0x70,0x10,0x10,0x10,0x10,0x10,0xE0,0x40,0x40,0x40,0x48,
+    0x50,0x60,0x50,0x48,0x00,0x00,0xE0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0xF8,0xA8,0xA8,0xA8,0xA8,
+    0x00,0x00,0x00,0x00,0x00,0xB8,0xC8,0x88,0x88,0x88,0x00,0x00,0x00,0x00,0x00,0x70,0x88,0x88,0x88,0x70,0x00,0x00,0x00,0x00,
+    0x00,0xB0,0xC8,0x88,0x88,0xF0,0x80,0x80,0x00,0x00,0x00,0x78,0x88,0x88,0x98,0x68,0x08,0x08,0x00,0x00,0x00,0x58,0x68,0x40,
+    0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x38,0x40,0x30,0x08,0x70,0x00,0x00,0x00,0x20,0x20,0x78,0x20,0x20,0x20,0x18,0x00,0x00,
+    0x00,0x00,0x00,0x88,0x88,0x88,0x98,0xE8,0x00,0x00,0x00,0x00,0x00,0x88,0x50,0x50,0x50,0x20,0x00,0x00,0x00,0x00,0x00,0xA4,
+    0xB4,0xB4,0x48,0x48,0x00,0x00,0x00,0x00,0x00,0x88,0x50,0x20,0x50,0x88,0x00,0x00,0x00,0x00,0x00,0x84,0x48,0x48,0x30,0x30,
+    0x20,0xC0,0x00,0x00,0x00,0xF8,0x10,0x20,0x40,0xF8,0x00,0x00,0x38,0x20,0x20,0x20,0x40,0x20,0x20,0x20,0x38,0x00,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x70,0x10,0x10,0x10,0x08,0x10,0x10,0x10,0x70,0x00,0x00,0x00,0x00,0x00,0xE4,0x9C,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x50,0x88,0x88,0x88,0xF8,0x00,0x00,0x00,0x10,0x30,0x78,0xFC,0x78,0x30,0x10,0x00,0x00,
+    0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0x10,0x10,0x10,0x10,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xF0,0x10,0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00,0x1C,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x1C,0x00,0x00,0x00,
+    0x00,0x00,0x10,0x10,0x10,0x10,0xFC,0x10,0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x10,0x10,
+    0x10,0x10,0x1C,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xF0,0x10,0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00,0xFC,0x10,
+    0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x20,0x20,0x20,
+    0x00,0x10,0x38,0x50,0x50,0x50,0x38,0x10,0x00,0x00,0x00,0x18,0x20,0x20,0x70,0x20,0x20,0x78,0x00,0x00,0x00,0x84,0x78,0x48,
+    0x48,0x78,0x84,0x00,0x00,0x00,0x00,0x84,0x48,0x30,0x70,0x20,0x70,0x20,0x00,0x00,0x20,0x20,0x20,0x00,0x00,0x00,0x20,0x20,
+    0x20,0x00,0x00,0x38,0x40,0x30,0x48,0x68,0x10,0x08,0x70,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,
+    0x84,0xB4,0xA4,0xB4,0x84,0x78,0x00,0x00,0x00,0x70,0x70,0x50,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x50,0xA0,
+    0x50,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x70,0x88,0xE8,0x88,0x70,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x50,0x20,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0xF8,0x20,0x20,0xF8,0x00,0x00,0x00,0x70,0x20,0x70,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x38,0x10,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x88,0x88,0x88,0x98,0xE8,0x80,0x80,0x00,0xF8,0xE8,0x68,0x28,0x28,0x28,0x28,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x30,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x30,0x00,0x30,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x30,0x48,0x48,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x50,0x28,0x50,0xA0,0x00,0x00,0x00,0xC8,0x50,0x50,
+    0x38,0x68,0x7C,0x88,0x00,0x00,0x00,0xC8,0x50,0x50,0x3C,0x44,0x58,0x9C,0x00,0x00,0x00,0xE4,0xC8,0xF0,0x38,0x28,0x7C,0x88,
+    0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x20,0x40,0x48,0x78,0x40,0x30,0x30,0x50,0x48,0x78,0x48,0x84,0x00,0x00,0x10,0x30,
+    0x30,0x50,0x48,0x78,0x48,0x84,0x00,0x00,0x20,0x70,0x30,0x50,0x48,0x78,0x48,0x84,0x00,0x00,0x50,0xB0,0x30,0x50,0x48,0x78,
+    0x48,0x84,0x00,0x00,0x50,0x30,0x30,0x50,0x48,0x78,0x48,0x84,0x00,0x00,0x38,0x10,0x30,0x28,0x48,0x78,0x44,0x84,0x00,0x00,
+    0x00,0x1C,0x30,0x30,0x58,0x50,0x70,0x9C,0x00,0x00,0x00,0x38,0x40,0x80,0x80,0x80,0x40,0x38,0x10,0x30,0x20,0x78,0x40,0x40,
+    0x70,0x40,0x40,0x78,0x00,0x00,0x08,0x78,0x40,0x40,0x70,0x40,0x40,0x78,0x00,0x00,0x20,0x78,0x40,0x40,0x70,0x40,0x40,0x78,
+    0x00,0x00,0x50,0x78,0x40,0x40,0x70,0x40,0x40,0x78,0x00,0x00,0x20,0xF8,0x20,0x20,0x20,0x20,0x20,0xF8,0x00,0x00,0x10,0xF8,
+    0x20,0x20,0x20,0x20,0x20,0xF8,0x00,0x00,0x20,0xF8,0x20,0x20,0x20,0x20,0x20,0xF8,0x00,0x00,0x50,0xF8,0x20,0x20,0x20,0x20,
+    0x20,0xF8,0x00,0x00,0x00,0xF0,0x88,0x88,0xC8,0x88,0x88,0xF0,0x00,0x00,0x50,0xA8,0xC8,0xE8,0xA8,0x98,0x98,0x88,0x00,0x00,
+    0x20,0x70,0x88,0x88,0x88,0x88,0x88,0x70,0x00,0x00,0x10,0x70,0x88,0x88,0x88,0x88,0x88,0x70,0x00,0x00,0x20,0x70,0x88,0x88,
+    0x88,0x88,0x88,0x70,0x00,0x00,0x50,0xF0,0x88,0x88,0x88,0x88,0x88,0x70,0x00,0x00,0x50,0x70,0x88,0x88,0x88,0x88,0x88,0x70,
+    0x00,0x00,0x00,0x00,0x00,0x88,0x50,0x20,0x50,0x88,0x00,0x00,0x00,0x78,0x98,0xA8,0xA8,0xC8,0xC8,0xF0,0x00,0x00,0x20,0x98,
+    0x88,0x88,0x88,0x88,0x88,0x70,0x00,0x00,0x10,0xA8,0x88,0x88,0x88,0x88,0x88,0x70,0x00,0x00,0x20,0xD8,0x88,0x88,0x88,0x88,
+    0x88,0x70,0x00,0x00,0x50,0x88,0x88,0x88,0x88,0x88,0x88,0x70,0x00,0x00,0x08,0x98,0x50,0x50,0x20,0x20,0x20,0x20,0x00,0x00,
+    0x00,0x80,0xF0,0x88,0x88,0x88,0xF0,0x80,0x00,0x00,0x70,0x90,0x90,0xA0,0xA0,0x90,0x88,0xB8,0x00,0x00,0x40,0x20,0x00,0x70,
+    0x08,0x38,0x48,0x7C,0x00,0x00,0x08,0x10,0x00,0x70,0x08,0x38,0x48,0x7C,0x00,0x00,0x20,0x50,0x00,0x70,0x08,0x38,0x48,0x7C,
+    0x00,0x00,0x50,0x70,0x00,0x70,0x08,0x38,0x48,0x7C,0x00,0x00,0x00,0x50,0x00,0x70,0x08,0x38,0x48,0x7C,0x00,0x00,0x00,0x10,
+    0x28,0x70,0x08,0x38,0x48,0x7C,0x00,0x00,0x00,0x00,0x00,0xD8,0x24,0x7C,0xA0,0xDC,0x00,0x00,0x00,0x00,0x00,0x78,0x80,0x80,
+    0x80,0x78,0x10,0x30,0x40,0x20,0x00,0x70,0x88,0xF8,0x80,0x78,0x00,0x00,0x08,0x10,0x00,0x70,0x88,0xF8,0x80,0x78,0x00,0x00,
+    0x20,0x50,0x00,0x70,0x88,0xF8,0x80,0x78,0x00,0x00,0x00,0x50,0x00,0x70,0x88,0xF8,0x80,0x78,0x00,0x00,0x40,0x20,0x00,0x70,
+    0x10,0x10,0x10,0x10,0x00,0x00,0x10,0x20,0x00,0x70,0x10,0x10,0x10,0x10,0x00,0x00,0x20,0x50,0x00,0x70,0x10,0x10,0x10,0x10,
+    0x00,0x00,0x00,0x50,0x00,0x70,0x10,0x10,0x10,0x10,0x00,0x00,0xD0,0x60,0x90,0x78,0x88,0x88,0x88,0x70,0x00,0x00,0x50,0x70,
+    0x00,0xB8,0xC8,0x88,0x88,0x88,0x00,0x00,0x40,0x20,0x00,0x70,0x88,0x88,0x88,0x70,0x00,0x00,0x10,0x20,0x00,0x70,0x88,0x88,
+    0x88,0x70,0x00,0x00,0x20,0x50,0x00,0x70,0x88,0x88,0x88,0x70,0x00,0x00,0x50,0x70,0x00,0x70,0x88,0x88,0x88,0x70,0x00,0x00,
+    0x00,0x50,0x00,0x70,0x88,0x88,0x88,0x70,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xF8,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x78,
+    0x98,0xA8,0xC8,0xF0,0x00,0x00,0x40,0x20,0x00,0x88,0x88,0x88,0x98,0xE8,0x00,0x00,0x10,0x20,0x00,0x88,0x88,0x88,0x98,0xE8,
+    0x00,0x00,0x20,0x50,0x00,0x88,0x88,0x88,0x98,0xE8,0x00,0x00,0x00,0x50,0x00,0x88,0x88,0x88,0x98,0xE8,0x00,0x00,0x08,0x10,
+    0x00,0x84,0x48,0x48,0x30,0x30,0x20,0xC0,0x80,0x80,0x80,0xB0,0xC8,0x88,0x88,0xF0,0x80,0x80,0x00,0x50,0x00,0x84,0x48,0x48,
+    0x30,0x30,0x20,0xC0,
+};
+
+static const FONT_PACKED font_06x10 = { 6, 10, 6, font_ranges_06x10, (const uint16_t *) 0, font_data_06x10 };
+
+static const FONT_RANGE font_ranges_08x08[6] =
+{
+    { 0x21, 0x81,   0 },
+    { 0x8A, 0x8E,  97 },
+    { 0x91, 0x91, 102 },
+    { 0x94, 0x95, 103 },
+    { 0x97, 0x98, 105 },
+    { 0xA1, 0xFF, 107 },
+};
+
+static const uint8_t font_data_08x08[1616] =
+{
+    0x30,0x78,0x78,0x30,0x30,0x00,0x30,0x00,0x6C,0x6C,0x6C,0x00,0x00,0x00,0x00,0x00,0x6C,0x6C,0xFE,0x6C,0xFE,0x6C,0x6C,0x00,
+    0x30,0x7C,0xC0,0x78,0x0C,0xF8,0x30,0x00,0x00,0xC6,0xCC,0x18,0x30,0x66,0xC6,0x00,0x38,0x6C,0x38,0x76,0xDC,0xCC,0x76,0x00,
+    0x60,0x60,0xC0,0x00,0x00,0x00,0x00,0x00,0x18,0x30,0x60,0x60,0x60,0x30,0x18,0x00,0x60,0x30,0x18,0x18,0x18,0x30,0x60,0x00,
+    0x00,0x66,0x3C,0xFF,0x3C,0x66,0x00,0x00,0x00,0x30,0x30,0xFC,0x30,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x30,0x60,
+    0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x00,0x06,0x0C,0x18,0x30,0x60,0xC0,0x80,0x00,
+    0x78,0xCC,0xDC,0xFC,0xEC,0xCC,0x78,0x00,0x30,0xF0,0x30,0x30,0x30,0x30,0xFC,0x00,0x78,0xCC,0x0C,0x38,0x60,0xCC,0xFC,0x00,
+    0x78,0xCC,0x0C,0x38,0x0C,0xCC,0x78,0x00,0x1C,0x3C,0x6C,0xCC,0xFE,0x0C,0x0C,0x00,0xFC,0xC0,0xF8,0x0C,0x0C,0xCC,0x78,0x00,
+    0x38,0x60,0xC0,0xF8,0xCC,0xCC,0x78,0x00,0xFC,0xCC,0x0C,0x18,0x30,0x60,0x60,0x00,0x78,0xCC,0xCC,0x78,0xCC,0xCC,0x78,0x00,
+    0x78,0xCC,0xCC,0x7C,0x0C,0x18,0x70,0x00,0x00,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x00,0x00,0x30,0x30,0x00,0x70,0x30,0x60,
+    0x18,0x30,0x60,0xC0,0x60,0x30,0x18,0x00,0x00,0x00,0xFC,0x00,0xFC,0x00,0x00,0x00,0x60,0x30,0x18,0x0C,0x18,0x30,0x60,0x00,
+    0x78,0xCC,0x0C,0x18,0x30,0x00,0x30,0x00,0x7C,0xC6,0xDE,0xDE,0xDE,0xC0,0x78,0x00,0x30,0x78,0xCC,0xCC,0xFC,0xCC,0xCC,0x00,
+    0xFC,0x66,0x66,0x7C,0x66,0x66,0xFC,0x00,0x3C,0x66,0xC0,0xC0,0xC0,0x66,0x3C,0x00,0xFC,0x6C,0x66,0x66,0x66,0x6C,0xFC,0x00,
+    0xFE,0x62,0x68,0x78,0x68,0x62,0xFE,0x00,0xFE,0x62,0x68,0x78,0x68,0x60,0xF0,0x00,0x3C,0x66,0xC0,0xC0,0xCE,0x66,0x3E,0x00,
+    0xCC,0xCC,0xCC,0xFC,0xCC,0xCC,0xCC,0x00,0x78,0x30,0x30,0x30,0x30,0x30,0x78,0x00,0x1E,0x0C,0x0C,0x0C,0xCC,0xCC,0x78,0x00,
+    0xE6,0x66,0x6C,0x78,0x6C,0x66,0xE6,0x00,0xF0,0x60,0x60,0x60,0x62,0x66,0xFE,0x00,0xC6,0xEE,0xFE,0xD6,0xC6,0xC6,0xC6,0x00,
+    0xC6,0xE6,0xF6,0xDE,0xCE,0xC6,0xC6,0x00,0x38,0x6C,0xC6,0xC6,0xC6,0x6C,0x38,0x00,0xFC,0x66,0x66,0x7C,0x60,0x60,0xF0,0x00,
+    0x78,0xCC,0xCC,0xCC,0xDC,0x78,0x1C,0x00,0xFC,0x66,0x66,0x7C,0x78,0x6C,0xE6,0x00,0x78,0xCC,0xE0,0x38,0x1C,0xCC,0x78,0x00,
+    0xFC,0xB4,0x30,0x30,0x30,0x30,0x78,0x00,0xCC,0xCC,0xCC,0xCC,0xCC,0xCC,0xFC,0x00,0xCC,0xCC,0xCC,0xCC,0xCC,0x78,0x30,0x00,
+    0xC6,0xC6,0xC6,0xD6,0xFE,0xEE,0xC6,0x00,0xC6,0xC6,0x6C,0x38,0x6C,0xC6,0xC6,0x00,0xCC,0xCC,0xCC,0x78,0x30,0x30,0x78,0x00,
+    0xFE,0xCC,0x98,0x30,0x62,0xC6,0xFE,0x00,0x78,0x60,0x60,0x60,0x60,0x60,0x78,0x00,0xC0,0x60,0x30,0x18,0x0C,0x06,0x02,0x00,
+    0x78,0x18,0x18,0x18,0x18,0x18,0x78,0x00,0x10,0x38,0x6C,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
+    0x30,0x30,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x0C,0x7C,0xCC,0x76,0x00,0xE0,0x60,0x7C,0x66,0x66,0x66,0xBC,0x00,
+    0x00,0x00,0x78,0xCC,0xC0,0xCC,0x78,0x00,0x1C,0x0C,0x0C,0x7C,0xCC,0xCC,0x76,0x00,0x00,0x00,0x78,0xCC,0xFC,0xC0,0x78,0x00,
+    0x38,0x6C,0x60,0xF0,0x60,0x60,0xF0,0x00,0x00,0x00,0x76,0xCC,0xCC,0x7C,0x0C,0xF8,0xE0,0x60,0x6C,0x76,0x66,0x66,0xE6,0x00,
+    0x30,0x00,0x70,0x30,0x30,0x30,0x78,0x00,0x18,0x00,0x78,0x18,0x18,0x18,0xD8,0x70,0xE0,0x60,0x66,0x6C,0x78,0x6C,0xE6,0x00,
+    0x70,0x30,0x30,0x30,0x30,0x30,0x78,0x00,0x00,0x00,0xEC,0xFE,0xD6,0xC6,0xC6,0x00,0x00,0x00,0xF8,0xCC,0xCC,0xCC,0xCC,0x00,
+    0x00,0x00,0x78,0xCC,0xCC,0xCC,0x78,0x00,0x00,0x00,0xDC,0x66,0x66,0x7C,0x60,0xF0,0x00,0x00,0x76,0xCC,0xCC,0x7C,0x0C,0x1E,
+    0x00,0x00,0xD8,0x6C,0x6C,0x60,0xF0,0x00,0x00,0x00,0x7C,0xC0,0x78,0x0C,0xF8,0x00,0x10,0x30,0x7C,0x30,0x30,0x34,0x18,0x00,
+    0x00,0x00,0xCC,0xCC,0xCC,0xCC,0x76,0x00,0x00,0x00,0xCC,0xCC,0xCC,0x78,0x30,0x00,0x00,0x00,0xC6,0xC6,0xD6,0xFE,0x6C,0x00,
+    0x00,0x00,0xC6,0x6C,0x38,0x6C,0xC6,0x00,0x00,0x00,0xCC,0xCC,0xCC,0x7C,0x0C,0xF8,0x00,0x00,0xFC,0x98,0x30,0x64,0xFC,0x00,
+    0x1C,0x30,0x30,0xE0,0x30,0x30,0x1C,0x00,0x18,0x18,0x18,0x00,0x18,0x18,0x18,0x00,0xE0,0x30,0x30,0x1C,0x30,0x30,0xE0,0x00,
+    0x76,0xDC,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x38,0x6C,0xC6,0xC6,0xC6,0xFE,0x00,0x10,0x38,0x7C,0xFE,0x7C,0x38,0x10,0x00,
+    0x22,0x88,0x22,0x88,0x22,0x88,0x22,0x88,0x18,0x18,0x18,0x18,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x18,0x18,0x18,
+    0x00,0x00,0x00,0x00,0x1F,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1F,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0xFF,0x18,0x18,0x18,
+    0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x1F,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xF8,0x18,0x18,0x18,
+    0x00,0x00,0x00,0x00,0xFF,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x18,0x00,0x18,0x18,0x3C,0x3C,0x18,
+    0x18,0x18,0x7E,0xC0,0xC0,0x7E,0x18,0x18,0x38,0x6C,0x64,0xF0,0x60,0xE6,0xFC,0x00,0x00,0x82,0xFE,0x6C,0x6C,0xFE,0x82,0x00,
+    0xCC,0xCC,0x78,0xFC,0x30,0xFC,0x30,0x30,0x18,0x18,0x18,0x00,0x18,0x18,0x18,0x00,0x7E,0xC3,0x78,0xCC,0xCC,0x78,0x8C,0xF8,
+    0x00,0xCC,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0xB9,0xA1,0xB9,0x42,0x3C,0x00,0x3C,0x6C,0x6C,0x3E,0x00,0x7E,0x00,0x00,
+    0x00,0x33,0x66,0xCC,0x66,0x33,0x00,0x00,0x00,0x00,0x00,0xFC,0x0C,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,
+    0x3C,0x5A,0xA5,0xB9,0xA9,0x66,0x3C,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x6C,0x6C,0x38,0x00,0x00,0x00,0x00,
+    0x30,0x30,0xFC,0x30,0x30,0x00,0xFC,0x00,0x78,0x0C,0x38,0x60,0x7C,0x00,0x00,0x00,0x7C,0x0E,0x3C,0x0E,0x7C,0x00,0x00,0x00,
+    0x18,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x66,0x66,0x66,0x7C,0x60,0xC0,0x7F,0xDB,0xDB,0x7B,0x1B,0x1B,0x1B,0x00,
+    0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x60,0x38,0x78,0x18,0x18,0x7E,0x00,0x00,0x00,
+    0x3C,0x66,0x66,0x3C,0x00,0x7E,0x00,0x00,0x00,0xCC,0x66,0x33,0x66,0xCC,0x00,0x00,0xE6,0x6C,0x78,0x73,0x67,0xCD,0x9F,0x03,
+    0xE6,0x6C,0x78,0x7E,0x63,0xCE,0x98,0x1F,0xE6,0x2C,0x78,0x33,0xE7,0xCD,0x9F,0x03,0x30,0x00,0x30,0x60,0xC0,0xCC,0x78,0x00,
+    0xC0,0x60,0x30,0x78,0xCC,0xFC,0xCC,0x00,0x0C,0x18,0x30,0x78,0xCC,0xFC,0xCC,0x00,0x78,0x84,0x30,0x78,0xCC,0xFC,0xCC,0x00,
+    0x76,0xDC,0x30,0x78,0xCC,0xFC,0xCC,0x00,0xCC,0x30,0x78,0xCC,0xCC,0xFC,0xCC,0x00,0x30,0x48,0x30,0x78,0xCC,0xFC,0xCC,0x00,
+    0x3E,0x6C,0xCC,0xFE,0xCC,0xCC,0xCE,0x00,0x78,0xCC,0xC0,0xC0,0xCC,0x78,0x30,0x60,0x60,0x30,0xFC,0x60,0x78,0x60,0xFC,0x00,
+    0x18,0x30,0xFC,0x60,0x78,0x60,0xFC,0x00,0x78,0x84,0xFC,0x60,0x78,0x60,0xFC,0x00,0xCC,0x00,0xFC,0x60,0x78,0x60,0xFC,0x00,
+    0x60,0x30,0x78,0x30,0x30,0x30,0x78,0x00,0x18,0x30,0x78,0x30,0x30,0x30,0x78,0x00,0x78,0x84,0x78,0x30,0x30,0x30,0x78,0x00,
+    0xCC,0x00,0x78,0x30,0x30,0x30,0x78,0x00,0xFC,0x6C,0x66,0xF6,0x66,0x6C,0xFC,0x00,0x76,0xDC,0x00,0xEC,0xFC,0xDC,0xCC,0x00,
+    0x30,0x18,0x7C,0xC6,0xC6,0xC6,0x7C,0x00,0x18,0x30,0x7C,0xC6,0xC6,0xC6,0x7C,0x00,0x7C,0x82,0x7C,0xC6,0xC6,0xC6,0x7C,0x00,
+    0x76,0xDC,0x7C,0xC6,0xC6,0xC6,0x7C,0x00,0xC6,0x00,0x7C,0xC6,0xC6,0xC6,0x7C,0x00,0x00,0x00,0xCC,0x78,0x30,0x78,0xCC,0x00,
+    0x3A,0x6C,0xCE,0xD6,0xE6,0x6C,0xB8,0x00,0x60,0x30,0xCC,0xCC,0xCC,0xCC,0x78,0x00,0x18,0x30,0xCC,0xCC,0xCC,0xCC,0x78,0x00,
+    0x78,0x84,0x00,0xCC,0xCC,0xCC,0x78,0x00,0xCC,0x00,0xCC,0xCC,0xCC,0xCC,0x78,0x00,0x18,0x30,0xCC,0xCC,0x78,0x30,0x78,0x00,
+    0xF0,0x60,0x7C,0x66,0x7C,0x60,0xF0,0x00,0x00,0x78,0xCC,0xF8,0xCC,0xF8,0xC0,0xC0,0x60,0x30,0x78,0x0C,0x7C,0xCC,0x7E,0x00,
+    0x18,0x30,0x78,0x0C,0x7C,0xCC,0x7E,0x00,0x7E,0xC3,0x3C,0x06,0x3E,0x66,0x3F,0x00,0x76,0xDC,0x78,0x0C,0x7C,0xCC,0x7E,0x00,
+    0xCC,0x00,0x78,0x0C,0x7C,0xCC,0x7E,0x00,0x3C,0x66,0x3C,0x06,0x3E,0x66,0x3F,0x00,0x00,0x00,0x7F,0x0C,0x7F,0xCC,0x7F,0x00,
+    0x00,0x78,0xCC,0xC0,0xCC,0x78,0x30,0x60,0x60,0x30,0x78,0xCC,0xFC,0xC0,0x78,0x00,0x18,0x30,0x78,0xCC,0xFC,0xC0,0x78,0x00,
+    0x7E,0xC3,0x3C,0x66,0x7E,0x60,0x3C,0x00,0xCC,0x00,0x78,0xCC,0xFC,0xC0,0x78,0x00,0x60,0x30,0x70,0x30,0x30,0x30,0x78,0x00,
+    0x18,0x30,0x70,0x30,0x30,0x30,0x78,0x00,0x7C,0xC6,0x38,0x18,0x18,0x18,0x3C,0x00,0xCC,0x00,0x70,0x30,0x30,0x30,0x78,0x00,
+    0xD8,0x70,0xD8,0x0C,0x3C,0x6C,0x38,0x00,0x76,0xDC,0x00,0xF8,0xCC,0xCC,0xCC,0x00,0x60,0x30,0x00,0x78,0xCC,0xCC,0x78,0x00,
+    0x0C,0x18,0x00,0x78,0xCC,0xCC,0x78,0x00,0x78,0xCC,0x00,0x78,0xCC,0xCC,0x78,0x00,0x76,0xDC,0x00,0x78,0xCC,0xCC,0x78,0x00,
+    0x00,0xCC,0x00,0x78,0xCC,0xCC,0x78,0x00,0x30,0x30,0x00,0xFC,0x00,0x30,0x30,0x00,0x00,0x00,0x7C,0xCE,0xD6,0xE6,0x7C,0x00,
+    0x60,0x30,0x00,0xCC,0xCC,0xCC,0x7E,0x00,0x0C,0x18,0x00,0xCC,0xCC,0xCC,0x7E,0x00,0x78,0xCC,0x00,0xCC,0xCC,0xCC,0x7E,0x00,
+    0x00,0xCC,0x00,0xCC,0xCC,0xCC,0x7E,0x00,0x18,0x30,0x00,0xCC,0xCC,0xFC,0x0C,0xF8,0x00,0xE0,0x78,0x6C,0x78,0x60,0xF0,0x00,
+    0x00,0xCC,0x00,0xCC,0xCC,0xFC,0x0C,0xF8,
+};
+
+static const FONT_PACKED font_08x08 = { 8, 8, 6, font_ranges_08x08, (const uint16_t *) 0, font_data_08x08 };
+
+static const FONT_RANGE font_ranges_08x12[6] =
+{
+    { 0x21, 0x81,   0 },
+    { 0x8A, 0x8E,  97 },
+    { 0x91, 0x91, 102 },
+    { 0x94, 0x95, 103 },
+    { 0x97, 0x98, 105 },
+    { 0xA1, 0xFF, 107 },
+};
+
+static const uint8_t font_data_08x12[2424] =
+{
+    0x00,0x30,0x78,0x78,0x78,0x30,0x30,0x00,0x30,0x30,0x00,0x00,0x00,0x66,0x66,0x66,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x6C,0x6C,0xFE,0x6C,0x6C,0x6C,0xFE,0x6C,0x6C,0x00,0x00,0x30,0x30,0x7C,0xC0,0xC0,0x78,0x0C,0x0C,0xF8,0x30,0x30,0x00,
+    0x00,0x00,0x00,0xC4,0xCC,0x18,0x30,0x60,0xCC,0x8C,0x00,0x00,0x00,0x70,0xD8,0xD8,0x70,0xFA,0xDE,0xCC,0xDC,0x76,0x00,0x00,
+    0x00,0x30,0x30,0x30,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x18,0x30,0x60,0x60,0x60,0x30,0x18,0x0C,0x00,0x00,
+    0x00,0x60,0x30,0x18,0x0C,0x0C,0x0C,0x18,0x30,0x60,0x00,0x00,0x00,0x00,0x00,0x66,0x3C,0xFF,0x3C,0x66,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x18,0x18,0x7E,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x38,0x60,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x38,0x00,0x00,
+    0x00,0x00,0x02,0x06,0x0C,0x18,0x30,0x60,0xC0,0x80,0x00,0x00,0x00,0x7C,0xC6,0xCE,0xDE,0xD6,0xF6,0xE6,0xC6,0x7C,0x00,0x00,
+    0x00,0x10,0x30,0xF0,0x30,0x30,0x30,0x30,0x30,0xFC,0x00,0x00,0x00,0x78,0xCC,0xCC,0x0C,0x18,0x30,0x60,0xCC,0xFC,0x00,0x00,
+    0x00,0x78,0xCC,0x0C,0x0C,0x38,0x0C,0x0C,0xCC,0x78,0x00,0x00,0x00,0x0C,0x1C,0x3C,0x6C,0xCC,0xFE,0x0C,0x0C,0x1E,0x00,0x00,
+    0x00,0xFC,0xC0,0xC0,0xC0,0xF8,0x0C,0x0C,0xCC,0x78,0x00,0x00,0x00,0x38,0x60,0xC0,0xC0,0xF8,0xCC,0xCC,0xCC,0x78,0x00,0x00,
+    0x00,0xFE,0xC6,0xC6,0x06,0x0C,0x18,0x30,0x30,0x30,0x00,0x00,0x00,0x78,0xCC,0xCC,0xCC,0x78,0xCC,0xCC,0xCC,0x78,0x00,0x00,
+    0x00,0x78,0xCC,0xCC,0xCC,0x7C,0x18,0x18,0x30,0x70,0x00,0x00,0x00,0x00,0x00,0x38,0x38,0x00,0x00,0x38,0x38,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x38,0x38,0x00,0x00,0x38,0x38,0x18,0x30,0x00,0x00,0x0C,0x18,0x30,0x60,0xC0,0x60,0x30,0x18,0x0C,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x7E,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x30,0x18,0x0C,0x06,0x0C,0x18,0x30,0x60,0x00,0x00,
+    0x00,0x78,0xCC,0x0C,0x18,0x30,0x30,0x00,0x30,0x30,0x00,0x00,0x00,0x7C,0xC6,0xC6,0xDE,0xDE,0xDE,0xC0,0xC0,0x7C,0x00,0x00,
+    0x00,0x30,0x78,0xCC,0xCC,0xCC,0xFC,0xCC,0xCC,0xCC,0x00,0x00,0x00,0xFC,0x66,0x66,0x66,0x7C,0x66,0x66,0x66,0xFC,0x00,0x00,
+    0x00,0x3C,0x66,0xC6,0xC0,0xC0,0xC0,0xC6,0x66,0x3C,0x00,0x00,0x00,0xF8,0x6C,0x66,0x66,0x66,0x66,0x66,0x6C,0xF8,0x00,0x00,
+    0x00,0xFE,0x62,0x60,0x64,0x7C,0x64,0x60,0x62,0xFE,0x00,0x00,0x00,0xFE,0x66,0x62,0x64,0x7C,0x64,0x60,0x60,0xF0,0x00,0x00,
+    0x00,0x3C,0x66,0xC6,0xC0,0xC0,0xCE,0xC6,0x66,0x3E,0x00,0x00,0x00,0xCC,0xCC,0xCC,0xCC,0xFC,0xCC,0xCC,0xCC,0xCC,0x00,0x00,
+    0x00,0x78,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x78,0x00,0x00,0x00,0x1E,0x0C,0x0C,0x0C,0x0C,0xCC,0xCC,0xCC,0x78,0x00,0x00,
+    0x00,0xE6,0x66,0x6C,0x6C,0x78,0x6C,0x6C,0x66,0xE6,0x00,0x00,0x00,0xF0,0x60,0x60,0x60,0x60,0x62,0x66,0x66,0xFE,0x00,0x00,
+    0x00,0xC6,0xEE,0xFE,0xFE,0xD6,0xC6,0xC6,0xC6,0xC6,0x00,0x00,0x00,0xC6,0xC6,0xE6,0xF6,0xFE,0xDE,0xCE,0xC6,0xC6,0x00,0x00,
+    0x00,0x38,0x6C,0xC6,0xC6,0xC6,0xC6,0xC6,0x6C,0x38,0x00,0x00,0x00,0xFC,0x66,0x66,0x66,0x7C,0x60,0x60,0x60,0xF0,0x00,0x00,
+    0x00,0x38,0x6C,0xC6,0xC6,0xC6,0xCE,0xDE,0x7C,0x0C,0x1E,0x00,0x00,0xFC,0x66,0x66,0x66,0x7C,0x6C,0x66,0x66,0xE6,0x00,0x00,
+    0x00,0x78,0xCC,0xCC,0xC0,0x70,0x18,0xCC,0xCC,0x78,0x00,0x00,0x00,0xFC,0xB4,0x30,0x30,0x30,0x30,0x30,0x30,0x78,0x00,0x00,
+    0x00,0xCC,0xCC,0xCC,0xCC,0xCC,0xCC,0xCC,0xCC,0x78,0x00,0x00,0x00,0xCC,0xCC,0xCC,0xCC,0xCC,0xCC,0xCC,0x78,0x30,0x00,0x00,
+    0x00,0xC6,0xC6,0xC6,0xC6,0xD6,0xD6,0x6C,0x6C,0x6C,0x00,0x00,0x00,0xCC,0xCC,0xCC,0x78,0x30,0x78,0xCC,0xCC,0xCC,0x00,0x00,
+    0x00,0xCC,0xCC,0xCC,0xCC,0x78,0x30,0x30,0x30,0x78,0x00,0x00,0x00,0xFE,0xCE,0x98,0x18,0x30,0x60,0x62,0xC6,0xFE,0x00,0x00,
+    0x00,0x3C,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x3C,0x00,0x00,0x00,0x00,0x80,0xC0,0x60,0x30,0x18,0x0C,0x06,0x02,0x00,0x00,
+    0x00,0x3C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x3C,0x00,0x00,0x10,0x38,0x6C,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x30,0x30,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x78,0x0C,0x7C,0xCC,0xCC,0x76,0x00,0x00,0x00,0xE0,0x60,0x60,0x7C,0x66,0x66,0x66,0x66,0xDC,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x78,0xCC,0xC0,0xC0,0xCC,0x78,0x00,0x00,0x00,0x1C,0x0C,0x0C,0x7C,0xCC,0xCC,0xCC,0xCC,0x76,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x78,0xCC,0xFC,0xC0,0xCC,0x78,0x00,0x00,0x00,0x38,0x6C,0x60,0x60,0xF8,0x60,0x60,0x60,0xF0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x76,0xCC,0xCC,0xCC,0x7C,0x0C,0xCC,0x78,0x00,0xE0,0x60,0x60,0x6C,0x76,0x66,0x66,0x66,0xE6,0x00,0x00,
+    0x00,0x18,0x18,0x00,0x78,0x18,0x18,0x18,0x18,0x7E,0x00,0x00,0x00,0x0C,0x0C,0x00,0x3C,0x0C,0x0C,0x0C,0x0C,0xCC,0xCC,0x78,
+    0x00,0xE0,0x60,0x60,0x66,0x6C,0x78,0x6C,0x66,0xE6,0x00,0x00,0x00,0x78,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x7E,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xFC,0xD6,0xD6,0xD6,0xD6,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xCC,0xCC,0xCC,0xCC,0xCC,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x78,0xCC,0xCC,0xCC,0xCC,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0x66,0x66,0x66,0x66,0x7C,0x60,0xF0,
+    0x00,0x00,0x00,0x00,0x76,0xCC,0xCC,0xCC,0xCC,0x7C,0x0C,0x1E,0x00,0x00,0x00,0x00,0xEC,0x6E,0x76,0x60,0x60,0xF0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x78,0xCC,0x60,0x18,0xCC,0x78,0x00,0x00,0x00,0x00,0x20,0x60,0xFC,0x60,0x60,0x60,0x6C,0x38,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xCC,0xCC,0xCC,0xCC,0xCC,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0xCC,0xCC,0xCC,0x78,0x30,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xC6,0xC6,0xD6,0xD6,0x6C,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x6C,0x38,0x38,0x6C,0xC6,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x66,0x66,0x66,0x66,0x3C,0x0C,0x18,0xF0,0x00,0x00,0x00,0x00,0xFC,0x8C,0x18,0x60,0xC4,0xFC,0x00,0x00,
+    0x00,0x1C,0x30,0x30,0x60,0xC0,0x60,0x30,0x30,0x1C,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x00,0x18,0x18,0x18,0x18,0x00,0x00,
+    0x00,0xE0,0x30,0x30,0x18,0x0C,0x18,0x30,0x30,0xE0,0x00,0x00,0x00,0x73,0xDA,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x10,0x38,0x6C,0xC6,0xC6,0xFE,0x00,0x00,0x00,0x00,0x10,0x38,0x7C,0xFE,0xFE,0x7C,0x38,0x10,0x00,0x00,0x00,
+    0x24,0x92,0x49,0x24,0x92,0x49,0x24,0x92,0x49,0x24,0x92,0x49,0x18,0x18,0x18,0x18,0x18,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xF8,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x1F,0x18,0x18,0x18,0x18,0x18,0x18,
+    0x18,0x18,0x18,0x18,0x18,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x18,0xFF,0x18,0x18,0x18,0x18,0x18,0x18,
+    0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x18,0x1F,0x18,0x18,0x18,0x18,0x18,0x18,
+    0x18,0x18,0x18,0x18,0x18,0xF8,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0xFF,0x18,0x18,0x18,0x18,0x18,0x18,
+    0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x30,0x30,0x00,0x30,0x30,0x78,0x78,0x78,0x30,0x00,0x00,
+    0x00,0x30,0x30,0x78,0xCC,0xC0,0xC0,0xCC,0x78,0x30,0x30,0x00,0x3C,0x66,0x60,0x60,0x60,0xFC,0x60,0x60,0xC0,0xFE,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xC6,0x7C,0x6C,0x7C,0xC6,0x00,0x00,0xCC,0xCC,0xCC,0xCC,0x78,0xFC,0x30,0xFC,0x30,0x30,0x00,0x00,
+    0x00,0x18,0x18,0x18,0x18,0x00,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x7E,0x63,0x30,0x3C,0x66,0x66,0x3C,0x0C,0xC6,0x7E,0x00,
+    0x00,0xCC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x44,0xBA,0xA2,0xA2,0xA2,0xBA,0x44,0x38,0x00,0x00,
+    0x00,0x78,0xCC,0xCC,0x7E,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x66,0xCC,0xCC,0x66,0x33,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xFC,0x0C,0x0C,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x38,0x44,0xBA,0xAA,0xBA,0xB2,0xAA,0x44,0x38,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x3C,0x66,0x66,0x66,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0xFC,0x30,0x30,0x00,0xFC,0x00,0x00,0x00,
+    0x00,0x78,0x0C,0x18,0x30,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x0C,0x38,0x0C,0x78,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x0C,0x18,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x66,0x66,0x66,0x66,0x7B,0x60,0xC0,
+    0x00,0x7F,0xDB,0xDB,0xDB,0x7B,0x1B,0x1B,0x1B,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x70,0x00,0x30,0x70,0x30,0x30,0x78,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x78,0xCC,0xCC,0x78,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0x66,0x33,0x33,0x66,0xCC,0x00,0x00,
+    0x00,0x63,0xE6,0x6C,0x78,0x37,0x6F,0xDB,0xB3,0x3F,0x03,0x00,0x00,0x62,0xE6,0x6C,0x78,0x30,0x6E,0xC3,0x86,0x0C,0x1F,0x00,
+    0xE0,0x33,0x66,0x3C,0xF8,0x37,0x6F,0xDB,0xB3,0x3F,0x03,0x00,0x00,0x30,0x30,0x00,0x30,0x60,0xC0,0xC0,0xCC,0x78,0x00,0x00,
+    0x60,0x30,0x00,0x30,0x78,0xCC,0xCC,0xFC,0xCC,0xCC,0x00,0x00,0x0C,0x18,0x00,0x30,0x78,0xCC,0xCC,0xFC,0xCC,0xCC,0x00,0x00,
+    0x78,0xCC,0x00,0x30,0x78,0xCC,0xCC,0xFC,0xCC,0xCC,0x00,0x00,0x76,0xDC,0x00,0x30,0x78,0xCC,0xCC,0xFC,0xCC,0xCC,0x00,0x00,
+    0x00,0xCC,0x00,0x30,0x78,0xCC,0xCC,0xFC,0xCC,0xCC,0x00,0x00,0x78,0xCC,0xCC,0x78,0x78,0xCC,0xCC,0xFC,0xCC,0xCC,0x00,0x00,
+    0x00,0x3E,0x78,0xD8,0xD8,0xFE,0xD8,0xD8,0xD8,0xDE,0x00,0x00,0x00,0x78,0xCC,0xCC,0xC0,0xC0,0xC0,0xCC,0xCC,0x78,0x30,0x60,
+    0x60,0x30,0x00,0xFC,0xC4,0xC0,0xF8,0xC0,0xC4,0xFC,0x00,0x00,0x0C,0x18,0x00,0xFC,0xC4,0xC0,0xF8,0xC0,0xC4,0xFC,0x00,0x00,
+    0x78,0xCC,0x00,0xFC,0xC4,0xC0,0xF8,0xC0,0xC4,0xFC,0x00,0x00,0x00,0xCC,0x00,0xFC,0xC4,0xC0,0xF8,0xC0,0xC4,0xFC,0x00,0x00,
+    0x60,0x30,0x00,0x78,0x30,0x30,0x30,0x30,0x30,0x78,0x00,0x00,0x18,0x30,0x00,0x78,0x30,0x30,0x30,0x30,0x30,0x78,0x00,0x00,
+    0x78,0xCC,0x00,0x78,0x30,0x30,0x30,0x30,0x30,0x78,0x00,0x00,0x00,0xCC,0x00,0x78,0x30,0x30,0x30,0x30,0x30,0x78,0x00,0x00,
+    0x00,0xF8,0x6C,0x66,0x66,0xF6,0x66,0x66,0x6C,0xF8,0x00,0x00,0x76,0xDC,0x00,0xC6,0xE6,0xF6,0xDE,0xCE,0xC6,0xC6,0x00,0x00,
+    0x60,0x30,0x00,0x78,0xCC,0xCC,0xCC,0xCC,0xCC,0x78,0x00,0x00,0x18,0x30,0x00,0x78,0xCC,0xCC,0xCC,0xCC,0xCC,0x78,0x00,0x00,
+    0x78,0xCC,0x00,0x78,0xCC,0xCC,0xCC,0xCC,0xCC,0x78,0x00,0x00,0x76,0xDC,0x00,0x78,0xCC,0xCC,0xCC,0xCC,0xCC,0x78,0x00,0x00,
+    0x00,0xCC,0x00,0x78,0xCC,0xCC,0xCC,0xCC,0xCC,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x6C,0x38,0x6C,0xC6,0x00,0x00,
+    0x00,0x3A,0x6C,0xCE,0xD6,0xD6,0xD6,0xE6,0x6C,0xB8,0x00,0x00,0x60,0x30,0x00,0xCC,0xCC,0xCC,0xCC,0xCC,0xCC,0x78,0x00,0x00,
+    0x18,0x30,0x00,0xCC,0xCC,0xCC,0xCC,0xCC,0xCC,0x78,0x00,0x00,0x78,0xCC,0x00,0xCC,0xCC,0xCC,0xCC,0xCC,0xCC,0x78,0x00,0x00,
+    0xCC,0x00,0xCC,0xCC,0xCC,0xCC,0xCC,0xCC,0xCC,0x78,0x00,0x00,0x18,0x30,0x00,0xCC,0xCC,0xCC,0x78,0x30,0x30,0x78,0x00,0x00,
+    0x00,0xF0,0x60,0x7C,0x66,0x66,0x66,0x7C,0x60,0xF0,0x00,0x00,0x00,0x78,0xCC,0xCC,0xD8,0xCC,0xCC,0xCC,0xF8,0xC0,0x60,0x00,
+    0xC0,0x60,0x30,0x00,0x78,0x0C,0x7C,0xCC,0xCC,0x76,0x00,0x00,0x0C,0x18,0x30,0x00,0x78,0x0C,0x7C,0xCC,0xCC,0x76,0x00,0x00,
+    0x30,0x78,0xCC,0x00,0x78,0x0C,0x7C,0xCC,0xCC,0x76,0x00,0x00,0x00,0x76,0xDC,0x00,0x78,0x0C,0x7C,0xCC,0xCC,0x76,0x00,0x00,
+    0x00,0xCC,0xCC,0x00,0x78,0x0C,0x7C,0xCC,0xCC,0x76,0x00,0x00,0x38,0x6C,0x6C,0x38,0xF8,0x0C,0x7C,0xCC,0xCC,0x76,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xFE,0x1B,0x7F,0xD8,0xD8,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0xCC,0xC0,0xC0,0xCC,0x78,0x30,0x60,
+    0xC0,0x60,0x30,0x00,0x78,0xCC,0xFC,0xC0,0xC0,0x7C,0x00,0x00,0x0C,0x18,0x30,0x00,0x78,0xCC,0xFC,0xC0,0xCC,0x78,0x00,0x00,
+    0x30,0x78,0xCC,0x00,0x78,0xCC,0xFC,0xC0,0xC0,0x7C,0x00,0x00,0x00,0xCC,0xCC,0x00,0x78,0xCC,0xFC,0xC0,0xC0,0x7C,0x00,0x00,
+    0x60,0x30,0x18,0x00,0x78,0x18,0x18,0x18,0x18,0x7E,0x00,0x00,0x0C,0x18,0x30,0x00,0x78,0x18,0x18,0x18,0x18,0x7E,0x00,0x00,
+    0x10,0x38,0x6C,0x00,0x78,0x18,0x18,0x18,0x18,0x7E,0x00,0x00,0x00,0x6C,0x6C,0x00,0x78,0x18,0x18,0x18,0x18,0x7E,0x00,0x00,
+    0xCC,0x30,0xD8,0x0C,0x06,0x7E,0xC6,0xC6,0xC6,0x7C,0x00,0x00,0x00,0x76,0xDC,0x00,0xF8,0xCC,0xCC,0xCC,0xCC,0xCC,0x00,0x00,
+    0xC0,0x60,0x30,0x00,0x78,0xCC,0xCC,0xCC,0xCC,0x78,0x00,0x00,0x0C,0x18,0x30,0x00,0x78,0xCC,0xCC,0xCC,0xCC,0x78,0x00,0x00,
+    0x30,0x78,0xCC,0x00,0x78,0xCC,0xCC,0xCC,0xCC,0x78,0x00,0x00,0x00,0x76,0xDC,0x00,0x78,0xCC,0xCC,0xCC,0xCC,0x78,0x00,0x00,
+    0x00,0xCC,0xCC,0x00,0x78,0xCC,0xCC,0xCC,0xCC,0x78,0x00,0x00,0x00,0x00,0x30,0x30,0x00,0xFC,0x00,0x30,0x30,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x78,0xCC,0xDC,0xEC,0xCC,0x78,0x00,0x00,0xC0,0x60,0x30,0x00,0xCC,0xCC,0xCC,0xCC,0xCC,0x76,0x00,0x00,
+    0x0C,0x18,0x30,0x00,0xCC,0xCC,0xCC,0xCC,0xCC,0x76,0x00,0x00,0x30,0x78,0xCC,0x00,0xCC,0xCC,0xCC,0xCC,0xCC,0x76,0x00,0x00,
+    0x00,0xCC,0xCC,0x00,0xCC,0xCC,0xCC,0xCC,0xCC,0x76,0x00,0x00,0x06,0x0C,0x18,0x00,0x66,0x66,0x66,0x66,0x3C,0x0C,0x18,0xF0,
+    0x00,0x00,0xE0,0x60,0x7C,0x66,0x66,0x7C,0x60,0xF0,0x00,0x00,0x00,0x66,0x66,0x00,0x66,0x66,0x66,0x66,0x3C,0x0C,0x18,0xF0,
+};
+
+static const FONT_PACKED font_08x12 = { 8, 12, 6, font_ranges_08x12, (const uint16_t *) 0, font_data_08x12 };
+
+static const FONT_RANGE font_ranges_08x14[6] =
+{
+    { 0x21, 0x81,   0 },
+    { 0x8A, 0x8E,  97 },
+    { 0x91, 0x91, 102 },
+    { 0x94, 0x95, 103 },
+    { 0x97, 0x98, 105 },
+    { 0xA1, 0xFF, 107 },
+};
+
+static const uint16_t font_offsets_08x14[203] =
+{
+        0,     9,    13,    27,    41,    56,    70,    74,    89,   104,   114,   123,   131,   135,   140,   157,
+      167,   176,   190,   202,   215,   228,   243,   257,   271,   286,   295,   307,   317,   324,   334,   348,
+      361,   374,   388,   398,   408,   420,   430,   442,   451,   459,   467,   479,   486,   498,   513,   523,
+      534,   546,   558,   572,   578,   585,   599,   614,   626,   636,   648,   655,   672,   679,   692,   696,
+      700,   712,   724,   734,   746,   757,   766,   779,   788,   797,   807,   819,   824,   831,   838,   848,
+      859,   870,   877,   888,   899,   907,   919,   930,   940,   955,   965,   976,   980,   991,   997,  1007,
+     1020,  1035,  1041,  1046,  1051,  1057,  1064,  1068,  1075,  1082,  1087,  1090,  1098,  1110,  1123,  1133,
+     1146,  1154,  1170,  1173,  1185,  1193,  1203,  1209,  1213,  1223,  1226,  1232,  1244,  1252,  1260,  1264,
+     1273,  1283,  1288,  1293,  1299,  1307,  1317,  1331,  1344,  1357,  1371,  1386,  1400,  1414,  1428,  1443,
+     1457,  1470,  1482,  1495,  1508,  1521,  1535,  1544,  1553,  1562,  1572,  1586,  1602,  1613,  1624,  1635,
+     1646,  1658,  1668,  1680,  1688,  1696,  1704,  1713,  1724,  1737,  1752,  1767,  1782,  1797,  1812,  1827,
+     1843,  1855,  1867,  1881,  1895,  1909,  1923,  1932,  1941,  1950,  1959,  1972,  1982,  1995,  2008,  2021,
+     2034,  2047,  2059,  2069,  2080,  2091,  2102,  2113,  2131,  2144,  2162,
+};
+
+static const uint8_t font_data_08x14[2162] =
+{
+    0x00,0x80,0x10,0x05,0x40,0x80,0x10,0x00,0x42,0x80,0x24,0x02,0x49,0x00,0x80,0x09,0x00,0x86,0x12,0x7F,0x12,0x24,0xFF,0x24,
+    0x48,0x00,0x42,0x82,0x10,0x3C,0x50,0x01,0x82,0x30,0x18,0x14,0x01,0x81,0x78,0x10,0x41,0x00,0x82,0x61,0x92,0x94,0x00,0x82,
+    0x68,0x16,0x29,0x00,0x81,0x49,0x86,0x42,0x00,0x81,0x18,0x24,0x00,0x86,0x28,0x30,0xD1,0x89,0x8E,0xC6,0x7F,0x42,0x80,0x10,
+    0x02,0x49,0x82,0x06,0x0C,0x10,0x00,0x80,0x20,0x03,0x80,0x10,0x00,0x81,0x0C,0x06,0x40,0x82,0x60,0x30,0x08,0x00,0x80,0x04,
+    0x03,0x80,0x08,0x00,0x81,0x30,0x60,0x40,0x00,0x80,0x10,0x00,0x83,0x66,0x28,0x34,0x24,0x46,0x03,0x80,0x10,0x01,0x81,0xFE,
+    0x10,0x01,0x42,0x08,0x80,0x18,0x00,0x81,0x08,0x10,0x40,0x05,0x80,0x7E,0x46,0x08,0x80,0x18,0x00,0x42,0x81,0x02,0x04,0x01,
+    0x80,0x08,0x00,0x81,0x18,0x10,0x00,0x80,0x20,0x01,0x80,0x40,0x40,0x00,0x82,0x18,0x24,0x42,0x04,0x81,0x24,0x18,0x42,0x00,
+    0x82,0x08,0x78,0x08,0x05,0x80,0x7F,0x42,0x00,0x81,0x78,0x04,0x01,0x80,0x08,0x00,0x83,0x10,0x20,0x40,0x7C,0x42,0x00,0x81,
+    0x3C,0x02,0x01,0x81,0x1C,0x02,0x02,0x80,0x3C,0x42,0x00,0x82,0x04,0x0C,0x14,0x00,0x83,0x24,0x44,0x7E,0x04,0x01,0x42,0x00,
+    0x81,0x3E,0x20,0x01,0x82,0x38,0x06,0x02,0x01,0x80,0x3C,0x42,0x00,0x82,0x1C,0x20,0x40,0x00,0x82,0x5C,0x62,0x42,0x00,0x81,
+    0x22,0x1C,0x42,0x00,0x82,0x7E,0x02,0x04,0x00,0x81,0x08,0x10,0x01,0x80,0x20,0x00,0x42,0x00,0x81,0x3C,0x42,0x00,0x83,0x44,
+    0x38,0x24,0x42,0x01,0x80,0x3C,0x42,0x00,0x82,0x38,0x44,0x42,0x00,0x82,0x46,0x3A,0x02,0x00,0x81,0x04,0x38,0x42,0x03,0x80,
+    0x18,0x00,0x42,0x80,0x18,0x00,0x42,0x03,0x80,0x18,0x00,0x42,0x80,0x18,0x00,0x81,0x08,0x10,0x40,0x03,0x86,0x02,0x0C,0x10,
+    0x60,0x10,0x0C,0x02,0x42,0x04,0x80,0x7E,0x41,0x80,0x7E,0x44,0x03,0x86,0x40,0x30,0x08,0x06,0x08,0x30,0x40,0x42,0x00,0x85,
+    0x7C,0x42,0x02,0x04,0x08,0x10,0x00,0x40,0x80,0x10,0x00,0x42,0x00,0x83,0x3C,0x62,0x4E,0x92,0x01,0x83,0x96,0xDB,0x44,0x3C,
+    0x42,0x01,0x83,0x08,0x18,0x14,0x24,0x00,0x83,0x42,0x7E,0x42,0x81,0x42,0x01,0x81,0x7C,0x42,0x00,0x83,0x44,0x78,0x44,0x42,
+    0x00,0x80,0x7C,0x42,0x01,0x82,0x3E,0x40,0x80,0x03,0x81,0x40,0x3E,0x42,0x01,0x82,0xF8,0x84,0x82,0x03,0x81,0x84,0xF8,0x42,
+    0x01,0x81,0x7E,0x40,0x01,0x81,0x7C,0x40,0x01,0x80,0x7E,0x42,0x01,0x81,0x7E,0x40,0x01,0x81,0x7C,0x40,0x02,0x42,0x01,0x82,
+    0x3E,0x40,0x80,0x01,0x83,0x8E,0x82,0x42,0x3E,0x42,0x01,0x80,0x42,0x02,0x81,0x7E,0x42,0x02,0x42,0x01,0x81,0x7C,0x10,0x05,
+    0x80,0x7C,0x42,0x01,0x81,0x3C,0x04,0x05,0x80,0x78,0x42,0x01,0x88,0x42,0x44,0x48,0x50,0x60,0x50,0x48,0x44,0x42,0x42,0x01,
+    0x80,0x40,0x06,0x80,0x7E,0x42,0x01,0x80,0xC6,0x01,0x80,0xAA,0x01,0x81,0x92,0x82,0x00,0x42,0x01,0x81,0x42,0x62,0x00,0x80,
+    0x52,0x00,0x80,0x4A,0x00,0x81,0x46,0x42,0x42,0x01,0x82,0x38,0x44,0x82,0x03,0x81,0x44,0x38,0x42,0x01,0x81,0x7C,0x42,0x01,
+    0x82,0x46,0x78,0x40,0x01,0x42,0x01,0x82,0x38,0x44,0x82,0x03,0x83,0x44,0x38,0x06,0x03,0x40,0x01,0x81,0x78,0x44,0x01,0x84,
+    0x78,0x48,0x4C,0x44,0x42,0x42,0x01,0x81,0x3E,0x40,0x00,0x83,0x60,0x18,0x06,0x02,0x00,0x80,0x7C,0x42,0x01,0x81,0xFE,0x10,
+    0x06,0x42,0x01,0x80,0x42,0x06,0x80,0x3C,0x42,0x01,0x81,0x81,0x42,0x00,0x82,0x44,0x24,0x28,0x00,0x80,0x10,0x00,0x42,0x01,
+    0x80,0x81,0x00,0x82,0x93,0x9A,0x5A,0x00,0x80,0x66,0x00,0x80,0x24,0x42,0x01,0x83,0x81,0x42,0x24,0x18,0x01,0x82,0x24,0x42,
+    0x81,0x42,0x01,0x85,0x81,0x42,0x44,0x28,0x18,0x10,0x02,0x42,0x01,0x88,0xFE,0x02,0x04,0x08,0x10,0x20,0x40,0x80,0xFE,0x42,
+    0x81,0x1E,0x10,0x09,0x80,0x1E,0x40,0x81,0x40,0x20,0x01,0x80,0x10,0x00,0x81,0x18,0x08,0x00,0x80,0x04,0x01,0x80,0x02,0x40,
+    0x81,0x78,0x08,0x09,0x80,0x78,0x40,0x00,0x80,0x08,0x00,0x81,0x18,0x14,0x00,0x82,0x24,0x22,0x42,0x44,0x0A,0x80,0xFF,0x41,
+    0x81,0x08,0x04,0x4B,0x03,0x81,0x3C,0x02,0x00,0x81,0x3E,0x42,0x00,0x80,0x3F,0x42,0x80,0x40,0x02,0x82,0x5C,0x62,0x42,0x01,
+    0x81,0x62,0x5C,0x42,0x03,0x82,0x1E,0x20,0x40,0x01,0x81,0x20,0x1E,0x42,0x80,0x02,0x02,0x82,0x3A,0x46,0x42,0x01,0x81,0x46,
+    0x3A,0x42,0x03,0x84,0x3C,0x22,0x42,0x7E,0x40,0x00,0x80,0x3E,0x42,0x81,0x0E,0x10,0x01,0x81,0x7E,0x10,0x04,0x42,0x03,0x82,
+    0x3E,0x46,0x42,0x01,0x82,0x46,0x3A,0x02,0x00,0x80,0x3C,0x80,0x40,0x02,0x82,0x5C,0x62,0x42,0x03,0x42,0x80,0x18,0x00,0x41,
+    0x81,0x78,0x08,0x04,0x42,0x80,0x0C,0x00,0x41,0x81,0x3C,0x04,0x06,0x80,0x78,0x80,0x40,0x02,0x86,0x44,0x48,0x50,0x60,0x58,
+    0x44,0x42,0x42,0x81,0x78,0x08,0x08,0x42,0x03,0x82,0xB6,0xDA,0x92,0x03,0x42,0x03,0x82,0x5C,0x62,0x42,0x03,0x42,0x03,0x82,
+    0x38,0x44,0x82,0x01,0x81,0x44,0x38,0x42,0x03,0x82,0x5C,0x62,0x42,0x01,0x82,0x62,0x5C,0x40,0x01,0x03,0x82,0x3A,0x46,0x42,
+    0x01,0x82,0x46,0x3A,0x02,0x01,0x03,0x82,0x5C,0x64,0x40,0x03,0x42,0x03,0x84,0x3C,0x40,0x60,0x18,0x04,0x00,0x80,0x78,0x42,
+    0x01,0x80,0x20,0x00,0x81,0xFE,0x20,0x03,0x80,0x1E,0x42,0x03,0x80,0x42,0x03,0x81,0x46,0x3A,0x42,0x03,0x81,0x81,0x42,0x00,
+    0x81,0x44,0x28,0x00,0x80,0x10,0x42,0x03,0x82,0x81,0x89,0x5A,0x00,0x81,0x66,0x24,0x00,0x42,0x03,0x82,0x42,0x24,0x18,0x01,
+    0x81,0x24,0x42,0x42,0x03,0x81,0x81,0x42,0x00,0x80,0x24,0x00,0x80,0x18,0x00,0x82,0x10,0x30,0xE0,0x03,0x86,0xFE,0x04,0x08,
+    0x10,0x20,0x40,0xFE,0x42,0x81,0x0E,0x10,0x03,0x81,0x60,0x10,0x03,0x80,0x0E,0x40,0x80,0x08,0x0B,0x40,0x81,0x70,0x08,0x03,
+    0x81,0x06,0x08,0x03,0x80,0x70,0x40,0x04,0x82,0x61,0x99,0x86,0x45,0x02,0x83,0x10,0x38,0x44,0x82,0x02,0x80,0xFE,0x42,0x00,
+    0x88,0x08,0x18,0x3C,0x7E,0xFF,0x7E,0x3C,0x1C,0x08,0x00,0x42,0x80,0x92,0x41,0x80,0x92,0x41,0x80,0x92,0x40,0x80,0x92,0x41,
+    0x80,0x92,0x41,0x80,0x08,0x04,0x80,0xF8,0x46,0x05,0x81,0xF8,0x08,0x05,0x05,0x81,0x0F,0x08,0x05,0x80,0x08,0x04,0x80,0x0F,
+    0x46,0x80,0x08,0x04,0x81,0xFF,0x08,0x05,0x05,0x80,0xFF,0x46,0x80,0x08,0x04,0x81,0x0F,0x08,0x05,0x80,0x08,0x04,0x81,0xF8,
+    0x08,0x05,0x05,0x81,0xFF,0x08,0x05,0x80,0x08,0x0C,0x03,0x80,0x10,0x00,0x40,0x80,0x10,0x05,0x00,0x83,0x08,0x1E,0x28,0x48,
+    0x02,0x82,0x28,0x1E,0x08,0x42,0x00,0x81,0x0E,0x10,0x01,0x81,0x38,0x10,0x01,0x81,0x20,0x3E,0x42,0x01,0x82,0x82,0x7C,0x44,
+    0x02,0x81,0x7C,0x82,0x43,0x00,0x88,0x81,0x42,0x24,0x28,0x10,0x7C,0x10,0x7C,0x10,0x00,0x42,0x80,0x08,0x03,0x42,0x80,0x08,
+    0x03,0x40,0x00,0x81,0x1E,0x20,0x00,0x88,0x38,0x2C,0x22,0x32,0x1C,0x06,0x02,0x22,0x3C,0x40,0x80,0x24,0x4C,0x00,0x83,0x3C,
+    0x42,0x9D,0xA1,0x02,0x82,0x9D,0x42,0x3C,0x42,0x00,0x84,0x3C,0x04,0x1C,0x24,0x3E,0x47,0x03,0x82,0x12,0x24,0x48,0x00,0x81,
+    0x24,0x12,0x43,0x05,0x81,0xFE,0x02,0x00,0x44,0x05,0x80,0x7E,0x46,0x00,0x82,0x3C,0x42,0x5A,0x00,0x81,0x42,0x3C,0x46,0x80,
+    0xFF,0x4C,0x00,0x82,0x10,0x28,0x10,0x49,0x03,0x80,0x10,0x00,0x81,0xFE,0x10,0x00,0x40,0x80,0xFE,0x42,0x00,0x84,0x3C,0x04,
+    0x08,0x10,0x3C,0x47,0x00,0x84,0x3C,0x04,0x18,0x04,0x3C,0x47,0x81,0x08,0x10,0x4B,0x03,0x80,0x42,0x03,0x82,0x66,0x5A,0x40,
+    0x01,0x00,0x81,0x7E,0xF2,0x01,0x81,0x72,0x12,0x05,0x40,0x05,0x80,0x18,0x00,0x45,0x0A,0x82,0x10,0x08,0x18,0x00,0x81,0x18,
+    0x08,0x02,0x47,0x00,0x81,0x38,0x44,0x01,0x80,0x38,0x47,0x03,0x82,0x48,0x24,0x12,0x00,0x81,0x24,0x48,0x43,0x00,0x82,0xC2,
+    0x44,0x48,0x00,0x85,0x50,0x16,0x2A,0x52,0x5F,0x82,0x42,0x00,0x89,0xC2,0x44,0x4C,0x48,0x50,0x1F,0x21,0x62,0x4C,0x8F,0x42,
+    0x00,0x89,0xE1,0x22,0xC4,0x24,0xE8,0x16,0x2A,0x32,0x5F,0x82,0x42,0x03,0x80,0x08,0x00,0x40,0x80,0x08,0x00,0x84,0x10,0x20,
+    0x40,0x42,0x3E,0x81,0x10,0x08,0x00,0x82,0x18,0x14,0x24,0x00,0x83,0x42,0x7E,0x42,0x81,0x42,0x85,0x08,0x10,0x08,0x18,0x14,
+    0x24,0x00,0x83,0x42,0x7E,0x42,0x81,0x42,0x85,0x18,0x24,0x08,0x18,0x14,0x24,0x00,0x83,0x42,0x7E,0x42,0x81,0x42,0x85,0x1A,
+    0x2C,0x08,0x18,0x14,0x24,0x00,0x83,0x42,0x7E,0x42,0x81,0x42,0x80,0x24,0x40,0x83,0x08,0x18,0x14,0x24,0x00,0x83,0x42,0x7E,
+    0x42,0x81,0x42,0x86,0x10,0x28,0x10,0x38,0x28,0x2C,0x44,0x00,0x82,0x7E,0xC2,0x81,0x42,0x01,0x81,0x0F,0x18,0x00,0x85,0x28,
+    0x2E,0x48,0x78,0x48,0x8F,0x42,0x01,0x82,0x3E,0x40,0x80,0x03,0x84,0x40,0x3E,0x08,0x04,0x0C,0x83,0x08,0x04,0x7E,0x40,0x01,
+    0x81,0x7C,0x40,0x01,0x80,0x7E,0x42,0x83,0x04,0x08,0x7E,0x40,0x01,0x81,0x7C,0x40,0x01,0x80,0x7E,0x42,0x83,0x18,0x24,0x7E,
+    0x40,0x01,0x81,0x7C,0x40,0x01,0x80,0x7E,0x42,0x80,0x24,0x40,0x81,0x7E,0x40,0x01,0x81,0x7C,0x40,0x01,0x80,0x7E,0x42,0x83,
+    0x10,0x08,0x7C,0x10,0x05,0x80,0x7C,0x42,0x83,0x04,0x08,0x7C,0x10,0x05,0x80,0x7C,0x42,0x83,0x18,0x24,0x7C,0x10,0x05,0x80,
+    0x7C,0x42,0x80,0x24,0x40,0x81,0x7C,0x10,0x05,0x80,0x7C,0x42,0x01,0x82,0x7C,0x42,0x41,0x00,0x81,0xF1,0x41,0x00,0x81,0x42,
+    0x7C,0x42,0x83,0x1A,0x2C,0x42,0x62,0x00,0x80,0x52,0x00,0x80,0x4A,0x00,0x81,0x46,0x42,0x42,0x84,0x10,0x08,0x38,0x44,0x82,
+    0x03,0x81,0x44,0x38,0x42,0x84,0x04,0x08,0x38,0x44,0x82,0x03,0x81,0x44,0x38,0x42,0x84,0x18,0x24,0x38,0x44,0x82,0x03,0x81,
+    0x44,0x38,0x42,0x84,0x1A,0x2C,0x38,0x44,0x82,0x03,0x81,0x44,0x38,0x42,0x80,0x24,0x40,0x82,0x38,0x44,0x82,0x03,0x81,0x44,
+    0x38,0x42,0x03,0x86,0x82,0x44,0x28,0x10,0x28,0x44,0x82,0x42,0x01,0x88,0x3A,0x44,0x86,0x8A,0x92,0xA2,0xC2,0x44,0xB8,0x42,
+    0x82,0x08,0x04,0x42,0x06,0x80,0x3C,0x42,0x82,0x04,0x08,0x42,0x06,0x80,0x3C,0x42,0x82,0x18,0x24,0x42,0x06,0x80,0x3C,0x42,
+    0x80,0x24,0x40,0x80,0x42,0x06,0x80,0x3C,0x42,0x87,0x04,0x08,0x81,0x42,0x44,0x28,0x18,0x10,0x02,0x42,0x01,0x80,0x40,0x00,
+    0x81,0x7C,0x42,0x01,0x81,0x7C,0x40,0x00,0x42,0x81,0x38,0x44,0x01,0x80,0x48,0x00,0x82,0x44,0x42,0x41,0x00,0x80,0x4E,0x42,
+    0x81,0x10,0x08,0x41,0x81,0x3C,0x02,0x00,0x81,0x3E,0x42,0x00,0x80,0x3F,0x42,0x81,0x04,0x08,0x41,0x81,0x3C,0x02,0x00,0x81,
+    0x3E,0x42,0x00,0x80,0x3F,0x42,0x81,0x18,0x24,0x41,0x81,0x3C,0x02,0x00,0x81,0x3E,0x42,0x00,0x80,0x3F,0x42,0x81,0x12,0x2C,
+    0x41,0x81,0x3C,0x02,0x00,0x81,0x3E,0x42,0x00,0x80,0x3F,0x42,0x00,0x80,0x24,0x41,0x81,0x3C,0x02,0x00,0x81,0x3E,0x42,0x00,
+    0x80,0x3F,0x42,0x82,0x08,0x14,0x08,0x40,0x81,0x3C,0x02,0x00,0x81,0x3E,0x42,0x00,0x80,0x3F,0x42,0x03,0x81,0xEE,0x11,0x00,
+    0x81,0x7F,0x90,0x00,0x80,0x6F,0x42,0x03,0x82,0x1E,0x20,0x40,0x01,0x84,0x20,0x1E,0x10,0x08,0x18,0x81,0x10,0x08,0x41,0x84,
+    0x3C,0x22,0x42,0x7E,0x40,0x00,0x80,0x3E,0x42,0x81,0x04,0x08,0x41,0x84,0x3C,0x22,0x42,0x7E,0x40,0x00,0x80,0x3E,0x42,0x81,
+    0x18,0x24,0x41,0x84,0x3C,0x22,0x42,0x7E,0x40,0x00,0x80,0x3E,0x42,0x00,0x80,0x12,0x41,0x84,0x3C,0x22,0x42,0x7E,0x40,0x00,
+    0x80,0x3E,0x42,0x81,0x10,0x08,0x41,0x81,0x78,0x08,0x04,0x42,0x81,0x04,0x08,0x41,0x81,0x78,0x08,0x04,0x42,0x81,0x18,0x24,
+    0x41,0x81,0x78,0x08,0x04,0x42,0x00,0x80,0x24,0x41,0x81,0x78,0x08,0x04,0x42,0x86,0xE8,0x30,0x68,0x04,0x3C,0x46,0x82,0x01,
+    0x81,0x44,0x38,0x42,0x81,0x12,0x2C,0x41,0x82,0x5C,0x62,0x42,0x03,0x42,0x81,0x20,0x10,0x41,0x82,0x38,0x44,0x82,0x01,0x81,
+    0x44,0x38,0x42,0x81,0x04,0x08,0x41,0x82,0x38,0x44,0x82,0x01,0x81,0x44,0x38,0x42,0x81,0x18,0x24,0x41,0x82,0x38,0x44,0x82,
+    0x01,0x81,0x44,0x38,0x42,0x81,0x12,0x2C,0x41,0x82,0x38,0x44,0x82,0x01,0x81,0x44,0x38,0x42,0x00,0x80,0x24,0x41,0x82,0x38,
+    0x44,0x82,0x01,0x81,0x44,0x38,0x42,0x03,0x80,0x18,0x00,0x40,0x80,0xFE,0x40,0x80,0x18,0x00,0x42,0x03,0x86,0x7E,0xC6,0x8A,
+    0x92,0xA2,0x44,0xF8,0x42,0x81,0x20,0x10,0x41,0x80,0x42,0x03,0x81,0x46,0x3A,0x42,0x81,0x04,0x08,0x41,0x80,0x42,0x03,0x81,
+    0x46,0x3A,0x42,0x81,0x18,0x24,0x41,0x80,0x42,0x03,0x81,0x46,0x3A,0x42,0x00,0x80,0x24,0x41,0x80,0x42,0x03,0x81,0x46,0x3A,
+    0x42,0x81,0x04,0x08,0x41,0x81,0x81,0x42,0x00,0x80,0x24,0x00,0x80,0x18,0x00,0x82,0x10,0x30,0xE0,0x80,0x40,0x02,0x82,0x5C,
+    0x62,0x42,0x01,0x82,0x62,0x5C,0x40,0x01,0x00,0x80,0x24,0x41,0x81,0x81,0x42,0x00,0x80,0x24,0x00,0x80,0x18,0x00,0x82,0x10,
+    0x30,0xE0,
+};
+
+static const FONT_PACKED font_08x14 = { 8, 14, 6, font_ranges_08x14, font_offsets_08x14, font_data_08x14 };
+
+static const FONT_RANGE font_ranges_10x16[6] =
+{
+    { 0x21, 0x81,   0 },
+    { 0x8A, 0x8E,  97 },
+    { 0x91, 0x91, 102 },
+    { 0x94, 0x95, 103 },
+    { 0x97, 0x98, 105 },
+    { 0xA1, 0xFF, 107 },
+};
+
+static const uint16_t font_offsets_10x16[203] =
+{
+        0,    11,    17,    43,    73,   100,   127,   133,   156,   179,   196,   208,   220,   225,   231,   262,
+      281,   294,   319,   336,   360,   381,   404,   428,   453,   476,   487,   504,   523,   532,   551,   576,
+      603,   626,   647,   666,   681,   698,   712,   735,   747,   758,   769,   792,   801,   823,   846,   861,
+      877,   896,   917,   940,   948,   959,   981,  1004,  1027,  1043,  1066,  1077,  1108,  1119,  1142,  1147,
+     1153,  1172,  1191,  1206,  1225,  1244,  1260,  1280,  1296,  1309,  1324,  1347,  1355,  1365,  1377,  1392,
+     1409,  1426,  1438,  1457,  1472,  1483,  1502,  1521,  1540,  1564,  1583,  1600,  1606,  1623,  1632,  1649,
+     1676,  1701,  1709,  1716,  1723,  1731,  1741,  1746,  1756,  1766,  1773,  1777,  1787,  1806,  1825,  1840,
+     1866,  1877,  1908,  1912,  1939,  1954,  1971,  1979,  1984,  2001,  2005,  2016,  2032,  2047,  2062,  2068,
+     2081,  2097,  2103,  2111,  2119,  2130,  2147,  2174,  2201,  2228,  2251,  2279,  2307,  2335,  2363,  2389,
+     2417,  2440,  2464,  2486,  2508,  2530,  2550,  2566,  2582,  2598,  2612,  2633,  2661,  2681,  2701,  2721,
+     2741,  2759,  2778,  2801,  2817,  2833,  2849,  2863,  2884,  2904,  2927,  2952,  2977,  3002,  3027,  3050,
+     3076,  3095,  3115,  3140,  3165,  3190,  3213,  3227,  3241,  3255,  3267,  3290,  3308,  3329,  3350,  3371,
+     3392,  3411,  3426,  3445,  3462,  3479,  3496,  3511,  3541,  3562,  3590,
+};
+
+static const uint8_t font_data_10x16[3590] =
+{
+    0x00,0x80,0x00,0x08,0x07,0x40,0x80,0x00,0x08,0x00,0x42,0x00,0x80,0x00,0x22,0x02,0x4A,0x00,0x80,0x00,0x09,0x00,0x80,0x00,
+    0x12,0x00,0x84,0x80,0x7F,0x00,0x12,0x00,0x24,0x80,0xFF,0x00,0x24,0x00,0x80,0x00,0x48,0x00,0x42,0x83,0x00,0x04,0x00,0x1F,
+    0x00,0x34,0x00,0x24,0x00,0x84,0x00,0x14,0x00,0x0C,0x00,0x06,0x00,0x07,0x00,0x05,0x00,0x82,0x00,0x25,0x00,0x3E,0x00,0x04,
+    0x41,0x00,0x8B,0x40,0x70,0x80,0x88,0x00,0x89,0x00,0x8A,0x00,0x72,0x00,0x04,0x00,0x08,0x80,0x13,0x40,0x14,0x40,0x24,0x40,
+    0x44,0x80,0x83,0x42,0x00,0x81,0x00,0x1C,0x00,0x22,0x00,0x88,0x00,0x26,0x00,0x1C,0x00,0x30,0x40,0x48,0x40,0x8C,0x80,0x84,
+    0x80,0x82,0x00,0x43,0x80,0x3F,0x42,0x00,0x80,0x00,0x08,0x02,0x4A,0x00,0x84,0x80,0x01,0x00,0x06,0x00,0x0C,0x00,0x08,0x00,
+    0x10,0x04,0x83,0x00,0x08,0x00,0x0C,0x00,0x06,0x80,0x01,0x40,0x00,0x84,0x00,0x60,0x00,0x18,0x00,0x0C,0x00,0x04,0x00,0x02,
+    0x04,0x83,0x00,0x04,0x00,0x0C,0x00,0x18,0x00,0x60,0x40,0x00,0x80,0x00,0x08,0x00,0x84,0x00,0x6B,0x00,0x36,0x00,0x14,0x00,
+    0x1C,0x00,0x14,0x47,0x04,0x80,0x00,0x08,0x02,0x81,0x80,0xFF,0x00,0x08,0x01,0x42,0x0A,0x80,0x00,0x18,0x00,0x80,0x00,0x08,
+    0x00,0x80,0x00,0x10,0x07,0x80,0x00,0x3F,0x46,0x0A,0x80,0x00,0x18,0x00,0x42,0x00,0x81,0x80,0x00,0x00,0x01,0x00,0x80,0x00,
+    0x02,0x00,0x80,0x00,0x04,0x00,0x80,0x00,0x08,0x00,0x80,0x00,0x10,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x40,0x40,0x00,0x81,
+    0x00,0x1C,0x00,0x22,0x00,0x80,0x00,0x41,0x04,0x80,0x00,0x22,0x00,0x80,0x00,0x1C,0x42,0x00,0x82,0x00,0x08,0x00,0x78,0x00,
+    0x08,0x07,0x80,0x00,0x7F,0x42,0x00,0x82,0x00,0x7C,0x00,0x42,0x00,0x02,0x01,0x80,0x00,0x04,0x00,0x84,0x00,0x08,0x00,0x10,
+    0x00,0x20,0x00,0x40,0x00,0x7E,0x42,0x00,0x81,0x00,0x3C,0x00,0x02,0x02,0x81,0x00,0x1C,0x00,0x02,0x03,0x80,0x00,0x3C,0x42,
+    0x00,0x82,0x00,0x04,0x00,0x0C,0x00,0x14,0x00,0x81,0x00,0x24,0x00,0x44,0x00,0x82,0x00,0x84,0x00,0xFF,0x00,0x04,0x01,0x42,
+    0x00,0x81,0x00,0x3E,0x00,0x20,0x01,0x82,0x00,0x38,0x00,0x04,0x00,0x02,0x02,0x81,0x00,0x04,0x00,0x38,0x42,0x00,0x81,0x00,
+    0x1E,0x00,0x20,0x00,0x83,0x00,0x40,0x00,0x5C,0x00,0x62,0x00,0x41,0x02,0x81,0x00,0x22,0x00,0x1C,0x42,0x00,0x83,0x00,0x7F,
+    0x00,0x01,0x00,0x02,0x00,0x04,0x00,0x80,0x00,0x08,0x00,0x80,0x00,0x10,0x01,0x80,0x00,0x20,0x00,0x42,0x00,0x81,0x00,0x3E,
+    0x00,0x41,0x01,0x84,0x00,0x26,0x00,0x18,0x00,0x26,0x00,0x42,0x00,0x41,0x00,0x81,0x00,0x42,0x00,0x3C,0x42,0x00,0x82,0x00,
+    0x1C,0x00,0x22,0x00,0x41,0x02,0x83,0x00,0x23,0x00,0x1D,0x00,0x01,0x00,0x02,0x00,0x80,0x00,0x3C,0x42,0x04,0x80,0x00,0x18,
+    0x00,0x43,0x80,0x00,0x18,0x00,0x42,0x04,0x80,0x00,0x18,0x00,0x43,0x80,0x00,0x18,0x00,0x80,0x00,0x08,0x00,0x80,0x00,0x10,
+    0x04,0x83,0x80,0x00,0x00,0x03,0x00,0x0C,0x00,0x30,0x00,0x82,0x00,0x0C,0x00,0x03,0x80,0x00,0x42,0x06,0x80,0x80,0x7F,0x41,
+    0x80,0x80,0x7F,0x44,0x04,0x83,0x00,0x40,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x82,0x00,0x0C,0x00,0x30,0x00,0x40,0x42,0x00,
+    0x87,0x00,0x7E,0x00,0x43,0x00,0x41,0x00,0x01,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x10,0x00,0x40,0x80,0x00,0x10,0x00,0x42,
+    0x00,0x84,0x00,0x1E,0x00,0x21,0x00,0x47,0x00,0xC9,0x00,0x91,0x00,0x80,0x00,0x93,0x00,0x83,0x00,0x97,0xC0,0x4D,0x00,0x62,
+    0x00,0x3E,0x42,0x02,0x87,0x00,0x08,0x00,0x1C,0x00,0x14,0x00,0x12,0x00,0x22,0x00,0x21,0x00,0x7F,0x80,0x40,0x00,0x80,0x40,
+    0x80,0x42,0x02,0x81,0x00,0x7E,0x00,0x41,0x00,0x83,0x00,0x42,0x00,0x7C,0x00,0x42,0x00,0x41,0x01,0x80,0x00,0x7E,0x42,0x02,
+    0x83,0x00,0x1F,0x00,0x61,0x00,0x40,0x00,0x80,0x02,0x82,0x00,0x40,0x00,0x60,0x00,0x1F,0x42,0x02,0x82,0x00,0x7C,0x00,0x42,
+    0x00,0x41,0x04,0x81,0x00,0x42,0x00,0x7C,0x42,0x02,0x81,0x00,0x7F,0x00,0x40,0x02,0x81,0x00,0x7E,0x00,0x40,0x01,0x80,0x00,
+    0x7F,0x42,0x02,0x81,0x00,0x7F,0x00,0x40,0x02,0x81,0x00,0x7E,0x00,0x40,0x02,0x42,0x02,0x83,0x80,0x0F,0x80,0x30,0x00,0x20,
+    0x00,0x40,0x00,0x84,0x80,0x43,0x80,0x40,0x80,0x20,0x80,0x30,0x80,0x0F,0x42,0x02,0x80,0x00,0x41,0x03,0x81,0x00,0x7F,0x00,
+    0x41,0x02,0x42,0x02,0x81,0x00,0x7F,0x00,0x08,0x06,0x80,0x00,0x7F,0x42,0x02,0x81,0x00,0x1E,0x00,0x02,0x06,0x80,0x00,0x3C,
+    0x42,0x02,0x89,0x00,0x41,0x00,0x42,0x00,0x44,0x00,0x48,0x00,0x70,0x00,0x50,0x00,0x48,0x00,0x46,0x00,0x41,0x80,0x40,0x42,
+    0x02,0x80,0x00,0x40,0x07,0x80,0x00,0x7F,0x42,0x02,0x80,0x00,0xC3,0x00,0x81,0x00,0xE3,0x00,0xA5,0x00,0x81,0x00,0xB5,0x00,
+    0x99,0x00,0x80,0x00,0x81,0x00,0x42,0x02,0x82,0x00,0x41,0x00,0x61,0x00,0x51,0x00,0x80,0x00,0x49,0x00,0x80,0x00,0x45,0x00,
+    0x81,0x00,0x43,0x00,0x41,0x42,0x02,0x82,0x00,0x1E,0x00,0x21,0x80,0x40,0x04,0x81,0x00,0x21,0x00,0x1E,0x42,0x02,0x81,0x00,
+    0x7E,0x00,0x41,0x01,0x82,0x00,0x42,0x00,0x7C,0x00,0x40,0x02,0x42,0x02,0x82,0x00,0x1E,0x00,0x21,0x80,0x40,0x04,0x83,0x00,
+    0x21,0x00,0x1E,0x00,0x02,0x80,0x01,0x40,0x02,0x81,0x00,0x7C,0x00,0x42,0x01,0x85,0x00,0x44,0x00,0x78,0x00,0x48,0x00,0x44,
+    0x00,0x42,0x00,0x41,0x42,0x02,0x86,0x00,0x3F,0x00,0x41,0x00,0x40,0x00,0x60,0x00,0x18,0x00,0x06,0x00,0x01,0x00,0x81,0x00,
+    0x43,0x00,0x7C,0x42,0x02,0x81,0x80,0xFF,0x00,0x08,0x07,0x42,0x02,0x80,0x00,0x41,0x06,0x81,0x00,0x22,0x00,0x3C,0x42,0x02,
+    0x81,0x40,0x80,0x80,0x40,0x00,0x80,0x00,0x21,0x00,0x81,0x00,0x22,0x00,0x12,0x00,0x80,0x00,0x0C,0x00,0x42,0x02,0x80,0x40,
+    0x80,0x00,0x81,0x80,0x48,0x80,0x4C,0x00,0x82,0x80,0x54,0x80,0x52,0x00,0x33,0x00,0x80,0x00,0x21,0x42,0x02,0x84,0x40,0x80,
+    0x80,0x40,0x00,0x21,0x00,0x12,0x00,0x0C,0x00,0x83,0x00,0x12,0x00,0x21,0x80,0x40,0x40,0x80,0x42,0x02,0x85,0x40,0x80,0x80,
+    0x40,0x00,0x21,0x00,0x22,0x00,0x14,0x00,0x08,0x03,0x42,0x02,0x89,0x80,0x7F,0x80,0x00,0x00,0x01,0x00,0x02,0x00,0x04,0x00,
+    0x08,0x00,0x10,0x00,0x20,0x00,0x40,0x80,0x7F,0x42,0x00,0x81,0x00,0x1F,0x00,0x10,0x0A,0x80,0x00,0x1F,0x40,0x00,0x81,0x00,
+    0x40,0x00,0x20,0x00,0x80,0x00,0x10,0x00,0x80,0x00,0x08,0x00,0x80,0x00,0x04,0x00,0x80,0x00,0x02,0x00,0x80,0x00,0x01,0x00,
+    0x80,0x80,0x00,0x40,0x00,0x81,0x00,0x7C,0x00,0x04,0x0A,0x80,0x00,0x7C,0x40,0x00,0x80,0x00,0x04,0x00,0x85,0x00,0x0C,0x00,
+    0x0A,0x00,0x1A,0x00,0x12,0x00,0x11,0x00,0x21,0x00,0x80,0x80,0x40,0x44,0x0C,0x80,0xC0,0xFF,0x41,0x81,0x00,0x08,0x00,0x04,
+    0x4D,0x04,0x81,0x00,0x3C,0x00,0x02,0x00,0x84,0x00,0x1E,0x00,0x22,0x00,0x42,0x00,0x46,0x00,0x3B,0x42,0x00,0x80,0x00,0x40,
+    0x02,0x82,0x00,0x5E,0x00,0x62,0x00,0x41,0x02,0x81,0x00,0x62,0x00,0x5C,0x42,0x04,0x82,0x00,0x1F,0x00,0x20,0x00,0x40,0x02,
+    0x81,0x00,0x20,0x00,0x1F,0x42,0x00,0x80,0x00,0x01,0x02,0x82,0x00,0x1D,0x00,0x23,0x00,0x41,0x02,0x81,0x00,0x23,0x00,0x3D,
+    0x42,0x04,0x84,0x00,0x1E,0x00,0x21,0x00,0x41,0x00,0x7F,0x00,0x40,0x00,0x81,0x00,0x20,0x00,0x1F,0x42,0x00,0x82,0x80,0x07,
+    0x00,0x18,0x00,0x10,0x00,0x81,0x80,0x7F,0x00,0x10,0x05,0x42,0x04,0x82,0x00,0x1D,0x00,0x23,0x00,0x41,0x02,0x84,0x00,0x23,
+    0x00,0x3D,0x00,0x01,0x00,0x02,0x00,0x3C,0x00,0x80,0x00,0x40,0x02,0x83,0x00,0x4E,0x00,0x51,0x00,0x61,0x00,0x41,0x03,0x42,
+    0x00,0x80,0x00,0x18,0x00,0x41,0x81,0x00,0x78,0x00,0x08,0x05,0x42,0x00,0x80,0x00,0x0C,0x00,0x41,0x81,0x00,0x3C,0x00,0x04,
+    0x07,0x80,0x00,0x78,0x00,0x80,0x00,0x40,0x02,0x87,0x00,0x41,0x00,0x46,0x00,0x48,0x00,0x70,0x00,0x50,0x00,0x4C,0x00,0x42,
+    0x00,0x41,0x42,0x00,0x81,0x00,0x3C,0x00,0x04,0x09,0x42,0x04,0x82,0x00,0xB3,0x80,0xCC,0x80,0x88,0x04,0x42,0x04,0x83,0x00,
+    0x4E,0x00,0x71,0x00,0x61,0x00,0x41,0x03,0x42,0x04,0x82,0x00,0x1C,0x00,0x22,0x00,0x41,0x02,0x81,0x00,0x22,0x00,0x1C,0x42,
+    0x04,0x82,0x00,0x5E,0x00,0x62,0x00,0x41,0x02,0x82,0x00,0x62,0x00,0x5C,0x00,0x40,0x01,0x04,0x82,0x00,0x1D,0x00,0x23,0x00,
+    0x41,0x02,0x82,0x00,0x23,0x00,0x3D,0x00,0x01,0x01,0x04,0x83,0x00,0x27,0x00,0x29,0x00,0x31,0x00,0x20,0x03,0x42,0x04,0x81,
+    0x00,0x3E,0x00,0x40,0x00,0x84,0x00,0x30,0x00,0x0C,0x00,0x02,0x00,0x42,0x00,0x7C,0x42,0x02,0x80,0x00,0x10,0x00,0x81,0x00,
+    0x7F,0x00,0x10,0x04,0x80,0x00,0x0F,0x42,0x04,0x80,0x00,0x42,0x04,0x81,0x00,0x46,0x00,0x3A,0x42,0x04,0x81,0x80,0x80,0x00,
+    0x41,0x00,0x84,0x00,0x42,0x00,0x22,0x00,0x24,0x00,0x14,0x00,0x18,0x42,0x04,0x82,0x40,0x80,0x40,0x88,0x80,0x4C,0x00,0x80,
+    0x80,0x52,0x00,0x81,0x00,0x33,0x00,0x21,0x42,0x04,0x83,0x80,0x40,0x00,0x21,0x00,0x12,0x00,0x0C,0x00,0x82,0x00,0x12,0x00,
+    0x21,0x80,0x40,0x42,0x04,0x81,0x40,0x80,0x80,0x40,0x00,0x83,0x00,0x21,0x00,0x32,0x00,0x12,0x00,0x0C,0x00,0x82,0x00,0x08,
+    0x00,0x10,0x00,0xE0,0x04,0x87,0x80,0x7F,0x00,0x01,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x10,0x00,0x20,0x80,0x7F,0x42,0x00,
+    0x81,0x00,0x07,0x00,0x08,0x04,0x81,0x00,0x30,0x00,0x08,0x03,0x80,0x00,0x07,0x40,0x00,0x80,0x00,0x08,0x0C,0x40,0x00,0x81,
+    0x00,0x38,0x00,0x04,0x04,0x81,0x00,0x03,0x00,0x04,0x03,0x80,0x00,0x38,0x40,0x06,0x82,0x40,0x70,0x40,0x8C,0x80,0x83,0x45,
+    0x03,0x84,0x00,0x08,0x00,0x14,0x00,0x22,0x00,0x63,0x00,0x41,0x02,0x80,0x00,0x7F,0x42,0x00,0x80,0x00,0x08,0x00,0x89,0x00,
+    0x1C,0x00,0x3E,0x00,0x3F,0x80,0x7F,0xC0,0xFF,0x80,0x7F,0x00,0x3F,0x00,0x1E,0x00,0x0C,0x00,0x08,0x42,0x80,0x00,0xDB,0x00,
+    0x40,0x80,0x00,0xDB,0x00,0x40,0x80,0x00,0xDB,0x00,0x41,0x80,0x00,0xDB,0x00,0x40,0x80,0x00,0xDB,0x00,0x40,0x80,0x00,0x08,
+    0x06,0x80,0x00,0xF8,0x46,0x07,0x81,0x00,0xF8,0x00,0x08,0x05,0x07,0x81,0xC0,0x0F,0x00,0x08,0x05,0x80,0x00,0x08,0x06,0x80,
+    0xC0,0x0F,0x46,0x80,0x00,0x08,0x06,0x81,0xC0,0xFF,0x00,0x08,0x05,0x07,0x80,0xC0,0xFF,0x46,0x80,0x00,0x08,0x06,0x81,0xC0,
+    0x0F,0x00,0x08,0x05,0x80,0x00,0x08,0x06,0x81,0x00,0xF8,0x00,0x08,0x05,0x07,0x81,0xC0,0xFF,0x00,0x08,0x05,0x80,0x00,0x08,
+    0x0E,0x04,0x80,0x00,0x04,0x00,0x40,0x80,0x00,0x04,0x06,0x00,0x83,0x00,0x04,0x00,0x1F,0x00,0x24,0x00,0x44,0x04,0x82,0x00,
+    0x34,0x00,0x1F,0x00,0x04,0x42,0x00,0x81,0x00,0x07,0x00,0x08,0x02,0x81,0x00,0x1E,0x00,0x08,0x02,0x81,0x00,0x10,0x00,0x3F,
+    0x42,0x02,0x82,0x80,0x40,0x00,0x3F,0x00,0x21,0x02,0x81,0x00,0x3F,0x80,0x40,0x44,0x00,0x87,0x40,0x80,0x80,0x40,0x00,0x21,
+    0x00,0x22,0x00,0x14,0x00,0x08,0x00,0x3E,0x00,0x08,0x00,0x81,0x00,0x3E,0x00,0x08,0x00,0x42,0x00,0x80,0x00,0x08,0x04,0x42,
+    0x80,0x00,0x08,0x03,0x40,0x00,0x81,0x00,0x1F,0x00,0x20,0x00,0x8A,0x00,0x30,0x00,0x1C,0x00,0x26,0x00,0x21,0x00,0x31,0x00,
+    0x1D,0x00,0x06,0x00,0x03,0x00,0x01,0x00,0x21,0x00,0x3E,0x40,0x80,0x00,0x22,0x4E,0x00,0x85,0x00,0x3E,0x00,0x63,0x00,0x41,
+    0x80,0x9E,0x80,0xB0,0x80,0xA0,0x00,0x84,0x80,0xB0,0x80,0x9E,0x00,0x41,0x00,0x63,0x00,0x3E,0x42,0x00,0x83,0x00,0x3C,0x00,
+    0x02,0x00,0x1E,0x00,0x22,0x00,0x80,0x00,0x1F,0x48,0x04,0x86,0x80,0x08,0x00,0x11,0x00,0x22,0x00,0x44,0x00,0x22,0x00,0x11,
+    0x80,0x08,0x43,0x06,0x81,0x80,0x7F,0x80,0x00,0x01,0x44,0x07,0x80,0x00,0x3F,0x46,0x00,0x86,0x00,0x1C,0x00,0x22,0x00,0x5D,
+    0x00,0x55,0x00,0x5D,0x00,0x22,0x00,0x1C,0x47,0x80,0xC0,0xFF,0x4E,0x00,0x81,0x00,0x0C,0x00,0x12,0x00,0x80,0x00,0x0C,0x4A,
+    0x04,0x80,0x00,0x04,0x00,0x81,0x80,0x7F,0x00,0x04,0x00,0x41,0x80,0x80,0x7F,0x42,0x00,0x81,0x00,0x3C,0x00,0x02,0x00,0x82,
+    0x00,0x0C,0x00,0x10,0x00,0x3E,0x48,0x00,0x83,0x00,0x3E,0x00,0x02,0x00,0x1C,0x00,0x02,0x00,0x80,0x00,0x3C,0x48,0x81,0x00,
+    0x08,0x00,0x10,0x4D,0x04,0x80,0x00,0x41,0x04,0x82,0x00,0x63,0x00,0x5D,0x00,0x40,0x01,0x00,0x81,0x00,0x3F,0x00,0x79,0x01,
+    0x82,0x00,0x39,0x00,0x19,0x00,0x09,0x06,0x40,0x07,0x80,0x00,0x0C,0x00,0x45,0x0C,0x82,0x00,0x04,0x00,0x02,0x00,0x0E,0x00,
+    0x81,0x00,0x18,0x00,0x08,0x03,0x48,0x00,0x81,0x00,0x1E,0x00,0x21,0x02,0x80,0x00,0x1E,0x48,0x04,0x86,0x00,0x44,0x00,0x22,
+    0x00,0x11,0x80,0x08,0x00,0x11,0x00,0x22,0x00,0x44,0x43,0x00,0x81,0x00,0xC1,0x00,0x42,0x00,0x81,0x00,0x44,0x00,0x48,0x00,
+    0x85,0x80,0x11,0x80,0x12,0x80,0x24,0xC0,0x47,0x80,0x40,0x80,0x80,0x42,0x00,0x81,0x00,0xC1,0x00,0x42,0x00,0x81,0x00,0x44,
+    0x00,0x48,0x00,0x85,0x80,0x13,0x40,0x10,0x40,0x20,0x80,0x41,0x00,0x41,0xC0,0x83,0x42,0x00,0x8B,0x40,0xF0,0x80,0x10,0x00,
+    0x61,0x00,0x32,0x00,0x12,0x00,0xE4,0x80,0x09,0x80,0x12,0x80,0x14,0xC0,0x27,0x80,0x40,0x80,0x80,0x42,0x04,0x80,0x00,0x04,
+    0x00,0x40,0x80,0x00,0x04,0x00,0x85,0x00,0x08,0x00,0x30,0x00,0x40,0x00,0x41,0x00,0x61,0x00,0x3F,0x81,0x00,0x10,0x00,0x08,
+    0x40,0x87,0x00,0x08,0x00,0x1C,0x00,0x14,0x00,0x12,0x00,0x22,0x00,0x21,0x00,0x7F,0x80,0x40,0x00,0x80,0x40,0x80,0x42,0x81,
+    0x00,0x04,0x00,0x08,0x40,0x87,0x00,0x08,0x00,0x1C,0x00,0x14,0x00,0x12,0x00,0x22,0x00,0x21,0x00,0x7F,0x80,0x40,0x00,0x80,
+    0x40,0x80,0x42,0x81,0x00,0x0C,0x00,0x12,0x40,0x87,0x00,0x08,0x00,0x1C,0x00,0x14,0x00,0x12,0x00,0x22,0x00,0x21,0x00,0x7F,
+    0x80,0x40,0x00,0x80,0x40,0x80,0x42,0x81,0x00,0x1A,0x00,0x2C,0x40,0x87,0x00,0x08,0x00,0x1C,0x00,0x14,0x00,0x12,0x00,0x22,
+    0x00,0x21,0x00,0x7F,0x80,0x40,0x00,0x80,0x40,0x80,0x42,0x80,0x00,0x22,0x41,0x87,0x00,0x08,0x00,0x1C,0x00,0x14,0x00,0x12,
+    0x00,0x22,0x00,0x21,0x00,0x7F,0x80,0x40,0x00,0x80,0x40,0x80,0x42,0x82,0x00,0x0C,0x00,0x12,0x00,0x0C,0x00,0x81,0x00,0x16,
+    0x00,0x12,0x00,0x83,0x00,0x23,0x00,0x21,0x80,0x7F,0x80,0x40,0x00,0x80,0x40,0x80,0x42,0x02,0x82,0x80,0x0F,0x00,0x0C,0x00,
+    0x14,0x00,0x85,0x00,0x24,0x00,0x27,0x00,0x24,0x00,0x7C,0x00,0x44,0x80,0x87,0x42,0x02,0x83,0x00,0x1F,0x00,0x61,0x00,0x40,
+    0x00,0x80,0x02,0x85,0x00,0x40,0x00,0x60,0x00,0x1F,0x00,0x02,0x00,0x01,0x00,0x07,0x81,0x00,0x08,0x00,0x04,0x40,0x81,0x00,
+    0x7F,0x00,0x40,0x02,0x81,0x00,0x7E,0x00,0x40,0x01,0x80,0x00,0x7F,0x42,0x81,0x00,0x04,0x00,0x08,0x40,0x81,0x00,0x7F,0x00,
+    0x40,0x02,0x81,0x00,0x7E,0x00,0x40,0x01,0x80,0x00,0x7F,0x42,0x81,0x00,0x0C,0x00,0x12,0x40,0x81,0x00,0x7F,0x00,0x40,0x02,
+    0x81,0x00,0x7E,0x00,0x40,0x01,0x80,0x00,0x7F,0x42,0x80,0x00,0x22,0x41,0x81,0x00,0x7F,0x00,0x40,0x02,0x81,0x00,0x7E,0x00,
+    0x40,0x01,0x80,0x00,0x7F,0x42,0x81,0x00,0x10,0x00,0x08,0x40,0x81,0x00,0x7F,0x00,0x08,0x06,0x80,0x00,0x7F,0x42,0x81,0x00,
+    0x04,0x00,0x08,0x40,0x81,0x00,0x7F,0x00,0x08,0x06,0x80,0x00,0x7F,0x42,0x81,0x00,0x0C,0x00,0x12,0x40,0x81,0x00,0x7F,0x00,
+    0x08,0x06,0x80,0x00,0x7F,0x42,0x80,0x00,0x22,0x41,0x81,0x00,0x7F,0x00,0x08,0x06,0x80,0x00,0x7F,0x42,0x02,0x82,0x00,0x7C,
+    0x00,0x42,0x00,0x41,0x00,0x81,0x00,0xF1,0x00,0x41,0x01,0x81,0x00,0x42,0x00,0x7C,0x42,0x81,0x00,0x1A,0x00,0x2C,0x40,0x82,
+    0x00,0x41,0x00,0x61,0x00,0x51,0x00,0x80,0x00,0x49,0x00,0x80,0x00,0x45,0x00,0x81,0x00,0x43,0x00,0x41,0x42,0x81,0x00,0x10,
+    0x00,0x08,0x40,0x82,0x00,0x1E,0x00,0x21,0x80,0x40,0x04,0x81,0x00,0x21,0x00,0x1E,0x42,0x81,0x00,0x04,0x00,0x08,0x40,0x82,
+    0x00,0x1E,0x00,0x21,0x80,0x40,0x04,0x81,0x00,0x21,0x00,0x1E,0x42,0x81,0x00,0x0C,0x00,0x12,0x40,0x82,0x00,0x1E,0x00,0x21,
+    0x80,0x40,0x04,0x81,0x00,0x21,0x00,0x1E,0x42,0x81,0x00,0x1A,0x00,0x2C,0x40,0x82,0x00,0x1E,0x00,0x21,0x80,0x40,0x04,0x81,
+    0x00,0x21,0x00,0x1E,0x42,0x80,0x00,0x22,0x41,0x82,0x00,0x1E,0x00,0x21,0x80,0x40,0x04,0x81,0x00,0x21,0x00,0x1E,0x42,0x04,
+    0x83,0x80,0x40,0x00,0x21,0x00,0x12,0x00,0x0C,0x00,0x82,0x00,0x12,0x00,0x21,0x80,0x40,0x42,0x02,0x89,0x80,0x1E,0x00,0x21,
+    0x80,0x43,0x80,0x42,0x80,0x44,0x80,0x48,0x80,0x50,0x80,0x70,0x00,0x21,0x00,0x5E,0x42,0x81,0x00,0x10,0x00,0x08,0x40,0x80,
+    0x00,0x41,0x06,0x81,0x00,0x22,0x00,0x3C,0x42,0x81,0x00,0x04,0x00,0x08,0x40,0x80,0x00,0x41,0x06,0x81,0x00,0x22,0x00,0x3C,
+    0x42,0x81,0x00,0x0C,0x00,0x12,0x40,0x80,0x00,0x41,0x06,0x81,0x00,0x22,0x00,0x3C,0x42,0x80,0x00,0x22,0x41,0x80,0x00,0x41,
+    0x06,0x81,0x00,0x22,0x00,0x3C,0x42,0x81,0x00,0x04,0x00,0x08,0x40,0x85,0x40,0x80,0x80,0x40,0x00,0x21,0x00,0x22,0x00,0x14,
+    0x00,0x08,0x03,0x42,0x02,0x80,0x00,0x40,0x00,0x81,0x00,0x7E,0x00,0x41,0x01,0x82,0x00,0x42,0x00,0x7C,0x00,0x40,0x00,0x42,
+    0x00,0x81,0x00,0x38,0x00,0x44,0x01,0x80,0x00,0x48,0x01,0x82,0x00,0x44,0x00,0x42,0x00,0x41,0x00,0x80,0x00,0x4E,0x42,0x00,
+    0x81,0x00,0x20,0x00,0x10,0x41,0x81,0x00,0x3C,0x00,0x02,0x00,0x84,0x00,0x1E,0x00,0x22,0x00,0x42,0x00,0x46,0x00,0x3B,0x42,
+    0x00,0x81,0x00,0x04,0x00,0x08,0x41,0x81,0x00,0x3C,0x00,0x02,0x00,0x84,0x00,0x1E,0x00,0x22,0x00,0x42,0x00,0x46,0x00,0x3B,
+    0x42,0x00,0x81,0x00,0x18,0x00,0x24,0x41,0x81,0x00,0x3C,0x00,0x02,0x00,0x84,0x00,0x1E,0x00,0x22,0x00,0x42,0x00,0x46,0x00,
+    0x3B,0x42,0x00,0x81,0x00,0x12,0x00,0x2C,0x41,0x81,0x00,0x3C,0x00,0x02,0x00,0x84,0x00,0x1E,0x00,0x22,0x00,0x42,0x00,0x46,
+    0x00,0x3B,0x42,0x01,0x80,0x00,0x24,0x41,0x81,0x00,0x3C,0x00,0x02,0x00,0x84,0x00,0x1E,0x00,0x22,0x00,0x42,0x00,0x46,0x00,
+    0x3B,0x42,0x82,0x00,0x08,0x00,0x14,0x00,0x08,0x41,0x81,0x00,0x3C,0x00,0x02,0x00,0x84,0x00,0x1E,0x00,0x22,0x00,0x42,0x00,
+    0x46,0x00,0x3B,0x42,0x04,0x81,0x00,0xF7,0x80,0x08,0x00,0x84,0x80,0x7F,0x00,0xC8,0x00,0x88,0x00,0x8C,0x80,0x77,0x42,0x04,
+    0x82,0x00,0x1F,0x00,0x20,0x00,0x40,0x02,0x84,0x00,0x20,0x00,0x1F,0x00,0x04,0x00,0x02,0x00,0x0E,0x00,0x81,0x00,0x10,0x00,
+    0x08,0x41,0x84,0x00,0x1E,0x00,0x21,0x00,0x41,0x00,0x7F,0x00,0x40,0x00,0x81,0x00,0x20,0x00,0x1F,0x42,0x00,0x81,0x00,0x04,
+    0x00,0x08,0x41,0x84,0x00,0x1E,0x00,0x21,0x00,0x41,0x00,0x7F,0x00,0x40,0x00,0x81,0x00,0x20,0x00,0x1F,0x42,0x00,0x81,0x00,
+    0x18,0x00,0x24,0x41,0x84,0x00,0x1E,0x00,0x21,0x00,0x41,0x00,0x7F,0x00,0x40,0x00,0x81,0x00,0x20,0x00,0x1F,0x42,0x01,0x80,
+    0x00,0x12,0x41,0x84,0x00,0x1E,0x00,0x21,0x00,0x41,0x00,0x7F,0x00,0x40,0x00,0x81,0x00,0x20,0x00,0x1F,0x42,0x00,0x81,0x00,
+    0x10,0x00,0x08,0x41,0x81,0x00,0x78,0x00,0x08,0x05,0x42,0x00,0x81,0x00,0x04,0x00,0x08,0x41,0x81,0x00,0x78,0x00,0x08,0x05,
+    0x42,0x00,0x81,0x00,0x18,0x00,0x24,0x41,0x81,0x00,0x78,0x00,0x08,0x05,0x42,0x01,0x80,0x00,0x24,0x41,0x81,0x00,0x78,0x00,
+    0x08,0x05,0x42,0x00,0x86,0x00,0x74,0x00,0x18,0x00,0x34,0x00,0x02,0x00,0x1E,0x00,0x23,0x00,0x41,0x02,0x81,0x00,0x22,0x00,
+    0x1C,0x42,0x00,0x81,0x00,0x12,0x00,0x2C,0x41,0x83,0x00,0x4E,0x00,0x71,0x00,0x61,0x00,0x41,0x03,0x42,0x00,0x81,0x00,0x20,
+    0x00,0x10,0x41,0x82,0x00,0x1C,0x00,0x22,0x00,0x41,0x02,0x81,0x00,0x22,0x00,0x1C,0x42,0x00,0x81,0x00,0x04,0x00,0x08,0x41,
+    0x82,0x00,0x1C,0x00,0x22,0x00,0x41,0x02,0x81,0x00,0x22,0x00,0x1C,0x42,0x00,0x81,0x00,0x18,0x00,0x24,0x41,0x82,0x00,0x1C,
+    0x00,0x22,0x00,0x41,0x02,0x81,0x00,0x22,0x00,0x1C,0x42,0x00,0x81,0x00,0x12,0x00,0x2C,0x41,0x82,0x00,0x1C,0x00,0x22,0x00,
+    0x41,0x02,0x81,0x00,0x22,0x00,0x1C,0x42,0x01,0x80,0x00,0x24,0x41,0x82,0x00,0x1C,0x00,0x22,0x00,0x41,0x02,0x81,0x00,0x22,
+    0x00,0x1C,0x42,0x04,0x80,0x00,0x0C,0x00,0x41,0x80,0x80,0x7F,0x40,0x80,0x00,0x0C,0x00,0x42,0x04,0x83,0x00,0x1D,0x00,0x22,
+    0x00,0x45,0x00,0x49,0x00,0x82,0x00,0x51,0x00,0x22,0x00,0x5C,0x42,0x00,0x81,0x00,0x20,0x00,0x10,0x41,0x80,0x00,0x42,0x04,
+    0x81,0x00,0x46,0x00,0x3A,0x42,0x00,0x81,0x00,0x04,0x00,0x08,0x41,0x80,0x00,0x42,0x04,0x81,0x00,0x46,0x00,0x3A,0x42,0x00,
+    0x81,0x00,0x18,0x00,0x24,0x41,0x80,0x00,0x42,0x04,0x81,0x00,0x46,0x00,0x3A,0x42,0x01,0x80,0x00,0x24,0x41,0x80,0x00,0x42,
+    0x04,0x81,0x00,0x46,0x00,0x3A,0x42,0x00,0x81,0x00,0x04,0x00,0x08,0x41,0x81,0x40,0x80,0x80,0x40,0x00,0x83,0x00,0x21,0x00,
+    0x32,0x00,0x12,0x00,0x0C,0x00,0x82,0x00,0x08,0x00,0x10,0x00,0xE0,0x00,0x80,0x00,0x40,0x02,0x82,0x00,0x5E,0x00,0x62,0x00,
+    0x41,0x02,0x82,0x00,0x62,0x00,0x5C,0x00,0x40,0x01,0x01,0x80,0x00,0x24,0x41,0x81,0x40,0x80,0x80,0x40,0x00,0x83,0x00,0x21,
+    0x00,0x32,0x00,0x12,0x00,0x0C,0x00,0x82,0x00,0x08,0x00,0x10,0x00,0xE0,
+};
+
+static const FONT_PACKED font_10x16 = { 10, 16, 6, font_ranges_10x16, font_offsets_10x16, font_data_10x16 };
+
+static const FONT_RANGE font_ranges_12x16[6] =
+{
+    { 0x21, 0x81,   0 },
+    { 0x8A, 0x8E,  97 },
+    { 0x91, 0x91, 102 },
+    { 0x94, 0x95, 103 },
+    { 0x97, 0x98, 105 },
+    { 0xA1, 0xFF, 107 },
+};
+
+static const uint16_t font_offsets_12x16[203] =
+{
+        0,    18,    24,    46,    75,   102,   131,   143,   165,   187,   207,   221,   231,   237,   243,   270,
+      300,   317,   346,   376,   401,   429,   459,   488,   518,   548,   559,   576,   606,   617,   647,   673,
+      699,   722,   752,   774,   796,   817,   834,   864,   877,   890,   906,   936,   945,   968,   998,  1020,
+     1041,  1065,  1093,  1123,  1132,  1144,  1165,  1185,  1214,  1235,  1264,  1277,  1304,  1317,  1333,  1338,
+     1351,  1372,  1394,  1413,  1435,  1456,  1475,  1499,  1514,  1533,  1554,  1578,  1591,  1603,  1615,  1634,
+     1655,  1676,  1688,  1709,  1728,  1741,  1762,  1777,  1798,  1822,  1842,  1870,  1880,  1908,  1917,  1935,
+     1956,  1989,  1998,  2007,  2016,  2025,  2037,  2043,  2055,  2067,  2076,  2080,  2098,  2124,  2149,  2172,
+     2201,  2211,  2238,  2249,  2274,  2297,  2310,  2320,  2326,  2351,  2357,  2371,  2390,  2402,  2414,  2422,
+     2437,  2455,  2466,  2473,  2482,  2505,  2518,  2542,  2567,  2591,  2618,  2647,  2676,  2705,  2734,  2762,
+     2791,  2820,  2848,  2875,  2902,  2929,  2955,  2974,  2993,  3012,  3030,  3060,  3089,  3113,  3137,  3161,
+     3185,  3208,  3225,  3252,  3270,  3288,  3306,  3324,  3343,  3368,  3393,  3422,  3451,  3480,  3507,  3533,
+     3562,  3581,  3603,  3632,  3661,  3690,  3716,  3738,  3760,  3782,  3801,  3828,  3846,  3873,  3900,  3927,
+     3952,  3976,  3992,  4013,  4034,  4055,  4076,  4094,  4124,  4150,  4179,
+};
+
+static const uint8_t font_data_12x16[4179] =
+{
+    0x80,0x00,0x06,0x00,0x80,0x00,0x0F,0x03,0x80,0x00,0x06,0x01,0x41,0x80,0x00,0x06,0x00,0x41,0x01,0x80,0x80,0x19,0x02,0x49,
+    0x00,0x80,0x60,0x06,0x01,0x81,0xF0,0x3F,0xC0,0x0C,0x00,0x80,0x80,0x19,0x00,0x81,0xC0,0x7F,0x00,0x33,0x01,0x42,0x80,0x00,
+    0x06,0x00,0x82,0x80,0x1F,0xC0,0x3F,0x00,0x36,0x00,0x82,0x80,0x3F,0xC0,0x1F,0xC0,0x06,0x00,0x82,0xC0,0x3F,0x80,0x1F,0x00,
+    0x06,0x00,0x41,0x01,0x8B,0x10,0x00,0x30,0x38,0x70,0x38,0xE0,0x38,0xC0,0x01,0x80,0x03,0x00,0x07,0x00,0x0E,0x00,0x1C,0xE0,
+    0x38,0xE0,0x70,0xE0,0x60,0x41,0x00,0x82,0x00,0x07,0x80,0x0D,0x80,0x19,0x00,0x88,0x00,0x1B,0x00,0x0E,0x00,0x1E,0x00,0x3E,
+    0x60,0x33,0xC0,0x33,0x80,0x31,0xC0,0x3B,0x60,0x1E,0x41,0x80,0x00,0x0E,0x01,0x80,0x00,0x06,0x00,0x80,0x00,0x0C,0x49,0x84,
+    0x80,0x03,0x00,0x06,0x00,0x0E,0x00,0x0C,0x00,0x1C,0x04,0x83,0x00,0x0C,0x00,0x0E,0x00,0x06,0x80,0x03,0x41,0x84,0x00,0x1C,
+    0x00,0x06,0x00,0x07,0x00,0x03,0x80,0x03,0x04,0x83,0x00,0x03,0x00,0x07,0x00,0x06,0x00,0x1C,0x41,0x02,0x80,0xC0,0x36,0x00,
+    0x85,0x80,0x1F,0x00,0x0F,0xC0,0x3F,0x00,0x0F,0x80,0x1F,0xC0,0x36,0x00,0x43,0x03,0x80,0x00,0x06,0x01,0x80,0xC0,0x3F,0x00,
+    0x80,0x00,0x06,0x01,0x43,0x0A,0x80,0x00,0x0E,0x01,0x81,0x00,0x06,0x00,0x0C,0x06,0x80,0xC0,0x3F,0x00,0x46,0x0A,0x80,0x00,
+    0x0E,0x01,0x41,0x00,0x8B,0x10,0x00,0x30,0x00,0x70,0x00,0xE0,0x00,0xC0,0x01,0x80,0x03,0x00,0x07,0x00,0x0E,0x00,0x1C,0x00,
+    0x38,0x00,0x70,0x00,0x60,0x42,0x8D,0x80,0x0F,0xE0,0x3F,0x60,0x30,0x70,0x60,0xF0,0x60,0xB0,0x61,0x30,0x63,0x30,0x66,0x30,
+    0x6C,0x30,0x78,0x30,0x70,0x60,0x30,0xE0,0x3F,0x80,0x0F,0x41,0x82,0x00,0x03,0x00,0x07,0x00,0x1F,0x00,0x80,0x00,0x03,0x06,
+    0x80,0xE0,0x1F,0x00,0x41,0x8C,0xC0,0x1F,0xE0,0x3F,0x70,0x70,0x30,0x60,0x70,0x60,0xE0,0x00,0xC0,0x01,0x80,0x03,0x00,0x07,
+    0x00,0x0E,0x00,0x1C,0x00,0x38,0xF0,0x7F,0x00,0x41,0x8D,0xC0,0x1F,0xE0,0x3F,0x70,0x70,0x30,0x60,0x30,0x00,0x70,0x00,0xE0,
+    0x0F,0xC0,0x0F,0x60,0x00,0x30,0x00,0x30,0x60,0x70,0x70,0xE0,0x3F,0xC0,0x1F,0x41,0x88,0xC0,0x01,0xC0,0x03,0xC0,0x07,0xC0,
+    0x0E,0xC0,0x1C,0xC0,0x38,0xC0,0x70,0xC0,0x60,0xF0,0x7F,0x00,0x80,0xC0,0x00,0x02,0x41,0x80,0xF0,0x7F,0x00,0x80,0x00,0x60,
+    0x01,0x83,0xC0,0x7F,0xE0,0x3F,0x70,0x00,0x30,0x00,0x00,0x83,0x30,0x60,0x70,0x70,0xE0,0x3F,0xC0,0x1F,0x41,0x89,0xC0,0x03,
+    0xC0,0x07,0x00,0x0E,0x00,0x1C,0x00,0x38,0x00,0x30,0xC0,0x7F,0xE0,0x7F,0x70,0x70,0x30,0x60,0x00,0x82,0x70,0x70,0xE0,0x3F,
+    0xC0,0x1F,0x41,0x80,0xF0,0x7F,0x00,0x80,0x60,0x00,0x00,0x80,0xC0,0x00,0x00,0x80,0x80,0x01,0x00,0x80,0x00,0x03,0x00,0x80,
+    0x00,0x06,0x00,0x80,0x00,0x0C,0x00,0x41,0x83,0x80,0x0F,0xC0,0x1F,0xE0,0x38,0x60,0x30,0x00,0x84,0xE0,0x38,0xC0,0x1F,0xE0,
+    0x3F,0x70,0x70,0x30,0x60,0x00,0x82,0x70,0x70,0xE0,0x3F,0xC0,0x1F,0x41,0x83,0xC0,0x1F,0xE0,0x3F,0x70,0x70,0x30,0x60,0x00,
+    0x88,0x70,0x70,0xF0,0x3F,0xF0,0x1F,0x60,0x00,0xE0,0x00,0xC0,0x01,0x80,0x03,0x00,0x1F,0x00,0x1E,0x41,0x03,0x80,0x00,0x0E,
+    0x01,0x42,0x80,0x00,0x0E,0x01,0x42,0x03,0x80,0x00,0x0E,0x01,0x42,0x80,0x00,0x0E,0x01,0x80,0x00,0x06,0x00,0x80,0x00,0x0C,
+    0x86,0xC0,0x00,0xC0,0x01,0x80,0x03,0x00,0x07,0x00,0x0E,0x00,0x1C,0x00,0x38,0x00,0x85,0x00,0x1C,0x00,0x0E,0x00,0x07,0x80,
+    0x03,0xC0,0x01,0xC0,0x00,0x41,0x04,0x80,0xE0,0x3F,0x00,0x41,0x80,0xE0,0x3F,0x00,0x44,0x86,0x00,0x30,0x00,0x38,0x00,0x1C,
+    0x00,0x0E,0x00,0x07,0x80,0x03,0xC0,0x01,0x00,0x85,0x80,0x03,0x00,0x07,0x00,0x0E,0x00,0x1C,0x00,0x38,0x00,0x30,0x41,0x88,
+    0x80,0x1F,0xC0,0x3F,0xE0,0x70,0x60,0x60,0xE0,0x60,0xC0,0x01,0x80,0x03,0x00,0x07,0x00,0x06,0x01,0x40,0x80,0x00,0x06,0x00,
+    0x41,0x85,0xC0,0x1F,0xE0,0x3F,0x60,0x30,0xB0,0x67,0xB0,0x6F,0xB0,0x6D,0x02,0x84,0xE0,0x6F,0xC0,0x67,0x00,0x70,0xC0,0x3F,
+    0xC0,0x0F,0x41,0x80,0x00,0x06,0x00,0x80,0x00,0x0F,0x01,0x80,0x80,0x19,0x01,0x81,0xC0,0x30,0xC0,0x3F,0x00,0x80,0x60,0x60,
+    0x01,0x41,0x83,0x00,0x7F,0x80,0x7F,0xC0,0x61,0xC0,0x60,0x00,0x84,0xC0,0x61,0x80,0x7F,0xC0,0x7F,0xE0,0x60,0x60,0x60,0x00,
+    0x82,0xE0,0x60,0xC0,0x7F,0x80,0x7F,0x41,0x84,0x80,0x0F,0xC0,0x1F,0xE0,0x38,0x60,0x30,0x00,0x60,0x04,0x83,0x60,0x30,0xE0,
+    0x38,0xC0,0x1F,0x80,0x0F,0x41,0x84,0x00,0x7F,0x80,0x7F,0xC0,0x61,0xC0,0x60,0x60,0x60,0x04,0x83,0xC0,0x60,0xC0,0x61,0x80,
+    0x7F,0x00,0x7F,0x41,0x80,0xE0,0x7F,0x00,0x80,0x00,0x60,0x02,0x80,0x80,0x7F,0x00,0x80,0x00,0x60,0x02,0x80,0xE0,0x7F,0x00,
+    0x41,0x80,0xE0,0x7F,0x00,0x80,0x00,0x60,0x02,0x80,0x80,0x7F,0x00,0x80,0x00,0x60,0x04,0x41,0x84,0xC0,0x0F,0xE0,0x1F,0x60,
+    0x38,0x00,0x30,0x00,0x60,0x00,0x80,0xE0,0x63,0x00,0x80,0x60,0x60,0x00,0x83,0x60,0x30,0x60,0x38,0xE0,0x1F,0xE0,0x0F,0x41,
+    0x80,0x60,0x60,0x04,0x80,0xE0,0x7F,0x00,0x80,0x60,0x60,0x04,0x41,0x80,0x80,0x1F,0x00,0x80,0x00,0x06,0x08,0x80,0x80,0x1F,
+    0x00,0x41,0x80,0x60,0x00,0x07,0x80,0x60,0x60,0x00,0x82,0xC0,0x70,0xC0,0x3F,0x80,0x1F,0x41,0x86,0x60,0x60,0xE0,0x60,0xC0,
+    0x61,0x80,0x63,0x00,0x67,0x00,0x6E,0x00,0x7C,0x00,0x85,0x00,0x6E,0x00,0x67,0x80,0x63,0xC0,0x61,0xE0,0x60,0x60,0x60,0x41,
+    0x80,0x00,0x60,0x0A,0x80,0xE0,0x7F,0x00,0x41,0x81,0x60,0x60,0xE0,0x70,0x00,0x80,0xE0,0x79,0x00,0x80,0x60,0x6F,0x00,0x80,
+    0x60,0x66,0x00,0x80,0x60,0x60,0x03,0x41,0x81,0x60,0x60,0x60,0x70,0x00,0x81,0x60,0x78,0x60,0x6C,0x00,0x80,0x60,0x66,0x00,
+    0x80,0x60,0x63,0x00,0x81,0xE0,0x61,0xE0,0x60,0x00,0x80,0x60,0x60,0x41,0x84,0x00,0x0F,0x80,0x1F,0xC0,0x39,0xC0,0x30,0x60,
+    0x60,0x04,0x83,0xC0,0x30,0xC0,0x39,0x80,0x1F,0x00,0x0F,0x41,0x83,0x80,0x7F,0xC0,0x7F,0xE0,0x60,0x60,0x60,0x01,0x83,0xE0,
+    0x60,0xC0,0x7F,0x80,0x7F,0x00,0x60,0x03,0x41,0x84,0x00,0x0F,0x80,0x1F,0xC0,0x39,0xC0,0x30,0x60,0x60,0x03,0x84,0x60,0x63,
+    0xC0,0x33,0xC0,0x39,0xE0,0x1F,0x60,0x0F,0x41,0x83,0x80,0x7F,0xC0,0x7F,0xE0,0x60,0x60,0x60,0x01,0x87,0xE0,0x60,0xC0,0x7F,
+    0x80,0x7F,0x00,0x67,0x80,0x63,0xC0,0x61,0xE0,0x60,0x60,0x60,0x41,0x8D,0x80,0x1F,0xC0,0x3F,0xE0,0x70,0x60,0x60,0x00,0x60,
+    0x00,0x70,0x80,0x3F,0xC0,0x1F,0xE0,0x00,0x60,0x00,0x60,0x60,0xE0,0x70,0xC0,0x3F,0x80,0x1F,0x41,0x80,0xC0,0x3F,0x00,0x80,
+    0x00,0x06,0x0A,0x41,0x80,0x60,0x60,0x09,0x82,0xC0,0x30,0xC0,0x3F,0x80,0x1F,0x41,0x80,0x60,0x60,0x01,0x80,0xC0,0x30,0x01,
+    0x80,0x80,0x19,0x01,0x80,0x00,0x0F,0x01,0x80,0x00,0x06,0x00,0x41,0x80,0x60,0x60,0x05,0x80,0x60,0x66,0x00,0x82,0x60,0x6F,
+    0xE0,0x79,0xE0,0x70,0x00,0x80,0x60,0x60,0x41,0x80,0x60,0x60,0x00,0x80,0xC0,0x30,0x00,0x82,0x80,0x19,0x00,0x0F,0x00,0x06,
+    0x00,0x82,0x00,0x0F,0x80,0x19,0xC0,0x30,0x00,0x80,0x60,0x60,0x00,0x41,0x80,0x60,0x60,0x00,0x80,0xC0,0x30,0x00,0x80,0x80,
+    0x19,0x00,0x80,0x00,0x0F,0x00,0x80,0x00,0x06,0x04,0x41,0x80,0xE0,0x7F,0x00,0x80,0xC0,0x00,0x00,0x82,0x80,0x01,0x00,0x03,
+    0x00,0x06,0x00,0x82,0x00,0x0C,0x00,0x18,0x00,0x30,0x00,0x80,0xE0,0x7F,0x00,0x41,0x80,0x80,0x1F,0x00,0x80,0x00,0x18,0x08,
+    0x80,0x80,0x1F,0x00,0x41,0x00,0x8B,0x00,0x40,0x00,0x60,0x00,0x70,0x00,0x38,0x00,0x1C,0x00,0x0E,0x00,0x07,0x80,0x03,0xC0,
+    0x01,0xE0,0x00,0x70,0x00,0x30,0x00,0x42,0x80,0x80,0x1F,0x00,0x80,0x80,0x01,0x08,0x80,0x80,0x1F,0x00,0x41,0x86,0x00,0x02,
+    0x00,0x07,0x80,0x0F,0xC0,0x1D,0xE0,0x38,0x70,0x70,0x30,0x60,0x48,0x0D,0x80,0xF0,0x7F,0x00,0x00,0x80,0x00,0x07,0x01,0x80,
+    0x00,0x06,0x00,0x80,0x00,0x03,0x48,0x04,0x85,0xC0,0x1F,0xE0,0x3F,0x60,0x00,0xE0,0x1F,0xE0,0x3F,0x60,0x60,0x00,0x81,0xE0,
+    0x7F,0xE0,0x3F,0x41,0x80,0x00,0x60,0x03,0x83,0x80,0x6F,0xC0,0x7F,0xE0,0x70,0x60,0x60,0x01,0x82,0xE0,0x60,0xC0,0x7F,0x80,
+    0x7F,0x41,0x04,0x83,0x80,0x1F,0xC0,0x3F,0x60,0x70,0x00,0x60,0x01,0x82,0x60,0x70,0xC0,0x3F,0x80,0x1F,0x41,0x80,0x60,0x00,
+    0x03,0x83,0x60,0x1F,0xE0,0x3F,0xE0,0x71,0x60,0x60,0x01,0x82,0x60,0x70,0xE0,0x3F,0xE0,0x1F,0x41,0x04,0x88,0x80,0x1F,0xC0,
+    0x3F,0x60,0x70,0xE0,0x7F,0xC0,0x7F,0x00,0x60,0x00,0x70,0xC0,0x3F,0x80,0x1F,0x41,0x83,0x80,0x07,0x80,0x0F,0x00,0x1C,0x00,
+    0x18,0x01,0x80,0x00,0x7F,0x00,0x80,0x00,0x18,0x04,0x41,0x04,0x8A,0xE0,0x1F,0xE0,0x3F,0x60,0x70,0x60,0x60,0xE0,0x70,0xE0,
+    0x3F,0x60,0x1F,0x60,0x00,0xE0,0x00,0xC0,0x3F,0x80,0x3F,0x80,0x00,0x60,0x03,0x83,0x00,0x6F,0x80,0x7F,0xC0,0x71,0xC0,0x60,
+    0x04,0x41,0x01,0x80,0x00,0x06,0x00,0x40,0x80,0x00,0x0E,0x00,0x80,0x00,0x06,0x03,0x80,0x80,0x1F,0x00,0x41,0x01,0x80,0x80,
+    0x01,0x00,0x40,0x80,0x80,0x03,0x00,0x80,0x80,0x01,0x04,0x82,0x80,0x19,0x80,0x1F,0x00,0x0F,0x80,0x00,0x30,0x03,0x83,0x80,
+    0x31,0x80,0x33,0x00,0x37,0x00,0x3E,0x00,0x83,0x00,0x37,0x80,0x33,0xC0,0x31,0xC0,0x30,0x41,0x80,0x00,0x0E,0x00,0x80,0x00,
+    0x06,0x08,0x80,0x80,0x1F,0x00,0x41,0x04,0x83,0x80,0x59,0xC0,0x7F,0xE0,0x7F,0x60,0x66,0x04,0x41,0x04,0x83,0x80,0x3F,0xC0,
+    0x3F,0xE0,0x30,0x60,0x30,0x04,0x41,0x04,0x83,0x80,0x1F,0xC0,0x3F,0xE0,0x70,0x60,0x60,0x01,0x82,0xE0,0x70,0xC0,0x3F,0x80,
+    0x1F,0x41,0x04,0x83,0x80,0x7F,0xC0,0x7F,0xE0,0x60,0x60,0x60,0x00,0x83,0xE0,0x70,0xC0,0x7F,0x80,0x6F,0x00,0x60,0x01,0x04,
+    0x83,0xE0,0x1F,0xE0,0x3F,0x60,0x70,0x60,0x60,0x00,0x83,0xE0,0x70,0xE0,0x3F,0x60,0x1F,0x60,0x00,0x01,0x04,0x83,0xC0,0x37,
+    0xE0,0x3F,0x60,0x38,0x00,0x30,0x04,0x41,0x04,0x85,0x00,0x3F,0x80,0x7F,0x00,0x60,0x00,0x7F,0x80,0x3F,0x80,0x01,0x00,0x81,
+    0x80,0x7F,0x00,0x3F,0x41,0x00,0x80,0x00,0x18,0x02,0x80,0x00,0x7F,0x00,0x80,0x00,0x18,0x03,0x81,0x80,0x1F,0x80,0x0F,0x41,
+    0x04,0x80,0x60,0x60,0x04,0x82,0xE0,0x70,0xE0,0x3F,0x60,0x1F,0x41,0x04,0x80,0x60,0x60,0x00,0x80,0xC0,0x30,0x00,0x80,0x80,
+    0x19,0x00,0x80,0x00,0x0F,0x00,0x80,0x00,0x06,0x41,0x04,0x80,0x60,0x66,0x03,0x83,0x60,0x6F,0xC0,0x3F,0xC0,0x39,0x80,0x10,
+    0x41,0x04,0x88,0xC0,0x60,0xC0,0x71,0x80,0x3B,0x00,0x1F,0x00,0x0E,0x00,0x1F,0x80,0x3B,0xC0,0x71,0xC0,0x60,0x41,0x04,0x80,
+    0xC0,0x30,0x00,0x80,0x80,0x19,0x00,0x80,0x00,0x0F,0x00,0x80,0x00,0x06,0x00,0x80,0x00,0x0C,0x00,0x80,0x00,0x18,0x04,0x87,
+    0xC0,0x7F,0x80,0x7F,0x00,0x03,0x00,0x06,0x00,0x0C,0x00,0x18,0x00,0x30,0xC0,0x7F,0x00,0x41,0x83,0xC0,0x03,0xC0,0x07,0x00,
+    0x0E,0x00,0x0C,0x01,0x83,0x00,0x1C,0x00,0x38,0x00,0x1C,0x00,0x0C,0x01,0x82,0x00,0x0E,0xC0,0x07,0xC0,0x03,0x40,0x80,0x00,
+    0x06,0x04,0x40,0x80,0x00,0x06,0x05,0x41,0x83,0x00,0x3C,0x00,0x3E,0x00,0x07,0x00,0x03,0x01,0x83,0x80,0x03,0xC0,0x01,0x80,
+    0x03,0x00,0x03,0x01,0x82,0x00,0x07,0x00,0x3E,0x00,0x3C,0x40,0x01,0x82,0x60,0x1C,0xC0,0x36,0x80,0x63,0x4A,0x03,0x84,0x00,
+    0x06,0x00,0x0F,0x80,0x19,0xC0,0x30,0x60,0x60,0x00,0x80,0xE0,0x7F,0x00,0x43,0x02,0x88,0x00,0x02,0x00,0x07,0x80,0x0F,0xC0,
+    0x1F,0xE0,0x3F,0xC0,0x1F,0x80,0x0F,0x00,0x07,0x00,0x02,0x43,0x8F,0x80,0x88,0x20,0x22,0x80,0x88,0x20,0x22,0x80,0x88,0x20,
+    0x22,0x80,0x88,0x20,0x22,0x80,0x88,0x20,0x22,0x80,0x88,0x20,0x22,0x80,0x88,0x20,0x22,0x80,0x88,0x20,0x22,0x80,0x00,0x06,
+    0x05,0x80,0x00,0xFE,0x00,0x46,0x06,0x80,0x00,0xFE,0x00,0x80,0x00,0x06,0x05,0x06,0x80,0xF0,0x07,0x00,0x80,0x00,0x06,0x05,
+    0x80,0x00,0x06,0x05,0x80,0xF0,0x07,0x00,0x46,0x80,0x00,0x06,0x05,0x80,0xF0,0xFF,0x00,0x80,0x00,0x06,0x05,0x06,0x80,0xF0,
+    0xFF,0x00,0x46,0x80,0x00,0x06,0x05,0x80,0xF0,0x07,0x00,0x80,0x00,0x06,0x05,0x80,0x00,0x06,0x05,0x80,0x00,0xFE,0x00,0x80,
+    0x00,0x06,0x05,0x06,0x80,0xF0,0xFF,0x00,0x80,0x00,0x06,0x05,0x80,0x00,0x06,0x0E,0x80,0x00,0x06,0x00,0x41,0x80,0x00,0x06,
+    0x01,0x80,0x00,0x0F,0x03,0x80,0x00,0x06,0x00,0x41,0x00,0x80,0x00,0x06,0x00,0x83,0x80,0x0F,0xC0,0x1F,0xC0,0x3E,0x00,0x36,
+    0x01,0x83,0xC0,0x3E,0xC0,0x1F,0x80,0x0F,0x00,0x06,0x00,0x41,0x01,0x83,0x80,0x07,0xC0,0x0F,0xC0,0x0C,0x00,0x0C,0x00,0x81,
+    0x00,0x1F,0x00,0x0C,0x00,0x82,0x00,0x18,0xE0,0x3F,0xC0,0x3B,0x42,0x00,0x84,0x60,0x60,0x60,0x6F,0xC0,0x3F,0xE0,0x70,0x60,
+    0x60,0x02,0x83,0xE0,0x70,0xC0,0x3F,0x60,0x6F,0x60,0x60,0x42,0x80,0x60,0x60,0x00,0x80,0xC0,0x30,0x00,0x80,0x80,0x19,0x00,
+    0x80,0x00,0x0F,0x00,0x84,0x00,0x06,0xC0,0x3F,0x00,0x06,0xC0,0x3F,0x00,0x06,0x00,0x41,0x80,0x00,0x06,0x04,0x40,0x80,0x00,
+    0x06,0x05,0x41,0x00,0x82,0x80,0x1F,0xC0,0x30,0x00,0x30,0x00,0x81,0x80,0x1F,0xC0,0x30,0x00,0x81,0x80,0x1F,0xC0,0x00,0x00,
+    0x81,0xC0,0x30,0x80,0x1F,0x42,0x05,0x81,0x80,0x10,0xC0,0x39,0x00,0x80,0x80,0x10,0x45,0x01,0x8A,0xC0,0x1F,0xE0,0x3F,0x70,
+    0x70,0x30,0x67,0xB0,0x6D,0x30,0x6C,0xB0,0x6D,0x30,0x67,0x70,0x70,0xE0,0x3F,0xC0,0x1F,0x42,0x87,0xC0,0x1F,0xE0,0x3F,0x60,
+    0x00,0xE0,0x3F,0xE0,0x7F,0x60,0x60,0xE0,0x7F,0xE0,0x3F,0x40,0x80,0xC0,0x3F,0x00,0x44,0x04,0x84,0xC0,0x18,0x80,0x31,0x00,
+    0x63,0x80,0x31,0xC0,0x18,0x45,0x02,0x80,0xE0,0xFF,0x00,0x80,0x60,0x00,0x03,0x45,0x05,0x80,0x80,0x1F,0x00,0x47,0x01,0x86,
+    0xC0,0x1F,0xE0,0x3F,0x70,0x70,0x30,0x6F,0xB0,0x6D,0x30,0x6F,0xB0,0x6D,0x00,0x82,0x70,0x70,0xE0,0x3F,0xC0,0x1F,0x42,0x01,
+    0x80,0x80,0x07,0x00,0x4B,0x82,0x00,0x0F,0x80,0x1F,0x80,0x19,0x00,0x81,0x80,0x1F,0x00,0x0F,0x49,0x03,0x80,0x00,0x06,0x00,
+    0x80,0x80,0x1F,0x00,0x80,0x00,0x06,0x00,0x40,0x80,0x80,0x1F,0x00,0x42,0x84,0x00,0x3C,0x00,0x06,0x00,0x1C,0x00,0x30,0x00,
+    0x3E,0x4A,0x84,0x00,0x3C,0x00,0x06,0x00,0x1C,0x00,0x06,0x00,0x3C,0x4A,0x82,0x00,0x03,0x00,0x06,0x00,0x0C,0x4C,0x03,0x80,
+    0xC0,0x60,0x03,0x83,0xC0,0x71,0xC0,0x7F,0xC0,0x7E,0x00,0x60,0x02,0x00,0x82,0xE0,0x1F,0xC0,0x36,0xC0,0x66,0x01,0x82,0xC0,
+    0x36,0xC0,0x1E,0xC0,0x06,0x04,0x41,0x05,0x81,0x00,0x02,0x00,0x07,0x00,0x80,0x00,0x02,0x45,0x05,0x81,0x00,0x13,0x00,0x0F,
+    0x47,0x82,0x00,0x18,0x00,0x38,0x00,0x18,0x01,0x4A,0x83,0x80,0x1F,0xC0,0x3F,0xE0,0x70,0x60,0x60,0x00,0x82,0xE0,0x70,0xC0,
+    0x3F,0x80,0x1F,0x40,0x80,0xC0,0x3F,0x00,0x44,0x04,0x84,0x00,0x63,0x80,0x31,0xC0,0x18,0x80,0x31,0x00,0x63,0x45,0x01,0x89,
+    0x00,0x30,0x00,0x70,0xC0,0x30,0x80,0x31,0x00,0x7B,0x00,0x06,0x60,0x0D,0x60,0x1B,0xE0,0x33,0x60,0x00,0x00,0x42,0x01,0x8A,
+    0x00,0x30,0x00,0x70,0xC0,0x30,0x80,0x31,0x00,0x7B,0x00,0x06,0xC0,0x0D,0x60,0x18,0xC0,0x30,0x80,0x01,0xE0,0x01,0x42,0x01,
+    0x89,0x00,0x70,0x00,0x18,0xC0,0x30,0x80,0x19,0x00,0x73,0x00,0x06,0x60,0x0D,0x60,0x1B,0xE0,0x33,0x60,0x00,0x00,0x42,0x80,
+    0x00,0x06,0x00,0x40,0x80,0x00,0x06,0x01,0x87,0x00,0x0E,0x00,0x1C,0x00,0x38,0x60,0x70,0x60,0x60,0xE0,0x70,0xC0,0x3F,0x80,
+    0x1F,0x41,0x83,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x06,0x00,0x80,0x00,0x0F,0x00,0x80,0x80,0x19,0x00,0x83,0xC0,0x30,0xC0,
+    0x3F,0xE0,0x7F,0x60,0x60,0x00,0x41,0x83,0x00,0x03,0x00,0x06,0x00,0x0C,0x00,0x06,0x00,0x80,0x00,0x0F,0x00,0x80,0x80,0x19,
+    0x00,0x83,0xC0,0x30,0xC0,0x3F,0xE0,0x7F,0x60,0x60,0x00,0x41,0x83,0x00,0x06,0x00,0x0F,0x80,0x19,0x00,0x06,0x00,0x80,0x00,
+    0x0F,0x00,0x80,0x80,0x19,0x00,0x83,0xC0,0x30,0xC0,0x3F,0xE0,0x7F,0x60,0x60,0x00,0x41,0x81,0xC0,0x0E,0x80,0x1B,0x40,0x80,
+    0x00,0x06,0x00,0x80,0x00,0x0F,0x00,0x80,0x80,0x19,0x00,0x83,0xC0,0x30,0xC0,0x3F,0xE0,0x7F,0x60,0x60,0x00,0x41,0x80,0x80,
+    0x19,0x00,0x40,0x80,0x00,0x06,0x00,0x80,0x00,0x0F,0x00,0x80,0x80,0x19,0x00,0x83,0xC0,0x30,0xC0,0x3F,0xE0,0x7F,0x60,0x60,
+    0x00,0x41,0x82,0x00,0x06,0x00,0x09,0x00,0x06,0x40,0x81,0x00,0x06,0x00,0x0F,0x00,0x80,0x80,0x19,0x00,0x83,0xC0,0x30,0xC0,
+    0x3F,0xE0,0x7F,0x60,0x60,0x00,0x41,0x80,0xE0,0x07,0x00,0x80,0x00,0x0F,0x00,0x88,0x00,0x1F,0x00,0x1B,0xC0,0x1B,0xC0,0x33,
+    0x00,0x33,0x00,0x3F,0x00,0x7F,0x00,0x63,0xE0,0x63,0x00,0x41,0x85,0x80,0x0F,0xC0,0x1F,0xE0,0x38,0x60,0x30,0x60,0x60,0x00,
+    0x60,0x02,0x85,0x60,0x30,0xE0,0x38,0xC0,0x1F,0x80,0x0F,0x00,0x06,0x00,0x1E,0x00,0x83,0x00,0x18,0x00,0x0C,0x00,0x06,0xE0,
+    0x7F,0x00,0x80,0x00,0x60,0x00,0x80,0x80,0x7F,0x00,0x80,0x00,0x60,0x01,0x80,0xE0,0x7F,0x00,0x41,0x83,0x80,0x01,0x00,0x03,
+    0x00,0x06,0xE0,0x7F,0x00,0x80,0x00,0x60,0x00,0x80,0x80,0x7F,0x00,0x80,0x00,0x60,0x01,0x80,0xE0,0x7F,0x00,0x41,0x83,0x00,
+    0x06,0x00,0x0F,0x80,0x19,0xE0,0x7F,0x00,0x80,0x00,0x60,0x00,0x80,0x80,0x7F,0x00,0x80,0x00,0x60,0x01,0x80,0xE0,0x7F,0x00,
+    0x41,0x80,0x80,0x19,0x00,0x40,0x80,0xE0,0x7F,0x00,0x80,0x00,0x60,0x00,0x80,0x80,0x7F,0x00,0x80,0x00,0x60,0x01,0x80,0xE0,
+    0x7F,0x00,0x41,0x83,0x00,0x18,0x00,0x0C,0x00,0x06,0x80,0x1F,0x00,0x80,0x00,0x06,0x05,0x80,0x80,0x1F,0x00,0x41,0x83,0x80,
+    0x01,0x00,0x03,0x00,0x06,0x80,0x1F,0x00,0x80,0x00,0x06,0x05,0x80,0x80,0x1F,0x00,0x41,0x83,0x00,0x06,0x00,0x0F,0x80,0x19,
+    0x80,0x1F,0x00,0x80,0x00,0x06,0x05,0x80,0x80,0x1F,0x00,0x41,0x80,0x80,0x19,0x00,0x40,0x80,0x80,0x1F,0x00,0x80,0x00,0x06,
+    0x05,0x80,0x80,0x1F,0x00,0x41,0x84,0x00,0x3F,0x80,0x3F,0xC0,0x31,0xC0,0x30,0x60,0x30,0x00,0x80,0x60,0x78,0x00,0x80,0x60,
+    0x30,0x00,0x83,0xC0,0x30,0xC0,0x31,0x80,0x3F,0x00,0x3F,0x41,0x81,0xC0,0x0E,0x80,0x1B,0x40,0x89,0x60,0x60,0x60,0x70,0x60,
+    0x78,0x60,0x7C,0x60,0x6E,0x60,0x67,0xE0,0x63,0xE0,0x61,0xE0,0x60,0x60,0x60,0x00,0x41,0x86,0x00,0x18,0x00,0x0C,0x00,0x06,
+    0x80,0x1F,0xC0,0x3F,0xE0,0x70,0x60,0x60,0x03,0x82,0xE0,0x70,0xC0,0x3F,0x80,0x1F,0x41,0x86,0x80,0x01,0x00,0x03,0x00,0x06,
+    0x80,0x1F,0xC0,0x3F,0xE0,0x70,0x60,0x60,0x03,0x82,0xE0,0x70,0xC0,0x3F,0x80,0x1F,0x41,0x86,0x00,0x06,0x00,0x0F,0x80,0x19,
+    0x80,0x1F,0xC0,0x3F,0xE0,0x70,0x60,0x60,0x03,0x82,0xE0,0x70,0xC0,0x3F,0x80,0x1F,0x41,0x81,0xC0,0x0E,0x80,0x1B,0x40,0x83,
+    0x80,0x1F,0xC0,0x3F,0xE0,0x70,0x60,0x60,0x03,0x82,0xE0,0x70,0xC0,0x3F,0x80,0x1F,0x41,0x80,0x80,0x19,0x00,0x40,0x83,0x80,
+    0x1F,0xC0,0x3F,0xE0,0x70,0x60,0x60,0x03,0x82,0xE0,0x70,0xC0,0x3F,0x80,0x1F,0x41,0x03,0x86,0xC0,0x30,0x80,0x19,0x00,0x0F,
+    0x00,0x06,0x00,0x0F,0x80,0x19,0xC0,0x30,0x44,0x01,0x83,0x60,0x1F,0xC0,0x3F,0xE0,0x71,0x60,0x63,0x00,0x80,0x60,0x66,0x00,
+    0x80,0x60,0x6C,0x00,0x82,0xE0,0x78,0xC0,0x3F,0x80,0x6F,0x41,0x83,0x00,0x18,0x00,0x0C,0x00,0x06,0x60,0x60,0x06,0x82,0xC0,
+    0x30,0xC0,0x3F,0x80,0x1F,0x41,0x83,0x80,0x01,0x00,0x03,0x00,0x06,0x60,0x60,0x06,0x82,0xC0,0x30,0xC0,0x3F,0x80,0x1F,0x41,
+    0x83,0x00,0x06,0x00,0x0F,0x80,0x19,0x60,0x60,0x06,0x82,0xC0,0x30,0xC0,0x3F,0x80,0x1F,0x41,0x01,0x80,0x80,0x19,0x00,0x40,
+    0x80,0x60,0x60,0x04,0x82,0xE0,0x70,0xE0,0x3F,0x60,0x1F,0x41,0x87,0x80,0x01,0x00,0x03,0x00,0x06,0x60,0x60,0xC0,0x30,0x80,
+    0x19,0x00,0x0F,0x00,0x06,0x05,0x41,0x80,0x00,0x3C,0x00,0x83,0x00,0x18,0x80,0x1F,0xC0,0x1F,0xC0,0x18,0x02,0x83,0xC0,0x1F,
+    0x80,0x1F,0x00,0x18,0x00,0x3C,0x00,0x41,0x03,0x82,0x00,0x0F,0x80,0x19,0xC0,0x30,0x00,0x82,0x80,0x3F,0xC0,0x31,0xC0,0x30,
+    0x00,0x82,0xC0,0x31,0x80,0x3F,0x00,0x30,0x00,0x00,0x82,0x00,0x0C,0x00,0x06,0x00,0x03,0x40,0x85,0xC0,0x1F,0xE0,0x3F,0x60,
+    0x00,0xE0,0x1F,0xE0,0x3F,0x60,0x60,0x00,0x81,0xE0,0x7F,0xE0,0x3F,0x41,0x00,0x82,0x00,0x03,0x00,0x06,0x00,0x0C,0x40,0x85,
+    0xC0,0x1F,0xE0,0x3F,0x60,0x00,0xE0,0x1F,0xE0,0x3F,0x60,0x60,0x00,0x81,0xE0,0x7F,0xE0,0x3F,0x41,0x00,0x82,0x00,0x06,0x00,
+    0x0F,0x80,0x19,0x40,0x85,0xC0,0x1F,0xE0,0x3F,0x60,0x00,0xE0,0x1F,0xE0,0x3F,0x60,0x60,0x00,0x81,0xE0,0x7F,0xE0,0x3F,0x41,
+    0x01,0x81,0xC0,0x0E,0x80,0x1B,0x40,0x85,0xC0,0x1F,0xE0,0x3F,0x60,0x00,0xE0,0x1F,0xE0,0x3F,0x60,0x60,0x00,0x81,0xE0,0x7F,
+    0xE0,0x3F,0x41,0x01,0x80,0x80,0x19,0x00,0x40,0x85,0xC0,0x1F,0xE0,0x3F,0x60,0x00,0xE0,0x1F,0xE0,0x3F,0x60,0x60,0x00,0x81,
+    0xE0,0x7F,0xE0,0x3F,0x41,0x00,0x82,0x00,0x06,0x00,0x09,0x00,0x06,0x40,0x85,0xC0,0x1F,0xE0,0x3F,0x60,0x00,0xE0,0x1F,0xE0,
+    0x3F,0x60,0x60,0x00,0x81,0xE0,0x7F,0xE0,0x3F,0x41,0x05,0x84,0xC0,0x3D,0x60,0x66,0x60,0x06,0xC0,0x3F,0x00,0x66,0x00,0x81,
+    0x60,0x66,0xC0,0x3B,0x41,0x04,0x83,0x80,0x1F,0xC0,0x3F,0xE0,0x70,0x00,0x60,0x01,0x84,0xE0,0x70,0xC0,0x3F,0x80,0x1F,0x00,
+    0x06,0x00,0x1E,0x00,0x82,0x00,0x0C,0x00,0x06,0x00,0x03,0x40,0x83,0x80,0x1F,0xC0,0x3F,0x60,0x70,0xE0,0x7F,0x00,0x80,0x00,
+    0x60,0x00,0x81,0xC0,0x3F,0x80,0x1F,0x41,0x00,0x82,0x80,0x01,0x00,0x03,0x00,0x06,0x40,0x83,0x80,0x1F,0xC0,0x3F,0x60,0x70,
+    0xE0,0x7F,0x00,0x83,0x00,0x60,0x00,0x70,0xC0,0x3F,0x80,0x1F,0x41,0x00,0x82,0x00,0x06,0x00,0x0F,0x80,0x19,0x40,0x83,0x80,
+    0x1F,0xC0,0x3F,0x60,0x70,0xE0,0x7F,0x00,0x80,0x00,0x60,0x00,0x81,0xC0,0x3F,0x80,0x1F,0x41,0x01,0x80,0x80,0x19,0x00,0x40,
+    0x83,0x80,0x1F,0xC0,0x3F,0x60,0x70,0xE0,0x7F,0x00,0x80,0x00,0x60,0x00,0x81,0xC0,0x3F,0x80,0x1F,0x41,0x00,0x82,0x00,0x0C,
+    0x00,0x06,0x00,0x03,0x40,0x80,0x00,0x0E,0x00,0x80,0x00,0x06,0x03,0x80,0x80,0x1F,0x00,0x41,0x00,0x82,0x00,0x03,0x00,0x06,
+    0x00,0x0C,0x40,0x80,0x00,0x0E,0x00,0x80,0x00,0x06,0x03,0x80,0x80,0x1F,0x00,0x41,0x00,0x82,0x00,0x06,0x00,0x0F,0x80,0x19,
+    0x40,0x80,0x00,0x0E,0x00,0x80,0x00,0x06,0x03,0x80,0x80,0x1F,0x00,0x41,0x01,0x80,0x00,0x1B,0x00,0x40,0x80,0x00,0x0E,0x00,
+    0x80,0x00,0x06,0x03,0x80,0x80,0x1F,0x00,0x41,0x01,0x88,0x00,0x0F,0x80,0x1F,0x80,0x18,0x00,0x18,0x00,0x1C,0x00,0x0E,0x00,
+    0x07,0x80,0x0F,0x80,0x19,0x00,0x81,0x80,0x1F,0x00,0x0F,0x41,0x01,0x81,0xC0,0x0E,0x80,0x1B,0x40,0x83,0x80,0x3F,0xC0,0x3F,
+    0xE0,0x30,0x60,0x30,0x04,0x41,0x00,0x82,0x00,0x0C,0x00,0x06,0x00,0x03,0x40,0x83,0x80,0x1F,0xC0,0x3F,0xE0,0x70,0x60,0x60,
+    0x01,0x82,0xE0,0x70,0xC0,0x3F,0x80,0x1F,0x41,0x00,0x82,0x00,0x03,0x00,0x06,0x00,0x0C,0x40,0x83,0x80,0x1F,0xC0,0x3F,0xE0,
+    0x70,0x60,0x60,0x01,0x82,0xE0,0x70,0xC0,0x3F,0x80,0x1F,0x41,0x00,0x82,0x00,0x06,0x00,0x0F,0x80,0x19,0x40,0x83,0x80,0x1F,
+    0xC0,0x3F,0xE0,0x70,0x60,0x60,0x01,0x82,0xE0,0x70,0xC0,0x3F,0x80,0x1F,0x41,0x01,0x81,0x80,0x1D,0x00,0x37,0x40,0x83,0x80,
+    0x1F,0xC0,0x3F,0xE0,0x70,0x60,0x60,0x01,0x82,0xE0,0x70,0xC0,0x3F,0x80,0x1F,0x41,0x01,0x80,0x80,0x19,0x00,0x40,0x83,0x80,
+    0x1F,0xC0,0x3F,0xE0,0x70,0x60,0x60,0x01,0x82,0xE0,0x70,0xC0,0x3F,0x80,0x1F,0x41,0x03,0x80,0x00,0x06,0x00,0x40,0x80,0xC0,
+    0x3F,0x00,0x40,0x80,0x00,0x06,0x00,0x43,0x04,0x88,0x60,0x1F,0xC0,0x3F,0xE0,0x71,0x60,0x63,0x60,0x66,0x60,0x6C,0xE0,0x78,
+    0xC0,0x3F,0x80,0x6F,0x41,0x00,0x82,0x00,0x0C,0x00,0x06,0x00,0x03,0x40,0x80,0x60,0x60,0x04,0x82,0xE0,0x70,0xE0,0x3F,0x60,
+    0x1F,0x41,0x00,0x82,0x00,0x03,0x00,0x06,0x00,0x0C,0x40,0x80,0x60,0x60,0x04,0x82,0xE0,0x70,0xE0,0x3F,0x60,0x1F,0x41,0x00,
+    0x82,0x00,0x06,0x00,0x0F,0x80,0x19,0x40,0x80,0x60,0x60,0x04,0x82,0xE0,0x70,0xE0,0x3F,0x60,0x1F,0x41,0x01,0x80,0x80,0x19,
+    0x00,0x40,0x80,0x60,0x60,0x04,0x82,0xE0,0x70,0xE0,0x3F,0x60,0x1F,0x41,0x01,0x83,0x80,0x01,0x00,0x03,0x00,0x06,0xC0,0x30,
+    0x00,0x80,0x80,0x19,0x00,0x80,0x00,0x0F,0x00,0x80,0x00,0x06,0x00,0x80,0x00,0x0C,0x00,0x80,0x00,0x18,0x01,0x80,0x00,0x3C,
+    0x00,0x83,0x00,0x18,0x80,0x1F,0xC0,0x1F,0xC0,0x18,0x00,0x83,0xC0,0x1F,0x80,0x1F,0x00,0x18,0x00,0x3C,0x00,0x41,0x01,0x80,
+    0x80,0x19,0x00,0x40,0x80,0xC0,0x30,0x00,0x80,0x80,0x19,0x00,0x80,0x00,0x0F,0x00,0x80,0x00,0x06,0x00,0x80,0x00,0x0C,0x00,
+    0x80,0x00,0x18,
+};
+
+static const FONT_PACKED font_12x16 = { 12, 16, 6, font_ranges_12x16, font_offsets_12x16, font_data_12x16 };
+
+static const FONT_RANGE font_ranges_12x20[6] =
+{
+    { 0x21, 0x81,   0 },
+    { 0x8A, 0x8E,  97 },
+    { 0x91, 0x91, 102 },
+    { 0x94, 0x95, 103 },
+    { 0x97, 0x98, 105 },
+    { 0xA1, 0xFF, 107 },
+};
+
+static const uint16_t font_offsets_12x20[203] =
+{
+        0,    11,    17,    43,    78,   109,   140,   146,   177,   208,   227,   241,   254,   260,   266,   301,
+      324,   340,   368,   397,   423,   450,   479,   509,   540,   569,   580,   598,   623,   634,   659,   686,
+      717,   746,   773,   796,   819,   841,   859,   888,   902,   916,   933,   962,   972,   998,  1026,  1049,
+     1071,  1100,  1127,  1156,  1166,  1179,  1208,  1235,  1264,  1284,  1312,  1326,  1361,  1375,  1400,  1406,
+     1412,  1437,  1462,  1485,  1508,  1533,  1551,  1577,  1593,  1608,  1629,  1658,  1668,  1680,  1692,  1711,
+     1732,  1753,  1765,  1790,  1809,  1822,  1847,  1871,  1896,  1928,  1952,  1975,  1981,  2004,  2013,  2024,
+     2055,  2080,  2089,  2098,  2107,  2116,  2128,  2134,  2146,  2158,  2167,  2171,  2181,  2207,  2231,  2254,
+     2282,  2293,  2330,  2335,  2362,  2379,  2400,  2410,  2416,  2437,  2442,  2453,  2472,  2489,  2506,  2512,
+     2527,  2543,  2549,  2559,  2567,  2582,  2603,  2634,  2665,  2696,  2725,  2759,  2793,  2827,  2861,  2894,
+     2928,  2957,  2987,  3014,  3041,  3068,  3094,  3113,  3132,  3151,  3169,  3198,  3231,  3259,  3287,  3315,
+     3343,  3370,  3395,  3424,  3442,  3460,  3478,  3495,  3520,  3546,  3579,  3611,  3643,  3675,  3706,  3736,
+     3768,  3793,  3823,  3855,  3887,  3919,  3949,  3966,  3983,  4000,  4015,  4042,  4060,  4086,  4112,  4138,
+     4163,  4187,  4203,  4228,  4248,  4268,  4288,  4306,  4345,  4370,  4407,
+};
+
+static const uint8_t font_data_12x20[4407] =
+{
+    0x01,0x80,0x00,0x06,0x08,0x41,0x80,0x00,0x06,0x00,0x43,0x00,0x80,0x80,0x31,0x03,0x4D,0x01,0x80,0x40,0x04,0x00,0x80,0x80,
+    0x08,0x01,0x81,0xF0,0x7F,0x00,0x11,0x01,0x81,0xE0,0x7F,0x00,0x22,0x00,0x80,0x00,0x44,0x00,0x43,0x00,0x84,0x00,0x02,0x80,
+    0x0F,0xC0,0x1F,0x40,0x32,0x00,0x32,0x00,0x82,0x00,0x1E,0x00,0x0E,0x80,0x03,0x00,0x80,0xC0,0x02,0x00,0x83,0xC0,0x22,0x80,
+    0x3F,0x00,0x1F,0x00,0x02,0x42,0x01,0x84,0x10,0x78,0x20,0xCC,0x40,0xCC,0x80,0xCC,0x00,0xCD,0x00,0x82,0x00,0x7A,0xE0,0x05,
+    0x30,0x0B,0x00,0x83,0x30,0x13,0x30,0x23,0x30,0x43,0xE0,0x81,0x43,0x01,0x82,0x00,0x0F,0x80,0x1F,0x80,0x19,0x00,0x89,0x00,
+    0x1B,0x00,0x0E,0x00,0x3C,0x30,0x66,0x30,0xC7,0x30,0xC3,0xE0,0xC1,0xE0,0xE1,0xE0,0x7F,0x70,0x3F,0x43,0x00,0x80,0x00,0x06,
+    0x03,0x4D,0x00,0x84,0xC0,0x00,0xC0,0x03,0x00,0x07,0x00,0x06,0x00,0x0C,0x00,0x80,0x00,0x18,0x04,0x80,0x00,0x0C,0x00,0x83,
+    0x00,0x06,0x00,0x07,0xC0,0x03,0xC0,0x00,0x40,0x00,0x84,0x00,0x30,0x00,0x3C,0x00,0x0E,0x00,0x06,0x00,0x03,0x00,0x80,0x80,
+    0x01,0x04,0x80,0x00,0x03,0x00,0x83,0x00,0x06,0x00,0x0E,0x00,0x3C,0x00,0x30,0x40,0x01,0x80,0x00,0x0C,0x00,0x81,0xC0,0x6C,
+    0xC0,0x73,0x40,0x82,0x00,0x1B,0x80,0x39,0x00,0x11,0x49,0x04,0x80,0x00,0x06,0x02,0x80,0xE0,0x7F,0x00,0x80,0x00,0x06,0x03,
+    0x43,0x0C,0x80,0x00,0x0E,0x01,0x82,0x00,0x06,0x00,0x04,0x00,0x0C,0x40,0x08,0x80,0xC0,0x3F,0x00,0x48,0x0C,0x80,0x00,0x0E,
+    0x01,0x43,0x00,0x81,0x60,0x00,0xC0,0x00,0x00,0x80,0x80,0x01,0x01,0x80,0x00,0x03,0x00,0x80,0x00,0x06,0x00,0x80,0x00,0x0C,
+    0x00,0x80,0x00,0x18,0x01,0x80,0x00,0x30,0x00,0x80,0x00,0x60,0x40,0x01,0x82,0x00,0x0F,0x80,0x1F,0xC0,0x30,0x00,0x80,0x60,
+    0x60,0x04,0x80,0xC0,0x30,0x00,0x81,0x80,0x1F,0x00,0x0F,0x43,0x01,0x83,0x00,0x06,0x00,0x3E,0x00,0x66,0x00,0x06,0x07,0x80,
+    0xE0,0x7F,0x00,0x43,0x01,0x83,0x00,0x1F,0x80,0x3F,0xC0,0x21,0xC0,0x00,0x01,0x86,0x80,0x01,0x00,0x03,0x00,0x06,0x00,0x0C,
+    0x00,0x18,0x00,0x30,0xC0,0x3F,0x00,0x43,0x01,0x85,0x00,0x1F,0xC0,0x3F,0xC0,0x20,0xC0,0x00,0x80,0x01,0x00,0x1F,0x00,0x81,
+    0x80,0x01,0xC0,0x00,0x01,0x82,0xC0,0x21,0x80,0x3F,0x00,0x3F,0x43,0x01,0x88,0x80,0x01,0x80,0x03,0x80,0x07,0x80,0x05,0x80,
+    0x09,0x80,0x19,0x80,0x31,0x80,0x21,0xE0,0x7F,0x00,0x80,0x80,0x01,0x02,0x43,0x01,0x80,0xC0,0x1F,0x00,0x80,0x00,0x18,0x02,
+    0x83,0x00,0x1F,0x80,0x1F,0xC0,0x01,0xC0,0x00,0x00,0x82,0xC0,0x01,0x80,0x1F,0x00,0x1F,0x43,0x01,0x88,0x00,0x0F,0x80,0x1F,
+    0x80,0x38,0x00,0x30,0x00,0x60,0x00,0x67,0x80,0x6F,0xC0,0x71,0xC0,0x60,0x01,0x82,0xC0,0x31,0x80,0x3F,0x00,0x0F,0x43,0x01,
+    0x80,0xE0,0x3F,0x00,0x88,0x60,0x00,0xC0,0x00,0x80,0x00,0x80,0x01,0x00,0x03,0x00,0x02,0x00,0x06,0x00,0x04,0x00,0x0C,0x00,
+    0x80,0x00,0x18,0x00,0x43,0x01,0x82,0x00,0x0F,0x80,0x3F,0x80,0x31,0x00,0x85,0x80,0x39,0x00,0x1F,0x00,0x0E,0x80,0x37,0xC0,
+    0x61,0xC0,0x60,0x00,0x82,0xC0,0x71,0x80,0x3F,0x00,0x1F,0x43,0x01,0x83,0x00,0x1E,0x80,0x3F,0x80,0x71,0xC0,0x60,0x01,0x87,
+    0xC0,0x71,0xC0,0x3E,0xC0,0x1C,0xC0,0x00,0x80,0x01,0x80,0x23,0x00,0x3F,0x00,0x1E,0x43,0x04,0x80,0x00,0x0E,0x01,0x44,0x80,
+    0x00,0x0E,0x01,0x43,0x04,0x80,0x00,0x0E,0x01,0x44,0x80,0x00,0x0E,0x01,0x82,0x00,0x06,0x00,0x04,0x00,0x0C,0x40,0x04,0x8A,
+    0x20,0x00,0xE0,0x00,0xC0,0x03,0x00,0x07,0x00,0x1C,0x00,0x70,0x00,0x1C,0x00,0x07,0xC0,0x03,0xE0,0x00,0x20,0x00,0x43,0x06,
+    0x80,0xE0,0x7F,0x00,0x41,0x80,0xE0,0x7F,0x00,0x46,0x04,0x8A,0x00,0x40,0x00,0x70,0x00,0x3C,0x00,0x0E,0x80,0x03,0xE0,0x00,
+    0x80,0x03,0x00,0x0E,0x00,0x3C,0x00,0x70,0x00,0x40,0x43,0x01,0x83,0x00,0x7F,0xC0,0x7F,0xC0,0x41,0xC0,0x00,0x00,0x83,0x80,
+    0x01,0x00,0x03,0x00,0x06,0x00,0x0C,0x00,0x41,0x80,0x00,0x0C,0x00,0x43,0x01,0x85,0x80,0x0F,0xC0,0x18,0x60,0x30,0xE0,0x63,
+    0x60,0xC6,0x60,0xCC,0x00,0x80,0xE0,0xCC,0x00,0x84,0x60,0xCF,0x70,0x66,0x00,0x60,0x00,0x30,0x80,0x0F,0x43,0x02,0x81,0x00,
+    0x06,0x00,0x0F,0x00,0x81,0x00,0x0B,0x80,0x19,0x00,0x84,0xC0,0x31,0xC0,0x30,0xC0,0x3F,0xE0,0x7F,0x60,0x60,0x00,0x80,0x30,
+    0xC0,0x43,0x02,0x82,0x00,0x7F,0x80,0x7F,0x80,0x61,0x00,0x84,0x00,0x63,0x00,0x7E,0x00,0x7F,0x80,0x61,0xC0,0x60,0x01,0x81,
+    0x80,0x7F,0x00,0x7F,0x43,0x02,0x84,0xC0,0x07,0xE0,0x1F,0x20,0x38,0x00,0x30,0x00,0x60,0x03,0x83,0x00,0x30,0x20,0x3C,0xE0,
+    0x1F,0xC0,0x07,0x43,0x02,0x84,0x00,0x7F,0x80,0x7F,0xC0,0x61,0xE0,0x60,0x60,0x60,0x03,0x83,0xC0,0x60,0xC0,0x61,0x80,0x7F,
+    0x00,0x7F,0x43,0x02,0x80,0xE0,0x3F,0x00,0x80,0x00,0x30,0x01,0x80,0xC0,0x3F,0x00,0x80,0x00,0x30,0x02,0x80,0xE0,0x3F,0x00,
+    0x43,0x02,0x80,0xE0,0x3F,0x00,0x80,0x00,0x30,0x01,0x80,0xC0,0x3F,0x00,0x80,0x00,0x30,0x04,0x43,0x02,0x84,0xC0,0x07,0xE0,
+    0x1F,0x20,0x38,0x00,0x30,0x00,0x60,0x00,0x80,0xE0,0x61,0x00,0x84,0x60,0x60,0x60,0x30,0x60,0x38,0xE0,0x1F,0xC0,0x07,0x43,
+    0x02,0x80,0xC0,0x60,0x03,0x80,0xC0,0x7F,0x00,0x80,0xC0,0x60,0x04,0x43,0x02,0x80,0x80,0x7F,0x00,0x80,0x00,0x0C,0x07,0x80,
+    0x80,0x7F,0x00,0x43,0x02,0x80,0x80,0x1F,0x00,0x80,0x80,0x01,0x06,0x82,0x80,0x03,0x00,0x3F,0x00,0x3E,0x43,0x02,0x8C,0xE0,
+    0x60,0xC0,0x61,0x80,0x63,0x00,0x67,0x00,0x66,0x00,0x6C,0x00,0x7C,0x00,0x6E,0x00,0x67,0x80,0x63,0xC0,0x61,0xE0,0x60,0x70,
+    0x60,0x43,0x02,0x80,0x00,0x30,0x09,0x80,0xE0,0x3F,0x00,0x43,0x02,0x80,0xE0,0xE0,0x00,0x81,0xE0,0xF1,0x60,0xD1,0x00,0x81,
+    0x60,0xDB,0x60,0xCA,0x00,0x82,0x60,0xCE,0x60,0xC4,0x60,0xC0,0x01,0x43,0x02,0x80,0x60,0x70,0x00,0x80,0x60,0x78,0x00,0x85,
+    0x60,0x6C,0x60,0x6E,0x60,0x66,0x60,0x67,0x60,0x63,0xE0,0x61,0x00,0x80,0xE0,0x60,0x00,0x43,0x02,0x84,0x00,0x1F,0x80,0x3F,
+    0xC0,0x71,0xE0,0xE0,0x60,0xC0,0x03,0x83,0xE0,0xE0,0xC0,0x71,0x80,0x3F,0x00,0x1F,0x43,0x02,0x83,0x80,0x3F,0xC0,0x3F,0xE0,
+    0x30,0x60,0x30,0x00,0x83,0xE0,0x30,0xC0,0x3F,0x00,0x3F,0x00,0x30,0x03,0x43,0x02,0x84,0x00,0x1F,0x80,0x3F,0xC0,0x71,0xE0,
+    0xE0,0x60,0xC0,0x03,0x86,0xC0,0x60,0xC0,0x71,0x80,0x3F,0x00,0x1F,0xC0,0x01,0xF0,0x00,0x20,0x00,0x40,0x02,0x82,0x00,0x7E,
+    0x80,0x7F,0x80,0x61,0x01,0x87,0x80,0x63,0x00,0x7F,0x00,0x7E,0x00,0x67,0x80,0x63,0xC0,0x61,0xE0,0x60,0x70,0x60,0x43,0x02,
+    0x88,0x00,0x1F,0x80,0x3F,0x80,0x60,0x00,0x60,0x00,0x70,0x00,0x3C,0x00,0x1F,0xC0,0x03,0xC0,0x00,0x00,0x82,0xC0,0x61,0x80,
+    0x7F,0x00,0x3F,0x43,0x02,0x80,0xF0,0xFF,0x00,0x80,0x00,0x06,0x09,0x43,0x02,0x80,0xC0,0x60,0x08,0x82,0xC0,0x71,0x80,0x3F,
+    0x00,0x1F,0x43,0x02,0x81,0x30,0xE0,0x60,0x60,0x00,0x81,0x60,0x70,0xC0,0x30,0x00,0x84,0xC0,0x38,0x80,0x19,0x80,0x1D,0x00,
+    0x0D,0x00,0x0F,0x00,0x80,0x00,0x06,0x43,0x02,0x80,0x30,0xC0,0x01,0x80,0x20,0x46,0x00,0x82,0x60,0x47,0x60,0x6F,0x60,0x69,
+    0x00,0x81,0xC0,0x69,0xC0,0x39,0x00,0x80,0xC0,0x30,0x43,0x02,0x8C,0x70,0xE0,0x60,0x70,0xC0,0x30,0x80,0x19,0x00,0x1F,0x00,
+    0x0F,0x00,0x06,0x00,0x0F,0x80,0x1B,0x80,0x19,0xC0,0x30,0xE0,0x60,0x70,0xC0,0x43,0x02,0x85,0x30,0xE0,0x60,0x60,0xC0,0x30,
+    0xC0,0x38,0x80,0x19,0x00,0x0F,0x00,0x80,0x00,0x06,0x04,0x43,0x02,0x80,0xE0,0x7F,0x00,0x89,0x60,0x00,0xC0,0x00,0x80,0x01,
+    0x00,0x03,0x00,0x06,0x00,0x0C,0x00,0x18,0x00,0x30,0x00,0x60,0xE0,0x7F,0x00,0x43,0x00,0x80,0xC0,0x0F,0x00,0x80,0x00,0x0C,
+    0x0C,0x80,0xC0,0x0F,0x00,0x40,0x00,0x81,0x00,0x60,0x00,0x30,0x00,0x80,0x00,0x18,0x01,0x80,0x00,0x0C,0x00,0x80,0x00,0x06,
+    0x00,0x80,0x00,0x03,0x00,0x80,0x80,0x01,0x01,0x80,0xC0,0x00,0x00,0x80,0x60,0x00,0x40,0x00,0x80,0x00,0x3F,0x00,0x80,0x00,
+    0x03,0x0C,0x80,0x00,0x3F,0x00,0x40,0x01,0x80,0x00,0x02,0x00,0x88,0x00,0x07,0x00,0x05,0x00,0x0D,0x80,0x0D,0x80,0x18,0xC0,
+    0x18,0xC0,0x30,0x40,0x30,0x60,0x60,0x46,0x0F,0x80,0xF0,0xFF,0x00,0x41,0x81,0x00,0x06,0x00,0x03,0x51,0x04,0x83,0x80,0x1F,
+    0xC0,0x3F,0xC0,0x20,0xC0,0x00,0x00,0x85,0xC0,0x1F,0xC0,0x30,0xC0,0x60,0xC0,0x61,0xF0,0x7F,0x70,0x3E,0x43,0x00,0x80,0x00,
+    0x60,0x02,0x84,0x00,0x67,0x80,0x6F,0xC0,0x79,0xC0,0x70,0xC0,0x60,0x02,0x82,0x80,0x71,0x80,0x7F,0x00,0x6F,0x43,0x04,0x84,
+    0x80,0x0F,0xC0,0x3F,0x40,0x38,0x00,0x70,0x00,0x60,0x01,0x83,0x00,0x70,0x00,0x38,0xC0,0x3F,0x80,0x0F,0x43,0x00,0x80,0xC0,
+    0x00,0x02,0x83,0xC0,0x1E,0xC0,0x3F,0xC0,0x31,0xC0,0x60,0x03,0x82,0xC0,0x71,0xC0,0x3F,0xC0,0x1C,0x43,0x04,0x84,0x00,0x0F,
+    0x80,0x3F,0xC0,0x31,0xC0,0x60,0xC0,0x7F,0x00,0x80,0x00,0x60,0x00,0x82,0x40,0x30,0xC0,0x3F,0x80,0x0F,0x43,0x00,0x82,0xE0,
+    0x07,0xE0,0x0F,0x00,0x0C,0x00,0x80,0xE0,0x7F,0x00,0x80,0x00,0x0C,0x07,0x43,0x04,0x83,0xC0,0x1E,0xC0,0x3F,0xC0,0x31,0xC0,
+    0x60,0x03,0x86,0xC0,0x71,0xC0,0x3F,0xC0,0x1E,0xC0,0x00,0xC0,0x21,0x80,0x3F,0x00,0x1F,0x00,0x80,0x00,0x60,0x02,0x83,0x80,
+    0x67,0xC0,0x6F,0xC0,0x78,0xC0,0x60,0x06,0x43,0x00,0x80,0x00,0x03,0x00,0x41,0x80,0x00,0x3F,0x00,0x80,0x00,0x03,0x07,0x43,
+    0x00,0x80,0x80,0x01,0x00,0x41,0x80,0x80,0x1F,0x00,0x80,0x80,0x01,0x08,0x82,0x80,0x03,0x00,0x3F,0x00,0x3E,0x00,0x80,0x00,
+    0x30,0x02,0x8A,0xE0,0x30,0xC0,0x31,0x80,0x33,0x00,0x37,0x00,0x36,0x00,0x3E,0x00,0x37,0x80,0x33,0xC0,0x31,0xE0,0x30,0x70,
+    0x30,0x43,0x00,0x80,0x00,0x3F,0x00,0x80,0x00,0x03,0x0B,0x43,0x04,0x83,0xC0,0xD9,0xE0,0xFF,0x60,0xEE,0x60,0xCC,0x06,0x43,
+    0x04,0x83,0x80,0x67,0xC0,0x6F,0xC0,0x78,0xC0,0x60,0x06,0x43,0x04,0x83,0x00,0x0F,0xC0,0x3F,0xC0,0x30,0x60,0x60,0x03,0x82,
+    0xC0,0x30,0xC0,0x3F,0x00,0x0F,0x43,0x04,0x83,0x00,0x6F,0x80,0x7F,0xC0,0x71,0xC0,0x60,0x03,0x83,0x80,0x71,0x80,0x7F,0x00,
+    0x6F,0x00,0x60,0x02,0x04,0x83,0xC0,0x1E,0xC0,0x3F,0xC0,0x31,0xC0,0x60,0x03,0x83,0xC0,0x71,0xC0,0x3E,0xC0,0x1C,0xC0,0x00,
+    0x02,0x04,0x83,0xC0,0x33,0xC0,0x37,0x40,0x3C,0x00,0x30,0x06,0x43,0x04,0x82,0x80,0x1F,0x80,0x3F,0x00,0x30,0x00,0x86,0x00,
+    0x3C,0x80,0x0F,0xC0,0x01,0xC0,0x00,0xC0,0x20,0x80,0x3F,0x00,0x1F,0x43,0x02,0x80,0x00,0x0C,0x00,0x80,0xE0,0x7F,0x00,0x80,
+    0x00,0x0C,0x05,0x81,0xE0,0x0F,0xE0,0x07,0x43,0x04,0x80,0xC0,0x60,0x06,0x82,0xC0,0x63,0xC0,0x7E,0xC0,0x3C,0x43,0x04,0x82,
+    0x60,0x60,0x40,0x30,0xC0,0x30,0x00,0x81,0x80,0x18,0x80,0x19,0x00,0x81,0x00,0x0D,0x00,0x0F,0x00,0x80,0x00,0x06,0x43,0x04,
+    0x81,0x30,0xC0,0x30,0xC6,0x00,0x86,0x20,0x47,0x20,0x6F,0x20,0x69,0x60,0x69,0xE0,0x69,0xC0,0x39,0xC0,0x30,0x00,0x43,0x04,
+    0x8A,0xE0,0x70,0xC0,0x30,0x80,0x19,0x00,0x1D,0x00,0x0F,0x00,0x06,0x00,0x0F,0x80,0x1B,0x80,0x19,0xC0,0x30,0xE0,0x60,0x43,
+    0x04,0x84,0x60,0x60,0x40,0x30,0xC0,0x30,0xC0,0x38,0x80,0x19,0x00,0x81,0x00,0x0D,0x00,0x0F,0x00,0x80,0x00,0x06,0x00,0x83,
+    0x00,0x04,0x00,0x0C,0x00,0x3C,0x00,0x38,0x04,0x80,0xC0,0x7F,0x00,0x87,0xC0,0x00,0x80,0x01,0x00,0x03,0x00,0x06,0x00,0x0C,
+    0x00,0x18,0x00,0x30,0xC0,0x7F,0x00,0x43,0x00,0x82,0xC0,0x03,0xC0,0x07,0x00,0x06,0x04,0x80,0x00,0x3C,0x00,0x80,0x00,0x06,
+    0x04,0x81,0xC0,0x07,0xC0,0x03,0x40,0x00,0x80,0x00,0x06,0x10,0x40,0x00,0x82,0x00,0x3C,0x00,0x3E,0x00,0x06,0x04,0x80,0xC0,
+    0x03,0x00,0x80,0x00,0x06,0x04,0x81,0x00,0x3E,0x00,0x3C,0x40,0x08,0x82,0x20,0x3C,0xE0,0x7F,0xC0,0x43,0x47,0x02,0x81,0xC0,
+    0x3F,0x40,0x20,0x09,0x80,0xC0,0x3F,0x43,0x01,0x8D,0x00,0x02,0x00,0x06,0x00,0x0F,0x80,0x0F,0xC0,0x3F,0xE0,0x7F,0xF0,0xFF,
+    0xE0,0x7F,0xC0,0x3F,0x80,0x1F,0x80,0x0F,0x00,0x07,0x00,0x06,0x00,0x02,0x43,0x80,0xC0,0xCC,0x00,0x41,0x80,0xC0,0xCC,0x00,
+    0x41,0x80,0xC0,0xCC,0x00,0x41,0x80,0xC0,0xCC,0x00,0x41,0x80,0xC0,0xCC,0x00,0x41,0x80,0x00,0x06,0x07,0x80,0x00,0xFE,0x00,
+    0x48,0x08,0x80,0x00,0xFE,0x00,0x80,0x00,0x06,0x07,0x08,0x80,0xF0,0x07,0x00,0x80,0x00,0x06,0x07,0x80,0x00,0x06,0x07,0x80,
+    0xF0,0x07,0x00,0x48,0x80,0x00,0x06,0x07,0x80,0xF0,0xFF,0x00,0x80,0x00,0x06,0x07,0x08,0x80,0xF0,0xFF,0x00,0x48,0x80,0x00,
+    0x06,0x07,0x80,0xF0,0x07,0x00,0x80,0x00,0x06,0x07,0x80,0x00,0x06,0x07,0x80,0x00,0xFE,0x00,0x80,0x00,0x06,0x07,0x08,0x80,
+    0xF0,0xFF,0x00,0x80,0x00,0x06,0x07,0x80,0x00,0x06,0x12,0x04,0x80,0x00,0x06,0x00,0x41,0x80,0x00,0x06,0x09,0x01,0x80,0x00,
+    0x02,0x00,0x83,0xC0,0x0F,0xC0,0x1F,0x40,0x3A,0x00,0x32,0x02,0x83,0x00,0x3A,0xC0,0x1F,0x80,0x0F,0x00,0x02,0x00,0x43,0x01,
+    0x82,0xC0,0x07,0xC0,0x0F,0x00,0x0C,0x01,0x80,0x00,0x3F,0x00,0x80,0x00,0x0C,0x02,0x81,0x00,0x18,0xC0,0x3F,0x00,0x43,0x03,
+    0x84,0x20,0x40,0x40,0x2F,0xC0,0x3F,0xC0,0x39,0xC0,0x30,0x00,0x83,0xC0,0x39,0xC0,0x3F,0x40,0x2F,0x20,0x40,0x45,0x01,0x88,
+    0x30,0xE0,0x60,0x70,0xC0,0x30,0xC0,0x38,0x80,0x1D,0x00,0x0F,0x00,0x06,0xC0,0x3F,0x00,0x06,0x00,0x81,0xC0,0x3F,0x00,0x06,
+    0x01,0x43,0x00,0x80,0x00,0x06,0x05,0x43,0x80,0x00,0x06,0x05,0x40,0x01,0x82,0x80,0x0F,0x80,0x1F,0x00,0x30,0x00,0x8C,0x00,
+    0x38,0x00,0x0F,0x80,0x13,0xC0,0x31,0xC0,0x30,0xC0,0x38,0x80,0x1F,0x80,0x07,0xC0,0x01,0xC0,0x00,0xC0,0x20,0x80,0x3F,0x00,
+    0x1F,0x40,0x80,0x80,0x31,0x00,0x51,0x01,0x85,0x00,0x1F,0x80,0x20,0x40,0x40,0x60,0xCF,0x20,0x90,0x20,0xA0,0x02,0x84,0x20,
+    0x90,0x60,0xCF,0x40,0x40,0x80,0x20,0x00,0x1F,0x43,0x01,0x84,0x00,0x3F,0x80,0x21,0x80,0x01,0x80,0x1F,0x80,0x31,0x00,0x80,
+    0xC0,0x1F,0x4A,0x05,0x88,0x60,0x0C,0xC0,0x18,0x80,0x31,0x00,0x63,0x00,0xC6,0x00,0x63,0x80,0x31,0xC0,0x18,0x60,0x0C,0x44,
+    0x07,0x80,0xE0,0xFF,0x00,0x80,0x60,0x00,0x01,0x46,0x08,0x80,0xC0,0x3F,0x00,0x48,0x01,0x88,0x00,0x1F,0x80,0x31,0xC0,0x6E,
+    0x40,0x4A,0x40,0x4E,0x40,0x4C,0xC0,0x6A,0x80,0x31,0x00,0x1F,0x48,0x80,0xF0,0xFF,0x00,0x51,0x01,0x81,0x00,0x0C,0x00,0x12,
+    0x00,0x80,0x00,0x0C,0x4D,0x04,0x80,0x00,0x06,0x01,0x80,0xE0,0x7F,0x00,0x80,0x00,0x06,0x01,0x40,0x80,0xE0,0x7F,0x00,0x43,
+    0x01,0x81,0x80,0x1F,0xC0,0x00,0x00,0x83,0x80,0x01,0x00,0x06,0x00,0x18,0xC0,0x1F,0x4A,0x01,0x84,0x00,0x1F,0x80,0x11,0x80,
+    0x01,0x00,0x0F,0x80,0x01,0x00,0x80,0x00,0x1F,0x4A,0x81,0x00,0x06,0x00,0x0C,0x51,0x04,0x80,0xC0,0x60,0x06,0x83,0xC0,0x71,
+    0xC0,0x7F,0xC0,0x6E,0x00,0x60,0x02,0x01,0x81,0xC0,0x3F,0x40,0x7C,0x02,0x82,0x40,0x3C,0x40,0x1C,0x40,0x04,0x08,0x40,0x08,
+    0x80,0x00,0x06,0x00,0x48,0x0F,0x83,0x00,0x04,0x00,0x0E,0x00,0x03,0x00,0x0E,0x01,0x81,0x00,0x1E,0x00,0x06,0x04,0x4A,0x01,
+    0x82,0x00,0x0F,0x80,0x19,0xC0,0x30,0x01,0x81,0x80,0x19,0x00,0x0F,0x4A,0x05,0x88,0x00,0xC6,0x00,0x63,0x80,0x31,0xC0,0x18,
+    0x60,0x0C,0xC0,0x18,0x80,0x31,0x00,0x63,0x00,0xC6,0x44,0x01,0x81,0xC0,0xE0,0x80,0x61,0x00,0x81,0x00,0x63,0x00,0x66,0x00,
+    0x87,0x60,0x6C,0xE0,0x0C,0x60,0x19,0x60,0x1A,0x60,0x34,0xF0,0x67,0x60,0x60,0x60,0xC0,0x43,0x01,0x81,0xC0,0xE0,0x80,0x61,
+    0x00,0x81,0x00,0x63,0x00,0x66,0x00,0x82,0xE0,0x6D,0x30,0x0C,0x30,0x18,0x00,0x83,0x60,0x30,0xC0,0x60,0x80,0x61,0xF0,0xC1,
+    0x43,0x01,0x8D,0x30,0xF0,0x60,0x18,0xC0,0x18,0xC0,0x61,0x80,0x19,0x00,0x1B,0xE0,0xF6,0xE0,0x06,0x60,0x0D,0x60,0x1A,0x60,
+    0x3C,0xF0,0x37,0x60,0x60,0x60,0xC0,0x43,0x04,0x80,0x00,0x06,0x00,0x41,0x80,0x00,0x06,0x00,0x84,0x00,0x04,0x00,0x0C,0x00,
+    0x18,0x00,0x30,0x00,0x60,0x00,0x82,0x40,0x70,0xC0,0x3F,0xC0,0x1F,0x81,0x00,0x0C,0x00,0x06,0x40,0x81,0x00,0x06,0x00,0x0F,
+    0x00,0x81,0x00,0x0B,0x80,0x19,0x00,0x84,0xC0,0x31,0xC0,0x30,0xC0,0x3F,0xE0,0x7F,0x60,0x60,0x00,0x80,0x30,0xC0,0x43,0x81,
+    0x00,0x03,0x00,0x06,0x40,0x81,0x00,0x06,0x00,0x0F,0x00,0x81,0x00,0x0B,0x80,0x19,0x00,0x84,0xC0,0x31,0xC0,0x30,0xC0,0x3F,
+    0xE0,0x7F,0x60,0x60,0x00,0x80,0x30,0xC0,0x43,0x81,0x00,0x0E,0x00,0x11,0x40,0x81,0x00,0x06,0x00,0x0F,0x00,0x81,0x00,0x0B,
+    0x80,0x19,0x00,0x84,0xC0,0x31,0xC0,0x30,0xC0,0x3F,0xE0,0x7F,0x60,0x60,0x00,0x80,0x30,0xC0,0x43,0x81,0x40,0x0E,0x80,0x13,
+    0x40,0x81,0x00,0x06,0x00,0x0F,0x00,0x81,0x00,0x0B,0x80,0x19,0x00,0x84,0xC0,0x31,0xC0,0x30,0xC0,0x3F,0xE0,0x7F,0x60,0x60,
+    0x00,0x80,0x30,0xC0,0x43,0x80,0x80,0x31,0x00,0x40,0x81,0x00,0x06,0x00,0x0F,0x00,0x81,0x00,0x0B,0x80,0x19,0x00,0x84,0xC0,
+    0x31,0xC0,0x30,0xC0,0x3F,0xE0,0x7F,0x60,0x60,0x00,0x80,0x30,0xC0,0x43,0x84,0x00,0x06,0x00,0x09,0x00,0x0F,0x00,0x06,0x00,
+    0x0F,0x00,0x81,0x00,0x0B,0x80,0x19,0x00,0x84,0xC0,0x31,0xC0,0x30,0xC0,0x3F,0xE0,0x7F,0x60,0x60,0x00,0x80,0x30,0xC0,0x43,
+    0x02,0x88,0xF0,0x03,0xF0,0x07,0x00,0x07,0x00,0x0F,0x00,0x0B,0xE0,0x1B,0xE0,0x13,0x00,0x33,0x00,0x3F,0x00,0x82,0x00,0x63,
+    0xF0,0x43,0xF0,0xC3,0x43,0x02,0x84,0xC0,0x07,0xE0,0x1F,0x20,0x38,0x00,0x30,0x00,0x60,0x03,0x87,0x00,0x30,0x20,0x3C,0xE0,
+    0x1F,0xC0,0x07,0x00,0x02,0x00,0x07,0x80,0x01,0x00,0x07,0x81,0x00,0x06,0x00,0x03,0x40,0x80,0xE0,0x3F,0x00,0x80,0x00,0x30,
+    0x01,0x80,0xC0,0x3F,0x00,0x80,0x00,0x30,0x02,0x80,0xE0,0x3F,0x00,0x43,0x81,0x00,0x03,0x00,0x06,0x40,0x80,0xE0,0x3F,0x00,
+    0x80,0x00,0x30,0x01,0x80,0xC0,0x3F,0x00,0x80,0x00,0x30,0x02,0x80,0xE0,0x3F,0x00,0x43,0x81,0x00,0x07,0x80,0x08,0x40,0x80,
+    0xE0,0x3F,0x00,0x80,0x00,0x30,0x01,0x80,0xC0,0x3F,0x00,0x80,0x00,0x30,0x02,0x80,0xE0,0x3F,0x00,0x43,0x80,0xC0,0x18,0x00,
+    0x40,0x80,0xE0,0x3F,0x00,0x80,0x00,0x30,0x01,0x80,0xC0,0x3F,0x00,0x80,0x00,0x30,0x02,0x80,0xE0,0x3F,0x00,0x43,0x81,0x00,
+    0x0C,0x00,0x06,0x40,0x80,0x80,0x7F,0x00,0x80,0x00,0x0C,0x07,0x80,0x80,0x7F,0x00,0x43,0x81,0x00,0x03,0x00,0x06,0x40,0x80,
+    0x80,0x7F,0x00,0x80,0x00,0x0C,0x07,0x80,0x80,0x7F,0x00,0x43,0x81,0x00,0x0E,0x00,0x11,0x40,0x80,0x80,0x7F,0x00,0x80,0x00,
+    0x0C,0x07,0x80,0x80,0x7F,0x00,0x43,0x80,0x80,0x31,0x00,0x40,0x80,0x80,0x7F,0x00,0x80,0x00,0x0C,0x07,0x80,0x80,0x7F,0x00,
+    0x43,0x02,0x85,0x00,0x7F,0x80,0x7F,0xC0,0x61,0xE0,0x60,0x60,0x60,0x60,0xF8,0x00,0x80,0x60,0x60,0x00,0x83,0xC0,0x60,0xC0,
+    0x61,0x80,0x7F,0x00,0x7F,0x43,0x81,0x40,0x0E,0x80,0x13,0x40,0x80,0x60,0x70,0x00,0x80,0x60,0x78,0x00,0x85,0x60,0x6C,0x60,
+    0x6E,0x60,0x66,0x60,0x67,0x60,0x63,0xE0,0x61,0x00,0x80,0xE0,0x60,0x00,0x43,0x81,0x00,0x0C,0x00,0x06,0x40,0x84,0x00,0x1F,
+    0x80,0x3F,0xC0,0x71,0xE0,0xE0,0x60,0xC0,0x03,0x83,0xE0,0xE0,0xC0,0x71,0x80,0x3F,0x00,0x1F,0x43,0x81,0x00,0x03,0x00,0x06,
+    0x40,0x84,0x00,0x1F,0x80,0x3F,0xC0,0x71,0xE0,0xE0,0x60,0xC0,0x03,0x83,0xE0,0xE0,0xC0,0x71,0x80,0x3F,0x00,0x1F,0x43,0x81,
+    0x00,0x0E,0x00,0x11,0x40,0x84,0x00,0x1F,0x80,0x3F,0xC0,0x71,0xE0,0xE0,0x60,0xC0,0x03,0x83,0xE0,0xE0,0xC0,0x71,0x80,0x3F,
+    0x00,0x1F,0x43,0x81,0x40,0x0E,0x80,0x13,0x40,0x84,0x00,0x1F,0x80,0x3F,0xC0,0x71,0xE0,0xE0,0x60,0xC0,0x03,0x83,0xE0,0xE0,
+    0xC0,0x71,0x80,0x3F,0x00,0x1F,0x43,0x80,0x80,0x31,0x00,0x40,0x84,0x00,0x1F,0x80,0x3F,0xC0,0x71,0xE0,0xE0,0x60,0xC0,0x03,
+    0x83,0xE0,0xE0,0xC0,0x71,0x80,0x3F,0x00,0x1F,0x43,0x04,0x8A,0x40,0x40,0xE0,0xE0,0xC0,0x71,0x80,0x3B,0x00,0x1F,0x00,0x0E,
+    0x00,0x1F,0x80,0x3B,0xC0,0x71,0xE0,0xE0,0x40,0x40,0x43,0x02,0x8C,0x60,0x1F,0xC0,0x3F,0xC0,0x71,0xC0,0xE1,0x60,0xC3,0x60,
+    0xC2,0x60,0xC4,0x60,0xC8,0x60,0xD8,0xE0,0x70,0xC0,0x71,0x80,0x7F,0x00,0xDF,0x43,0x81,0x00,0x0C,0x00,0x06,0x40,0x80,0xC0,
+    0x60,0x08,0x82,0xC0,0x71,0x80,0x3F,0x00,0x1F,0x43,0x81,0x00,0x03,0x00,0x06,0x40,0x80,0xC0,0x60,0x08,0x82,0xC0,0x71,0x80,
+    0x3F,0x00,0x1F,0x43,0x81,0x00,0x0E,0x00,0x11,0x40,0x80,0xC0,0x60,0x08,0x82,0xC0,0x71,0x80,0x3F,0x00,0x1F,0x43,0x80,0x80,
+    0x31,0x00,0x40,0x80,0xC0,0x60,0x08,0x82,0xC0,0x71,0x80,0x3F,0x00,0x1F,0x43,0x81,0x00,0x03,0x00,0x06,0x40,0x85,0x30,0xE0,
+    0x60,0x60,0xC0,0x30,0xC0,0x38,0x80,0x19,0x00,0x0F,0x00,0x80,0x00,0x06,0x04,0x43,0x02,0x80,0x00,0x60,0x01,0x83,0x00,0x7F,
+    0x80,0x7F,0xC0,0x61,0xC0,0x60,0x00,0x83,0xC0,0x61,0x80,0x7F,0x00,0x7E,0x00,0x60,0x00,0x43,0x00,0x82,0x00,0x3F,0x80,0x7F,
+    0x80,0x61,0x00,0x80,0x00,0x63,0x00,0x88,0x00,0x66,0x00,0x67,0x80,0x63,0xC0,0x61,0xE0,0x60,0x60,0x60,0x60,0x64,0xE0,0x67,
+    0xC0,0x63,0x43,0x82,0x00,0x18,0x00,0x0C,0x00,0x06,0x41,0x83,0x80,0x1F,0xC0,0x3F,0xC0,0x20,0xC0,0x00,0x00,0x85,0xC0,0x1F,
+    0xC0,0x30,0xC0,0x60,0xC0,0x61,0xF0,0x7F,0x70,0x3E,0x43,0x82,0x80,0x01,0x00,0x03,0x00,0x06,0x41,0x83,0x80,0x1F,0xC0,0x3F,
+    0xC0,0x20,0xC0,0x00,0x00,0x85,0xC0,0x1F,0xC0,0x30,0xC0,0x60,0xC0,0x61,0xF0,0x7F,0x70,0x3E,0x43,0x82,0x00,0x07,0x80,0x0D,
+    0xC0,0x18,0x41,0x83,0x80,0x1F,0xC0,0x3F,0xC0,0x20,0xC0,0x00,0x00,0x85,0xC0,0x1F,0xC0,0x30,0xC0,0x60,0xC0,0x61,0xF0,0x7F,
+    0x70,0x3E,0x43,0x00,0x81,0x40,0x0E,0x80,0x13,0x41,0x83,0x80,0x1F,0xC0,0x3F,0xC0,0x20,0xC0,0x00,0x00,0x85,0xC0,0x1F,0xC0,
+    0x30,0xC0,0x60,0xC0,0x61,0xF0,0x7F,0x70,0x3E,0x43,0x00,0x80,0x80,0x19,0x00,0x41,0x83,0x80,0x1F,0xC0,0x3F,0xC0,0x20,0xC0,
+    0x00,0x00,0x85,0xC0,0x1F,0xC0,0x30,0xC0,0x60,0xC0,0x61,0xF0,0x7F,0x70,0x3E,0x43,0x80,0x00,0x09,0x00,0x80,0x00,0x06,0x41,
+    0x83,0x80,0x1F,0xC0,0x3F,0xC0,0x20,0xC0,0x00,0x00,0x85,0xC0,0x1F,0xC0,0x30,0xC0,0x60,0xC0,0x61,0xF0,0x7F,0x70,0x3E,0x43,
+    0x04,0x83,0xC0,0x7D,0xE0,0x7F,0x30,0x07,0x30,0x06,0x00,0x82,0xF0,0x3F,0xF0,0x67,0x00,0xC6,0x00,0x81,0xF0,0xFF,0xE0,0x79,
+    0x43,0x04,0x84,0x80,0x0F,0xC0,0x3F,0x40,0x38,0x00,0x70,0x00,0x60,0x01,0x87,0x00,0x70,0x00,0x38,0xC0,0x3F,0x80,0x0F,0x00,
+    0x04,0x00,0x0E,0x00,0x03,0x00,0x0E,0x82,0x00,0x0C,0x00,0x06,0x00,0x03,0x41,0x84,0x00,0x0F,0x80,0x3F,0xC0,0x31,0xC0,0x60,
+    0xC0,0x7F,0x00,0x80,0x00,0x60,0x00,0x82,0x40,0x30,0xC0,0x3F,0x80,0x0F,0x43,0x82,0x80,0x01,0x00,0x03,0x00,0x06,0x41,0x84,
+    0x00,0x0F,0x80,0x3F,0xC0,0x31,0xC0,0x60,0xC0,0x7F,0x00,0x80,0x00,0x60,0x00,0x82,0x40,0x30,0xC0,0x3F,0x80,0x0F,0x43,0x82,
+    0x00,0x07,0x80,0x0D,0xC0,0x18,0x41,0x84,0x00,0x0F,0x80,0x3F,0xC0,0x31,0xC0,0x60,0xC0,0x7F,0x00,0x80,0x00,0x60,0x00,0x82,
+    0x40,0x30,0xC0,0x3F,0x80,0x0F,0x43,0x00,0x80,0xC0,0x0C,0x00,0x41,0x84,0x00,0x0F,0x80,0x3F,0xC0,0x31,0xC0,0x60,0xC0,0x7F,
+    0x00,0x80,0x00,0x60,0x00,0x82,0x40,0x30,0xC0,0x3F,0x80,0x0F,0x43,0x82,0x00,0x0C,0x00,0x06,0x00,0x03,0x41,0x80,0x00,0x3F,
+    0x00,0x80,0x00,0x03,0x07,0x43,0x82,0x80,0x01,0x00,0x03,0x00,0x06,0x41,0x80,0x00,0x3F,0x00,0x80,0x00,0x03,0x07,0x43,0x82,
+    0x80,0x03,0xC0,0x06,0x60,0x0C,0x41,0x80,0x00,0x3F,0x00,0x80,0x00,0x03,0x07,0x43,0x00,0x80,0x80,0x19,0x00,0x41,0x80,0x00,
+    0x3F,0x00,0x80,0x00,0x03,0x07,0x43,0x00,0x87,0x00,0x7B,0x00,0x7E,0x00,0x0F,0x80,0x13,0xC0,0x0F,0xC0,0x3F,0xE0,0x30,0x60,
+    0x60,0x03,0x82,0xC0,0x30,0xC0,0x3F,0x00,0x0F,0x43,0x00,0x81,0x40,0x0E,0x80,0x13,0x41,0x83,0x80,0x67,0xC0,0x6F,0xC0,0x78,
+    0xC0,0x60,0x06,0x43,0x82,0x00,0x18,0x00,0x0C,0x00,0x06,0x41,0x83,0x00,0x0F,0xC0,0x3F,0xC0,0x30,0x60,0x60,0x03,0x82,0xC0,
+    0x30,0xC0,0x3F,0x00,0x0F,0x43,0x82,0x80,0x01,0x00,0x03,0x00,0x06,0x41,0x83,0x00,0x0F,0xC0,0x3F,0xC0,0x30,0x60,0x60,0x03,
+    0x82,0xC0,0x30,0xC0,0x3F,0x00,0x0F,0x43,0x82,0x00,0x07,0x80,0x0D,0xC0,0x18,0x41,0x83,0x00,0x0F,0xC0,0x3F,0xC0,0x30,0x60,
+    0x60,0x03,0x82,0xC0,0x30,0xC0,0x3F,0x00,0x0F,0x43,0x00,0x81,0x40,0x0E,0x80,0x13,0x41,0x83,0x00,0x0F,0xC0,0x3F,0xC0,0x30,
+    0x60,0x60,0x03,0x82,0xC0,0x30,0xC0,0x3F,0x00,0x0F,0x43,0x00,0x80,0x80,0x19,0x00,0x41,0x83,0x00,0x0F,0xC0,0x3F,0xC0,0x30,
+    0x60,0x60,0x03,0x82,0xC0,0x30,0xC0,0x3F,0x00,0x0F,0x43,0x04,0x80,0x00,0x06,0x00,0x41,0x80,0xE0,0x7F,0x00,0x42,0x80,0x00,
+    0x06,0x00,0x43,0x04,0x8A,0x60,0x0F,0xC0,0x3F,0xC0,0x30,0xE0,0x61,0x60,0x63,0x60,0x66,0x60,0x6C,0x60,0x78,0xC0,0x30,0xC0,
+    0x3F,0x00,0x6F,0x43,0x82,0x00,0x18,0x00,0x0C,0x00,0x06,0x41,0x80,0xC0,0x60,0x06,0x82,0xC0,0x63,0xC0,0x7E,0xC0,0x3C,0x43,
+    0x82,0x80,0x01,0x00,0x03,0x00,0x06,0x41,0x80,0xC0,0x60,0x06,0x82,0xC0,0x63,0xC0,0x7E,0xC0,0x3C,0x43,0x82,0x00,0x07,0x80,
+    0x0D,0xC0,0x18,0x41,0x80,0xC0,0x60,0x06,0x82,0xC0,0x63,0xC0,0x7E,0xC0,0x3C,0x43,0x00,0x80,0x80,0x19,0x00,0x41,0x80,0xC0,
+    0x60,0x06,0x82,0xC0,0x63,0xC0,0x7E,0xC0,0x3C,0x43,0x82,0x80,0x01,0x00,0x03,0x00,0x06,0x41,0x84,0x60,0x60,0x40,0x30,0xC0,
+    0x30,0xC0,0x38,0x80,0x19,0x00,0x81,0x00,0x0D,0x00,0x0F,0x00,0x80,0x00,0x06,0x00,0x83,0x00,0x04,0x00,0x0C,0x00,0x3C,0x00,
+    0x38,0x00,0x80,0x00,0x60,0x02,0x83,0x00,0x67,0x80,0x6F,0xC0,0x71,0xC0,0x60,0x03,0x83,0x80,0x71,0x80,0x7F,0x00,0x6F,0x00,
+    0x60,0x02,0x00,0x80,0x80,0x19,0x00,0x41,0x84,0x60,0x60,0x40,0x30,0xC0,0x30,0xC0,0x38,0x80,0x19,0x00,0x81,0x00,0x0D,0x00,
+    0x0F,0x00,0x80,0x00,0x06,0x00,0x83,0x00,0x04,0x00,0x0C,0x00,0x3C,0x00,0x38,
+};
+
+static const FONT_PACKED font_12x20 = { 12, 20, 6, font_ranges_12x20, font_offsets_12x20, font_data_12x20 };
+
+static const FONT_RANGE font_ranges_16x26[6] =
+{
+    { 0x21, 0x81,   0 },
+    { 0x8A, 0x8E,  97 },
+    { 0x91, 0x91, 102 },
+    { 0x94, 0x95, 103 },
+    { 0x97, 0x98, 105 },
+    { 0xA1, 0xFF, 107 },
+};
+
+static const uint16_t font_offsets_16x26[203] =
+{
+        0,    11,    21,    53,    94,   135,   174,   184,   219,   254,   277,   291,   306,   312,   318,   369,
+      396,   414,   450,   487,   521,   552,   591,   629,   666,   705,   716,   736,   767,   778,   809,   842,
+      883,   918,   951,   978,  1005,  1027,  1045,  1078,  1092,  1106,  1123,  1158,  1168,  1194,  1228,  1255,
+     1279,  1314,  1347,  1380,  1390,  1405,  1440,  1468,  1503,  1527,  1561,  1575,  1626,  1640,  1673,  1679,
+     1687,  1716,  1743,  1768,  1795,  1826,  1846,  1878,  1896,  1911,  1932,  1967,  1977,  1993,  2007,  2030,
+     2055,  2080,  2094,  2125,  2146,  2161,  2192,  2223,  2254,  2294,  2324,  2363,  2369,  2408,  2419,  2430,
+     2471,  2496,  2505,  2514,  2523,  2532,  2544,  2550,  2562,  2574,  2583,  2587,  2597,  2627,  2655,  2678,
+     2714,  2725,  2774,  2779,  2814,  2837,  2864,  2874,  2880,  2905,  2910,  2921,  2940,  2962,  2985,  2993,
+     3010,  3030,  3036,  3048,  3058,  3077,  3104,  3145,  3186,  3227,  3260,  3302,  3344,  3386,  3428,  3467,
+     3509,  3544,  3580,  3609,  3638,  3667,  3693,  3714,  3735,  3756,  3774,  3809,  3850,  3884,  3918,  3952,
+     3986,  4017,  4048,  4083,  4105,  4127,  4149,  4168,  4199,  4227,  4268,  4307,  4346,  4385,  4422,  4456,
+     4494,  4523,  4557,  4598,  4639,  4680,  4716,  4736,  4756,  4776,  4791,  4826,  4848,  4881,  4914,  4947,
+     4978,  5006,  5022,  5053,  5078,  5103,  5128,  5148,  5198,  5227,  5272,
+};
+
+static const uint8_t font_data_16x26[5272] =
+{
+    0x01,0x80,0xC0,0x01,0x0C,0x41,0x80,0xC0,0x01,0x01,0x44,0x00,0x80,0x70,0x1C,0x03,0x80,0x20,0x08,0x00,0x51,0x01,0x80,0x8C,
+    0x01,0x00,0x80,0x18,0x03,0x02,0x80,0xFE,0x3F,0x00,0x83,0x30,0x06,0x60,0x06,0x60,0x0C,0xFC,0x7F,0x00,0x80,0xC0,0x18,0x02,
+    0x80,0x80,0x31,0x00,0x44,0x80,0xC0,0x00,0x00,0x83,0xF8,0x03,0xFC,0x0F,0xC4,0x0E,0xC0,0x1C,0x01,0x84,0xC0,0x1E,0xC0,0x0F,
+    0xC0,0x07,0xE0,0x01,0xF8,0x00,0x00,0x80,0xDC,0x00,0x02,0x83,0xD8,0x18,0xF8,0x1F,0xF0,0x07,0xC0,0x00,0x00,0x42,0x01,0x83,
+    0x03,0x3C,0x06,0x66,0x0C,0xC3,0x18,0xC3,0x00,0x89,0x30,0xC3,0x60,0xC3,0xC0,0x66,0xC0,0x3C,0x80,0x01,0x3C,0x03,0x66,0x03,
+    0xC3,0x06,0xC3,0x0C,0xC3,0x18,0x00,0x82,0xC3,0x30,0x66,0x60,0x3C,0xC0,0x44,0x01,0x82,0xC0,0x07,0xE0,0x0F,0x70,0x1C,0x01,
+    0x8D,0x60,0x1C,0xE0,0x0E,0x80,0x0F,0x00,0x1F,0x07,0x3F,0x87,0x73,0xC7,0xE3,0xC6,0xE1,0xE6,0xE0,0x7E,0xE0,0x7C,0xF0,0x3C,
+    0x78,0xFE,0x3F,0xCF,0x0F,0x44,0x00,0x80,0x80,0x03,0x03,0x80,0x00,0x01,0x00,0x51,0x00,0x85,0x18,0x00,0x78,0x00,0xF0,0x00,
+    0xC0,0x01,0x80,0x03,0x00,0x07,0x01,0x80,0x00,0x0E,0x06,0x80,0x00,0x07,0x01,0x84,0x80,0x03,0xC0,0x01,0xF0,0x00,0x78,0x00,
+    0x18,0x00,0x40,0x00,0x85,0x00,0x30,0x00,0x3C,0x00,0x1E,0x00,0x07,0x80,0x03,0xC0,0x01,0x01,0x80,0xE0,0x00,0x06,0x80,0xC0,
+    0x01,0x01,0x84,0x80,0x03,0x00,0x07,0x00,0x1E,0x00,0x3C,0x00,0x30,0x40,0x01,0x80,0xC0,0x01,0x01,0x87,0xD8,0x19,0x7C,0x3E,
+    0x30,0x0C,0x40,0x02,0xE0,0x07,0x70,0x0E,0x38,0x1C,0x20,0x04,0x4C,0x06,0x80,0x80,0x01,0x04,0x80,0xFE,0x7F,0x00,0x80,0x80,
+    0x01,0x04,0x44,0x10,0x80,0xC0,0x03,0x02,0x83,0xC0,0x00,0xC0,0x01,0x80,0x01,0x00,0x03,0x40,0x0B,0x80,0xF8,0x1F,0x00,0x4B,
+    0x10,0x80,0xC0,0x03,0x02,0x44,0x00,0x81,0x06,0x00,0x0C,0x00,0x00,0x80,0x18,0x00,0x00,0x80,0x30,0x00,0x00,0x80,0x60,0x00,
+    0x00,0x80,0xC0,0x00,0x00,0x80,0x80,0x01,0x00,0x80,0x00,0x03,0x00,0x80,0x00,0x06,0x00,0x80,0x00,0x0C,0x00,0x80,0x00,0x18,
+    0x00,0x80,0x00,0x30,0x00,0x80,0x00,0x60,0x40,0x01,0x83,0xC0,0x07,0xE0,0x0F,0x70,0x1C,0x38,0x38,0x00,0x80,0x1C,0x70,0x07,
+    0x80,0x38,0x38,0x00,0x82,0x70,0x1C,0xE0,0x0F,0xC0,0x07,0x44,0x01,0x84,0xC0,0x00,0xC0,0x07,0xC0,0x3F,0xC0,0x31,0xC0,0x01,
+    0x0B,0x80,0xFE,0x3F,0x00,0x44,0x01,0x83,0xC0,0x0F,0xE0,0x3F,0x70,0x30,0x38,0x00,0x02,0x80,0x70,0x00,0x00,0x88,0xE0,0x00,
+    0xC0,0x01,0x80,0x03,0x00,0x07,0x00,0x0E,0x00,0x0C,0x00,0x1C,0x00,0x38,0xF8,0x3F,0x00,0x44,0x01,0x83,0xC0,0x0F,0xF0,0x1F,
+    0x78,0x10,0x38,0x00,0x01,0x86,0x30,0x00,0x60,0x00,0xC0,0x07,0xE0,0x07,0xF0,0x00,0x78,0x00,0x38,0x00,0x01,0x83,0x78,0x00,
+    0xF0,0x10,0xE0,0x1F,0xC0,0x1F,0x44,0x01,0x82,0x70,0x00,0xF0,0x00,0xF0,0x01,0x00,0x84,0x70,0x03,0x70,0x07,0x70,0x06,0x70,
+    0x0C,0x70,0x18,0x00,0x82,0x70,0x30,0x70,0x60,0xFE,0x7F,0x00,0x80,0x70,0x00,0x03,0x44,0x01,0x80,0xFC,0x0F,0x01,0x80,0x00,
+    0x0C,0x03,0x84,0xC0,0x0F,0xF0,0x0F,0x78,0x00,0x3C,0x00,0x1C,0x00,0x01,0x83,0x3C,0x00,0x78,0x08,0xF0,0x0F,0xC0,0x0F,0x44,
+    0x01,0x84,0xF8,0x01,0xFC,0x07,0x04,0x0F,0x00,0x0E,0x00,0x1C,0x00,0x85,0x00,0x38,0xF0,0x39,0xF8,0x3B,0x3C,0x3E,0x1E,0x3C,
+    0x0E,0x38,0x01,0x84,0x0E,0x1C,0x1C,0x1C,0x1C,0x0E,0xF8,0x0F,0xE0,0x03,0x44,0x01,0x80,0xFC,0x1F,0x01,0x80,0x18,0x00,0x00,
+    0x80,0x30,0x00,0x00,0x83,0x60,0x00,0x40,0x00,0xC0,0x00,0x80,0x01,0x00,0x80,0x00,0x03,0x00,0x80,0x00,0x06,0x00,0x81,0x00,
+    0x0E,0x00,0x0C,0x00,0x44,0x01,0x83,0xE0,0x03,0xF0,0x0F,0x78,0x1E,0x38,0x1C,0x01,0x87,0x30,0x1E,0xF0,0x0F,0xC0,0x07,0xF0,
+    0x0F,0xF8,0x1C,0x78,0x18,0x3C,0x38,0x1C,0x38,0x01,0x82,0x38,0x1C,0xF0,0x0F,0xE0,0x07,0x44,0x01,0x85,0xE0,0x03,0xF8,0x0F,
+    0x38,0x1C,0x1C,0x1C,0x1C,0x38,0x0E,0x38,0x01,0x85,0x1E,0x3C,0x3E,0x1E,0xEE,0x0F,0xCE,0x07,0x0E,0x00,0x1C,0x00,0x00,0x83,
+    0x38,0x00,0x78,0x10,0xF0,0x1F,0xC0,0x0F,0x44,0x06,0x80,0xC0,0x03,0x02,0x45,0x80,0xC0,0x03,0x02,0x44,0x06,0x80,0xC0,0x03,
+    0x02,0x45,0x80,0xC0,0x03,0x02,0x83,0xC0,0x00,0xC0,0x01,0x80,0x01,0x00,0x03,0x40,0x06,0x86,0x02,0x00,0x0E,0x00,0x3C,0x00,
+    0xF0,0x00,0xC0,0x03,0x00,0x0F,0x00,0x3C,0x00,0x85,0x00,0x0F,0xC0,0x03,0xF0,0x00,0x3C,0x00,0x0E,0x00,0x02,0x00,0x44,0x09,
+    0x80,0xFE,0x7F,0x00,0x42,0x80,0xFE,0x7F,0x00,0x48,0x06,0x86,0x00,0x40,0x00,0x70,0x00,0x3C,0x00,0x0F,0xC0,0x03,0xF0,0x00,
+    0x3C,0x00,0x00,0x85,0xF0,0x00,0xC0,0x03,0x00,0x0F,0x00,0x3C,0x00,0x70,0x00,0x40,0x44,0x01,0x84,0xE0,0x1F,0xF8,0x3F,0x3C,
+    0x30,0x1C,0x30,0x1C,0x00,0x00,0x85,0x38,0x00,0x78,0x00,0xF0,0x00,0xE0,0x01,0xC0,0x01,0x80,0x03,0x01,0x41,0x80,0x80,0x03,
+    0x01,0x44,0x01,0x87,0xF0,0x03,0xF8,0x07,0x1C,0x0E,0x0C,0x18,0x7C,0x38,0x8C,0x30,0x8C,0x71,0x0C,0x63,0x00,0x80,0x1C,0x63,
+    0x00,0x87,0x3C,0x63,0x2C,0x63,0xEF,0x71,0xCF,0x31,0x00,0x38,0x10,0x1C,0xF0,0x0F,0xE0,0x03,0x44,0x04,0x83,0x80,0x03,0xC0,
+    0x03,0xC0,0x07,0xE0,0x06,0x00,0x85,0x60,0x0E,0x70,0x0C,0x70,0x1C,0x38,0x1C,0x38,0x18,0xFC,0x3F,0x00,0x81,0x1C,0x70,0x0E,
+    0x70,0x00,0x80,0x07,0xE0,0x44,0x04,0x83,0xE0,0x3F,0xF0,0x3F,0x78,0x38,0x38,0x38,0x00,0x81,0x70,0x38,0xE0,0x3F,0x00,0x82,
+    0x78,0x38,0x3C,0x38,0x1C,0x38,0x01,0x82,0x3C,0x38,0xF8,0x3F,0xE0,0x3F,0x44,0x04,0x85,0xF8,0x03,0xFC,0x0F,0x0C,0x1E,0x00,
+    0x3C,0x00,0x38,0x00,0x70,0x04,0x84,0x00,0x38,0x00,0x3C,0x04,0x1E,0xFC,0x0F,0xF8,0x03,0x44,0x04,0x85,0xE0,0x3F,0xF0,0x3F,
+    0x3C,0x38,0x1C,0x38,0x1E,0x38,0x0E,0x38,0x04,0x80,0x1C,0x38,0x00,0x82,0x78,0x38,0xF0,0x3F,0xC0,0x3F,0x44,0x04,0x80,0xFC,
+    0x1F,0x00,0x80,0x00,0x1C,0x03,0x80,0xF8,0x1F,0x00,0x80,0x00,0x1C,0x03,0x80,0xFE,0x1F,0x00,0x44,0x04,0x80,0xFE,0x1F,0x00,
+    0x80,0x00,0x1C,0x03,0x80,0xFC,0x1F,0x00,0x80,0x00,0x1C,0x05,0x44,0x04,0x85,0xF8,0x03,0xFC,0x0F,0x0C,0x1E,0x00,0x3C,0x00,
+    0x38,0x00,0x70,0x01,0x80,0xFC,0x70,0x00,0x85,0x1C,0x70,0x1C,0x38,0x1C,0x3C,0x1C,0x1E,0xFC,0x0F,0xF8,0x03,0x44,0x04,0x80,
+    0x1C,0x38,0x05,0x80,0xFC,0x3F,0x00,0x80,0x1C,0x38,0x05,0x44,0x04,0x80,0xF8,0x3F,0x00,0x80,0x80,0x03,0x0A,0x80,0xF8,0x3F,
+    0x00,0x44,0x04,0x80,0xF0,0x1F,0x00,0x80,0x70,0x00,0x09,0x82,0xE0,0x20,0xC0,0x3F,0x80,0x3F,0x44,0x04,0x8F,0x1E,0x38,0x3C,
+    0x38,0x78,0x38,0xF0,0x38,0xE0,0x38,0xC0,0x39,0x80,0x3B,0x00,0x3F,0x80,0x3B,0xC0,0x3B,0xE0,0x39,0xF0,0x38,0x78,0x38,0x3C,
+    0x38,0x1E,0x38,0x1F,0x38,0x44,0x04,0x80,0x00,0x1C,0x0C,0x80,0xFC,0x1F,0x00,0x44,0x04,0x81,0x1C,0x70,0x3C,0x78,0x01,0x80,
+    0x6C,0x6C,0x01,0x81,0x4C,0x66,0xCC,0x66,0x00,0x80,0x8C,0x63,0x01,0x80,0x0C,0x60,0x01,0x44,0x04,0x80,0x0C,0x38,0x00,0x81,
+    0x0C,0x3C,0x0C,0x3E,0x00,0x86,0x0C,0x3F,0x8C,0x37,0x8C,0x33,0xCC,0x33,0xEC,0x31,0xFC,0x30,0x7C,0x30,0x00,0x81,0x3C,0x30,
+    0x1C,0x30,0x00,0x44,0x04,0x83,0xE0,0x07,0xF0,0x0F,0x38,0x1C,0x1C,0x38,0x00,0x80,0x0E,0x70,0x04,0x80,0x1C,0x38,0x00,0x82,
+    0x38,0x1C,0xF0,0x0F,0xE0,0x07,0x44,0x04,0x83,0xF8,0x1F,0xFC,0x1F,0x1E,0x1C,0x0E,0x1C,0x01,0x84,0x1E,0x1C,0x3C,0x1C,0xF8,
+    0x1F,0xE0,0x1F,0x00,0x1C,0x04,0x44,0x04,0x83,0xE0,0x07,0xF0,0x0F,0x38,0x1C,0x1C,0x38,0x00,0x80,0x0E,0x70,0x04,0x80,0x1C,
+    0x38,0x00,0x86,0x38,0x1C,0xF0,0x0F,0xE0,0x07,0x78,0x00,0x1E,0x00,0x0F,0x00,0x02,0x00,0x40,0x04,0x83,0xE0,0x3F,0xF0,0x3F,
+    0x78,0x38,0x38,0x38,0x01,0x89,0x70,0x38,0xE0,0x3F,0xC0,0x3F,0xE0,0x39,0xE0,0x38,0xF0,0x38,0x78,0x38,0x3C,0x38,0x1C,0x38,
+    0x1E,0x38,0x44,0x04,0x83,0xF0,0x07,0xF8,0x1F,0x18,0x3C,0x00,0x38,0x00,0x85,0x00,0x3C,0x00,0x1F,0xE0,0x0F,0xF8,0x03,0x7C,
+    0x00,0x1C,0x00,0x01,0x82,0x38,0x30,0xF8,0x3F,0xE0,0x0F,0x44,0x04,0x80,0xFE,0xFF,0x00,0x80,0x80,0x03,0x0C,0x44,0x04,0x80,
+    0x0E,0x38,0x0A,0x83,0x1E,0x3C,0x1C,0x1C,0xF8,0x0F,0xF0,0x07,0x44,0x04,0x81,0x07,0xE0,0x0E,0x70,0x00,0x87,0x0E,0x38,0x1C,
+    0x38,0x1C,0x3C,0x1C,0x1C,0x38,0x1C,0x38,0x0E,0x30,0x0E,0x70,0x07,0x00,0x81,0xE0,0x07,0xE0,0x03,0x00,0x80,0xC0,0x01,0x44,
+    0x04,0x80,0x03,0xC0,0x00,0x82,0x03,0xE0,0x86,0x61,0xC6,0x63,0x02,0x81,0x6E,0x72,0x6C,0x36,0x01,0x82,0x7C,0x34,0x3C,0x3C,
+    0x38,0x3C,0x00,0x44,0x04,0x86,0x07,0x78,0x0E,0x3C,0x1C,0x1E,0x38,0x1E,0x70,0x0F,0xE0,0x07,0xC0,0x03,0x00,0x87,0xE0,0x03,
+    0xE0,0x07,0xF0,0x06,0x78,0x0C,0x3C,0x18,0x1C,0x38,0x1E,0x70,0x0F,0xE0,0x44,0x04,0x87,0x07,0xE0,0x0E,0x70,0x0C,0x38,0x18,
+    0x38,0x38,0x1C,0x70,0x1E,0xE0,0x0E,0xC0,0x07,0x00,0x80,0x80,0x03,0x05,0x44,0x04,0x80,0xFC,0x3F,0x00,0x8C,0x1C,0x00,0x38,
+    0x00,0x70,0x00,0xE0,0x00,0xC0,0x01,0x80,0x01,0x00,0x03,0x00,0x07,0x00,0x0E,0x00,0x1C,0x00,0x38,0x00,0x70,0xFC,0x7F,0x00,
+    0x44,0x00,0x80,0xFC,0x03,0x00,0x80,0x80,0x03,0x12,0x80,0xFC,0x03,0x00,0x40,0x00,0x81,0x00,0x60,0x00,0x30,0x00,0x80,0x00,
+    0x18,0x00,0x80,0x00,0x0C,0x00,0x80,0x00,0x06,0x00,0x80,0x00,0x03,0x00,0x80,0x80,0x01,0x00,0x80,0xC0,0x00,0x00,0x80,0x60,
+    0x00,0x00,0x80,0x30,0x00,0x00,0x80,0x18,0x00,0x00,0x80,0x0C,0x00,0x00,0x80,0x06,0x00,0x40,0x00,0x80,0xC0,0x3F,0x00,0x80,
+    0xC0,0x01,0x12,0x80,0xC0,0x3F,0x00,0x40,0x01,0x80,0x80,0x00,0x00,0x80,0xC0,0x01,0x00,0x86,0xC0,0x03,0x60,0x03,0x60,0x07,
+    0x30,0x06,0x30,0x0C,0x18,0x0C,0x18,0x18,0x00,0x80,0x0C,0x30,0x00,0x80,0x06,0x60,0x48,0x14,0x80,0xFF,0xFF,0x00,0x42,0x82,
+    0x80,0x03,0xC0,0x01,0xE0,0x00,0x56,0x06,0x83,0xE0,0x07,0xF0,0x1F,0x78,0x18,0x38,0x00,0x00,0x83,0xF8,0x07,0xF8,0x0F,0x38,
+    0x1C,0x38,0x38,0x01,0x82,0x78,0x3C,0xDE,0x1F,0x1E,0x0F,0x44,0x00,0x80,0x00,0x38,0x04,0x84,0xE0,0x39,0xF8,0x3B,0x38,0x3E,
+    0x1C,0x3C,0x1C,0x38,0x04,0x83,0x38,0x38,0x78,0x3C,0xF0,0x3F,0xE0,0x33,0x44,0x06,0x84,0xF8,0x03,0xFC,0x0F,0x04,0x1E,0x00,
+    0x1C,0x00,0x38,0x03,0x84,0x00,0x3C,0x00,0x1C,0x04,0x1F,0xFC,0x0F,0xF8,0x03,0x44,0x00,0x80,0x0E,0x00,0x04,0x84,0xCE,0x03,
+    0xFE,0x0F,0x3E,0x1E,0x0E,0x1C,0x0E,0x38,0x04,0x83,0x1E,0x3C,0x3E,0x1C,0xEE,0x0F,0xCE,0x07,0x44,0x06,0x84,0xE0,0x03,0xF0,
+    0x0F,0x38,0x1E,0x1C,0x1C,0x1C,0x38,0x00,0x80,0xFC,0x3F,0x00,0x80,0x00,0x38,0x00,0x83,0x00,0x1C,0x04,0x1E,0xFC,0x0F,0xF8,
+    0x03,0x44,0x00,0x83,0xFF,0x00,0xFF,0x01,0xC0,0x03,0x80,0x03,0x01,0x80,0xFE,0x3F,0x00,0x80,0x80,0x03,0x0A,0x44,0x06,0x84,
+    0xCE,0x03,0xFE,0x0F,0x3E,0x1E,0x0E,0x1C,0x0E,0x38,0x04,0x88,0x1E,0x3C,0x3E,0x1C,0xEE,0x0F,0xCE,0x07,0x0E,0x00,0x1C,0x00,
+    0x3C,0x18,0xF8,0x1F,0xE0,0x0F,0x00,0x80,0x00,0x38,0x04,0x84,0xF0,0x38,0xF8,0x3B,0x3C,0x3E,0x1C,0x3C,0x1C,0x38,0x08,0x44,
+    0x00,0x80,0xC0,0x01,0x01,0x42,0x80,0xC0,0x3F,0x00,0x80,0xC0,0x01,0x0A,0x44,0x00,0x80,0x70,0x00,0x01,0x42,0x80,0xF0,0x1F,
+    0x00,0x80,0x70,0x00,0x0C,0x82,0xE0,0x20,0xE0,0x3F,0x80,0x1F,0x00,0x80,0x00,0x1C,0x04,0x8D,0x3C,0x1C,0x78,0x1C,0x70,0x1C,
+    0xF0,0x1C,0xE0,0x1D,0xC0,0x1D,0xC0,0x1F,0xC0,0x1D,0xE0,0x1D,0xF0,0x1C,0x70,0x1C,0x78,0x1C,0x3C,0x1C,0x1E,0x1C,0x44,0x00,
+    0x80,0xE0,0x1F,0x00,0x80,0xE0,0x00,0x10,0x44,0x06,0x85,0x8C,0x73,0x9E,0x77,0xFE,0x7F,0xEE,0x79,0xCE,0x79,0xCE,0x71,0x07,
+    0x44,0x06,0x84,0xF0,0x38,0xF8,0x3B,0x3C,0x3E,0x1C,0x3C,0x1C,0x38,0x08,0x44,0x06,0x84,0xC0,0x07,0xF0,0x1F,0x78,0x3C,0x38,
+    0x38,0x1C,0x70,0x04,0x83,0x38,0x38,0x78,0x3C,0xF0,0x1F,0xC0,0x07,0x44,0x06,0x84,0xE0,0x39,0xF8,0x3B,0x38,0x3E,0x1C,0x3C,
+    0x1C,0x38,0x04,0x84,0x38,0x38,0x78,0x3C,0xF0,0x3F,0xE0,0x39,0x00,0x38,0x03,0x06,0x84,0x9C,0x07,0xFC,0x1F,0x7C,0x3C,0x1C,
+    0x38,0x1C,0x70,0x04,0x84,0x3C,0x78,0x7C,0x38,0xDC,0x1F,0x1C,0x0F,0x1C,0x00,0x03,0x06,0x84,0x7C,0x0E,0xFC,0x0E,0x8C,0x0F,
+    0x0C,0x0F,0x00,0x0E,0x08,0x44,0x06,0x83,0xF0,0x07,0xF8,0x0F,0x08,0x1E,0x00,0x1C,0x00,0x84,0x80,0x1F,0xE0,0x0F,0xF8,0x01,
+    0x3C,0x00,0x1C,0x00,0x00,0x82,0x3C,0x18,0xF8,0x1F,0xE0,0x0F,0x44,0x04,0x80,0x00,0x07,0x00,0x80,0xFC,0x3F,0x00,0x80,0x00,
+    0x07,0x07,0x82,0x80,0x07,0xFC,0x03,0xFC,0x01,0x44,0x06,0x80,0x1C,0x38,0x08,0x83,0x3C,0x38,0x7C,0x3C,0xDC,0x1F,0x1C,0x0F,
+    0x44,0x06,0x81,0x0E,0x78,0x1C,0x38,0x00,0x85,0x1C,0x3C,0x18,0x1C,0x38,0x1C,0x38,0x0E,0x30,0x0E,0x70,0x07,0x00,0x81,0x60,
+    0x07,0xE0,0x03,0x00,0x80,0xC0,0x01,0x44,0x06,0x83,0x03,0xC0,0xC3,0xE1,0xC2,0xE1,0xC6,0x63,0x00,0x85,0x46,0x62,0x66,0x76,
+    0x64,0x76,0x6C,0x36,0x6C,0x34,0x3C,0x3C,0x00,0x81,0x38,0x3C,0x38,0x18,0x44,0x06,0x86,0x0C,0x78,0x18,0x3C,0x30,0x1E,0x70,
+    0x0E,0x60,0x0F,0xC0,0x07,0xC0,0x03,0x00,0x85,0xE0,0x07,0xF0,0x0E,0x70,0x0C,0x78,0x1C,0x3C,0x38,0x1E,0x70,0x44,0x06,0x88,
+    0x0E,0x78,0x0C,0x38,0x1C,0x38,0x18,0x1C,0x38,0x1C,0x38,0x1E,0x70,0x0E,0x70,0x0F,0xE0,0x07,0x00,0x80,0xC0,0x03,0x00,0x86,
+    0x80,0x03,0x80,0x01,0x80,0x03,0x00,0x03,0x00,0x07,0x00,0x3E,0x00,0x3C,0x06,0x80,0xFC,0x3F,0x00,0x8A,0x1C,0x00,0x38,0x00,
+    0x70,0x00,0xE0,0x00,0xC0,0x01,0x80,0x03,0x00,0x07,0x00,0x0E,0x00,0x1C,0x00,0x38,0xFC,0x3F,0x00,0x44,0x00,0x83,0xF8,0x00,
+    0xF8,0x01,0xC0,0x03,0x80,0x03,0x01,0x80,0xC0,0x01,0x02,0x81,0x80,0x03,0x00,0x1F,0x00,0x81,0x80,0x03,0xC0,0x01,0x02,0x80,
+    0x80,0x03,0x01,0x82,0xC0,0x03,0xF8,0x01,0xF8,0x00,0x40,0x00,0x80,0x80,0x01,0x16,0x40,0x00,0x83,0x00,0x3E,0x00,0x3F,0x80,
+    0x07,0x80,0x03,0x01,0x80,0x00,0x07,0x02,0x81,0x80,0x03,0xF0,0x01,0x00,0x81,0x80,0x03,0x00,0x07,0x02,0x80,0x80,0x03,0x01,
+    0x82,0x80,0x07,0x00,0x3F,0x00,0x3E,0x40,0x0B,0x83,0x06,0x1E,0xC6,0x3F,0xFC,0x63,0x78,0x60,0x49,0x04,0x81,0xF0,0x1F,0x10,
+    0x10,0x0C,0x80,0xF0,0x1F,0x44,0x01,0x92,0x00,0x01,0x80,0x01,0x80,0x03,0xC0,0x07,0xE0,0x07,0xF0,0x0F,0xF8,0x1F,0xFC,0x3F,
+    0xFE,0x7F,0xFF,0xFF,0xFE,0x7F,0xFC,0x3F,0xF8,0x1F,0xF0,0x0F,0xE0,0x07,0xC0,0x07,0x80,0x03,0x80,0x01,0x00,0x01,0x44,0x80,
+    0x38,0xE7,0x01,0x41,0x80,0x38,0xE7,0x01,0x41,0x80,0x38,0xE7,0x01,0x42,0x80,0x38,0xE7,0x01,0x41,0x80,0x38,0xE7,0x01,0x41,
+    0x80,0x80,0x01,0x0A,0x80,0x80,0xFF,0x00,0x4B,0x0B,0x80,0x80,0xFF,0x00,0x80,0x80,0x01,0x0A,0x0B,0x80,0xFF,0x01,0x00,0x80,
+    0x80,0x01,0x0A,0x80,0x80,0x01,0x0A,0x80,0xFF,0x01,0x00,0x4B,0x80,0x80,0x01,0x0A,0x80,0xFF,0xFF,0x00,0x80,0x80,0x01,0x0A,
+    0x0B,0x80,0xFF,0xFF,0x00,0x4B,0x80,0x80,0x01,0x0A,0x80,0xFF,0x01,0x00,0x80,0x80,0x01,0x0A,0x80,0x80,0x01,0x0A,0x80,0x80,
+    0xFF,0x00,0x80,0x80,0x01,0x0A,0x0B,0x80,0xFF,0xFF,0x00,0x80,0x80,0x01,0x0A,0x80,0x80,0x01,0x18,0x06,0x80,0x80,0x03,0x01,
+    0x41,0x80,0x80,0x03,0x0C,0x01,0x80,0x80,0x01,0x00,0x84,0xF0,0x03,0xF0,0x0F,0x90,0x1D,0x80,0x1D,0x80,0x39,0x05,0x84,0x80,
+    0x1D,0x90,0x1F,0xF0,0x0F,0xE0,0x07,0x80,0x01,0x00,0x44,0x01,0x83,0x7C,0x00,0xFC,0x01,0xC0,0x01,0x80,0x03,0x03,0x80,0xF0,
+    0x0F,0x00,0x80,0x80,0x03,0x02,0x82,0x00,0x07,0x00,0x0E,0xFC,0x1F,0x01,0x44,0x05,0x84,0x04,0x20,0xCC,0x33,0xF8,0x1F,0x30,
+    0x0C,0x18,0x18,0x02,0x83,0x30,0x0C,0xF8,0x1F,0xCC,0x33,0x04,0x20,0x47,0x01,0x82,0x07,0x70,0x06,0x38,0x0C,0x1C,0x00,0x81,
+    0x18,0x0E,0x30,0x07,0x00,0x82,0xE0,0x03,0xC0,0x01,0xFC,0x1F,0x00,0x80,0xC0,0x01,0x01,0x80,0xFC,0x1F,0x00,0x80,0xC0,0x01,
+    0x01,0x44,0x00,0x80,0x80,0x01,0x07,0x44,0x80,0x80,0x01,0x08,0x40,0x01,0x83,0xF8,0x03,0xF8,0x0F,0x08,0x1E,0x00,0x1C,0x00,
+    0x8D,0x00,0x1E,0x80,0x0F,0xE0,0x07,0xF0,0x0F,0x78,0x0C,0x3C,0x1C,0x1C,0x1C,0x1C,0x1E,0x98,0x0F,0xF0,0x07,0xF0,0x01,0x78,
+    0x00,0x3C,0x00,0x1C,0x00,0x00,0x82,0x3C,0x18,0xF8,0x1F,0xE0,0x07,0x40,0x80,0x30,0x0C,0x00,0x57,0x01,0x87,0xF0,0x07,0xF8,
+    0x0F,0x1C,0x1C,0x0E,0x38,0xF6,0x31,0xF7,0x77,0x13,0x66,0x03,0x6C,0x03,0x86,0x13,0x66,0xF7,0x77,0xE6,0x31,0x0E,0x38,0x1C,
+    0x1C,0xF8,0x0F,0xF0,0x07,0x44,0x01,0x89,0xC0,0x07,0xE0,0x0F,0x60,0x08,0xE0,0x07,0xE0,0x0F,0x60,0x1C,0x60,0x18,0xE0,0x18,
+    0xF8,0x1F,0x38,0x0F,0x4D,0x07,0x8B,0x08,0x02,0x1C,0x07,0x38,0x0E,0x70,0x1C,0xE0,0x38,0xC0,0x30,0xC0,0x71,0xE0,0x38,0x70,
+    0x1C,0x38,0x0E,0x1C,0x07,0x08,0x02,0x45,0x0A,0x80,0xFE,0x7F,0x00,0x80,0x06,0x00,0x02,0x48,0x0B,0x80,0xF8,0x1F,0x00,0x4B,
+    0x01,0x83,0xC0,0x07,0x20,0x08,0x90,0x17,0x48,0x24,0x00,0x81,0x88,0x27,0x88,0x24,0x00,0x82,0xD0,0x14,0x20,0x08,0xC0,0x07,
+    0x4C,0x80,0xFF,0xFF,0x00,0x57,0x01,0x81,0x00,0x07,0x80,0x08,0x01,0x80,0x00,0x07,0x52,0x06,0x80,0x80,0x01,0x02,0x80,0xFE,
+    0x7F,0x00,0x80,0x80,0x01,0x02,0x41,0x80,0xFE,0x7F,0x00,0x44,0x01,0x88,0xE0,0x07,0xF8,0x0F,0x38,0x08,0x38,0x00,0x70,0x00,
+    0xE0,0x01,0x80,0x03,0x00,0x0E,0xF8,0x0F,0x00,0x4D,0x01,0x86,0xF0,0x07,0xF8,0x0F,0x38,0x08,0x38,0x00,0xE0,0x03,0xF0,0x03,
+    0x38,0x00,0x00,0x81,0xF8,0x0F,0xE0,0x0F,0x4D,0x82,0xC0,0x01,0x80,0x03,0x00,0x07,0x56,0x06,0x80,0x1C,0x38,0x08,0x84,0x3C,
+    0x3C,0x7C,0x3E,0xDC,0x3F,0xDE,0x3B,0x00,0x38,0x03,0x01,0x82,0xF8,0x1F,0xF8,0x3F,0x18,0x7F,0x03,0x83,0x18,0x3F,0x18,0x1F,
+    0x18,0x0F,0x18,0x03,0x0B,0x40,0x0C,0x80,0x80,0x03,0x01,0x49,0x14,0x82,0x80,0x00,0xC0,0x01,0x60,0x00,0x00,0x80,0xC0,0x03,
+    0x01,0x80,0xC0,0x07,0x00,0x80,0xC0,0x01,0x06,0x4D,0x01,0x83,0xE0,0x07,0xF0,0x0F,0x38,0x1C,0x18,0x18,0x02,0x82,0x38,0x1C,
+    0xF0,0x0F,0xE0,0x07,0x4D,0x07,0x8B,0x80,0x10,0xC0,0x39,0xE0,0x1C,0x70,0x0E,0x38,0x07,0x9C,0x03,0x18,0x03,0x38,0x07,0x70,
+    0x0E,0xE0,0x1C,0xC0,0x39,0x80,0x10,0x45,0x01,0x83,0x18,0xF8,0x30,0xF8,0x30,0x38,0x60,0x38,0x00,0x80,0xC0,0x38,0x00,0x80,
+    0x80,0x39,0x00,0x87,0x1C,0x3B,0x3C,0x06,0x5C,0x06,0x9C,0x0C,0x9C,0x0D,0x1C,0x1B,0xFF,0x1B,0x1C,0x30,0x00,0x80,0x1C,0x60,
+    0x44,0x01,0x83,0x30,0xF8,0x60,0xF8,0x60,0x38,0xC0,0x38,0x00,0x80,0x80,0x39,0x00,0x80,0x00,0x3B,0x00,0x89,0x3C,0x3E,0x7F,
+    0x0C,0x07,0x0C,0x07,0x18,0x0E,0x18,0x1C,0x30,0x30,0x30,0x60,0x60,0x7F,0x60,0x7F,0xC0,0x44,0x01,0x82,0x07,0x7E,0x0E,0x7F,
+    0x1C,0x07,0x00,0x8E,0x38,0x3C,0x38,0x3E,0x70,0x07,0xE0,0x07,0xE0,0x7F,0xDC,0x7D,0xBC,0x03,0xDC,0x03,0x9C,0x07,0x9C,0x0F,
+    0x1C,0x0F,0xFF,0x1F,0x1C,0x1C,0x1C,0x38,0x1C,0x70,0x44,0x06,0x80,0xC0,0x01,0x01,0x41,0x80,0xC0,0x01,0x01,0x85,0x80,0x03,
+    0x80,0x07,0x00,0x0F,0x00,0x1E,0x00,0x1C,0x00,0x38,0x00,0x83,0x0C,0x38,0x0C,0x3C,0xFC,0x1F,0xF8,0x07,0x82,0x00,0x07,0x80,
+    0x03,0xC0,0x01,0x41,0x83,0x80,0x03,0xC0,0x03,0xC0,0x07,0xE0,0x06,0x00,0x85,0x60,0x0E,0x70,0x0C,0x70,0x1C,0x38,0x1C,0x38,
+    0x18,0xFC,0x3F,0x00,0x81,0x1C,0x70,0x0E,0x70,0x00,0x80,0x07,0xE0,0x44,0x82,0xE0,0x00,0xC0,0x01,0x80,0x03,0x41,0x83,0x80,
+    0x03,0xC0,0x03,0xC0,0x07,0xE0,0x06,0x00,0x85,0x60,0x0E,0x70,0x0C,0x70,0x1C,0x38,0x1C,0x38,0x18,0xFC,0x3F,0x00,0x81,0x1C,
+    0x70,0x0E,0x70,0x00,0x80,0x07,0xE0,0x44,0x82,0xC0,0x07,0xE0,0x0E,0x70,0x1C,0x41,0x83,0x80,0x03,0xC0,0x03,0xC0,0x07,0xE0,
+    0x06,0x00,0x85,0x60,0x0E,0x70,0x0C,0x70,0x1C,0x38,0x1C,0x38,0x18,0xFC,0x3F,0x00,0x81,0x1C,0x70,0x0E,0x70,0x00,0x80,0x07,
+    0xE0,0x44,0x82,0x30,0x07,0xF0,0x0F,0xE0,0x0C,0x41,0x83,0x80,0x03,0xC0,0x03,0xC0,0x07,0xE0,0x06,0x00,0x85,0x60,0x0E,0x70,
+    0x0C,0x70,0x1C,0x38,0x1C,0x38,0x18,0xFC,0x3F,0x00,0x81,0x1C,0x70,0x0E,0x70,0x00,0x80,0x07,0xE0,0x44,0x80,0x30,0x0C,0x00,
+    0x42,0x83,0x80,0x03,0xC0,0x03,0xC0,0x07,0xE0,0x06,0x00,0x85,0x60,0x0E,0x70,0x0C,0x70,0x1C,0x38,0x1C,0x38,0x18,0xFC,0x3F,
+    0x00,0x81,0x1C,0x70,0x0E,0x70,0x00,0x80,0x07,0xE0,0x44,0x81,0xC0,0x01,0x20,0x02,0x01,0x80,0xC0,0x01,0x00,0x80,0xE0,0x03,
+    0x00,0x81,0x60,0x07,0x70,0x06,0x00,0x84,0x30,0x0E,0x38,0x0C,0x38,0x1C,0x1C,0x1C,0xFC,0x3F,0x00,0x81,0x0E,0x38,0x0E,0x70,
+    0x00,0x80,0x07,0xE0,0x44,0x04,0x84,0xFC,0x01,0xFC,0x03,0xE0,0x03,0xE0,0x07,0xE0,0x06,0x00,0x85,0xE0,0x0E,0xFC,0x0C,0xFC,
+    0x1C,0xE0,0x18,0xE0,0x38,0xE0,0x3F,0x00,0x82,0xE0,0x60,0xFE,0x60,0xFE,0xC0,0x44,0x04,0x85,0xF8,0x03,0xFC,0x0F,0x0C,0x1E,
+    0x00,0x3C,0x00,0x38,0x00,0x70,0x04,0x87,0x00,0x38,0x00,0x3C,0x04,0x1E,0xFC,0x0F,0xF8,0x03,0x40,0x00,0xE0,0x00,0x30,0x00,
+    0x00,0x80,0xE0,0x01,0x82,0x80,0x03,0xC0,0x01,0xE0,0x00,0x41,0x80,0xFC,0x1F,0x00,0x80,0x00,0x1C,0x03,0x80,0xF8,0x1F,0x00,
+    0x80,0x00,0x1C,0x03,0x80,0xFE,0x1F,0x00,0x44,0x82,0x70,0x00,0xE0,0x00,0xC0,0x01,0x41,0x80,0xFC,0x1F,0x00,0x80,0x00,0x1C,
+    0x03,0x80,0xF8,0x1F,0x00,0x80,0x00,0x1C,0x03,0x80,0xFE,0x1F,0x00,0x44,0x82,0xE0,0x03,0x70,0x07,0x38,0x0E,0x41,0x80,0xFC,
+    0x1F,0x00,0x80,0x00,0x1C,0x03,0x80,0xF8,0x1F,0x00,0x80,0x00,0x1C,0x03,0x80,0xFE,0x1F,0x00,0x44,0x80,0x18,0x06,0x00,0x42,
+    0x80,0xFC,0x1F,0x00,0x80,0x00,0x1C,0x03,0x80,0xF8,0x1F,0x00,0x80,0x00,0x1C,0x03,0x80,0xFE,0x1F,0x00,0x44,0x82,0x00,0x07,
+    0x80,0x03,0xC0,0x01,0x41,0x80,0xF8,0x3F,0x00,0x80,0x80,0x03,0x0A,0x80,0xF8,0x3F,0x00,0x44,0x82,0xE0,0x00,0xC0,0x01,0x80,
+    0x03,0x41,0x80,0xF8,0x3F,0x00,0x80,0x80,0x03,0x0A,0x80,0xF8,0x3F,0x00,0x44,0x82,0xC0,0x07,0xE0,0x0E,0x70,0x1C,0x41,0x80,
+    0xF8,0x3F,0x00,0x80,0x80,0x03,0x0A,0x80,0xF8,0x3F,0x00,0x44,0x80,0x30,0x0C,0x00,0x42,0x80,0xF8,0x3F,0x00,0x80,0x80,0x03,
+    0x0A,0x80,0xF8,0x3F,0x00,0x44,0x04,0x85,0xE0,0x3F,0xF0,0x3F,0x3C,0x38,0x1C,0x38,0x1E,0x38,0x0E,0x38,0x00,0x80,0x0E,0xFF,
+    0x00,0x80,0x0E,0x38,0x00,0x80,0x1C,0x38,0x00,0x82,0x78,0x38,0xF0,0x3F,0xC0,0x3F,0x44,0x82,0x30,0x07,0xF0,0x0F,0xE0,0x0C,
+    0x41,0x80,0x0C,0x38,0x00,0x81,0x0C,0x3C,0x0C,0x3E,0x00,0x86,0x0C,0x3F,0x8C,0x37,0x8C,0x33,0xCC,0x33,0xEC,0x31,0xFC,0x30,
+    0x7C,0x30,0x00,0x81,0x3C,0x30,0x1C,0x30,0x00,0x44,0x82,0x00,0x07,0x80,0x03,0xC0,0x01,0x41,0x83,0xE0,0x07,0xF0,0x0F,0x38,
+    0x1C,0x1C,0x38,0x00,0x80,0x0E,0x70,0x04,0x80,0x1C,0x38,0x00,0x82,0x38,0x1C,0xF0,0x0F,0xE0,0x07,0x44,0x82,0xE0,0x00,0xC0,
+    0x01,0x80,0x03,0x41,0x83,0xE0,0x07,0xF0,0x0F,0x38,0x1C,0x1C,0x38,0x00,0x80,0x0E,0x70,0x04,0x80,0x1C,0x38,0x00,0x82,0x38,
+    0x1C,0xF0,0x0F,0xE0,0x07,0x44,0x82,0xC0,0x07,0xE0,0x0E,0x70,0x1C,0x41,0x83,0xE0,0x07,0xF0,0x0F,0x38,0x1C,0x1C,0x38,0x00,
+    0x80,0x0E,0x70,0x04,0x80,0x1C,0x38,0x00,0x82,0x38,0x1C,0xF0,0x0F,0xE0,0x07,0x44,0x82,0x30,0x07,0xF0,0x0F,0xE0,0x0C,0x41,
+    0x83,0xE0,0x07,0xF0,0x0F,0x38,0x1C,0x1C,0x38,0x00,0x80,0x0E,0x70,0x04,0x80,0x1C,0x38,0x00,0x82,0x38,0x1C,0xF0,0x0F,0xE0,
+    0x07,0x44,0x80,0x30,0x0C,0x00,0x42,0x83,0xE0,0x07,0xF0,0x0F,0x38,0x1C,0x1C,0x38,0x00,0x80,0x0E,0x70,0x04,0x80,0x1C,0x38,
+    0x00,0x82,0x38,0x1C,0xF0,0x0F,0xE0,0x07,0x44,0x06,0x86,0x04,0x20,0x0E,0x70,0x1C,0x38,0x38,0x1C,0x70,0x0E,0xE0,0x07,0xC0,
+    0x03,0x00,0x85,0xE0,0x07,0x70,0x0E,0x38,0x1C,0x1C,0x38,0x0E,0x70,0x04,0x20,0x44,0x04,0x83,0xE6,0x07,0xFC,0x0F,0x38,0x1C,
+    0x3C,0x38,0x00,0x82,0x6E,0x70,0xCE,0x70,0x8E,0x71,0x00,0x82,0x0E,0x73,0x0E,0x76,0x1C,0x3C,0x00,0x82,0x38,0x1C,0xF0,0x3F,
+    0xE0,0x67,0x44,0x82,0x00,0x07,0x80,0x03,0xC0,0x01,0x41,0x80,0x0E,0x38,0x0A,0x83,0x1E,0x3C,0x1C,0x1C,0xF8,0x0F,0xF0,0x07,
+    0x44,0x82,0xE0,0x00,0xC0,0x01,0x80,0x03,0x41,0x80,0x0E,0x38,0x0A,0x83,0x1E,0x3C,0x1C,0x1C,0xF8,0x0F,0xF0,0x07,0x44,0x82,
+    0xC0,0x07,0xE0,0x0E,0x70,0x1C,0x41,0x80,0x0E,0x38,0x0A,0x83,0x1E,0x3C,0x1C,0x1C,0xF8,0x0F,0xF0,0x07,0x44,0x80,0x18,0x06,
+    0x00,0x42,0x80,0x0E,0x38,0x0A,0x83,0x1E,0x3C,0x1C,0x1C,0xF8,0x0F,0xF0,0x07,0x44,0x82,0xE0,0x00,0xC0,0x01,0x80,0x03,0x41,
+    0x87,0x07,0xE0,0x0E,0x70,0x0C,0x38,0x18,0x38,0x38,0x1C,0x70,0x1E,0xE0,0x0E,0xC0,0x07,0x00,0x80,0x80,0x03,0x05,0x44,0x04,
+    0x80,0x00,0x1C,0x01,0x83,0xF8,0x1F,0xFC,0x1F,0x1E,0x1C,0x0E,0x1C,0x01,0x84,0x1E,0x1C,0x3C,0x1C,0xF8,0x1F,0xE0,0x1F,0x00,
+    0x1C,0x01,0x44,0x00,0x83,0xC0,0x0F,0xE0,0x1F,0x70,0x3C,0x70,0x38,0x00,0x82,0x60,0x38,0xE0,0x38,0xC0,0x39,0x01,0x85,0xE0,
+    0x39,0xF0,0x38,0x78,0x38,0x3C,0x38,0x1E,0x38,0x0E,0x38,0x00,0x82,0x0E,0x39,0xFC,0x39,0xF8,0x38,0x44,0x00,0x83,0x00,0x0C,
+    0x00,0x06,0x00,0x03,0x80,0x01,0x41,0x83,0xE0,0x07,0xF0,0x1F,0x78,0x18,0x38,0x00,0x00,0x83,0xF8,0x07,0xF8,0x0F,0x38,0x1C,
+    0x38,0x38,0x01,0x82,0x78,0x3C,0xDE,0x1F,0x1E,0x0F,0x44,0x00,0x83,0x60,0x00,0xC0,0x00,0x80,0x01,0x00,0x03,0x41,0x83,0xE0,
+    0x07,0xF0,0x1F,0x78,0x18,0x38,0x00,0x00,0x83,0xF8,0x07,0xF8,0x0F,0x38,0x1C,0x38,0x38,0x01,0x82,0x78,0x3C,0xDE,0x1F,0x1E,
+    0x0F,0x44,0x00,0x83,0x80,0x03,0xC0,0x06,0x60,0x0C,0x30,0x18,0x41,0x83,0xE0,0x07,0xF0,0x1F,0x78,0x18,0x38,0x00,0x00,0x83,
+    0xF8,0x07,0xF8,0x0F,0x38,0x1C,0x38,0x38,0x01,0x82,0x78,0x3C,0xDE,0x1F,0x1E,0x0F,0x44,0x01,0x82,0x30,0x07,0xF0,0x0F,0xE0,
+    0x0C,0x41,0x83,0xE0,0x07,0xF0,0x1F,0x78,0x18,0x38,0x00,0x00,0x83,0xF8,0x07,0xF8,0x0F,0x38,0x1C,0x38,0x38,0x01,0x82,0x78,
+    0x3C,0xDE,0x1F,0x1E,0x0F,0x44,0x02,0x80,0x30,0x06,0x00,0x41,0x83,0xE0,0x07,0xF0,0x1F,0x78,0x18,0x38,0x00,0x00,0x83,0xF8,
+    0x07,0xF8,0x0F,0x38,0x1C,0x38,0x38,0x01,0x82,0x78,0x3C,0xDE,0x1F,0x1E,0x0F,0x44,0x81,0x80,0x03,0x40,0x04,0x01,0x80,0x80,
+    0x03,0x41,0x83,0xE0,0x07,0xF0,0x1F,0x78,0x18,0x38,0x00,0x00,0x83,0xF8,0x07,0xF8,0x0F,0x38,0x1C,0x38,0x38,0x01,0x82,0x78,
+    0x3C,0xDE,0x1F,0x1E,0x0F,0x44,0x06,0x83,0x3C,0x1F,0xFE,0x3F,0xE6,0x01,0xC7,0x01,0x00,0x83,0xFF,0x0F,0xFF,0x3F,0xC0,0x39,
+    0xC0,0x71,0x01,0x82,0xE1,0x79,0xFF,0x3F,0x3E,0x1E,0x44,0x06,0x84,0xF8,0x03,0xFC,0x0F,0x04,0x1E,0x00,0x1C,0x00,0x38,0x03,
+    0x87,0x00,0x3C,0x00,0x1C,0x04,0x1F,0xFC,0x0F,0xF8,0x03,0x80,0x00,0xC0,0x01,0x60,0x00,0x00,0x80,0xC0,0x03,0x00,0x83,0x00,
+    0x0C,0x00,0x06,0x00,0x03,0x80,0x01,0x41,0x84,0xE0,0x03,0xF0,0x0F,0x38,0x1E,0x1C,0x1C,0x1C,0x38,0x00,0x80,0xFC,0x3F,0x00,
+    0x80,0x00,0x38,0x00,0x83,0x00,0x1C,0x04,0x1E,0xFC,0x0F,0xF8,0x03,0x44,0x00,0x83,0x30,0x00,0x60,0x00,0xC0,0x00,0x80,0x01,
+    0x41,0x84,0xE0,0x03,0xF0,0x0F,0x38,0x1E,0x1C,0x1C,0x1C,0x38,0x00,0x80,0xFC,0x3F,0x00,0x80,0x00,0x38,0x00,0x83,0x00,0x1C,
+    0x04,0x1E,0xFC,0x0F,0xF8,0x03,0x44,0x00,0x83,0x80,0x03,0xC0,0x06,0x60,0x0C,0x30,0x18,0x41,0x84,0xE0,0x03,0xF0,0x0F,0x38,
+    0x1E,0x1C,0x1C,0x1C,0x38,0x00,0x80,0xFC,0x3F,0x00,0x80,0x00,0x38,0x00,0x83,0x00,0x1C,0x04,0x1E,0xFC,0x0F,0xF8,0x03,0x44,
+    0x02,0x80,0x30,0x06,0x00,0x41,0x84,0xE0,0x03,0xF0,0x0F,0x38,0x1E,0x1C,0x1C,0x1C,0x38,0x00,0x80,0xFC,0x3F,0x00,0x80,0x00,
+    0x38,0x00,0x83,0x00,0x1C,0x04,0x1E,0xFC,0x0F,0xF8,0x03,0x44,0x00,0x83,0x00,0x06,0x00,0x03,0x80,0x01,0xC0,0x00,0x41,0x80,
+    0xC0,0x3F,0x00,0x80,0xC0,0x01,0x0A,0x44,0x00,0x83,0x60,0x00,0xC0,0x00,0x80,0x01,0x00,0x03,0x41,0x80,0xC0,0x3F,0x00,0x80,
+    0xC0,0x01,0x0A,0x44,0x00,0x83,0xC0,0x01,0x60,0x03,0x30,0x06,0x18,0x0C,0x41,0x80,0xC0,0x3F,0x00,0x80,0xC0,0x01,0x0A,0x44,
+    0x02,0x80,0x60,0x0C,0x00,0x41,0x80,0xC0,0x3F,0x00,0x80,0xC0,0x01,0x0A,0x44,0x00,0x8A,0xC0,0x78,0xC0,0x7F,0x80,0x0F,0xC0,
+    0x0F,0xE0,0x18,0x70,0x00,0xF0,0x07,0xF8,0x1F,0x78,0x3C,0x3C,0x38,0x1C,0x70,0x04,0x83,0x38,0x38,0x78,0x3C,0xF0,0x1F,0xC0,
+    0x07,0x44,0x01,0x82,0x30,0x07,0xF0,0x0F,0xE0,0x0C,0x41,0x84,0xF0,0x38,0xF8,0x3B,0x3C,0x3E,0x1C,0x3C,0x1C,0x38,0x08,0x44,
+    0x00,0x83,0x00,0x0C,0x00,0x06,0x00,0x03,0x80,0x01,0x41,0x84,0xC0,0x07,0xF0,0x1F,0x78,0x3C,0x38,0x38,0x1C,0x70,0x04,0x83,
+    0x38,0x38,0x78,0x3C,0xF0,0x1F,0xC0,0x07,0x44,0x00,0x83,0x60,0x00,0xC0,0x00,0x80,0x01,0x00,0x03,0x41,0x84,0xC0,0x07,0xF0,
+    0x1F,0x78,0x3C,0x38,0x38,0x1C,0x70,0x04,0x83,0x38,0x38,0x78,0x3C,0xF0,0x1F,0xC0,0x07,0x44,0x00,0x83,0x80,0x03,0xC0,0x06,
+    0x60,0x0C,0x30,0x18,0x41,0x84,0xC0,0x07,0xF0,0x1F,0x78,0x3C,0x38,0x38,0x1C,0x70,0x04,0x83,0x38,0x38,0x78,0x3C,0xF0,0x1F,
+    0xC0,0x07,0x44,0x01,0x82,0x30,0x07,0xF0,0x0F,0xE0,0x0C,0x41,0x84,0xC0,0x07,0xF0,0x1F,0x78,0x3C,0x38,0x38,0x1C,0x70,0x04,
+    0x83,0x38,0x38,0x78,0x3C,0xF0,0x1F,0xC0,0x07,0x44,0x02,0x80,0x60,0x0C,0x00,0x41,0x84,0xC0,0x07,0xF0,0x1F,0x78,0x3C,0x38,
+    0x38,0x1C,0x70,0x04,0x83,0x38,0x38,0x78,0x3C,0xF0,0x1F,0xC0,0x07,0x44,0x06,0x80,0x80,0x03,0x01,0x42,0x80,0xFC,0x7F,0x00,
+    0x42,0x80,0x80,0x03,0x01,0x44,0x06,0x88,0xCC,0x07,0xF8,0x1F,0x78,0x3C,0x78,0x38,0xDC,0x70,0x9C,0x70,0x9C,0x71,0x1C,0x73,
+    0x1C,0x76,0x00,0x83,0x38,0x3C,0x78,0x3C,0xF0,0x3F,0xC0,0x67,0x44,0x00,0x83,0x00,0x0C,0x00,0x06,0x00,0x03,0x80,0x01,0x41,
+    0x80,0x1C,0x38,0x08,0x83,0x3C,0x38,0x7C,0x3C,0xDC,0x1F,0x1C,0x0F,0x44,0x00,0x83,0x60,0x00,0xC0,0x00,0x80,0x01,0x00,0x03,
+    0x41,0x80,0x1C,0x38,0x08,0x83,0x3C,0x38,0x7C,0x3C,0xDC,0x1F,0x1C,0x0F,0x44,0x00,0x83,0x80,0x03,0xC0,0x06,0x60,0x0C,0x30,
+    0x18,0x41,0x80,0x1C,0x38,0x08,0x83,0x3C,0x38,0x7C,0x3C,0xDC,0x1F,0x1C,0x0F,0x44,0x02,0x80,0x60,0x0C,0x00,0x41,0x80,0x1C,
+    0x38,0x08,0x83,0x3C,0x38,0x7C,0x3C,0xDC,0x1F,0x1C,0x0F,0x44,0x00,0x83,0x60,0x00,0xC0,0x00,0x80,0x01,0x00,0x03,0x41,0x88,
+    0x0E,0x78,0x0C,0x38,0x1C,0x38,0x18,0x1C,0x38,0x1C,0x38,0x1E,0x70,0x0E,0x70,0x0F,0xE0,0x07,0x00,0x80,0xC0,0x03,0x00,0x86,
+    0x80,0x03,0x80,0x01,0x80,0x03,0x00,0x03,0x00,0x07,0x00,0x3E,0x00,0x3C,0x00,0x80,0x00,0x38,0x04,0x84,0xE0,0x39,0xF8,0x3B,
+    0x38,0x3E,0x1C,0x3C,0x1C,0x38,0x04,0x84,0x38,0x38,0x78,0x3C,0xF0,0x3F,0xE0,0x39,0x00,0x38,0x03,0x02,0x80,0x60,0x0C,0x00,
+    0x41,0x88,0x0E,0x78,0x0C,0x38,0x1C,0x38,0x18,0x1C,0x38,0x1C,0x38,0x1E,0x70,0x0E,0x70,0x0F,0xE0,0x07,0x00,0x80,0xC0,0x03,
+    0x00,0x86,0x80,0x03,0x80,0x01,0x80,0x03,0x00,0x03,0x00,0x07,0x00,0x3E,0x00,0x3C,
+};
+
+static const FONT_PACKED font_16x26 = { 16, 26, 6, font_ranges_16x26, font_offsets_16x26, font_data_16x26 };
+
+static const FONT_RANGE font_ranges_22x36[6] =
+{
+    { 0x21, 0x81,   0 },
+    { 0x8A, 0x8E,  97 },
+    { 0x91, 0x91, 102 },
+    { 0x94, 0x95, 103 },
+    { 0x97, 0x98, 105 },
+    { 0xA1, 0xFF, 107 },
+};
+
+static const uint16_t font_offsets_22x36[203] =
+{
+        0,    13,    24,    67,   148,   225,   302,   313,   382,   451,   491,   508,   533,   540,   547,   634,
+      682,   709,   774,   840,   896,   950,  1025,  1092,  1164,  1239,  1252,  1283,  1343,  1356,  1416,  1476,
+     1555,  1624,  1685,  1744,  1798,  1825,  1847,  1911,  1928,  1945,  1973,  2045,  2057,  2113,  2180,  2234,
+     2276,  2345,  2408,  2472,  2484,  2510,  2577,  2633,  2704,  2749,  2812,  2828,  2915,  2931,  2991,  2998,
+     3012,  3063,  3111,  3161,  3209,  3264,  3295,  3359,  3388,  3406,  3440,  3504,  3515,  3540,  3565,  3609,
+     3657,  3705,  3730,  3788,  3817,  3843,  3901,  3958,  4017,  4091,  4142,  4202,  4208,  4268,  4295,  4311,
+     4392,  4422,  4433,  4444,  4455,  4466,  4481,  4488,  4503,  4518,  4529,  4534,  4547,  4603,  4646,  4696,
+     4757,  4769,  4863,  4869,  4943,  4983,  5031,  5043,  5050,  5101,  5107,  5133,  5156,  5195,  5235,  5249,
+     5279,  5312,  5319,  5344,  5356,  5388,  5436,  5513,  5590,  5670,  5730,  5812,  5894,  5976,  6058,  6132,
+     6208,  6273,  6354,  6394,  6434,  6474,  6506,  6536,  6566,  6596,  6618,  6680,  6760,  6827,  6894,  6961,
+     7028,  7087,  7147,  7219,  7258,  7297,  7336,  7367,  7425,  7472,  7547,  7617,  7687,  7757,  7822,  7879,
+     7948,  8003,  8075,  8149,  8223,  8297,  8358,  8389,  8420,  8451,  8469,  8542,  8581,  8644,  8707,  8770,
+     8828,  8878,  8897,  8957,  9002,  9047,  9092,  9124,  9217,  9269,  9349,
+};
+
+static const uint8_t font_data_22x36[9349] =
+{
+    0x01,0x80,0x00,0x70,0x00,0x11,0x42,0x80,0x00,0x70,0x00,0x02,0x47,0x80,0x80,0x07,0x0F,0x04,0x80,0x00,0x03,0x06,0x02,0x59,
+    0x01,0x80,0xE0,0x70,0x00,0x00,0x80,0xC0,0xE1,0x00,0x02,0x81,0x80,0xC3,0x01,0xF8,0xFF,0x3F,0x01,0x80,0x00,0x87,0x03,0x03,
+    0x80,0xE0,0xFF,0x7F,0x01,0x81,0x00,0x0E,0x07,0x00,0x1C,0x0E,0x03,0x80,0x00,0x38,0x1C,0x00,0x47,0x80,0x00,0x30,0x00,0x00,
+    0x85,0x00,0xFE,0x00,0x80,0xFF,0x03,0x80,0xFF,0x07,0x80,0xB1,0x07,0x00,0x30,0x0F,0x00,0x30,0x0E,0x01,0x8A,0x00,0x30,0x0F,
+    0x00,0xB0,0x07,0x00,0xF0,0x03,0x00,0xF0,0x01,0x00,0xF8,0x00,0x00,0x7E,0x00,0x00,0x3F,0x00,0x80,0x3F,0x00,0x80,0x33,0x00,
+    0xC0,0x33,0x00,0xC0,0x31,0x00,0x01,0x85,0xC0,0x33,0x10,0x80,0x37,0x1C,0x80,0xFF,0x1F,0x00,0xFF,0x1F,0x00,0xFC,0x03,0x00,
+    0x30,0x00,0x00,0x45,0x01,0x83,0x1C,0x00,0x1F,0x38,0x80,0x3F,0x70,0xC0,0x71,0xE0,0xE0,0xE0,0x00,0x81,0xC0,0xE1,0xE0,0x80,
+    0xE3,0xE0,0x00,0x8A,0x00,0xE7,0xE0,0x00,0xCE,0x71,0x00,0x9C,0x3F,0x00,0x1C,0x1F,0x00,0x38,0x00,0x00,0x70,0x00,0xE0,0xE3,
+    0x00,0xF0,0xE7,0x00,0x38,0xCE,0x01,0x1C,0x9C,0x03,0x1C,0x1C,0x07,0x00,0x81,0x1C,0x1C,0x0E,0x1C,0x1C,0x1C,0x00,0x82,0x38,
+    0x0E,0x38,0xF0,0x07,0x70,0xE0,0x03,0xE0,0x47,0x01,0x84,0x00,0xF8,0x00,0x00,0xFE,0x01,0x00,0xFE,0x03,0x00,0x8F,0x07,0x00,
+    0x07,0x07,0x01,0x92,0x00,0x0E,0x07,0x00,0x9E,0x03,0x00,0xFC,0x03,0x00,0xF0,0x03,0x00,0xE0,0x07,0x1C,0xE0,0x1F,0x1C,0xE0,
+    0x3C,0x1C,0x70,0x78,0x1C,0x78,0x70,0x18,0x3C,0xE0,0x38,0x3C,0xE0,0x38,0x1E,0xE0,0x70,0x0F,0xE0,0xF0,0x07,0xF0,0xE0,0x07,
+    0x78,0xE0,0x03,0x7E,0xF0,0xFF,0x3F,0xF0,0xFF,0x1F,0x78,0xF8,0x03,0x47,0x80,0x00,0xF0,0x00,0x04,0x80,0x00,0x60,0x00,0x02,
+    0x59,0x87,0x60,0x00,0x00,0xE0,0x03,0x00,0x80,0x0F,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0x70,0x00,0x00,
+    0xE0,0x00,0x00,0x80,0x00,0xC0,0x01,0x01,0x80,0x00,0x80,0x03,0x07,0x80,0x00,0xC0,0x01,0x01,0x80,0x00,0xE0,0x00,0x00,0x86,
+    0x00,0x70,0x00,0x00,0x78,0x00,0x00,0x3C,0x00,0x00,0x1E,0x00,0x80,0x0F,0x00,0xE0,0x03,0x00,0x60,0x00,0x00,0x42,0x87,0x00,
+    0x00,0x1C,0x00,0x00,0x1F,0x00,0xC0,0x07,0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0x78,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,
+    0x80,0x00,0x0E,0x00,0x01,0x80,0x00,0x07,0x00,0x07,0x80,0x00,0x0E,0x00,0x01,0x80,0x00,0x1C,0x00,0x00,0x86,0x00,0x38,0x00,
+    0x00,0x78,0x00,0x00,0xF0,0x00,0x00,0xE0,0x01,0x00,0xC0,0x07,0x00,0x00,0x1F,0x00,0x00,0x18,0x42,0x01,0x80,0x00,0x70,0x00,
+    0x02,0x83,0xC0,0x70,0x0C,0xE0,0x23,0x1F,0xE0,0x87,0x1F,0x80,0x87,0x07,0x40,0x85,0x00,0xCC,0x00,0x00,0xFE,0x01,0x00,0xCF,
+    0x03,0x80,0x87,0x07,0x80,0x03,0x07,0x00,0x02,0x01,0x52,0x08,0x80,0x00,0x38,0x00,0x06,0x80,0xF8,0xFF,0x3F,0x01,0x80,0x00,
+    0x38,0x00,0x06,0x47,0x16,0x80,0x00,0xF8,0x00,0x03,0x80,0x00,0x38,0x00,0x00,0x83,0x00,0x30,0x00,0x00,0x70,0x00,0x00,0xE0,
+    0x00,0x00,0xC0,0x00,0x41,0x0E,0x80,0xC0,0xFF,0x0F,0x01,0x51,0x16,0x80,0x00,0xF8,0x00,0x03,0x47,0x81,0x38,0x00,0x00,0x70,
+    0x00,0x00,0x00,0x80,0xE0,0x00,0x00,0x00,0x80,0xC0,0x01,0x00,0x00,0x80,0x80,0x03,0x00,0x00,0x80,0x00,0x07,0x00,0x00,0x80,
+    0x00,0x0E,0x00,0x00,0x80,0x00,0x1C,0x00,0x00,0x83,0x00,0x38,0x00,0x00,0x78,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0x80,
+    0x00,0xC0,0x01,0x00,0x80,0x00,0x80,0x03,0x00,0x80,0x00,0x00,0x07,0x00,0x80,0x00,0x00,0x0E,0x00,0x80,0x00,0x00,0x1C,0x00,
+    0x80,0x00,0x00,0x38,0x00,0x80,0x00,0x00,0x70,0x42,0x01,0x85,0x00,0xF8,0x00,0x00,0xFE,0x03,0x00,0xFF,0x07,0x80,0x07,0x0F,
+    0x80,0x03,0x0E,0xC0,0x01,0x1C,0x01,0x80,0xE0,0x00,0x38,0x08,0x80,0xC0,0x01,0x1C,0x01,0x84,0x80,0x03,0x0E,0x80,0x07,0x0F,
+    0x00,0xFF,0x07,0x00,0xFE,0x03,0x00,0xF8,0x00,0x47,0x01,0x85,0x00,0x18,0x00,0x00,0xF8,0x00,0x00,0xF8,0x07,0x00,0xF8,0x1F,
+    0x00,0x38,0x1E,0x00,0x38,0x00,0x10,0x80,0xF0,0xFF,0x1F,0x01,0x47,0x01,0x85,0x00,0xF8,0x01,0x00,0xFE,0x0F,0x00,0xFF,0x0F,
+    0x00,0x0F,0x0E,0x80,0x07,0x08,0x80,0x03,0x00,0x03,0x89,0x00,0x07,0x00,0x00,0x0F,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,
+    0x38,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xC0,0x01,0x00,0x80,0x03,0x00,0x00,0x07,0x00,0x82,0x00,0x00,0x0E,0x00,0x00,
+    0x1E,0x80,0xFF,0x1F,0x01,0x47,0x01,0x84,0x00,0xF8,0x03,0x00,0xFE,0x0F,0x00,0xFF,0x0F,0x80,0x0F,0x0C,0x80,0x03,0x00,0x02,
+    0x82,0x00,0x07,0x00,0x00,0x1E,0x00,0x00,0xFC,0x03,0x00,0x84,0x00,0xFE,0x03,0x00,0x1F,0x00,0x80,0x07,0x00,0xC0,0x03,0x00,
+    0xC0,0x01,0x00,0x02,0x85,0xC0,0x03,0x00,0x80,0x03,0x00,0x80,0x0F,0x0C,0x00,0xFF,0x0F,0x00,0xFE,0x0F,0x00,0xF8,0x07,0x47,
+    0x01,0x82,0x00,0x07,0x00,0x00,0x0F,0x00,0x00,0x1F,0x00,0x00,0x81,0x00,0x3F,0x00,0x00,0x77,0x00,0x00,0x81,0x00,0xE7,0x00,
+    0x00,0xC7,0x01,0x00,0x82,0x00,0x87,0x03,0x00,0x07,0x07,0x00,0x07,0x0E,0x00,0x82,0x00,0x07,0x1C,0x00,0x07,0x38,0xE0,0xFF,
+    0x3F,0x01,0x80,0x00,0x07,0x00,0x05,0x47,0x01,0x80,0x00,0xFF,0x07,0x01,0x80,0x00,0x00,0x07,0x05,0x86,0x00,0xF0,0x07,0x00,
+    0xFC,0x07,0x00,0xFE,0x07,0x00,0x1F,0x00,0x00,0x0F,0x00,0x80,0x07,0x00,0x80,0x03,0x00,0x02,0x85,0x80,0x07,0x00,0x00,0x07,
+    0x00,0x00,0x0F,0x06,0x00,0xFE,0x07,0x00,0xFC,0x07,0x00,0xF0,0x03,0x47,0x01,0x86,0x00,0x3F,0x00,0xC0,0xFF,0x00,0xC0,0xFF,
+    0x01,0xC0,0xC0,0x03,0x00,0x80,0x07,0x00,0x00,0x07,0x00,0x00,0x0E,0x01,0x88,0x00,0x00,0x1C,0x00,0x7C,0x1C,0x00,0xFF,0x1C,
+    0x80,0xFF,0x1D,0xC0,0x87,0x1F,0xC0,0x01,0x1E,0xE0,0x01,0x1E,0xE0,0x00,0x1E,0xE0,0x00,0x1C,0x00,0x80,0xE0,0x00,0x0E,0x00,
+    0x84,0xC0,0x01,0x0F,0xC0,0x83,0x07,0x80,0xFF,0x03,0x00,0xFF,0x01,0x00,0xFC,0x00,0x47,0x01,0x80,0xF0,0xFF,0x0F,0x01,0x80,
+    0xE0,0x00,0x00,0x00,0x80,0xC0,0x01,0x00,0x00,0x81,0x80,0x03,0x00,0x00,0x07,0x00,0x00,0x80,0x00,0x0E,0x00,0x00,0x89,0x00,
+    0x1C,0x00,0x00,0x3C,0x00,0x00,0x38,0x00,0x00,0x78,0x00,0x00,0x70,0x00,0x00,0xF0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x01,0x00,
+    0xC0,0x01,0x00,0xC0,0x03,0x00,0x80,0x00,0x80,0x07,0x01,0x47,0x01,0x84,0x00,0xFE,0x00,0x00,0xFF,0x03,0x80,0xFF,0x07,0xC0,
+    0x07,0x07,0xC0,0x01,0x0E,0x01,0x89,0xC0,0x01,0x0F,0x80,0x03,0x07,0x00,0xC7,0x07,0x00,0xEE,0x03,0x00,0xFC,0x01,0x00,0xFE,
+    0x01,0x00,0xBF,0x07,0x80,0x0F,0x07,0xC0,0x07,0x0E,0xE0,0x01,0x1C,0x00,0x80,0xE0,0x00,0x1C,0x01,0x84,0xE0,0x01,0x1E,0xC0,
+    0x83,0x0F,0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFC,0x00,0x47,0x01,0x85,0x00,0xFC,0x00,0x00,0xFE,0x03,0x00,0xFF,0x07,0x80,
+    0x07,0x0F,0xC0,0x03,0x0E,0xC0,0x01,0x1C,0x00,0x80,0xE0,0x00,0x1C,0x00,0x88,0xE0,0x01,0x1C,0xE0,0x01,0x1E,0xE0,0x03,0x0E,
+    0xE0,0x87,0x0F,0xE0,0xFE,0x07,0xE0,0xFC,0x03,0xE0,0xF8,0x01,0xE0,0x00,0x00,0xC0,0x01,0x00,0x01,0x85,0x80,0x03,0x00,0x80,
+    0x07,0x00,0x00,0x0F,0x0C,0x00,0xFE,0x0F,0x00,0xFC,0x0F,0x00,0xF0,0x03,0x47,0x08,0x80,0x00,0xF8,0x00,0x03,0x48,0x80,0x00,
+    0xF8,0x00,0x03,0x47,0x08,0x80,0x00,0xF8,0x00,0x03,0x48,0x80,0x00,0xF8,0x00,0x03,0x80,0x00,0x38,0x00,0x00,0x83,0x00,0x30,
+    0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xC0,0x00,0x41,0x08,0x92,0x10,0x00,0x00,0x70,0x00,0x00,0xF0,0x01,0x00,0xE0,0x07,
+    0x00,0x80,0x1F,0x00,0x00,0x3E,0x00,0x00,0xF8,0x00,0x00,0xE0,0x03,0x00,0xC0,0x0F,0x00,0x00,0x3F,0x00,0x80,0x0F,0x00,0xE0,
+    0x03,0x00,0xF8,0x00,0x00,0x3E,0x00,0x80,0x1F,0x00,0xE0,0x07,0x00,0xF0,0x01,0x00,0x70,0x00,0x00,0x10,0x00,0x00,0x47,0x0C,
+    0x80,0xF0,0xFF,0x3F,0x01,0x43,0x80,0xF0,0xFF,0x3F,0x01,0x4C,0x08,0x92,0x00,0x00,0x20,0x00,0x00,0x38,0x00,0x00,0x3E,0x00,
+    0x80,0x1F,0x00,0xE0,0x07,0x00,0xF0,0x01,0x00,0x7C,0x00,0x00,0x1F,0x00,0xC0,0x0F,0x00,0xF0,0x03,0x00,0xC0,0x07,0x00,0x00,
+    0x1F,0x00,0x00,0x7C,0x00,0x00,0xF0,0x01,0x00,0xE0,0x07,0x00,0x80,0x1F,0x00,0x00,0x3E,0x00,0x00,0x38,0x00,0x00,0x20,0x47,
+    0x01,0x86,0x00,0xFC,0x07,0x80,0xFF,0x1F,0xC0,0xFF,0x1F,0xE0,0x03,0x1C,0xE0,0x01,0x1C,0xE0,0x00,0x1C,0xE0,0x00,0x00,0x00,
+    0x88,0xC0,0x01,0x00,0x80,0x03,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0x60,
+    0x00,0x00,0xE0,0x00,0x01,0x42,0x80,0x00,0xE0,0x00,0x02,0x47,0x01,0x8C,0x00,0x7F,0x00,0xC0,0xFF,0x01,0xE0,0xC1,0x03,0xE0,
+    0x00,0x07,0x70,0x00,0x0E,0xF0,0x0F,0x1C,0xF0,0x1F,0x1C,0x70,0x38,0x38,0x70,0x70,0x38,0x70,0x70,0x78,0x70,0x60,0x70,0x70,
+    0xE0,0x70,0xF0,0xE0,0x70,0x00,0x80,0xF0,0xE1,0x70,0x00,0x89,0x70,0xE3,0x70,0x70,0xF7,0x70,0x70,0x7E,0x38,0x7C,0x7E,0x38,
+    0x7C,0x3C,0x1C,0x00,0x00,0x1C,0x00,0x00,0x0E,0x80,0x81,0x07,0x80,0xFF,0x03,0x00,0xFE,0x00,0x47,0x04,0x82,0x00,0x78,0x00,
+    0x00,0xF8,0x00,0x00,0xFC,0x00,0x00,0x8B,0x00,0xDC,0x01,0x00,0xDE,0x01,0x00,0x8E,0x03,0x00,0x8F,0x03,0x00,0x87,0x03,0x00,
+    0x07,0x07,0x80,0x07,0x07,0x80,0x03,0x0E,0xC0,0x03,0x0E,0xC0,0x01,0x0E,0xC0,0xFF,0x1F,0xE0,0xFF,0x1F,0x00,0x83,0xF0,0x00,
+    0x38,0x70,0x00,0x38,0x78,0x00,0x78,0x38,0x00,0x70,0x00,0x80,0x1C,0x00,0xE0,0x47,0x04,0x84,0x00,0xFC,0x1F,0x00,0xFF,0x1F,
+    0x80,0xFF,0x1F,0xC0,0x07,0x1C,0xC0,0x01,0x1C,0x01,0x88,0x80,0x03,0x1C,0x80,0x0F,0x1C,0x00,0xFE,0x1F,0x00,0xF8,0x1F,0x00,
+    0xFF,0x1F,0x80,0x0F,0x1C,0xC0,0x03,0x1C,0xE0,0x01,0x1C,0xE0,0x00,0x1C,0x02,0x83,0xC0,0x03,0x1C,0xC0,0xFF,0x1F,0x80,0xFF,
+    0x1F,0x00,0xFE,0x1F,0x47,0x04,0x88,0xE0,0x3F,0x00,0xF8,0xFF,0x00,0xF8,0xFF,0x03,0x38,0xE0,0x07,0x00,0x80,0x0F,0x00,0x00,
+    0x0E,0x00,0x00,0x1E,0x00,0x00,0x1C,0x00,0x00,0x38,0x04,0x88,0x00,0x00,0x3C,0x00,0x00,0x1C,0x00,0x00,0x1E,0x00,0x00,0x1F,
+    0x00,0x80,0x0F,0x38,0xE0,0x07,0xF8,0xFF,0x03,0xF8,0xFF,0x00,0xC0,0x3F,0x00,0x47,0x04,0x85,0x00,0xF0,0x3F,0x00,0xFE,0x3F,
+    0x00,0xFF,0x3F,0x80,0x0F,0x38,0xC0,0x03,0x38,0xC0,0x01,0x38,0x00,0x81,0xE0,0x01,0x38,0xE0,0x00,0x38,0x05,0x80,0xC0,0x01,
+    0x38,0x00,0x85,0xC0,0x03,0x38,0x80,0x07,0x38,0x80,0x1F,0x38,0x00,0xFF,0x3F,0x00,0xFC,0x3F,0x00,0xF0,0x3F,0x47,0x04,0x80,
+    0xE0,0xFF,0x0F,0x01,0x80,0x00,0x00,0x0E,0x05,0x80,0x80,0xFF,0x0F,0x01,0x80,0x00,0x00,0x0E,0x05,0x80,0xF0,0xFF,0x0F,0x01,
+    0x47,0x04,0x80,0xF0,0xFF,0x0F,0x01,0x80,0x00,0x00,0x0E,0x05,0x80,0xC0,0xFF,0x0F,0x01,0x80,0x00,0x00,0x0E,0x08,0x47,0x04,
+    0x88,0xC0,0x7F,0x00,0xF0,0xFF,0x01,0xF0,0xFF,0x07,0x70,0xC0,0x0F,0x00,0x00,0x1F,0x00,0x00,0x1C,0x00,0x00,0x3C,0x00,0x00,
+    0x38,0x00,0x00,0x70,0x01,0x80,0xF0,0x0F,0x70,0x01,0x88,0x70,0x00,0x78,0x70,0x00,0x38,0x70,0x00,0x3C,0x70,0x00,0x3E,0x70,
+    0x00,0x1F,0x70,0xE0,0x0F,0xF0,0xFF,0x07,0xF0,0xFF,0x01,0xC0,0x7F,0x00,0x47,0x04,0x80,0xE0,0x00,0x1C,0x08,0x80,0xE0,0xFF,
+    0x1F,0x01,0x80,0xE0,0x00,0x1C,0x08,0x47,0x04,0x80,0xC0,0xFF,0x1F,0x01,0x80,0x00,0x70,0x00,0x0F,0x80,0xC0,0xFF,0x1F,0x01,
+    0x47,0x04,0x80,0x00,0xFF,0x07,0x01,0x80,0x00,0x07,0x00,0x0D,0x84,0x00,0x0E,0x00,0x00,0x1E,0x10,0x00,0xFC,0x1F,0x00,0xF8,
+    0x1F,0x00,0xE0,0x0F,0x47,0x04,0x96,0xE0,0x01,0x1C,0xC0,0x03,0x1C,0x80,0x07,0x1C,0x00,0x0F,0x1C,0x00,0x1E,0x1C,0x00,0x1C,
+    0x1C,0x00,0x3C,0x1C,0x00,0x78,0x1C,0x00,0xF0,0x1C,0x00,0xE0,0x1D,0x00,0xC0,0x1D,0x00,0xE0,0x1F,0x00,0xE0,0x1D,0x00,0xF0,
+    0x1C,0x00,0x78,0x1C,0x00,0x3C,0x1C,0x00,0x1E,0x1C,0x00,0x0F,0x1C,0x80,0x07,0x1C,0xC0,0x03,0x1C,0xE0,0x01,0x1C,0xF0,0x00,
+    0x1C,0xF8,0x00,0x1C,0x47,0x04,0x80,0x00,0x00,0x0E,0x12,0x80,0xF0,0xFF,0x0F,0x01,0x47,0x04,0x80,0xF8,0x00,0x3E,0x00,0x81,
+    0xF8,0x00,0x3F,0xF8,0x01,0x3F,0x00,0x81,0xB8,0x81,0x3B,0xB8,0x83,0x3B,0x00,0x86,0x38,0xC3,0x39,0x38,0xC7,0x39,0x38,0xC6,
+    0x39,0x38,0xE6,0x38,0x38,0xEE,0x38,0x38,0xEC,0x38,0x38,0x7C,0x38,0x00,0x80,0x38,0x38,0x38,0x00,0x80,0x38,0x00,0x38,0x03,
+    0x47,0x04,0x80,0x70,0x00,0x1E,0x00,0x81,0x70,0x00,0x1F,0x70,0x80,0x1F,0x00,0x8E,0x70,0xC0,0x1F,0x70,0xC0,0x1D,0x70,0xE0,
+    0x1C,0x70,0xF0,0x1C,0x70,0x70,0x1C,0x70,0x78,0x1C,0x70,0x38,0x1C,0x70,0x3C,0x1C,0x70,0x1C,0x1C,0x70,0x0E,0x1C,0x70,0x0F,
+    0x1C,0x70,0x07,0x1C,0xF0,0x07,0x1C,0xF0,0x03,0x1C,0xF0,0x01,0x1C,0x00,0x80,0xF0,0x00,0x1C,0x00,0x47,0x04,0x85,0x00,0xFC,
+    0x01,0x00,0xFF,0x07,0x80,0xFF,0x0F,0xC0,0x07,0x1F,0xC0,0x01,0x1C,0xE0,0x00,0x38,0x00,0x81,0xF0,0x00,0x78,0x70,0x00,0x70,
+    0x05,0x81,0xF0,0x00,0x78,0xE0,0x00,0x38,0x00,0x84,0xC0,0x01,0x1C,0xC0,0x07,0x1F,0x80,0xFF,0x0F,0x00,0xFF,0x07,0x00,0xFC,
+    0x01,0x47,0x04,0x85,0x00,0xFF,0x0F,0xC0,0xFF,0x0F,0xE0,0xFF,0x0F,0xE0,0x01,0x0E,0xF0,0x00,0x0E,0x70,0x00,0x0E,0x02,0x85,
+    0xE0,0x00,0x0E,0xE0,0x03,0x0E,0xC0,0xFF,0x0F,0x00,0xFF,0x0F,0x00,0xFC,0x0F,0x00,0x00,0x0E,0x07,0x47,0x04,0x85,0x00,0xFC,
+    0x01,0x00,0xFF,0x07,0x80,0xFF,0x0F,0xC0,0x07,0x1F,0xC0,0x01,0x1C,0xE0,0x00,0x38,0x00,0x81,0xF0,0x00,0x78,0x70,0x00,0x70,
+    0x05,0x81,0xE0,0x00,0x78,0xE0,0x00,0x38,0x00,0x89,0xC0,0x01,0x1C,0xC0,0x07,0x1F,0x80,0xFF,0x0F,0x00,0xFE,0x03,0x00,0xFE,
+    0x01,0x80,0x07,0x00,0xF0,0x03,0x00,0xFC,0x01,0x00,0x78,0x00,0x00,0x10,0x00,0x00,0x42,0x04,0x84,0x00,0xF8,0x1F,0x00,0xFE,
+    0x1F,0x00,0xFF,0x1F,0x80,0x0F,0x1C,0x80,0x03,0x1C,0x02,0x84,0x80,0x07,0x1C,0x00,0x07,0x1C,0x00,0x1F,0x1C,0x00,0xFE,0x1F,
+    0x00,0xF8,0x1F,0x00,0x80,0x00,0x3C,0x1C,0x00,0x86,0x00,0x1E,0x1C,0x00,0x0F,0x1C,0x80,0x07,0x1C,0xC0,0x03,0x1C,0xC0,0x01,
+    0x1C,0xE0,0x01,0x1C,0xF0,0x00,0x1C,0x47,0x04,0x84,0x00,0xFE,0x01,0xC0,0xFF,0x07,0xC0,0xFF,0x0F,0xC0,0x01,0x0F,0x00,0x00,
+    0x1C,0x01,0x88,0x00,0x00,0x1E,0x00,0x00,0x1F,0x00,0xE0,0x0F,0x00,0xFC,0x07,0x00,0xFF,0x01,0x80,0x3F,0x00,0xC0,0x0F,0x00,
+    0xE0,0x01,0x00,0xE0,0x00,0x00,0x01,0x84,0xE0,0x01,0x10,0xC0,0x03,0x1E,0x80,0xFF,0x1F,0x00,0xFF,0x1F,0x00,0xFC,0x03,0x47,
+    0x04,0x80,0xF8,0xFF,0xFF,0x01,0x80,0x00,0x70,0x00,0x12,0x47,0x04,0x80,0xE0,0x00,0x1C,0x0F,0x85,0xE0,0x01,0x1E,0xC0,0x01,
+    0x0E,0xC0,0x07,0x0F,0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFC,0x00,0x47,0x04,0x81,0x1C,0x00,0xF0,0x38,0x00,0x70,0x00,0x83,
+    0x70,0x00,0x78,0x70,0x00,0x38,0xF0,0x00,0x3C,0xE0,0x00,0x1C,0x00,0x82,0xC0,0x01,0x1E,0xC0,0x01,0x0E,0x80,0x03,0x0F,0x00,
+    0x83,0x80,0x07,0x07,0x00,0x87,0x07,0x00,0x8F,0x03,0x00,0xCE,0x03,0x00,0x83,0x00,0xDC,0x01,0x00,0xFC,0x01,0x00,0xFC,0x00,
+    0x00,0xF8,0x00,0x00,0x80,0x00,0x70,0x00,0x47,0x04,0x80,0x1C,0x00,0xE0,0x01,0x80,0x18,0x00,0x70,0x00,0x80,0x38,0x78,0x70,
+    0x01,0x84,0x38,0x7C,0x70,0x30,0xFC,0x70,0x30,0xFC,0x38,0x30,0xDC,0x38,0x70,0xCE,0x38,0x00,0x82,0x70,0xCE,0x39,0x60,0xCE,
+    0x39,0x60,0x87,0x1D,0x01,0x82,0xE0,0x87,0x1F,0xE0,0x03,0x1F,0xC0,0x03,0x1F,0x00,0x47,0x04,0x8A,0x3C,0x00,0x78,0x78,0x00,
+    0x3C,0xF0,0x00,0x1E,0xE0,0x01,0x0E,0xC0,0x03,0x0F,0x80,0x83,0x07,0x80,0xC7,0x03,0x00,0xCF,0x01,0x00,0xFE,0x01,0x00,0xFC,
+    0x00,0x00,0x78,0x00,0x00,0x8A,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xCF,0x01,0x00,0x87,0x03,0x80,0x87,0x07,0xC0,0x03,0x0F,
+    0xE0,0x01,0x0E,0xE0,0x00,0x1C,0xF0,0x00,0x38,0x78,0x00,0x78,0x3C,0x00,0xF0,0x47,0x04,0x8B,0x3C,0x00,0x78,0x38,0x00,0x3C,
+    0x70,0x00,0x1E,0xF0,0x00,0x1E,0xE0,0x00,0x0F,0xC0,0x01,0x07,0xC0,0x83,0x07,0x80,0xC3,0x03,0x00,0xC7,0x01,0x00,0xEF,0x01,
+    0x00,0xFE,0x00,0x00,0x7C,0x00,0x00,0x80,0x00,0x38,0x00,0x08,0x47,0x04,0x80,0xF0,0xFF,0x1F,0x01,0x91,0xF0,0x00,0x00,0xE0,
+    0x01,0x00,0xC0,0x03,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x0E,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,
+    0xF0,0x00,0x00,0xE0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x03,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x3C,0xF0,
+    0xFF,0x3F,0x01,0x47,0x80,0xE0,0xFF,0x00,0x01,0x80,0x00,0xE0,0x00,0x19,0x80,0xE0,0xFF,0x00,0x01,0x42,0x81,0x00,0x00,0x70,
+    0x00,0x00,0x38,0x00,0x80,0x00,0x00,0x1C,0x00,0x80,0x00,0x00,0x0E,0x00,0x80,0x00,0x00,0x07,0x00,0x80,0x00,0x80,0x03,0x00,
+    0x80,0x00,0xC0,0x01,0x00,0x80,0x00,0xE0,0x00,0x00,0x83,0x00,0x70,0x00,0x00,0x78,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,
+    0x80,0x00,0x0E,0x00,0x00,0x80,0x00,0x07,0x00,0x00,0x80,0x80,0x03,0x00,0x00,0x80,0xC0,0x01,0x00,0x00,0x80,0xE0,0x00,0x00,
+    0x00,0x80,0x70,0x00,0x00,0x00,0x80,0x38,0x00,0x00,0x42,0x80,0x00,0xFC,0x1F,0x01,0x80,0x00,0x1C,0x00,0x19,0x80,0x00,0xFC,
+    0x1F,0x01,0x42,0x01,0x80,0x00,0x20,0x00,0x00,0x80,0x00,0x70,0x00,0x00,0x81,0x00,0x78,0x00,0x00,0xF8,0x00,0x00,0x80,0x00,
+    0xDC,0x01,0x00,0x86,0x00,0x8E,0x01,0x00,0x8E,0x03,0x00,0x87,0x03,0x00,0x07,0x07,0x80,0x03,0x07,0x80,0x03,0x06,0xC0,0x01,
+    0x0E,0x00,0x81,0xC0,0x01,0x1C,0xE0,0x00,0x1C,0x00,0x80,0x70,0x00,0x38,0x4C,0x1B,0x80,0xFC,0xFF,0xFF,0x01,0x44,0x83,0x00,
+    0xF0,0x00,0x00,0x78,0x00,0x00,0x3C,0x00,0x00,0x0E,0x00,0x5F,0x08,0x81,0x00,0xFC,0x01,0x00,0xFF,0x0F,0x00,0x81,0x80,0x07,
+    0x0E,0x80,0x03,0x00,0x02,0x84,0x80,0xFF,0x01,0x80,0xFF,0x07,0x80,0x03,0x0F,0x80,0x03,0x1C,0x80,0x03,0x38,0x00,0x84,0x80,
+    0x07,0x38,0x80,0x1F,0x3C,0xF0,0xFD,0x1F,0xF0,0xF9,0x0F,0xF0,0xE0,0x07,0x47,0x80,0x00,0x00,0x1C,0x07,0x86,0x00,0x3E,0x1C,
+    0x00,0xFF,0x1C,0x80,0xFF,0x1D,0xC0,0x83,0x1F,0xC0,0x01,0x1F,0xE0,0x01,0x1E,0xE0,0x00,0x1C,0x05,0x85,0xC0,0x01,0x1C,0xC0,
+    0x03,0x1E,0x80,0x87,0x1F,0x80,0xFF,0x1F,0x00,0xFF,0x1D,0x00,0x7C,0x18,0x47,0x08,0x87,0xC0,0x3F,0x00,0xF0,0xFF,0x01,0xF0,
+    0xFF,0x03,0x70,0xC0,0x07,0x00,0x00,0x0F,0x00,0x00,0x0E,0x00,0x00,0x1E,0x00,0x00,0x1C,0x03,0x86,0x00,0x00,0x1E,0x00,0x00,
+    0x0E,0x00,0x00,0x0F,0x30,0xC0,0x07,0xF0,0xFF,0x03,0xF0,0xFF,0x01,0xC0,0x3F,0x00,0x47,0x80,0xC0,0x01,0x00,0x07,0x86,0xC0,
+    0xF1,0x01,0xC0,0xFD,0x07,0xC0,0xFF,0x0F,0xC0,0x0F,0x0F,0xC0,0x03,0x1E,0xC0,0x01,0x1C,0xC0,0x01,0x38,0x05,0x85,0xC0,0x03,
+    0x3C,0xC0,0x07,0x1C,0xC0,0x0F,0x1E,0xC0,0xFD,0x0F,0xC0,0xF9,0x07,0xC0,0xE1,0x03,0x47,0x08,0x87,0x00,0xFC,0x00,0x00,0xFF,
+    0x03,0x00,0xFF,0x07,0x80,0x07,0x0F,0x80,0x03,0x1C,0xC0,0x01,0x1C,0xC0,0x01,0x38,0xC0,0xFF,0x3F,0x01,0x80,0x00,0x00,0x38,
+    0x00,0x86,0x00,0x00,0x3C,0x00,0x00,0x1C,0x00,0x00,0x1E,0xC0,0x81,0x0F,0xC0,0xFF,0x0F,0xC0,0xFF,0x03,0x00,0xFE,0x00,0x47,
+    0x85,0xF8,0x0F,0x00,0xFC,0x3F,0x00,0xFC,0x7F,0x00,0x04,0x78,0x00,0x00,0xF0,0x00,0x00,0xE0,0x00,0x02,0x80,0xF8,0xFF,0x1F,
+    0x01,0x80,0x00,0xE0,0x00,0x0E,0x47,0x08,0x86,0xC0,0xF1,0x01,0xC0,0xFD,0x07,0xC0,0xFF,0x0F,0xC0,0x0F,0x0F,0xC0,0x03,0x1E,
+    0xC0,0x01,0x1C,0xC0,0x01,0x38,0x05,0x86,0xC0,0x03,0x3C,0xC0,0x07,0x1C,0xC0,0x0F,0x1E,0xC0,0xFD,0x0F,0xC0,0xF9,0x07,0xC0,
+    0xE1,0x03,0xC0,0x01,0x00,0x00,0x84,0x80,0x03,0x00,0x80,0x07,0x0E,0x00,0xFF,0x0F,0x00,0xFE,0x0F,0x00,0xF8,0x03,0x40,0x80,
+    0x00,0x00,0x1C,0x07,0x86,0x00,0x3E,0x1C,0x80,0xFF,0x1C,0x80,0xFF,0x1D,0xC0,0xC3,0x1F,0xC0,0x01,0x1F,0xC0,0x01,0x1E,0xC0,
+    0x01,0x1C,0x0B,0x47,0x00,0x80,0x00,0x78,0x00,0x02,0x43,0x80,0x00,0xF8,0x1F,0x01,0x80,0x00,0x38,0x00,0x0E,0x47,0x00,0x80,
+    0x00,0x1E,0x00,0x02,0x43,0x80,0x00,0xFE,0x0F,0x01,0x80,0x00,0x0E,0x00,0x10,0x84,0x00,0x1E,0x00,0x00,0x1C,0x18,0x00,0xFC,
+    0x1F,0x00,0xF8,0x1F,0x00,0xE0,0x07,0x40,0x80,0x00,0x00,0x0E,0x07,0x92,0xF0,0x01,0x0E,0xE0,0x03,0x0E,0xC0,0x07,0x0E,0x80,
+    0x0F,0x0E,0x00,0x1F,0x0E,0x00,0x3E,0x0E,0x00,0x7C,0x0E,0x00,0x78,0x0E,0x00,0xF0,0x0E,0x00,0xE0,0x0F,0x00,0xF0,0x0E,0x00,
+    0x78,0x0E,0x00,0x3C,0x0E,0x00,0x1E,0x0E,0x00,0x0F,0x0E,0x80,0x07,0x0E,0xC0,0x03,0x0E,0xE0,0x01,0x0E,0xF0,0x00,0x0E,0x47,
+    0x80,0x00,0xF8,0x1F,0x01,0x80,0x00,0x38,0x00,0x17,0x47,0x08,0x86,0xE0,0xE1,0x38,0xE0,0xF3,0x39,0xF0,0xF3,0x3B,0x70,0x3E,
+    0x3F,0x70,0x3C,0x3E,0x70,0x3C,0x3C,0x70,0x38,0x38,0x0B,0x47,0x08,0x86,0x00,0x3E,0x1C,0x80,0xFF,0x1C,0x80,0xFF,0x1D,0xC0,
+    0xC3,0x1F,0xC0,0x01,0x1F,0xC0,0x01,0x1E,0xC0,0x01,0x1C,0x0B,0x47,0x08,0x86,0x00,0xFC,0x01,0x00,0xFF,0x07,0x80,0xFF,0x0F,
+    0x80,0x07,0x0F,0xC0,0x03,0x1E,0xC0,0x01,0x1C,0xE0,0x00,0x38,0x05,0x85,0xC0,0x01,0x1C,0xC0,0x03,0x1E,0x80,0x07,0x0F,0x80,
+    0xFF,0x0F,0x00,0xFF,0x07,0x00,0xFC,0x01,0x47,0x08,0x86,0x00,0x3E,0x1C,0x00,0xFF,0x1C,0x80,0xFF,0x1D,0xC0,0x83,0x1F,0xC0,
+    0x01,0x1F,0xE0,0x01,0x1E,0xE0,0x00,0x1C,0x05,0x86,0xC0,0x01,0x1C,0xC0,0x03,0x1E,0x80,0x87,0x1F,0x80,0xFF,0x1F,0x00,0xFF,
+    0x1D,0x00,0x7C,0x1C,0x00,0x00,0x1C,0x05,0x40,0x08,0x86,0xC0,0xF9,0x01,0xC0,0xFD,0x07,0xC0,0xFF,0x0F,0xC0,0x0F,0x0F,0xC0,
+    0x03,0x1E,0xC0,0x01,0x1C,0xC0,0x01,0x38,0x05,0x86,0xC0,0x03,0x3C,0xC0,0x07,0x1C,0xC0,0x0F,0x1E,0xC0,0xFD,0x0F,0xC0,0xF9,
+    0x07,0xC0,0xE1,0x03,0xC0,0x01,0x00,0x05,0x40,0x08,0x86,0xE0,0x0F,0x07,0xE0,0x3F,0x07,0xE0,0x7F,0x07,0xE0,0xF0,0x07,0xE0,
+    0xC0,0x07,0xE0,0x80,0x07,0x00,0x00,0x07,0x0B,0x47,0x08,0x84,0x00,0xFE,0x00,0x80,0xFF,0x03,0x80,0xFF,0x07,0x80,0x01,0x0F,
+    0x00,0x00,0x0E,0x00,0x86,0x00,0x00,0x0F,0x00,0xE0,0x07,0x00,0xFC,0x03,0x00,0xFF,0x01,0x80,0x3F,0x00,0xC0,0x07,0x00,0xC0,
+    0x01,0x00,0x00,0x84,0xC0,0x01,0x08,0xC0,0x07,0x0E,0x80,0xFF,0x0F,0x00,0xFF,0x0F,0x00,0xFC,0x01,0x47,0x04,0x80,0x00,0xC0,
+    0x01,0x02,0x80,0xE0,0xFF,0x3F,0x01,0x80,0x00,0xC0,0x01,0x0A,0x81,0x00,0xF0,0x01,0xE0,0xFF,0x00,0x00,0x80,0xE0,0x3F,0x00,
+    0x47,0x08,0x80,0xC0,0x01,0x1C,0x0B,0x85,0xC0,0x03,0x1C,0xC0,0x07,0x1C,0xC0,0x1F,0x1E,0xC0,0xFD,0x0F,0xC0,0xF9,0x0F,0xC0,
+    0xE1,0x03,0x47,0x08,0x81,0x78,0x00,0x70,0x70,0x00,0x38,0x00,0x8D,0xE0,0x00,0x3C,0xE0,0x00,0x1C,0xC0,0x01,0x1E,0xC0,0x01,
+    0x0E,0x80,0x03,0x0E,0x80,0x03,0x07,0x80,0x07,0x07,0x00,0x87,0x07,0x00,0x8F,0x03,0x00,0xCE,0x03,0x00,0xCE,0x01,0x00,0xDC,
+    0x01,0x00,0xFC,0x00,0x00,0xF8,0x00,0x00,0x80,0x00,0x70,0x00,0x47,0x08,0x84,0x1C,0x00,0xE0,0x1C,0x00,0xF0,0x18,0x78,0xF0,
+    0x18,0x78,0x70,0x38,0x7C,0x70,0x00,0x83,0x38,0xFC,0x70,0x30,0xCC,0x78,0x30,0xCE,0x38,0x70,0xCE,0x39,0x00,0x84,0x70,0x86,
+    0x39,0x60,0x87,0x3D,0x60,0x87,0x1F,0x60,0x07,0x1F,0xE0,0x03,0x1F,0x00,0x81,0xC0,0x03,0x1F,0xC0,0x03,0x0E,0x47,0x08,0x88,
+    0xF0,0x00,0x3C,0xE0,0x00,0x1E,0xC0,0x01,0x0F,0xC0,0x83,0x07,0x80,0x83,0x03,0x00,0xC7,0x03,0x00,0xEF,0x01,0x00,0xFE,0x00,
+    0x00,0x7C,0x00,0x00,0x88,0x00,0xFC,0x00,0x00,0xFE,0x00,0x00,0xCF,0x01,0x80,0xC7,0x03,0x80,0x83,0x07,0xC0,0x03,0x07,0xE0,
+    0x01,0x0E,0xF0,0x00,0x1E,0x78,0x00,0x3C,0x47,0x08,0x81,0x38,0x00,0x78,0x70,0x00,0x38,0x00,0x80,0xE0,0x00,0x1C,0x00,0x80,
+    0xC0,0x01,0x0E,0x00,0x85,0xC0,0x01,0x0F,0x80,0x03,0x07,0x80,0x83,0x07,0x00,0x87,0x03,0x00,0xC7,0x03,0x00,0xCE,0x01,0x00,
+    0x80,0x00,0xFC,0x00,0x00,0x80,0x00,0x78,0x00,0x00,0x80,0x00,0x70,0x00,0x00,0x85,0x00,0xE0,0x00,0x00,0xE0,0x01,0x00,0xC0,
+    0x03,0x00,0xC0,0x3F,0x00,0x80,0x3F,0x00,0x00,0x3E,0x40,0x08,0x80,0xE0,0xFF,0x3F,0x01,0x8D,0xE0,0x03,0x00,0xC0,0x07,0x00,
+    0x80,0x0F,0x00,0x00,0x1F,0x00,0x00,0x3E,0x00,0x00,0x7C,0x00,0x00,0xF8,0x00,0x00,0xF0,0x01,0x00,0xE0,0x03,0x00,0xC0,0x07,
+    0x00,0x80,0x0F,0x00,0x00,0x1F,0x00,0x00,0x3E,0xE0,0xFF,0x3F,0x01,0x47,0x81,0xC0,0x0F,0x00,0xC0,0x3F,0x00,0x00,0x81,0x00,
+    0x78,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x38,0x00,0x03,0x85,0x00,0xF0,0x00,0x00,0xE0,0x0F,0x00,0x80,0x0F,0x00,0xE0,0x0F,
+    0x00,0xF0,0x00,0x00,0x38,0x00,0x03,0x80,0x00,0x70,0x00,0x03,0x83,0x00,0x78,0x00,0xC0,0x3F,0x00,0xC0,0x1F,0x00,0xC0,0x0F,
+    0x00,0x42,0x80,0x00,0x38,0x00,0x1F,0x42,0x84,0x00,0xC0,0x0F,0x00,0xE0,0x0F,0x00,0xF0,0x0F,0x00,0x78,0x00,0x00,0x38,0x00,
+    0x03,0x80,0x00,0x70,0x00,0x03,0x85,0x00,0x3C,0x00,0xC0,0x1F,0x00,0xC0,0x07,0x00,0xC0,0x1F,0x00,0x00,0x3C,0x00,0x00,0x70,
+    0x00,0x03,0x80,0x00,0x38,0x00,0x03,0x81,0x00,0x78,0x00,0x00,0xF0,0x0F,0x00,0x80,0x00,0xC0,0x0F,0x42,0x0D,0x87,0x00,0x00,
+    0x0F,0x18,0xC0,0x1F,0x18,0xE0,0x3F,0x38,0xF8,0x30,0x30,0x7C,0x70,0xF0,0x1F,0x60,0xE0,0x0F,0x60,0xC0,0x03,0x00,0x4D,0x04,
+    0x80,0x80,0xFF,0x0F,0x00,0x80,0x80,0x00,0x0C,0x12,0x80,0x80,0xFF,0x0F,0x47,0x01,0x99,0x00,0x20,0x00,0x00,0x30,0x00,0x00,
+    0x70,0x00,0x00,0xF8,0x00,0x00,0xFC,0x01,0x00,0xFE,0x01,0x00,0xFF,0x03,0x00,0xFF,0x07,0x80,0xFF,0x0F,0xE0,0xFF,0x1F,0xF0,
+    0xFF,0x3F,0xF8,0xFF,0x7F,0xFC,0xFF,0xFF,0xF8,0xFF,0x7F,0xF0,0xFF,0x3F,0xE0,0xFF,0x1F,0xC0,0xFF,0x0F,0x80,0xFF,0x07,0x00,
+    0xFF,0x07,0x00,0xFE,0x03,0x00,0xFC,0x01,0x00,0xFC,0x00,0x00,0xF8,0x00,0x00,0x70,0x00,0x00,0x30,0x00,0x00,0x20,0x00,0x47,
+    0x80,0xC0,0xE3,0xF1,0x02,0x42,0x80,0xC0,0xE3,0xF1,0x02,0x42,0x80,0xC0,0xE3,0xF1,0x02,0x43,0x80,0xC0,0xE3,0xF1,0x02,0x42,
+    0x80,0xC0,0xE3,0xF1,0x02,0x42,0x80,0x00,0x38,0x00,0x0E,0x80,0x00,0xF8,0xFF,0x01,0x50,0x0F,0x80,0x00,0xF8,0xFF,0x01,0x80,
+    0x00,0x38,0x00,0x0F,0x0F,0x80,0xFC,0x3F,0x00,0x01,0x80,0x00,0x38,0x00,0x0F,0x80,0x00,0x38,0x00,0x0E,0x80,0xFC,0x3F,0x00,
+    0x01,0x50,0x80,0x00,0x38,0x00,0x0E,0x80,0xFC,0xFF,0xFF,0x01,0x80,0x00,0x38,0x00,0x0F,0x0F,0x80,0xFC,0xFF,0xFF,0x01,0x50,
+    0x80,0x00,0x38,0x00,0x0E,0x80,0xFC,0x3F,0x00,0x01,0x80,0x00,0x38,0x00,0x0F,0x80,0x00,0x38,0x00,0x0E,0x80,0x00,0xF8,0xFF,
+    0x01,0x80,0x00,0x38,0x00,0x0F,0x0F,0x80,0xFC,0xFF,0xFF,0x01,0x80,0x00,0x38,0x00,0x0F,0x80,0x00,0x38,0x00,0x22,0x08,0x80,
+    0x00,0x38,0x00,0x02,0x42,0x80,0x00,0x38,0x00,0x11,0x40,0x01,0x80,0x00,0x30,0x00,0x01,0x86,0x00,0xFE,0x00,0x80,0xFF,0x01,
+    0x80,0xFF,0x07,0x80,0xB1,0x07,0x00,0x30,0x0F,0x00,0x30,0x0E,0x00,0x30,0x1C,0x05,0x87,0x00,0x30,0x1E,0x00,0x30,0x0E,0x00,
+    0x30,0x0F,0x80,0xB1,0x07,0x80,0xFF,0x07,0x80,0xFF,0x03,0x00,0xFE,0x00,0x00,0x30,0x00,0x01,0x47,0x01,0x84,0xC0,0x0F,0x00,
+    0xC0,0x3F,0x00,0xC0,0x7F,0x00,0x40,0x70,0x00,0x00,0xE0,0x00,0x05,0x80,0x00,0xFC,0x07,0x01,0x80,0x00,0xE0,0x00,0x04,0x83,
+    0x00,0xC0,0x01,0x00,0x80,0x01,0x00,0x80,0x07,0xC0,0xFF,0x0F,0x01,0x47,0x05,0x87,0x20,0x00,0x10,0x70,0x00,0x38,0xE0,0x78,
+    0x1C,0xC0,0xFF,0x0F,0x80,0xFF,0x07,0x80,0x87,0x07,0xC0,0x03,0x0F,0xC0,0x01,0x0E,0x02,0x86,0xC0,0x03,0x0F,0x80,0x87,0x07,
+    0x80,0xFF,0x07,0xC0,0xFF,0x0F,0xE0,0x78,0x1C,0x70,0x00,0x38,0x20,0x00,0x10,0x4B,0x01,0x8D,0x1C,0x00,0x7C,0x38,0x00,0x3C,
+    0x70,0x00,0x1E,0xE0,0x00,0x1E,0xE0,0x01,0x0F,0xC0,0x01,0x0F,0x80,0x83,0x07,0x00,0xC7,0x03,0x00,0xCF,0x03,0x00,0xEE,0x01,
+    0x00,0xFC,0x01,0x00,0xF8,0x00,0x00,0x78,0x00,0x80,0xFF,0x0F,0x00,0x80,0x00,0x70,0x00,0x02,0x80,0x80,0xFF,0x0F,0x00,0x80,
+    0x00,0x70,0x00,0x03,0x47,0x80,0x00,0x38,0x00,0x0B,0x46,0x80,0x00,0x38,0x00,0x0B,0x42,0x01,0x84,0x00,0xFF,0x00,0x80,0xFF,
+    0x03,0x80,0xFF,0x07,0x80,0x81,0x07,0x00,0x00,0x0E,0x01,0x92,0x00,0x00,0x0F,0x00,0xC0,0x07,0x00,0xF0,0x07,0x00,0xFC,0x03,
+    0x00,0xFE,0x03,0x80,0x1F,0x07,0x80,0x07,0x0E,0xC0,0x03,0x0E,0xC0,0x01,0x0E,0xC0,0x01,0x0F,0xC0,0x81,0x0F,0x80,0xC1,0x07,
+    0x80,0xFB,0x03,0x00,0xFF,0x01,0x00,0x7F,0x00,0x80,0x1F,0x00,0x80,0x07,0x00,0xC0,0x03,0x00,0xC0,0x01,0x00,0x00,0x84,0xC0,
+    0x01,0x08,0x80,0x07,0x0F,0x80,0xFF,0x0F,0x00,0xFF,0x0F,0x00,0xFC,0x01,0x41,0x80,0x80,0x03,0x07,0x01,0x60,0x01,0x8B,0x00,
+    0xFC,0x01,0x00,0xFF,0x07,0x80,0x07,0x0F,0xC0,0x01,0x1C,0xC0,0x00,0x18,0x60,0x00,0x30,0x60,0x7C,0x30,0x60,0xFE,0x31,0x30,
+    0xFE,0x63,0x30,0xC2,0x63,0x30,0x80,0x67,0x30,0x00,0x67,0x02,0x8A,0x30,0x80,0x67,0x30,0xC2,0x63,0x30,0xFE,0x63,0x60,0xFE,
+    0x31,0x60,0x78,0x30,0x60,0x00,0x30,0xC0,0x00,0x18,0xC0,0x01,0x1C,0x80,0x07,0x0F,0x00,0xFF,0x07,0x00,0xFC,0x01,0x47,0x01,
+    0x83,0x00,0xFC,0x01,0x00,0xFE,0x07,0x00,0x0F,0x06,0x00,0x07,0x00,0x00,0x83,0x00,0xFF,0x00,0x00,0xFF,0x07,0x00,0x07,0x07,
+    0x00,0x07,0x0E,0x00,0x82,0x00,0x1F,0x0F,0xC0,0xFF,0x07,0xC0,0xE3,0x03,0x54,0x0A,0x8E,0x80,0x40,0x00,0xC0,0xE1,0x00,0x80,
+    0xC3,0x01,0x00,0x87,0x03,0x00,0x0E,0x07,0x00,0x1C,0x0E,0x00,0x38,0x1C,0x00,0x70,0x38,0x00,0x38,0x1C,0x00,0x1C,0x0E,0x00,
+    0x0E,0x07,0x00,0x87,0x03,0x80,0xC3,0x01,0xC0,0xE1,0x00,0x80,0x40,0x00,0x49,0x0D,0x80,0xF8,0xFF,0x3F,0x01,0x80,0x38,0x00,
+    0x00,0x04,0x4C,0x0E,0x80,0xC0,0xFF,0x0F,0x01,0x51,0x01,0x8F,0x00,0xFC,0x00,0x00,0xFF,0x03,0x80,0x87,0x07,0xC0,0xF9,0x0E,
+    0xC0,0xCC,0x0C,0xE0,0xCC,0x1C,0x60,0xCC,0x18,0x60,0xF0,0x18,0x60,0xD0,0x18,0x60,0xD8,0x18,0xE0,0xD8,0x1C,0xC0,0xCC,0x0C,
+    0xC0,0x01,0x0E,0x80,0x87,0x07,0x00,0xFF,0x03,0x00,0xFC,0x00,0x51,0x80,0xFC,0xFF,0xFF,0x01,0x60,0x01,0x83,0x00,0xF0,0x00,
+    0x00,0xF8,0x01,0x00,0x9C,0x03,0x00,0x0C,0x03,0x00,0x82,0x00,0x9C,0x03,0x00,0xF8,0x01,0x00,0xF0,0x00,0x59,0x08,0x80,0x00,
+    0x38,0x00,0x03,0x80,0xF8,0xFF,0x3F,0x01,0x80,0x00,0x38,0x00,0x03,0x42,0x80,0xF8,0xFF,0x3F,0x01,0x47,0x01,0x83,0x00,0xFC,
+    0x03,0x00,0xFE,0x07,0x00,0x0F,0x06,0x00,0x07,0x00,0x00,0x86,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x78,0x00,0x00,0xE0,0x01,
+    0x00,0xC0,0x03,0x00,0x00,0x07,0x00,0xFF,0x07,0x00,0x54,0x01,0x85,0x00,0xFE,0x01,0x80,0xFF,0x03,0x80,0x03,0x03,0x80,0x03,
+    0x00,0x00,0x07,0x00,0x00,0xFE,0x00,0x00,0x81,0x00,0x07,0x00,0x80,0x03,0x00,0x00,0x82,0x80,0x07,0x03,0x00,0xFF,0x03,0x00,
+    0xFC,0x01,0x54,0x83,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x00,0xC0,0x01,0x5F,0x08,0x80,0xC0,0x01,0x1C,0x0B,0x86,
+    0xC0,0x03,0x1E,0xC0,0x07,0x1E,0xC0,0x8F,0x1F,0xC0,0xFD,0x1F,0xC0,0xFD,0x1D,0xE0,0xF0,0x1C,0x00,0x00,0x1C,0x05,0x40,0x01,
+    0x83,0xC0,0xFF,0x07,0xC0,0xFF,0x1F,0xC0,0xE0,0x1F,0xC0,0xE0,0x3F,0x04,0x84,0xC0,0xE0,0x1F,0xC0,0xE0,0x0F,0xC0,0xE0,0x07,
+    0xC0,0xE0,0x01,0xC0,0x60,0x00,0x10,0x42,0x0F,0x80,0x00,0x78,0x00,0x02,0x4F,0x1B,0x84,0x00,0x30,0x00,0x00,0x20,0x00,0x00,
+    0x78,0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x00,0x81,0x00,0xFC,0x00,0x00,0xF8,0x00,0x01,0x80,0x00,0xF0,0x03,0x00,0x80,0x00,
+    0x70,0x00,0x09,0x54,0x01,0x84,0x00,0xFC,0x00,0x00,0xFF,0x03,0x80,0x87,0x07,0x80,0x03,0x07,0xC0,0x01,0x0E,0x03,0x83,0x80,
+    0x03,0x07,0x80,0x87,0x07,0x00,0xFF,0x03,0x00,0xFC,0x00,0x54,0x0A,0x8E,0x00,0x08,0x08,0x00,0x1C,0x1C,0x00,0x0E,0x0E,0x00,
+    0x07,0x07,0x80,0x83,0x03,0xC0,0xC1,0x01,0xE0,0xE0,0x00,0x70,0x70,0x00,0xE0,0xE0,0x00,0xC0,0xC1,0x01,0x80,0x83,0x03,0x00,
+    0x07,0x07,0x00,0x0E,0x0E,0x00,0x1C,0x1C,0x00,0x08,0x08,0x49,0x01,0x83,0xC0,0x01,0xF8,0x80,0x03,0xF8,0x80,0x03,0x38,0x00,
+    0x07,0x38,0x00,0x83,0x00,0x0E,0x38,0x00,0x1E,0x38,0x00,0x1C,0x38,0x00,0x38,0x38,0x00,0x80,0x00,0x70,0x38,0x00,0x8B,0xF0,
+    0xE0,0x38,0xF0,0xE1,0x00,0xF0,0xC3,0x01,0x70,0xC7,0x01,0x70,0x86,0x03,0x70,0x8C,0x03,0x70,0x18,0x07,0x70,0x30,0x0F,0xFC,
+    0x3F,0x0E,0xFC,0x3F,0x1C,0x70,0x00,0x1C,0x70,0x00,0x38,0x00,0x80,0x70,0x00,0x70,0x47,0x01,0x83,0x80,0x03,0xF8,0x00,0x07,
+    0xF8,0x00,0x07,0x38,0x00,0x0E,0x38,0x00,0x83,0x00,0x1C,0x38,0x00,0x3C,0x38,0x00,0x38,0x38,0x00,0x70,0x38,0x00,0x80,0x00,
+    0xE0,0x38,0x00,0x84,0xF0,0xC3,0x39,0xF8,0xC7,0x01,0x3C,0x84,0x03,0x1C,0x80,0x03,0x1C,0x00,0x07,0x00,0x87,0x38,0x00,0x0E,
+    0xF0,0x00,0x1E,0xE0,0x01,0x1C,0xC0,0x01,0x38,0x80,0x03,0x38,0x00,0x07,0x70,0xFC,0x07,0x70,0xFC,0x07,0xE0,0x47,0x01,0x96,
+    0x1C,0x00,0x7F,0x38,0x80,0x7F,0x70,0xC0,0x41,0x70,0xC0,0x01,0xE0,0x80,0x03,0xC0,0x01,0x3F,0xC0,0x03,0x3E,0x80,0x83,0x07,
+    0x00,0xC7,0x01,0x00,0xCE,0x01,0x00,0xCE,0x43,0x00,0x9C,0x7F,0xF0,0x38,0x7F,0xF0,0x39,0x00,0xF0,0x73,0x00,0x70,0xE7,0x00,
+    0x70,0xE6,0x00,0x70,0xCC,0x01,0x70,0x98,0x03,0x70,0xB0,0x07,0xFC,0x3F,0x07,0xFC,0x3F,0x0E,0x70,0x00,0x1C,0x00,0x81,0x70,
+    0x00,0x38,0x70,0x00,0x70,0x47,0x08,0x80,0x00,0x1C,0x00,0x02,0x42,0x80,0x00,0x1C,0x00,0x01,0x86,0x00,0x18,0x00,0x00,0x38,
+    0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xC0,0x01,0x00,0x80,0x07,0x00,0x00,0x0E,0x00,0x80,0x00,0x00,0x1C,0x00,0x85,0xE0,
+    0x00,0x1C,0xE0,0x00,0x1E,0xE0,0x00,0x1F,0xE0,0xFF,0x0F,0xE0,0xFF,0x07,0x80,0xFF,0x00,0x40,0x83,0x00,0xC0,0x03,0x00,0xE0,
+    0x01,0x00,0xF0,0x00,0x00,0x38,0x00,0x40,0x82,0x00,0x78,0x00,0x00,0xF8,0x00,0x00,0xFC,0x00,0x00,0x8B,0x00,0xDC,0x01,0x00,
+    0xDE,0x01,0x00,0x8E,0x03,0x00,0x8F,0x03,0x00,0x87,0x03,0x00,0x07,0x07,0x80,0x07,0x07,0x80,0x03,0x0E,0xC0,0x03,0x0E,0xC0,
+    0x01,0x0E,0xC0,0xFF,0x1F,0xE0,0xFF,0x1F,0x00,0x83,0xF0,0x00,0x38,0x70,0x00,0x38,0x78,0x00,0x78,0x38,0x00,0x70,0x00,0x80,
+    0x1C,0x00,0xE0,0x47,0x83,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0xE0,0x00,0x40,0x82,0x00,0x78,0x00,0x00,0xF8,
+    0x00,0x00,0xFC,0x00,0x00,0x8B,0x00,0xDC,0x01,0x00,0xDE,0x01,0x00,0x8E,0x03,0x00,0x8F,0x03,0x00,0x87,0x03,0x00,0x07,0x07,
+    0x80,0x07,0x07,0x80,0x03,0x0E,0xC0,0x03,0x0E,0xC0,0x01,0x0E,0xC0,0xFF,0x1F,0xE0,0xFF,0x1F,0x00,0x83,0xF0,0x00,0x38,0x70,
+    0x00,0x38,0x78,0x00,0x78,0x38,0x00,0x70,0x00,0x80,0x1C,0x00,0xE0,0x47,0x83,0x00,0xF8,0x00,0x00,0xFC,0x01,0x00,0x8E,0x03,
+    0x00,0x07,0x07,0x40,0x82,0x00,0x78,0x00,0x00,0xF8,0x00,0x00,0xFC,0x00,0x00,0x8B,0x00,0xDC,0x01,0x00,0xDE,0x01,0x00,0x8E,
+    0x03,0x00,0x8F,0x03,0x00,0x87,0x03,0x00,0x07,0x07,0x80,0x07,0x07,0x80,0x03,0x0E,0xC0,0x03,0x0E,0xC0,0x01,0x0E,0xC0,0xFF,
+    0x1F,0xE0,0xFF,0x1F,0x00,0x83,0xF0,0x00,0x38,0x70,0x00,0x38,0x78,0x00,0x78,0x38,0x00,0x70,0x00,0x80,0x1C,0x00,0xE0,0x47,
+    0x83,0x80,0xE1,0x01,0x80,0xFB,0x03,0x00,0x7F,0x06,0x00,0x1E,0x06,0x40,0x82,0x00,0x78,0x00,0x00,0xF8,0x00,0x00,0xFC,0x00,
+    0x00,0x8B,0x00,0xDC,0x01,0x00,0xDE,0x01,0x00,0x8E,0x03,0x00,0x8F,0x03,0x00,0x87,0x03,0x00,0x07,0x07,0x80,0x07,0x07,0x80,
+    0x03,0x0E,0xC0,0x03,0x0E,0xC0,0x01,0x0E,0xC0,0xFF,0x1F,0xE0,0xFF,0x1F,0x00,0x83,0xF0,0x00,0x38,0x70,0x00,0x38,0x78,0x00,
+    0x78,0x38,0x00,0x70,0x00,0x80,0x1C,0x00,0xE0,0x47,0x80,0x80,0x03,0x07,0x01,0x41,0x82,0x00,0x78,0x00,0x00,0xF8,0x00,0x00,
+    0xFC,0x00,0x00,0x8B,0x00,0xDC,0x01,0x00,0xDE,0x01,0x00,0x8E,0x03,0x00,0x8F,0x03,0x00,0x87,0x03,0x00,0x07,0x07,0x80,0x07,
+    0x07,0x80,0x03,0x0E,0xC0,0x03,0x0E,0xC0,0x01,0x0E,0xC0,0xFF,0x1F,0xE0,0xFF,0x1F,0x00,0x83,0xF0,0x00,0x38,0x70,0x00,0x38,
+    0x78,0x00,0x78,0x38,0x00,0x70,0x00,0x80,0x1C,0x00,0xE0,0x47,0x81,0x00,0x70,0x00,0x00,0x88,0x00,0x01,0x80,0x00,0x70,0x00,
+    0x00,0x80,0x00,0xF8,0x00,0x00,0x81,0x00,0xFC,0x00,0x00,0xDC,0x01,0x00,0x85,0x00,0x9E,0x03,0x00,0x8E,0x03,0x00,0x0F,0x03,
+    0x00,0x07,0x07,0x80,0x07,0x07,0x80,0x03,0x0E,0x00,0x82,0xC0,0x01,0x0E,0xC0,0xFF,0x1F,0xE0,0xFF,0x1F,0x00,0x83,0xF0,0x00,
+    0x38,0x70,0x00,0x38,0x70,0x00,0x70,0x38,0x00,0x70,0x00,0x80,0x1C,0x00,0xE0,0x47,0x04,0x81,0xF0,0x3F,0x00,0xF0,0x7F,0x00,
+    0x00,0x80,0x00,0xFC,0x00,0x00,0x81,0x00,0xDC,0x00,0x00,0xDC,0x01,0x00,0x80,0x00,0x9C,0x03,0x00,0x80,0xE0,0x1F,0x07,0x00,
+    0x83,0xE0,0x1F,0x06,0x00,0x1C,0x0E,0x00,0x1C,0x0C,0x00,0xFC,0x1F,0x00,0x83,0x00,0xFC,0x3F,0x00,0x1C,0x38,0x00,0x1C,0x30,
+    0xF8,0x1F,0x70,0x00,0x80,0xF8,0x1F,0xE0,0x47,0x04,0x88,0xE0,0x3F,0x00,0xF8,0xFF,0x00,0xF8,0xFF,0x03,0x38,0xE0,0x07,0x00,
+    0x80,0x0F,0x00,0x00,0x0E,0x00,0x00,0x1E,0x00,0x00,0x1C,0x00,0x00,0x38,0x04,0x8D,0x00,0x00,0x3C,0x00,0x00,0x1C,0x00,0x00,
+    0x1E,0x00,0x00,0x1F,0x00,0x80,0x0F,0x38,0xE0,0x07,0xF8,0xFF,0x03,0xF8,0xFF,0x00,0xC0,0x3F,0x00,0x00,0x0C,0x00,0x00,0x08,
+    0x00,0x00,0x1E,0x00,0x00,0x07,0x00,0x80,0x03,0x00,0x00,0x81,0x00,0x3F,0x00,0x00,0x3E,0x00,0x83,0x00,0xE0,0x01,0x00,0xF0,
+    0x00,0x00,0x78,0x00,0x00,0x1C,0x00,0x40,0x80,0xE0,0xFF,0x0F,0x01,0x80,0x00,0x00,0x0E,0x05,0x80,0x80,0xFF,0x0F,0x01,0x80,
+    0x00,0x00,0x0E,0x05,0x80,0xF0,0xFF,0x0F,0x01,0x47,0x83,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x38,0x00,0x40,
+    0x80,0xE0,0xFF,0x0F,0x01,0x80,0x00,0x00,0x0E,0x05,0x80,0x80,0xFF,0x0F,0x01,0x80,0x00,0x00,0x0E,0x05,0x80,0xF0,0xFF,0x0F,
+    0x01,0x47,0x83,0x00,0x7C,0x00,0x00,0xFE,0x00,0x00,0xC7,0x01,0x80,0x83,0x03,0x40,0x80,0xE0,0xFF,0x0F,0x01,0x80,0x00,0x00,
+    0x0E,0x05,0x80,0x80,0xFF,0x0F,0x01,0x80,0x00,0x00,0x0E,0x05,0x80,0xF0,0xFF,0x0F,0x01,0x47,0x80,0xC0,0x81,0x03,0x01,0x41,
+    0x80,0xE0,0xFF,0x0F,0x01,0x80,0x00,0x00,0x0E,0x05,0x80,0x80,0xFF,0x0F,0x01,0x80,0x00,0x00,0x0E,0x05,0x80,0xF0,0xFF,0x0F,
+    0x01,0x47,0x83,0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0x38,0x00,0x40,0x80,0xC0,0xFF,0x1F,0x01,0x80,0x00,0x70,
+    0x00,0x0F,0x80,0xC0,0xFF,0x1F,0x01,0x47,0x83,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x70,0x00,0x40,0x80,0xC0,
+    0xFF,0x1F,0x01,0x80,0x00,0x70,0x00,0x0F,0x80,0xC0,0xFF,0x1F,0x01,0x47,0x83,0x00,0xF8,0x00,0x00,0xFC,0x01,0x00,0x8E,0x03,
+    0x00,0x07,0x07,0x40,0x80,0xC0,0xFF,0x1F,0x01,0x80,0x00,0x70,0x00,0x0F,0x80,0xC0,0xFF,0x1F,0x01,0x47,0x80,0x80,0x03,0x07,
+    0x01,0x41,0x80,0xC0,0xFF,0x1F,0x01,0x80,0x00,0x70,0x00,0x0F,0x80,0xC0,0xFF,0x1F,0x01,0x47,0x04,0x85,0x00,0xF0,0x3F,0x00,
+    0xFE,0x3F,0x00,0xFF,0x3F,0x80,0x0F,0x38,0xC0,0x03,0x38,0xC0,0x01,0x38,0x00,0x82,0xE0,0x01,0x38,0xE0,0x00,0x38,0xE0,0x80,
+    0xFF,0x01,0x80,0xE0,0x00,0x38,0x01,0x80,0xC0,0x01,0x38,0x00,0x85,0xC0,0x03,0x38,0x80,0x07,0x38,0x80,0x1F,0x38,0x00,0xFF,
+    0x3F,0x00,0xFC,0x3F,0x00,0xF0,0x3F,0x47,0x83,0x80,0xE1,0x01,0x80,0xFB,0x03,0x00,0x7F,0x06,0x00,0x1E,0x06,0x40,0x80,0x70,
+    0x00,0x1E,0x00,0x81,0x70,0x00,0x1F,0x70,0x80,0x1F,0x00,0x8E,0x70,0xC0,0x1F,0x70,0xC0,0x1D,0x70,0xE0,0x1C,0x70,0xF0,0x1C,
+    0x70,0x70,0x1C,0x70,0x78,0x1C,0x70,0x38,0x1C,0x70,0x3C,0x1C,0x70,0x1C,0x1C,0x70,0x0E,0x1C,0x70,0x0F,0x1C,0x70,0x07,0x1C,
+    0xF0,0x07,0x1C,0xF0,0x03,0x1C,0xF0,0x01,0x1C,0x00,0x80,0xF0,0x00,0x1C,0x00,0x47,0x83,0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,
+    0xF0,0x00,0x00,0x38,0x00,0x40,0x85,0x00,0xFC,0x01,0x00,0xFF,0x07,0x80,0xFF,0x0F,0xC0,0x07,0x1F,0xC0,0x01,0x1C,0xE0,0x00,
+    0x38,0x00,0x81,0xF0,0x00,0x78,0x70,0x00,0x70,0x05,0x81,0xF0,0x00,0x78,0xE0,0x00,0x38,0x00,0x84,0xC0,0x01,0x1C,0xC0,0x07,
+    0x1F,0x80,0xFF,0x0F,0x00,0xFF,0x07,0x00,0xFC,0x01,0x47,0x83,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x70,0x00,
+    0x40,0x85,0x00,0xFC,0x01,0x00,0xFF,0x07,0x80,0xFF,0x0F,0xC0,0x07,0x1F,0xC0,0x01,0x1C,0xE0,0x00,0x38,0x00,0x81,0xF0,0x00,
+    0x78,0x70,0x00,0x70,0x05,0x81,0xF0,0x00,0x78,0xE0,0x00,0x38,0x00,0x84,0xC0,0x01,0x1C,0xC0,0x07,0x1F,0x80,0xFF,0x0F,0x00,
+    0xFF,0x07,0x00,0xFC,0x01,0x47,0x83,0x00,0xF8,0x00,0x00,0xFC,0x01,0x00,0x8E,0x03,0x00,0x07,0x07,0x40,0x85,0x00,0xFC,0x01,
+    0x00,0xFF,0x07,0x80,0xFF,0x0F,0xC0,0x07,0x1F,0xC0,0x01,0x1C,0xE0,0x00,0x38,0x00,0x81,0xF0,0x00,0x78,0x70,0x00,0x70,0x05,
+    0x81,0xF0,0x00,0x78,0xE0,0x00,0x38,0x00,0x84,0xC0,0x01,0x1C,0xC0,0x07,0x1F,0x80,0xFF,0x0F,0x00,0xFF,0x07,0x00,0xFC,0x01,
+    0x47,0x83,0x80,0xE1,0x01,0x80,0xFB,0x03,0x00,0x7F,0x06,0x00,0x1E,0x06,0x40,0x85,0x00,0xFC,0x01,0x00,0xFF,0x07,0x80,0xFF,
+    0x0F,0xC0,0x07,0x1F,0xC0,0x01,0x1C,0xE0,0x00,0x38,0x00,0x81,0xF0,0x00,0x78,0x70,0x00,0x70,0x05,0x81,0xF0,0x00,0x78,0xE0,
+    0x00,0x38,0x00,0x84,0xC0,0x01,0x1C,0xC0,0x07,0x1F,0x80,0xFF,0x0F,0x00,0xFF,0x07,0x00,0xFC,0x01,0x47,0x80,0x80,0x03,0x07,
+    0x01,0x41,0x85,0x00,0xFC,0x01,0x00,0xFF,0x07,0x80,0xFF,0x0F,0xC0,0x07,0x1F,0xC0,0x01,0x1C,0xE0,0x00,0x38,0x00,0x81,0xF0,
+    0x00,0x78,0x70,0x00,0x70,0x05,0x81,0xF0,0x00,0x78,0xE0,0x00,0x38,0x00,0x84,0xC0,0x01,0x1C,0xC0,0x07,0x1F,0x80,0xFF,0x0F,
+    0x00,0xFF,0x07,0x00,0xFC,0x01,0x47,0x08,0x92,0x20,0x00,0x20,0x70,0x00,0x70,0xE0,0x00,0x38,0xC0,0x01,0x1C,0x80,0x03,0x0E,
+    0x00,0x07,0x07,0x00,0x8E,0x03,0x00,0xDC,0x01,0x00,0xF8,0x00,0x00,0x70,0x00,0x00,0xF8,0x00,0x00,0xDC,0x01,0x00,0x8E,0x03,
+    0x00,0x07,0x07,0x80,0x03,0x0E,0xC0,0x01,0x1C,0xE0,0x00,0x38,0x70,0x00,0x70,0x20,0x00,0x20,0x47,0x04,0x96,0x70,0xFC,0x01,
+    0xE0,0xFF,0x07,0xC0,0xFF,0x0F,0xC0,0x07,0x1F,0xC0,0x01,0x1C,0xE0,0x03,0x38,0xE0,0x07,0x38,0xE0,0x0E,0x78,0x70,0x0C,0x70,
+    0x70,0x1C,0x70,0x70,0x38,0x70,0x70,0x70,0x70,0x70,0xE0,0x70,0x70,0xC0,0x71,0x70,0x80,0x71,0xF0,0x80,0x3B,0xE0,0x00,0x3F,
+    0xE0,0x00,0x3E,0xC0,0x01,0x1C,0xC0,0x07,0x1F,0x80,0xFF,0x1F,0x00,0xFF,0x3F,0x00,0xFC,0x71,0x47,0x83,0x00,0xE0,0x01,0x00,
+    0xF0,0x00,0x00,0x78,0x00,0x00,0x1C,0x00,0x40,0x80,0xE0,0x00,0x1C,0x0F,0x85,0xE0,0x01,0x1E,0xC0,0x01,0x0E,0xC0,0x07,0x0F,
+    0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFC,0x00,0x47,0x83,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x70,0x00,0x40,
+    0x80,0xE0,0x00,0x1C,0x0F,0x85,0xE0,0x01,0x1E,0xC0,0x01,0x0E,0xC0,0x07,0x0F,0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFC,0x00,
+    0x47,0x83,0x00,0xF8,0x00,0x00,0xFC,0x01,0x00,0x8E,0x03,0x00,0x07,0x07,0x40,0x80,0xE0,0x00,0x1C,0x0F,0x85,0xE0,0x01,0x1E,
+    0xC0,0x01,0x0E,0xC0,0x07,0x0F,0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFC,0x00,0x47,0x80,0xC0,0x81,0x03,0x01,0x41,0x80,0xE0,
+    0x00,0x1C,0x0F,0x85,0xE0,0x01,0x1E,0xC0,0x01,0x0E,0xC0,0x07,0x0F,0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFC,0x00,0x47,0x83,
+    0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x70,0x00,0x40,0x8B,0x3C,0x00,0x78,0x38,0x00,0x3C,0x70,0x00,0x1E,0xF0,
+    0x00,0x1E,0xE0,0x00,0x0F,0xC0,0x01,0x07,0xC0,0x83,0x07,0x80,0xC3,0x03,0x00,0xC7,0x01,0x00,0xEF,0x01,0x00,0xFE,0x00,0x00,
+    0x7C,0x00,0x00,0x80,0x00,0x38,0x00,0x08,0x47,0x04,0x80,0x00,0x00,0x0E,0x03,0x85,0x00,0xFF,0x0F,0xC0,0xFF,0x0F,0xE0,0xFF,
+    0x0F,0xE0,0x01,0x0E,0xF0,0x00,0x0E,0x70,0x00,0x0E,0x02,0x85,0xE0,0x00,0x0E,0xE0,0x03,0x0E,0xC0,0xFF,0x0F,0x00,0xFF,0x0F,
+    0x00,0xFC,0x0F,0x00,0x00,0x0E,0x02,0x47,0x84,0x00,0xF0,0x03,0x00,0xFC,0x07,0x00,0xFE,0x0F,0x00,0x1E,0x1E,0x00,0x0E,0x1C,
+    0x01,0x80,0x00,0x1C,0x1C,0x00,0x80,0x00,0x38,0x1C,0x00,0x80,0x00,0x70,0x1C,0x00,0x88,0x00,0x78,0x1C,0x00,0x7C,0x1C,0x00,
+    0x3E,0x1C,0x00,0x1F,0x1C,0x80,0x0F,0x1C,0xC0,0x03,0x1C,0xE0,0x01,0x1C,0xF0,0x00,0x1C,0x70,0x00,0x1C,0x01,0x83,0xF0,0x60,
+    0x1C,0xE0,0x7F,0x1C,0xC0,0x7F,0x1C,0x80,0x1F,0x1C,0x47,0x85,0x00,0x80,0x07,0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0xE0,0x00,
+    0x00,0x70,0x00,0x00,0x38,0x00,0x42,0x81,0x00,0xFC,0x01,0x00,0xFF,0x0F,0x00,0x81,0x80,0x07,0x0E,0x80,0x03,0x00,0x02,0x84,
+    0x80,0xFF,0x01,0x80,0xFF,0x07,0x80,0x03,0x0F,0x80,0x03,0x1C,0x80,0x03,0x38,0x00,0x84,0x80,0x07,0x38,0x80,0x1F,0x3C,0xF0,
+    0xFD,0x1F,0xF0,0xF9,0x0F,0xF0,0xE0,0x07,0x47,0x85,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x1C,0x00,0x00,0x38,
+    0x00,0x00,0x70,0x00,0x42,0x81,0x00,0xFC,0x01,0x00,0xFF,0x0F,0x00,0x81,0x80,0x07,0x0E,0x80,0x03,0x00,0x02,0x84,0x80,0xFF,
+    0x01,0x80,0xFF,0x07,0x80,0x03,0x0F,0x80,0x03,0x1C,0x80,0x03,0x38,0x00,0x84,0x80,0x07,0x38,0x80,0x1F,0x3C,0xF0,0xFD,0x1F,
+    0xF0,0xF9,0x0F,0xF0,0xE0,0x07,0x47,0x85,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xCE,0x01,0x00,0x87,0x03,0x80,
+    0x03,0x07,0x42,0x81,0x00,0xFC,0x01,0x00,0xFF,0x0F,0x00,0x81,0x80,0x07,0x0E,0x80,0x03,0x00,0x02,0x84,0x80,0xFF,0x01,0x80,
+    0xFF,0x07,0x80,0x03,0x0F,0x80,0x03,0x1C,0x80,0x03,0x38,0x00,0x84,0x80,0x07,0x38,0x80,0x1F,0x3C,0xF0,0xFD,0x1F,0xF0,0xF9,
+    0x0F,0xF0,0xE0,0x07,0x47,0x00,0x83,0x80,0xE1,0x01,0x80,0xF3,0x03,0x00,0x3F,0x07,0x00,0x1E,0x06,0x43,0x81,0x00,0xFC,0x01,
+    0x00,0xFF,0x0F,0x00,0x81,0x80,0x07,0x0E,0x80,0x03,0x00,0x02,0x84,0x80,0xFF,0x01,0x80,0xFF,0x07,0x80,0x03,0x0F,0x80,0x03,
+    0x1C,0x80,0x03,0x38,0x00,0x84,0x80,0x07,0x38,0x80,0x1F,0x3C,0xF0,0xFD,0x1F,0xF0,0xF9,0x0F,0xF0,0xE0,0x07,0x47,0x01,0x80,
+    0x80,0xC3,0x01,0x01,0x43,0x81,0x00,0xFC,0x01,0x00,0xFF,0x0F,0x00,0x81,0x80,0x07,0x0E,0x80,0x03,0x00,0x02,0x84,0x80,0xFF,
+    0x01,0x80,0xFF,0x07,0x80,0x03,0x0F,0x80,0x03,0x1C,0x80,0x03,0x38,0x00,0x84,0x80,0x07,0x38,0x80,0x1F,0x3C,0xF0,0xFD,0x1F,
+    0xF0,0xF9,0x0F,0xF0,0xE0,0x07,0x47,0x82,0x00,0x78,0x00,0x00,0xCC,0x00,0x00,0x84,0x00,0x00,0x81,0x00,0xCC,0x00,0x00,0x78,
+    0x00,0x42,0x81,0x00,0xFC,0x01,0x00,0xFF,0x0F,0x00,0x81,0x80,0x07,0x0E,0x80,0x03,0x00,0x02,0x84,0x80,0xFF,0x01,0x80,0xFF,
+    0x07,0x80,0x03,0x0F,0x80,0x03,0x1C,0x80,0x03,0x38,0x00,0x84,0x80,0x07,0x38,0x80,0x1F,0x3C,0xF0,0xFD,0x1F,0xF0,0xF9,0x0F,
+    0xF0,0xE0,0x07,0x47,0x08,0x85,0x80,0x87,0x1F,0xE0,0xEF,0x3F,0xF0,0xFF,0x3F,0x70,0xFC,0x20,0x30,0x78,0x00,0x38,0x70,0x00,
+    0x01,0x84,0xF8,0xFF,0x07,0xF8,0xFF,0x1F,0xF8,0x7F,0x3C,0x00,0x70,0x38,0x00,0x70,0x70,0x00,0x84,0x00,0x78,0x70,0x18,0xFC,
+    0x78,0xF8,0xFF,0x3F,0xF8,0x9F,0x3F,0xE0,0x07,0x0F,0x47,0x08,0x87,0xC0,0x3F,0x00,0xF0,0xFF,0x01,0xF0,0xFF,0x03,0x70,0xC0,
+    0x07,0x00,0x00,0x0F,0x00,0x00,0x0E,0x00,0x00,0x1E,0x00,0x00,0x1C,0x03,0x8B,0x00,0x00,0x1E,0x00,0x00,0x0E,0x00,0x00,0x0F,
+    0x30,0xC0,0x07,0xF0,0xFF,0x03,0xF0,0xFF,0x01,0xC0,0x3F,0x00,0x00,0x30,0x00,0x00,0x20,0x00,0x00,0x78,0x00,0x00,0x1C,0x00,
+    0x00,0x0E,0x00,0x00,0x81,0x00,0xFC,0x00,0x00,0xF8,0x00,0x85,0x00,0x80,0x07,0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0xE0,0x00,
+    0x00,0x70,0x00,0x00,0x38,0x00,0x42,0x87,0x00,0xFC,0x00,0x00,0xFF,0x03,0x00,0xFF,0x07,0x80,0x07,0x0F,0x80,0x03,0x1C,0xC0,
+    0x01,0x1C,0xC0,0x01,0x38,0xC0,0xFF,0x3F,0x01,0x80,0x00,0x00,0x38,0x00,0x86,0x00,0x00,0x3C,0x00,0x00,0x1C,0x00,0x00,0x1E,
+    0xC0,0x81,0x0F,0xC0,0xFF,0x0F,0xC0,0xFF,0x03,0x00,0xFE,0x00,0x47,0x85,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,
+    0x1C,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x42,0x87,0x00,0xFC,0x00,0x00,0xFF,0x03,0x00,0xFF,0x07,0x80,0x07,0x0F,0x80,0x03,
+    0x1C,0xC0,0x01,0x1C,0xC0,0x01,0x38,0xC0,0xFF,0x3F,0x01,0x80,0x00,0x00,0x38,0x00,0x86,0x00,0x00,0x3C,0x00,0x00,0x1C,0x00,
+    0x00,0x1E,0xC0,0x81,0x0F,0xC0,0xFF,0x0F,0xC0,0xFF,0x03,0x00,0xFE,0x00,0x47,0x85,0x00,0x3C,0x00,0x00,0x7E,0x00,0x00,0xFF,
+    0x00,0x00,0xE7,0x00,0x80,0xC3,0x01,0xC0,0x81,0x03,0x42,0x87,0x00,0xFC,0x00,0x00,0xFF,0x03,0x00,0xFF,0x07,0x80,0x07,0x0F,
+    0x80,0x03,0x1C,0xC0,0x01,0x1C,0xC0,0x01,0x38,0xC0,0xFF,0x3F,0x01,0x80,0x00,0x00,0x38,0x00,0x86,0x00,0x00,0x3C,0x00,0x00,
+    0x1C,0x00,0x00,0x1E,0xC0,0x81,0x0F,0xC0,0xFF,0x0F,0xC0,0xFF,0x03,0x00,0xFE,0x00,0x47,0x01,0x80,0x80,0xC3,0x01,0x01,0x43,
+    0x87,0x00,0xFC,0x00,0x00,0xFF,0x03,0x00,0xFF,0x07,0x80,0x07,0x0F,0x80,0x03,0x1C,0xC0,0x01,0x1C,0xC0,0x01,0x38,0xC0,0xFF,
+    0x3F,0x01,0x80,0x00,0x00,0x38,0x00,0x86,0x00,0x00,0x3C,0x00,0x00,0x1C,0x00,0x00,0x1E,0xC0,0x81,0x0F,0xC0,0xFF,0x0F,0xC0,
+    0xFF,0x03,0x00,0xFE,0x00,0x47,0x85,0x00,0x80,0x07,0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0xE0,0x00,0x00,0x70,0x00,0x00,0x38,
+    0x00,0x42,0x80,0x00,0xF8,0x1F,0x01,0x80,0x00,0x38,0x00,0x0E,0x47,0x85,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,
+    0x1C,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x42,0x80,0x00,0xF8,0x1F,0x01,0x80,0x00,0x38,0x00,0x0E,0x47,0x85,0x00,0x3C,0x00,
+    0x00,0x7E,0x00,0x00,0xFF,0x00,0x00,0xE7,0x00,0x80,0xC3,0x01,0xC0,0x81,0x03,0x42,0x80,0x00,0xF8,0x1F,0x01,0x80,0x00,0x38,
+    0x00,0x0E,0x47,0x01,0x80,0x80,0xC3,0x01,0x01,0x43,0x80,0x00,0xF8,0x1F,0x01,0x80,0x00,0x38,0x00,0x0E,0x47,0x8F,0x00,0x08,
+    0x3C,0x00,0x9C,0x3F,0x00,0xF8,0x3F,0x00,0xF0,0x07,0x00,0xF8,0x01,0x00,0xFC,0x07,0x00,0x3E,0x0F,0x00,0x1F,0x04,0x00,0x0F,
+    0x00,0x80,0xFF,0x01,0x80,0xFF,0x03,0xC0,0xFF,0x0F,0xC0,0x07,0x0F,0xE0,0x01,0x1E,0xE0,0x01,0x1C,0xE0,0x00,0x38,0x04,0x86,
+    0xE0,0x01,0x38,0xC0,0x01,0x1C,0xC0,0x03,0x1E,0x80,0x07,0x0F,0x00,0xFF,0x0F,0x00,0xFE,0x03,0x00,0xF8,0x01,0x47,0x00,0x83,
+    0x80,0xE1,0x01,0x80,0xF3,0x03,0x00,0x3F,0x07,0x00,0x1E,0x06,0x43,0x86,0x00,0x3E,0x1C,0x80,0xFF,0x1C,0x80,0xFF,0x1D,0xC0,
+    0xC3,0x1F,0xC0,0x01,0x1F,0xC0,0x01,0x1E,0xC0,0x01,0x1C,0x0B,0x47,0x85,0x00,0x00,0x0F,0x00,0x80,0x07,0x00,0xC0,0x03,0x00,
+    0xC0,0x01,0x00,0xE0,0x00,0x00,0x70,0x00,0x42,0x86,0x00,0xFC,0x01,0x00,0xFF,0x07,0x80,0xFF,0x0F,0x80,0x07,0x0F,0xC0,0x03,
+    0x1E,0xC0,0x01,0x1C,0xE0,0x00,0x38,0x05,0x85,0xC0,0x01,0x1C,0xC0,0x03,0x1E,0x80,0x07,0x0F,0x80,0xFF,0x0F,0x00,0xFF,0x07,
+    0x00,0xFC,0x01,0x47,0x85,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x42,
+    0x86,0x00,0xFC,0x01,0x00,0xFF,0x07,0x80,0xFF,0x0F,0x80,0x07,0x0F,0xC0,0x03,0x1E,0xC0,0x01,0x1C,0xE0,0x00,0x38,0x05,0x85,
+    0xC0,0x01,0x1C,0xC0,0x03,0x1E,0x80,0x07,0x0F,0x80,0xFF,0x0F,0x00,0xFF,0x07,0x00,0xFC,0x01,0x47,0x85,0x00,0x78,0x00,0x00,
+    0xFC,0x00,0x00,0xFE,0x01,0x00,0xCE,0x01,0x00,0x87,0x03,0x80,0x03,0x07,0x42,0x86,0x00,0xFC,0x01,0x00,0xFF,0x07,0x80,0xFF,
+    0x0F,0x80,0x07,0x0F,0xC0,0x03,0x1E,0xC0,0x01,0x1C,0xE0,0x00,0x38,0x05,0x85,0xC0,0x01,0x1C,0xC0,0x03,0x1E,0x80,0x07,0x0F,
+    0x80,0xFF,0x0F,0x00,0xFF,0x07,0x00,0xFC,0x01,0x47,0x00,0x83,0x80,0xE1,0x01,0x80,0xF3,0x03,0x00,0x3F,0x07,0x00,0x1E,0x06,
+    0x43,0x86,0x00,0xFC,0x01,0x00,0xFF,0x07,0x80,0xFF,0x0F,0x80,0x07,0x0F,0xC0,0x03,0x1E,0xC0,0x01,0x1C,0xE0,0x00,0x38,0x05,
+    0x85,0xC0,0x01,0x1C,0xC0,0x03,0x1E,0x80,0x07,0x0F,0x80,0xFF,0x0F,0x00,0xFF,0x07,0x00,0xFC,0x01,0x47,0x01,0x80,0x00,0x87,
+    0x03,0x01,0x43,0x86,0x00,0xFC,0x01,0x00,0xFF,0x07,0x80,0xFF,0x0F,0x80,0x07,0x0F,0xC0,0x03,0x1E,0xC0,0x01,0x1C,0xE0,0x00,
+    0x38,0x05,0x85,0xC0,0x01,0x1C,0xC0,0x03,0x1E,0x80,0x07,0x0F,0x80,0xFF,0x0F,0x00,0xFF,0x07,0x00,0xFC,0x01,0x47,0x08,0x80,
+    0x00,0x78,0x00,0x02,0x43,0x80,0xF8,0xFF,0x3F,0x01,0x43,0x80,0x00,0x78,0x00,0x02,0x47,0x08,0x92,0xE0,0xFC,0x01,0xC0,0xFF,
+    0x07,0x80,0xFF,0x0F,0x80,0x07,0x0F,0xC0,0x03,0x1E,0xC0,0x07,0x1C,0xE0,0x0E,0x38,0xE0,0x1C,0x38,0xE0,0x38,0x38,0xE0,0x70,
+    0x38,0xE0,0xE0,0x38,0xE0,0xC0,0x39,0xE0,0x80,0x3B,0xC0,0x01,0x1F,0xC0,0x03,0x1E,0x80,0x07,0x0F,0x80,0xFF,0x0F,0x00,0xFF,
+    0x1F,0x00,0xFC,0x39,0x47,0x85,0x00,0x00,0x0F,0x00,0x80,0x07,0x00,0xC0,0x03,0x00,0xC0,0x01,0x00,0xE0,0x00,0x00,0x70,0x00,
+    0x42,0x80,0xC0,0x01,0x1C,0x0B,0x85,0xC0,0x03,0x1C,0xC0,0x07,0x1C,0xC0,0x1F,0x1E,0xC0,0xFD,0x0F,0xC0,0xF9,0x0F,0xC0,0xE1,
+    0x03,0x47,0x85,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x42,0x80,0xC0,
+    0x01,0x1C,0x0B,0x85,0xC0,0x03,0x1C,0xC0,0x07,0x1C,0xC0,0x1F,0x1E,0xC0,0xFD,0x0F,0xC0,0xF9,0x0F,0xC0,0xE1,0x03,0x47,0x85,
+    0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xCE,0x01,0x00,0x87,0x03,0x80,0x03,0x07,0x42,0x80,0xC0,0x01,0x1C,0x0B,
+    0x85,0xC0,0x03,0x1C,0xC0,0x07,0x1C,0xC0,0x1F,0x1E,0xC0,0xFD,0x0F,0xC0,0xF9,0x0F,0xC0,0xE1,0x03,0x47,0x01,0x80,0x00,0x87,
+    0x03,0x01,0x43,0x80,0xC0,0x01,0x1C,0x0B,0x85,0xC0,0x03,0x1C,0xC0,0x07,0x1C,0xC0,0x1F,0x1E,0xC0,0xFD,0x0F,0xC0,0xF9,0x0F,
+    0xC0,0xE1,0x03,0x47,0x85,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x42,
+    0x81,0x38,0x00,0x78,0x70,0x00,0x38,0x00,0x80,0xE0,0x00,0x1C,0x00,0x80,0xC0,0x01,0x0E,0x00,0x85,0xC0,0x01,0x0F,0x80,0x03,
+    0x07,0x80,0x83,0x07,0x00,0x87,0x03,0x00,0xC7,0x03,0x00,0xCE,0x01,0x00,0x80,0x00,0xFC,0x00,0x00,0x80,0x00,0x78,0x00,0x00,
+    0x80,0x00,0x70,0x00,0x00,0x85,0x00,0xE0,0x00,0x00,0xE0,0x01,0x00,0xC0,0x03,0x00,0xC0,0x3F,0x00,0x80,0x3F,0x00,0x00,0x3E,
+    0x40,0x80,0x00,0x00,0x1C,0x07,0x86,0x00,0x3E,0x1C,0x00,0xFF,0x1C,0x80,0xFF,0x1D,0xC0,0x83,0x1F,0xC0,0x01,0x1F,0xE0,0x01,
+    0x1E,0xE0,0x00,0x1C,0x05,0x86,0xC0,0x01,0x1C,0xC0,0x03,0x1E,0x80,0x87,0x1F,0x80,0xFF,0x1F,0x00,0xFF,0x1D,0x00,0x7C,0x1C,
+    0x00,0x00,0x1C,0x05,0x40,0x01,0x80,0x80,0xC3,0x01,0x01,0x43,0x81,0x38,0x00,0x78,0x70,0x00,0x38,0x00,0x80,0xE0,0x00,0x1C,
+    0x00,0x80,0xC0,0x01,0x0E,0x00,0x85,0xC0,0x01,0x0F,0x80,0x03,0x07,0x80,0x83,0x07,0x00,0x87,0x03,0x00,0xC7,0x03,0x00,0xCE,
+    0x01,0x00,0x80,0x00,0xFC,0x00,0x00,0x80,0x00,0x78,0x00,0x00,0x80,0x00,0x70,0x00,0x00,0x85,0x00,0xE0,0x00,0x00,0xE0,0x01,
+    0x00,0xC0,0x03,0x00,0xC0,0x3F,0x00,0x80,0x3F,0x00,0x00,0x3E,0x40,
+};
+
+static const FONT_PACKED font_22x36 = { 22, 36, 6, font_ranges_22x36, font_offsets_22x36, font_data_22x36 };
+
+static const FONT_RANGE font_ranges_24x40[6] =
+{
+    { 0x21, 0x81,   0 },
+    { 0x8A, 0x8E,  97 },
+    { 0x91, 0x91, 102 },
+    { 0x94, 0x95, 103 },
+    { 0x97, 0x98, 105 },
+    { 0xA1, 0xFF, 107 },
+};
+
+static const uint16_t font_offsets_24x40[203] =
+{
+        0,    13,    25,    80,   165,   256,   342,   354,   430,   506,   551,   568,   593,   600,   607,   705,
+      765,   795,   865,   936,  1001,  1060,  1146,  1218,  1302,  1388,  1401,  1432,  1498,  1511,  1577,  1638,
+     1729,  1793,  1857,  1917,  1974,  2001,  2023,  2091,  2108,  2125,  2156,  2234,  2246,  2303,  2374,  2428,
+     2473,  2545,  2611,  2678,  2690,  2716,  2787,  2856,  2934,  2983,  3052,  3069,  3167,  3184,  3251,  3258,
+     3272,  3330,  3381,  3431,  3482,  3541,  3573,  3640,  3673,  3691,  3724,  3794,  3806,  3833,  3861,  3909,
+     3958,  4007,  4035,  4096,  4129,  4158,  4218,  4279,  4345,  4431,  4488,  4562,  4569,  4643,  4670,  4684,
+     4773,  4803,  4814,  4825,  4836,  4847,  4862,  4869,  4884,  4899,  4910,  4915,  4927,  4991,  5040,  5090,
+     5154,  5167,  5267,  5273,  5356,  5396,  5450,  5462,  5469,  5522,  5528,  5554,  5577,  5616,  5659,  5673,
+     5705,  5740,  5747,  5772,  5787,  5819,  5873,  5957,  6042,  6133,  6198,  6275,  6352,  6429,  6506,  6575,
+     6655,  6725,  6807,  6847,  6887,  6927,  6959,  6989,  7019,  7049,  7071,  7138,  7222,  7289,  7356,  7423,
+     7490,  7549,  7615,  7693,  7732,  7771,  7810,  7841,  7903,  7953,  8036,  8114,  8192,  8269,  8344,  8408,
+     8484,  8544,  8616,  8695,  8774,  8852,  8917,  8949,  8981,  9012,  9030,  9108,  9153,  9221,  9289,  9356,
+     9421,  9475,  9494,  9560,  9609,  9658,  9706,  9741,  9847,  9901,  9993,
+};
+
+static const uint8_t font_data_24x40[9993] =
+{
+    0x02,0x80,0x00,0x3C,0x00,0x13,0x43,0x80,0x00,0x3C,0x00,0x02,0x47,0x00,0x80,0xF0,0xC1,0x07,0x04,0x80,0xE0,0x80,0x03,0x03,
+    0x5B,0x02,0x80,0x38,0x38,0x00,0x00,0x80,0x70,0x70,0x00,0x02,0x80,0xE0,0xE0,0x00,0x01,0x80,0xFE,0xFF,0x1F,0x01,0x80,0xC0,
+    0xC1,0x01,0x00,0x81,0x80,0xC3,0x01,0x80,0x83,0x03,0x00,0x80,0xFC,0xFF,0x7F,0x01,0x80,0x00,0x07,0x07,0x01,0x80,0x00,0x0E,
+    0x0E,0x02,0x80,0x00,0x1C,0x1C,0x00,0x47,0x00,0x80,0x00,0x0C,0x00,0x00,0x85,0x80,0x3F,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x01,
+    0x70,0xEC,0x03,0x00,0xCC,0x07,0x00,0x8C,0x07,0x02,0x8B,0x00,0xCC,0x07,0x00,0xEC,0x03,0x00,0xFC,0x01,0x00,0xFC,0x00,0x00,
+    0x7E,0x00,0x00,0x3F,0x00,0xC0,0x0F,0x00,0xE0,0x0F,0x00,0xF0,0x0D,0x00,0xF0,0x0C,0x00,0xF8,0x0C,0x00,0x78,0x0C,0x00,0x02,
+    0x85,0xF0,0x0C,0x08,0xF0,0x0D,0x0F,0xE0,0xFF,0x0F,0xC0,0xFF,0x0F,0x00,0xFF,0x00,0x00,0x0C,0x00,0x00,0x45,0x02,0x86,0x07,
+    0x00,0x1F,0x0E,0xC0,0x3F,0x1C,0xE0,0x71,0x1C,0xE0,0x70,0x38,0x70,0xE0,0x70,0x70,0xE0,0xE0,0x70,0xE0,0x00,0x8E,0xC0,0x71,
+    0xE0,0x80,0xE3,0x70,0x80,0xE3,0x79,0x00,0xC7,0x3F,0x00,0x0E,0x0F,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0xF0,0x70,
+    0x00,0xFC,0x73,0x00,0x1E,0xE7,0x00,0x0E,0xC7,0x01,0x07,0xCE,0x01,0x07,0x8E,0x03,0x07,0x0E,0x07,0x00,0x85,0x07,0x0E,0x0E,
+    0x0E,0x07,0x1C,0x9E,0x07,0x38,0xFC,0x03,0x38,0xF0,0x00,0x70,0x00,0x00,0xE0,0x46,0x02,0x84,0x00,0x7E,0x00,0x00,0xFF,0x01,
+    0x80,0xFF,0x03,0xC0,0xC7,0x03,0xC0,0x83,0x07,0x02,0x95,0x80,0xC7,0x07,0x00,0xCF,0x03,0x00,0xDE,0x03,0x00,0xFC,0x03,0x00,
+    0xF8,0x03,0x00,0xF0,0x0F,0x0F,0xF0,0x1F,0x0F,0xF8,0x3C,0x0F,0x7C,0x78,0x0F,0x3C,0x78,0x0E,0x3E,0xF0,0x0E,0x1F,0xF0,0x9E,
+    0x0F,0xF0,0x9C,0x0F,0xF0,0xFC,0x07,0xF0,0xF8,0x03,0xF8,0xF0,0x01,0x78,0xF8,0x01,0x7C,0xFC,0x07,0x3F,0xFE,0xFF,0x1F,0x3F,
+    0xFE,0x0F,0x00,0xF8,0x03,0x46,0x00,0x80,0x00,0x7C,0x00,0x04,0x80,0x00,0x38,0x00,0x03,0x5B,0x00,0x88,0x38,0x00,0x00,0xF8,
+    0x00,0x00,0xF8,0x03,0x00,0xE0,0x07,0x00,0x80,0x0F,0x00,0x00,0x1F,0x00,0x00,0x3E,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,
+    0x80,0x00,0xF0,0x00,0x01,0x80,0x00,0xE0,0x01,0x09,0x80,0x00,0xF0,0x00,0x01,0x80,0x00,0x78,0x00,0x00,0x87,0x00,0x3C,0x00,
+    0x00,0x3E,0x00,0x00,0x1F,0x00,0x80,0x0F,0x00,0xE0,0x07,0x00,0xF8,0x03,0x00,0xF8,0x00,0x00,0x38,0x00,0x00,0x41,0x00,0x88,
+    0x00,0x00,0x1C,0x00,0x00,0x1F,0x00,0xC0,0x1F,0x00,0xE0,0x07,0x00,0xF0,0x01,0x00,0xF8,0x00,0x00,0x7C,0x00,0x00,0x3C,0x00,
+    0x00,0x1E,0x00,0x00,0x80,0x00,0x0F,0x00,0x01,0x80,0x80,0x07,0x00,0x09,0x80,0x00,0x0F,0x00,0x01,0x80,0x00,0x1E,0x00,0x00,
+    0x87,0x00,0x3C,0x00,0x00,0x7C,0x00,0x00,0xF8,0x00,0x00,0xF0,0x01,0x00,0xE0,0x07,0x00,0xC0,0x1F,0x00,0x00,0x1F,0x00,0x00,
+    0x1C,0x41,0x02,0x80,0x00,0x3C,0x00,0x02,0x84,0x10,0x18,0x08,0x70,0x18,0x0E,0xF8,0x81,0x1F,0xF8,0xC3,0x1F,0xC0,0xC3,0x03,
+    0x40,0x83,0x00,0x42,0x00,0x00,0xFF,0x00,0x80,0xE7,0x01,0xC0,0xC3,0x03,0x00,0x81,0xC0,0x81,0x03,0x00,0x81,0x00,0x53,0x0A,
+    0x80,0x00,0x1C,0x00,0x07,0x80,0xFE,0xFF,0x3F,0x01,0x80,0x00,0x1C,0x00,0x07,0x47,0x19,0x80,0x00,0x7E,0x00,0x04,0x80,0x00,
+    0x1E,0x00,0x00,0x83,0x00,0x1C,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0x60,0x00,0x41,0x11,0x80,0xF0,0xFF,0x0F,0x01,0x52,
+    0x19,0x80,0x00,0x7E,0x00,0x04,0x47,0x00,0x81,0x0E,0x00,0x00,0x1C,0x00,0x00,0x00,0x80,0x38,0x00,0x00,0x00,0x80,0x70,0x00,
+    0x00,0x00,0x80,0xE0,0x00,0x00,0x00,0x80,0xC0,0x01,0x00,0x00,0x80,0x80,0x03,0x00,0x00,0x80,0x00,0x07,0x00,0x00,0x80,0x00,
+    0x0E,0x00,0x00,0x83,0x00,0x1C,0x00,0x00,0x3C,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0x80,0x00,0xE0,0x00,0x00,0x80,0x00,
+    0xC0,0x01,0x00,0x80,0x00,0x80,0x03,0x00,0x80,0x00,0x00,0x07,0x00,0x80,0x00,0x00,0x0E,0x00,0x80,0x00,0x00,0x1C,0x00,0x80,
+    0x00,0x00,0x38,0x00,0x80,0x00,0x00,0x70,0x41,0x02,0x86,0x00,0x7E,0x00,0x80,0xFF,0x01,0xC0,0xFF,0x03,0xE0,0xC3,0x07,0xF0,
+    0x81,0x0F,0xF0,0x00,0x0F,0x78,0x00,0x1E,0x01,0x81,0x38,0x00,0x1C,0x3C,0x00,0x3C,0x08,0x81,0x38,0x00,0x1C,0x78,0x00,0x1E,
+    0x01,0x85,0xF0,0x00,0x0F,0xF0,0x81,0x0F,0xE0,0xC3,0x07,0xC0,0xFF,0x03,0x80,0xFF,0x01,0x00,0x7E,0x00,0x46,0x02,0x86,0x00,
+    0x06,0x00,0x00,0x3E,0x00,0x00,0xFE,0x01,0x00,0xFE,0x1F,0x00,0xDE,0x1F,0x00,0x1E,0x18,0x00,0x1E,0x00,0x12,0x80,0xFE,0xFF,
+    0x1F,0x01,0x47,0x02,0x85,0x00,0xFC,0x01,0x00,0xFF,0x0F,0x80,0xFF,0x0F,0xC0,0x07,0x0E,0xC0,0x03,0x08,0xE0,0x01,0x00,0x04,
+    0x80,0xC0,0x03,0x00,0x00,0x8A,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,
+    0x00,0xE0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x03,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0x81,0x00,0x00,0x1F,0xE0,0xFF,0x1F,0x01,
+    0x47,0x02,0x85,0x00,0xFE,0x01,0xC0,0xFF,0x07,0xE0,0xFF,0x07,0xE0,0x03,0x07,0xF0,0x01,0x00,0xF0,0x00,0x00,0x02,0x80,0xE0,
+    0x01,0x00,0x00,0x81,0xC0,0x07,0x00,0x00,0xFF,0x00,0x00,0x84,0xC0,0xFF,0x00,0xE0,0x07,0x00,0xF0,0x01,0x00,0xF0,0x00,0x00,
+    0x78,0x00,0x00,0x04,0x85,0xF0,0x00,0x00,0xF0,0x01,0x00,0xE0,0x03,0x07,0xC0,0xFF,0x07,0x80,0xFF,0x07,0x00,0xFE,0x01,0x46,
+    0x02,0x82,0xC0,0x03,0x00,0xC0,0x07,0x00,0xC0,0x0F,0x00,0x00,0x8E,0xC0,0x1F,0x00,0xC0,0x3F,0x00,0xC0,0x3B,0x00,0xC0,0x73,
+    0x00,0xC0,0xF3,0x00,0xC0,0xE3,0x00,0xC0,0xC3,0x01,0xC0,0xC3,0x03,0xC0,0x83,0x03,0xC0,0x03,0x07,0xC0,0x03,0x0F,0xC0,0x03,
+    0x0E,0xC0,0x03,0x1C,0xC0,0x03,0x3C,0xFC,0xFF,0x3F,0x01,0x80,0xC0,0x03,0x00,0x06,0x47,0x02,0x80,0xE0,0xFF,0x03,0x01,0x80,
+    0x00,0x80,0x03,0x05,0x85,0x00,0xF8,0x03,0x00,0xFE,0x03,0x80,0xFF,0x03,0xC0,0x0F,0x00,0xE0,0x03,0x00,0xE0,0x01,0x00,0x00,
+    0x80,0xF0,0x00,0x00,0x04,0x86,0xF0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x03,0x00,0xC0,0x07,0x06,0x80,0xFF,0x07,0x00,0xFF,0x07,
+    0x00,0xFC,0x01,0x46,0x02,0x85,0xC0,0x1F,0x00,0xF0,0x7F,0x00,0xF0,0xFF,0x00,0x70,0xF0,0x01,0x00,0xC0,0x03,0x00,0x80,0x07,
+    0x00,0x80,0x00,0x00,0x0F,0x01,0x89,0x00,0x00,0x1E,0x80,0x1F,0x1E,0xC0,0x7F,0x1E,0xF0,0xFF,0x1E,0xF0,0xC1,0x1F,0xF8,0x80,
+    0x1F,0x78,0x00,0x1F,0x7C,0x00,0x1F,0x3C,0x00,0x1F,0x3C,0x00,0x1E,0x00,0x80,0x3C,0x00,0x0F,0x00,0x86,0x38,0x00,0x0F,0x78,
+    0x80,0x07,0xF8,0x80,0x07,0xF0,0xE1,0x03,0xE0,0xFF,0x01,0xC0,0xFF,0x00,0x00,0x3F,0x00,0x46,0x02,0x80,0xF8,0xFF,0x0F,0x02,
+    0x80,0x70,0x00,0x00,0x00,0x8F,0xE0,0x00,0x00,0xE0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x03,0x00,0x80,0x03,0x00,0x80,0x07,0x00,
+    0x00,0x07,0x00,0x00,0x0F,0x00,0x00,0x0E,0x00,0x00,0x1E,0x00,0x00,0x1C,0x00,0x00,0x3C,0x00,0x00,0x38,0x00,0x00,0x78,0x00,
+    0x00,0x70,0x00,0x00,0xF0,0x00,0x00,0x80,0x00,0xE0,0x01,0x01,0x80,0x00,0xC0,0x03,0x01,0x47,0x02,0x85,0x80,0x7F,0x00,0xE0,
+    0xFF,0x01,0xF0,0xFF,0x03,0xF0,0xC1,0x07,0xF8,0x80,0x0F,0x78,0x00,0x0F,0x01,0x8B,0x78,0x80,0x0F,0xF0,0x80,0x0F,0xE0,0xC1,
+    0x07,0xC0,0xF3,0x03,0x80,0xFF,0x01,0x00,0xFF,0x00,0x80,0xFF,0x01,0xE0,0xDF,0x03,0xF0,0x87,0x07,0xF8,0x03,0x0F,0xF8,0x00,
+    0x0F,0x7C,0x00,0x1E,0x00,0x80,0x3C,0x00,0x1E,0x01,0x85,0x3C,0x00,0x1F,0x78,0x80,0x0F,0xF0,0xC1,0x0F,0xE0,0xFF,0x07,0xC0,
+    0xFF,0x01,0x00,0x7F,0x00,0x46,0x02,0x87,0x00,0x7E,0x00,0x80,0xFF,0x01,0xE0,0xFF,0x03,0xE0,0xC3,0x07,0xF0,0x80,0x0F,0xF0,
+    0x00,0x0F,0x78,0x00,0x0E,0x78,0x00,0x1E,0x00,0x80,0x3C,0x00,0x1E,0x00,0x89,0x7C,0x00,0x1E,0x7C,0x00,0x1F,0x7C,0x00,0x0F,
+    0xFC,0x80,0x0F,0xFC,0xC1,0x07,0xBC,0xFF,0x03,0x3C,0xFF,0x01,0x3C,0xFC,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0x01,0x80,0xF0,
+    0x00,0x00,0x00,0x84,0xE0,0x01,0x00,0xC0,0x07,0x07,0x80,0xFF,0x07,0x00,0xFF,0x07,0x00,0xFC,0x01,0x46,0x0A,0x80,0x00,0x7E,
+    0x00,0x04,0x48,0x80,0x00,0x7E,0x00,0x04,0x47,0x0A,0x80,0x00,0x7E,0x00,0x04,0x48,0x80,0x00,0x7E,0x00,0x04,0x80,0x00,0x1E,
+    0x00,0x00,0x83,0x00,0x1C,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0x60,0x00,0x41,0x0A,0x94,0x04,0x00,0x00,0x1C,0x00,0x00,
+    0x7C,0x00,0x00,0xF8,0x01,0x00,0xE0,0x07,0x00,0x80,0x0F,0x00,0x00,0x3F,0x00,0x00,0xFC,0x00,0x00,0xF0,0x03,0x00,0xC0,0x0F,
+    0x00,0x00,0x3F,0x00,0xC0,0x0F,0x00,0xF0,0x03,0x00,0xFC,0x00,0x00,0x3F,0x00,0x80,0x0F,0x00,0xE0,0x07,0x00,0xF8,0x01,0x00,
+    0x7C,0x00,0x00,0x1C,0x00,0x00,0x04,0x00,0x00,0x47,0x0F,0x80,0xFC,0xFF,0x3F,0x01,0x43,0x80,0xFC,0xFF,0x3F,0x01,0x4D,0x0A,
+    0x94,0x00,0x00,0x20,0x00,0x00,0x38,0x00,0x00,0x3E,0x00,0x80,0x1F,0x00,0xE0,0x07,0x00,0xF0,0x01,0x00,0xFC,0x00,0x00,0x3F,
+    0x00,0xC0,0x0F,0x00,0xF0,0x03,0x00,0xFC,0x00,0x00,0xF0,0x03,0x00,0xC0,0x0F,0x00,0x00,0x3F,0x00,0x00,0xFC,0x00,0x00,0xF0,
+    0x01,0x00,0xE0,0x07,0x00,0x80,0x1F,0x00,0x00,0x3E,0x00,0x00,0x38,0x00,0x00,0x20,0x47,0x02,0x85,0x00,0xFF,0x03,0xC0,0xFF,
+    0x1F,0xF0,0xFF,0x1F,0xF0,0x03,0x1C,0xF8,0x00,0x1C,0x78,0x00,0x1C,0x00,0x80,0x78,0x00,0x00,0x00,0x86,0xF0,0x00,0x00,0xE0,
+    0x01,0x00,0xC0,0x03,0x00,0x80,0x0F,0x00,0x00,0x1F,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0x80,0x00,0xF0,0x00,0x02,0x43,
+    0x80,0x00,0xF0,0x00,0x02,0x47,0x02,0x8E,0x80,0x3F,0x00,0xC0,0xFF,0x00,0xE0,0xE1,0x03,0x70,0x80,0x07,0x70,0x00,0x0F,0x38,
+    0x00,0x0E,0xF8,0x07,0x1C,0xF8,0x0F,0x1C,0x78,0x1C,0x38,0x38,0x38,0x38,0x38,0x70,0x38,0x38,0x70,0x70,0x38,0x60,0x70,0x38,
+    0xE0,0x70,0x78,0xE0,0x70,0x00,0x80,0xF8,0xE0,0x70,0x00,0x8B,0xF8,0xE1,0x70,0xB8,0xE1,0x70,0xB8,0x73,0x78,0x38,0x7F,0x38,
+    0x3F,0x3E,0x38,0x3F,0x1C,0x1C,0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x00,0x07,0xC0,0xC0,0x03,0xC0,0xFF,0x01,0x00,0x7F,0x00,
+    0x46,0x06,0x81,0x00,0x3C,0x00,0x00,0x7E,0x00,0x01,0x80,0x00,0xEF,0x00,0x00,0x81,0x80,0xE7,0x01,0x80,0xC7,0x01,0x00,0x82,
+    0xC0,0xC3,0x03,0xC0,0x83,0x03,0xE0,0x81,0x07,0x00,0x81,0xE0,0x01,0x07,0xF0,0x00,0x0F,0x00,0x80,0xF8,0xFF,0x1F,0x01,0x80,
+    0x3C,0x00,0x3C,0x00,0x81,0x3E,0x00,0x7C,0x1E,0x00,0x78,0x00,0x80,0x1F,0x00,0xF0,0x47,0x06,0x84,0x80,0xFF,0x0F,0xE0,0xFF,
+    0x0F,0xF0,0xFF,0x0F,0xF8,0x01,0x0F,0x78,0x00,0x0F,0x02,0x88,0xF0,0x00,0x0F,0xE0,0x03,0x0F,0xC0,0xFF,0x0F,0x00,0xFF,0x0F,
+    0xC0,0xFF,0x0F,0xF0,0x03,0x0F,0xF8,0x00,0x0F,0x78,0x00,0x0F,0x3C,0x00,0x0F,0x02,0x84,0x7C,0x00,0x0F,0xF8,0x00,0x0F,0xF8,
+    0xFF,0x0F,0xE0,0xFF,0x0F,0x80,0xFF,0x0F,0x47,0x06,0x87,0xF0,0x1F,0x00,0xFE,0x7F,0x00,0xFE,0xFF,0x01,0x1E,0xF0,0x03,0x02,
+    0xC0,0x07,0x00,0x80,0x0F,0x00,0x00,0x1F,0x00,0x00,0x1E,0x00,0x80,0x00,0x00,0x3C,0x05,0x80,0x00,0x00,0x1E,0x00,0x86,0x00,
+    0x00,0x1F,0x00,0x80,0x0F,0x00,0xC0,0x07,0x0E,0xF8,0x03,0xFE,0xFF,0x01,0xFE,0x7F,0x00,0xF0,0x1F,0x00,0x47,0x06,0x86,0x00,
+    0xFE,0x1F,0xC0,0xFF,0x1F,0xE0,0xFF,0x1F,0xF0,0x03,0x1E,0xF8,0x00,0x1E,0x7C,0x00,0x1E,0x3C,0x00,0x1E,0x00,0x80,0x1E,0x00,
+    0x1E,0x06,0x81,0x1C,0x00,0x1E,0x3C,0x00,0x1E,0x00,0x85,0x78,0x00,0x1E,0xF8,0x00,0x1E,0xF0,0x07,0x1E,0xE0,0xFF,0x1F,0x80,
+    0xFF,0x1F,0x00,0xFE,0x1F,0x47,0x06,0x80,0xF8,0xFF,0x0F,0x01,0x80,0x00,0x00,0x0F,0x06,0x80,0xE0,0xFF,0x0F,0x01,0x80,0x00,
+    0x00,0x0F,0x06,0x80,0xFC,0xFF,0x0F,0x01,0x47,0x06,0x80,0xFE,0xFF,0x07,0x01,0x80,0x00,0x80,0x07,0x06,0x80,0xF8,0xFF,0x07,
+    0x01,0x80,0x00,0x80,0x07,0x09,0x47,0x06,0x87,0xF0,0x1F,0x00,0xFE,0x7F,0x00,0xFE,0xFF,0x01,0x1E,0xF0,0x03,0x02,0xC0,0x07,
+    0x00,0x80,0x0F,0x00,0x00,0x1F,0x00,0x00,0x1E,0x00,0x80,0x00,0x00,0x3C,0x01,0x80,0xFE,0x03,0x3C,0x01,0x81,0x1E,0x00,0x3C,
+    0x1E,0x00,0x1E,0x00,0x86,0x1E,0x00,0x1F,0x1E,0x80,0x0F,0x1E,0xC0,0x07,0x1E,0xF8,0x03,0xFE,0xFF,0x01,0xFE,0x7F,0x00,0xF0,
+    0x1F,0x00,0x47,0x06,0x80,0x78,0x00,0x1E,0x09,0x80,0xF8,0xFF,0x1F,0x01,0x80,0x78,0x00,0x1E,0x09,0x47,0x06,0x80,0xF8,0xFF,
+    0x1F,0x01,0x80,0x00,0x3C,0x00,0x11,0x80,0xF8,0xFF,0x1F,0x01,0x47,0x06,0x80,0xC0,0xFF,0x07,0x01,0x80,0xC0,0x03,0x00,0x0E,
+    0x85,0xC0,0x07,0x00,0x80,0x07,0x00,0x80,0x0F,0x18,0x00,0xFF,0x1F,0x00,0xFE,0x1F,0x00,0xF8,0x07,0x47,0x06,0x98,0xF8,0x01,
+    0x1E,0xF0,0x01,0x1E,0xE0,0x03,0x1E,0xC0,0x07,0x1E,0x80,0x07,0x1E,0x00,0x0F,0x1E,0x00,0x1F,0x1E,0x00,0x3E,0x1E,0x00,0x3C,
+    0x1E,0x00,0x78,0x1E,0x00,0xF0,0x1E,0x00,0xE0,0x1E,0x00,0xF0,0x1F,0x00,0xF8,0x1E,0x00,0x7C,0x1E,0x00,0x3C,0x1E,0x00,0x1E,
+    0x1E,0x00,0x1F,0x1E,0x80,0x0F,0x1E,0xC0,0x07,0x1E,0xE0,0x03,0x1E,0xF0,0x01,0x1E,0xF8,0x00,0x1E,0xFC,0x00,0x1E,0x7E,0x00,
+    0x1E,0x47,0x06,0x80,0x00,0x00,0x0F,0x14,0x80,0xF8,0xFF,0x0F,0x01,0x47,0x06,0x80,0x7C,0x00,0x3E,0x00,0x81,0x7C,0x00,0x3F,
+    0xFC,0x00,0x3F,0x00,0x81,0xDC,0x80,0x3B,0xDC,0x81,0x3B,0x00,0x81,0x9C,0xC1,0x39,0x9C,0xC3,0x39,0x00,0x81,0x1C,0xE3,0x38,
+    0x1C,0xE7,0x38,0x00,0x81,0x1C,0x76,0x38,0x1C,0x7E,0x38,0x00,0x80,0x1C,0x3C,0x38,0x01,0x80,0x1C,0x00,0x38,0x03,0x47,0x06,
+    0x80,0x38,0x00,0x1E,0x00,0x81,0x38,0x00,0x1F,0x38,0x80,0x1F,0x00,0x84,0x38,0xC0,0x1F,0x38,0xE0,0x1F,0x38,0xE0,0x1D,0x38,
+    0xF0,0x1D,0x38,0xF8,0x1C,0x00,0x86,0x38,0x7C,0x1C,0x38,0x3C,0x1C,0x38,0x3E,0x1C,0x38,0x1F,0x1C,0x38,0x0F,0x1C,0xB8,0x0F,
+    0x1C,0xF8,0x07,0x1C,0x00,0x81,0xF8,0x03,0x1C,0xF8,0x01,0x1C,0x00,0x81,0xF8,0x00,0x1C,0x78,0x00,0x1C,0x00,0x47,0x06,0x86,
+    0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x3C,0x00,0x3C,0x00,0x80,0x1E,
+    0x00,0x78,0x07,0x80,0x3C,0x00,0x3C,0x00,0x85,0x78,0x00,0x1E,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,
+    0x00,0xFF,0x00,0x47,0x06,0x85,0x80,0xFF,0x0F,0xE0,0xFF,0x0F,0xF8,0xFF,0x0F,0xF8,0x00,0x0F,0x7C,0x00,0x0F,0x3C,0x00,0x0F,
+    0x03,0x86,0x78,0x00,0x0F,0xF8,0x00,0x0F,0xF0,0x03,0x0F,0xE0,0xFF,0x0F,0xC0,0xFF,0x0F,0x00,0xFE,0x0F,0x00,0x00,0x0F,0x07,
+    0x47,0x06,0x86,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x3C,0x00,0x3C,
+    0x00,0x80,0x1E,0x00,0x78,0x07,0x80,0x3C,0x00,0x3C,0x00,0x8B,0x78,0x00,0x1E,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,
+    0xC0,0xFF,0x03,0xC0,0xFF,0x00,0xE0,0x03,0x00,0xF8,0x01,0x00,0xFF,0x00,0x00,0x7E,0x00,0x00,0x1E,0x00,0x00,0x04,0x00,0x00,
+    0x41,0x06,0x85,0x80,0xFF,0x0F,0xE0,0xFF,0x0F,0xF0,0xFF,0x0F,0xF0,0x01,0x0F,0xF8,0x00,0x0F,0x78,0x00,0x0F,0x02,0x84,0xF0,
+    0x00,0x0F,0xF0,0x01,0x0F,0xE0,0x07,0x0F,0xC0,0xFF,0x0F,0x00,0xFF,0x0F,0x00,0x80,0x80,0x0F,0x0F,0x00,0x82,0xC0,0x07,0x0F,
+    0xE0,0x03,0x0F,0xF0,0x01,0x0F,0x00,0x82,0xF8,0x00,0x0F,0x7C,0x00,0x0F,0x3E,0x00,0x0F,0x00,0x47,0x06,0x84,0x80,0xFF,0x00,
+    0xF0,0xFF,0x03,0xF0,0xFF,0x07,0xF0,0x80,0x0F,0x00,0x00,0x1E,0x02,0x89,0x00,0x00,0x1F,0x00,0xC0,0x0F,0x00,0xF8,0x0F,0x00,
+    0xFF,0x03,0xE0,0xFF,0x00,0xF0,0x3F,0x00,0xF8,0x07,0x00,0xFC,0x00,0x00,0x7C,0x00,0x00,0x3C,0x00,0x00,0x01,0x84,0x78,0x00,
+    0x18,0xF8,0x01,0x1F,0xF0,0xFF,0x1F,0xC0,0xFF,0x1F,0x00,0xFF,0x01,0x47,0x06,0x80,0xFF,0xFF,0xFF,0x01,0x80,0x00,0x3C,0x00,
+    0x14,0x47,0x06,0x80,0x3C,0x00,0x1E,0x11,0x85,0x78,0x00,0x0F,0xF8,0x00,0x0F,0xF0,0xC1,0x07,0xF0,0xFF,0x07,0xC0,0xFF,0x01,
+    0x00,0x7F,0x00,0x47,0x06,0x81,0x0F,0x00,0xF8,0x1E,0x00,0x78,0x00,0x83,0x3E,0x00,0x7C,0x3C,0x00,0x3C,0x3C,0x00,0x3E,0x78,
+    0x00,0x1E,0x00,0x83,0x78,0x00,0x1F,0xF0,0x00,0x0F,0xF0,0x80,0x0F,0xE0,0x81,0x07,0x00,0x88,0xE0,0xC1,0x07,0xC0,0xC3,0x03,
+    0xC0,0xE3,0x03,0x80,0xE3,0x01,0x80,0xE7,0x01,0x80,0xF7,0x01,0x00,0xF7,0x00,0x00,0xFF,0x00,0x00,0x7E,0x00,0x01,0x80,0x00,
+    0x3C,0x00,0x47,0x06,0x81,0x07,0x00,0xE0,0x07,0x00,0xF0,0x00,0x80,0x0E,0x00,0x70,0x00,0x80,0x0E,0x3C,0x70,0x00,0x85,0x0E,
+    0x3E,0x70,0x0E,0x7E,0x78,0x1C,0x7E,0x78,0x1C,0x7E,0x38,0x1C,0x7F,0x38,0x1C,0xE7,0x38,0x00,0x83,0x1C,0xE7,0x3C,0x38,0xE7,
+    0x3C,0xB8,0xC7,0x1C,0xB8,0xC3,0x1D,0x01,0x81,0xF8,0x83,0x1D,0xF0,0x81,0x1F,0x00,0x81,0xF0,0x81,0x0F,0xF0,0x01,0x0F,0x47,
+    0x06,0x98,0x1E,0x00,0x7C,0x3C,0x00,0x3E,0x38,0x00,0x1F,0x70,0x00,0x0F,0xF0,0x80,0x0F,0xE0,0xC1,0x07,0xC0,0xE1,0x03,0x80,
+    0xE3,0x03,0x80,0xF7,0x01,0x00,0xFF,0x00,0x00,0x7E,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0x7F,0x00,0x00,0xFF,0x00,0x80,
+    0xEF,0x01,0xC0,0xC7,0x01,0xE0,0xC3,0x03,0xE0,0x83,0x07,0xF0,0x01,0x0F,0xF8,0x00,0x0E,0x78,0x00,0x1E,0x7C,0x00,0x3C,0x3E,
+    0x00,0x78,0x1F,0x00,0xF0,0x47,0x06,0x8E,0x0F,0x00,0x7C,0x1E,0x00,0x3C,0x1C,0x00,0x1E,0x3C,0x00,0x1F,0x38,0x00,0x0F,0x78,
+    0x80,0x07,0xF0,0xC0,0x07,0xE0,0xE0,0x03,0xE0,0xE1,0x01,0xC0,0xF1,0x01,0xC0,0xFB,0x00,0x80,0x7F,0x00,0x00,0x7F,0x00,0x00,
+    0x3F,0x00,0x00,0x1E,0x00,0x09,0x47,0x06,0x80,0xFC,0xFF,0x1F,0x01,0x93,0x7C,0x00,0x00,0xF8,0x00,0x00,0xF0,0x00,0x00,0xE0,
+    0x01,0x00,0xC0,0x03,0x00,0x80,0x07,0x00,0x80,0x0F,0x00,0x00,0x1F,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,
+    0xF8,0x00,0x00,0xF0,0x01,0x00,0xE0,0x01,0x00,0xC0,0x03,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x1F,0x00,0x00,0x3E,0xFC,
+    0xFF,0x3F,0x01,0x47,0x00,0x80,0xF8,0x7F,0x00,0x01,0x80,0x00,0x70,0x00,0x1D,0x80,0xF8,0x7F,0x00,0x01,0x41,0x00,0x81,0x00,
+    0x00,0x70,0x00,0x00,0x38,0x00,0x80,0x00,0x00,0x1C,0x00,0x80,0x00,0x00,0x0E,0x00,0x80,0x00,0x00,0x07,0x00,0x80,0x00,0x80,
+    0x03,0x00,0x80,0x00,0xC0,0x01,0x00,0x80,0x00,0xE0,0x00,0x00,0x80,0x00,0x70,0x00,0x00,0x83,0x00,0x38,0x00,0x00,0x3C,0x00,
+    0x00,0x1C,0x00,0x00,0x0E,0x00,0x00,0x80,0x00,0x07,0x00,0x00,0x80,0x80,0x03,0x00,0x00,0x80,0xC0,0x01,0x00,0x00,0x80,0xE0,
+    0x00,0x00,0x00,0x80,0x70,0x00,0x00,0x00,0x80,0x38,0x00,0x00,0x00,0x80,0x1C,0x00,0x00,0x00,0x80,0x0E,0x00,0x00,0x41,0x00,
+    0x80,0x00,0xFE,0x1F,0x01,0x80,0x00,0x0E,0x00,0x1D,0x80,0x00,0xFE,0x1F,0x01,0x41,0x02,0x80,0x00,0x10,0x00,0x00,0x80,0x00,
+    0x38,0x00,0x00,0x81,0x00,0x3C,0x00,0x00,0x7C,0x00,0x00,0x80,0x00,0xEE,0x00,0x00,0x8B,0x00,0xE7,0x00,0x00,0xC7,0x01,0x80,
+    0xC3,0x01,0x80,0x83,0x03,0xC0,0x83,0x03,0xC0,0x01,0x03,0xE0,0x01,0x07,0xE0,0x00,0x07,0xE0,0x00,0x0E,0x70,0x00,0x0E,0x70,
+    0x00,0x1C,0x38,0x00,0x1C,0x00,0x80,0x1C,0x00,0x38,0x4D,0x1F,0x80,0xFF,0xFF,0xFF,0x01,0x44,0x83,0x00,0xF0,0x00,0x00,0x78,
+    0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x63,0x0A,0x85,0x80,0xFF,0x00,0xC0,0xFF,0x07,0xE0,0xFF,0x07,0xF0,0x01,0x07,0xF0,0x00,
+    0x04,0xF0,0x00,0x00,0x01,0x85,0xF0,0x7F,0x00,0xF0,0xFF,0x01,0xF0,0xFF,0x07,0xF0,0xC0,0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x1E,
+    0x01,0x84,0xF0,0x01,0x1E,0xF8,0x87,0x1F,0x7F,0xFF,0x0F,0x7F,0xFE,0x07,0x1E,0xF8,0x01,0x47,0x00,0x80,0x00,0x00,0x1E,0x08,
+    0x86,0x00,0x1F,0x1E,0xC0,0x7F,0x1E,0xE0,0xFF,0x1E,0xF0,0xE1,0x1E,0xF0,0x80,0x1F,0xF0,0x00,0x1F,0x78,0x00,0x1E,0x06,0x80,
+    0xF0,0x00,0x1E,0x00,0x84,0xF0,0x01,0x1F,0xE0,0xC3,0x1F,0xC0,0xFF,0x1F,0x80,0xFF,0x1E,0x00,0x3E,0x1C,0x47,0x0A,0x87,0xE0,
+    0x3F,0x00,0xF8,0xFF,0x00,0xF8,0xFF,0x03,0x38,0xE0,0x07,0x00,0xC0,0x07,0x00,0x80,0x0F,0x00,0x00,0x0F,0x00,0x00,0x1E,0x05,
+    0x86,0x00,0x00,0x0F,0x00,0x80,0x0F,0x00,0xC0,0x0F,0x38,0xF0,0x07,0xF8,0xFF,0x03,0xF8,0xFF,0x00,0xE0,0x3F,0x00,0x47,0x00,
+    0x80,0x78,0x00,0x00,0x08,0x85,0x78,0xFC,0x00,0x78,0xFF,0x03,0xF8,0xFF,0x07,0xF8,0x83,0x0F,0xF8,0x00,0x0F,0x78,0x00,0x1E,
+    0x00,0x80,0x78,0x00,0x3C,0x06,0x85,0xF8,0x00,0x1E,0xF8,0x01,0x1E,0xF8,0x07,0x0F,0x78,0xFF,0x0F,0x78,0xFE,0x07,0x78,0xF8,
+    0x01,0x47,0x0A,0x87,0x00,0x3F,0x00,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xF0,0xC1,0x07,0xF0,0x80,0x07,0x70,0x00,0x0F,0x78,0x00,
+    0x0F,0x78,0x00,0x1E,0x00,0x80,0xF8,0xFF,0x1F,0x01,0x80,0x00,0x00,0x1E,0x00,0x80,0x00,0x00,0x0F,0x00,0x84,0x00,0x80,0x0F,
+    0x38,0xE0,0x07,0xF8,0xFF,0x03,0xF8,0xFF,0x01,0xC0,0x3F,0x00,0x47,0x00,0x85,0xFE,0x03,0x00,0xFF,0x0F,0x00,0xFF,0x3F,0x00,
+    0x03,0x3E,0x00,0x00,0x7C,0x00,0x00,0x78,0x00,0x03,0x80,0xFE,0xFF,0x1F,0x01,0x80,0x00,0x78,0x00,0x10,0x47,0x0A,0x85,0x78,
+    0xFC,0x00,0x78,0xFF,0x03,0xF8,0xFF,0x07,0xF8,0x83,0x0F,0xF8,0x00,0x0F,0x78,0x00,0x1E,0x00,0x80,0x78,0x00,0x3C,0x06,0x86,
+    0xF8,0x00,0x1E,0xF8,0x01,0x1F,0x78,0x87,0x0F,0x78,0xFF,0x0F,0x78,0xFE,0x07,0x78,0xF8,0x01,0x78,0x00,0x00,0x00,0x80,0xF0,
+    0x00,0x00,0x00,0x83,0xE0,0x03,0x0E,0xC0,0xFF,0x0F,0x80,0xFF,0x0F,0x00,0xFE,0x01,0x00,0x80,0x00,0x00,0x0F,0x08,0x87,0xE0,
+    0x07,0x0F,0xF0,0x1F,0x0F,0xF8,0x3F,0x0F,0x78,0x70,0x0F,0x7C,0xE0,0x0F,0x3C,0xC0,0x0F,0x3C,0x80,0x0F,0x3C,0x00,0x0F,0x0C,
+    0x47,0x00,0x80,0x00,0x3E,0x00,0x03,0x44,0x80,0x00,0xFE,0x1F,0x01,0x80,0x00,0x1E,0x00,0x10,0x47,0x00,0x80,0x80,0x0F,0x00,
+    0x03,0x44,0x80,0x80,0xFF,0x0F,0x01,0x80,0x80,0x07,0x00,0x13,0x84,0x00,0x0F,0x00,0x00,0x1F,0x18,0x00,0xFE,0x1F,0x00,0xFC,
+    0x1F,0x00,0xF0,0x07,0x00,0x80,0x00,0x00,0x0F,0x08,0x89,0xF8,0x01,0x0F,0xF0,0x01,0x0F,0xE0,0x03,0x0F,0xC0,0x07,0x0F,0x80,
+    0x0F,0x0F,0x80,0x1F,0x0F,0x00,0x1F,0x0F,0x00,0x3E,0x0F,0x00,0x7C,0x0F,0x00,0xF8,0x0F,0x00,0x89,0x00,0x7C,0x0F,0x00,0x3E,
+    0x0F,0x00,0x1F,0x0F,0x80,0x0F,0x0F,0xC0,0x07,0x0F,0xE0,0x03,0x0F,0xF0,0x01,0x0F,0xF8,0x01,0x0F,0xFC,0x00,0x0F,0x7E,0x00,
+    0x0F,0x47,0x00,0x80,0x00,0xFF,0x0F,0x01,0x80,0x00,0x0F,0x00,0x1A,0x47,0x0A,0x85,0x70,0xF0,0x38,0xF8,0xF8,0x39,0xFC,0xF9,
+    0x3B,0x9C,0x1F,0x3F,0x1C,0x1F,0x3E,0x1C,0x1E,0x3C,0x00,0x80,0x1C,0x1C,0x38,0x0C,0x47,0x0A,0x87,0xE0,0x07,0x0F,0xF0,0x1F,
+    0x0F,0xF8,0x3F,0x0F,0x78,0x70,0x0F,0x7C,0xE0,0x0F,0x3C,0xC0,0x0F,0x3C,0x80,0x0F,0x3C,0x00,0x0F,0x0C,0x47,0x0A,0x85,0x00,
+    0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x00,0x80,0x3C,0x00,0x3C,0x05,0x80,
+    0x78,0x00,0x1E,0x00,0x84,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0xFF,0x00,0x47,0x0A,0x86,0x80,
+    0x0F,0x0F,0xE0,0x3F,0x0F,0xF0,0x7F,0x0F,0xF8,0xF0,0x0F,0x78,0xC0,0x0F,0x78,0x80,0x0F,0x3C,0x00,0x0F,0x06,0x80,0x78,0x00,
+    0x0F,0x00,0x85,0xF8,0x80,0x0F,0xF0,0xE1,0x0F,0xE0,0xFF,0x0F,0xC0,0x7F,0x0F,0x00,0x1F,0x0F,0x00,0x00,0x0F,0x06,0x0A,0x85,
+    0x38,0xFC,0x00,0x78,0xFF,0x03,0xF8,0xFF,0x07,0xF8,0x83,0x0F,0xF8,0x00,0x0F,0x78,0x00,0x1E,0x00,0x80,0x78,0x00,0x3C,0x06,
+    0x86,0xF8,0x00,0x1E,0xF8,0x01,0x1E,0x78,0x07,0x0F,0x78,0xFE,0x0F,0x78,0xFC,0x07,0x78,0xF8,0x01,0x78,0x00,0x00,0x06,0x0A,
+    0x87,0xFC,0xC1,0x03,0xFC,0xC7,0x03,0xFC,0xCF,0x03,0x1C,0xDE,0x03,0x1C,0xF8,0x03,0x1C,0xF0,0x03,0x1C,0xE0,0x03,0x00,0xC0,
+    0x03,0x0C,0x47,0x0A,0x84,0xC0,0x7F,0x00,0xF0,0xFF,0x03,0xF0,0xFF,0x07,0x70,0xC0,0x0F,0x00,0x00,0x0F,0x01,0x87,0x00,0xC0,
+    0x0F,0x00,0xF8,0x07,0x00,0xFF,0x03,0xC0,0xFF,0x00,0xF0,0x1F,0x00,0xF0,0x03,0x00,0xF8,0x00,0x00,0x78,0x00,0x00,0x00,0x84,
+    0xF8,0x00,0x10,0xF0,0x01,0x1E,0xE0,0xFF,0x1F,0xC0,0xFF,0x1F,0x00,0xFF,0x03,0x47,0x06,0x80,0x00,0xF0,0x00,0x02,0x80,0xFC,
+    0xFF,0x1F,0x01,0x80,0x00,0xF0,0x00,0x0B,0x84,0x00,0xF8,0x00,0x00,0x7C,0x00,0xFC,0x7F,0x00,0xFC,0x3F,0x00,0xFC,0x0F,0x00,
+    0x47,0x0A,0x80,0xF0,0x00,0x1E,0x0C,0x86,0xF0,0x01,0x1E,0xF0,0x03,0x1E,0xF0,0x07,0x1E,0xF0,0x0E,0x1F,0xF0,0xFE,0x0F,0xF0,
+    0xF8,0x07,0xF0,0xF0,0x03,0x47,0x0A,0x81,0x3E,0x00,0x78,0x3C,0x00,0x3C,0x00,0x83,0x7C,0x00,0x3E,0x78,0x00,0x1E,0x78,0x00,
+    0x1F,0xF0,0x00,0x0F,0x00,0x80,0xE0,0x81,0x07,0x00,0x81,0xE0,0xC1,0x07,0xC0,0xC3,0x03,0x00,0x83,0x80,0xE3,0x01,0x80,0xE7,
+    0x01,0x00,0xF7,0x00,0x00,0xFF,0x00,0x00,0x80,0x00,0x7E,0x00,0x00,0x80,0x00,0x3C,0x00,0x47,0x0A,0x80,0x07,0x00,0xF0,0x00,
+    0x81,0x06,0x3C,0xF0,0x0E,0x3E,0x70,0x00,0x80,0x0E,0x7E,0x78,0x00,0x82,0x0C,0x66,0x78,0x1C,0x67,0x38,0x1C,0xE7,0x38,0x00,
+    0x82,0x1C,0xC3,0x3C,0x98,0xC3,0x3C,0xB8,0xC3,0x1D,0x00,0x85,0xB8,0x81,0x1D,0xF8,0x81,0x1F,0xF0,0x81,0x1F,0xF0,0x01,0x1F,
+    0xF0,0x01,0x0F,0xF0,0x00,0x0F,0x47,0x0A,0x94,0x78,0x00,0x3E,0x70,0x00,0x1F,0xE0,0x80,0x0F,0xE0,0x81,0x07,0xC0,0xC1,0x07,
+    0x80,0xE3,0x03,0x80,0xF7,0x01,0x00,0xF7,0x01,0x00,0xFE,0x00,0x00,0x7E,0x00,0x00,0x3C,0x00,0x00,0x7E,0x00,0x00,0xFF,0x00,
+    0x80,0xEF,0x01,0x80,0xCF,0x01,0xC0,0xC7,0x03,0xE0,0x83,0x07,0xE0,0x01,0x07,0xF0,0x01,0x0F,0xF8,0x00,0x1E,0x7C,0x00,0x3C,
+    0x47,0x0A,0x8C,0x1E,0x00,0x7C,0x1C,0x00,0x3C,0x3C,0x00,0x3E,0x38,0x00,0x1E,0x78,0x00,0x1E,0x70,0x00,0x1F,0xF0,0x00,0x0F,
+    0xF0,0x80,0x0F,0xE0,0x81,0x07,0xE0,0xC1,0x07,0xC0,0xC3,0x03,0xC0,0xE3,0x03,0x80,0xE7,0x01,0x00,0x83,0x00,0xF7,0x00,0x00,
+    0xFF,0x00,0x00,0xFE,0x00,0x00,0x7E,0x00,0x00,0x80,0x00,0x3C,0x00,0x00,0x87,0x00,0x38,0x00,0x00,0x78,0x00,0x00,0x70,0x00,
+    0x00,0xF0,0x00,0x00,0xE0,0x01,0x00,0xC0,0x3F,0x00,0x80,0x3F,0x00,0x00,0x3F,0x0A,0x80,0xFC,0xFF,0x1F,0x01,0x8F,0x7C,0x00,
+    0x00,0xF8,0x00,0x00,0xF0,0x01,0x00,0xE0,0x03,0x00,0xC0,0x07,0x00,0x80,0x0F,0x00,0x00,0x1F,0x00,0x00,0x3E,0x00,0x00,0x7C,
+    0x00,0x00,0xF8,0x00,0x00,0xF0,0x01,0x00,0xE0,0x03,0x00,0xC0,0x07,0x00,0x80,0x0F,0x00,0x00,0x1F,0xFC,0xFF,0x1F,0x01,0x47,
+    0x00,0x84,0xF0,0x03,0x00,0xF0,0x0F,0x00,0xF0,0x1F,0x00,0x00,0x3E,0x00,0x00,0x3C,0x00,0x03,0x81,0x00,0x3E,0x00,0x00,0x1E,
+    0x00,0x03,0x87,0x00,0x3E,0x00,0x00,0x7C,0x00,0x00,0xF8,0x07,0x00,0xE0,0x07,0x00,0xF8,0x07,0x00,0x7C,0x00,0x00,0x3C,0x00,
+    0x00,0x1E,0x00,0x03,0x81,0x00,0x3E,0x00,0x00,0x3C,0x00,0x03,0x83,0x00,0x3E,0x00,0xF0,0x1F,0x00,0xF0,0x0F,0x00,0xF0,0x03,
+    0x00,0x41,0x00,0x80,0x00,0x1C,0x00,0x23,0x41,0x00,0x84,0x00,0xC0,0x0F,0x00,0xF0,0x0F,0x00,0xF8,0x0F,0x00,0x7C,0x00,0x00,
+    0x3C,0x00,0x03,0x81,0x00,0x7C,0x00,0x00,0x78,0x00,0x03,0x87,0x00,0x7C,0x00,0x00,0x3E,0x00,0xE0,0x1F,0x00,0xE0,0x07,0x00,
+    0xE0,0x1F,0x00,0x00,0x3E,0x00,0x00,0x7C,0x00,0x00,0x78,0x00,0x03,0x81,0x00,0x7C,0x00,0x00,0x3C,0x00,0x03,0x83,0x00,0x7C,
+    0x00,0x00,0xF8,0x0F,0x00,0xF0,0x0F,0x00,0xC0,0x0F,0x41,0x11,0x87,0x00,0x80,0x0F,0x0E,0xE0,0x1F,0x0E,0xF0,0x3F,0x0E,0xFC,
+    0x38,0x1C,0x3F,0x70,0xFC,0x0F,0x70,0xF8,0x07,0x70,0xF0,0x01,0x00,0x4D,0x06,0x81,0xE0,0xFF,0x07,0x20,0x00,0x04,0x15,0x80,
+    0xE0,0xFF,0x07,0x47,0x02,0x80,0x00,0x08,0x00,0x00,0x9A,0x00,0x1C,0x00,0x00,0x3E,0x00,0x00,0x7E,0x00,0x00,0x7F,0x00,0x80,
+    0xFF,0x00,0x80,0xFF,0x01,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0xFF,0x0F,0xF8,0xFF,0x1F,0xFC,0xFF,0x3F,0xFE,0xFF,0x7F,0xFF,
+    0xFF,0xFF,0xFE,0xFF,0x7F,0xFC,0xFF,0x3F,0xF8,0xFF,0x1F,0xF0,0xFF,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0xC0,0xFF,0x01,0x80,
+    0xFF,0x00,0x00,0x7F,0x00,0x00,0x7E,0x00,0x00,0x3E,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x08,0x00,0x47,0x80,0xF0,0xF0,
+    0xF0,0x02,0x43,0x80,0xF0,0xF0,0xF0,0x02,0x43,0x80,0xF0,0xF0,0xF0,0x02,0x43,0x80,0xF0,0xF0,0xF0,0x02,0x43,0x80,0xF0,0xF0,
+    0xF0,0x02,0x43,0x80,0x00,0x1C,0x00,0x11,0x80,0x00,0xFC,0xFF,0x01,0x51,0x12,0x80,0x00,0xFC,0xFF,0x01,0x80,0x00,0x1C,0x00,
+    0x10,0x12,0x80,0xFF,0x1F,0x00,0x01,0x80,0x00,0x1C,0x00,0x10,0x80,0x00,0x1C,0x00,0x11,0x80,0xFF,0x1F,0x00,0x01,0x51,0x80,
+    0x00,0x1C,0x00,0x11,0x80,0xFF,0xFF,0xFF,0x01,0x80,0x00,0x1C,0x00,0x10,0x12,0x80,0xFF,0xFF,0xFF,0x01,0x51,0x80,0x00,0x1C,
+    0x00,0x11,0x80,0xFF,0x1F,0x00,0x01,0x80,0x00,0x1C,0x00,0x10,0x80,0x00,0x1C,0x00,0x11,0x80,0x00,0xFC,0xFF,0x01,0x80,0x00,
+    0x1C,0x00,0x10,0x12,0x80,0xFF,0xFF,0xFF,0x01,0x80,0x00,0x1C,0x00,0x10,0x80,0x00,0x1C,0x00,0x26,0x0A,0x80,0x00,0x3C,0x00,
+    0x02,0x43,0x80,0x00,0x3C,0x00,0x13,0x02,0x80,0x00,0x0C,0x00,0x01,0x85,0x80,0x3F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x01,0xE0,
+    0xEC,0x03,0x00,0x8C,0x07,0x00,0x0C,0x0F,0x00,0x81,0x00,0x0C,0x1F,0x00,0x0C,0x1E,0x05,0x88,0x00,0x0C,0x1F,0x00,0x0C,0x0F,
+    0x00,0x8C,0x0F,0x00,0xCC,0x07,0x60,0xFC,0x07,0xE0,0xFF,0x03,0xE0,0xFF,0x00,0x80,0x3F,0x00,0x00,0x0C,0x00,0x01,0x47,0x02,
+    0x85,0xF8,0x07,0x00,0xF8,0x0F,0x00,0xF8,0x1F,0x00,0x08,0x3C,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x05,0x80,0x80,0xFF,0x03,
+    0x01,0x80,0x00,0x78,0x00,0x05,0x84,0x00,0x70,0x00,0x00,0xF0,0x00,0x00,0xE0,0x01,0x00,0xC0,0x03,0xF8,0xFF,0x07,0x01,0x47,
+    0x07,0x87,0x08,0x00,0x08,0x1C,0x00,0x1C,0x38,0x3E,0x0E,0xF0,0xFF,0x07,0xE0,0xFF,0x03,0xE0,0xC1,0x03,0xE0,0x80,0x03,0x70,
+    0x00,0x07,0x03,0x86,0xE0,0x80,0x03,0xE0,0xC1,0x03,0xE0,0xFF,0x03,0xF0,0xFF,0x07,0x38,0x3E,0x0E,0x1C,0x00,0x1C,0x08,0x00,
+    0x08,0x4C,0x02,0x8E,0x0F,0x00,0x7C,0x0E,0x00,0x3E,0x1C,0x00,0x1E,0x3C,0x00,0x1F,0x78,0x00,0x0F,0x70,0x80,0x07,0xE0,0xC0,
+    0x07,0xE0,0xC1,0x03,0xC0,0xE1,0x03,0x80,0xF3,0x01,0x80,0xF7,0x00,0x00,0xFF,0x00,0x00,0x7E,0x00,0x00,0x3E,0x00,0xF0,0xFF,
+    0x0F,0x01,0x80,0x00,0x3C,0x00,0x02,0x80,0xF0,0xFF,0x0F,0x01,0x80,0x00,0x3C,0x00,0x03,0x47,0x00,0x80,0x00,0x1C,0x00,0x0C,
+    0x47,0x80,0x00,0x1C,0x00,0x0D,0x41,0x02,0x85,0xC0,0x3F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x01,0x60,0xC0,0x03,0x00,0x80,0x07,
+    0x00,0x00,0x07,0x01,0x93,0x00,0xC0,0x07,0x00,0xE0,0x03,0x00,0xFC,0x01,0x00,0xFF,0x01,0x80,0xFF,0x01,0xC0,0x8F,0x03,0xE0,
+    0x03,0x03,0xF0,0x01,0x07,0xF0,0x00,0x07,0x70,0x00,0x07,0x70,0x80,0x07,0x70,0xE0,0x03,0xE0,0xF0,0x03,0xE0,0xFE,0x01,0xC0,
+    0x7F,0x00,0xC0,0x1F,0x00,0xE0,0x07,0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0x70,0x00,0x00,0x01,0x84,0xF0,0x00,0x04,0xE0,0x81,
+    0x07,0xC0,0xFF,0x07,0x80,0xFF,0x07,0x00,0xFE,0x00,0x41,0x80,0xE0,0x80,0x03,0x01,0x64,0x02,0x8C,0x00,0xFE,0x00,0x80,0xFF,
+    0x03,0xC0,0x01,0x07,0xE0,0x00,0x0E,0x70,0x00,0x1C,0x30,0x00,0x18,0x18,0x00,0x30,0x18,0x3F,0x30,0x98,0xFF,0x30,0x8C,0xFF,
+    0x61,0x8C,0xC1,0x63,0x0C,0x80,0x63,0x0C,0x00,0x67,0x03,0x8C,0x0C,0x80,0x67,0x0C,0x80,0x63,0x8C,0xE0,0x63,0x8C,0xFF,0x61,
+    0x98,0xFF,0x30,0x18,0x7E,0x30,0x18,0x00,0x30,0x30,0x00,0x18,0x70,0x00,0x1C,0xE0,0x00,0x0E,0xC0,0x01,0x07,0x80,0xFF,0x03,
+    0x00,0xFE,0x00,0x46,0x02,0x83,0x00,0xFE,0x00,0x80,0xFF,0x03,0xC0,0x83,0x03,0xC0,0x01,0x00,0x01,0x83,0xC0,0x7F,0x00,0xC0,
+    0xFF,0x01,0xC0,0xC1,0x03,0xC0,0x01,0x07,0x01,0x82,0xC0,0x87,0x07,0xF0,0xFC,0x03,0xF0,0xF0,0x01,0x55,0x0C,0x90,0x20,0x20,
+    0x00,0x70,0x70,0x00,0xE0,0xE0,0x00,0xC0,0xC1,0x01,0x80,0x83,0x03,0x00,0x07,0x07,0x00,0x0E,0x0E,0x00,0x1C,0x1C,0x00,0x38,
+    0x38,0x00,0x1C,0x1C,0x00,0x0E,0x0E,0x00,0x07,0x07,0x80,0x83,0x03,0xC0,0xC1,0x01,0xE0,0xE0,0x00,0x70,0x70,0x00,0x20,0x20,
+    0x00,0x49,0x0F,0x80,0xFE,0xFF,0x3F,0x01,0x80,0x0E,0x00,0x00,0x05,0x4D,0x11,0x80,0xF0,0xFF,0x0F,0x01,0x52,0x02,0x84,0x00,
+    0x7C,0x00,0x00,0xFF,0x01,0xC0,0x83,0x07,0xC0,0xFC,0x06,0x60,0xC6,0x0C,0x00,0x8A,0x30,0xC6,0x18,0x30,0xCC,0x18,0x30,0xF8,
+    0x18,0x30,0xC8,0x18,0x30,0xCC,0x18,0x60,0xCC,0x0C,0x60,0xC6,0x0C,0xC0,0x00,0x06,0xC0,0x83,0x07,0x00,0xFF,0x01,0x00,0x7C,
+    0x00,0x53,0x80,0xFF,0xFF,0xFF,0x01,0x64,0x02,0x83,0x00,0x7C,0x00,0x00,0xFE,0x00,0x00,0xC7,0x01,0x00,0x83,0x01,0x01,0x82,
+    0x00,0xC7,0x01,0x00,0xFE,0x00,0x00,0x7C,0x00,0x5B,0x0A,0x80,0x00,0x1C,0x00,0x04,0x80,0xFE,0xFF,0x3F,0x01,0x80,0x00,0x1C,
+    0x00,0x04,0x42,0x80,0xFE,0xFF,0x3F,0x01,0x47,0x02,0x83,0x00,0xFE,0x00,0x80,0xFF,0x03,0xC0,0x03,0x03,0xC0,0x01,0x00,0x01,
+    0x86,0x80,0x03,0x00,0x00,0x0F,0x00,0x00,0x3E,0x00,0x00,0x78,0x00,0x00,0xE0,0x01,0x00,0xC0,0x03,0xC0,0xFF,0x03,0x01,0x55,
+    0x02,0x83,0x00,0xFF,0x00,0x80,0xFF,0x03,0xC0,0x83,0x03,0xC0,0x01,0x00,0x00,0x84,0x80,0x07,0x00,0x00,0xFF,0x00,0x00,0xFE,
+    0x00,0x80,0x07,0x00,0xC0,0x01,0x00,0x01,0x82,0xC0,0x83,0x03,0x80,0xFF,0x03,0x00,0xFE,0x01,0x55,0x83,0x00,0x1E,0x00,0x00,
+    0x3C,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x63,0x0A,0x80,0x78,0x00,0x0F,0x0C,0x87,0xF8,0x00,0x0F,0xF8,0x80,0x0F,0xF8,0x81,
+    0x0F,0xF8,0xE3,0x0F,0x78,0xFF,0x0F,0x7C,0x7E,0x0F,0x3C,0x3C,0x0F,0x00,0x00,0x0F,0x06,0x02,0x83,0xE0,0xFF,0x01,0xE0,0xFF,
+    0x07,0x60,0xF0,0x0F,0x60,0xF0,0x1F,0x05,0x80,0x60,0xF0,0x0F,0x00,0x83,0x60,0xF0,0x07,0x60,0xF0,0x03,0x60,0xF0,0x00,0x60,
+    0x30,0x00,0x12,0x41,0x12,0x80,0x00,0x3E,0x00,0x03,0x4F,0x1F,0x84,0x00,0x18,0x00,0x00,0x30,0x00,0x00,0x3C,0x00,0x00,0x0E,
+    0x00,0x00,0x07,0x00,0x00,0x81,0x00,0x7E,0x00,0x00,0x7C,0x00,0x02,0x81,0x00,0xF8,0x00,0x00,0xF8,0x03,0x00,0x80,0x00,0x38,
+    0x00,0x0A,0x55,0x02,0x84,0x00,0xFE,0x00,0x80,0xFF,0x03,0xC0,0x83,0x07,0xC0,0x01,0x07,0xE0,0x00,0x0E,0x05,0x83,0xC0,0x01,
+    0x07,0xC0,0x83,0x07,0x80,0xFF,0x03,0x00,0xFE,0x00,0x55,0x0C,0x90,0x00,0x08,0x10,0x00,0x1C,0x38,0x00,0x0E,0x1E,0x00,0x07,
+    0x0F,0x80,0x83,0x07,0xC0,0xC1,0x03,0xE0,0xE0,0x01,0x70,0x70,0x00,0x38,0x78,0x00,0x70,0xF0,0x00,0xE0,0xE0,0x01,0xC0,0xC1,
+    0x03,0x80,0x83,0x07,0x00,0x07,0x0F,0x00,0x0E,0x1E,0x00,0x1C,0x3C,0x00,0x08,0x10,0x49,0x02,0x81,0x70,0x00,0x3C,0xE0,0x00,
+    0xFC,0x00,0x80,0xC0,0x01,0x1C,0x00,0x80,0x80,0x03,0x1C,0x00,0x81,0x00,0x07,0x1C,0x00,0x0E,0x1C,0x00,0x80,0x00,0x1C,0x1C,
+    0x00,0x80,0x00,0x38,0x1C,0x00,0x89,0x78,0x70,0x1C,0xF8,0x70,0x00,0xF8,0xE0,0x00,0xB8,0xE1,0x00,0x38,0xC3,0x01,0x38,0xC7,
+    0x01,0x38,0x8E,0x03,0x38,0x8C,0x03,0x38,0x18,0x07,0xFE,0x1F,0x0E,0x00,0x80,0x38,0x00,0x1C,0x00,0x80,0x38,0x00,0x38,0x00,
+    0x80,0x00,0x00,0x70,0x46,0x02,0x81,0xE0,0x00,0x3C,0xC0,0x01,0xFC,0x00,0x80,0x80,0x03,0x1C,0x00,0x80,0x00,0x07,0x1C,0x00,
+    0x81,0x00,0x0E,0x1C,0x00,0x1C,0x1C,0x00,0x80,0x00,0x38,0x1C,0x00,0x80,0x00,0x70,0x1C,0x00,0x84,0xF8,0xE1,0x1C,0xFE,0xE3,
+    0x00,0x0F,0xC2,0x01,0x07,0xC0,0x01,0x07,0x80,0x03,0x00,0x87,0x0E,0x00,0x07,0x3C,0x00,0x07,0x78,0x00,0x0E,0xE0,0x00,0x1C,
+    0xC0,0x01,0x1C,0x80,0x03,0x38,0xFF,0x03,0x38,0xFF,0x03,0x70,0x00,0x80,0x00,0x00,0xE0,0x46,0x02,0x97,0x07,0x80,0x7F,0x0E,
+    0xC0,0x7F,0x1C,0xE0,0x41,0x1C,0xE0,0x00,0x38,0xE0,0x00,0x70,0xC0,0x01,0x70,0x80,0x1F,0xE0,0x00,0x1F,0xC0,0xC1,0x07,0xC0,
+    0xE1,0x01,0x80,0xE3,0x00,0x00,0xE7,0x00,0x00,0xE7,0x41,0x00,0xCE,0x7F,0x3C,0x1C,0x7F,0x7C,0x1C,0x00,0x7C,0x38,0x00,0xDC,
+    0x70,0x00,0x9C,0x71,0x00,0x9C,0xE3,0x00,0x1C,0xC7,0x01,0x1C,0xC6,0x01,0x1C,0x8C,0x03,0xFF,0x0F,0x07,0x00,0x81,0x1C,0x00,
+    0x0E,0x1C,0x00,0x1C,0x00,0x81,0x1C,0x00,0x38,0x00,0x00,0x70,0x46,0x0A,0x80,0x00,0x0F,0x00,0x02,0x43,0x80,0x00,0x0F,0x00,
+    0x01,0x89,0x00,0x0E,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x7C,0x00,0x00,0xF8,0x00,0x00,0xE0,0x01,0x00,0xC0,0x03,0x00,
+    0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x1E,0x00,0x80,0x38,0x00,0x1E,0x00,0x84,0x38,0x00,0x1F,0x38,0xC0,0x0F,0xF8,0xFF,0x0F,
+    0xF8,0xFF,0x03,0xC0,0xFF,0x00,0x83,0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0x70,0x00,0x00,0x38,0x00,0x42,0x81,0x00,0x3C,0x00,
+    0x00,0x7E,0x00,0x01,0x80,0x00,0xEF,0x00,0x00,0x81,0x80,0xE7,0x01,0x80,0xC7,0x01,0x00,0x82,0xC0,0xC3,0x03,0xC0,0x83,0x03,
+    0xE0,0x81,0x07,0x00,0x81,0xE0,0x01,0x07,0xF0,0x00,0x0F,0x00,0x80,0xF8,0xFF,0x1F,0x01,0x80,0x3C,0x00,0x3C,0x00,0x81,0x3E,
+    0x00,0x7C,0x1E,0x00,0x78,0x00,0x80,0x1F,0x00,0xF0,0x47,0x83,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x38,0x00,0x00,0x70,0x00,
+    0x42,0x81,0x00,0x3C,0x00,0x00,0x7E,0x00,0x01,0x80,0x00,0xEF,0x00,0x00,0x81,0x80,0xE7,0x01,0x80,0xC7,0x01,0x00,0x82,0xC0,
+    0xC3,0x03,0xC0,0x83,0x03,0xE0,0x81,0x07,0x00,0x81,0xE0,0x01,0x07,0xF0,0x00,0x0F,0x00,0x80,0xF8,0xFF,0x1F,0x01,0x80,0x3C,
+    0x00,0x3C,0x00,0x81,0x3E,0x00,0x7C,0x1E,0x00,0x78,0x00,0x80,0x1F,0x00,0xF0,0x47,0x83,0x00,0x7E,0x00,0x00,0xFF,0x00,0x80,
+    0xE7,0x01,0xC0,0x81,0x03,0x42,0x81,0x00,0x3C,0x00,0x00,0x7E,0x00,0x01,0x80,0x00,0xEF,0x00,0x00,0x81,0x80,0xE7,0x01,0x80,
+    0xC7,0x01,0x00,0x82,0xC0,0xC3,0x03,0xC0,0x83,0x03,0xE0,0x81,0x07,0x00,0x81,0xE0,0x01,0x07,0xF0,0x00,0x0F,0x00,0x80,0xF8,
+    0xFF,0x1F,0x01,0x80,0x3C,0x00,0x3C,0x00,0x81,0x3E,0x00,0x7C,0x1E,0x00,0x78,0x00,0x80,0x1F,0x00,0xF0,0x47,0x83,0x60,0xF0,
+    0x00,0xE0,0xFC,0x01,0xC0,0x9F,0x03,0x80,0x07,0x03,0x42,0x81,0x00,0x3C,0x00,0x00,0x7E,0x00,0x01,0x80,0x00,0xEF,0x00,0x00,
+    0x81,0x80,0xE7,0x01,0x80,0xC7,0x01,0x00,0x82,0xC0,0xC3,0x03,0xC0,0x83,0x03,0xE0,0x81,0x07,0x00,0x81,0xE0,0x01,0x07,0xF0,
+    0x00,0x0F,0x00,0x80,0xF8,0xFF,0x1F,0x01,0x80,0x3C,0x00,0x3C,0x00,0x81,0x3E,0x00,0x7C,0x1E,0x00,0x78,0x00,0x80,0x1F,0x00,
+    0xF0,0x47,0x80,0xE0,0x80,0x03,0x01,0x43,0x81,0x00,0x3C,0x00,0x00,0x7E,0x00,0x01,0x80,0x00,0xEF,0x00,0x00,0x81,0x80,0xE7,
+    0x01,0x80,0xC7,0x01,0x00,0x82,0xC0,0xC3,0x03,0xC0,0x83,0x03,0xE0,0x81,0x07,0x00,0x81,0xE0,0x01,0x07,0xF0,0x00,0x0F,0x00,
+    0x80,0xF8,0xFF,0x1F,0x01,0x80,0x3C,0x00,0x3C,0x00,0x81,0x3E,0x00,0x7C,0x1E,0x00,0x78,0x00,0x80,0x1F,0x00,0xF0,0x47,0x82,
+    0x00,0x3C,0x00,0x00,0x42,0x00,0x00,0x81,0x00,0x01,0x83,0x00,0xC3,0x00,0x00,0x7E,0x00,0x00,0x3C,0x00,0x00,0x7E,0x00,0x01,
+    0x80,0x00,0xEF,0x00,0x00,0x81,0x80,0xE7,0x01,0x80,0xC7,0x01,0x00,0x82,0xC0,0xC3,0x03,0xC0,0x83,0x03,0xE0,0x81,0x07,0x00,
+    0x81,0xE0,0x01,0x07,0xF0,0x00,0x0F,0x00,0x80,0xF8,0xFF,0x1F,0x01,0x80,0x3C,0x00,0x3C,0x00,0x81,0x3E,0x00,0x7C,0x1E,0x00,
+    0x78,0x00,0x80,0x0F,0x00,0xF0,0x47,0x06,0x81,0xFC,0x1F,0x00,0xFC,0x3F,0x00,0x00,0x80,0x00,0x7F,0x00,0x00,0x81,0x00,0xFF,
+    0x00,0x00,0xEF,0x00,0x00,0x80,0x00,0xCF,0x01,0x00,0x85,0x00,0xCF,0x03,0xF8,0x8F,0x03,0xF8,0x8F,0x07,0xF8,0x0F,0x07,0x00,
+    0x0F,0x07,0x00,0x0F,0x0E,0x00,0x80,0x00,0xFF,0x1F,0x00,0x81,0x00,0xFF,0x3F,0x00,0x0F,0x38,0x00,0x80,0xFE,0x0F,0x70,0x00,
+    0x80,0xFE,0x0F,0xF0,0x47,0x06,0x87,0xF0,0x1F,0x00,0xFE,0x7F,0x00,0xFE,0xFF,0x01,0x1E,0xF0,0x03,0x02,0xC0,0x07,0x00,0x80,
+    0x0F,0x00,0x00,0x1F,0x00,0x00,0x1E,0x00,0x80,0x00,0x00,0x3C,0x05,0x80,0x00,0x00,0x1E,0x00,0x8B,0x00,0x00,0x1F,0x00,0x80,
+    0x0F,0x00,0xC0,0x07,0x0E,0xF8,0x03,0xFE,0xFF,0x01,0xFE,0x7F,0x00,0xF0,0x1F,0x00,0x00,0x06,0x00,0x00,0x0C,0x00,0x00,0x0F,
+    0x00,0x80,0x03,0x00,0xC0,0x01,0x00,0x00,0x81,0x80,0x1F,0x00,0x00,0x1F,0x00,0x83,0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0x38,
+    0x00,0x00,0x1C,0x00,0x42,0x80,0xF8,0xFF,0x0F,0x01,0x80,0x00,0x00,0x0F,0x06,0x80,0xE0,0xFF,0x0F,0x01,0x80,0x00,0x00,0x0F,
+    0x06,0x80,0xFC,0xFF,0x0F,0x01,0x47,0x83,0xC0,0x03,0x00,0x80,0x07,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x42,0x80,0xF8,0xFF,
+    0x0F,0x01,0x80,0x00,0x00,0x0F,0x06,0x80,0xE0,0xFF,0x0F,0x01,0x80,0x00,0x00,0x0F,0x06,0x80,0xFC,0xFF,0x0F,0x01,0x47,0x83,
+    0x00,0x3F,0x00,0x80,0x7F,0x00,0xC0,0xF3,0x00,0xE0,0xC0,0x01,0x42,0x80,0xF8,0xFF,0x0F,0x01,0x80,0x00,0x00,0x0F,0x06,0x80,
+    0xE0,0xFF,0x0F,0x01,0x80,0x00,0x00,0x0F,0x06,0x80,0xFC,0xFF,0x0F,0x01,0x47,0x80,0x70,0xC0,0x01,0x01,0x43,0x80,0xF8,0xFF,
+    0x0F,0x01,0x80,0x00,0x00,0x0F,0x06,0x80,0xE0,0xFF,0x0F,0x01,0x80,0x00,0x00,0x0F,0x06,0x80,0xFC,0xFF,0x0F,0x01,0x47,0x83,
+    0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0x70,0x00,0x00,0x38,0x00,0x42,0x80,0xF8,0xFF,0x1F,0x01,0x80,0x00,0x3C,0x00,0x11,0x80,
+    0xF8,0xFF,0x1F,0x01,0x47,0x83,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x42,0x80,0xF8,0xFF,0x1F,0x01,
+    0x80,0x00,0x3C,0x00,0x11,0x80,0xF8,0xFF,0x1F,0x01,0x47,0x83,0x00,0x7E,0x00,0x00,0xFF,0x00,0x80,0xE7,0x01,0xC0,0x81,0x03,
+    0x42,0x80,0xF8,0xFF,0x1F,0x01,0x80,0x00,0x3C,0x00,0x11,0x80,0xF8,0xFF,0x1F,0x01,0x47,0x80,0xE0,0x80,0x03,0x01,0x43,0x80,
+    0xF8,0xFF,0x1F,0x01,0x80,0x00,0x3C,0x00,0x11,0x80,0xF8,0xFF,0x1F,0x01,0x47,0x06,0x86,0x00,0xFE,0x1F,0xC0,0xFF,0x1F,0xE0,
+    0xFF,0x1F,0xF0,0x03,0x1E,0xF8,0x00,0x1E,0x7C,0x00,0x1E,0x3C,0x00,0x1E,0x00,0x80,0x1E,0x00,0x1E,0x00,0x80,0x1E,0xF0,0xFF,
+    0x01,0x80,0x1E,0x00,0x1E,0x01,0x81,0x1C,0x00,0x1E,0x3C,0x00,0x1E,0x00,0x85,0x78,0x00,0x1E,0xF8,0x00,0x1E,0xF0,0x07,0x1E,
+    0xE0,0xFF,0x1F,0x80,0xFF,0x1F,0x00,0xFE,0x1F,0x47,0x83,0x60,0xF0,0x00,0xE0,0xFC,0x01,0xC0,0x9F,0x03,0x80,0x07,0x03,0x42,
+    0x80,0x38,0x00,0x1E,0x00,0x81,0x38,0x00,0x1F,0x38,0x80,0x1F,0x00,0x84,0x38,0xC0,0x1F,0x38,0xE0,0x1F,0x38,0xE0,0x1D,0x38,
+    0xF0,0x1D,0x38,0xF8,0x1C,0x00,0x86,0x38,0x7C,0x1C,0x38,0x3C,0x1C,0x38,0x3E,0x1C,0x38,0x1F,0x1C,0x38,0x0F,0x1C,0xB8,0x0F,
+    0x1C,0xF8,0x07,0x1C,0x00,0x81,0xF8,0x03,0x1C,0xF8,0x01,0x1C,0x00,0x81,0xF8,0x00,0x1C,0x78,0x00,0x1C,0x00,0x47,0x83,0x00,
+    0xC0,0x03,0x00,0xE0,0x01,0x00,0x70,0x00,0x00,0x38,0x00,0x42,0x86,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,
+    0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x3C,0x00,0x3C,0x00,0x80,0x1E,0x00,0x78,0x07,0x80,0x3C,0x00,0x3C,0x00,0x85,0x78,0x00,
+    0x1E,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0xFF,0x00,0x47,0x83,0x80,0x07,0x00,0x00,0x0F,0x00,
+    0x00,0x1C,0x00,0x00,0x38,0x00,0x42,0x86,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,
+    0x00,0x1E,0x3C,0x00,0x3C,0x00,0x80,0x1E,0x00,0x78,0x07,0x80,0x3C,0x00,0x3C,0x00,0x85,0x78,0x00,0x1E,0xF8,0x00,0x1F,0xF0,
+    0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0xFF,0x00,0x47,0x83,0x00,0x7E,0x00,0x00,0xFF,0x00,0x80,0xE7,0x01,0xC0,0x81,
+    0x03,0x42,0x86,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x3C,0x00,0x3C,
+    0x00,0x80,0x1E,0x00,0x78,0x07,0x80,0x3C,0x00,0x3C,0x00,0x85,0x78,0x00,0x1E,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,
+    0xC0,0xFF,0x03,0x00,0xFF,0x00,0x47,0x83,0x60,0xF0,0x00,0xE0,0xFC,0x01,0xC0,0x9F,0x03,0x80,0x07,0x03,0x42,0x86,0x00,0xFF,
+    0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x3C,0x00,0x3C,0x00,0x80,0x1E,0x00,0x78,
+    0x07,0x80,0x3C,0x00,0x3C,0x00,0x85,0x78,0x00,0x1E,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0xFF,
+    0x00,0x47,0x80,0xE0,0x80,0x03,0x01,0x43,0x86,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,
+    0x78,0x00,0x1E,0x3C,0x00,0x3C,0x00,0x80,0x1E,0x00,0x78,0x07,0x80,0x3C,0x00,0x3C,0x00,0x85,0x78,0x00,0x1E,0xF8,0x00,0x1F,
+    0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0xFF,0x00,0x47,0x0A,0x94,0x10,0x00,0x10,0x38,0x00,0x38,0x7C,0x00,0x7C,
+    0xF8,0x00,0x3E,0xF0,0x01,0x1F,0xE0,0x83,0x0F,0xC0,0xC7,0x07,0x80,0xEF,0x03,0x00,0xFF,0x01,0x00,0xFE,0x00,0x00,0x7C,0x00,
+    0x00,0xFE,0x00,0x00,0xFF,0x01,0x80,0xEF,0x03,0xC0,0xC7,0x07,0xE0,0x83,0x0F,0xF0,0x01,0x1F,0xF8,0x00,0x3E,0x7C,0x00,0x7C,
+    0x38,0x00,0x38,0x10,0x00,0x10,0x47,0x06,0x98,0x0E,0xFF,0x00,0xDC,0xFF,0x03,0xF8,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,
+    0xF8,0x00,0x1E,0xFC,0x01,0x3C,0xFC,0x03,0x3C,0x9E,0x03,0x78,0x1E,0x07,0x78,0x1E,0x0E,0x78,0x1E,0x1C,0x78,0x1E,0x3C,0x78,
+    0x1E,0x38,0x78,0x1E,0x70,0x78,0x1E,0xE0,0x78,0x1E,0xC0,0x79,0x3C,0xC0,0x3F,0x3C,0x80,0x3F,0x78,0x00,0x1F,0xF8,0x00,0x1F,
+    0xF0,0x81,0x0F,0xE0,0xFF,0x1F,0xC0,0xFF,0x3B,0x00,0xFF,0x70,0x47,0x83,0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0x38,0x00,0x00,
+    0x1C,0x00,0x42,0x80,0x3C,0x00,0x1E,0x11,0x85,0x78,0x00,0x0F,0xF8,0x00,0x0F,0xF0,0xC1,0x07,0xF0,0xFF,0x07,0xC0,0xFF,0x01,
+    0x00,0x7F,0x00,0x47,0x83,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x42,0x80,0x3C,0x00,0x1E,0x11,0x85,
+    0x78,0x00,0x0F,0xF8,0x00,0x0F,0xF0,0xC1,0x07,0xF0,0xFF,0x07,0xC0,0xFF,0x01,0x00,0x7F,0x00,0x47,0x83,0x00,0x7E,0x00,0x00,
+    0xFF,0x00,0x80,0xE7,0x01,0xC0,0x81,0x03,0x42,0x80,0x3C,0x00,0x1E,0x11,0x85,0x78,0x00,0x0F,0xF8,0x00,0x0F,0xF0,0xC1,0x07,
+    0xF0,0xFF,0x07,0xC0,0xFF,0x01,0x00,0x7F,0x00,0x47,0x80,0x70,0xC0,0x01,0x01,0x43,0x80,0x3C,0x00,0x1E,0x11,0x85,0x78,0x00,
+    0x0F,0xF8,0x00,0x0F,0xF0,0xC1,0x07,0xF0,0xFF,0x07,0xC0,0xFF,0x01,0x00,0x7F,0x00,0x47,0x83,0x80,0x07,0x00,0x00,0x0F,0x00,
+    0x00,0x1C,0x00,0x00,0x38,0x00,0x42,0x8E,0x0F,0x00,0x7C,0x1E,0x00,0x3C,0x1C,0x00,0x1E,0x3C,0x00,0x1F,0x38,0x00,0x0F,0x78,
+    0x80,0x07,0xF0,0xC0,0x07,0xE0,0xE0,0x03,0xE0,0xE1,0x01,0xC0,0xF1,0x01,0xC0,0xFB,0x00,0x80,0x7F,0x00,0x00,0x7F,0x00,0x00,
+    0x3F,0x00,0x00,0x1E,0x00,0x09,0x47,0x06,0x80,0x00,0x00,0x0F,0x03,0x85,0xC0,0xFF,0x0F,0xF0,0xFF,0x0F,0xF8,0xFF,0x0F,0xF8,
+    0x00,0x0F,0x7C,0x00,0x0F,0x3C,0x00,0x0F,0x02,0x86,0x7C,0x00,0x0F,0xF8,0x00,0x0F,0xF0,0x03,0x0F,0xE0,0xFF,0x0F,0xC0,0xFF,
+    0x0F,0x00,0xFE,0x0F,0x00,0x00,0x0F,0x03,0x47,0x00,0x85,0x00,0xFC,0x01,0x00,0xFF,0x07,0x80,0xFF,0x0F,0xC0,0x87,0x0F,0xC0,
+    0x03,0x1F,0xC0,0x03,0x1E,0x00,0x82,0x80,0x03,0x1E,0x80,0x07,0x1E,0x00,0x0F,0x1E,0x00,0x81,0x00,0x1E,0x1E,0x00,0x3C,0x1E,
+    0x01,0x88,0x00,0x3E,0x1E,0x00,0x1F,0x1E,0x80,0x1F,0x1E,0xE0,0x0F,0x1E,0xF0,0x07,0x1E,0xF0,0x01,0x1E,0xF8,0x00,0x1E,0x7C,
+    0x00,0x1E,0x3C,0x00,0x1E,0x02,0x83,0x78,0x70,0x1E,0xF8,0x7F,0x1E,0xF0,0x7F,0x1E,0xC0,0x1F,0x1E,0x47,0x00,0x85,0x00,0xE0,
+    0x01,0x00,0xF0,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x43,0x85,0x80,0xFF,0x00,0xC0,0xFF,0x07,
+    0xE0,0xFF,0x07,0xF0,0x01,0x07,0xF0,0x00,0x04,0xF0,0x00,0x00,0x01,0x85,0xF0,0x7F,0x00,0xF0,0xFF,0x01,0xF0,0xFF,0x07,0xF0,
+    0xC0,0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x1E,0x01,0x84,0xF0,0x01,0x1E,0xF8,0x87,0x1F,0x7F,0xFF,0x0F,0x7F,0xFE,0x07,0x1E,0xF8,
+    0x01,0x47,0x00,0x85,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x43,0x85,
+    0x80,0xFF,0x00,0xC0,0xFF,0x07,0xE0,0xFF,0x07,0xF0,0x01,0x07,0xF0,0x00,0x04,0xF0,0x00,0x00,0x01,0x85,0xF0,0x7F,0x00,0xF0,
+    0xFF,0x01,0xF0,0xFF,0x07,0xF0,0xC0,0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x1E,0x01,0x84,0xF0,0x01,0x1E,0xF8,0x87,0x1F,0x7F,0xFF,
+    0x0F,0x7F,0xFE,0x07,0x1E,0xF8,0x01,0x47,0x00,0x80,0x00,0x7E,0x00,0x00,0x83,0x00,0xFF,0x00,0x80,0xE7,0x01,0xC0,0xC3,0x03,
+    0xE0,0x00,0x07,0x43,0x85,0x80,0xFF,0x00,0xC0,0xFF,0x07,0xE0,0xFF,0x07,0xF0,0x01,0x07,0xF0,0x00,0x04,0xF0,0x00,0x00,0x01,
+    0x85,0xF0,0x7F,0x00,0xF0,0xFF,0x01,0xF0,0xFF,0x07,0xF0,0xC0,0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x1E,0x01,0x84,0xF0,0x01,0x1E,
+    0xF8,0x87,0x1F,0x7F,0xFF,0x0F,0x7F,0xFE,0x07,0x1E,0xF8,0x01,0x47,0x01,0x84,0x60,0xF0,0x00,0x60,0xFC,0x01,0xE0,0xFF,0x03,
+    0xC0,0x1F,0x03,0x80,0x07,0x03,0x43,0x85,0x80,0xFF,0x00,0xC0,0xFF,0x07,0xE0,0xFF,0x07,0xF0,0x01,0x07,0xF0,0x00,0x04,0xF0,
+    0x00,0x00,0x01,0x85,0xF0,0x7F,0x00,0xF0,0xFF,0x01,0xF0,0xFF,0x07,0xF0,0xC0,0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x1E,0x01,0x84,
+    0xF0,0x01,0x1E,0xF8,0x87,0x1F,0x7F,0xFF,0x0F,0x7F,0xFE,0x07,0x1E,0xF8,0x01,0x47,0x03,0x80,0xE0,0xE0,0x00,0x01,0x43,0x85,
+    0x80,0xFF,0x00,0xC0,0xFF,0x07,0xE0,0xFF,0x07,0xF0,0x01,0x07,0xF0,0x00,0x04,0xF0,0x00,0x00,0x01,0x85,0xF0,0x7F,0x00,0xF0,
+    0xFF,0x01,0xF0,0xFF,0x07,0xF0,0xC0,0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x1E,0x01,0x84,0xF0,0x01,0x1E,0xF8,0x87,0x1F,0x7F,0xFF,
+    0x0F,0x7F,0xFE,0x07,0x1E,0xF8,0x01,0x47,0x82,0x00,0x38,0x00,0x00,0x44,0x00,0x00,0x82,0x00,0x01,0x81,0x00,0x44,0x00,0x00,
+    0x38,0x00,0x43,0x85,0x80,0xFF,0x00,0xC0,0xFF,0x07,0xE0,0xFF,0x07,0xF0,0x01,0x07,0xF0,0x00,0x04,0xF0,0x00,0x00,0x01,0x85,
+    0xF0,0x7F,0x00,0xF0,0xFF,0x01,0xF0,0xFF,0x07,0xF0,0xC0,0x0F,0xF0,0x00,0x0F,0xF0,0x00,0x1E,0x01,0x84,0xF0,0x01,0x1E,0xF8,
+    0x87,0x1F,0x7F,0xFF,0x0F,0x7F,0xFE,0x07,0x1E,0xF8,0x01,0x47,0x0A,0x85,0xF0,0xE1,0x07,0xFC,0xF3,0x1F,0xFC,0xFF,0x1F,0x1E,
+    0x7F,0x10,0x0E,0x3E,0x00,0x0F,0x3C,0x00,0x01,0x85,0xFF,0xFF,0x03,0xFF,0xFF,0x0F,0xFF,0xFF,0x1F,0x00,0x3C,0x3E,0x00,0x3C,
+    0x7C,0x00,0x3C,0x78,0x00,0x80,0x00,0x3E,0x78,0x00,0x83,0x03,0x7F,0x7C,0xFF,0xEF,0x3F,0xFF,0xC7,0x1F,0xF8,0x83,0x0F,0x47,
+    0x0A,0x87,0xE0,0x3F,0x00,0xF8,0xFF,0x00,0xF8,0xFF,0x03,0x38,0xE0,0x07,0x00,0xC0,0x07,0x00,0x80,0x0F,0x00,0x00,0x0F,0x00,
+    0x00,0x1E,0x05,0x8B,0x00,0x00,0x0F,0x00,0x80,0x0F,0x00,0xC0,0x0F,0x38,0xF0,0x07,0xF8,0xFF,0x03,0xF8,0xFF,0x00,0xE0,0x3F,
+    0x00,0x00,0x18,0x00,0x00,0x30,0x00,0x00,0x3C,0x00,0x00,0x0E,0x00,0x00,0x07,0x00,0x00,0x81,0x00,0x7E,0x00,0x00,0x7C,0x00,
+    0x00,0x85,0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x43,0x87,0x00,0x3F,
+    0x00,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xF0,0xC1,0x07,0xF0,0x80,0x07,0x70,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x1E,0x00,0x80,
+    0xF8,0xFF,0x1F,0x01,0x80,0x00,0x00,0x1E,0x00,0x80,0x00,0x00,0x0F,0x00,0x84,0x00,0x80,0x0F,0x38,0xE0,0x07,0xF8,0xFF,0x03,
+    0xF8,0xFF,0x01,0xC0,0x3F,0x00,0x47,0x00,0x85,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,
+    0x00,0x70,0x00,0x43,0x87,0x00,0x3F,0x00,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xF0,0xC1,0x07,0xF0,0x80,0x07,0x70,0x00,0x0F,0x78,
+    0x00,0x0F,0x78,0x00,0x1E,0x00,0x80,0xF8,0xFF,0x1F,0x01,0x80,0x00,0x00,0x1E,0x00,0x80,0x00,0x00,0x0F,0x00,0x84,0x00,0x80,
+    0x0F,0x38,0xE0,0x07,0xF8,0xFF,0x03,0xF8,0xFF,0x01,0xC0,0x3F,0x00,0x47,0x00,0x80,0x00,0x3F,0x00,0x00,0x83,0x80,0x7F,0x00,
+    0xC0,0xF3,0x00,0xE0,0xE1,0x01,0x70,0x80,0x03,0x43,0x87,0x00,0x3F,0x00,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xF0,0xC1,0x07,0xF0,
+    0x80,0x07,0x70,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x1E,0x00,0x80,0xF8,0xFF,0x1F,0x01,0x80,0x00,0x00,0x1E,0x00,0x80,0x00,
+    0x00,0x0F,0x00,0x84,0x00,0x80,0x0F,0x38,0xE0,0x07,0xF8,0xFF,0x03,0xF8,0xFF,0x01,0xC0,0x3F,0x00,0x47,0x03,0x80,0x70,0x70,
+    0x00,0x01,0x43,0x87,0x00,0x3F,0x00,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xF0,0xC1,0x07,0xF0,0x80,0x07,0x70,0x00,0x0F,0x78,0x00,
+    0x0F,0x78,0x00,0x1E,0x00,0x80,0xF8,0xFF,0x1F,0x01,0x80,0x00,0x00,0x1E,0x00,0x80,0x00,0x00,0x0F,0x00,0x84,0x00,0x80,0x0F,
+    0x38,0xE0,0x07,0xF8,0xFF,0x03,0xF8,0xFF,0x01,0xC0,0x3F,0x00,0x47,0x00,0x85,0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0x70,0x00,
+    0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x43,0x80,0x00,0xFE,0x1F,0x01,0x80,0x00,0x1E,0x00,0x10,0x47,0x00,0x85,0x80,
+    0x07,0x00,0x00,0x0F,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x43,0x80,0x00,0xFE,0x1F,0x01,0x80,
+    0x00,0x1E,0x00,0x10,0x47,0x00,0x80,0x00,0x3F,0x00,0x00,0x83,0x80,0x7F,0x00,0xC0,0xF3,0x00,0xE0,0xE1,0x01,0x70,0x80,0x03,
+    0x43,0x80,0x00,0xFE,0x1F,0x01,0x80,0x00,0x1E,0x00,0x10,0x47,0x03,0x80,0xE0,0xE0,0x00,0x01,0x43,0x80,0x00,0xFE,0x1F,0x01,
+    0x80,0x00,0x1E,0x00,0x10,0x47,0x00,0x8F,0x00,0x02,0x3E,0x00,0xCF,0x3F,0x00,0xFE,0x3F,0x00,0xFC,0x07,0x00,0xFC,0x00,0x00,
+    0xFE,0x01,0x80,0xDF,0x07,0x80,0x0F,0x07,0xC0,0x07,0x06,0xE0,0x03,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x03,0xF8,0xFF,0x07,0xF8,
+    0xC1,0x0F,0xF8,0x00,0x0F,0x7C,0x00,0x1E,0x00,0x80,0x3C,0x00,0x3C,0x05,0x80,0x78,0x00,0x1E,0x00,0x84,0xF0,0x00,0x0F,0xF0,
+    0xC3,0x0F,0xE0,0xFF,0x07,0x80,0xFF,0x03,0x00,0x7E,0x00,0x47,0x01,0x84,0x60,0xF0,0x00,0x60,0xFC,0x01,0xE0,0xFF,0x03,0xC0,
+    0x1F,0x03,0x80,0x07,0x03,0x43,0x87,0xE0,0x07,0x0F,0xF0,0x1F,0x0F,0xF8,0x3F,0x0F,0x78,0x70,0x0F,0x7C,0xE0,0x0F,0x3C,0xC0,
+    0x0F,0x3C,0x80,0x0F,0x3C,0x00,0x0F,0x0C,0x47,0x00,0x85,0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0xE0,0x00,0x00,0x70,0x00,0x00,
+    0x38,0x00,0x00,0x1C,0x00,0x43,0x85,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,
+    0x1E,0x00,0x80,0x3C,0x00,0x3C,0x05,0x80,0x78,0x00,0x1E,0x00,0x84,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,
+    0x03,0x00,0xFF,0x00,0x47,0x00,0x85,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x70,
+    0x00,0x43,0x85,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x00,0x80,0x3C,
+    0x00,0x3C,0x05,0x80,0x78,0x00,0x1E,0x00,0x84,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0xFF,0x00,
+    0x47,0x00,0x80,0x00,0x7E,0x00,0x00,0x83,0x00,0xFF,0x00,0x80,0xE7,0x01,0xC0,0xC3,0x03,0xE0,0x00,0x07,0x43,0x85,0x00,0xFF,
+    0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x00,0x80,0x3C,0x00,0x3C,0x05,0x80,0x78,
+    0x00,0x1E,0x00,0x84,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0xFF,0x00,0x47,0x01,0x84,0x60,0xF0,
+    0x00,0x60,0xFC,0x01,0xE0,0xFF,0x03,0xC0,0x1F,0x03,0x80,0x07,0x03,0x43,0x85,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,
+    0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x00,0x80,0x3C,0x00,0x3C,0x05,0x80,0x78,0x00,0x1E,0x00,0x84,0xF8,0x00,0x1F,
+    0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0xFF,0x00,0x47,0x03,0x80,0xC0,0xC1,0x01,0x01,0x43,0x85,0x00,0xFF,0x00,
+    0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x00,0x80,0x3C,0x00,0x3C,0x05,0x80,0x78,0x00,
+    0x1E,0x00,0x84,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0xFF,0x00,0x47,0x0A,0x80,0x00,0x3C,0x00,
+    0x02,0x44,0x80,0xFE,0xFF,0x3F,0x01,0x44,0x80,0x00,0x3C,0x00,0x02,0x47,0x0A,0x94,0x1C,0xFE,0x00,0xF8,0xFF,0x03,0xF0,0xFF,
+    0x07,0xF0,0x83,0x0F,0xF8,0x00,0x1F,0xF8,0x01,0x1E,0xF8,0x03,0x1E,0x3C,0x07,0x3C,0x3C,0x0E,0x3C,0x3C,0x1C,0x3C,0x3C,0x3C,
+    0x3C,0x3C,0x38,0x3C,0x3C,0x70,0x3C,0x3C,0xE0,0x3C,0x78,0xC0,0x1F,0x78,0x80,0x1F,0xF8,0x00,0x1F,0xF0,0xC1,0x0F,0xE0,0xFF,
+    0x0F,0xC0,0xFF,0x1F,0x00,0xFF,0x38,0x47,0x00,0x85,0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0xE0,0x00,0x00,0x70,0x00,0x00,0x38,
+    0x00,0x00,0x1C,0x00,0x43,0x80,0xF0,0x00,0x1E,0x0C,0x86,0xF0,0x01,0x1E,0xF0,0x03,0x1E,0xF0,0x07,0x1E,0xF0,0x0E,0x1F,0xF0,
+    0xFE,0x0F,0xF0,0xF8,0x07,0xF0,0xF0,0x03,0x47,0x00,0x85,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,
+    0x38,0x00,0x00,0x70,0x00,0x43,0x80,0xF0,0x00,0x1E,0x0C,0x86,0xF0,0x01,0x1E,0xF0,0x03,0x1E,0xF0,0x07,0x1E,0xF0,0x0E,0x1F,
+    0xF0,0xFE,0x0F,0xF0,0xF8,0x07,0xF0,0xF0,0x03,0x47,0x00,0x80,0x00,0x7E,0x00,0x00,0x83,0x00,0xFF,0x00,0x80,0xE7,0x01,0xC0,
+    0xC3,0x03,0xE0,0x00,0x07,0x43,0x80,0xF0,0x00,0x1E,0x0C,0x86,0xF0,0x01,0x1E,0xF0,0x03,0x1E,0xF0,0x07,0x1E,0xF0,0x0E,0x1F,
+    0xF0,0xFE,0x0F,0xF0,0xF8,0x07,0xF0,0xF0,0x03,0x47,0x03,0x80,0xC0,0xC1,0x01,0x01,0x43,0x80,0xF0,0x00,0x1E,0x0C,0x86,0xF0,
+    0x01,0x1E,0xF0,0x03,0x1E,0xF0,0x07,0x1E,0xF0,0x0E,0x1F,0xF0,0xFE,0x0F,0xF0,0xF8,0x07,0xF0,0xF0,0x03,0x47,0x00,0x85,0x80,
+    0x07,0x00,0x00,0x0F,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x43,0x8C,0x1E,0x00,0x7C,0x1C,0x00,
+    0x3C,0x3C,0x00,0x3E,0x38,0x00,0x1E,0x78,0x00,0x1E,0x70,0x00,0x1F,0xF0,0x00,0x0F,0xF0,0x80,0x0F,0xE0,0x81,0x07,0xE0,0xC1,
+    0x07,0xC0,0xC3,0x03,0xC0,0xE3,0x03,0x80,0xE7,0x01,0x00,0x83,0x00,0xF7,0x00,0x00,0xFF,0x00,0x00,0xFE,0x00,0x00,0x7E,0x00,
+    0x00,0x80,0x00,0x3C,0x00,0x00,0x87,0x00,0x38,0x00,0x00,0x78,0x00,0x00,0x70,0x00,0x00,0xF0,0x00,0x00,0xE0,0x01,0x00,0xC0,
+    0x3F,0x00,0x80,0x3F,0x00,0x00,0x3F,0x00,0x80,0x00,0x00,0x0F,0x08,0x86,0x80,0x0F,0x0F,0xE0,0x3F,0x0F,0xF0,0x7F,0x0F,0xF8,
+    0x70,0x0F,0x78,0xC0,0x0F,0x78,0x80,0x0F,0x3C,0x00,0x0F,0x06,0x80,0x78,0x00,0x0F,0x00,0x85,0xF8,0x80,0x0F,0xF0,0xE1,0x0F,
+    0xE0,0xFF,0x0F,0xC0,0x7F,0x0F,0x00,0x1F,0x0F,0x00,0x00,0x0F,0x06,0x03,0x80,0xE0,0xE0,0x00,0x01,0x43,0x8C,0x1E,0x00,0x7C,
+    0x1C,0x00,0x3C,0x3C,0x00,0x3E,0x38,0x00,0x1E,0x78,0x00,0x1E,0x70,0x00,0x1F,0xF0,0x00,0x0F,0xF0,0x80,0x0F,0xE0,0x81,0x07,
+    0xE0,0xC1,0x07,0xC0,0xC3,0x03,0xC0,0xE3,0x03,0x80,0xE7,0x01,0x00,0x83,0x00,0xF7,0x00,0x00,0xFF,0x00,0x00,0xFE,0x00,0x00,
+    0x7E,0x00,0x00,0x80,0x00,0x3C,0x00,0x00,0x87,0x00,0x38,0x00,0x00,0x78,0x00,0x00,0x70,0x00,0x00,0xF0,0x00,0x00,0xE0,0x01,
+    0x00,0xC0,0x3F,0x00,0x80,0x3F,0x00,0x00,0x3F,
+};
+
+static const FONT_PACKED font_24x40 = { 24, 40, 6, font_ranges_24x40, font_offsets_24x40, font_data_24x40 };
+
+static const FONT_RANGE font_ranges_32x53[6] =
+{
+    { 0x21, 0x81,   0 },
+    { 0x8A, 0x8E,  97 },
+    { 0x91, 0x91, 102 },
+    { 0x94, 0x95, 103 },
+    { 0x97, 0x98, 105 },
+    { 0xA1, 0xFF, 107 },
+};
+
+static const uint16_t font_offsets_32x53[203] =
+{
+        0,    25,    39,   135,   277,   434,   587,   601,   738,   875,   950,   970,  1007,  1015,  1023,  1172,
+     1277,  1323,  1445,  1570,  1676,  1767,  1906,  2024,  2165,  2304,  2319,  2365,  2476,  2491,  2602,  2705,
+     2858,  2973,  3088,  3197,  3292,  3324,  3350,  3465,  3485,  3505,  3548,  3683,  3697,  3795,  3909,  3998,
+     4072,  4193,  4312,  4429,  4443,  4486,  4611,  4712,  4847,  4927,  5041,  5061,  5210,  5230,  5343,  5351,
+     5377,  5476,  5563,  5656,  5745,  5844,  5895,  6015,  6069,  6090,  6143,  6264,  6278,  6322,  6370,  6455,
+     6541,  6627,  6675,  6782,  6827,  6876,  6981,  7086,  7201,  7348,  7442,  7551,  7559,  7668,  7711,  7731,
+     7877,  7912,  7925,  7938,  7951,  7964,  7982,  7990,  8008,  8026,  8039,  8045,  8070,  8162,  8236,  8329,
+     8431,  8446,  8619,  8626,  8765,  8840,  8939,  8953,  8961,  9052,  9059,  9100,  9127,  9193,  9268,  9294,
+     9345,  9403,  9411,  9455,  9473,  9534,  9633,  9774,  9917, 10076, 10178, 10318, 10458, 10598, 10738, 10859,
+    11007, 11120, 11266, 11323, 11380, 11437, 11475, 11520, 11565, 11610, 11636, 11743, 11882, 11996, 12110, 12224,
+    12338, 12433, 12546, 12681, 12749, 12817, 12885, 12934, 13039, 13119, 13273, 13405, 13537, 13669, 13794, 13900,
+    14030, 14131, 14261, 14393, 14525, 14657, 14763, 14810, 14857, 14904, 14925, 15066, 15140, 15258, 15376, 15494,
+    15605, 15697, 15719, 15834, 15916, 15998, 16080, 16136, 16316, 16408, 16562,
+};
+
+static const uint8_t font_data_32x53[16562] =
+{
+    0x03,0x80,0x00,0xC0,0x07,0x00,0x15,0x81,0x00,0x80,0x07,0x00,0x00,0x80,0x03,0x00,0x01,0x44,0x80,0x00,0xE0,0x0F,0x00,0x04,
+    0x4A,0x00,0x80,0x80,0x1F,0xF0,0x03,0x03,0x80,0x00,0x0F,0xE0,0x01,0x07,0x65,0x03,0x80,0xF0,0xC0,0x03,0x00,0x00,0x80,0xE0,
+    0x81,0x07,0x00,0x02,0x80,0xC0,0x03,0x0F,0x00,0x01,0x80,0x80,0x07,0x1E,0x00,0x00,0x81,0xFE,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,
+    0x0F,0x00,0x81,0xFC,0xFF,0xFF,0x0F,0x00,0x0F,0x3C,0x00,0x00,0x80,0x00,0x1E,0x78,0x00,0x01,0x80,0x00,0x3C,0xF0,0x00,0x00,
+    0x82,0xF8,0xFF,0xFF,0x3F,0xF8,0xFF,0xFF,0x7F,0xF0,0xFF,0xFF,0x7F,0x00,0x80,0x00,0x78,0xE0,0x01,0x00,0x80,0x00,0xF0,0xC0,
+    0x03,0x02,0x80,0x00,0xE0,0x81,0x07,0x02,0x80,0x00,0xC0,0x03,0x0F,0x00,0x4A,0x00,0x80,0x00,0xC0,0x01,0x00,0x01,0x87,0x00,
+    0xFC,0x0F,0x00,0x80,0xFF,0x3F,0x00,0xC0,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0x00,0xC0,0xC3,0xF9,0x01,0x40,0xC0,0xF1,0x01,0x00,
+    0xC0,0xF1,0x03,0x00,0xC0,0xE1,0x03,0x02,0x8F,0x00,0xC0,0xF1,0x03,0x00,0xC0,0xF1,0x01,0x00,0xC0,0xF9,0x01,0x00,0xC0,0xFD,
+    0x00,0x00,0xC0,0x7F,0x00,0x00,0xC0,0x3F,0x00,0x00,0xE0,0x1F,0x00,0x00,0xF0,0x0F,0x00,0x00,0xFC,0x07,0x00,0x00,0xFE,0x01,
+    0x00,0x00,0xFF,0x01,0x00,0x80,0xFF,0x01,0x00,0xC0,0xDF,0x01,0x00,0xC0,0xCF,0x01,0x00,0xE0,0xC7,0x01,0x00,0xE0,0xC3,0x01,
+    0x00,0x03,0x87,0xC0,0xC7,0x01,0x00,0xC0,0xC7,0x01,0x07,0x80,0xDF,0xE1,0x07,0x80,0xFF,0xFF,0x07,0x00,0xFF,0xFF,0x07,0x00,
+    0xFC,0xFF,0x01,0x00,0xF0,0x3F,0x00,0x00,0xC0,0x01,0x00,0x01,0x47,0x02,0x89,0x0F,0x00,0x00,0x00,0x1E,0x00,0xE0,0x07,0x3C,
+    0x00,0xF8,0x1F,0x3C,0x00,0xFC,0x3F,0x78,0x00,0x3E,0x7C,0xF0,0x00,0x1E,0x78,0xE0,0x01,0x1E,0x78,0xE0,0x01,0x0F,0xF0,0xC0,
+    0x03,0x0F,0xF0,0x80,0x07,0x0F,0xF0,0x00,0x88,0x00,0x0F,0x0F,0xF0,0x00,0x1E,0x0F,0xF0,0x00,0x1E,0x1E,0x78,0x00,0x3C,0x1E,
+    0x78,0x00,0x78,0x3C,0x3C,0x00,0xF0,0xFC,0x3F,0x00,0xF0,0xF8,0x1F,0x00,0xE0,0xE1,0x07,0x00,0xC0,0x03,0x00,0x00,0x88,0xE0,
+    0x87,0x07,0x00,0xF8,0x1F,0x0F,0x00,0xFC,0x3F,0x0F,0x00,0x3C,0x3C,0x1E,0x00,0x1E,0x78,0x3C,0x00,0x1E,0x78,0x78,0x00,0x0F,
+    0xF0,0x78,0x00,0x0F,0xF0,0xF0,0x00,0x0F,0xF0,0xE0,0x01,0x00,0x88,0x0F,0xF0,0xC0,0x03,0x0F,0xF0,0x80,0x07,0x1E,0x78,0x80,
+    0x07,0x1E,0x78,0x00,0x0F,0x3C,0x3C,0x00,0x1E,0xFC,0x3F,0x00,0x3C,0xF8,0x1F,0x00,0x3C,0xE0,0x07,0x00,0x78,0x00,0x00,0x00,
+    0xF0,0x49,0x02,0x86,0x00,0xF0,0x07,0x00,0x00,0xFC,0x1F,0x00,0x00,0xFE,0x3F,0x00,0x00,0xFF,0x7F,0x00,0x00,0x3F,0x7E,0x00,
+    0x80,0x1F,0xFC,0x00,0x80,0x0F,0xF8,0x00,0x02,0x9D,0x00,0x1F,0xF8,0x00,0x00,0x1F,0xFC,0x00,0x00,0x3E,0x7C,0x00,0x00,0xFC,
+    0x7C,0x00,0x00,0xF8,0x7F,0x00,0x00,0xF0,0x3F,0x00,0x00,0xC0,0x3F,0x00,0x00,0x80,0xFF,0x00,0x00,0x80,0xFF,0x03,0x1F,0x80,
+    0xFF,0x07,0x1F,0xC0,0xCF,0x0F,0x1F,0xC0,0x87,0x1F,0x1F,0xE0,0x07,0x3F,0x1E,0xF0,0x03,0x3E,0x1E,0xF0,0x03,0x7C,0x1E,0xF8,
+    0x01,0x7C,0x3E,0xFC,0x00,0x7C,0x3C,0xFE,0x00,0x7C,0x3C,0x7E,0x00,0x7C,0x7C,0x3F,0x00,0x7C,0xF8,0x3F,0x00,0x7E,0xF0,0x1F,
+    0x00,0x7E,0xF0,0x0F,0x00,0x3F,0xE0,0x07,0x80,0x3F,0xF0,0x0F,0xC0,0x1F,0xF8,0x7F,0xE0,0x0F,0xFC,0xFF,0xFF,0x0F,0xFE,0xFC,
+    0xFF,0x03,0x7F,0xF0,0xFF,0x01,0x00,0x80,0x3F,0x00,0x49,0x00,0x80,0x00,0xF0,0x0F,0x00,0x04,0x80,0x00,0xE0,0x07,0x00,0x08,
+    0x63,0x00,0x8D,0x70,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0xF0,0x0F,0x00,0x00,0xF0,0x1F,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,
+    0xFF,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0xF0,0x01,0x00,0x00,0xE0,0x03,0x00,0x00,0xE0,0x07,0x00,0x00,0xC0,0x07,0x00,0x00,
+    0x80,0x0F,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x1F,0x00,0x00,0x80,0x00,0x00,0x3E,0x00,0x02,0x80,0x00,0x00,0x7C,0x00,0x09,
+    0x80,0x00,0x00,0x3E,0x00,0x02,0x80,0x00,0x00,0x1F,0x00,0x00,0x8C,0x00,0x80,0x1F,0x00,0x00,0x80,0x0F,0x00,0x00,0xC0,0x07,
+    0x00,0x00,0xE0,0x07,0x00,0x00,0xE0,0x03,0x00,0x00,0xF0,0x01,0x00,0x00,0xFC,0x01,0x00,0x00,0xFF,0x00,0x00,0xC0,0x7F,0x00,
+    0x00,0xF0,0x1F,0x00,0x00,0xF0,0x0F,0x00,0x00,0xF0,0x03,0x00,0x00,0x70,0x00,0x00,0x00,0x42,0x00,0x8D,0x00,0x00,0x00,0x0E,
+    0x00,0x00,0xC0,0x0F,0x00,0x00,0xF0,0x0F,0x00,0x00,0xF8,0x0F,0x00,0x00,0xFE,0x03,0x00,0x00,0xFF,0x00,0x00,0x80,0x3F,0x00,
+    0x00,0x80,0x0F,0x00,0x00,0xC0,0x07,0x00,0x00,0xE0,0x07,0x00,0x00,0xF0,0x03,0x00,0x00,0xF0,0x01,0x00,0x00,0xF8,0x01,0x00,
+    0x00,0xF8,0x00,0x00,0x00,0x80,0x00,0x7C,0x00,0x00,0x02,0x80,0x00,0x3E,0x00,0x00,0x09,0x80,0x00,0x7C,0x00,0x00,0x02,0x80,
+    0x00,0xF8,0x00,0x00,0x00,0x8C,0x00,0xF8,0x01,0x00,0x00,0xF0,0x01,0x00,0x00,0xE0,0x03,0x00,0x00,0xE0,0x07,0x00,0x00,0xC0,
+    0x07,0x00,0x00,0x80,0x0F,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0xF8,0x0F,0x00,0x00,
+    0xF0,0x0F,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x0E,0x42,0x03,0x80,0x00,0xC0,0x07,0x00,0x03,0x86,0x40,0x80,0x03,0x04,0xC0,
+    0x81,0x03,0x07,0xC0,0x87,0xC3,0x07,0xC0,0x1F,0xF0,0x07,0xE0,0x3F,0xF8,0x0F,0xC0,0x1F,0xF0,0x07,0x00,0x18,0x30,0x00,0x40,
+    0x88,0x00,0x20,0x08,0x00,0x00,0xF0,0x1E,0x00,0x00,0x78,0x3C,0x00,0x00,0x7C,0x7C,0x00,0x00,0x3E,0xF8,0x00,0x00,0x3F,0xF8,
+    0x01,0x00,0x1F,0xF0,0x01,0x00,0x0E,0xE0,0x00,0x00,0x08,0x20,0x00,0x5A,0x0E,0x80,0x00,0xC0,0x03,0x00,0x09,0x80,0xFC,0xFF,
+    0xFF,0x3F,0x02,0x80,0x00,0xC0,0x03,0x00,0x0A,0x4A,0x21,0x80,0x00,0xE0,0x0F,0x00,0x06,0x80,0x00,0xE0,0x01,0x00,0x00,0x80,
+    0x00,0xC0,0x01,0x00,0x00,0x83,0x00,0xC0,0x03,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x0C,0x00,0x42,0x17,
+    0x80,0xE0,0xFF,0xFF,0x07,0x02,0x58,0x21,0x80,0x00,0xF0,0x0F,0x00,0x06,0x4A,0x00,0x81,0x3C,0x00,0x00,0x00,0x78,0x00,0x00,
+    0x00,0x00,0x80,0xF0,0x00,0x00,0x00,0x00,0x80,0xE0,0x01,0x00,0x00,0x00,0x80,0xC0,0x03,0x00,0x00,0x00,0x80,0x80,0x07,0x00,
+    0x00,0x00,0x80,0x00,0x0F,0x00,0x00,0x00,0x80,0x00,0x1E,0x00,0x00,0x00,0x80,0x00,0x3C,0x00,0x00,0x00,0x80,0x00,0x78,0x00,
+    0x00,0x00,0x80,0x00,0xF0,0x00,0x00,0x00,0x80,0x00,0xE0,0x01,0x00,0x00,0x80,0x00,0xC0,0x03,0x00,0x01,0x80,0x00,0x80,0x07,
+    0x00,0x00,0x80,0x00,0x00,0x0F,0x00,0x00,0x80,0x00,0x00,0x1E,0x00,0x00,0x80,0x00,0x00,0x3C,0x00,0x00,0x80,0x00,0x00,0x78,
+    0x00,0x00,0x80,0x00,0x00,0xF0,0x00,0x00,0x80,0x00,0x00,0xE0,0x01,0x00,0x80,0x00,0x00,0xC0,0x03,0x00,0x80,0x00,0x00,0x80,
+    0x07,0x00,0x80,0x00,0x00,0x00,0x0F,0x00,0x80,0x00,0x00,0x00,0x1E,0x00,0x80,0x00,0x00,0x00,0x3C,0x42,0x02,0x87,0x00,0xE0,
+    0x07,0x00,0x00,0xFC,0x3F,0x00,0x00,0xFE,0x7F,0x00,0x00,0xFF,0xFF,0x00,0x80,0x1F,0xF8,0x01,0xC0,0x0F,0xF0,0x03,0xC0,0x07,
+    0xE0,0x03,0xE0,0x03,0xC0,0x07,0x00,0x81,0xE0,0x01,0x80,0x07,0xF0,0x01,0x80,0x0F,0x01,0x81,0xF0,0x00,0x00,0x0F,0xF8,0x00,
+    0x00,0x1F,0x0A,0x81,0xF0,0x00,0x00,0x0F,0xF0,0x01,0x80,0x0F,0x01,0x81,0xE0,0x01,0x80,0x07,0xE0,0x03,0xC0,0x07,0x00,0x86,
+    0xC0,0x07,0xE0,0x03,0xC0,0x0F,0xF0,0x03,0x80,0x1F,0xF8,0x01,0x00,0xFF,0xFF,0x00,0x00,0xFE,0x7F,0x00,0x00,0xFC,0x3F,0x00,
+    0x00,0xE0,0x07,0x00,0x49,0x02,0x88,0x00,0x30,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0xF0,0x0F,0x00,0x00,0xF0,0x7F,0x00,0x00,
+    0xF0,0xFF,0x03,0x00,0xF0,0xFF,0x07,0x00,0xF0,0xE1,0x07,0x00,0xF0,0x01,0x06,0x00,0xF0,0x01,0x00,0x19,0x80,0xFC,0xFF,0xFF,
+    0x07,0x02,0x4A,0x02,0x88,0x00,0xC0,0x3F,0x00,0x00,0xF0,0xFF,0x03,0x00,0xFC,0xFF,0x07,0x00,0xFE,0xFF,0x07,0x00,0xFE,0xC0,
+    0x07,0x00,0x3F,0x00,0x06,0x00,0x1F,0x00,0x00,0x80,0x1F,0x00,0x00,0x80,0x0F,0x00,0x00,0x04,0x80,0x00,0x1F,0x00,0x00,0x00,
+    0x80,0x00,0x3E,0x00,0x00,0x00,0x87,0x00,0x7C,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0xE0,0x03,0x00,0x00,
+    0xC0,0x07,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x3E,0x00,0x00,0x82,0x00,0x00,0x7C,0x00,0x00,0x00,0xF8,
+    0x00,0x00,0x00,0xF0,0x01,0x00,0x84,0x00,0x00,0xE0,0x03,0x00,0x00,0xE0,0x07,0x00,0x00,0xC0,0x07,0x00,0x00,0xC0,0x0F,0x80,
+    0xFF,0xFF,0x0F,0x02,0x4A,0x02,0x82,0x00,0xF0,0x1F,0x00,0x00,0xFC,0xFF,0x01,0x00,0xFF,0xFF,0x01,0x00,0x83,0x80,0x3F,0xE0,
+    0x01,0xC0,0x0F,0x00,0x01,0xC0,0x0F,0x00,0x00,0xC0,0x07,0x00,0x00,0x03,0x80,0x80,0x0F,0x00,0x00,0x00,0x89,0x00,0x3F,0x00,
+    0x00,0x00,0x7E,0x00,0x00,0x00,0xF8,0x3F,0x00,0x00,0xF0,0x3F,0x00,0x00,0xF8,0x3F,0x00,0x00,0xFE,0x3F,0x00,0x00,0xFF,0x00,
+    0x00,0x80,0x1F,0x00,0x00,0xC0,0x0F,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x80,0xE0,0x03,0x00,0x00,0x04,0x88,0xE0,0x07,0x00,
+    0x00,0xC0,0x07,0x00,0x00,0xC0,0x0F,0x00,0x00,0x80,0x1F,0x00,0x02,0x80,0x7F,0xC0,0x03,0x00,0xFF,0xFF,0x03,0x00,0xFE,0xFF,
+    0x03,0x00,0xF8,0xFF,0x03,0x00,0xC0,0x7F,0x00,0x49,0x03,0x82,0x00,0x1F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x7F,0x00,0x00,
+    0x00,0x81,0x00,0xFF,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x91,0x00,0xFF,0x03,0x00,0x00,0xDF,0x07,0x00,0x00,0x9F,0x07,0x00,
+    0x00,0x9F,0x0F,0x00,0x00,0x1F,0x1F,0x00,0x00,0x1F,0x1E,0x00,0x00,0x1F,0x3C,0x00,0x00,0x1F,0x7C,0x00,0x00,0x1F,0x78,0x00,
+    0x00,0x1F,0xF0,0x00,0x00,0x1F,0xF0,0x01,0x00,0x1F,0xE0,0x01,0x00,0x1F,0xC0,0x03,0x00,0x1F,0xC0,0x07,0x00,0x1F,0x80,0x0F,
+    0x00,0x1F,0x00,0x0F,0x00,0x1F,0x00,0x1F,0xF8,0xFF,0xFF,0x1F,0x02,0x80,0x00,0x1F,0x00,0x00,0x08,0x4A,0x03,0x80,0xC0,0xFF,
+    0xFF,0x00,0x03,0x80,0x00,0x00,0xF0,0x00,0x08,0x87,0x00,0x80,0xFF,0x00,0x00,0xF0,0xFF,0x00,0x00,0xFC,0xFF,0x00,0x00,0xFE,
+    0xFF,0x00,0x00,0xFF,0x01,0x00,0x80,0x3F,0x00,0x00,0xC0,0x0F,0x00,0x00,0xC0,0x07,0x00,0x00,0x00,0x80,0xE0,0x03,0x00,0x00,
+    0x04,0x88,0xE0,0x07,0x00,0x00,0xC0,0x07,0x00,0x00,0xC0,0x0F,0x00,0x00,0x80,0x1F,0x00,0x01,0x00,0x7F,0xE0,0x01,0x00,0xFF,
+    0xFF,0x01,0x00,0xFC,0xFF,0x01,0x00,0xF8,0xFF,0x01,0x00,0xC0,0x3F,0x00,0x49,0x02,0x89,0x00,0xFE,0x01,0x00,0xE0,0xFF,0x07,
+    0x00,0xE0,0xFF,0x1F,0x00,0xE0,0xFF,0x3F,0x00,0xE0,0x01,0x7F,0x00,0x20,0x00,0xFC,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xF0,
+    0x01,0x00,0x00,0xF0,0x03,0x00,0x00,0xE0,0x03,0x00,0x80,0x00,0x00,0xC0,0x07,0x01,0x8A,0x00,0x00,0x80,0x07,0x00,0xF8,0x81,
+    0x0F,0x00,0xFE,0x87,0x0F,0x80,0xFF,0x9F,0x0F,0xC0,0xFF,0xBF,0x0F,0xE0,0x1F,0xBC,0x0F,0xE0,0x07,0xF0,0x0F,0xF0,0x03,0xE0,
+    0x0F,0xF0,0x01,0xE0,0x0F,0xF8,0x01,0xC0,0x0F,0xF8,0x00,0xC0,0x0F,0x01,0x80,0xF8,0x00,0xC0,0x07,0x02,0x88,0xF0,0x01,0xC0,
+    0x03,0xF0,0x01,0xE0,0x03,0xF0,0x03,0xF0,0x03,0xE0,0x07,0xF8,0x01,0xC0,0x0F,0xFC,0x00,0x80,0xFF,0xFF,0x00,0x00,0xFF,0x7F,
+    0x00,0x00,0xFE,0x1F,0x00,0x00,0xF8,0x07,0x00,0x49,0x03,0x80,0xF0,0xFF,0xFF,0x07,0x03,0x8D,0xE0,0x01,0x00,0x00,0xE0,0x03,
+    0x00,0x00,0xC0,0x03,0x00,0x00,0xC0,0x07,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x1E,
+    0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xF0,
+    0x01,0x00,0x00,0x80,0x00,0xE0,0x03,0x00,0x00,0x80,0x00,0xC0,0x07,0x00,0x00,0x83,0x00,0x80,0x0F,0x00,0x00,0x80,0x1F,0x00,
+    0x00,0x00,0x1F,0x00,0x00,0x00,0x3F,0x00,0x00,0x80,0x00,0x00,0x7E,0x00,0x00,0x81,0x00,0x00,0x7C,0x00,0x00,0x00,0xFC,0x00,
+    0x01,0x80,0x00,0x00,0xF8,0x01,0x01,0x4A,0x02,0x87,0x00,0xF0,0x07,0x00,0x00,0xFE,0x3F,0x00,0x00,0xFF,0x7F,0x00,0x80,0xFF,
+    0xFF,0x00,0x80,0x3F,0xFC,0x01,0xC0,0x0F,0xF0,0x01,0xC0,0x0F,0xE0,0x03,0xC0,0x07,0xE0,0x03,0x02,0x8F,0x80,0x07,0xF0,0x03,
+    0x80,0x0F,0xF0,0x03,0x80,0x0F,0xF8,0x01,0x00,0x1F,0xFC,0x01,0x00,0x3E,0xFF,0x00,0x00,0xFC,0x7F,0x00,0x00,0xF8,0x3F,0x00,
+    0x00,0xF8,0x1F,0x00,0x00,0xFC,0x7F,0x00,0x00,0xFF,0xFF,0x00,0x80,0xFF,0xF8,0x01,0xC0,0x7F,0xF0,0x03,0xC0,0x1F,0xE0,0x03,
+    0xE0,0x0F,0xC0,0x07,0xE0,0x07,0xC0,0x07,0xF0,0x03,0x80,0x0F,0x00,0x80,0xF0,0x01,0x80,0x0F,0x02,0x87,0xE0,0x03,0xC0,0x0F,
+    0xE0,0x03,0xE0,0x07,0xE0,0x07,0xF0,0x07,0xC0,0x1F,0xF8,0x03,0x80,0xFF,0xFF,0x01,0x00,0xFF,0xFF,0x00,0x00,0xFC,0x7F,0x00,
+    0x00,0xF0,0x0F,0x00,0x49,0x02,0x89,0x00,0xF0,0x0F,0x00,0x00,0xFC,0x3F,0x00,0x00,0xFF,0x7F,0x00,0x80,0xFF,0xFF,0x00,0x80,
+    0x1F,0xF8,0x01,0xC0,0x0F,0xF0,0x03,0xE0,0x07,0xE0,0x07,0xE0,0x03,0xC0,0x07,0xE0,0x01,0xC0,0x07,0xF0,0x01,0x80,0x0F,0x02,
+    0x80,0xF8,0x01,0x80,0x0F,0x01,0x8A,0xF8,0x01,0xC0,0x0F,0xF8,0x03,0xC0,0x07,0xF8,0x03,0xE0,0x07,0xF8,0x07,0xF0,0x03,0xF8,
+    0x1E,0xFC,0x03,0xF8,0xFE,0xFF,0x01,0xF8,0xFC,0xFF,0x00,0xF8,0xF0,0x3F,0x00,0xF8,0xC0,0x0F,0x00,0xF0,0x00,0x00,0x00,0xF0,
+    0x01,0x00,0x00,0x01,0x80,0xE0,0x03,0x00,0x00,0x00,0x88,0xE0,0x07,0x00,0x00,0xC0,0x07,0x00,0x00,0x80,0x0F,0x00,0x00,0x80,
+    0x1F,0x00,0x02,0x00,0x7F,0xC0,0x03,0x00,0xFE,0xFF,0x03,0x00,0xFC,0xFF,0x03,0x00,0xF0,0xFF,0x03,0x00,0xC0,0x3F,0x00,0x49,
+    0x0D,0x80,0x00,0xF0,0x0F,0x00,0x06,0x4B,0x80,0x00,0xF0,0x0F,0x00,0x06,0x4A,0x0D,0x80,0x00,0xF0,0x0F,0x00,0x06,0x4B,0x80,
+    0x00,0xF0,0x0F,0x00,0x06,0x81,0x00,0xF0,0x01,0x00,0x00,0xE0,0x01,0x00,0x00,0x84,0x00,0xE0,0x03,0x00,0x00,0xC0,0x03,0x00,
+    0x00,0xC0,0x0F,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x0E,0x00,0x42,0x0E,0x9A,0x04,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x7C,
+    0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0xF8,0x07,0x00,0x00,0xE0,0x1F,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,
+    0xF8,0x0F,0x00,0x00,0xE0,0x3F,0x00,0x00,0x80,0xFF,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0xF8,0x0F,0x00,0x00,0xE0,0x3F,0x00,
+    0x00,0xF8,0x0F,0x00,0x00,0xFE,0x03,0x00,0x80,0xFF,0x00,0x00,0xE0,0x3F,0x00,0x00,0xF8,0x0F,0x00,0x00,0xFE,0x03,0x00,0x80,
+    0x7F,0x00,0x00,0xE0,0x1F,0x00,0x00,0xF8,0x07,0x00,0x00,0xFC,0x01,0x00,0x00,0x7C,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x04,
+    0x00,0x00,0x00,0x4A,0x14,0x80,0xFC,0xFF,0xFF,0x3F,0x02,0x45,0x80,0xFC,0xFF,0xFF,0x3F,0x02,0x51,0x0E,0x9A,0x00,0x00,0x00,
+    0x20,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x3E,0x00,0x00,0x80,0x3F,0x00,0x00,0xE0,0x1F,0x00,0x00,0xF8,0x07,0x00,0x00,0xFE,
+    0x01,0x00,0xC0,0x7F,0x00,0x00,0xF0,0x1F,0x00,0x00,0xFC,0x07,0x00,0x00,0xFF,0x01,0x00,0xC0,0x7F,0x00,0x00,0xF0,0x1F,0x00,
+    0x00,0xFC,0x07,0x00,0x00,0xF0,0x1F,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0xFC,0x07,0x00,0x00,0xF0,0x1F,
+    0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xF8,0x07,0x00,0x00,0xE0,0x1F,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,
+    0x3E,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x20,0x4A,0x02,0x87,0x00,0xF0,0xFF,0x00,0x00,0xFE,0xFF,0x0F,0x80,0xFF,0xFF,0x0F,
+    0xC0,0xFF,0xFF,0x0F,0xE0,0x1F,0x80,0x0F,0xE0,0x07,0x00,0x0F,0xF0,0x03,0x00,0x0F,0xF0,0x01,0x00,0x0F,0x00,0x80,0xF0,0x01,
+    0x00,0x00,0x00,0x80,0xE0,0x03,0x00,0x00,0x00,0x88,0xC0,0x07,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x7E,
+    0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0xE0,0x03,0x00,0x00,0xC0,0x07,0x00,0x00,0x80,0x0F,0x00,0x00,0x81,
+    0x00,0x00,0x0F,0x00,0x00,0x00,0x1F,0x00,0x02,0x44,0x80,0x00,0x80,0x3F,0x00,0x04,0x4A,0x02,0x92,0x00,0xFC,0x01,0x00,0x80,
+    0xFF,0x0F,0x00,0xC0,0xFF,0x3F,0x00,0xE0,0x07,0x7E,0x00,0xF0,0x01,0xF8,0x00,0xF0,0x00,0xF0,0x01,0xF0,0x00,0xE0,0x03,0x78,
+    0x00,0xC0,0x03,0x78,0x1F,0x80,0x07,0xF8,0x7F,0x80,0x0F,0xF8,0xFF,0x00,0x0F,0xF8,0xF0,0x01,0x0F,0x78,0xE0,0x01,0x1E,0x78,
+    0xC0,0x03,0x1E,0x78,0x80,0x07,0x1E,0x78,0x80,0x07,0x3E,0x78,0x80,0x07,0x3C,0x78,0x00,0x07,0x3C,0xF8,0x00,0x0F,0x3C,0x01,
+    0x80,0xF8,0x01,0x0F,0x3C,0x00,0x80,0xF8,0x03,0x0F,0x3C,0x00,0x8E,0x78,0x07,0x0F,0x3C,0x78,0x8F,0x0F,0x3E,0x78,0x9E,0x07,
+    0x1E,0x78,0xFE,0x07,0x1E,0x7F,0xFC,0x03,0x1E,0x7F,0xF8,0x03,0x0F,0x7F,0xF0,0x00,0x0F,0x00,0x00,0x80,0x07,0x00,0x00,0xC0,
+    0x07,0x00,0x00,0xE0,0x03,0x80,0x00,0xF0,0x01,0x80,0x07,0xFC,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0x1F,0x00,0x00,0xF8,0x07,
+    0x00,0x49,0x08,0x80,0x00,0xE0,0x07,0x00,0x00,0x80,0x00,0xF0,0x0F,0x00,0x01,0x80,0x00,0xF8,0x1E,0x00,0x00,0x81,0x00,0xFC,
+    0x3E,0x00,0x00,0x7C,0x3C,0x00,0x00,0x83,0x00,0x3E,0x7C,0x00,0x00,0x3E,0x78,0x00,0x00,0x3F,0xF8,0x00,0x00,0x1F,0xF0,0x00,
+    0x00,0x87,0x80,0x0F,0xF0,0x01,0x80,0x0F,0xE0,0x01,0xC0,0x0F,0xE0,0x03,0xC0,0x07,0xE0,0x03,0xC0,0x07,0xC0,0x03,0xE0,0x03,
+    0xC0,0x07,0xE0,0xFF,0xFF,0x07,0xF0,0xFF,0xFF,0x0F,0x00,0x81,0xF8,0xFF,0xFF,0x1F,0xF8,0x00,0x00,0x1F,0x00,0x83,0xFC,0x00,
+    0x00,0x3E,0x7C,0x00,0x00,0x3E,0x7E,0x00,0x00,0x7E,0x3E,0x00,0x00,0x7C,0x00,0x80,0x3F,0x00,0x00,0xFC,0x4A,0x08,0x86,0x00,
+    0xF8,0xFF,0x07,0x00,0xFF,0xFF,0x07,0xC0,0xFF,0xFF,0x07,0xE0,0xFF,0xFF,0x07,0xE0,0x0F,0xC0,0x07,0xF0,0x03,0xC0,0x07,0xF0,
+    0x01,0xC0,0x07,0x02,0x8C,0xE0,0x03,0xC0,0x07,0xC0,0x07,0xC0,0x07,0x80,0x3F,0xC0,0x07,0x00,0xFF,0xFF,0x07,0x00,0xFC,0xFF,
+    0x07,0x00,0xFE,0xFF,0x07,0x80,0xFF,0xFF,0x07,0xC0,0x7F,0xC0,0x07,0xE0,0x0F,0xC0,0x07,0xF0,0x03,0xC0,0x07,0xF0,0x01,0xC0,
+    0x07,0xF8,0x01,0xC0,0x07,0xF8,0x00,0xC0,0x07,0x02,0x86,0xF8,0x01,0xC0,0x07,0xF0,0x01,0xC0,0x07,0xF0,0x0F,0xC0,0x07,0xE0,
+    0xFF,0xFF,0x07,0xC0,0xFF,0xFF,0x07,0x80,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0x07,0x4A,0x07,0x8B,0xC0,0xFF,0x00,0x00,0xFC,0xFF,
+    0x07,0x00,0xFC,0xFF,0x1F,0x00,0xFC,0xFF,0x7F,0x00,0x7C,0x80,0xFF,0x00,0x0C,0x00,0xFC,0x01,0x00,0x00,0xF8,0x03,0x00,0x00,
+    0xF0,0x03,0x00,0x00,0xE0,0x07,0x00,0x00,0xC0,0x07,0x00,0x00,0xC0,0x0F,0x00,0x00,0x80,0x0F,0x00,0x80,0x00,0x00,0x00,0x1F,
+    0x07,0x80,0x00,0x00,0x80,0x0F,0x00,0x8A,0x00,0x00,0xC0,0x0F,0x00,0x00,0xC0,0x07,0x00,0x00,0xE0,0x07,0x00,0x00,0xF0,0x03,
+    0x00,0x00,0xF8,0x03,0x04,0x00,0xFE,0x01,0x3C,0x80,0xFF,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x1F,0x00,0xF8,0xFF,0x07,0x00,
+    0x80,0xFF,0x00,0x00,0x49,0x08,0x89,0x00,0xC0,0xFF,0x1F,0x00,0xF8,0xFF,0x1F,0x00,0xFE,0xFF,0x1F,0x00,0xFF,0xFF,0x1F,0x80,
+    0x7F,0x00,0x1F,0xC0,0x1F,0x00,0x1F,0xE0,0x07,0x00,0x1F,0xE0,0x03,0x00,0x1F,0xF0,0x03,0x00,0x1F,0xF0,0x01,0x00,0x1F,0x00,
+    0x81,0xF8,0x01,0x00,0x1F,0xF8,0x00,0x00,0x1F,0x07,0x80,0xF0,0x01,0x00,0x1F,0x01,0x80,0xE0,0x03,0x00,0x1F,0x00,0x86,0xC0,
+    0x07,0x00,0x1F,0xC0,0x1F,0x00,0x1F,0x80,0xFF,0x00,0x1F,0x00,0xFF,0xFF,0x1F,0x00,0xFE,0xFF,0x1F,0x00,0xF8,0xFF,0x1F,0x00,
+    0x80,0xFF,0x1F,0x4A,0x08,0x80,0xF8,0xFF,0xFF,0x03,0x02,0x80,0x00,0x00,0xE0,0x03,0x08,0x80,0xC0,0xFF,0xFF,0x03,0x02,0x80,
+    0x00,0x00,0xE0,0x03,0x09,0x80,0xFC,0xFF,0xFF,0x03,0x02,0x4A,0x08,0x80,0xFC,0xFF,0xFF,0x03,0x02,0x80,0x00,0x00,0xE0,0x03,
+    0x09,0x80,0xE0,0xFF,0xFF,0x03,0x02,0x80,0x00,0x00,0xE0,0x03,0x0C,0x4A,0x07,0x8B,0x80,0xFF,0x01,0x00,0xF8,0xFF,0x0F,0x00,
+    0xF8,0xFF,0x3F,0x00,0xF8,0xFF,0xFF,0x00,0xF8,0x00,0xFF,0x01,0x18,0x00,0xF8,0x03,0x00,0x00,0xF0,0x07,0x00,0x00,0xE0,0x07,
+    0x00,0x00,0xC0,0x0F,0x00,0x00,0x80,0x0F,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x1F,0x00,0x80,0x00,0x00,0x00,0x3E,0x03,0x80,
+    0xF8,0x3F,0x00,0x3E,0x02,0x80,0xF8,0x00,0x00,0x1F,0x00,0x8A,0xF8,0x00,0x80,0x1F,0xF8,0x00,0x80,0x0F,0xF8,0x00,0xC0,0x0F,
+    0xF8,0x00,0xE0,0x07,0xF8,0x00,0xF0,0x07,0xF8,0x00,0xFC,0x03,0xF8,0x80,0xFF,0x01,0xF8,0xFF,0xFF,0x00,0xF8,0xFF,0x3F,0x00,
+    0xF8,0xFF,0x0F,0x00,0x00,0xFF,0x01,0x00,0x49,0x08,0x80,0xF0,0x01,0x80,0x0F,0x0C,0x80,0xF0,0xFF,0xFF,0x0F,0x02,0x80,0xF0,
+    0x01,0x80,0x0F,0x0D,0x4A,0x08,0x80,0xE0,0xFF,0xFF,0x0F,0x02,0x80,0x00,0xC0,0x07,0x00,0x17,0x80,0xE0,0xFF,0xFF,0x0F,0x02,
+    0x4A,0x08,0x80,0x00,0xFF,0xFF,0x00,0x02,0x80,0x00,0x1F,0x00,0x00,0x14,0x80,0x00,0x3E,0x00,0x00,0x00,0x82,0x00,0x7E,0x00,
+    0x00,0x00,0xFC,0xC0,0x03,0x00,0xF8,0xFF,0x03,0x00,0x81,0x00,0xE0,0xFF,0x03,0x00,0x80,0x7F,0x00,0x49,0x08,0xA0,0xF0,0x03,
+    0x80,0x0F,0xE0,0x07,0x80,0x0F,0xC0,0x07,0x80,0x0F,0x80,0x0F,0x80,0x0F,0x00,0x1F,0x80,0x0F,0x00,0x3E,0x80,0x0F,0x00,0x7C,
+    0x80,0x0F,0x00,0xFC,0x80,0x0F,0x00,0xF8,0x80,0x0F,0x00,0xF0,0x81,0x0F,0x00,0xE0,0x83,0x0F,0x00,0xC0,0x87,0x0F,0x00,0x80,
+    0x8F,0x0F,0x00,0x80,0x9F,0x0F,0x00,0x00,0xBF,0x0F,0x00,0x00,0xBE,0x0F,0x00,0x00,0xFF,0x0F,0x00,0x80,0xBF,0x0F,0x00,0x80,
+    0x9F,0x0F,0x00,0xC0,0x8F,0x0F,0x00,0xE0,0x87,0x0F,0x00,0xF0,0x83,0x0F,0x00,0xF8,0x81,0x0F,0x00,0xFC,0x80,0x0F,0x00,0x7E,
+    0x80,0x0F,0x00,0x7F,0x80,0x0F,0x80,0x3F,0x80,0x0F,0xC0,0x1F,0x80,0x0F,0xE0,0x0F,0x80,0x0F,0xF0,0x07,0x80,0x0F,0xF8,0x03,
+    0x80,0x0F,0xFC,0x01,0x80,0x0F,0xFE,0x00,0x80,0x0F,0x4A,0x08,0x80,0x00,0x00,0xE0,0x03,0x1B,0x80,0xF8,0xFF,0xFF,0x03,0x02,
+    0x4A,0x08,0x81,0xF8,0x01,0x80,0x3F,0xF8,0x03,0x80,0x3F,0x00,0x81,0xF8,0x03,0xC0,0x3F,0xF8,0x07,0xC0,0x3F,0x00,0x86,0x78,
+    0x07,0xE0,0x3F,0x78,0x0F,0xE0,0x3D,0x78,0x0F,0xF0,0x3D,0x78,0x0E,0xF0,0x3C,0x78,0x1E,0xF0,0x3C,0x78,0x1E,0xF8,0x3C,0x78,
+    0x3C,0x78,0x3C,0x00,0x81,0x78,0x3C,0x7C,0x3C,0x78,0x78,0x3C,0x3C,0x00,0x81,0x78,0x78,0x3E,0x3C,0x78,0xF0,0x1E,0x3C,0x00,
+    0x81,0x78,0xE0,0x1F,0x3C,0x78,0xE0,0x0F,0x3C,0x00,0x81,0x78,0xC0,0x0F,0x3C,0x78,0xC0,0x07,0x3C,0x00,0x80,0x78,0x00,0x00,
+    0x3C,0x05,0x4A,0x08,0x81,0xF0,0x00,0x80,0x0F,0xF0,0x00,0xC0,0x0F,0x00,0x80,0xF0,0x00,0xE0,0x0F,0x00,0x81,0xF0,0x00,0xF0,
+    0x0F,0xF0,0x00,0xF8,0x0F,0x00,0x81,0xF0,0x00,0xFC,0x0F,0xF0,0x00,0x7E,0x0F,0x00,0x81,0xF0,0x00,0x3F,0x0F,0xF0,0x80,0x1F,
+    0x0F,0x00,0x83,0xF0,0xC0,0x0F,0x0F,0xF0,0xC0,0x07,0x0F,0xF0,0xE0,0x07,0x0F,0xF0,0xF0,0x03,0x0F,0x00,0x81,0xF0,0xF8,0x01,
+    0x0F,0xF0,0xFC,0x00,0x0F,0x00,0x83,0xF0,0x7E,0x00,0x0F,0xF0,0x3E,0x00,0x0F,0xF0,0x3F,0x00,0x0F,0xF0,0x1F,0x00,0x0F,0x00,
+    0x81,0xF0,0x0F,0x00,0x0F,0xF0,0x07,0x00,0x0F,0x00,0x81,0xF0,0x03,0x00,0x0F,0xF0,0x01,0x00,0x0F,0x00,0x4A,0x07,0x87,0x00,
+    0xF0,0x0F,0x00,0x00,0xFC,0x3F,0x00,0x00,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x01,0xC0,0x1F,0xF8,0x03,0xE0,0x07,0xE0,0x07,0xE0,
+    0x03,0xC0,0x07,0xF0,0x01,0x80,0x0F,0x00,0x80,0xF8,0x00,0x00,0x1F,0x01,0x80,0x7C,0x00,0x00,0x3E,0x09,0x80,0xF8,0x00,0x00,
+    0x1F,0x01,0x80,0xF0,0x01,0x80,0x0F,0x00,0x86,0xE0,0x03,0xC0,0x07,0xE0,0x07,0xE0,0x07,0xC0,0x1F,0xF8,0x03,0x80,0xFF,0xFF,
+    0x01,0x00,0xFF,0xFF,0x00,0x00,0xFC,0x3F,0x00,0x00,0xF0,0x0F,0x00,0x49,0x08,0x87,0x00,0xFE,0xFF,0x03,0xC0,0xFF,0xFF,0x03,
+    0xE0,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0x03,0xF8,0x07,0xE0,0x03,0xF8,0x01,0xE0,0x03,0xFC,0x00,0xE0,0x03,0x7C,0x00,0xE0,0x03,
+    0x03,0x88,0xF8,0x00,0xE0,0x03,0xF8,0x01,0xE0,0x03,0xF8,0x03,0xE0,0x03,0xF0,0x1F,0xE0,0x03,0xE0,0xFF,0xFF,0x03,0x80,0xFF,
+    0xFF,0x03,0x00,0xFE,0xFF,0x03,0x00,0xF0,0xFF,0x03,0x00,0x00,0xE0,0x03,0x0B,0x4A,0x07,0x87,0x00,0xF0,0x0F,0x00,0x00,0xFC,
+    0x3F,0x00,0x00,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x01,0xC0,0x1F,0xF8,0x03,0xE0,0x07,0xE0,0x07,0xE0,0x03,0xC0,0x07,0xF0,0x01,
+    0x80,0x0F,0x00,0x80,0xF8,0x00,0x00,0x1F,0x01,0x80,0x7C,0x00,0x00,0x3E,0x09,0x80,0xF8,0x00,0x00,0x1F,0x01,0x80,0xF0,0x01,
+    0x80,0x0F,0x00,0x8E,0xE0,0x03,0xC0,0x07,0xE0,0x07,0xE0,0x07,0xC0,0x1F,0xF8,0x03,0x80,0xFF,0xFF,0x01,0x00,0xFF,0xFF,0x00,
+    0x00,0xFC,0x3F,0x00,0x00,0xFE,0x0F,0x00,0x80,0x3F,0x00,0x00,0xE0,0x1F,0x00,0x00,0xF8,0x0F,0x00,0x00,0xFF,0x03,0x00,0x00,
+    0xFE,0x01,0x00,0x00,0x7E,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x41,0x08,0x86,0x00,0xF8,0xFF,0x07,0x00,
+    0xFE,0xFF,0x07,0x80,0xFF,0xFF,0x07,0xC0,0xFF,0xFF,0x07,0xC0,0x1F,0xC0,0x07,0xE0,0x07,0xC0,0x07,0xE0,0x03,0xC0,0x07,0x03,
+    0x86,0xC0,0x07,0xC0,0x07,0xC0,0x0F,0xC0,0x07,0x80,0x1F,0xC0,0x07,0x00,0x7F,0xC0,0x07,0x00,0xFE,0xFF,0x07,0x00,0xFC,0xFF,
+    0x07,0x00,0xF0,0xFF,0x07,0x00,0x8D,0x00,0xF8,0xC1,0x07,0x00,0xFC,0xC0,0x07,0x00,0xFE,0xC0,0x07,0x00,0x7E,0xC0,0x07,0x00,
+    0x3F,0xC0,0x07,0x80,0x1F,0xC0,0x07,0xC0,0x1F,0xC0,0x07,0xC0,0x0F,0xC0,0x07,0xE0,0x07,0xC0,0x07,0xF0,0x03,0xC0,0x07,0xF8,
+    0x03,0xC0,0x07,0xF8,0x01,0xC0,0x07,0xFC,0x00,0xC0,0x07,0x7E,0x00,0xC0,0x07,0x4A,0x07,0x86,0x00,0xF8,0x1F,0x00,0x80,0xFF,
+    0x7F,0x00,0xC0,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0x03,0xC0,0x0F,0xF0,0x07,0xC0,0x00,0xC0,0x07,0x00,0x00,0x80,0x0F,0x03,0x8B,
+    0x00,0x00,0xC0,0x0F,0x00,0x00,0xF0,0x07,0x00,0x00,0xFC,0x07,0x00,0x00,0xFF,0x03,0x00,0xE0,0xFF,0x01,0x00,0xFC,0xFF,0x00,
+    0x00,0xFF,0x3F,0x00,0x80,0xFF,0x0F,0x00,0xC0,0xFF,0x01,0x00,0xE0,0x3F,0x00,0x00,0xE0,0x0F,0x00,0x00,0xF0,0x03,0x00,0x00,
+    0x00,0x80,0xF0,0x01,0x00,0x00,0x02,0x86,0xE0,0x03,0x00,0x08,0xE0,0x07,0x00,0x0F,0xC0,0x1F,0xE0,0x0F,0x80,0xFF,0xFF,0x0F,
+    0x00,0xFF,0xFF,0x0F,0x00,0xFC,0xFF,0x03,0x00,0xE0,0x3F,0x00,0x49,0x08,0x80,0xFE,0xFF,0xFF,0x7F,0x02,0x80,0x00,0xE0,0x03,
+    0x00,0x1B,0x4A,0x08,0x80,0xF8,0x00,0x80,0x0F,0x17,0x80,0xF0,0x01,0xC0,0x07,0x00,0x86,0xF0,0x03,0xE0,0x07,0xE0,0x07,0xF0,
+    0x03,0xE0,0x0F,0xF8,0x03,0xC0,0xFF,0xFF,0x01,0x80,0xFF,0xFF,0x00,0x00,0xFE,0x3F,0x00,0x00,0xF8,0x0F,0x00,0x49,0x08,0x99,
+    0x1F,0x00,0x00,0xFC,0x1E,0x00,0x00,0x7C,0x3E,0x00,0x00,0x7C,0x3E,0x00,0x00,0x7E,0x3C,0x00,0x00,0x3E,0x7C,0x00,0x00,0x3F,
+    0x78,0x00,0x00,0x1F,0xF8,0x00,0x00,0x1F,0xF0,0x00,0x80,0x1F,0xF0,0x01,0x80,0x0F,0xF0,0x01,0xC0,0x0F,0xE0,0x01,0xC0,0x07,
+    0xE0,0x03,0xC0,0x07,0xC0,0x03,0xE0,0x07,0xC0,0x07,0xE0,0x03,0x80,0x07,0xF0,0x03,0x80,0x0F,0xF0,0x03,0x80,0x0F,0xF0,0x01,
+    0x00,0x1F,0xF8,0x01,0x00,0x1F,0xF8,0x00,0x00,0x1E,0xFC,0x00,0x00,0x3E,0xFC,0x00,0x00,0x3C,0x7E,0x00,0x00,0x7C,0x7E,0x00,
+    0x00,0x7C,0x3E,0x00,0x00,0xF8,0x3F,0x00,0x00,0x80,0x00,0xF0,0x1F,0x00,0x00,0x80,0x00,0xE0,0x0F,0x00,0x01,0x80,0x00,0xC0,
+    0x07,0x00,0x4A,0x08,0x80,0x0F,0x00,0x00,0xF8,0x01,0x80,0x1E,0x00,0x00,0x78,0x02,0x83,0x1E,0xE0,0x03,0x7C,0x1E,0xE0,0x07,
+    0x7C,0x3C,0xE0,0x07,0x7C,0x3C,0xF0,0x07,0x3C,0x00,0x84,0x3C,0xF0,0x0F,0x3C,0x3C,0xF0,0x0F,0x3E,0x3C,0xF8,0x0F,0x3E,0x78,
+    0xF8,0x0E,0x3E,0x78,0x78,0x1E,0x1E,0x01,0x82,0x78,0x7C,0x3C,0x1E,0x78,0x3C,0x3C,0x1F,0xF0,0x3C,0x3C,0x1F,0x00,0x81,0xF0,
+    0x3E,0x78,0x0F,0xF0,0x1E,0x78,0x0F,0x00,0x83,0xE0,0x1E,0x78,0x0F,0xE0,0x1F,0xF8,0x0F,0xE0,0x0F,0xF0,0x0F,0xE0,0x0F,0xF0,
+    0x07,0x01,0x80,0xC0,0x07,0xE0,0x07,0x4A,0x08,0xA0,0x3E,0x00,0x00,0x7F,0x7C,0x00,0x00,0x3F,0xF8,0x00,0x80,0x1F,0xF0,0x01,
+    0xC0,0x0F,0xF0,0x01,0xE0,0x0F,0xE0,0x03,0xE0,0x07,0xC0,0x07,0xF0,0x03,0x80,0x0F,0xF8,0x01,0x00,0x1F,0xFC,0x01,0x00,0x1F,
+    0xFC,0x00,0x00,0x3E,0x7E,0x00,0x00,0x7C,0x3F,0x00,0x00,0xF8,0x3F,0x00,0x00,0xF8,0x1F,0x00,0x00,0xF0,0x0F,0x00,0x00,0xE0,
+    0x07,0x00,0x00,0xF0,0x07,0x00,0x00,0xF0,0x0F,0x00,0x00,0xF8,0x1F,0x00,0x00,0xFC,0x1F,0x00,0x00,0xFE,0x3E,0x00,0x00,0x7E,
+    0x7C,0x00,0x00,0x3F,0xF8,0x00,0x80,0x1F,0xF8,0x00,0xC0,0x1F,0xF0,0x01,0xC0,0x0F,0xE0,0x03,0xE0,0x07,0xC0,0x07,0xF0,0x03,
+    0x80,0x0F,0xF8,0x03,0x80,0x0F,0xF8,0x01,0x00,0x1F,0xFC,0x00,0x00,0x3E,0x7E,0x00,0x00,0x7C,0x7F,0x00,0x00,0xF8,0x4A,0x08,
+    0x82,0x1F,0x00,0x00,0x7E,0x3E,0x00,0x00,0x3F,0x7C,0x00,0x80,0x1F,0x00,0x8D,0xF8,0x00,0xC0,0x0F,0xF0,0x01,0xC0,0x07,0xF0,
+    0x01,0xE0,0x07,0xE0,0x03,0xF0,0x03,0xC0,0x07,0xF0,0x01,0xC0,0x07,0xF8,0x01,0x80,0x0F,0xFC,0x00,0x00,0x1F,0x7C,0x00,0x00,
+    0x1F,0x7E,0x00,0x00,0x3E,0x3F,0x00,0x00,0x7C,0x1F,0x00,0x00,0xFC,0x1F,0x00,0x00,0xF8,0x0F,0x00,0x00,0xF0,0x07,0x00,0x00,
+    0x80,0x00,0xE0,0x03,0x00,0x0C,0x4A,0x08,0x80,0xFC,0xFF,0xFF,0x0F,0x02,0x99,0xFC,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0xF0,
+    0x03,0x00,0x00,0xE0,0x07,0x00,0x00,0xC0,0x0F,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,
+    0x7E,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0xF0,0x03,0x00,0x00,0xE0,0x03,0x00,0x00,0xE0,0x07,0x00,0x00,
+    0xC0,0x0F,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xF8,0x00,0x00,
+    0x00,0xF8,0x01,0x00,0x00,0xF0,0x03,0x00,0x00,0xE0,0x07,0x00,0x00,0xC0,0x0F,0x00,0x00,0x80,0x1F,0xFC,0xFF,0xFF,0x1F,0x02,
+    0x4A,0x00,0x80,0xE0,0xFF,0x1F,0x00,0x02,0x80,0x00,0x00,0x1E,0x00,0x27,0x80,0xE0,0xFF,0x1F,0x00,0x02,0x42,0x00,0x81,0x00,
+    0x00,0x00,0x3C,0x00,0x00,0x00,0x1E,0x00,0x80,0x00,0x00,0x00,0x0F,0x00,0x80,0x00,0x00,0x80,0x07,0x00,0x80,0x00,0x00,0xC0,
+    0x03,0x00,0x80,0x00,0x00,0xE0,0x01,0x00,0x80,0x00,0x00,0xF0,0x00,0x00,0x80,0x00,0x00,0x78,0x00,0x00,0x80,0x00,0x00,0x3C,
+    0x00,0x00,0x80,0x00,0x00,0x1E,0x00,0x00,0x80,0x00,0x00,0x0F,0x00,0x00,0x80,0x00,0x80,0x07,0x00,0x00,0x80,0x00,0xC0,0x03,
+    0x00,0x01,0x80,0x00,0xE0,0x01,0x00,0x00,0x80,0x00,0xF0,0x00,0x00,0x00,0x80,0x00,0x78,0x00,0x00,0x00,0x80,0x00,0x3C,0x00,
+    0x00,0x00,0x80,0x00,0x1E,0x00,0x00,0x00,0x80,0x00,0x0F,0x00,0x00,0x00,0x80,0x80,0x07,0x00,0x00,0x00,0x80,0xC0,0x03,0x00,
+    0x00,0x00,0x80,0xE0,0x01,0x00,0x00,0x00,0x80,0xF0,0x00,0x00,0x00,0x00,0x80,0x78,0x00,0x00,0x00,0x00,0x80,0x3C,0x00,0x00,
+    0x00,0x42,0x00,0x80,0x00,0xF0,0xFF,0x0F,0x02,0x80,0x00,0xF0,0x00,0x00,0x27,0x80,0x00,0xF0,0xFF,0x0F,0x02,0x42,0x03,0x80,
+    0x00,0x00,0x01,0x00,0x00,0x80,0x00,0x80,0x03,0x00,0x00,0x80,0x00,0xC0,0x07,0x00,0x00,0x93,0x00,0xE0,0x07,0x00,0x00,0xE0,
+    0x0F,0x00,0x00,0xF0,0x0F,0x00,0x00,0xF0,0x1E,0x00,0x00,0xF8,0x1E,0x00,0x00,0x78,0x3E,0x00,0x00,0x7C,0x3C,0x00,0x00,0x3C,
+    0x7C,0x00,0x00,0x3E,0x78,0x00,0x00,0x1E,0x78,0x00,0x00,0x1E,0xF0,0x00,0x00,0x0F,0xF0,0x00,0x00,0x0F,0xE0,0x01,0x80,0x07,
+    0xE0,0x01,0x80,0x07,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0x80,0x07,0xE0,0x01,0x80,0x07,0xE0,0x01,0x80,0x0F,0xF0,0x00,
+    0x00,0x0F,0x00,0x80,0x78,0x00,0x00,0x1E,0x00,0x80,0x3C,0x00,0x00,0x3C,0x52,0x29,0x80,0xFF,0xFF,0xFF,0xFF,0x02,0x46,0x85,
+    0x00,0x80,0x1F,0x00,0x00,0xC0,0x0F,0x00,0x00,0xE0,0x07,0x00,0x00,0xF0,0x01,0x00,0x00,0xF8,0x00,0x00,0x00,0x7C,0x00,0x00,
+    0x6E,0x0D,0x87,0x00,0xF0,0x3F,0x00,0x00,0xFC,0xFF,0x01,0x00,0xFE,0xFF,0x07,0x00,0xFF,0xFF,0x07,0x00,0x7F,0xC0,0x07,0x80,
+    0x1F,0x00,0x06,0x80,0x1F,0x00,0x00,0x80,0x0F,0x00,0x00,0x03,0x87,0x80,0xFF,0x0F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0xFF,
+    0x01,0x80,0x0F,0xF8,0x03,0x80,0x0F,0xC0,0x07,0x80,0x0F,0x80,0x0F,0x80,0x0F,0x00,0x0F,0x80,0x0F,0x00,0x1F,0x01,0x86,0x80,
+    0x1F,0x00,0x1F,0x80,0x3F,0x80,0x1F,0xC0,0xFF,0xC0,0x0F,0xFC,0xF7,0xFF,0x0F,0xFC,0xE7,0xFF,0x07,0xFC,0x83,0xFF,0x03,0xF8,
+    0x00,0xFE,0x00,0x49,0x00,0x80,0x00,0x00,0x80,0x0F,0x0B,0x87,0x00,0xF8,0x81,0x0F,0x00,0xFE,0x87,0x0F,0x00,0xFF,0x8F,0x0F,
+    0x80,0xFF,0x9F,0x0F,0xC0,0x1F,0xBE,0x0F,0xC0,0x07,0xF8,0x0F,0xE0,0x03,0xE0,0x0F,0xE0,0x03,0xC0,0x0F,0x00,0x80,0xF0,0x01,
+    0x80,0x0F,0x08,0x80,0xE0,0x03,0x80,0x0F,0x00,0x87,0xE0,0x07,0x80,0x0F,0xC0,0x07,0xC0,0x0F,0xC0,0x0F,0xF0,0x0F,0x80,0x3F,
+    0xF8,0x0F,0x00,0xFF,0xBF,0x0F,0x00,0xFE,0x1F,0x0F,0x00,0xFC,0x0F,0x0F,0x00,0xF0,0x03,0x00,0x49,0x0D,0x88,0x00,0xFE,0x03,
+    0x00,0xE0,0xFF,0x1F,0x00,0xE0,0xFF,0x7F,0x00,0xE0,0xFF,0xFF,0x00,0xE0,0x01,0xFE,0x01,0x20,0x00,0xF8,0x03,0x00,0x00,0xF0,
+    0x03,0x00,0x00,0xE0,0x07,0x00,0x00,0xC0,0x07,0x00,0x81,0x00,0x00,0xC0,0x0F,0x00,0x00,0x80,0x0F,0x05,0x81,0x00,0x00,0xC0,
+    0x0F,0x00,0x00,0xC0,0x07,0x00,0x87,0x00,0x00,0xE0,0x07,0x00,0x00,0xF0,0x03,0x10,0x00,0xF8,0x03,0xF0,0x00,0xFF,0x01,0xF0,
+    0xFF,0xFF,0x00,0xF0,0xFF,0x3F,0x00,0xF0,0xFF,0x1F,0x00,0x00,0xFF,0x03,0x00,0x49,0x00,0x80,0xE0,0x03,0x00,0x00,0x0B,0x88,
+    0xE0,0xC3,0x1F,0x00,0xE0,0xF3,0x7F,0x00,0xE0,0xFB,0xFF,0x00,0xE0,0xFF,0xFF,0x01,0xE0,0x3F,0xF8,0x03,0xE0,0x1F,0xE0,0x07,
+    0xE0,0x07,0xC0,0x07,0xE0,0x03,0xC0,0x0F,0xE0,0x03,0x80,0x0F,0x00,0x80,0xE0,0x03,0x00,0x1F,0x08,0x88,0xE0,0x07,0x80,0x0F,
+    0xE0,0x0F,0x80,0x0F,0xE0,0x1F,0x80,0x0F,0xE0,0x3F,0xC0,0x07,0xE0,0xFB,0xF0,0x07,0xE0,0xF3,0xFF,0x03,0xE0,0xE3,0xFF,0x01,
+    0xE0,0xC3,0xFF,0x00,0x00,0x00,0x3F,0x00,0x49,0x0D,0x8A,0x00,0xF8,0x07,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFF,0x7F,0x00,0x80,
+    0xFF,0xFF,0x00,0xC0,0x1F,0xFC,0x01,0xC0,0x07,0xF0,0x01,0xE0,0x03,0xE0,0x03,0xE0,0x03,0xC0,0x07,0xE0,0x01,0xC0,0x07,0xF0,
+    0x01,0xC0,0x07,0xF0,0x01,0x80,0x0F,0x00,0x80,0xF0,0xFF,0xFF,0x0F,0x02,0x80,0x00,0x00,0x80,0x0F,0x01,0x80,0x00,0x00,0xC0,
+    0x07,0x00,0x87,0x00,0x00,0xE0,0x07,0x00,0x00,0xF0,0x03,0x10,0x00,0xF8,0x03,0xF0,0x01,0xFE,0x01,0xF0,0xFF,0xFF,0x00,0xF0,
+    0xFF,0x7F,0x00,0xE0,0xFF,0x1F,0x00,0x00,0xFE,0x03,0x00,0x49,0x88,0xF0,0x3F,0x00,0x00,0xFE,0xFF,0x00,0x00,0xFE,0xFF,0x03,
+    0x00,0xFE,0xFF,0x07,0x00,0x0E,0xF0,0x0F,0x00,0x00,0xC0,0x0F,0x00,0x00,0x80,0x0F,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x1F,
+    0x00,0x05,0x80,0xFC,0xFF,0xFF,0x1F,0x02,0x80,0x00,0x00,0x1F,0x00,0x15,0x4A,0x0D,0x88,0xF0,0xC1,0x1F,0x00,0xF0,0xF1,0x7F,
+    0x00,0xF0,0xFD,0xFF,0x00,0xF0,0xFF,0xFF,0x01,0xF0,0x3F,0xF8,0x03,0xF0,0x0F,0xE0,0x07,0xF0,0x03,0xC0,0x07,0xF0,0x01,0xC0,
+    0x0F,0xF0,0x01,0x80,0x0F,0x00,0x80,0xF0,0x01,0x00,0x1F,0x07,0x80,0xF0,0x03,0x80,0x0F,0x00,0x87,0xF0,0x07,0xC0,0x0F,0xF0,
+    0x1F,0xE0,0x07,0xF0,0x7D,0xF0,0x07,0xF0,0xF9,0xFF,0x03,0xF0,0xF1,0xFF,0x01,0xF0,0xE1,0xFF,0x00,0xF0,0x81,0x3F,0x00,0xF0,
+    0x01,0x00,0x00,0x00,0x80,0xE0,0x03,0x00,0x00,0x00,0x86,0xE0,0x07,0x00,0x00,0xC0,0x0F,0x00,0x02,0x80,0x3F,0xC0,0x07,0x80,
+    0xFF,0xFF,0x07,0x00,0xFE,0xFF,0x07,0x00,0xFC,0xFF,0x07,0x00,0xE0,0x7F,0x00,0x00,0x80,0x00,0x00,0xC0,0x07,0x0B,0x8A,0x00,
+    0xFE,0xC0,0x07,0x80,0xFF,0xC3,0x07,0xC0,0xFF,0xC7,0x07,0xE0,0xFF,0xCF,0x07,0xE0,0xFF,0xDF,0x07,0xF0,0x07,0xFF,0x07,0xF0,
+    0x03,0xFC,0x07,0xF0,0x01,0xF8,0x07,0xF0,0x01,0xF0,0x07,0xF0,0x01,0xE0,0x07,0xF0,0x01,0xC0,0x07,0x10,0x4A,0x01,0x80,0x00,
+    0xF8,0x01,0x00,0x04,0x45,0x80,0x00,0xF0,0xFF,0x07,0x02,0x80,0x00,0xF0,0x01,0x00,0x16,0x4A,0x01,0x80,0x00,0x7E,0x00,0x00,
+    0x04,0x45,0x80,0x00,0xFC,0xFF,0x03,0x02,0x80,0x00,0x7C,0x00,0x00,0x19,0x87,0x00,0x78,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,
+    0xF8,0x00,0x10,0x00,0xF0,0x03,0x1E,0x00,0xF0,0xFF,0x1F,0x00,0xE0,0xFF,0x1F,0x00,0xC0,0xFF,0x1F,0x00,0x00,0xFE,0x03,0x00,
+    0x80,0x00,0x00,0xE0,0x03,0x0B,0x9B,0xF8,0x01,0xE0,0x03,0xF0,0x03,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xC0,0x0F,0xE0,0x03,0x80,
+    0x1F,0xE0,0x03,0x00,0x3F,0xE0,0x03,0x00,0x7E,0xE0,0x03,0x00,0xFC,0xE0,0x03,0x00,0xF8,0xE0,0x03,0x00,0xF0,0xE1,0x03,0x00,
+    0xE0,0xE3,0x03,0x00,0xC0,0xE7,0x03,0x00,0x80,0xEF,0x03,0x00,0xC0,0xFF,0x03,0x00,0xC0,0xEF,0x03,0x00,0xE0,0xE7,0x03,0x00,
+    0xF0,0xE3,0x03,0x00,0xF8,0xE1,0x03,0x00,0xFC,0xE0,0x03,0x00,0x7E,0xE0,0x03,0x00,0x7F,0xE0,0x03,0x80,0x3F,0xE0,0x03,0xC0,
+    0x1F,0xE0,0x03,0xE0,0x0F,0xE0,0x03,0xF0,0x07,0xE0,0x03,0xF8,0x03,0xE0,0x03,0xFC,0x01,0xE0,0x03,0xFE,0x00,0xE0,0x03,0x4A,
+    0x00,0x80,0x00,0xF0,0xFF,0x0F,0x02,0x80,0x00,0xF0,0x01,0x00,0x23,0x4A,0x0D,0x89,0xC0,0x03,0x3C,0x3C,0xE0,0x0F,0x7E,0x3C,
+    0xF0,0x1F,0xFF,0x3C,0xF0,0x3F,0xFF,0x3D,0xF8,0xB8,0xCF,0x3F,0x78,0xF0,0x87,0x3F,0x78,0xE0,0x07,0x3F,0x78,0xE0,0x07,0x3E,
+    0x78,0xC0,0x07,0x3E,0x78,0x80,0x07,0x3C,0x11,0x4A,0x0D,0x8A,0x00,0xFE,0xC0,0x07,0x80,0xFF,0xC3,0x07,0xC0,0xFF,0xC7,0x07,
+    0xE0,0xFF,0xCF,0x07,0xE0,0xFF,0xDF,0x07,0xF0,0x07,0xFF,0x07,0xF0,0x03,0xFC,0x07,0xF0,0x01,0xF8,0x07,0xF0,0x01,0xF0,0x07,
+    0xF0,0x01,0xE0,0x07,0xF0,0x01,0xC0,0x07,0x10,0x4A,0x0D,0x88,0x00,0xF0,0x0F,0x00,0x00,0xFE,0x7F,0x00,0x00,0xFF,0xFF,0x00,
+    0x80,0xFF,0xFF,0x01,0xC0,0x1F,0xF8,0x03,0xE0,0x07,0xE0,0x07,0xE0,0x03,0xC0,0x07,0xF0,0x03,0xC0,0x0F,0xF0,0x01,0x80,0x0F,
+    0x00,0x80,0xF8,0x00,0x00,0x1F,0x07,0x80,0xF0,0x01,0x80,0x0F,0x00,0x87,0xF0,0x03,0xC0,0x0F,0xE0,0x03,0xC0,0x07,0xE0,0x07,
+    0xE0,0x07,0xC0,0x1F,0xF8,0x03,0x80,0xFF,0xFF,0x01,0x00,0xFF,0xFF,0x00,0x00,0xFE,0x7F,0x00,0x00,0xF0,0x0F,0x00,0x49,0x0D,
+    0x87,0x00,0xFC,0xC0,0x07,0x00,0xFF,0xC3,0x07,0x80,0xFF,0xCF,0x07,0xC0,0xFF,0xDF,0x07,0xE0,0x0F,0xDF,0x07,0xE0,0x03,0xFC,
+    0x07,0xF0,0x01,0xF0,0x07,0xF0,0x01,0xE0,0x07,0x00,0x80,0xF8,0x00,0xC0,0x07,0x08,0x80,0xF0,0x01,0xC0,0x07,0x00,0x88,0xF0,
+    0x03,0xC0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x07,0xF8,0x07,0xC0,0x1F,0xFC,0x07,0x80,0xFF,0xFF,0x07,0x00,0xFF,0xDF,0x07,0x00,
+    0xFE,0xCF,0x07,0x00,0xF8,0xC3,0x07,0x00,0x00,0xC0,0x07,0x07,0x40,0x0D,0x88,0xE0,0xC1,0x1F,0x00,0xE0,0xF1,0x7F,0x00,0xE0,
+    0xFB,0xFF,0x00,0xE0,0xFF,0xFF,0x01,0xE0,0x3F,0xF8,0x03,0xE0,0x1F,0xE0,0x07,0xE0,0x07,0xC0,0x07,0xE0,0x03,0xC0,0x0F,0xE0,
+    0x03,0x80,0x0F,0x00,0x80,0xE0,0x03,0x00,0x1F,0x08,0x80,0xE0,0x07,0x80,0x0F,0x00,0x87,0xE0,0x0F,0x80,0x0F,0xE0,0x3F,0xC0,
+    0x07,0xE0,0xFB,0xF0,0x07,0xE0,0xF3,0xFF,0x03,0xE0,0xE3,0xFF,0x01,0xE0,0xC3,0xFF,0x00,0xE0,0x03,0x3F,0x00,0xE0,0x03,0x00,
+    0x00,0x07,0x40,0x0D,0x8A,0xF0,0x0F,0xF8,0x00,0xF8,0x3F,0xF8,0x00,0xF8,0xFF,0xF8,0x00,0xF8,0xFF,0xF9,0x00,0x78,0xF0,0xFB,
+    0x00,0x78,0xC0,0xFF,0x00,0x78,0x00,0xFF,0x00,0x78,0x00,0xFE,0x00,0x78,0x00,0xFC,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xF8,
+    0x00,0x10,0x4A,0x0D,0x86,0x00,0xFC,0x0F,0x00,0xC0,0xFF,0x3F,0x00,0xC0,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0x01,0xC0,0x03,0xFC,
+    0x01,0x00,0x00,0xF0,0x03,0x00,0x00,0xE0,0x03,0x01,0x8A,0x00,0x00,0xF0,0x03,0x00,0x00,0xFC,0x03,0x00,0x80,0xFF,0x01,0x00,
+    0xF0,0xFF,0x00,0x00,0xFE,0x7F,0x00,0x80,0xFF,0x1F,0x00,0xC0,0xFF,0x03,0x00,0xE0,0x7F,0x00,0x00,0xE0,0x0F,0x00,0x00,0xF0,
+    0x03,0x00,0x00,0xF0,0x01,0x00,0x00,0x01,0x86,0xF0,0x03,0x00,0x00,0xE0,0x07,0x00,0x07,0xE0,0x1F,0xE0,0x07,0xC0,0xFF,0xFF,
+    0x07,0x80,0xFF,0xFF,0x07,0x00,0xFE,0xFF,0x03,0x00,0xF0,0x3F,0x00,0x49,0x08,0x80,0x00,0x00,0x3E,0x00,0x04,0x80,0xE0,0xFF,
+    0xFF,0x1F,0x02,0x80,0x00,0x00,0x3E,0x00,0x10,0x85,0x00,0x00,0x1F,0x00,0x10,0xC0,0x1F,0x00,0xF0,0xFF,0x1F,0x00,0xF0,0xFF,
+    0x0F,0x00,0xF0,0xFF,0x07,0x00,0xE0,0xFF,0x00,0x00,0x49,0x0D,0x80,0xF0,0x01,0xC0,0x07,0x11,0x89,0xF0,0x03,0xC0,0x07,0xF0,
+    0x07,0xC0,0x07,0xF0,0x0F,0xC0,0x07,0xF0,0x1F,0xE0,0x07,0xF0,0x7F,0xF0,0x07,0xF0,0xFD,0xFF,0x03,0xF0,0xF9,0xFF,0x03,0xF0,
+    0xF1,0xFF,0x01,0xF0,0xE1,0xFF,0x00,0x00,0x80,0x3F,0x00,0x49,0x0D,0x81,0xFC,0x00,0x00,0x3F,0xF8,0x00,0x00,0x1F,0x00,0x83,
+    0xF8,0x01,0x80,0x1F,0xF0,0x01,0x80,0x0F,0xF0,0x03,0x80,0x0F,0xE0,0x03,0xC0,0x07,0x00,0x83,0xC0,0x07,0xE0,0x07,0xC0,0x07,
+    0xE0,0x03,0xC0,0x0F,0xE0,0x03,0x80,0x0F,0xF0,0x01,0x00,0x89,0x00,0x1F,0xF0,0x01,0x00,0x1F,0xF8,0x00,0x00,0x1E,0xF8,0x00,
+    0x00,0x3E,0xFC,0x00,0x00,0x3E,0x7C,0x00,0x00,0x7C,0x7C,0x00,0x00,0x7C,0x3E,0x00,0x00,0x78,0x3E,0x00,0x00,0xF8,0x3F,0x00,
+    0x00,0xF0,0x1F,0x00,0x00,0x81,0x00,0xF0,0x0F,0x00,0x00,0xE0,0x0F,0x00,0x00,0x80,0x00,0xC0,0x07,0x00,0x4A,0x0D,0x80,0x0F,
+    0x00,0x00,0xF8,0x00,0x82,0x0E,0x00,0x00,0xF8,0x1E,0xE0,0x03,0x78,0x1E,0xE0,0x07,0x7C,0x00,0x84,0x1E,0xF0,0x07,0x7C,0x1C,
+    0xF0,0x07,0x7C,0x3C,0xF0,0x0F,0x3C,0x3C,0x70,0x0E,0x3C,0x3C,0x78,0x0E,0x3E,0x00,0x8A,0x38,0x78,0x1E,0x3E,0x78,0x38,0x1C,
+    0x1E,0x78,0x3C,0x1C,0x1E,0x78,0x3C,0x3C,0x1E,0x78,0x3C,0x3C,0x1F,0x70,0x1C,0x38,0x1F,0x70,0x1E,0x38,0x1F,0xF0,0x1E,0x78,
+    0x0F,0xF0,0x1E,0x70,0x0F,0xF0,0x0E,0xF0,0x0F,0xE0,0x0F,0xF0,0x0F,0x00,0x81,0xE0,0x0F,0xE0,0x07,0xE0,0x07,0xE0,0x07,0x00,
+    0x80,0xC0,0x07,0xE0,0x07,0x4A,0x0D,0x9B,0xF8,0x01,0x80,0x3F,0xF0,0x01,0x80,0x1F,0xE0,0x03,0xC0,0x0F,0xE0,0x07,0xE0,0x07,
+    0xC0,0x07,0xF0,0x07,0x80,0x0F,0xF8,0x03,0x00,0x1F,0xF8,0x01,0x00,0x3F,0xFC,0x00,0x00,0x3E,0x7E,0x00,0x00,0x7C,0x7F,0x00,
+    0x00,0xFC,0x3F,0x00,0x00,0xF8,0x1F,0x00,0x00,0xF0,0x0F,0x00,0x00,0xE0,0x0F,0x00,0x00,0xF0,0x0F,0x00,0x00,0xF0,0x1F,0x00,
+    0x00,0xF8,0x1F,0x00,0x00,0xFC,0x3E,0x00,0x00,0xFE,0x7C,0x00,0x00,0x7E,0xFC,0x00,0x00,0x3F,0xF8,0x00,0x80,0x1F,0xF0,0x01,
+    0xC0,0x1F,0xE0,0x03,0xE0,0x0F,0xE0,0x07,0xE0,0x07,0xC0,0x07,0xF0,0x03,0x80,0x0F,0xF8,0x01,0x00,0x1F,0xFC,0x01,0x00,0x3F,
+    0x4A,0x0D,0x95,0x3E,0x00,0x00,0x3F,0x3C,0x00,0x00,0x1F,0x7C,0x00,0x80,0x1F,0x78,0x00,0x80,0x0F,0xF8,0x00,0xC0,0x0F,0xF0,
+    0x00,0xC0,0x0F,0xF0,0x01,0xC0,0x07,0xF0,0x01,0xE0,0x07,0xE0,0x03,0xE0,0x03,0xE0,0x03,0xF0,0x03,0xC0,0x07,0xF0,0x01,0xC0,
+    0x07,0xF8,0x01,0x80,0x07,0xF8,0x00,0x80,0x0F,0xFC,0x00,0x00,0x0F,0x7C,0x00,0x00,0x1F,0x7E,0x00,0x00,0x1E,0x7E,0x00,0x00,
+    0x3E,0x3E,0x00,0x00,0x3C,0x3F,0x00,0x00,0x7C,0x1F,0x00,0x00,0xFC,0x1F,0x00,0x00,0xF8,0x0F,0x00,0x00,0x80,0x00,0xF0,0x07,
+    0x00,0x00,0x80,0x00,0xE0,0x03,0x00,0x00,0x84,0x00,0xC0,0x03,0x00,0x00,0xC0,0x07,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0x0F,
+    0x00,0x00,0x00,0x1F,0x00,0x00,0x84,0x00,0x00,0x7E,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFC,0x1F,0x00,0x00,0xF0,0x1F,0x00,
+    0x00,0xC0,0x1F,0x40,0x0D,0x80,0xF8,0xFF,0xFF,0x07,0x02,0x94,0xF8,0x03,0x00,0x00,0xF0,0x03,0x00,0x00,0xE0,0x07,0x00,0x00,
+    0xC0,0x0F,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xF8,0x01,0x00,
+    0x00,0xF0,0x03,0x00,0x00,0xE0,0x07,0x00,0x00,0xC0,0x0F,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x7E,0x00,
+    0x00,0x00,0xFC,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0xF0,0x03,0x00,0x00,0xE0,0x07,0x00,0x00,0xC0,0x0F,0xF8,0xFF,0xFF,0x0F,
+    0x02,0x4A,0x00,0x86,0xE0,0x1F,0x00,0x00,0xE0,0xFF,0x00,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x03,0x00,0x00,0xF8,0x03,0x00,
+    0x00,0xE0,0x07,0x00,0x00,0xC0,0x07,0x00,0x04,0x81,0x00,0xE0,0x07,0x00,0x00,0xE0,0x03,0x00,0x05,0x83,0x00,0xC0,0x07,0x00,
+    0x00,0xC0,0x1F,0x00,0x00,0x80,0xFF,0x03,0x00,0x00,0xFE,0x03,0x00,0x83,0x00,0x00,0xFF,0x03,0x00,0x80,0x1F,0x00,0x00,0xC0,
+    0x07,0x00,0x00,0xE0,0x03,0x00,0x06,0x80,0x00,0xC0,0x07,0x00,0x05,0x85,0x00,0xE0,0x07,0x00,0x00,0xF8,0x03,0x00,0xE0,0xFF,
+    0x03,0x00,0xE0,0xFF,0x01,0x00,0xE0,0x7F,0x00,0x00,0xE0,0x1F,0x00,0x00,0x42,0x00,0x80,0x00,0xC0,0x03,0x00,0x2F,0x42,0x00,
+    0x86,0x00,0x00,0xF8,0x07,0x00,0x00,0xFF,0x07,0x00,0x80,0xFF,0x07,0x00,0xC0,0xFF,0x07,0x00,0xC0,0x1F,0x00,0x00,0xE0,0x07,
+    0x00,0x00,0xE0,0x03,0x00,0x04,0x81,0x00,0xE0,0x07,0x00,0x00,0xC0,0x07,0x00,0x05,0x83,0x00,0xE0,0x03,0x00,0x00,0xF8,0x03,
+    0x00,0xC0,0xFF,0x01,0x00,0xC0,0x7F,0x00,0x00,0x00,0x83,0xC0,0xFF,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0xE0,0x03,0x00,0x00,
+    0xC0,0x07,0x00,0x06,0x80,0x00,0xE0,0x03,0x00,0x05,0x85,0x00,0xE0,0x07,0x00,0x00,0xC0,0x1F,0x00,0x00,0xC0,0xFF,0x07,0x00,
+    0x80,0xFF,0x07,0x00,0x00,0xFF,0x07,0x00,0x00,0xF8,0x07,0x42,0x16,0x89,0x00,0x00,0xF0,0x01,0x3C,0x00,0xFC,0x07,0x3C,0x00,
+    0xFF,0x0F,0x3C,0x80,0xFF,0x1F,0x7C,0xE0,0x1F,0x1E,0x78,0xF8,0x07,0x3E,0xF8,0xFF,0x01,0x3C,0xF0,0xFF,0x00,0x3C,0xE0,0x3F,
+    0x00,0x3C,0x80,0x0F,0x00,0x00,0x53,0x08,0x80,0x80,0xFF,0xFF,0x01,0x00,0x80,0x80,0x00,0x00,0x01,0x1B,0x80,0x80,0xFF,0xFF,
+    0x01,0x00,0x4A,0x03,0x80,0x00,0x00,0x01,0x00,0x00,0x81,0x00,0x80,0x03,0x00,0x00,0xC0,0x07,0x00,0x00,0x9C,0x00,0xE0,0x0F,
+    0x00,0x00,0xF0,0x1F,0x00,0x00,0xF8,0x1F,0x00,0x00,0xF8,0x3F,0x00,0x00,0xFC,0x7F,0x00,0x00,0xFE,0xFF,0x00,0x00,0xFF,0xFF,
+    0x00,0x80,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0x07,0xF0,0xFF,0xFF,0x0F,0xF8,0xFF,0xFF,0x1F,0xFC,0xFF,0xFF,
+    0x3F,0xFE,0xFF,0xFF,0x7F,0xFC,0xFF,0xFF,0x3F,0xF8,0xFF,0xFF,0x1F,0xF0,0xFF,0xFF,0x0F,0xE0,0xFF,0xFF,0x07,0xC0,0xFF,0xFF,
+    0x03,0x80,0xFF,0xFF,0x03,0x00,0xFF,0xFF,0x01,0x00,0xFE,0xFF,0x00,0x00,0xFE,0x7F,0x00,0x00,0xFC,0x3F,0x00,0x00,0xF8,0x3F,
+    0x00,0x00,0xF0,0x1F,0x00,0x00,0xF0,0x0F,0x00,0x00,0xE0,0x0F,0x00,0x00,0xC0,0x07,0x00,0x00,0x81,0x00,0x80,0x03,0x00,0x00,
+    0x00,0x01,0x00,0x00,0x4A,0x80,0xC0,0x07,0x1F,0xF8,0x03,0x45,0x80,0xC0,0x07,0x1F,0xF8,0x03,0x44,0x80,0xC0,0x07,0x1F,0xF8,
+    0x03,0x45,0x80,0xC0,0x07,0x1F,0xF8,0x03,0x44,0x80,0xC0,0x07,0x1F,0xF8,0x03,0x45,0x80,0x00,0xC0,0x03,0x00,0x17,0x80,0x00,
+    0xC0,0xFF,0xFF,0x02,0x57,0x18,0x80,0x00,0xC0,0xFF,0xFF,0x02,0x80,0x00,0xC0,0x03,0x00,0x16,0x18,0x80,0xFF,0xFF,0x03,0x00,
+    0x02,0x80,0x00,0xC0,0x03,0x00,0x16,0x80,0x00,0xC0,0x03,0x00,0x17,0x80,0xFF,0xFF,0x03,0x00,0x02,0x57,0x80,0x00,0xC0,0x03,
+    0x00,0x17,0x80,0xFF,0xFF,0xFF,0xFF,0x02,0x80,0x00,0xC0,0x03,0x00,0x16,0x18,0x80,0xFF,0xFF,0xFF,0xFF,0x02,0x57,0x80,0x00,
+    0xC0,0x03,0x00,0x17,0x80,0xFF,0xFF,0x03,0x00,0x02,0x80,0x00,0xC0,0x03,0x00,0x16,0x80,0x00,0xC0,0x03,0x00,0x17,0x80,0x00,
+    0xC0,0xFF,0xFF,0x02,0x80,0x00,0xC0,0x03,0x00,0x16,0x18,0x80,0xFF,0xFF,0xFF,0xFF,0x02,0x80,0x00,0xC0,0x03,0x00,0x16,0x80,
+    0x00,0xC0,0x03,0x00,0x33,0x0D,0x80,0x00,0xF0,0x07,0x00,0x04,0x44,0x80,0x00,0xC0,0x01,0x00,0x01,0x81,0x00,0xC0,0x03,0x00,
+    0x00,0xE0,0x03,0x00,0x15,0x40,0x03,0x80,0x00,0xE0,0x00,0x00,0x02,0x87,0x00,0xFC,0x03,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,
+    0x3F,0x00,0xC0,0xFF,0x7F,0x00,0xC0,0xE3,0xFE,0x00,0x40,0xE0,0xF8,0x01,0x00,0xE0,0xF0,0x01,0x00,0xE0,0xE0,0x03,0x01,0x80,
+    0x00,0xE0,0xC0,0x07,0x07,0x80,0x00,0xE0,0xE0,0x03,0x00,0x88,0x00,0xE0,0xF0,0x03,0x00,0xE0,0xF8,0x01,0x40,0xE0,0xFC,0x01,
+    0xC0,0xE3,0xFF,0x00,0xC0,0xFF,0x7F,0x00,0xC0,0xFF,0x3F,0x00,0x80,0xFF,0x1F,0x00,0x00,0xFC,0x03,0x00,0x00,0xE0,0x00,0x00,
+    0x03,0x4A,0x02,0x87,0xC0,0x3F,0x00,0x00,0xE0,0xFF,0x00,0x00,0xE0,0xFF,0x01,0x00,0xE0,0xFF,0x03,0x00,0x60,0xE0,0x07,0x00,
+    0x00,0xC0,0x07,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0x0F,0x00,0x08,0x80,0x00,0xFC,0xFF,0x00,0x02,0x80,0x00,0x80,0x0F,0x00,
+    0x06,0x85,0x00,0x00,0x0F,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0xF8,0x00,0xF0,0xFF,
+    0xFF,0x01,0x03,0x4A,0x09,0x8B,0x00,0x00,0x00,0x04,0x30,0x00,0x00,0x0E,0x78,0x00,0x00,0x1F,0xF0,0xE0,0x87,0x0F,0xE0,0xF9,
+    0xDF,0x07,0xC0,0xFF,0xFF,0x03,0x80,0xFF,0xFF,0x01,0x00,0x3F,0xFC,0x00,0x80,0x0F,0xF0,0x01,0x80,0x07,0xE0,0x01,0xC0,0x07,
+    0xE0,0x03,0xC0,0x03,0xC0,0x03,0x02,0x89,0xC0,0x07,0xE0,0x03,0x80,0x07,0xE0,0x01,0x80,0x0F,0xF0,0x01,0x00,0x3F,0xFC,0x00,
+    0x80,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0x03,0xE0,0xF9,0x9F,0x07,0xF0,0xE0,0x07,0x0F,0x78,0x00,0x00,0x1E,0x30,0x00,0x00,0x0C,
+    0x51,0x03,0x93,0x3E,0x00,0x00,0x7E,0x3C,0x00,0x00,0x3F,0x78,0x00,0x80,0x1F,0xF8,0x00,0x80,0x1F,0xF0,0x00,0xC0,0x0F,0xE0,
+    0x01,0xE0,0x0F,0xE0,0x03,0xE0,0x07,0xC0,0x07,0xF0,0x03,0x80,0x07,0xF0,0x03,0x80,0x0F,0xF8,0x01,0x00,0x1F,0xFC,0x00,0x00,
+    0x1E,0xFC,0x00,0x00,0x3E,0x7E,0x00,0x00,0x7C,0x7F,0x00,0x00,0x78,0x3F,0x00,0x00,0xF8,0x1F,0x00,0x00,0xF0,0x1F,0x00,0x00,
+    0xE0,0x0F,0x00,0x00,0xE0,0x07,0x00,0xC0,0xFF,0xFF,0x07,0x02,0x80,0x00,0xC0,0x07,0x00,0x03,0x80,0xC0,0xFF,0xFF,0x07,0x02,
+    0x80,0x00,0xC0,0x07,0x00,0x04,0x4A,0x00,0x80,0x00,0xC0,0x03,0x00,0x11,0x4A,0x80,0x00,0xC0,0x03,0x00,0x11,0x42,0x02,0x86,
+    0x00,0xFE,0x03,0x00,0xC0,0xFF,0x1F,0x00,0xC0,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0x00,0xC0,0x03,0xFC,0x01,0x00,0x00,0xF0,0x01,
+    0x00,0x00,0xE0,0x03,0x02,0x8B,0x00,0x00,0xF0,0x03,0x00,0x00,0xF8,0x01,0x00,0x00,0xFE,0x01,0x00,0x80,0xFF,0x00,0x00,0xE0,
+    0x7F,0x00,0x00,0xF8,0x3F,0x00,0x00,0xFE,0x7F,0x00,0x00,0xFF,0xF3,0x00,0x80,0xFF,0xF0,0x01,0xC0,0x3F,0xE0,0x01,0xC0,0x0F,
+    0xE0,0x03,0xE0,0x07,0xE0,0x03,0x00,0x8E,0xE0,0x03,0xE0,0x03,0xE0,0x03,0xF0,0x03,0xE0,0x03,0xF8,0x01,0xC0,0x03,0xFE,0x01,
+    0xC0,0x07,0xFF,0x00,0x80,0xC7,0x7F,0x00,0x00,0xFF,0x3F,0x00,0x00,0xFE,0x0F,0x00,0x00,0xFE,0x07,0x00,0x00,0xFF,0x00,0x00,
+    0x80,0x7F,0x00,0x00,0xC0,0x1F,0x00,0x00,0xC0,0x0F,0x00,0x00,0xE0,0x07,0x00,0x00,0xE0,0x03,0x00,0x00,0x01,0x86,0xE0,0x03,
+    0x00,0x02,0xC0,0x07,0x80,0x03,0xC0,0x1F,0xF0,0x03,0x80,0xFF,0xFF,0x03,0x00,0xFF,0xFF,0x03,0x00,0xFC,0xFF,0x00,0x00,0xF0,
+    0x1F,0x00,0x42,0x80,0x00,0x0F,0xE0,0x01,0x02,0x70,0x02,0x8E,0x00,0xF8,0x0F,0x00,0x00,0xFE,0x3F,0x00,0x80,0xFF,0xFF,0x00,
+    0xC0,0x0F,0xF8,0x01,0xE0,0x03,0xE0,0x03,0xF0,0x00,0x80,0x07,0x70,0x00,0x00,0x07,0x78,0x00,0x00,0x0F,0x38,0x00,0x00,0x0E,
+    0x3C,0xFC,0x03,0x1E,0x1C,0xFF,0x0F,0x1C,0x1C,0xFF,0x3F,0x1C,0x1C,0x07,0x7E,0x1C,0x1E,0x00,0x78,0x3C,0x0E,0x00,0xF0,0x38,
+    0x00,0x80,0x0E,0x00,0xE0,0x39,0x05,0x90,0x0E,0x00,0xF0,0x39,0x0E,0x00,0xF0,0x38,0x0E,0x00,0xF8,0x38,0x1E,0x00,0x7C,0x3C,
+    0x1C,0x07,0x7E,0x1C,0x1C,0xFF,0x3F,0x1C,0x1C,0xFF,0x0F,0x1C,0x3C,0xF8,0x03,0x1E,0x38,0x00,0x00,0x0E,0x78,0x00,0x00,0x0F,
+    0x70,0x00,0x00,0x07,0xF0,0x00,0x80,0x07,0xE0,0x03,0xE0,0x03,0xC0,0x0F,0xF8,0x01,0x80,0xFF,0xFF,0x00,0x00,0xFE,0x3F,0x00,
+    0x00,0xF8,0x0F,0x00,0x49,0x02,0x85,0x00,0xE0,0x3F,0x00,0x00,0xF8,0xFF,0x01,0x00,0xFC,0xFF,0x01,0x00,0x7E,0xE0,0x01,0x00,
+    0x3E,0x80,0x01,0x00,0x1E,0x00,0x00,0x01,0x85,0x00,0xFE,0x0F,0x00,0x00,0xFE,0x7F,0x00,0x00,0xFE,0xFF,0x00,0x00,0x1E,0xF8,
+    0x01,0x00,0x1E,0xE0,0x03,0x00,0x1E,0xC0,0x03,0x00,0x84,0x00,0x3E,0xC0,0x03,0x00,0xFF,0xE0,0x03,0xC0,0xFF,0xFF,0x01,0xC0,
+    0x8F,0xFF,0x00,0x80,0x07,0x7E,0x00,0x5D,0x0F,0x97,0x40,0x00,0x02,0x00,0xE0,0x00,0x07,0x00,0xF0,0x81,0x0F,0x00,0xE0,0x03,
+    0x1F,0x00,0xC0,0x07,0x3E,0x00,0x80,0x0F,0x7C,0x00,0x00,0x1F,0xF8,0x00,0x00,0x3E,0xF0,0x01,0x00,0x7C,0xE0,0x03,0x00,0xF8,
+    0xC0,0x07,0x00,0xF0,0x81,0x0F,0x00,0xE0,0x01,0x0F,0x00,0xE0,0x03,0x1F,0x00,0xF0,0x81,0x0F,0x00,0xF8,0xC0,0x07,0x00,0x7C,
+    0xE0,0x03,0x00,0x3E,0xF0,0x01,0x00,0x1F,0xF8,0x00,0x80,0x0F,0x7C,0x00,0xC0,0x07,0x3E,0x00,0xE0,0x03,0x1F,0x00,0xF0,0x81,
+    0x0F,0x00,0xE0,0x00,0x07,0x00,0x40,0x00,0x02,0x00,0x4C,0x14,0x80,0xFC,0xFF,0xFF,0x3F,0x02,0x80,0x3C,0x00,0x00,0x00,0x07,
+    0x52,0x17,0x80,0xE0,0xFF,0xFF,0x07,0x02,0x58,0x02,0x95,0x00,0xC0,0x0F,0x00,0x00,0xF8,0x7F,0x00,0x00,0x3C,0xF0,0x00,0x00,
+    0x0E,0xC0,0x01,0x00,0xC7,0x9F,0x03,0x80,0xE3,0x1F,0x07,0x80,0x71,0x18,0x06,0x80,0x31,0x18,0x06,0xC0,0x30,0x18,0x0C,0xC0,
+    0x70,0x18,0x0C,0xC0,0xE0,0x1F,0x0C,0xC0,0xC0,0x1F,0x0C,0xC0,0xC0,0x19,0x0C,0xC0,0xE0,0x18,0x0C,0x80,0xE1,0x18,0x06,0x80,
+    0x71,0x18,0x06,0x80,0x73,0x18,0x07,0x00,0x3F,0x98,0x03,0x00,0x0E,0xC0,0x01,0x00,0x3C,0xF0,0x00,0x00,0xF8,0x7F,0x00,0x00,
+    0xC0,0x0F,0x00,0x5B,0x80,0xFF,0xFF,0xFF,0xFF,0x02,0x70,0x02,0x84,0x00,0xC0,0x07,0x00,0x00,0xE0,0x0F,0x00,0x00,0x70,0x1C,
+    0x00,0x00,0x38,0x38,0x00,0x00,0x18,0x30,0x00,0x01,0x83,0x00,0x38,0x38,0x00,0x00,0x70,0x1C,0x00,0x00,0xE0,0x0F,0x00,0x00,
+    0xC0,0x07,0x00,0x66,0x0D,0x80,0x00,0xC0,0x03,0x00,0x06,0x80,0xFC,0xFF,0xFF,0x3F,0x02,0x80,0x00,0xC0,0x03,0x00,0x06,0x43,
+    0x80,0xFC,0xFF,0xFF,0x3F,0x02,0x4A,0x02,0x85,0x00,0xF8,0x1F,0x00,0x00,0xFE,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x80,0x3F,0xF0,
+    0x00,0x80,0x0F,0x80,0x00,0x80,0x0F,0x00,0x00,0x01,0x88,0x00,0x3F,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,
+    0xF0,0x07,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0xF8,0x00,0x80,0xFF,0xFF,0x00,0x02,
+    0x5D,0x02,0x81,0x00,0xF8,0x0F,0x00,0x00,0xFF,0xFF,0x00,0x00,0x8A,0x80,0x1F,0xF0,0x00,0x80,0x0F,0x80,0x00,0x80,0x0F,0x00,
+    0x00,0x00,0x1F,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0xFC,0x1F,0x00,0x00,0xF0,0x1F,0x00,0x00,0xFC,0x1F,0x00,0x00,0x7F,0x00,
+    0x00,0x80,0x1F,0x00,0x00,0x80,0x0F,0x00,0x00,0x01,0x83,0x80,0x3F,0xF0,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFE,0xFF,0x00,0x00,
+    0xF0,0x1F,0x00,0x5D,0x85,0x00,0xF8,0x01,0x00,0x00,0xF0,0x03,0x00,0x00,0xE0,0x07,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x1F,
+    0x00,0x00,0x00,0x3E,0x00,0x6E,0x0D,0x80,0xF0,0x01,0xC0,0x07,0x11,0x80,0xF0,0x03,0xE0,0x07,0x00,0x88,0xF0,0x07,0xF0,0x07,
+    0xF0,0x0F,0xF8,0x07,0xF0,0x1F,0xFC,0x07,0xF0,0xFD,0xFF,0x07,0xF8,0xFD,0xFF,0x07,0xF8,0xF8,0xDF,0x07,0xF8,0xF0,0xCF,0x07,
+    0x00,0xE0,0xC3,0x07,0x00,0x00,0xC0,0x07,0x08,0x03,0x83,0xC0,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0x03,0xC0,0xFF,0xFF,0x07,0xC0,
+    0x01,0xFF,0x0F,0x00,0x80,0xC0,0x01,0xFF,0x1F,0x05,0x80,0xC0,0x01,0xFF,0x0F,0x00,0x85,0xC0,0x01,0xFF,0x07,0xC0,0x01,0xFF,
+    0x03,0xC0,0x01,0xFF,0x01,0xC0,0x01,0x7F,0x00,0xC0,0x01,0x1F,0x00,0xC0,0x01,0x07,0x00,0x19,0x42,0x18,0x80,0x00,0xE0,0x07,
+    0x00,0x04,0x55,0x29,0x86,0x00,0xC0,0x01,0x00,0x00,0x80,0x01,0x00,0x00,0x80,0x03,0x00,0x00,0xF0,0x03,0x00,0x00,0xF8,0x07,
+    0x00,0x00,0x7C,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x82,0x00,0x7C,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0xE0,0x07,0x00,0x02,
+    0x81,0x00,0xE0,0x03,0x00,0x00,0xE0,0x7F,0x00,0x01,0x80,0x00,0xE0,0x03,0x00,0x0E,0x5D,0x02,0x87,0x00,0xF0,0x0F,0x00,0x00,
+    0xFC,0x3F,0x00,0x00,0xFE,0x7F,0x00,0x00,0x1F,0xF8,0x00,0x80,0x0F,0xF0,0x01,0x80,0x07,0xE0,0x01,0xC0,0x07,0xE0,0x03,0xC0,
+    0x03,0xC0,0x03,0x05,0x85,0x80,0x07,0xE0,0x01,0x80,0x0F,0xF0,0x01,0x00,0x1F,0xF8,0x00,0x00,0xFE,0x7F,0x00,0x00,0xFC,0x3F,
+    0x00,0x00,0xF0,0x0F,0x00,0x5D,0x0F,0x97,0x00,0x40,0x00,0x02,0x00,0xE0,0x00,0x07,0x00,0xF0,0x81,0x0F,0x00,0xF8,0xC0,0x07,
+    0x00,0x7C,0xE0,0x03,0x00,0x3E,0xF0,0x01,0x00,0x1F,0xF8,0x00,0x80,0x0F,0x7C,0x00,0xC0,0x07,0x3E,0x00,0xE0,0x03,0x1F,0x00,
+    0xF0,0x81,0x0F,0x00,0xF8,0xC0,0x07,0x00,0xF0,0x80,0x07,0x00,0xE0,0x01,0x0F,0x00,0xE0,0x03,0x1F,0x00,0xC0,0x07,0x3E,0x00,
+    0x80,0x0F,0x7C,0x00,0x00,0x1F,0xF8,0x00,0x00,0x3E,0xF0,0x01,0x00,0x7C,0xE0,0x03,0x00,0xF8,0xC0,0x07,0x00,0xF0,0x81,0x0F,
+    0x00,0xE0,0x00,0x07,0x00,0x40,0x00,0x02,0x4C,0x02,0x81,0xC0,0x03,0x80,0x0F,0x80,0x07,0x80,0xFF,0x00,0x82,0x00,0x0F,0x80,
+    0xFF,0x00,0x0F,0x80,0x0F,0x00,0x1E,0x80,0x0F,0x00,0x80,0x00,0x3C,0x80,0x0F,0x00,0x81,0x00,0x78,0x80,0x0F,0x00,0xF0,0x80,
+    0x0F,0x00,0x80,0x00,0xE0,0x81,0x0F,0x00,0x80,0x00,0xC0,0x83,0x0F,0x00,0x80,0x00,0x80,0x87,0x0F,0x00,0x82,0x00,0x00,0x8F,
+    0x0F,0xF0,0x03,0x8F,0x0F,0xF0,0x07,0x1E,0x00,0x00,0x89,0xF0,0x0F,0x3C,0x00,0xF0,0x1D,0x3C,0x00,0xF0,0x39,0x78,0x00,0xF0,
+    0x71,0x78,0x00,0xF0,0xE1,0xF0,0x00,0xF0,0xE1,0xF1,0x00,0xF0,0xC1,0xE1,0x01,0xF0,0x81,0xE3,0x01,0xF0,0x01,0xC7,0x03,0xFE,
+    0xFF,0x87,0x07,0x00,0x82,0xFE,0xFF,0x07,0x0F,0xF0,0x01,0x00,0x0F,0xF0,0x01,0x00,0x1E,0x00,0x80,0xF0,0x01,0x00,0x3C,0x00,
+    0x80,0x00,0x00,0x00,0x78,0x49,0x02,0x81,0x80,0x07,0x80,0x0F,0x00,0x0F,0x80,0xFF,0x00,0x82,0x00,0x1E,0x80,0xFF,0x00,0x1E,
+    0x80,0x0F,0x00,0x3C,0x80,0x0F,0x00,0x80,0x00,0x78,0x80,0x0F,0x00,0x81,0x00,0xF0,0x80,0x0F,0x00,0xE0,0x81,0x0F,0x00,0x80,
+    0x00,0xC0,0x83,0x0F,0x00,0x80,0x00,0x80,0x87,0x0F,0x00,0x80,0x00,0x00,0x8F,0x0F,0x00,0x86,0x00,0x00,0x9E,0x0F,0xE0,0x1F,
+    0x9E,0x0F,0xF8,0x7F,0x3C,0x00,0xFC,0x7F,0x3C,0x00,0x7E,0x60,0x78,0x00,0x3E,0x00,0x78,0x00,0x3E,0x00,0xF0,0x00,0x00,0x89,
+    0x7E,0x00,0xE0,0x01,0xFC,0x00,0xE0,0x01,0xF8,0x01,0xC0,0x03,0xF0,0x03,0xC0,0x03,0xC0,0x07,0x80,0x07,0x80,0x0F,0x00,0x0F,
+    0x00,0x1E,0x00,0x0F,0x00,0x3C,0x00,0x1E,0x00,0x7C,0x00,0x1E,0xFE,0x7F,0x00,0x3C,0x00,0x80,0xFE,0x7F,0x00,0x78,0x00,0x80,
+    0x00,0x00,0x00,0xF0,0x49,0x02,0x8D,0x1F,0x00,0xE0,0x3F,0x3E,0x00,0xF8,0x7F,0x7C,0x00,0xFC,0x7F,0x7C,0x00,0x7E,0x60,0xF8,
+    0x00,0x3E,0x00,0xF0,0x01,0x3E,0x00,0xF0,0x01,0x3C,0x00,0xE0,0x03,0xFC,0x00,0xC0,0x07,0xF0,0x1F,0xC0,0x07,0xC0,0x1F,0x80,
+    0x0F,0xF0,0x1F,0x80,0x0F,0xFC,0x01,0x00,0x1F,0x7C,0x00,0x00,0x3E,0x3E,0x00,0x00,0x95,0x00,0x7C,0x3E,0x00,0x00,0xF8,0x7E,
+    0x60,0x00,0xF8,0xFC,0x7F,0x00,0xF0,0xF9,0x7F,0xF8,0xE1,0xC3,0x3F,0xF8,0xE3,0x03,0x00,0xF8,0xC3,0x07,0x00,0xF8,0x87,0x0F,
+    0x00,0xF8,0x8E,0x0F,0x00,0xF8,0x1C,0x1F,0x00,0xF8,0x38,0x3E,0x00,0xF8,0x70,0x3E,0x00,0xF8,0xF0,0x7C,0x00,0xF8,0xE0,0xF9,
+    0x00,0xF8,0xC0,0xF9,0x00,0xF8,0x80,0xF3,0x01,0xFF,0xFF,0xF3,0x01,0xFF,0xFF,0xE3,0x03,0xFF,0xFF,0xC3,0x07,0xF8,0x00,0xC0,
+    0x07,0xF8,0x00,0x80,0x0F,0xF8,0x00,0x00,0x1F,0x00,0x81,0xF8,0x00,0x00,0x3E,0x00,0x00,0x00,0x7C,0x49,0x0D,0x80,0x00,0xFC,
+    0x01,0x00,0x04,0x44,0x80,0x00,0xF8,0x00,0x00,0x02,0x8A,0x00,0xF0,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0xE0,0x03,0x00,0x00,
+    0xE0,0x07,0x00,0x00,0xC0,0x0F,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xF8,0x01,0x00,
+    0x00,0xE0,0x03,0x00,0x00,0xC0,0x07,0x00,0x80,0x00,0x00,0x80,0x0F,0x00,0x80,0xF0,0x00,0x80,0x0F,0x00,0x86,0xF0,0x00,0xC0,
+    0x0F,0xF0,0x00,0xE0,0x0F,0xF0,0x01,0xF8,0x07,0xF0,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0x01,0xF0,0xFF,0x7F,0x00,0x00,0xFF,0x0F,
+    0x00,0x40,0x85,0x00,0x00,0xFC,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x3F,0x00,0x00,0x80,0x0F,0x00,0x00,0xC0,0x07,0x00,0x00,
+    0xE0,0x03,0x00,0x42,0x80,0x00,0xE0,0x07,0x00,0x00,0x80,0x00,0xF0,0x0F,0x00,0x01,0x80,0x00,0xF8,0x1E,0x00,0x00,0x81,0x00,
+    0xFC,0x3E,0x00,0x00,0x7C,0x3C,0x00,0x00,0x83,0x00,0x3E,0x7C,0x00,0x00,0x3E,0x78,0x00,0x00,0x3F,0xF8,0x00,0x00,0x1F,0xF0,
+    0x00,0x00,0x87,0x80,0x0F,0xF0,0x01,0x80,0x0F,0xE0,0x01,0xC0,0x0F,0xE0,0x03,0xC0,0x07,0xE0,0x03,0xC0,0x07,0xC0,0x03,0xE0,
+    0x03,0xC0,0x07,0xE0,0xFF,0xFF,0x07,0xF0,0xFF,0xFF,0x0F,0x00,0x81,0xF8,0xFF,0xFF,0x1F,0xF8,0x00,0x00,0x1F,0x00,0x83,0xFC,
+    0x00,0x00,0x3E,0x7C,0x00,0x00,0x3E,0x7E,0x00,0x00,0x7E,0x3E,0x00,0x00,0x7C,0x00,0x80,0x3F,0x00,0x00,0xFC,0x4A,0x85,0x00,
+    0x7E,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0xE0,0x03,0x00,0x00,0xC0,0x07,0x00,0x00,0x80,0x0F,0x00,0x42,
+    0x80,0x00,0xE0,0x07,0x00,0x00,0x80,0x00,0xF0,0x0F,0x00,0x01,0x80,0x00,0xF8,0x1E,0x00,0x00,0x81,0x00,0xFC,0x3E,0x00,0x00,
+    0x7C,0x3C,0x00,0x00,0x83,0x00,0x3E,0x7C,0x00,0x00,0x3E,0x78,0x00,0x00,0x3F,0xF8,0x00,0x00,0x1F,0xF0,0x00,0x00,0x87,0x80,
+    0x0F,0xF0,0x01,0x80,0x0F,0xE0,0x01,0xC0,0x0F,0xE0,0x03,0xC0,0x07,0xE0,0x03,0xC0,0x07,0xC0,0x03,0xE0,0x03,0xC0,0x07,0xE0,
+    0xFF,0xFF,0x07,0xF0,0xFF,0xFF,0x0F,0x00,0x81,0xF8,0xFF,0xFF,0x1F,0xF8,0x00,0x00,0x1F,0x00,0x83,0xFC,0x00,0x00,0x3E,0x7C,
+    0x00,0x00,0x3E,0x7E,0x00,0x00,0x7E,0x3E,0x00,0x00,0x7C,0x00,0x80,0x3F,0x00,0x00,0xFC,0x4A,0x85,0x00,0xF8,0x0F,0x00,0x00,
+    0xFC,0x1F,0x00,0x00,0x7E,0x3F,0x00,0x00,0x3F,0x7E,0x00,0x80,0x0F,0xF8,0x00,0xC0,0x07,0xF0,0x01,0x42,0x80,0x00,0xE0,0x07,
+    0x00,0x00,0x80,0x00,0xF0,0x0F,0x00,0x01,0x80,0x00,0xF8,0x1E,0x00,0x00,0x81,0x00,0xFC,0x3E,0x00,0x00,0x7C,0x3C,0x00,0x00,
+    0x83,0x00,0x3E,0x7C,0x00,0x00,0x3E,0x78,0x00,0x00,0x3F,0xF8,0x00,0x00,0x1F,0xF0,0x00,0x00,0x87,0x80,0x0F,0xF0,0x01,0x80,
+    0x0F,0xE0,0x01,0xC0,0x0F,0xE0,0x03,0xC0,0x07,0xE0,0x03,0xC0,0x07,0xC0,0x03,0xE0,0x03,0xC0,0x07,0xE0,0xFF,0xFF,0x07,0xF0,
+    0xFF,0xFF,0x0F,0x00,0x81,0xF8,0xFF,0xFF,0x1F,0xF8,0x00,0x00,0x1F,0x00,0x83,0xFC,0x00,0x00,0x3E,0x7C,0x00,0x00,0x3E,0x7E,
+    0x00,0x00,0x7E,0x3E,0x00,0x00,0x7C,0x00,0x80,0x3F,0x00,0x00,0xFC,0x4A,0x85,0x00,0x07,0x3C,0x00,0x00,0x07,0xFF,0x00,0x00,
+    0xCF,0xFF,0x00,0x00,0xFE,0xE7,0x01,0x00,0xFE,0xC1,0x01,0x00,0x78,0xC0,0x01,0x42,0x80,0x00,0xE0,0x07,0x00,0x00,0x80,0x00,
+    0xF0,0x0F,0x00,0x01,0x80,0x00,0xF8,0x1E,0x00,0x00,0x81,0x00,0xFC,0x3E,0x00,0x00,0x7C,0x3C,0x00,0x00,0x83,0x00,0x3E,0x7C,
+    0x00,0x00,0x3E,0x78,0x00,0x00,0x3F,0xF8,0x00,0x00,0x1F,0xF0,0x00,0x00,0x87,0x80,0x0F,0xF0,0x01,0x80,0x0F,0xE0,0x01,0xC0,
+    0x0F,0xE0,0x03,0xC0,0x07,0xE0,0x03,0xC0,0x07,0xC0,0x03,0xE0,0x03,0xC0,0x07,0xE0,0xFF,0xFF,0x07,0xF0,0xFF,0xFF,0x0F,0x00,
+    0x81,0xF8,0xFF,0xFF,0x1F,0xF8,0x00,0x00,0x1F,0x00,0x83,0xFC,0x00,0x00,0x3E,0x7C,0x00,0x00,0x3E,0x7E,0x00,0x00,0x7E,0x3E,
+    0x00,0x00,0x7C,0x00,0x80,0x3F,0x00,0x00,0xFC,0x4A,0x80,0x00,0x0F,0xE0,0x01,0x02,0x44,0x80,0x00,0xE0,0x07,0x00,0x00,0x80,
+    0x00,0xF0,0x0F,0x00,0x01,0x80,0x00,0xF8,0x1E,0x00,0x00,0x81,0x00,0xFC,0x3E,0x00,0x00,0x7C,0x3C,0x00,0x00,0x83,0x00,0x3E,
+    0x7C,0x00,0x00,0x3E,0x78,0x00,0x00,0x3F,0xF8,0x00,0x00,0x1F,0xF0,0x00,0x00,0x87,0x80,0x0F,0xF0,0x01,0x80,0x0F,0xE0,0x01,
+    0xC0,0x0F,0xE0,0x03,0xC0,0x07,0xE0,0x03,0xC0,0x07,0xC0,0x03,0xE0,0x03,0xC0,0x07,0xE0,0xFF,0xFF,0x07,0xF0,0xFF,0xFF,0x0F,
+    0x00,0x81,0xF8,0xFF,0xFF,0x1F,0xF8,0x00,0x00,0x1F,0x00,0x83,0xFC,0x00,0x00,0x3E,0x7C,0x00,0x00,0x3E,0x7E,0x00,0x00,0x7E,
+    0x3E,0x00,0x00,0x7C,0x00,0x80,0x3F,0x00,0x00,0xFC,0x4A,0x83,0x00,0xC0,0x07,0x00,0x00,0xE0,0x0F,0x00,0x00,0x60,0x0C,0x00,
+    0x00,0x30,0x18,0x00,0x01,0x81,0x00,0x70,0x1C,0x00,0x00,0xE0,0x0F,0x00,0x00,0x81,0x00,0xC0,0x07,0x00,0x00,0xE0,0x0F,0x00,
+    0x01,0x80,0x00,0xF0,0x1F,0x00,0x00,0x8A,0x00,0xF8,0x3E,0x00,0x00,0xF8,0x3C,0x00,0x00,0xFC,0x3C,0x00,0x00,0x7C,0x7C,0x00,
+    0x00,0x7C,0x78,0x00,0x00,0x3E,0xF8,0x00,0x00,0x3E,0xF0,0x00,0x00,0x3F,0xF0,0x00,0x00,0x1F,0xF0,0x01,0x80,0x1F,0xE0,0x01,
+    0x80,0x0F,0xE0,0x03,0x00,0x84,0xC0,0x07,0xC0,0x03,0xC0,0x07,0xC0,0x07,0xE0,0x07,0xC0,0x07,0xE0,0xFF,0xFF,0x07,0xF0,0xFF,
+    0xFF,0x0F,0x00,0x86,0xF0,0xFF,0xFF,0x1F,0xF8,0x01,0x00,0x1F,0xF8,0x00,0x00,0x1F,0xFC,0x00,0x00,0x3E,0x7C,0x00,0x00,0x3E,
+    0x7E,0x00,0x00,0x7E,0x3E,0x00,0x00,0x7C,0x00,0x80,0x3F,0x00,0x00,0xFC,0x4A,0x08,0x81,0xFC,0xFF,0x01,0x00,0xFC,0xFF,0x03,
+    0x00,0x00,0x82,0xFC,0xFF,0x07,0x00,0x00,0xF8,0x07,0x00,0x00,0xF8,0x0F,0x00,0x00,0x80,0x00,0xF8,0x1E,0x00,0x01,0x80,0x00,
+    0xF8,0x3C,0x00,0x00,0x80,0x00,0xF8,0x78,0x00,0x00,0x82,0x00,0xF8,0xF0,0x00,0xF0,0xFF,0xF0,0x00,0xF0,0xFF,0xE0,0x01,0x00,
+    0x81,0xF0,0xFF,0xE0,0x03,0x00,0xF8,0xC0,0x03,0x00,0x82,0x00,0xF8,0x80,0x07,0x00,0xF8,0xFF,0x07,0x00,0xF8,0xFF,0x0F,0x00,
+    0x85,0x00,0xF8,0xFF,0x1F,0x00,0xF8,0x00,0x1E,0x00,0xF8,0x00,0x3E,0x00,0xF8,0x00,0x3C,0xFE,0xFF,0x00,0x3C,0xFE,0xFF,0x00,
+    0x78,0x00,0x80,0xFE,0xFF,0x00,0xF8,0x4A,0x07,0x8B,0xC0,0xFF,0x00,0x00,0xFC,0xFF,0x07,0x00,0xFC,0xFF,0x1F,0x00,0xFC,0xFF,
+    0x7F,0x00,0x7C,0x80,0xFF,0x00,0x0C,0x00,0xFC,0x01,0x00,0x00,0xF8,0x03,0x00,0x00,0xF0,0x03,0x00,0x00,0xE0,0x07,0x00,0x00,
+    0xC0,0x07,0x00,0x00,0xC0,0x0F,0x00,0x00,0x80,0x0F,0x00,0x80,0x00,0x00,0x00,0x1F,0x07,0x80,0x00,0x00,0x80,0x0F,0x00,0x90,
+    0x00,0x00,0xC0,0x0F,0x00,0x00,0xC0,0x07,0x00,0x00,0xE0,0x07,0x00,0x00,0xF0,0x03,0x00,0x00,0xF8,0x03,0x04,0x00,0xFE,0x01,
+    0x3C,0x80,0xFF,0x00,0xFC,0xFF,0x7F,0x00,0xFC,0xFF,0x1F,0x00,0xF8,0xFF,0x07,0x00,0x80,0xFF,0x00,0x00,0x00,0x60,0x00,0x00,
+    0x00,0xE0,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0x1F,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x82,0x00,0x1F,
+    0x00,0x00,0x00,0xFE,0x01,0x00,0x00,0xF8,0x01,0x00,0x85,0x00,0x00,0x3F,0x00,0x00,0x80,0x1F,0x00,0x00,0xC0,0x0F,0x00,0x00,
+    0xE0,0x03,0x00,0x00,0xF0,0x01,0x00,0x00,0xF8,0x00,0x00,0x42,0x80,0xF8,0xFF,0xFF,0x03,0x02,0x80,0x00,0x00,0xE0,0x03,0x08,
+    0x80,0xC0,0xFF,0xFF,0x03,0x02,0x80,0x00,0x00,0xE0,0x03,0x09,0x80,0xFC,0xFF,0xFF,0x03,0x02,0x4A,0x85,0x80,0x1F,0x00,0x00,
+    0x00,0x3F,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0xE0,0x03,0x00,0x42,0x80,0xF8,0xFF,
+    0xFF,0x03,0x02,0x80,0x00,0x00,0xE0,0x03,0x08,0x80,0xC0,0xFF,0xFF,0x03,0x02,0x80,0x00,0x00,0xE0,0x03,0x09,0x80,0xFC,0xFF,
+    0xFF,0x03,0x02,0x4A,0x85,0x00,0xFE,0x03,0x00,0x00,0xFF,0x07,0x00,0x80,0xDF,0x0F,0x00,0xC0,0x8F,0x1F,0x00,0xE0,0x03,0x3E,
+    0x00,0xF0,0x01,0x7C,0x00,0x42,0x80,0xF8,0xFF,0xFF,0x03,0x02,0x80,0x00,0x00,0xE0,0x03,0x08,0x80,0xC0,0xFF,0xFF,0x03,0x02,
+    0x80,0x00,0x00,0xE0,0x03,0x09,0x80,0xFC,0xFF,0xFF,0x03,0x02,0x4A,0x80,0x80,0x07,0xF0,0x00,0x02,0x44,0x80,0xF8,0xFF,0xFF,
+    0x03,0x02,0x80,0x00,0x00,0xE0,0x03,0x08,0x80,0xC0,0xFF,0xFF,0x03,0x02,0x80,0x00,0x00,0xE0,0x03,0x09,0x80,0xFC,0xFF,0xFF,
+    0x03,0x02,0x4A,0x85,0x00,0x00,0x7E,0x00,0x00,0x00,0x3F,0x00,0x00,0x80,0x1F,0x00,0x00,0xC0,0x07,0x00,0x00,0xE0,0x03,0x00,
+    0x00,0xF0,0x01,0x00,0x42,0x80,0xE0,0xFF,0xFF,0x0F,0x02,0x80,0x00,0xC0,0x07,0x00,0x17,0x80,0xE0,0xFF,0xFF,0x0F,0x02,0x4A,
+    0x85,0x00,0x7E,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0xE0,0x03,0x00,0x00,0xC0,0x07,0x00,0x00,0x80,0x0F,
+    0x00,0x42,0x80,0xE0,0xFF,0xFF,0x0F,0x02,0x80,0x00,0xC0,0x07,0x00,0x17,0x80,0xE0,0xFF,0xFF,0x0F,0x02,0x4A,0x85,0x00,0xF8,
+    0x0F,0x00,0x00,0xFC,0x1F,0x00,0x00,0x7E,0x3F,0x00,0x00,0x3F,0x7E,0x00,0x80,0x0F,0xF8,0x00,0xC0,0x07,0xF0,0x01,0x42,0x80,
+    0xE0,0xFF,0xFF,0x0F,0x02,0x80,0x00,0xC0,0x07,0x00,0x17,0x80,0xE0,0xFF,0xFF,0x0F,0x02,0x4A,0x80,0x00,0x0F,0xE0,0x01,0x02,
+    0x44,0x80,0xE0,0xFF,0xFF,0x0F,0x02,0x80,0x00,0xC0,0x07,0x00,0x17,0x80,0xE0,0xFF,0xFF,0x0F,0x02,0x4A,0x08,0x89,0x00,0xC0,
+    0xFF,0x1F,0x00,0xF8,0xFF,0x1F,0x00,0xFE,0xFF,0x1F,0x00,0xFF,0xFF,0x1F,0x80,0x7F,0x00,0x1F,0xC0,0x1F,0x00,0x1F,0xE0,0x07,
+    0x00,0x1F,0xE0,0x03,0x00,0x1F,0xF0,0x03,0x00,0x1F,0xF0,0x01,0x00,0x1F,0x00,0x81,0xF8,0x01,0x00,0x1F,0xF8,0x00,0x00,0x1F,
+    0x00,0x80,0xF8,0x00,0xFC,0xFF,0x02,0x80,0xF8,0x00,0x00,0x1F,0x01,0x80,0xF0,0x01,0x00,0x1F,0x01,0x80,0xE0,0x03,0x00,0x1F,
+    0x00,0x86,0xC0,0x07,0x00,0x1F,0xC0,0x1F,0x00,0x1F,0x80,0xFF,0x00,0x1F,0x00,0xFF,0xFF,0x1F,0x00,0xFE,0xFF,0x1F,0x00,0xF8,
+    0xFF,0x1F,0x00,0x80,0xFF,0x1F,0x4A,0x85,0x00,0x07,0x3C,0x00,0x00,0x07,0xFF,0x00,0x00,0xCF,0xFF,0x00,0x00,0xFE,0xE7,0x01,
+    0x00,0xFE,0xC1,0x01,0x00,0x78,0xC0,0x01,0x42,0x81,0xF0,0x00,0x80,0x0F,0xF0,0x00,0xC0,0x0F,0x00,0x80,0xF0,0x00,0xE0,0x0F,
+    0x00,0x81,0xF0,0x00,0xF0,0x0F,0xF0,0x00,0xF8,0x0F,0x00,0x81,0xF0,0x00,0xFC,0x0F,0xF0,0x00,0x7E,0x0F,0x00,0x81,0xF0,0x00,
+    0x3F,0x0F,0xF0,0x80,0x1F,0x0F,0x00,0x83,0xF0,0xC0,0x0F,0x0F,0xF0,0xC0,0x07,0x0F,0xF0,0xE0,0x07,0x0F,0xF0,0xF0,0x03,0x0F,
+    0x00,0x81,0xF0,0xF8,0x01,0x0F,0xF0,0xFC,0x00,0x0F,0x00,0x83,0xF0,0x7E,0x00,0x0F,0xF0,0x3E,0x00,0x0F,0xF0,0x3F,0x00,0x0F,
+    0xF0,0x1F,0x00,0x0F,0x00,0x81,0xF0,0x0F,0x00,0x0F,0xF0,0x07,0x00,0x0F,0x00,0x81,0xF0,0x03,0x00,0x0F,0xF0,0x01,0x00,0x0F,
+    0x00,0x4A,0x85,0x00,0x00,0x7E,0x00,0x00,0x00,0x3F,0x00,0x00,0x80,0x1F,0x00,0x00,0xC0,0x07,0x00,0x00,0xE0,0x03,0x00,0x00,
+    0xF0,0x01,0x00,0x41,0x87,0x00,0xF0,0x0F,0x00,0x00,0xFC,0x3F,0x00,0x00,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x01,0xC0,0x1F,0xF8,
+    0x03,0xE0,0x07,0xE0,0x07,0xE0,0x03,0xC0,0x07,0xF0,0x01,0x80,0x0F,0x00,0x80,0xF8,0x00,0x00,0x1F,0x01,0x80,0x7C,0x00,0x00,
+    0x3E,0x09,0x80,0xF8,0x00,0x00,0x1F,0x01,0x80,0xF0,0x01,0x80,0x0F,0x00,0x86,0xE0,0x03,0xC0,0x07,0xE0,0x07,0xE0,0x07,0xC0,
+    0x1F,0xF8,0x03,0x80,0xFF,0xFF,0x01,0x00,0xFF,0xFF,0x00,0x00,0xFC,0x3F,0x00,0x00,0xF0,0x0F,0x00,0x49,0x85,0x00,0x7E,0x00,
+    0x00,0x00,0xFC,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0xE0,0x03,0x00,0x00,0xC0,0x07,0x00,0x00,0x80,0x0F,0x00,0x41,0x87,0x00,
+    0xF0,0x0F,0x00,0x00,0xFC,0x3F,0x00,0x00,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x01,0xC0,0x1F,0xF8,0x03,0xE0,0x07,0xE0,0x07,0xE0,
+    0x03,0xC0,0x07,0xF0,0x01,0x80,0x0F,0x00,0x80,0xF8,0x00,0x00,0x1F,0x01,0x80,0x7C,0x00,0x00,0x3E,0x09,0x80,0xF8,0x00,0x00,
+    0x1F,0x01,0x80,0xF0,0x01,0x80,0x0F,0x00,0x86,0xE0,0x03,0xC0,0x07,0xE0,0x07,0xE0,0x07,0xC0,0x1F,0xF8,0x03,0x80,0xFF,0xFF,
+    0x01,0x00,0xFF,0xFF,0x00,0x00,0xFC,0x3F,0x00,0x00,0xF0,0x0F,0x00,0x49,0x85,0x00,0xF8,0x0F,0x00,0x00,0xFC,0x1F,0x00,0x00,
+    0x7E,0x3F,0x00,0x00,0x3F,0x7E,0x00,0x80,0x0F,0xF8,0x00,0xC0,0x07,0xF0,0x01,0x41,0x87,0x00,0xF0,0x0F,0x00,0x00,0xFC,0x3F,
+    0x00,0x00,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x01,0xC0,0x1F,0xF8,0x03,0xE0,0x07,0xE0,0x07,0xE0,0x03,0xC0,0x07,0xF0,0x01,0x80,
+    0x0F,0x00,0x80,0xF8,0x00,0x00,0x1F,0x01,0x80,0x7C,0x00,0x00,0x3E,0x09,0x80,0xF8,0x00,0x00,0x1F,0x01,0x80,0xF0,0x01,0x80,
+    0x0F,0x00,0x86,0xE0,0x03,0xC0,0x07,0xE0,0x07,0xE0,0x07,0xC0,0x1F,0xF8,0x03,0x80,0xFF,0xFF,0x01,0x00,0xFF,0xFF,0x00,0x00,
+    0xFC,0x3F,0x00,0x00,0xF0,0x0F,0x00,0x49,0x85,0x00,0x07,0x3C,0x00,0x00,0x07,0xFF,0x00,0x00,0xCF,0xFF,0x00,0x00,0xFE,0xE7,
+    0x01,0x00,0xFE,0xC1,0x01,0x00,0x78,0xC0,0x01,0x41,0x87,0x00,0xF0,0x0F,0x00,0x00,0xFC,0x3F,0x00,0x00,0xFF,0xFF,0x00,0x80,
+    0xFF,0xFF,0x01,0xC0,0x1F,0xF8,0x03,0xE0,0x07,0xE0,0x07,0xE0,0x03,0xC0,0x07,0xF0,0x01,0x80,0x0F,0x00,0x80,0xF8,0x00,0x00,
+    0x1F,0x01,0x80,0x7C,0x00,0x00,0x3E,0x09,0x80,0xF8,0x00,0x00,0x1F,0x01,0x80,0xF0,0x01,0x80,0x0F,0x00,0x86,0xE0,0x03,0xC0,
+    0x07,0xE0,0x07,0xE0,0x07,0xC0,0x1F,0xF8,0x03,0x80,0xFF,0xFF,0x01,0x00,0xFF,0xFF,0x00,0x00,0xFC,0x3F,0x00,0x00,0xF0,0x0F,
+    0x00,0x49,0x80,0x00,0x0F,0xE0,0x01,0x02,0x43,0x87,0x00,0xF0,0x0F,0x00,0x00,0xFC,0x3F,0x00,0x00,0xFF,0xFF,0x00,0x80,0xFF,
+    0xFF,0x01,0xC0,0x1F,0xF8,0x03,0xE0,0x07,0xE0,0x07,0xE0,0x03,0xC0,0x07,0xF0,0x01,0x80,0x0F,0x00,0x80,0xF8,0x00,0x00,0x1F,
+    0x01,0x80,0x7C,0x00,0x00,0x3E,0x09,0x80,0xF8,0x00,0x00,0x1F,0x01,0x80,0xF0,0x01,0x80,0x0F,0x00,0x86,0xE0,0x03,0xC0,0x07,
+    0xE0,0x07,0xE0,0x07,0xC0,0x1F,0xF8,0x03,0x80,0xFF,0xFF,0x01,0x00,0xFF,0xFF,0x00,0x00,0xFC,0x3F,0x00,0x00,0xF0,0x0F,0x00,
+    0x49,0x0D,0x8D,0x10,0x00,0x00,0x08,0x38,0x00,0x00,0x1C,0x7C,0x00,0x00,0x3E,0xF8,0x00,0x00,0x1F,0xF0,0x01,0x80,0x0F,0xE0,
+    0x03,0xC0,0x07,0xC0,0x07,0xE0,0x03,0x80,0x0F,0xF0,0x01,0x00,0x1F,0xF8,0x00,0x00,0x3E,0x7C,0x00,0x00,0x7C,0x3E,0x00,0x00,
+    0xF8,0x1F,0x00,0x00,0xF0,0x0F,0x00,0x00,0xE0,0x07,0x00,0x00,0x8C,0x00,0xF0,0x0F,0x00,0x00,0xF8,0x1F,0x00,0x00,0x7C,0x3E,
+    0x00,0x00,0x3E,0x7C,0x00,0x00,0x1F,0xF8,0x00,0x80,0x0F,0xF0,0x01,0xC0,0x07,0xE0,0x03,0xE0,0x03,0xC0,0x07,0xF0,0x01,0x80,
+    0x0F,0xF8,0x00,0x00,0x1F,0x7C,0x00,0x00,0x3E,0x38,0x00,0x00,0x1C,0x10,0x00,0x00,0x08,0x4A,0x07,0x87,0x3C,0xF0,0x0F,0x00,
+    0x78,0xFC,0x3F,0x00,0xF0,0xFF,0xFF,0x00,0xF0,0xFF,0xFF,0x01,0xE0,0x1F,0xF8,0x03,0xE0,0x07,0xE0,0x07,0xE0,0x03,0xC0,0x07,
+    0xF0,0x07,0x80,0x0F,0x00,0x86,0xF8,0x0F,0x00,0x1F,0xF8,0x1E,0x00,0x1F,0xF8,0x3C,0x00,0x1F,0x7C,0x3C,0x00,0x3E,0x7C,0x78,
+    0x00,0x3E,0x7C,0xF0,0x00,0x3E,0x7C,0xE0,0x01,0x3E,0x00,0x81,0x7C,0xC0,0x03,0x3E,0x7C,0x80,0x07,0x3E,0x00,0x86,0x7C,0x00,
+    0x0F,0x3E,0x7C,0x00,0x1E,0x3E,0x7C,0x00,0x3C,0x3E,0xF8,0x00,0x3C,0x1F,0xF8,0x00,0x78,0x1F,0xF8,0x00,0xF0,0x1F,0xF0,0x01,
+    0xE0,0x0F,0x00,0x86,0xE0,0x03,0xC0,0x07,0xE0,0x07,0xE0,0x07,0xC0,0x1F,0xF8,0x07,0x80,0xFF,0xFF,0x0F,0x00,0xFF,0xFF,0x0F,
+    0x00,0xFC,0x3F,0x1E,0x00,0xF0,0x0F,0x3C,0x49,0x85,0x00,0x00,0x7E,0x00,0x00,0x00,0x3F,0x00,0x00,0x80,0x1F,0x00,0x00,0xC0,
+    0x07,0x00,0x00,0xE0,0x03,0x00,0x00,0xF0,0x01,0x00,0x42,0x80,0xF8,0x00,0x80,0x0F,0x17,0x80,0xF0,0x01,0xC0,0x07,0x00,0x86,
+    0xF0,0x03,0xE0,0x07,0xE0,0x07,0xF0,0x03,0xE0,0x0F,0xF8,0x03,0xC0,0xFF,0xFF,0x01,0x80,0xFF,0xFF,0x00,0x00,0xFE,0x3F,0x00,
+    0x00,0xF8,0x0F,0x00,0x49,0x85,0x00,0x3F,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0xE0,
+    0x03,0x00,0x00,0xC0,0x07,0x00,0x42,0x80,0xF8,0x00,0x80,0x0F,0x17,0x80,0xF0,0x01,0xC0,0x07,0x00,0x86,0xF0,0x03,0xE0,0x07,
+    0xE0,0x07,0xF0,0x03,0xE0,0x0F,0xF8,0x03,0xC0,0xFF,0xFF,0x01,0x80,0xFF,0xFF,0x00,0x00,0xFE,0x3F,0x00,0x00,0xF8,0x0F,0x00,
+    0x49,0x85,0x00,0xF8,0x0F,0x00,0x00,0xFC,0x1F,0x00,0x00,0x7E,0x3F,0x00,0x00,0x3F,0x7E,0x00,0x80,0x0F,0xF8,0x00,0xC0,0x07,
+    0xF0,0x01,0x42,0x80,0xF8,0x00,0x80,0x0F,0x17,0x80,0xF0,0x01,0xC0,0x07,0x00,0x86,0xF0,0x03,0xE0,0x07,0xE0,0x07,0xF0,0x03,
+    0xE0,0x0F,0xF8,0x03,0xC0,0xFF,0xFF,0x01,0x80,0xFF,0xFF,0x00,0x00,0xFE,0x3F,0x00,0x00,0xF8,0x0F,0x00,0x49,0x80,0x80,0x07,
+    0xF0,0x00,0x02,0x44,0x80,0xF8,0x00,0x80,0x0F,0x17,0x80,0xF0,0x01,0xC0,0x07,0x00,0x86,0xF0,0x03,0xE0,0x07,0xE0,0x07,0xF0,
+    0x03,0xE0,0x0F,0xF8,0x03,0xC0,0xFF,0xFF,0x01,0x80,0xFF,0xFF,0x00,0x00,0xFE,0x3F,0x00,0x00,0xF8,0x0F,0x00,0x49,0x85,0x00,
+    0x3F,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0xE0,0x03,0x00,0x00,0xC0,0x07,0x00,0x42,
+    0x82,0x1F,0x00,0x00,0x7E,0x3E,0x00,0x00,0x3F,0x7C,0x00,0x80,0x1F,0x00,0x8D,0xF8,0x00,0xC0,0x0F,0xF0,0x01,0xC0,0x07,0xF0,
+    0x01,0xE0,0x07,0xE0,0x03,0xF0,0x03,0xC0,0x07,0xF0,0x01,0xC0,0x07,0xF8,0x01,0x80,0x0F,0xFC,0x00,0x00,0x1F,0x7C,0x00,0x00,
+    0x1F,0x7E,0x00,0x00,0x3E,0x3F,0x00,0x00,0x7C,0x1F,0x00,0x00,0xFC,0x1F,0x00,0x00,0xF8,0x0F,0x00,0x00,0xF0,0x07,0x00,0x00,
+    0x80,0x00,0xE0,0x03,0x00,0x0C,0x4A,0x08,0x80,0x00,0x00,0xE0,0x03,0x04,0x87,0x00,0xFE,0xFF,0x03,0xC0,0xFF,0xFF,0x03,0xE0,
+    0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0x03,0xF8,0x07,0xE0,0x03,0xF8,0x01,0xE0,0x03,0xFC,0x00,0xE0,0x03,0x7C,0x00,0xE0,0x03,0x03,
+    0x88,0xF8,0x00,0xE0,0x03,0xF8,0x01,0xE0,0x03,0xF8,0x03,0xE0,0x03,0xF0,0x1F,0xE0,0x03,0xE0,0xFF,0xFF,0x03,0x80,0xFF,0xFF,
+    0x03,0x00,0xFE,0xFF,0x03,0x00,0xF0,0xFF,0x03,0x00,0x00,0xE0,0x03,0x05,0x4A,0x87,0x00,0xC0,0x3F,0x00,0x00,0xF8,0xFF,0x00,
+    0x00,0xFC,0xFF,0x03,0x00,0xFE,0xFF,0x03,0x00,0x7F,0xE0,0x07,0x00,0x3F,0xC0,0x07,0x00,0x1F,0xC0,0x0F,0x00,0x1F,0x80,0x0F,
+    0x01,0x88,0x00,0x1E,0x80,0x0F,0x00,0x3E,0x80,0x0F,0x00,0x3C,0x80,0x0F,0x00,0x7C,0x80,0x0F,0x00,0xF8,0x80,0x0F,0x00,0xF0,
+    0x80,0x0F,0x00,0xF0,0x81,0x0F,0x00,0xE0,0x81,0x0F,0x00,0xE0,0x83,0x0F,0x00,0x8B,0x00,0xF0,0x83,0x0F,0x00,0xF8,0x83,0x0F,
+    0x00,0xFC,0x81,0x0F,0x00,0xFE,0x81,0x0F,0x00,0xFF,0x80,0x0F,0x80,0x7F,0x80,0x0F,0xC0,0x3F,0x80,0x0F,0xE0,0x1F,0x80,0x0F,
+    0xF0,0x0F,0x80,0x0F,0xF8,0x07,0x80,0x0F,0xF8,0x01,0x80,0x0F,0xFC,0x00,0x80,0x0F,0x00,0x80,0x7C,0x00,0x80,0x0F,0x02,0x85,
+    0xFC,0x00,0x84,0x0F,0xF8,0x81,0x87,0x0F,0xF8,0xFF,0x87,0x0F,0xF0,0xFF,0x87,0x0F,0xC0,0xFF,0x87,0x0F,0x00,0x7F,0x00,0x00,
+    0x49,0x87,0x00,0x00,0xF8,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x0F,0x00,0x00,0x80,
+    0x07,0x00,0x00,0xC0,0x03,0x00,0x00,0xE0,0x01,0x00,0x45,0x87,0x00,0xF0,0x3F,0x00,0x00,0xFC,0xFF,0x01,0x00,0xFE,0xFF,0x07,
+    0x00,0xFF,0xFF,0x07,0x00,0x7F,0xC0,0x07,0x80,0x1F,0x00,0x06,0x80,0x1F,0x00,0x00,0x80,0x0F,0x00,0x00,0x03,0x87,0x80,0xFF,
+    0x0F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0xFF,0x01,0x80,0x0F,0xF8,0x03,0x80,0x0F,0xC0,0x07,0x80,0x0F,0x80,0x0F,0x80,0x0F,
+    0x00,0x0F,0x80,0x0F,0x00,0x1F,0x01,0x86,0x80,0x1F,0x00,0x1F,0x80,0x3F,0x80,0x1F,0xC0,0xFF,0xC0,0x0F,0xFC,0xF7,0xFF,0x0F,
+    0xFC,0xE7,0xFF,0x07,0xFC,0x83,0xFF,0x03,0xF8,0x00,0xFE,0x00,0x49,0x87,0x00,0x1F,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x7C,
+    0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0xC0,0x03,0x00,0x00,0x80,0x07,0x00,0x45,0x87,
+    0x00,0xF0,0x3F,0x00,0x00,0xFC,0xFF,0x01,0x00,0xFE,0xFF,0x07,0x00,0xFF,0xFF,0x07,0x00,0x7F,0xC0,0x07,0x80,0x1F,0x00,0x06,
+    0x80,0x1F,0x00,0x00,0x80,0x0F,0x00,0x00,0x03,0x87,0x80,0xFF,0x0F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0xFF,0x01,0x80,0x0F,
+    0xF8,0x03,0x80,0x0F,0xC0,0x07,0x80,0x0F,0x80,0x0F,0x80,0x0F,0x00,0x0F,0x80,0x0F,0x00,0x1F,0x01,0x86,0x80,0x1F,0x00,0x1F,
+    0x80,0x3F,0x80,0x1F,0xC0,0xFF,0xC0,0x0F,0xFC,0xF7,0xFF,0x0F,0xFC,0xE7,0xFF,0x07,0xFC,0x83,0xFF,0x03,0xF8,0x00,0xFE,0x00,
+    0x49,0x87,0x00,0xE0,0x07,0x00,0x00,0xF0,0x0F,0x00,0x00,0xF8,0x1F,0x00,0x00,0x7C,0x3E,0x00,0x00,0x3C,0x3C,0x00,0x00,0x1E,
+    0x78,0x00,0x00,0x0F,0xF0,0x00,0x80,0x07,0xE0,0x01,0x45,0x87,0x00,0xF0,0x3F,0x00,0x00,0xFC,0xFF,0x01,0x00,0xFE,0xFF,0x07,
+    0x00,0xFF,0xFF,0x07,0x00,0x7F,0xC0,0x07,0x80,0x1F,0x00,0x06,0x80,0x1F,0x00,0x00,0x80,0x0F,0x00,0x00,0x03,0x87,0x80,0xFF,
+    0x0F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0xFF,0x01,0x80,0x0F,0xF8,0x03,0x80,0x0F,0xC0,0x07,0x80,0x0F,0x80,0x0F,0x80,0x0F,
+    0x00,0x0F,0x80,0x0F,0x00,0x1F,0x01,0x86,0x80,0x1F,0x00,0x1F,0x80,0x3F,0x80,0x1F,0xC0,0xFF,0xC0,0x0F,0xFC,0xF7,0xFF,0x0F,
+    0xFC,0xE7,0xFF,0x07,0xFC,0x83,0xFF,0x03,0xF8,0x00,0xFE,0x00,0x49,0x02,0x85,0x00,0x07,0x3C,0x00,0x00,0x07,0xFF,0x00,0x00,
+    0xCF,0xFF,0x00,0x00,0xFE,0xE7,0x01,0x00,0xFE,0xC1,0x01,0x00,0x78,0xC0,0x01,0x44,0x87,0x00,0xF0,0x3F,0x00,0x00,0xFC,0xFF,
+    0x01,0x00,0xFE,0xFF,0x07,0x00,0xFF,0xFF,0x07,0x00,0x7F,0xC0,0x07,0x80,0x1F,0x00,0x06,0x80,0x1F,0x00,0x00,0x80,0x0F,0x00,
+    0x00,0x03,0x87,0x80,0xFF,0x0F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0xFF,0x01,0x80,0x0F,0xF8,0x03,0x80,0x0F,0xC0,0x07,0x80,
+    0x0F,0x80,0x0F,0x80,0x0F,0x00,0x0F,0x80,0x0F,0x00,0x1F,0x01,0x86,0x80,0x1F,0x00,0x1F,0x80,0x3F,0x80,0x1F,0xC0,0xFF,0xC0,
+    0x0F,0xFC,0xF7,0xFF,0x0F,0xFC,0xE7,0xFF,0x07,0xFC,0x83,0xFF,0x03,0xF8,0x00,0xFE,0x00,0x49,0x03,0x80,0x00,0x0F,0x3C,0x00,
+    0x02,0x45,0x87,0x00,0xF0,0x3F,0x00,0x00,0xFC,0xFF,0x01,0x00,0xFE,0xFF,0x07,0x00,0xFF,0xFF,0x07,0x00,0x7F,0xC0,0x07,0x80,
+    0x1F,0x00,0x06,0x80,0x1F,0x00,0x00,0x80,0x0F,0x00,0x00,0x03,0x87,0x80,0xFF,0x0F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0xFF,
+    0x01,0x80,0x0F,0xF8,0x03,0x80,0x0F,0xC0,0x07,0x80,0x0F,0x80,0x0F,0x80,0x0F,0x00,0x0F,0x80,0x0F,0x00,0x1F,0x01,0x86,0x80,
+    0x1F,0x00,0x1F,0x80,0x3F,0x80,0x1F,0xC0,0xFF,0xC0,0x0F,0xFC,0xF7,0xFF,0x0F,0xFC,0xE7,0xFF,0x07,0xFC,0x83,0xFF,0x03,0xF8,
+    0x00,0xFE,0x00,0x49,0x83,0x00,0xC0,0x03,0x00,0x00,0xF0,0x0F,0x00,0x00,0x30,0x0C,0x00,0x00,0x18,0x18,0x00,0x02,0x82,0x00,
+    0x30,0x0C,0x00,0x00,0xF0,0x0F,0x00,0x00,0xC0,0x03,0x00,0x43,0x87,0x00,0xF0,0x3F,0x00,0x00,0xFC,0xFF,0x01,0x00,0xFE,0xFF,
+    0x07,0x00,0xFF,0xFF,0x07,0x00,0x7F,0xC0,0x07,0x80,0x1F,0x00,0x06,0x80,0x1F,0x00,0x00,0x80,0x0F,0x00,0x00,0x03,0x87,0x80,
+    0xFF,0x0F,0x00,0x80,0xFF,0x7F,0x00,0x80,0xFF,0xFF,0x01,0x80,0x0F,0xF8,0x03,0x80,0x0F,0xC0,0x07,0x80,0x0F,0x80,0x0F,0x80,
+    0x0F,0x00,0x0F,0x80,0x0F,0x00,0x1F,0x01,0x86,0x80,0x1F,0x00,0x1F,0x80,0x3F,0x80,0x1F,0xC0,0xFF,0xC0,0x0F,0xFC,0xF7,0xFF,
+    0x0F,0xFC,0xE7,0xFF,0x07,0xFC,0x83,0xFF,0x03,0xF8,0x00,0xFE,0x00,0x49,0x0D,0x88,0x80,0x0F,0xF8,0x03,0xE0,0x3F,0xFE,0x1F,
+    0xF0,0x7F,0xFF,0x1F,0xF8,0xFF,0xFF,0x1F,0xF8,0xF0,0x1F,0x18,0x7C,0xE0,0x0F,0x00,0x3C,0xE0,0x07,0x00,0x3C,0xC0,0x07,0x00,
+    0x3E,0xC0,0x07,0x00,0x02,0x86,0xFE,0xFF,0xFF,0x00,0xFE,0xFF,0xFF,0x03,0xFE,0xFF,0xFF,0x0F,0xFE,0xFF,0x87,0x1F,0x00,0xC0,
+    0x07,0x3F,0x00,0xC0,0x07,0x3E,0x00,0xC0,0x07,0x7C,0x01,0x80,0x00,0xE0,0x07,0x7C,0x00,0x85,0x00,0xF0,0x0F,0x7E,0x0E,0xF8,
+    0x1F,0x3F,0xFE,0xFF,0xFF,0x3F,0xFE,0xFF,0xFC,0x1F,0xFC,0x7F,0xF8,0x0F,0xE0,0x1F,0xE0,0x03,0x49,0x0D,0x88,0x00,0xFE,0x03,
+    0x00,0xE0,0xFF,0x1F,0x00,0xE0,0xFF,0x7F,0x00,0xE0,0xFF,0xFF,0x00,0xE0,0x01,0xFE,0x01,0x20,0x00,0xF8,0x03,0x00,0x00,0xF0,
+    0x03,0x00,0x00,0xE0,0x07,0x00,0x00,0xC0,0x07,0x00,0x81,0x00,0x00,0xC0,0x0F,0x00,0x00,0x80,0x0F,0x05,0x81,0x00,0x00,0xC0,
+    0x0F,0x00,0x00,0xC0,0x07,0x00,0x8D,0x00,0x00,0xE0,0x07,0x00,0x00,0xF0,0x03,0x10,0x00,0xF8,0x03,0xF0,0x00,0xFF,0x01,0xF0,
+    0xFF,0xFF,0x00,0xF0,0xFF,0x3F,0x00,0xF0,0xFF,0x1F,0x00,0x00,0xFF,0x03,0x00,0x00,0x80,0x01,0x00,0x00,0x80,0x03,0x00,0x00,
+    0xF0,0x03,0x00,0x00,0xF8,0x07,0x00,0x00,0x7C,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x82,0x00,0x7C,0x00,0x00,0x00,0xF8,0x07,
+    0x00,0x00,0xE0,0x07,0x00,0x87,0x00,0x00,0x7C,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x1F,0x00,0x00,0x80,0x0F,0x00,0x00,0x80,
+    0x07,0x00,0x00,0xC0,0x03,0x00,0x00,0xE0,0x01,0x00,0x00,0xF0,0x00,0x00,0x45,0x8A,0x00,0xF8,0x07,0x00,0x00,0xFE,0x1F,0x00,
+    0x00,0xFF,0x7F,0x00,0x80,0xFF,0xFF,0x00,0xC0,0x1F,0xFC,0x01,0xC0,0x07,0xF0,0x01,0xE0,0x03,0xE0,0x03,0xE0,0x03,0xC0,0x07,
+    0xE0,0x01,0xC0,0x07,0xF0,0x01,0xC0,0x07,0xF0,0x01,0x80,0x0F,0x00,0x80,0xF0,0xFF,0xFF,0x0F,0x02,0x80,0x00,0x00,0x80,0x0F,
+    0x01,0x80,0x00,0x00,0xC0,0x07,0x00,0x87,0x00,0x00,0xE0,0x07,0x00,0x00,0xF0,0x03,0x10,0x00,0xF8,0x03,0xF0,0x01,0xFE,0x01,
+    0xF0,0xFF,0xFF,0x00,0xF0,0xFF,0x7F,0x00,0xE0,0xFF,0x1F,0x00,0x00,0xFE,0x03,0x00,0x49,0x87,0x00,0x1F,0x00,0x00,0x00,0x3E,
+    0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0xC0,0x03,0x00,0x00,0x80,
+    0x07,0x00,0x45,0x8A,0x00,0xF8,0x07,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFF,0x7F,0x00,0x80,0xFF,0xFF,0x00,0xC0,0x1F,0xFC,0x01,
+    0xC0,0x07,0xF0,0x01,0xE0,0x03,0xE0,0x03,0xE0,0x03,0xC0,0x07,0xE0,0x01,0xC0,0x07,0xF0,0x01,0xC0,0x07,0xF0,0x01,0x80,0x0F,
+    0x00,0x80,0xF0,0xFF,0xFF,0x0F,0x02,0x80,0x00,0x00,0x80,0x0F,0x01,0x80,0x00,0x00,0xC0,0x07,0x00,0x87,0x00,0x00,0xE0,0x07,
+    0x00,0x00,0xF0,0x03,0x10,0x00,0xF8,0x03,0xF0,0x01,0xFE,0x01,0xF0,0xFF,0xFF,0x00,0xF0,0xFF,0x7F,0x00,0xE0,0xFF,0x1F,0x00,
+    0x00,0xFE,0x03,0x00,0x49,0x87,0x00,0xF0,0x03,0x00,0x00,0xF8,0x07,0x00,0x00,0xFC,0x0F,0x00,0x00,0x3E,0x1F,0x00,0x00,0x1E,
+    0x1E,0x00,0x00,0x0F,0x3C,0x00,0x80,0x07,0x78,0x00,0xC0,0x03,0xF0,0x00,0x45,0x8A,0x00,0xF8,0x07,0x00,0x00,0xFE,0x1F,0x00,
+    0x00,0xFF,0x7F,0x00,0x80,0xFF,0xFF,0x00,0xC0,0x1F,0xFC,0x01,0xC0,0x07,0xF0,0x01,0xE0,0x03,0xE0,0x03,0xE0,0x03,0xC0,0x07,
+    0xE0,0x01,0xC0,0x07,0xF0,0x01,0xC0,0x07,0xF0,0x01,0x80,0x0F,0x00,0x80,0xF0,0xFF,0xFF,0x0F,0x02,0x80,0x00,0x00,0x80,0x0F,
+    0x01,0x80,0x00,0x00,0xC0,0x07,0x00,0x87,0x00,0x00,0xE0,0x07,0x00,0x00,0xF0,0x03,0x10,0x00,0xF8,0x03,0xF0,0x01,0xFE,0x01,
+    0xF0,0xFF,0xFF,0x00,0xF0,0xFF,0x7F,0x00,0xE0,0xFF,0x1F,0x00,0x00,0xFE,0x03,0x00,0x49,0x03,0x80,0x80,0x07,0x1E,0x00,0x02,
+    0x45,0x8A,0x00,0xF8,0x07,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFF,0x7F,0x00,0x80,0xFF,0xFF,0x00,0xC0,0x1F,0xFC,0x01,0xC0,0x07,
+    0xF0,0x01,0xE0,0x03,0xE0,0x03,0xE0,0x03,0xC0,0x07,0xE0,0x01,0xC0,0x07,0xF0,0x01,0xC0,0x07,0xF0,0x01,0x80,0x0F,0x00,0x80,
+    0xF0,0xFF,0xFF,0x0F,0x02,0x80,0x00,0x00,0x80,0x0F,0x01,0x80,0x00,0x00,0xC0,0x07,0x00,0x87,0x00,0x00,0xE0,0x07,0x00,0x00,
+    0xF0,0x03,0x10,0x00,0xF8,0x03,0xF0,0x01,0xFE,0x01,0xF0,0xFF,0xFF,0x00,0xF0,0xFF,0x7F,0x00,0xE0,0xFF,0x1F,0x00,0x00,0xFE,
+    0x03,0x00,0x49,0x87,0x00,0x00,0x7C,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x1F,0x00,0x00,0x80,0x0F,0x00,0x00,0x80,0x07,0x00,
+    0x00,0xC0,0x03,0x00,0x00,0xE0,0x01,0x00,0x00,0xF0,0x00,0x00,0x45,0x80,0x00,0xF0,0xFF,0x07,0x02,0x80,0x00,0xF0,0x01,0x00,
+    0x16,0x4A,0x87,0x00,0x1F,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,
+    0xE0,0x01,0x00,0x00,0xC0,0x03,0x00,0x00,0x80,0x07,0x00,0x45,0x80,0x00,0xF0,0xFF,0x07,0x02,0x80,0x00,0xF0,0x01,0x00,0x16,
+    0x4A,0x87,0x00,0xF0,0x03,0x00,0x00,0xF8,0x07,0x00,0x00,0xFC,0x0F,0x00,0x00,0x3E,0x1F,0x00,0x00,0x1E,0x1E,0x00,0x00,0x0F,
+    0x3C,0x00,0x80,0x07,0x78,0x00,0xC0,0x03,0xF0,0x00,0x45,0x80,0x00,0xF0,0xFF,0x07,0x02,0x80,0x00,0xF0,0x01,0x00,0x16,0x4A,
+    0x03,0x80,0x00,0x0F,0x3C,0x00,0x02,0x45,0x80,0x00,0xF0,0xFF,0x07,0x02,0x80,0x00,0xF0,0x01,0x00,0x16,0x4A,0x00,0x95,0x00,
+    0x10,0x80,0x1F,0x00,0x70,0xF0,0x1F,0x00,0xF8,0xFC,0x1F,0x00,0xF0,0xFF,0x1F,0x00,0xE0,0xFF,0x01,0x00,0xC0,0x3F,0x00,0x00,
+    0xF0,0x3F,0x00,0x00,0xF8,0x7F,0x00,0x00,0xFC,0xF9,0x01,0x00,0xFE,0xE0,0x03,0x00,0x7F,0xC0,0x01,0x00,0x3F,0x00,0x00,0x80,
+    0x1F,0x00,0x00,0xC0,0xFF,0x0F,0x00,0xC0,0xFF,0x3F,0x00,0xE0,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0x01,0xE0,0x1F,0xF8,0x03,0xF0,
+    0x07,0xE0,0x07,0xF0,0x03,0xC0,0x07,0xF0,0x01,0xC0,0x0F,0xF8,0x01,0x80,0x0F,0x00,0x80,0xF8,0x00,0x00,0x1F,0x06,0x81,0xF0,
+    0x00,0x00,0x1F,0xF0,0x01,0x80,0x0F,0x00,0x87,0xE0,0x03,0xC0,0x0F,0xE0,0x03,0xC0,0x07,0xC0,0x07,0xE0,0x07,0xC0,0x1F,0xF8,
+    0x03,0x80,0xFF,0xFF,0x01,0x00,0xFF,0xFF,0x00,0x00,0xFC,0x3F,0x00,0x00,0xF0,0x0F,0x00,0x49,0x02,0x85,0x00,0x07,0x3C,0x00,
+    0x00,0x07,0xFF,0x00,0x00,0xCF,0xFF,0x00,0x00,0xFE,0xE7,0x01,0x00,0xFE,0xC1,0x01,0x00,0x78,0xC0,0x01,0x44,0x8A,0x00,0xFE,
+    0xC0,0x07,0x80,0xFF,0xC3,0x07,0xC0,0xFF,0xC7,0x07,0xE0,0xFF,0xCF,0x07,0xE0,0xFF,0xDF,0x07,0xF0,0x07,0xFF,0x07,0xF0,0x03,
+    0xFC,0x07,0xF0,0x01,0xF8,0x07,0xF0,0x01,0xF0,0x07,0xF0,0x01,0xE0,0x07,0xF0,0x01,0xC0,0x07,0x10,0x4A,0x87,0x00,0x00,0xF8,
+    0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x0F,0x00,0x00,0x80,0x07,0x00,0x00,0xC0,0x03,
+    0x00,0x00,0xE0,0x01,0x00,0x45,0x88,0x00,0xF0,0x0F,0x00,0x00,0xFE,0x7F,0x00,0x00,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x01,0xC0,
+    0x1F,0xF8,0x03,0xE0,0x07,0xE0,0x07,0xE0,0x03,0xC0,0x07,0xF0,0x03,0xC0,0x0F,0xF0,0x01,0x80,0x0F,0x00,0x80,0xF8,0x00,0x00,
+    0x1F,0x07,0x80,0xF0,0x01,0x80,0x0F,0x00,0x87,0xF0,0x03,0xC0,0x0F,0xE0,0x03,0xC0,0x07,0xE0,0x07,0xE0,0x07,0xC0,0x1F,0xF8,
+    0x03,0x80,0xFF,0xFF,0x01,0x00,0xFF,0xFF,0x00,0x00,0xFE,0x7F,0x00,0x00,0xF0,0x0F,0x00,0x49,0x87,0x00,0x3E,0x00,0x00,0x00,
+    0x7C,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0xE0,0x01,0x00,0x00,0xC0,0x03,0x00,0x00,0x80,0x07,0x00,0x00,
+    0x00,0x0F,0x00,0x45,0x88,0x00,0xF0,0x0F,0x00,0x00,0xFE,0x7F,0x00,0x00,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x01,0xC0,0x1F,0xF8,
+    0x03,0xE0,0x07,0xE0,0x07,0xE0,0x03,0xC0,0x07,0xF0,0x03,0xC0,0x0F,0xF0,0x01,0x80,0x0F,0x00,0x80,0xF8,0x00,0x00,0x1F,0x07,
+    0x80,0xF0,0x01,0x80,0x0F,0x00,0x87,0xF0,0x03,0xC0,0x0F,0xE0,0x03,0xC0,0x07,0xE0,0x07,0xE0,0x07,0xC0,0x1F,0xF8,0x03,0x80,
+    0xFF,0xFF,0x01,0x00,0xFF,0xFF,0x00,0x00,0xFE,0x7F,0x00,0x00,0xF0,0x0F,0x00,0x49,0x87,0x00,0xE0,0x07,0x00,0x00,0xF0,0x0F,
+    0x00,0x00,0xF8,0x1F,0x00,0x00,0x7C,0x3E,0x00,0x00,0x3C,0x3C,0x00,0x00,0x1E,0x78,0x00,0x00,0x0F,0xF0,0x00,0x80,0x07,0xE0,
+    0x01,0x45,0x88,0x00,0xF0,0x0F,0x00,0x00,0xFE,0x7F,0x00,0x00,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x01,0xC0,0x1F,0xF8,0x03,0xE0,
+    0x07,0xE0,0x07,0xE0,0x03,0xC0,0x07,0xF0,0x03,0xC0,0x0F,0xF0,0x01,0x80,0x0F,0x00,0x80,0xF8,0x00,0x00,0x1F,0x07,0x80,0xF0,
+    0x01,0x80,0x0F,0x00,0x87,0xF0,0x03,0xC0,0x0F,0xE0,0x03,0xC0,0x07,0xE0,0x07,0xE0,0x07,0xC0,0x1F,0xF8,0x03,0x80,0xFF,0xFF,
+    0x01,0x00,0xFF,0xFF,0x00,0x00,0xFE,0x7F,0x00,0x00,0xF0,0x0F,0x00,0x49,0x02,0x85,0x00,0x07,0x3C,0x00,0x00,0x07,0xFF,0x00,
+    0x00,0xCF,0xFF,0x00,0x00,0xFE,0xE7,0x01,0x00,0xFE,0xC1,0x01,0x00,0x78,0xC0,0x01,0x44,0x88,0x00,0xF0,0x0F,0x00,0x00,0xFE,
+    0x7F,0x00,0x00,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x01,0xC0,0x1F,0xF8,0x03,0xE0,0x07,0xE0,0x07,0xE0,0x03,0xC0,0x07,0xF0,0x03,
+    0xC0,0x0F,0xF0,0x01,0x80,0x0F,0x00,0x80,0xF8,0x00,0x00,0x1F,0x07,0x80,0xF0,0x01,0x80,0x0F,0x00,0x87,0xF0,0x03,0xC0,0x0F,
+    0xE0,0x03,0xC0,0x07,0xE0,0x07,0xE0,0x07,0xC0,0x1F,0xF8,0x03,0x80,0xFF,0xFF,0x01,0x00,0xFF,0xFF,0x00,0x00,0xFE,0x7F,0x00,
+    0x00,0xF0,0x0F,0x00,0x49,0x03,0x80,0x00,0x1E,0x78,0x00,0x02,0x45,0x88,0x00,0xF0,0x0F,0x00,0x00,0xFE,0x7F,0x00,0x00,0xFF,
+    0xFF,0x00,0x80,0xFF,0xFF,0x01,0xC0,0x1F,0xF8,0x03,0xE0,0x07,0xE0,0x07,0xE0,0x03,0xC0,0x07,0xF0,0x03,0xC0,0x0F,0xF0,0x01,
+    0x80,0x0F,0x00,0x80,0xF8,0x00,0x00,0x1F,0x07,0x80,0xF0,0x01,0x80,0x0F,0x00,0x87,0xF0,0x03,0xC0,0x0F,0xE0,0x03,0xC0,0x07,
+    0xE0,0x07,0xE0,0x07,0xC0,0x1F,0xF8,0x03,0x80,0xFF,0xFF,0x01,0x00,0xFF,0xFF,0x00,0x00,0xFE,0x7F,0x00,0x00,0xF0,0x0F,0x00,
+    0x49,0x0E,0x80,0x00,0xE0,0x07,0x00,0x04,0x44,0x80,0xF8,0xFF,0xFF,0x3F,0x02,0x45,0x80,0x00,0xE0,0x07,0x00,0x04,0x4A,0x0D,
+    0x8B,0x78,0xF0,0x0F,0x00,0xF0,0xFC,0x7F,0x00,0xE0,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0x01,0xC0,0x1F,0xF8,0x03,0xE0,0x07,0xE0,
+    0x07,0xE0,0x0F,0xC0,0x07,0xF0,0x0F,0xC0,0x0F,0xF0,0x1F,0x80,0x0F,0xF0,0x3D,0x80,0x0F,0xF8,0x78,0x00,0x1F,0xF8,0xF0,0x00,
+    0x1F,0x00,0x83,0xF8,0xE0,0x01,0x1F,0xF8,0xC0,0x03,0x1F,0xF8,0x80,0x07,0x1F,0xF8,0x00,0x0F,0x1F,0x00,0x8A,0xF8,0x00,0x1E,
+    0x1F,0xF0,0x01,0xBC,0x0F,0xF0,0x01,0xF8,0x0F,0xF0,0x03,0xF0,0x0F,0xE0,0x03,0xF0,0x07,0xE0,0x07,0xE0,0x07,0xC0,0x1F,0xF8,
+    0x03,0x80,0xFF,0xFF,0x03,0x00,0xFF,0xFF,0x07,0x00,0xFE,0x7F,0x0F,0x00,0xF0,0x0F,0x1E,0x49,0x87,0x00,0x00,0xF8,0x00,0x00,
+    0x00,0x7C,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x0F,0x00,0x00,0x80,0x07,0x00,0x00,0xC0,0x03,0x00,0x00,
+    0xE0,0x01,0x00,0x45,0x80,0xF0,0x01,0xC0,0x07,0x11,0x89,0xF0,0x03,0xC0,0x07,0xF0,0x07,0xC0,0x07,0xF0,0x0F,0xC0,0x07,0xF0,
+    0x1F,0xE0,0x07,0xF0,0x7F,0xF0,0x07,0xF0,0xFD,0xFF,0x03,0xF0,0xF9,0xFF,0x03,0xF0,0xF1,0xFF,0x01,0xF0,0xE1,0xFF,0x00,0x00,
+    0x80,0x3F,0x00,0x49,0x87,0x00,0x3E,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0xE0,0x01,
+    0x00,0x00,0xC0,0x03,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x0F,0x00,0x45,0x80,0xF0,0x01,0xC0,0x07,0x11,0x89,0xF0,0x03,0xC0,
+    0x07,0xF0,0x07,0xC0,0x07,0xF0,0x0F,0xC0,0x07,0xF0,0x1F,0xE0,0x07,0xF0,0x7F,0xF0,0x07,0xF0,0xFD,0xFF,0x03,0xF0,0xF9,0xFF,
+    0x03,0xF0,0xF1,0xFF,0x01,0xF0,0xE1,0xFF,0x00,0x00,0x80,0x3F,0x00,0x49,0x87,0x00,0xE0,0x07,0x00,0x00,0xF0,0x0F,0x00,0x00,
+    0xF8,0x1F,0x00,0x00,0x7C,0x3E,0x00,0x00,0x3C,0x3C,0x00,0x00,0x1E,0x78,0x00,0x00,0x0F,0xF0,0x00,0x80,0x07,0xE0,0x01,0x45,
+    0x80,0xF0,0x01,0xC0,0x07,0x11,0x89,0xF0,0x03,0xC0,0x07,0xF0,0x07,0xC0,0x07,0xF0,0x0F,0xC0,0x07,0xF0,0x1F,0xE0,0x07,0xF0,
+    0x7F,0xF0,0x07,0xF0,0xFD,0xFF,0x03,0xF0,0xF9,0xFF,0x03,0xF0,0xF1,0xFF,0x01,0xF0,0xE1,0xFF,0x00,0x00,0x80,0x3F,0x00,0x49,
+    0x03,0x80,0x00,0x0F,0x3C,0x00,0x02,0x45,0x80,0xF0,0x01,0xC0,0x07,0x11,0x89,0xF0,0x03,0xC0,0x07,0xF0,0x07,0xC0,0x07,0xF0,
+    0x0F,0xC0,0x07,0xF0,0x1F,0xE0,0x07,0xF0,0x7F,0xF0,0x07,0xF0,0xFD,0xFF,0x03,0xF0,0xF9,0xFF,0x03,0xF0,0xF1,0xFF,0x01,0xF0,
+    0xE1,0xFF,0x00,0x00,0x80,0x3F,0x00,0x49,0x87,0x00,0x1F,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0xF8,0x00,
+    0x00,0x00,0xF0,0x00,0x00,0x00,0xE0,0x01,0x00,0x00,0xC0,0x03,0x00,0x00,0x80,0x07,0x00,0x45,0x95,0x3E,0x00,0x00,0x3F,0x3C,
+    0x00,0x00,0x1F,0x7C,0x00,0x80,0x1F,0x78,0x00,0x80,0x0F,0xF8,0x00,0xC0,0x0F,0xF0,0x00,0xC0,0x0F,0xF0,0x01,0xC0,0x07,0xF0,
+    0x01,0xE0,0x07,0xE0,0x03,0xE0,0x03,0xE0,0x03,0xF0,0x03,0xC0,0x07,0xF0,0x01,0xC0,0x07,0xF8,0x01,0x80,0x07,0xF8,0x00,0x80,
+    0x0F,0xFC,0x00,0x00,0x0F,0x7C,0x00,0x00,0x1F,0x7E,0x00,0x00,0x1E,0x7E,0x00,0x00,0x3E,0x3E,0x00,0x00,0x3C,0x3F,0x00,0x00,
+    0x7C,0x1F,0x00,0x00,0xFC,0x1F,0x00,0x00,0xF8,0x0F,0x00,0x00,0x80,0x00,0xF0,0x07,0x00,0x00,0x80,0x00,0xE0,0x03,0x00,0x00,
+    0x84,0x00,0xC0,0x03,0x00,0x00,0xC0,0x07,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0x1F,0x00,0x00,0x84,0x00,
+    0x00,0x7E,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFC,0x1F,0x00,0x00,0xF0,0x1F,0x00,0x00,0xC0,0x1F,0x40,0x00,0x80,0x00,0x00,
+    0xC0,0x07,0x0B,0x87,0x00,0xFC,0xC0,0x07,0x00,0xFF,0xC3,0x07,0x80,0xFF,0xC7,0x07,0xC0,0xFF,0xCF,0x07,0xE0,0x0F,0xDF,0x07,
+    0xE0,0x03,0xFC,0x07,0xF0,0x01,0xF0,0x07,0xF0,0x01,0xE0,0x07,0x00,0x80,0xF8,0x00,0xC0,0x07,0x08,0x80,0xF0,0x01,0xC0,0x07,
+    0x00,0x88,0xF0,0x03,0xC0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x07,0xF8,0x07,0xC0,0x1F,0xFC,0x07,0x80,0xFF,0xFF,0x07,0x00,0xFF,
+    0xDF,0x07,0x00,0xFE,0xCF,0x07,0x00,0xF8,0xC3,0x07,0x00,0x00,0xC0,0x07,0x07,0x40,0x03,0x80,0x00,0x0F,0x3C,0x00,0x02,0x45,
+    0x95,0x3E,0x00,0x00,0x3F,0x3C,0x00,0x00,0x1F,0x7C,0x00,0x80,0x1F,0x78,0x00,0x80,0x0F,0xF8,0x00,0xC0,0x0F,0xF0,0x00,0xC0,
+    0x0F,0xF0,0x01,0xC0,0x07,0xF0,0x01,0xE0,0x07,0xE0,0x03,0xE0,0x03,0xE0,0x03,0xF0,0x03,0xC0,0x07,0xF0,0x01,0xC0,0x07,0xF8,
+    0x01,0x80,0x07,0xF8,0x00,0x80,0x0F,0xFC,0x00,0x00,0x0F,0x7C,0x00,0x00,0x1F,0x7E,0x00,0x00,0x1E,0x7E,0x00,0x00,0x3E,0x3E,
+    0x00,0x00,0x3C,0x3F,0x00,0x00,0x7C,0x1F,0x00,0x00,0xFC,0x1F,0x00,0x00,0xF8,0x0F,0x00,0x00,0x80,0x00,0xF0,0x07,0x00,0x00,
+    0x80,0x00,0xE0,0x03,0x00,0x00,0x84,0x00,0xC0,0x03,0x00,0x00,0xC0,0x07,0x00,0x00,0x80,0x07,0x00,0x00,0x80,0x0F,0x00,0x00,
+    0x00,0x1F,0x00,0x00,0x84,0x00,0x00,0x7E,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0xFC,0x1F,0x00,0x00,0xF0,0x1F,0x00,0x00,0xC0,
+    0x1F,0x40,
+};
+
+static const FONT_PACKED font_32x53 = { 32, 53, 6, font_ranges_32x53, font_offsets_32x53, font_data_32x53 };
+
+static const FONT_PACKED * const fonts[14] =
+{
+    &font_05x08,
+    &font_05x12,
+    &font_06x08,
+    &font_06x10,
+    &font_08x08,
+    &font_08x12,
+    &font_08x14,
+    &font_10x16,
+    &font_12x16,
+    &font_12x20,
+    &font_16x26,
+    &font_22x36,
+    &font_24x40,
+    &font_32x53,
+};
@@ -27,13 +27,9 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
-#ifdef unix
-#define TFT_HEIGHT  150
-#define TFT_WIDTH   150
-#else
 #include "tft.h"
-#endif
 
 #if defined ILI9341 || defined SSD1963
 
@@ -55,230 +51,440 @@
 #define FONT_32x53          13
 #define N_FONTS             14
 
-#include "font-iso88591-05x08.h"
-#include "font-iso88591-05x12.h"
-#include "font-iso88591-06x08.h"
-#include "font-iso88591-06x10.h"
-#include "font-iso88591-08x08.h"
-#include "font-iso88591-08x12.h"
-#include "font-iso88591-08x14.h"
-#include "font-iso88591-10x16.h"
-#include "font-iso88591-12x16.h"
-#include "font-iso88591-12x20.h"
-#include "font-iso88591-16x26.h"
-#include "font-iso88591-22x36.h"
-#include "font-iso88591-24x40.h"
-#include "font-iso88591-32x53.h"
-
-static const unsigned char * fonts[N_FONTS] =
-{
-    &font_05x08[0][0],
-    &font_05x12[0][0],
-    &font_06x08[0][0],
-    &font_06x10[0][0],
-    &font_08x08[0][0],
-    &font_08x12[0][0],
-    &font_08x14[0][0],
-    &font_10x16[0][0],
-    &font_12x16[0][0],
-    &font_12x20[0][0],
-    &font_16x26[0][0],
-    &font_22x36[0][0],
-    &font_24x40[0][0],
-    &font_32x53[0][0],
-};
-
-static const uint_fast16_t font_widths[N_FONTS] =
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * compressed fonts, see fontgen.c for the format. Codes not covered by a range are blank.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+typedef struct
 {
-    FONT_WIDTH_05x08,
-    FONT_WIDTH_05x12,
-    FONT_WIDTH_06x08,
-    FONT_WIDTH_06x10,
-    FONT_WIDTH_08x08,
-    FONT_WIDTH_08x12,
-    FONT_WIDTH_08x14,
-    FONT_WIDTH_10x16,
-    FONT_WIDTH_12x16,
-    FONT_WIDTH_12x20,
-    FONT_WIDTH_16x26,
-    FONT_WIDTH_22x36,
-    FONT_WIDTH_24x40,
-    FONT_WIDTH_32x53,
-};
-
-static const uint_fast16_t font_heights[N_FONTS] =
+    uint8_t             first;                                                  // first code of range
+    uint8_t             last;                                                   // last code of range
+    uint16_t            index;                                                  // index of first code in offsets
+} FONT_RANGE;
+
+typedef struct
 {
-    FONT_HEIGHT_05x08,
-    FONT_HEIGHT_05x12,
-    FONT_HEIGHT_06x08,
-    FONT_HEIGHT_06x10,
-    FONT_HEIGHT_08x08,
-    FONT_HEIGHT_08x12,
-    FONT_HEIGHT_08x14,
-    FONT_HEIGHT_10x16,
-    FONT_HEIGHT_12x16,
-    FONT_HEIGHT_12x20,
-    FONT_HEIGHT_16x26,
-    FONT_HEIGHT_22x36,
-    FONT_HEIGHT_24x40,
-    FONT_HEIGHT_32x53,
-};
-
-#define BYTES_PER_ROW   ((font_widths[current_font] - 1) / 8 + 1)
+    uint8_t             width;
+    uint8_t             height;
+    uint8_t             n_ranges;
+    const FONT_RANGE *  ranges;
+    const uint16_t *    offsets;                                                // NULL: plain glyphs, not packed
+    const uint8_t *     data;
+} FONT_PACKED;
+
+#define FONT_TOKEN_BLANK        0x40
+#define FONT_TOKEN_LITERAL      0x80
+
+#include "font-packed.h"
+
+#define BYTES_PER_ROW   ((fonts[current_font]->width - 1) / 8 + 1)
 #define BITS_PER_ROW    (8 * BYTES_PER_ROW)
 
 static int      current_font = 0;
 
-#ifdef unix // some test functions
+void
+set_font (int font)
+{
+    if (font >= 0 && font < N_FONTS)
+    {
+        current_font = font;
+    }
+}
 
-static char screen[TFT_HEIGHT][TFT_WIDTH];
+int
+get_font (void)
+{
+    return current_font;
+}
 
-static int  last_row_used = 0;
+int
+font_width (void)
+{
+    return fonts[current_font]->width;
+}
 
-void
-tft_show_screen (void)
+int
+number_of_fonts (void)
+{
+    return N_FONTS;
+}
+
+int
+font_height (void)
+{
+    return fonts[current_font]->height;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * glyph cache: glyphs expanded to RGB565 for the current font and fg/bg colors, LRU replacement
+ *
+ * The pool is allocated on first use. It must be DMA reachable, so it is taken from the heap, not from CCM RAM.
+ * A changed font or color pair invalidates all slots. If less than 2 glyphs fit into the pool, the cache is not used.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#define FONT_CACHE_BYTES        12288                                           // 64 glyphs 8x12 ... 3 glyphs 32x53
+#define FONT_CACHE_MAX_SLOTS    64
+#define FONT_CACHE_NONE         0xFF
+
+static uint16_t *               font_cache;                                     // pool
+static uint_fast16_t            font_cache_slots;                               // slots for current font, 0: cache not usable
+static int                      font_cache_font = -1;                           // font of cached glyphs
+static uint_fast16_t            font_cache_fcolor;                              // colors of cached glyphs
+static uint_fast16_t            font_cache_bcolor;
+static uint8_t                  font_cache_slot[256];                           // slot of character or FONT_CACHE_NONE
+static uint8_t                  font_cache_char[FONT_CACHE_MAX_SLOTS];          // character in slot
+static uint32_t                 font_cache_used[FONT_CACHE_MAX_SLOTS];          // time of last use, 0: empty
+static uint32_t                 font_cache_tick;
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: get row of glyph, pixel xx is bit (BITS_PER_ROW - 1 - xx)
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint32_t
+font_row (const unsigned char * glyph, uint_fast8_t bytes_per_row)
+{
+    uint32_t        font_line = 0;
+    uint_fast8_t    ii;
+
+    for (ii = 0; ii < bytes_per_row; ii++)
+    {
+        font_line |= glyph[ii] << (ii * 8);
+    }
+
+    return font_line;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: glyph decoder, delivers the rows of a compressed glyph one by one without copying the glyph to RAM
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+typedef struct
 {
-    int y;
-    int x;
+    const uint8_t *     p;                                                      // next token or literal row
+    uint_fast8_t        literal;                                                // literal rows left
+    uint_fast8_t        repeat;                                                 // repetitions of row left
+    uint32_t            row;                                                    // current row
+} FONT_DECODER;
+
+static void
+font_decode_start (FONT_DECODER * d, unsigned char ch)
+{
+    const FONT_PACKED * font = fonts[current_font];
+    uint_fast8_t        r;
+
+    d->literal  = 0;
+    d->repeat   = 0xFF;                                                         // blank glyph: repeat blank row
+    d->row      = 0;
 
-    for (y = 0; y < last_row_used; y++)
+    for (r = 0; r < font->n_ranges; r++)
     {
-        for (x = 0; x < TFT_WIDTH; x++)
+        if (ch >= font->ranges[r].first && ch <= font->ranges[r].last)
         {
-            if (screen[y][x])
+            uint_fast16_t idx = font->ranges[r].index + (ch - font->ranges[r].first);
+
+            d->repeat = 0;
+
+            if (font->offsets)
             {
-                putchar (screen[y][x]);
+                d->p = font->data + font->offsets[idx];
             }
             else
             {
-                putchar (' ');
+                d->p        = font->data + idx * BYTES_PER_ROW * font->height;
+                d->literal  = font->height;
             }
+            break;
         }
-        putchar ('\n');
     }
 }
 
-void
-tft_draw_pixel (int x, int y, int color565)
+static uint32_t
+font_decode_row (FONT_DECODER * d, uint_fast8_t bytes_per_row)
 {
-    if (x >= 0 && y >= 0 && x < TFT_WIDTH && y < TFT_HEIGHT)
+    uint_fast8_t    token;
+
+    if (d->repeat)
+    {
+        d->repeat--;
+    }
+    else if (d->literal)
+    {
+        d->row = font_row (d->p, bytes_per_row);
+        d->p += bytes_per_row;
+        d->literal--;
+    }
+    else
     {
-        if (color565)
+        token = *d->p++;
+
+        if (token & FONT_TOKEN_LITERAL)
         {
-            screen[y][x] = 'X';
+            d->literal  = token & 0x7F;
+            d->row      = font_row (d->p, bytes_per_row);
+            d->p += bytes_per_row;
         }
         else
         {
-            screen[y][x] = ' ';
+            if (token & FONT_TOKEN_BLANK)
+            {
+                d->row = 0;
+            }
+            d->repeat = token & 0x3F;
         }
     }
 
-    if (last_row_used < y)
-    {
-        last_row_used = y;
-    }
+    return d->row;
 }
-#endif // unix
 
-void
-set_font (int font)
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: expand glyph to RGB565
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+font_expand (unsigned char ch, uint16_t * buf, uint_fast16_t fcolor565, uint_fast16_t bcolor565)
 {
-    if (font >= 0 && font < N_FONTS)
+    FONT_DECODER            decoder;
+    uint_fast8_t            bytes_per_row   = BYTES_PER_ROW;
+    uint32_t                first_bit       = 1UL << (BITS_PER_ROW - 1);
+    uint_fast16_t           width           = fonts[current_font]->width;
+    uint_fast16_t           yy;
+    uint_fast16_t           xx;
+    uint32_t                font_line;
+    uint32_t                mask;
+
+    font_decode_start (&decoder, ch);
+
+    for (yy = 0; yy < fonts[current_font]->height; yy++)
     {
-        current_font = font;
+        font_line = font_decode_row (&decoder, bytes_per_row);
+
+        for (xx = 0, mask = first_bit; xx < width; xx++, mask >>= 1)
+        {
+            *buf++ = (font_line & mask) ? fcolor565 : bcolor565;
+        }
     }
 }
 
-int
-font_width (void)
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: get expanded glyph from cache, expand it if necessary. Returns NULL if the cache is not usable.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint16_t *
+font_cache_get (unsigned char ch, uint_fast16_t fcolor565, uint_fast16_t bcolor565)
 {
-    return font_widths[current_font];
-}
+    uint_fast16_t   glyph_size = fonts[current_font]->width * fonts[current_font]->height;
+    uint_fast16_t   slot;
+    uint_fast16_t   idx;
 
-int
-number_of_fonts (void)
-{
-    return N_FONTS;
-}
+    if (font_cache_font != current_font || font_cache_fcolor != fcolor565 || font_cache_bcolor != bcolor565)
+    {
+        if (! font_cache)
+        {
+            font_cache = malloc (FONT_CACHE_BYTES);
+        }
 
-int
-font_height (void)
-{
-    return font_heights[current_font];
+        font_cache_slots = font_cache ? FONT_CACHE_BYTES / (glyph_size * sizeof (uint16_t)) : 0;
+
+        if (font_cache_slots > FONT_CACHE_MAX_SLOTS)
+        {
+            font_cache_slots = FONT_CACHE_MAX_SLOTS;
+        }
+        else if (font_cache_slots < 2)                                                  // the slot being sent by DMA must not be reused
+        {
+            font_cache_slots = 0;
+        }
+
+        memset (font_cache_slot, FONT_CACHE_NONE, sizeof (font_cache_slot));
+        memset (font_cache_used, 0, sizeof (font_cache_used));
+        font_cache_font     = current_font;
+        font_cache_fcolor   = fcolor565;
+        font_cache_bcolor   = bcolor565;
+    }
+
+    if (font_cache_slots == 0)
+    {
+        return (uint16_t *) NULL;
+    }
+
+    slot = font_cache_slot[ch];
+
+    if (slot == FONT_CACHE_NONE)
+    {
+        slot = 0;
+
+        for (idx = 1; idx < font_cache_slots; idx++)                                    // least recently used or empty slot
+        {
+            if (font_cache_used[idx] < font_cache_used[slot])
+            {
+                slot = idx;
+            }
+        }
+
+        if (font_cache_used[slot])
+        {
+            font_cache_slot[font_cache_char[slot]] = FONT_CACHE_NONE;
+        }
+
+        tft_dma_wait ();                                                                // slot may still be sent after invalidation
+        font_expand (ch, font_cache + slot * glyph_size, fcolor565, bcolor565);
+        font_cache_slot[ch]     = slot;
+        font_cache_char[slot]   = ch;
+    }
+
+    font_cache_used[slot] = ++font_cache_tick;
+    return font_cache + slot * glyph_size;
 }
 
-void
-draw_letter (unsigned char ch, uint_fast16_t y, uint_fast16_t x, uint_fast16_t fcolor565, uint_fast16_t bcolor565)
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: stream a run of n glyphs row by row into one window, used if the cache is not usable.
+ * A decoder is needed per glyph, so longer runs are split into windows of FONT_STREAM_MAX glyphs.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#define FONT_STREAM_MAX         32
+
+static void
+font_stream_run (const unsigned char * s, uint_fast16_t n, uint_fast16_t y, uint_fast16_t x, uint_fast16_t fcolor565, uint_fast16_t bcolor565)
 {
+    FONT_DECODER    decoder[FONT_STREAM_MAX];
+    uint_fast8_t    bytes_per_row   = BYTES_PER_ROW;
+    uint32_t        first_bit       = 1UL << (BITS_PER_ROW - 1);
+    uint_fast16_t   width           = fonts[current_font]->width;
+    uint_fast16_t   height          = fonts[current_font]->height;
+    uint_fast16_t   cnt;
     uint_fast16_t   yy;
     uint_fast16_t   xx;
-    uint_fast16_t   idx;
+    uint_fast16_t   i;
     uint32_t        font_line;
-    uint_fast8_t    ii;
-    uint_fast8_t    bytes_per_row;
-    uint_fast8_t    bits_per_row;
-    uint_fast16_t   current_row;
-    uint_fast16_t   py;
+    uint32_t        mask;
 
-    bytes_per_row   = BYTES_PER_ROW;
-    bits_per_row    = BITS_PER_ROW;
-    current_row     = bytes_per_row * font_heights[current_font] * ch;
-    idx             = 0;
-
-    if (y + font_heights[current_font] < TFT_HEIGHT && x + font_widths[current_font] < TFT_WIDTH)
+    while (n > 0)
     {
-        for (yy = 0; yy < font_heights[current_font]; yy++)
-        {
-            font_line = 0;
+        cnt = (n > FONT_STREAM_MAX) ? FONT_STREAM_MAX : n;
 
-            for (ii = 0; ii < bytes_per_row; ii++)
-            {
-                font_line |= fonts[current_font][current_row + idx] << (ii * 8);
-                idx++;
-            }
+        for (i = 0; i < cnt; i++)
+        {
+            font_decode_start (decoder + i, s[i]);
+        }
 
-            py = y + yy;
+        tft_set_area (x, x + cnt * width - 1, y, y + height - 1);
 
-#ifdef unix
-            for (xx = 0, ii = bits_per_row - 1; xx < font_widths[current_font]; xx++, ii--)
+        for (yy = 0; yy < height; yy++)
+        {
+            for (i = 0; i < cnt; i++)
             {
-                if (font_line & (1 << ii))
-                {
-                    tft_draw_pixel (x + xx, py, fcolor565);
-                }
-                else
-                {
-                    tft_draw_pixel (x + xx, py, bcolor565);
-                }
-            }
-#else // faster
-            tft_set_area (x, x + font_widths[current_font] - 1, py, py);
+                font_line = font_decode_row (decoder + i, bytes_per_row);
 
-            for (xx = 0, ii = bits_per_row - 1; xx < font_widths[current_font]; xx++, ii--)
-            {
-                if (font_line & (1 << ii))
-                {
-                    tft_write_data (fcolor565);
-                }
-                else
+                for (xx = 0, mask = first_bit; xx < width; xx++, mask >>= 1)
                 {
-                    tft_write_data (bcolor565);
+                    if (font_line & mask)
+                    {
+                        tft_write_data (fcolor565);
+                    }
+                    else
+                    {
+                        tft_write_data (bcolor565);
+                    }
                 }
             }
-#endif
         }
+
+        s += cnt;
+        x += cnt * width;
+        n -= cnt;
     }
 }
 
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * font_glyph_rows () - get all rows of a glyph, pixel xx of a row is bit (width - 1 - xx)
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+font_glyph_rows (int font, unsigned char ch, uint32_t * rows, uint_fast8_t * widthp)
+{
+    FONT_DECODER    decoder;
+    int             save_font       = current_font;
+    uint_fast8_t    bytes_per_row;
+    uint_fast8_t    shift;
+    uint_fast16_t   yy;
+
+    current_font    = font;
+    bytes_per_row   = BYTES_PER_ROW;
+    shift           = BITS_PER_ROW - fonts[font]->width;
+
+    font_decode_start (&decoder, ch);
+
+    for (yy = 0; yy < fonts[font]->height; yy++)
+    {
+        rows[yy] = font_decode_row (&decoder, bytes_per_row) >> shift;
+    }
+
+    *widthp         = fonts[font]->width;
+    current_font    = save_font;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * draw_letter () - draw one glyph with one window
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+draw_letter (unsigned char ch, uint_fast16_t y, uint_fast16_t x, uint_fast16_t fcolor565, uint_fast16_t bcolor565)
+{
+    uint_fast16_t   width   = fonts[current_font]->width;
+    uint_fast16_t   height  = fonts[current_font]->height;
+
+    if (y + height <= TFT_HEIGHT && x + width <= TFT_WIDTH)
+    {
+        uint16_t *  pixels;
+
+        if (tft_comp_glyph (current_font, ch, x, y, width, height, fcolor565, bcolor565))
+        {
+            return;
+        }
+
+        pixels = font_cache_get (ch, fcolor565, bcolor565);
+
+        if (pixels)
+        {
+            tft_set_area (x, x + width - 1, y, y + height - 1);
+            tft_dma_write (pixels, width * height);
+        }
+        else
+        {
+            font_stream_run (&ch, 1, y, x, fcolor565, bcolor565);
+        }
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * draw_string () - draw string: cached glyphs are sent by DMA while the next one is looked up,
+ * without cache the whole string is streamed into one window. With the compositor started, each glyph is recorded.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
 void
 draw_string (unsigned char * s, uint_fast16_t y, uint_fast16_t x, uint_fast16_t fcolor565, uint_fast16_t bcolor565)
 {
     unsigned char * p;
 
+    if (*s && ! tft_comp_active () && ! font_cache_get (*s, fcolor565, bcolor565))
+    {
+        uint_fast16_t n = 0;
+
+        while (s[n] && x + (n + 1) * fonts[current_font]->width <= TFT_WIDTH)
+        {
+            n++;
+        }
+
+        if (n > 0 && y + fonts[current_font]->height <= TFT_HEIGHT)
+        {
+            font_stream_run (s, n, y, x, fcolor565, bcolor565);
+        }
+        return;
+    }
+
     for (p = s; *p; p++)
     {
         draw_letter (*p, y, x, fcolor565, bcolor565);
-        x += font_widths[current_font];
+        x += fonts[current_font]->width;
     }
 }
 
@@ -290,6 +496,12 @@ set_font (int font)
     (void) font;
 }
 
+int
+get_font (void)
+{
+    return 0;
+}
+
 int
 font_width (void)
 {
@@ -26,13 +26,13 @@
  */
 #include <stdint.h>
 
-#ifdef unix
-extern void     tft_show_screen (void);
-#endif
+#define FONT_MAX_HEIGHT 53                                                      // height of largest font
 
 extern int      number_of_fonts (void);
 extern void     set_font (int);
+extern int      get_font (void);
 extern int      font_width (void);
 extern int      font_height (void);
+extern void     font_glyph_rows (int, unsigned char, uint32_t *, uint_fast8_t *);
 extern void     draw_letter (unsigned char, uint_fast16_t, uint_fast16_t, uint_fast16_t, uint_fast16_t);
 extern void     draw_string (unsigned char *, uint_fast16_t, uint_fast16_t, uint_fast16_t, uint_fast16_t);
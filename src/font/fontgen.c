@@ -0,0 +1,292 @@
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * fontgen.c - generate font-packed.h from the uncompressed font-iso88591-*.h (unix only)
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Build and run on linux:
+ *
+ *   cc -o fontgen src/font/fontgen.c -Isrc/font && ./fontgen > src/font/font-packed.h
+ *
+ * Format of a glyph: a sequence of tokens, each describes one or more rows of BYTES_PER_ROW bytes:
+ *
+ *   0x00 - 0x3F    repeat previous row 1 - 64 times (previous row of the first token is blank)
+ *   0x40 - 0x7F    1 - 64 blank rows
+ *   0x80 - 0xFF    1 - 128 literal rows follow
+ *
+ * Blank glyphs are not stored. The present codes are described by ranges, each range has an index into the offset table.
+ * If the tokens plus offset table are not smaller than the plain glyphs (small fonts), the plain glyphs of the present
+ * codes are stored without offset table instead.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ * MIT License
+ *
+ * Copyright (c) 2018-2021 Frank Meyer - frank(at)fli4l.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#ifdef unix
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "font-iso88591-05x08.h"
+#include "font-iso88591-05x12.h"
+#include "font-iso88591-06x08.h"
+#include "font-iso88591-06x10.h"
+#include "font-iso88591-08x08.h"
+#include "font-iso88591-08x12.h"
+#include "font-iso88591-08x14.h"
+#include "font-iso88591-10x16.h"
+#include "font-iso88591-12x16.h"
+#include "font-iso88591-12x20.h"
+#include "font-iso88591-16x26.h"
+#include "font-iso88591-22x36.h"
+#include "font-iso88591-24x40.h"
+#include "font-iso88591-32x53.h"
+
+#define FONT_TOKEN_REPEAT       0x00
+#define FONT_TOKEN_BLANK        0x40
+#define FONT_TOKEN_LITERAL      0x80
+#define FONT_MAX_RUN            64
+#define FONT_MAX_LITERAL        128
+
+typedef struct
+{
+    const char *            name;
+    const unsigned char *   glyphs;
+    int                     width;
+    int                     height;
+} FONT_SRC;
+
+#define FONT_ENTRY(n)   { #n, &font_##n[0][0], FONT_WIDTH_##n, FONT_HEIGHT_##n }
+
+static const FONT_SRC fonts[] =
+{
+    FONT_ENTRY(05x08), FONT_ENTRY(05x12), FONT_ENTRY(06x08), FONT_ENTRY(06x10), FONT_ENTRY(08x08),
+    FONT_ENTRY(08x12), FONT_ENTRY(08x14), FONT_ENTRY(10x16), FONT_ENTRY(12x16), FONT_ENTRY(12x20),
+    FONT_ENTRY(16x26), FONT_ENTRY(22x36), FONT_ENTRY(24x40), FONT_ENTRY(32x53),
+};
+
+#define N_FONTS         (int) (sizeof (fonts) / sizeof (fonts[0]))
+
+static unsigned char    data[65536];
+static int              data_len;
+
+static int
+row_is_blank (const unsigned char * row, int bytes_per_row)
+{
+    int i;
+
+    for (i = 0; i < bytes_per_row; i++)
+    {
+        if (row[i])
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * encode one glyph, append to data
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+encode_glyph (const unsigned char * glyph, int bytes_per_row, int height)
+{
+    static const unsigned char  blank[4];
+    const unsigned char *       prev = blank;
+    const unsigned char *       row;
+    int                         y = 0;
+    int                         n;
+
+    while (y < height)
+    {
+        row = glyph + y * bytes_per_row;
+
+        if (! memcmp (row, prev, bytes_per_row) || row_is_blank (row, bytes_per_row))
+        {
+            int blank_run = ! memcmp (row, prev, bytes_per_row) ? 0 : 1;
+
+            for (n = 0; y + n < height && n < FONT_MAX_RUN && ! memcmp (glyph + (y + n) * bytes_per_row, row, bytes_per_row); n++)
+            {
+                ;
+            }
+
+            data[data_len++] = (blank_run ? FONT_TOKEN_BLANK : FONT_TOKEN_REPEAT) | (n - 1);
+        }
+        else
+        {
+            int pos = data_len++;                                               // literal token, patched below
+
+            for (n = 0; y + n < height && n < FONT_MAX_LITERAL; n++)
+            {
+                row = glyph + (y + n) * bytes_per_row;
+
+                if (n > 0 && (! memcmp (row, row - bytes_per_row, bytes_per_row) || row_is_blank (row, bytes_per_row)))
+                {
+                    break;                                                      // cheaper as repeat or blank token
+                }
+
+                memcpy (data + data_len, row, bytes_per_row);
+                data_len += bytes_per_row;
+            }
+
+            data[pos] = FONT_TOKEN_LITERAL | (n - 1);
+        }
+
+        prev = glyph + (y + n - 1) * bytes_per_row;
+        y += n;
+    }
+}
+
+int
+main (void)
+{
+    unsigned long   raw_total       = 0;
+    unsigned long   packed_total    = 0;
+    int             f;
+
+    printf ("/*---------------------------------------------------------------------------------------------------------------------------------------------------\n");
+    printf (" * font-packed.h - compressed fonts, generated by fontgen.c - do not edit\n");
+    printf (" *---------------------------------------------------------------------------------------------------------------------------------------------------\n");
+    printf (" */\n");
+
+    for (f = 0; f < N_FONTS; f++)
+    {
+        const FONT_SRC *    font            = fonts + f;
+        int                 bytes_per_row   = (font->width - 1) / 8 + 1;
+        int                 glyph_bytes     = bytes_per_row * font->height;
+        unsigned short      offsets[257];
+        int                 n_offsets       = 0;
+        int                 range_first[256];
+        int                 range_last[256];
+        int                 range_index[256];
+        int                 n_ranges        = 0;
+        int                 packed;
+        int                 size;
+        int                 ch;
+        int                 i;
+
+        data_len = 0;
+
+        for (ch = 0; ch < 256; ch++)
+        {
+            const unsigned char * glyph = font->glyphs + ch * glyph_bytes;
+
+            if (row_is_blank (glyph, glyph_bytes))
+            {
+                continue;
+            }
+
+            if (n_ranges == 0 || range_last[n_ranges - 1] != ch - 1)
+            {
+                range_first[n_ranges] = ch;
+                range_index[n_ranges] = n_offsets;
+                n_ranges++;
+            }
+
+            range_last[n_ranges - 1] = ch;
+            offsets[n_offsets++] = data_len;
+            encode_glyph (glyph, bytes_per_row, font->height);
+
+            if (data_len > 65535)
+            {
+                fprintf (stderr, "font %s: data exceeds 64 KiB\n", font->name);
+                return 1;
+            }
+        }
+
+        offsets[n_offsets] = data_len;
+        packed = data_len + (n_offsets + 1) * 2 < n_offsets * glyph_bytes;
+
+        if (! packed)
+        {
+            data_len = 0;
+
+            for (ch = 0; ch < 256; ch++)
+            {
+                const unsigned char * glyph = font->glyphs + ch * glyph_bytes;
+
+                if (! row_is_blank (glyph, glyph_bytes))
+                {
+                    memcpy (data + data_len, glyph, glyph_bytes);
+                    data_len += glyph_bytes;
+                }
+            }
+        }
+
+        printf ("\nstatic const FONT_RANGE font_ranges_%s[%d] =\n{\n", font->name, n_ranges);
+
+        for (i = 0; i < n_ranges; i++)
+        {
+            printf ("    { 0x%02X, 0x%02X, %3d },\n", range_first[i], range_last[i], range_index[i]);
+        }
+
+        printf ("};\n");
+
+        if (packed)
+        {
+            printf ("\nstatic const uint16_t font_offsets_%s[%d] =\n{", font->name, n_offsets + 1);
+
+            for (i = 0; i <= n_offsets; i++)
+            {
+                printf ("%s%5d,", (i % 16) ? " " : "\n    ", offsets[i]);
+            }
+
+            printf ("\n};\n");
+        }
+
+        printf ("\nstatic const uint8_t font_data_%s[%d] =\n{", font->name, data_len);
+
+        for (i = 0; i < data_len; i++)
+        {
+            printf ("%s0x%02X,", (i % 24) ? "" : "\n    ", data[i]);
+        }
+
+        if (packed)
+        {
+            printf ("\n};\n\nstatic const FONT_PACKED font_%s = { %d, %d, %d, font_ranges_%s, font_offsets_%s, font_data_%s };\n",
+                    font->name, font->width, font->height, n_ranges, font->name, font->name, font->name);
+        }
+        else
+        {
+            printf ("\n};\n\nstatic const FONT_PACKED font_%s = { %d, %d, %d, font_ranges_%s, (const uint16_t *) 0, font_data_%s };\n",
+                    font->name, font->width, font->height, n_ranges, font->name, font->name);
+        }
+
+        size            = n_ranges * 4 + (packed ? (n_offsets + 1) * 2 : 0) + data_len;
+        raw_total       += 256 * glyph_bytes;
+        packed_total    += size;
+        fprintf (stderr, "%s: %6d -> %6d bytes, %d glyphs in %d ranges%s\n", font->name, 256 * glyph_bytes, size, n_offsets, n_ranges,
+                 packed ? "" : ", not packed");
+    }
+
+    printf ("\nstatic const FONT_PACKED * const fonts[%d] =\n{\n", N_FONTS);
+
+    for (f = 0; f < N_FONTS; f++)
+    {
+        printf ("    &font_%s,\n", fonts[f].name);
+    }
+
+    printf ("};\n");
+    fprintf (stderr, "total: %lu -> %lu bytes\n", raw_total, packed_total);
+    return 0;
+}
+
+#endif // unix
@@ -29,10 +29,18 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 
-#include "console.h"
+#include "diskio.h"
+#include "w25qxx_ftl.h"
 #include "fs.h"
 
-#define FS_BUFSIZE              512
+#ifdef unix                                                                     // host build: FatFs on a disk image, no syscall layer
+#define __ELASTERROR            2000                                            // first user defined errno, see newlib sys/errno.h
+#else
+#include "console.h"
+#endif
+
+#define FS_BUFSIZE              512                                             // sector size
+#define FS_CP_BUFSIZE           (16 * FS_BUFSIZE)                               // preferred copy buffer size, halved until malloc succeeds
 #define FS_MAX_OPEN_FILES       8
 #define FS_FDNO_FLAG_IS_OPEN    0x01
 
@@ -43,7 +51,9 @@ typedef struct
 } FS_FDNO_SLOT;
 
 static int              fs_errno = FR_OK;
+#ifndef unix
 static FS_FDNO_SLOT     fs_fdno[FS_MAX_OPEN_FILES];
+#endif
 
 int                     fs_stdout_fd = -1;
 int                     fs_stderr_fd = -1;
@@ -225,21 +235,28 @@ static int                  ls_direntries_allocated;
 #define LS_DIRENTRIES_GRANULARITY     20
 
 static int
-new_ls_direntry (FILINFO * fnop)
+new_ls_direntry (FILINFO * fnop)                                                // returns 0 if out of memory
 {
-    if (! ls_direntries_allocated)
-    {
-        ls_direntries             = calloc (LS_DIRENTRIES_GRANULARITY, sizeof (LS_DIRENTRY));
-        ls_direntries_allocated   = LS_DIRENTRIES_GRANULARITY;
-        ls_direntries_used        = 0;
-    }
-    else
+    if (ls_direntries_used == ls_direntries_allocated)
     {
-        ls_direntries             = realloc (ls_direntries, (ls_direntries_allocated + LS_DIRENTRIES_GRANULARITY) * sizeof (LS_DIRENTRY));
+        LS_DIRENTRY * p = realloc (ls_direntries, (ls_direntries_allocated + LS_DIRENTRIES_GRANULARITY) * sizeof (LS_DIRENTRY));
+
+        if (! p)
+        {
+            return 0;
+        }
+
+        ls_direntries             = p;
         ls_direntries_allocated   += LS_DIRENTRIES_GRANULARITY;
     }
 
     ls_direntries[ls_direntries_used].fname     = malloc (strlen (fnop->fname) + 1);
+
+    if (! ls_direntries[ls_direntries_used].fname)
+    {
+        return 0;
+    }
+
     strcpy (ls_direntries[ls_direntries_used].fname, fnop->fname);
     ls_direntries[ls_direntries_used].fsize     = fnop->fsize;
     ls_direntries[ls_direntries_used].fdate     = fnop->fdate;
@@ -325,7 +342,7 @@ fs_ls_entry (char * fname, FSIZE_t fsize, WORD fdate, WORD ftime, BYTE fattrib,
             putchar ((fattrib & AM_HID) ? 'h' : '-');
             putchar ((fattrib & AM_SYS) ? 's' : '-');
 
-            printf ("%10lu  %d-%02d-%02d %02d:%02d:%02d  ", fsize,
+            printf ("%10lu  %d-%02d-%02d %02d:%02d:%02d  ", (unsigned long) fsize,
                     tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec);
 
         }
@@ -384,7 +401,12 @@ fs_ls (const char * path)
                     break;
                 }
 
-                new_ls_direntry (&fno);
+                if (! new_ls_direntry (&fno))
+                {
+                    fprintf (stderr, "%s: out of memory\n", name);
+                    res = -1;
+                    break;
+                }
             }
 
             f_closedir (&dir);
@@ -392,7 +414,11 @@ fs_ls (const char * path)
     }
     else if (is_dir == 0)
     {
-        new_ls_direntry (&fno);
+        if (! new_ls_direntry (&fno))
+        {
+            fprintf (stderr, "%s: out of memory\n", name);
+            res = -1;
+        }
     }
     else
     {
@@ -467,18 +493,30 @@ fs_cp (const char * src, const char * dst, uint_fast8_t flags)
 {
     if (flags & FS_CP_FLAG_FAST)
     {
-        FIL     fsrc;
-        FIL     fdst;
-        BYTE    buffer[FS_BUFSIZE];
-        FRESULT fr;
-        UINT    br;
-        UINT    bw;
+        FIL         fsrc;
+        FIL         fdst;
+        uint32_t    sbuffer[FS_BUFSIZE / sizeof (uint32_t)];                                                // word aligned for SDIO DMA
+        BYTE *      buffer = (BYTE *) NULL;
+        UINT        bufsize;
+        FRESULT     fr;
+        UINT        br;
+        UINT        bw;
 
         if (flags & FS_CP_FLAG_VERBOSE)
         {
             printf ("%s -> %s\n", src, dst);
         }
 
+        for (bufsize = FS_CP_BUFSIZE; bufsize > FS_BUFSIZE && ! (buffer = malloc (bufsize)); bufsize /= 2)   // try to get a big buffer
+        {
+            ;
+        }
+
+        if (bufsize == FS_BUFSIZE)
+        {
+            buffer = (BYTE *) sbuffer;
+        }
+
         fr = f_open (&fsrc, src, FA_READ);
 
         if (fr == FR_OK)
@@ -489,23 +527,23 @@ fs_cp (const char * src, const char * dst, uint_fast8_t flags)
             {
                 for (;;)
                 {
-                    fr = f_read (&fsrc, buffer, sizeof buffer, &br);                                                // read a chunk of source file
+                    fr = f_read (&fsrc, buffer, bufsize, &br);                                             // read a chunk of source file
 
                     if (fr || br == 0)
                     {
-                        break;                                                                                      // error or eof
+                        break;                                                                              // error or eof
                     }
 
-                    fr = f_write (&fdst, buffer, br, &bw);                                                          // write it to the destination file
+                    fr = f_write (&fdst, buffer, br, &bw);                                                 // write it to the destination file
 
                     if (fr)
-                    {                                                                                               // error
+                    {                                                                                       // error
                         break;
                     }
 
                     if (bw < br)
-                    {                                                                                               // error or disk full?
-                        fr = -1;                                                                                    // indicate error
+                    {                                                                                       // error or disk full?
+                        fr = -1;                                                                            // indicate error
                         break;
                     }
                 }
@@ -524,6 +562,11 @@ fs_cp (const char * src, const char * dst, uint_fast8_t flags)
             fs_perror (src, fr);
         }
 
+        if (buffer != (BYTE *) sbuffer)
+        {
+            free (buffer);
+        }
+
         return (int) fr;
     }
     else
@@ -571,11 +614,11 @@ fs_cp (const char * src, const char * dst, uint_fast8_t flags)
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
- * fs_df () - print disk free info
+ * fs_df () - print disk free info of drive, e.g. "0:" or "1:"
  *---------------------------------------------------------------------------------------------------------------------------------------------------
  */
 int
-fs_df (void)
+fs_df (const char * drive)
 {
     DWORD       fre_clust = 0;
     DWORD       fre_sect;
@@ -583,7 +626,7 @@ fs_df (void)
     FATFS *     fsp = (FATFS *) NULL;
     FRESULT     res;
 
-    res = f_getfree("0:", &fre_clust, &fsp);
+    res = f_getfree(drive, &fre_clust, &fsp);
 
     if (res == FR_OK)
     {
@@ -591,7 +634,7 @@ fs_df (void)
         fre_sect = fre_clust * fsp->csize;
 
         // assuming 512 bytes/sector
-        printf ("total drive space: %lu KiB, available: %lu KiB, used: %lu KiB\n", tot_sect / 2, fre_sect / 2, (tot_sect - fre_sect) / 2);
+        printf ("total drive space: %lu KiB, available: %lu KiB, used: %lu KiB\n", (unsigned long) tot_sect / 2, (unsigned long) fre_sect / 2, (unsigned long) (tot_sect - fre_sect) / 2);
     }
     else
     {
@@ -601,6 +644,154 @@ fs_df (void)
     return res;
 }
 
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * fs_ram_mount () - format and mount RAM disk as drive "1:"
+ *
+ * size == 0: use the free rest of CCM RAM, else allocate size bytes of main SRAM. The volume needs at least 128 sectors (64 KiB).
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#ifdef unix
+#define FS_RAM_CCM_SIZE         (64 * 1024)
+static char                     __ccmram_end__[FS_RAM_CCM_SIZE];                // simulated CCM RAM
+#define __ccmram_top__          (__ccmram_end__ + FS_RAM_CCM_SIZE)
+#else
+extern char                     __ccmram_end__[];                               // see linker script
+extern char                     __ccmram_top__[];
+#endif
+
+#define FS_RAM_MIN_SECTORS      128                                             // smallest volume f_mkfs() accepts
+
+static FATFS                    fs_ram_fs;                                      // must be static!
+static BYTE *                   fs_ram_mem;                                     // allocated memory, NULL if CCM RAM
+
+int
+fs_ram_mount (uint32_t size)
+{
+    uint32_t    work[FS_BUFSIZE / sizeof (uint32_t)];
+    BYTE *      mem;
+    FRESULT     res;
+
+    if (fs_ram_fs.fs_type)
+    {
+        fputs ("RAM disk already mounted\n", stderr);
+        return -1;
+    }
+
+    if (size == 0)
+    {
+        mem  = (BYTE *) __ccmram_end__;
+        size = __ccmram_top__ - __ccmram_end__;
+    }
+    else
+    {
+        mem = (BYTE *) NULL;
+    }
+
+    if (size / FS_BUFSIZE < FS_RAM_MIN_SECTORS)
+    {
+        fprintf (stderr, "RAM disk: %lu KiB too small, at least %d KiB needed\n", (unsigned long) size / 1024,
+                 FS_RAM_MIN_SECTORS * FS_BUFSIZE / 1024);
+        return -1;
+    }
+
+    if (! mem)
+    {
+        mem = fs_ram_mem = malloc (size);
+
+        if (! mem)
+        {
+            fputs ("RAM disk: not enough memory\n", stderr);
+            return -1;
+        }
+    }
+
+    ram_disk_init (mem, size / FS_BUFSIZE);
+
+    res = f_mkfs ("1:", FM_FAT | FM_SFD, 0, work, sizeof (work));
+
+    if (res == FR_OK)
+    {
+        res = f_mount (&fs_ram_fs, "1:", 1);
+    }
+
+    if (res != FR_OK)
+    {
+        fs_perror ("1:", res);
+        fs_ram_umount ();
+        return -1;
+    }
+
+    return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * fs_ram_umount () - unmount RAM disk, contents are lost
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+fs_ram_umount (void)
+{
+    f_mount (0, "1:", 0);
+    ram_disk_init ((BYTE *) NULL, 0);
+
+    if (fs_ram_mem)
+    {
+        free (fs_ram_mem);
+        fs_ram_mem = (BYTE *) NULL;
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * fs_flash_mount () - mount W25Qxx flash as drive "2:", create filesystem if there is none
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static FATFS                    fs_flash_fs;                                    // must be static!
+
+int
+fs_flash_mount (void)
+{
+    uint32_t    work[FS_BUFSIZE / sizeof (uint32_t)];
+    FRESULT     res;
+
+    if (fs_flash_fs.fs_type)
+    {
+        fputs ("flash already mounted\n", stderr);
+        return -1;
+    }
+
+    res = f_mount (&fs_flash_fs, "2:", 1);
+
+    if (res == FR_NO_FILESYSTEM)
+    {
+        res = f_mkfs ("2:", FM_FAT | FM_SFD, 0, work, sizeof (work));
+
+        if (res == FR_OK)
+        {
+            res = f_mount (&fs_flash_fs, "2:", 1);
+        }
+    }
+
+    if (res != FR_OK)
+    {
+        fs_perror ("2:", res);
+        fs_flash_umount ();
+        return -1;
+    }
+
+    return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * fs_flash_umount () - unmount flash and free the FTL tables
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+fs_flash_umount (void)
+{
+    f_mount (0, "2:", 0);
+    w25qxx_ftl_umount ();
+}
+
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
  * fs_find () - find files
  *---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -769,6 +960,292 @@ fs_rmdir (const char * dir)
     return res;
 }
 
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * fs_prealloc () - create file with a contiguous extent of size bytes
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+int
+fs_prealloc (const char * path, uint32_t size)
+{
+    FIL         fil;
+    FRESULT     res;
+
+    res = f_open (&fil, path, FA_WRITE | FA_CREATE_ALWAYS);
+
+    if (res == FR_OK)
+    {
+        res = f_expand (&fil, size, 1);
+        f_close (&fil);
+    }
+
+    if (res != FR_OK)
+    {
+        fs_perror (path, res);
+    }
+
+    return res;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * log files
+ *
+ * A log file is a preallocated contiguous extent. Appended data is collected in a sector buffer, full sectors are written directly to
+ * their LBA with disk_write() - whole runs with one multi-block write - bypassing the FAT. The directory entry is only updated by
+ * fs_log_sync() and fs_log_close(); on close the unused part of the extent is released.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#define FS_LOG_FLAG_IS_OPEN     0x01
+#define FS_LOG_FLAG_DIRTY       0x02                                            // size in directory entry is outdated
+
+typedef struct
+{
+    FIL         fil;
+    uint32_t    sbuf[FS_BUFSIZE / sizeof (uint32_t)];                           // partial sector, word aligned for SDIO DMA
+    DWORD       start_sect;                                                     // first sector of extent
+    DWORD       extent;                                                         // allocated bytes
+    DWORD       size;                                                           // appended bytes
+    uint32_t    flags;
+} FS_LOG_SLOT;
+
+static FS_LOG_SLOT      fs_log[FS_MAX_LOG_FILES];
+
+static FS_LOG_SLOT *
+fs_log_slot (int hdl)
+{
+    if (hdl >= 0 && hdl < FS_MAX_LOG_FILES && (fs_log[hdl].flags & FS_LOG_FLAG_IS_OPEN))
+    {
+        return &(fs_log[hdl]);
+    }
+
+    return (FS_LOG_SLOT *) NULL;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * fs_log_open () - create log file with a contiguous extent of size bytes, returns handle or -1
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+int
+fs_log_open (const char * path, uint32_t size)
+{
+    FS_LOG_SLOT *   lp;
+    FATFS *         fs;
+    FRESULT         res;
+    int             hdl;
+
+    for (hdl = 0; hdl < FS_MAX_LOG_FILES; hdl++)
+    {
+        if (! (fs_log[hdl].flags & FS_LOG_FLAG_IS_OPEN))
+        {
+            break;
+        }
+    }
+
+    if (hdl == FS_MAX_LOG_FILES)
+    {
+        errno = ENFILE;
+        return -1;
+    }
+
+    lp  = &(fs_log[hdl]);
+    res = f_open (&(lp->fil), path, FA_WRITE | FA_CREATE_ALWAYS);
+
+    if (res == FR_OK)
+    {
+        res = f_expand (&(lp->fil), size, 1);                                   // allocate contiguous clusters now
+
+        if (res != FR_OK)
+        {
+            f_close (&(lp->fil));
+        }
+    }
+
+    if (res != FR_OK)
+    {
+        fs_set_errno (res);
+        return -1;
+    }
+
+    fs              = lp->fil.obj.fs;
+    lp->start_sect  = fs->database + fs->csize * (lp->fil.obj.sclust - 2);
+    lp->extent      = size;
+    lp->size        = 0;
+    lp->flags       = FS_LOG_FLAG_IS_OPEN | FS_LOG_FLAG_DIRTY;
+    memset (lp->sbuf, 0, FS_BUFSIZE);
+    return hdl;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * fs_log_write () - append len bytes, returns number of bytes written or -1
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+int
+fs_log_write (int hdl, const void * buf, uint32_t len)
+{
+    FS_LOG_SLOT *   lp = fs_log_slot (hdl);
+    const BYTE *    ptr = buf;
+    BYTE            pdrv;
+    uint32_t        fill;
+    uint32_t        n;
+    int             rtc;
+
+    if (! lp)
+    {
+        errno = EBADF;
+        return -1;
+    }
+
+    if (len > lp->extent - lp->size)
+    {
+        len = lp->extent - lp->size;                                            // extent full
+    }
+
+    rtc     = len;
+    pdrv    = lp->fil.obj.fs->pdrv;
+    fill    = lp->size % FS_BUFSIZE;
+
+    if (fill)                                                                   // complete partial sector
+    {
+        n = FS_BUFSIZE - fill;
+
+        if (n > len)
+        {
+            n = len;
+        }
+
+        memcpy ((BYTE *) lp->sbuf + fill, ptr, n);
+        ptr         += n;
+        len         -= n;
+        lp->size    += n;
+
+        if (lp->size % FS_BUFSIZE == 0)
+        {
+            if (disk_write (pdrv, (BYTE *) lp->sbuf, lp->start_sect + lp->size / FS_BUFSIZE - 1, 1) != RES_OK)
+            {
+                fs_set_errno (FR_DISK_ERR);
+                return -1;
+            }
+
+            memset (lp->sbuf, 0, FS_BUFSIZE);
+        }
+    }
+
+    n = len / FS_BUFSIZE;                                                       // whole sectors: one multi-block write
+
+    if (n > 0)
+    {
+        if (disk_write (pdrv, ptr, lp->start_sect + lp->size / FS_BUFSIZE, n) != RES_OK)
+        {
+            fs_set_errno (FR_DISK_ERR);
+            return -1;
+        }
+
+        ptr         += n * FS_BUFSIZE;
+        len         -= n * FS_BUFSIZE;
+        lp->size    += n * FS_BUFSIZE;
+    }
+
+    if (len > 0)                                                                // tail
+    {
+        memcpy (lp->sbuf, ptr, len);
+        lp->size    += len;
+    }
+
+    lp->flags |= FS_LOG_FLAG_DIRTY;
+    return rtc;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * fs_log_sync () - write partial sector and update size in directory entry
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+int
+fs_log_sync (int hdl)
+{
+    FS_LOG_SLOT *   lp = fs_log_slot (hdl);
+    FRESULT         res;
+    UINT            bw;
+
+    if (! lp)
+    {
+        errno = EBADF;
+        return -1;
+    }
+
+    if (! (lp->flags & FS_LOG_FLAG_DIRTY))
+    {
+        return 0;
+    }
+
+    if (lp->size % FS_BUFSIZE)
+    {
+        if (disk_write (lp->fil.obj.fs->pdrv, (BYTE *) lp->sbuf, lp->start_sect + lp->size / FS_BUFSIZE, 1) != RES_OK)
+        {
+            fs_set_errno (FR_DISK_ERR);
+            return -1;
+        }
+    }
+
+    lp->fil.obj.objsize = lp->size;                                             // let f_sync() write the appended size ...
+    res = f_write (&(lp->fil), lp->sbuf, 0, &bw);                               // writes nothing, but marks the file as modified
+
+    if (res == FR_OK)
+    {
+        res = f_sync (&(lp->fil));
+    }
+
+    lp->fil.obj.objsize = lp->extent;                                           // ... but keep the extent for fs_log_close()
+
+    if (res != FR_OK)
+    {
+        fs_set_errno (res);
+        return -1;
+    }
+
+    lp->flags &= ~FS_LOG_FLAG_DIRTY;
+    return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * fs_log_close () - sync log file and release the unused part of the extent
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+int
+fs_log_close (int hdl)
+{
+    FS_LOG_SLOT *   lp = fs_log_slot (hdl);
+    FRESULT         res;
+    int             rtc;
+
+    if (! lp)
+    {
+        errno = EBADF;
+        return -1;
+    }
+
+    rtc = fs_log_sync (hdl);
+    res = f_lseek (&(lp->fil), lp->size);
+
+    if (res == FR_OK)
+    {
+        res = f_truncate (&(lp->fil));
+    }
+
+    if (res == FR_OK)
+    {
+        res = f_close (&(lp->fil));
+    }
+
+    if (res != FR_OK)
+    {
+        fs_set_errno (res);
+        rtc = -1;
+    }
+
+    lp->flags = 0;
+    return rtc;
+}
+
+#ifndef unix
 int
 _open (char * path, int flags, ...)
 {
@@ -927,44 +1404,16 @@ _read (int fd, char * ptr, int len)
             FRESULT     res;
             UINT        br;
 
-            rtc = 0;
+            res = f_read (fp, (BYTE *) ptr, len, &br);
+            // printf ("read: res=%d len=%d br=%d\n", res, len, br);
 
-            while (len > FS_BUFSIZE)
+            if (res != FR_OK)
             {
-                res = f_read (fp, ptr, FS_BUFSIZE, &br);
-                // printf ("read1: res=%d len=%d br=%d\n", res, len, br);
-
-                if (res != FR_OK)
-                {
-                    fs_set_errno (res);
-                    return -1;
-                }
-
-                len -= br;
-                ptr += br;
-                rtc += br;
-
-                if (br < FS_BUFSIZE)                                        // EOF
-                {                                                           // stop reading
-                    len = 0;
-                }
+                fs_set_errno (res);
+                return -1;
             }
 
-            if (len > 0)
-            {
-                res = f_read (fp, ptr, len, &br);
-                // printf ("read2: res=%d len=%d br=%d\n", res, len, br);
-
-                if (res != FR_OK)
-                {
-                    fs_set_errno (res);
-                    return -1;
-                }
-
-                len -= br;
-                ptr += br;
-                rtc += br;
-            }
+            rtc = br;
         }
         else
         {
@@ -976,6 +1425,35 @@ _read (int fd, char * ptr, int len)
     return rtc;
 }
 
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: write to console, insert CR before LF if missing. Writes runs of characters, not single characters.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+fs_console_write (char * ptr, int len, int * last_chp)
+{
+    static char cr = '\r';
+    int         start = 0;
+    int         idx;
+
+    for (idx = 0; idx < len; idx++)
+    {
+        if (ptr[idx] == '\n' && (idx > 0 ? ptr[idx - 1] : *last_chp) != '\r')
+        {
+            console_write (ptr + start, idx - start);
+            console_write (&cr, 1);
+            start = idx;
+        }
+    }
+
+    console_write (ptr + start, len - start);
+
+    if (len > 0)
+    {
+        *last_chp = ptr[len - 1];
+    }
+}
+
 int
 _write (int fd, char * ptr, int len)
 {
@@ -1000,39 +1478,15 @@ _write (int fd, char * ptr, int len)
     else if (fd == STDOUT_FILENO)
     {
         static int  last_ch;
-        int idx;
-
-        for (idx = 0; idx < len; idx++)
-        {
-            if (*ptr == '\n' && last_ch != '\r')
-            {
-                console_putc ('\r');
-            }
-
-            console_putc (*ptr);
-            last_ch = *ptr;
-            ptr++;
-        }
 
+        fs_console_write (ptr, len, &last_ch);
         rtc = len;
     }
     else if (fd == STDERR_FILENO)
     {
         static int  last_ch;
-        int idx;
-
-        for (idx = 0; idx < len; idx++)
-        {
-            if (*ptr == '\n' && last_ch != '\r')
-            {
-                console_putc ('\r');
-            }
-
-            console_putc (*ptr);
-            last_ch = *ptr;
-            ptr++;
-        }
 
+        fs_console_write (ptr, len, &last_ch);
         rtc = len;
     }
     else
@@ -1045,44 +1499,16 @@ _write (int fd, char * ptr, int len)
             FRESULT     res;
             UINT        bw;
 
-            rtc = 0;
+            res = f_write (fp, (BYTE *) ptr, len, &bw);
+            // printf ("write: res=%d len=%d bw=%d\n", res, len, bw);
 
-            while (len > FS_BUFSIZE)
+            if (res != FR_OK)
             {
-                res = f_write (fp, ptr, FS_BUFSIZE, &bw);
-                // printf ("write1: res=%d bw=%d\n", res, bw);
-
-                if (res != FR_OK)
-                {
-                    fs_set_errno (res);
-                    return -1;
-                }
-
-                len -= bw;
-                ptr += bw;
-                rtc += bw;
-
-                if (bw < FS_BUFSIZE)                                        // EOF or FS full
-                {                                                           // stop writing
-                    len = 0;
-                }
+                fs_set_errno (res);
+                return -1;
             }
 
-            if (len > 0)
-            {
-                res = f_write (fp, ptr, len, &bw);
-                // printf ("write2: res=%d bw=%d\n", res, bw);
-
-                if (res != FR_OK)
-                {
-                    fs_set_errno (res);
-                    return -1;
-                }
-
-                len -= bw;
-                ptr += bw;
-                rtc += bw;
-            }
+            rtc = bw;
         }
         else
         {
@@ -1184,11 +1610,14 @@ int _isatty(int fd)
     return 0;
 }
 
+#endif // !unix
+
 void
 fs_close_all_open_files (void)
 {
     int fd;
 
+#ifndef unix
     for (fd = 0; fd < FS_MAX_OPEN_FILES; fd++)
     {
         if ((fs_fdno[fd].flags & FS_FDNO_FLAG_IS_OPEN))
@@ -1197,4 +1626,14 @@ fs_close_all_open_files (void)
             _close (fd + 3);
         }
     }
+#endif
+
+    for (fd = 0; fd < FS_MAX_LOG_FILES; fd++)
+    {
+        if ((fs_log[fd].flags & FS_LOG_FLAG_IS_OPEN))
+        {
+            fprintf (stderr, "error: log %d not closed\n", fd);
+            fs_log_close (fd);
+        }
+    }
 }
@@ -33,10 +33,13 @@
 #include <unistd.h>
 #include <errno.h>
 
+#ifndef unix
 #include "stm32_sdcard.h"
+#endif
 #include "ff.h"
 
 #define FS_MAX_PATH_LEN         64                                             // max path len
+#define FS_MAX_LOG_FILES        2                                              // max number of open log files
 
 #define LS_FLAG_LONG            0x01
 #define LS_FLAG_SHOW_ALL        0x02
@@ -64,11 +67,21 @@ extern void                     fs_ls_output (uint_fast8_t, uint_fast8_t);
 
 extern int                      fs_cat (const char *);
 extern int                      fs_cp (const char *, const char *, uint_fast8_t);
-extern int                      fs_df (void);
+extern int                      fs_df (const char *);
 extern int                      fs_find (const char *);
 extern int                      fs_mv (const char *, const char *, uint_fast8_t);
 extern int                      fs_mkdir (const char *);
 extern int                      fs_rm (const char *);
 extern int                      fs_rmdir (const char *);
+extern int                      fs_prealloc (const char *, uint32_t);
+extern int                      fs_ram_mount (uint32_t);
+extern void                     fs_ram_umount (void);
+extern int                      fs_flash_mount (void);
+extern void                     fs_flash_umount (void);
+
+extern int                      fs_log_open (const char *, uint32_t);
+extern int                      fs_log_write (int, const void *, uint32_t);
+extern int                      fs_log_sync (int);
+extern int                      fs_log_close (int);
 
 extern void                     fs_close_all_open_files (void);
@@ -0,0 +1,652 @@
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * fsbench.c - storage benchmark: FatFs and fs layer on a disk image (unix only)
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ * MIT License
+ *
+ * Copyright (c) 2018-2021 Frank Meyer - frank(at)fli4l.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Build on linux:
+ *
+ *   cc -O2 -Isrc/fatfs -Isrc/fs -Isrc/w25qxx -o fsbench src/fs/fsbench.c src/fs/fs.c \
+ *      src/fatfs/ff.c src/fatfs/ffsystem.c src/fatfs/ffunicode.c src/fatfs/diskio.c \
+ *      src/w25qxx/w25qxx.c src/w25qxx/w25qxx_ftl.c
+ *
+ * Usage:
+ *
+ *   fsbench [-c MiB] [-k KiB] [-l usec] [-w usec] [-s usec] [-r] image
+ *   fsbench -F [-k KiB] [-p n]
+ *
+ *   -F         use simulated W25Q16 flash with FTL as drive 2: instead of an image
+ *   -p n       flash: simulate power fail at n-th program/erase, then remount and check
+ *   -c MiB     create and format image with given size
+ *   -k KiB     size of test file, default 1024, flash: a quarter of the volume
+ *   -l usec    latency per read command, default DISKIO_SIM_CMD_USEC
+ *   -w usec    latency per write command, default DISKIO_SIM_WCMD_USEC
+ *   -s usec    cost per sector, default DISKIO_SIM_SECTOR_USEC
+ *   -r         really wait for the simulated time, default: only account it
+ *
+ * MB/s is computed from the simulated device time, so results are reproducible and independent of the host.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#ifdef unix
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/time.h>
+
+#include "diskio.h"
+#include "w25qxx.h"
+#include "w25qxx_ftl.h"
+#include "fs.h"
+
+#define BENCH_TEST_FILE         "seq.dat"
+#define BENCH_COPY_FILE         "copy.dat"
+#define BENCH_TREE_DIRS         8
+#define BENCH_TREE_FILES        16
+#define BENCH_RANDOM_OPS        256
+#define BENCH_RANDOM_SIZE       4096
+#define BENCH_DEFAULT_SIZE      (1024 * 1024)
+#define BENCH_TRIM_ROUNDS       8
+
+static FATFS                    fs;                                             // must be static!
+static BYTE                     buf[32768];
+static struct timeval           tv_start;
+static int                      flash;                                          // 1: simulated flash, drive 2:
+
+static void
+bench_start (void)
+{
+    diskio_sim.read_cmds        = 0;
+    diskio_sim.write_cmds       = 0;
+    diskio_sim.sectors_read     = 0;
+    diskio_sim.sectors_written  = 0;
+    diskio_sim.busy_usec        = 0;
+    w25qxx_sim.reads            = 0;
+    w25qxx_sim.bytes_read       = 0;
+    w25qxx_sim.programs         = 0;
+    w25qxx_sim.bytes_programmed = 0;
+    w25qxx_sim.erases           = 0;
+    w25qxx_sim.busy_usec        = 0;
+    gettimeofday (&tv_start, (struct timezone *) NULL);
+}
+
+static void
+bench_report (const char * name, unsigned long bytes)
+{
+    struct timeval  tv;
+    double          wall_ms;
+    double          sim_ms;
+
+    gettimeofday (&tv, (struct timezone *) NULL);
+    wall_ms = (tv.tv_sec - tv_start.tv_sec) * 1000.0 + (tv.tv_usec - tv_start.tv_usec) / 1000.0;
+
+    if (flash)                                                                  // write commands are page programs, erases not shown
+    {
+        sim_ms  = w25qxx_sim.busy_usec / 1000.0;
+        printf ("%-22s %7lu %7lu %8lu %8lu %10.1f %8.1f", name,
+                w25qxx_sim.reads, w25qxx_sim.programs, w25qxx_sim.bytes_read / 512, w25qxx_sim.bytes_programmed / 512, sim_ms, wall_ms);
+    }
+    else
+    {
+        sim_ms  = diskio_sim.busy_usec / 1000.0;
+        printf ("%-22s %7lu %7lu %8lu %8lu %10.1f %8.1f", name,
+                diskio_sim.read_cmds, diskio_sim.write_cmds, diskio_sim.sectors_read, diskio_sim.sectors_written, sim_ms, wall_ms);
+    }
+
+    if (bytes > 0 && sim_ms > 0)
+    {
+        printf (" %8.2f", bytes / (sim_ms * 1000.0));
+    }
+
+    putchar ('\n');
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * hide output of fs_ls() and fs_find()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+stdout_off (void)
+{
+    int     saved;
+    int     null_fd;
+
+    fflush (stdout);
+    saved   = dup (STDOUT_FILENO);
+    null_fd = open ("/dev/null", O_WRONLY);
+    dup2 (null_fd, STDOUT_FILENO);
+    close (null_fd);
+    return saved;
+}
+
+static void
+stdout_on (int saved)
+{
+    fflush (stdout);
+    dup2 (saved, STDOUT_FILENO);
+    close (saved);
+}
+
+static FRESULT
+bench_seq_write (UINT chunk, unsigned long size)
+{
+    FIL         fil;
+    FRESULT     res;
+    UINT        bw;
+    char        name[32];
+
+    res = f_open (&fil, BENCH_TEST_FILE, FA_WRITE | FA_CREATE_ALWAYS);
+
+    if (res == FR_OK)
+    {
+        bench_start ();
+
+        while (size > 0 && res == FR_OK)
+        {
+            res = f_write (&fil, buf, chunk < size ? chunk : size, &bw);
+            size -= bw;
+        }
+
+        f_close (&fil);
+        sprintf (name, "seq write %5u", chunk);
+        bench_report (name, f_size (&fil));
+    }
+
+    return res;
+}
+
+static FRESULT
+bench_seq_read (UINT chunk)
+{
+    FIL         fil;
+    FRESULT     res;
+    UINT        br;
+    char        name[32];
+
+    res = f_open (&fil, BENCH_TEST_FILE, FA_READ);
+
+    if (res == FR_OK)
+    {
+        bench_start ();
+
+        do
+        {
+            res = f_read (&fil, buf, chunk, &br);
+        } while (res == FR_OK && br == chunk);
+
+        f_close (&fil);
+        sprintf (name, "seq read %5u", chunk);
+        bench_report (name, f_size (&fil));
+    }
+
+    return res;
+}
+
+static FRESULT
+bench_random (int do_write)
+{
+    FIL         fil;
+    FRESULT     res;
+    UINT        bx;
+    FSIZE_t     blocks;
+    int         idx;
+
+    res = f_open (&fil, BENCH_TEST_FILE, FA_READ | FA_WRITE);
+
+    if (res == FR_OK)
+    {
+        blocks = f_size (&fil) / BENCH_RANDOM_SIZE;
+        srand (4711);
+        bench_start ();
+
+        for (idx = 0; idx < BENCH_RANDOM_OPS && res == FR_OK && blocks > 0; idx++)
+        {
+            res = f_lseek (&fil, (FSIZE_t) (rand () % blocks) * BENCH_RANDOM_SIZE);
+
+            if (res == FR_OK)
+            {
+                if (do_write)
+                {
+                    res = f_write (&fil, buf, BENCH_RANDOM_SIZE, &bx);
+                }
+                else
+                {
+                    res = f_read (&fil, buf, BENCH_RANDOM_SIZE, &bx);
+                }
+            }
+        }
+
+        f_close (&fil);
+        bench_report (do_write ? "random write 4096" : "random read 4096", (unsigned long) idx * BENCH_RANDOM_SIZE);
+    }
+
+    return res;
+}
+
+static FRESULT
+bench_make_tree (void)
+{
+    FIL         fil;
+    FRESULT     res;
+    UINT        bw;
+    char        path[32];
+    int         d;
+    int         f;
+
+    res = f_mkdir ("tree");
+
+    for (d = 0; d < BENCH_TREE_DIRS && (res == FR_OK || res == FR_EXIST); d++)
+    {
+        sprintf (path, "tree/d%d", d);
+        res = f_mkdir (path);
+
+        for (f = 0; f < BENCH_TREE_FILES && (res == FR_OK || res == FR_EXIST); f++)
+        {
+            sprintf (path, "tree/d%d/f%d.txt", d, f);
+            res = f_open (&fil, path, FA_WRITE | FA_CREATE_ALWAYS);
+
+            if (res == FR_OK)
+            {
+                res = f_write (&fil, path, strlen (path), &bw);
+                f_close (&fil);
+            }
+        }
+    }
+
+    return (res == FR_EXIST) ? FR_OK : res;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * flash: delete files, which trims their sectors, remount and fill the free space again - BENCH_TRIM_ROUNDS times. Trimmed
+ * sectors are live again after the mount, garbage collection must still find a block for its copies.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static FRESULT
+bench_trim_remount (void)
+{
+    FATFS *         fsp;
+    DWORD           free_clusters;
+    FIL             fil;
+    FRESULT         res;
+    UINT            bw;
+    unsigned long   size;
+    unsigned long   pos;
+    unsigned long   total = 0;
+    char            name[16];
+    int             round;
+    int             n;
+
+    res = f_unlink (BENCH_COPY_FILE);
+    bench_start ();
+
+    for (round = 0; round < BENCH_TRIM_ROUNDS && res == FR_OK; round++)
+    {
+        f_mount (0, "2:", 0);
+        w25qxx_ftl_umount ();
+        res = f_mount (&fs, "2:", 1);
+
+        if (res == FR_OK)
+        {
+            res = f_getfree ("2:", &free_clusters, &fsp);
+        }
+
+        for (n = 0; n < 4 && res == FR_OK; n++)                                 // fill the volume with 4 files of random size
+        {
+            size = (unsigned long) (free_clusters - 1) * fsp->csize * FF_MAX_SS / (4 - n);
+            size = rand () % (size + 1);
+            sprintf (name, "trim%d.dat", n);
+            res = f_open (&fil, name, FA_WRITE | FA_CREATE_ALWAYS);
+
+            if (res == FR_OK)
+            {
+                for (pos = 0; pos < size && res == FR_OK; pos += bw)
+                {
+                    res = f_write (&fil, buf, size - pos < sizeof (buf) ? size - pos : sizeof (buf), &bw);
+
+                    if (res == FR_OK && bw == 0)
+                    {
+                        res = FR_DENIED;                                        // volume full
+                    }
+                }
+
+                f_close (&fil);
+                total += pos;
+            }
+
+            if (res == FR_OK)
+            {
+                res = f_getfree ("2:", &free_clusters, &fsp);
+            }
+        }
+
+        for (n = 0; n < 4 && res == FR_OK; n++)                                 // trim some of them
+        {
+            if (rand () % 2)
+            {
+                sprintf (name, "trim%d.dat", n);
+                res = f_unlink (name);
+            }
+        }
+    }
+
+    bench_report ("trim+remount write", total);
+    return res;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * flash: write a file until power fails at the n-th program/erase, remount and check that every sector holds old or new data
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+bench_power_fail (long n, unsigned long size)
+{
+    static BYTE     work[FF_MAX_SS];
+    FIL             fil;
+    FRESULT         res;
+    UINT            bx;
+    unsigned long   pos;
+    unsigned long   bad = 0;
+    int             round;
+
+    res = f_mkfs ("2:", FM_ANY, 0, work, sizeof (work));
+
+    if (res == FR_OK)
+    {
+        res = f_mount (&fs, "2:", 1);
+    }
+
+    for (round = 0; round < 2 && res == FR_OK; round++)                        // round 0: old data 0x00, round 1: new data 0x55
+    {
+        memset (buf, round ? 0x55 : 0x00, sizeof (buf));
+
+        if (round == 1)
+        {
+            w25qxx_sim.fail_after = n;
+        }
+
+        res = f_open (&fil, "2:" BENCH_TEST_FILE, round ? FA_WRITE : (FA_WRITE | FA_CREATE_ALWAYS));
+
+        for (pos = 0; pos < size && res == FR_OK; pos += bx)
+        {
+            res = f_write (&fil, buf, sizeof (buf), &bx);
+        }
+
+        if (res == FR_OK)
+        {
+            res = f_close (&fil);
+        }
+    }
+
+    printf ("power fail after %ld operations: %s\n", n, res == FR_OK ? "not reached" : "write failed");
+
+    w25qxx_sim.fail_after = -1;                                                 // power is back
+    f_mount (0, "2:", 0);
+    w25qxx_ftl_umount ();
+
+    res = f_mount (&fs, "2:", 1);
+
+    if (res == FR_OK)
+    {
+        res = f_open (&fil, "2:" BENCH_TEST_FILE, FA_READ);
+    }
+
+    while (res == FR_OK)
+    {
+        res = f_read (&fil, buf, 512, &bx);
+
+        if (res != FR_OK || bx == 0)
+        {
+            break;
+        }
+
+        for (pos = 1; pos < bx; pos++)
+        {
+            if (buf[pos] != buf[0] || (buf[0] != 0x00 && buf[0] != 0x55))
+            {
+                bad++;
+                break;
+            }
+        }
+    }
+
+    if (res != FR_OK)
+    {
+        fs_perror ("remount", res);
+        return EXIT_FAILURE;
+    }
+
+    f_close (&fil);
+    printf ("remount ok, %lu torn sectors, erase-before-write violations: %lu\n", bad, w25qxx_sim.violations);
+    return bad ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+int
+main (int argc, char ** argv)
+{
+    static BYTE     work[FF_MAX_SS];
+    unsigned long   create_mb   = 0;
+    unsigned long   size        = 0;                                            // 0: default
+    long            power_fail  = -1;
+    const char *    drive       = "0:";
+    const char *    image       = NULL;
+    FRESULT         res;
+    UINT            chunk;
+    int             saved;
+    int             opt;
+
+    while ((opt = getopt (argc, argv, "c:k:l:w:s:rFp:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'c':   create_mb               = strtoul (optarg, NULL, 10);           break;
+            case 'k':   size                    = strtoul (optarg, NULL, 10) * 1024;    break;
+            case 'l':   diskio_sim.cmd_usec     = strtoul (optarg, NULL, 10);           break;
+            case 'w':   diskio_sim.wcmd_usec    = strtoul (optarg, NULL, 10);           break;
+            case 's':   diskio_sim.sector_usec  = strtoul (optarg, NULL, 10);           break;
+            case 'r':   diskio_sim.sleep        = 1;                                    break;
+            case 'F':   flash                   = 1;                                    break;
+            case 'p':   power_fail              = strtol (optarg, NULL, 10);            break;
+            default:
+                fprintf (stderr, "usage: %s [-c MiB] [-k KiB] [-l usec] [-w usec] [-s usec] [-r] image\n", argv[0]);
+                fprintf (stderr, "       %s -F [-k KiB] [-p n]\n", argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    if (flash)
+    {
+        drive = "2:";
+        w25qxx_init ();
+
+        if (power_fail > 0)
+        {
+            return bench_power_fail (power_fail, size ? size : BENCH_DEFAULT_SIZE);
+        }
+
+        create_mb = 1;                                                          // always format
+    }
+    else if (optind == argc - 1)
+    {
+        image = argv[optind];
+    }
+    else
+    {
+        fprintf (stderr, "usage: %s [-c MiB] [-k KiB] [-l usec] [-w usec] [-s usec] [-r] image\n", argv[0]);
+        fprintf (stderr, "       %s -F [-k KiB] [-p n]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (create_mb > 0 && ! flash)
+    {
+        FILE * fp = fopen (image, "wb");
+
+        if (! fp || ftruncate (fileno (fp), (off_t) create_mb * 1024 * 1024) != 0)
+        {
+            perror (image);
+            return EXIT_FAILURE;
+        }
+
+        fclose (fp);
+    }
+
+    if (image && diskio_image_open (image) != 0)
+    {
+        perror (image);
+        return EXIT_FAILURE;
+    }
+
+    if (create_mb > 0)
+    {
+        res = f_mkfs (drive, FM_ANY, 0, work, sizeof (work));
+
+        if (res != FR_OK)
+        {
+            fs_perror ("mkfs", res);
+            return EXIT_FAILURE;
+        }
+    }
+
+    res = f_mount (&fs, drive, 1);
+
+    if (res == FR_OK)
+    {
+        res = f_chdrive (drive);
+    }
+
+    if (res != FR_OK)
+    {
+        fs_perror ("mount", res);
+        return EXIT_FAILURE;
+    }
+
+    if (size == 0)
+    {
+        if (flash)                                                              // test file and its copy must fit
+        {
+            size = (w25qxx_ftl_sectors () * W25QXX_FTL_SECTOR_SIZE / 4) & ~(sizeof (buf) - 1);
+        }
+        else
+        {
+            size = BENCH_DEFAULT_SIZE;
+        }
+    }
+
+    memset (buf, 0x55, sizeof (buf));
+
+    if (flash)
+    {
+        printf ("flash: page program %d usec, sector erase %d usec, read %d bytes/msec\n\n",
+                W25QXX_SIM_PROGRAM_USEC, W25QXX_SIM_ERASE_USEC, W25QXX_SIM_BYTES_PER_MS);
+    }
+    else
+    {
+        printf ("latency: read cmd %lu usec, write cmd %lu usec, sector %lu usec\n\n",
+                diskio_sim.cmd_usec, diskio_sim.wcmd_usec, diskio_sim.sector_usec);
+    }
+    printf ("%-22s %7s %7s %8s %8s %10s %8s %8s\n", "workload", "rd-cmds", "wr-cmds", "rd-sect", "wr-sect", "sim-ms", "wall-ms", "MB/s");
+
+    for (chunk = 512; chunk <= sizeof (buf) && res == FR_OK; chunk *= 8)
+    {
+        res = bench_seq_write (chunk, size);
+    }
+
+    for (chunk = 512; chunk <= sizeof (buf) && res == FR_OK; chunk *= 8)
+    {
+        res = bench_seq_read (chunk);
+    }
+
+    if (res == FR_OK)
+    {
+        res = bench_random (0);
+    }
+
+    if (res == FR_OK)
+    {
+        res = bench_random (1);
+    }
+
+    if (res == FR_OK)
+    {
+        bench_start ();
+        res = fs_cp (BENCH_TEST_FILE, BENCH_COPY_FILE, FS_CP_FLAG_FAST);
+        bench_report ("cp -f", size);
+
+        if ((int) res == -1)                                                    // fs_cp(): destination full
+        {
+            res = FR_DENIED;
+        }
+    }
+
+    if (res == FR_OK)
+    {
+        res = bench_make_tree ();
+    }
+
+    if (res == FR_OK)
+    {
+        saved = stdout_off ();
+        bench_start ();
+        res = fs_ls ("tree/d0");
+        fs_ls_output (LS_FLAG_LONG, LS_SORT_FNAME);
+        stdout_on (saved);
+        bench_report ("ls -l", 0);
+    }
+
+    if (res == FR_OK)
+    {
+        saved = stdout_off ();
+        bench_start ();
+        res = fs_find ("/tree");
+        stdout_on (saved);
+        bench_report ("find", 0);
+    }
+
+    if (res == FR_OK && flash)
+    {
+        res = bench_trim_remount ();
+    }
+
+    if (res != FR_OK)
+    {
+        fs_perror ("bench", res);
+    }
+
+    if (flash)
+    {
+        W25QXX_FTL_STATS    st;
+
+        w25qxx_ftl_stats (&st);
+        printf ("\nFTL: %lu blocks, %lu sectors, %lu free blocks, erase count %lu...%lu, %lu erases\n",
+                (unsigned long) st.blocks, (unsigned long) st.sectors, (unsigned long) st.free_blocks,
+                (unsigned long) st.erase_min, (unsigned long) st.erase_max, (unsigned long) st.erases);
+        printf ("write amplification: %.2f, erase-before-write violations: %lu\n",
+                st.host_writes ? (double) st.flash_writes / st.host_writes : 0.0, w25qxx_sim.violations);
+    }
+
+    f_mount (0, drive, 0);
+    diskio_image_close ();
+    return (res == FR_OK) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#endif // unix
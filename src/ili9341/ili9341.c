@@ -130,6 +130,7 @@
  */
 ILI9341_GLOBALS  ili9341;
 
+#ifndef unix                                                                                            // host build: no FSMC, see tft_sim.c
 /*-------------------------------------------------------------------------------------------------------------------------------------------
  * ili9341_reset_ctrl_lines () - reset control lines, set them to input to allow auto-init
  *-------------------------------------------------------------------------------------------------------------------------------------------
@@ -280,6 +281,8 @@ ili9341_init_fsmc (void)
     FSMC_NORSRAMCmd(FSMC_Bank1_NORSRAM1, ENABLE);
 }
 
+#endif // !unix
+
 /*-------------------------------------------------------------------------------------------------------------------------------------------
  * ili9341_soft_reset () - software reset
  *-------------------------------------------------------------------------------------------------------------------------------------------
@@ -614,9 +617,11 @@ ili9341_init (void)
 {
     ili9341.flags = 0;
 
+#ifndef unix
     ili9341_reset_ctrl_lines ();                                                            // control lines as input
     ili9341_init_ctrl_lines ();
     ili9341_init_fsmc ();
+#endif
     delay_msec(20);                                                                         // wait for display coming up
 
     ili9341_soft_reset ();
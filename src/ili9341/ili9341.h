@@ -48,12 +48,22 @@
  * ILI9341 API:
  *-------------------------------------------------------------------------------------------------------------------------------------------
  */
+#ifdef unix                                                                                     // host build: bus goes to tft_sim.c
+extern void                             tft_sim_write_command (uint_fast16_t);
+extern void                             tft_sim_write_data (uint_fast16_t);
+extern uint_fast16_t                    tft_sim_read_data (void);
+
+#define ili9341_write_command(cmd)              tft_sim_write_command (cmd)
+#define ili9341_write_data(val)                 tft_sim_write_data (val)
+#define ili9341_read_data()                     tft_sim_read_data ()
+#else
 #define TFT_REG                                 (*((volatile uint16_t *) 0x60000000))
 #define TFT_RAM                                 (*((volatile uint16_t *) 0x60080000))   // fm: 0x60020000 ?
 
 #define ili9341_write_command(cmd)              do { TFT_REG = (cmd); } while (0)
 #define ili9341_write_data(val)                 do { TFT_RAM = (val); } while (0)
 #define ili9341_read_data()                     (TFT_RAM)
+#endif
 
 #define ILI9341_GLOBAL_FLAGS_RGB_ORDER          0x01
 #define ILI9341_GLOBAL_FLAGS_FLIP_HORIZONTAL    0x02
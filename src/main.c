@@ -40,6 +40,18 @@
 #include "stm32_sdcard.h"
 #include "cmd.h"
 #include "timer2.h"
+#include "boot.h"
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * boot_sdcard () - async boot stage: power up and identify SD card, mounted by FatFs on first file access
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+boot_sdcard (void * arg)
+{
+    (void) arg;
+    sdcard_identify ();
+}
 
 /*-------------------------------------------------------------------------------------------------------------------------------------------
  * MINOS main function
@@ -52,16 +64,39 @@ main(void)
 
     SystemInit ();
     SystemCoreClockUpdate();
+    boot_init ();                                                           // start cycle counter for boot report
 
+    boot_begin ("gpio");
     delay_init (DELAY_RESOLUTION_10_US);
     board_led_init ();                                                      // initialize GPIO for board LED
     button_init ();
-    stm32f4_rtc_init ();
-    sdcard_init ();
+    boot_end ();
+
+    boot_begin ("console");
     console_init (115200);
+    boot_end ();
+
+    boot_begin ("sdio");
+    sdcard_init ();
+    boot_end ();
+
+    boot_start ("sdcard", boot_sdcard, NULL);                               // card power up runs while shell waits for input
+
+    boot_begin ("rtc");
+    stm32f4_rtc_init ();
+    boot_end ();
+
+    boot_begin ("mcurses");
     initscr ();
+    boot_end ();
+
+    boot_begin ("timer2");
     timer2_init ();                                                         // initialize timer2
+    boot_end ();
+
+    boot_begin ("w25qxx");
     w25qxx_init ();
+    boot_end ();
 
     setvbuf(stdin, NULL, _IONBF, 0);
     setvbuf(stdout, NULL, _IONBF, 0);
@@ -0,0 +1,129 @@
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * mcbench.c - bytes sent to the terminal by typical mcurses screens (unix only)
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Build and run on linux in a terminal with at least 25 lines and 80 columns:
+ *
+ *   cc -O2 -Dunix -Isrc/mcurses -o mcbench src/mcurses/mcbench.c src/mcurses/mcurses.c && ./mcbench
+ *
+ * Add -DMCURSES_VSCREEN_CELLS=0 to measure direct output without virtual screen. After endwin() the number of bytes of each
+ * test is printed, see mcurses_nbytes.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ * MIT License
+ *
+ * Copyright (c) 2018-2021 Frank Meyer - frank(at)fli4l.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#ifdef unix
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "mcurses.h"
+
+#define BENCH_FRAMES            100
+#define BENCH_TESTS             4
+
+static const char *             bench_name[BENCH_TESTS];
+static unsigned long            bench_bytes[BENCH_TESTS];
+static int                      bench_no;
+
+static void
+bench_start (const char * name)
+{
+    bench_name[bench_no] = name;
+    mcurses_nbytes = 0;
+}
+
+static void
+bench_stop (void)
+{
+    refresh ();
+    bench_bytes[bench_no++] = mcurses_nbytes;
+}
+
+int
+main (void)
+{
+    int     f;
+    int     y;
+    int     x;
+    int     i;
+
+    initscr ();
+
+    bench_start ("draw screen");
+    attrset (F_WHITE | B_BLUE);
+    mvprintw (0, 0, "%-*s", COLS, " mcbench");
+    attrset (A_NORMAL);
+
+    for (y = 0; y < 20; y++)
+    {
+        mvprintw (y + 2, 2, "sensor %2d:", y);
+    }
+    bench_stop ();
+
+    bench_start ("dashboard frames");
+    for (f = 0; f < BENCH_FRAMES; f++)
+    {
+        for (y = 0; y < 20; y++)
+        {
+            attrset ((y == f % 20) ? (F_RED | A_BOLD) : F_GREEN);
+            mvprintw (y + 2, 14, "%6d", (y * 37 + ((y < 4) ? f : f / 10)) % 100000);
+            attrset (A_NORMAL);
+            mvprintw (y + 2, 24, "last update %d", f / 25);
+        }
+        refresh ();
+    }
+    bench_stop ();
+
+    bench_start ("editor cursor moves");
+    for (i = 0; i < 20 * BENCH_FRAMES; i++)
+    {
+        y = 2 + (i / 7) % 20;
+        x = 40 + (i * 3) % 30;
+        mvaddch (y, x, 'a' + i % 26);
+        move (y, x + (i % 3));
+        refresh ();
+    }
+    bench_stop ();
+
+    bench_start ("scrolling log");
+    setscrreg (2, LINES - 2);
+    for (i = 0; i < BENCH_FRAMES; i++)
+    {
+        move (LINES - 2, 0);
+        scroll ();
+        attrset ((i % 10) ? A_NORMAL : A_REVERSE);
+        mvprintw (LINES - 2, 0, "log line %d", i);
+        clrtoeol ();
+        refresh ();
+    }
+    bench_stop ();
+
+    endwin ();
+
+    for (i = 0; i < bench_no; i++)
+    {
+        printf ("%-24s %8lu bytes\n", bench_name[i], bench_bytes[i]);
+    }
+    return 0;
+}
+
+#endif // unix
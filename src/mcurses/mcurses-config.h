@@ -28,5 +28,8 @@
 #define MCURSES_BAUD                115200L         // UART baudrate
 #define MCURSES_LINES               25              // 24 lines
 #define MCURSES_COLS                80              // 80 columns
+#ifndef MCURSES_VSCREEN_CELLS
+#define MCURSES_VSCREEN_CELLS       3072            // virtual screen used if LINES * COLS <= 3072, 0: write directly to terminal
+#endif
 
 #define MCURSES_UART_NUMBER         -1              // use external console driver
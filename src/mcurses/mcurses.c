@@ -49,6 +49,7 @@
 #include "stm32f4xx_rcc.h"
 #include "misc.h"
 #include "delay.h"
+#include "coro.h"
 #define PROGMEM
 #define PSTR(x)                                 (x)
 #define pgm_read_byte(s)                        (*s)
@@ -92,8 +93,37 @@ uint_fast8_t                                    mcurses_is_up = 0;
 uint_fast8_t                                    mcurses_cury = 0xff;            // current y position of cursor, public (getyx())
 uint_fast8_t                                    mcurses_curx = 0xff;            // current x position of cursor, public (getyx())
 
+static uint_fast16_t                            mcurses_attr = A_NORMAL;        // attributes set by attrset()
+static uint_fast16_t                            mcurses_phyattr = 0xffff;       // attributes of terminal, 0xffff: unknown
+static uint_fast8_t                             mcurses_charset = 0xff;         // charset of terminal, 0xff: unknown
+static uint_fast8_t                             mcurses_insert_mode = FALSE;    // insert mode of terminal
+static uint_fast8_t                             mcurses_phy_y = 0xff;           // y position of terminal cursor, 0xff: unknown
+static uint_fast8_t                             mcurses_phy_x = 0xff;           // x position of terminal cursor, 0xff: unknown
+
+uint32_t                                        mcurses_nbytes;                 // number of bytes sent to terminal, public
+
 static void                                     mcurses_puts_P (const char *);
 
+#if MCURSES_VSCREEN_CELLS > 0
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * virtual screen, see refresh()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#define MCURSES_VS_IDX(y,x)                     ((uint_fast16_t) (y) * COLS + (x))
+
+static uint8_t                                  mcurses_vs_ch[MCURSES_VSCREEN_CELLS];                       // virtual screen: characters
+static uint16_t                                 mcurses_vs_attr[MCURSES_VSCREEN_CELLS];                     // virtual screen: attributes
+static uint8_t                                  mcurses_ps_ch[MCURSES_VSCREEN_CELLS];                       // physical screen: characters
+static uint16_t                                 mcurses_ps_attr[MCURSES_VSCREEN_CELLS];                     // physical screen: attributes
+static uint8_t                                  mcurses_vs_first[256];                                      // first changed column of line
+static uint8_t                                  mcurses_vs_last[256];                                       // last changed column of line
+
+static uint_fast8_t                             mcurses_vs_on;                  // flag: virtual screen in use
+static uint_fast8_t                             mcurses_vs_clear;               // flag: clear terminal on next refresh
+
+static void                                     mcurses_vs_addch (uint_fast8_t, uint_fast8_t);
+#endif
+
 uint_fast8_t                                    LINES = MCURSES_LINES;
 uint_fast8_t                                    COLS  = MCURSES_COLS;
 
@@ -520,13 +550,13 @@ mcurses_phyio_flush_output ()
  */
 
 
-#define UART_TXBUFLEN                          128                              // 128 Bytes ringbuffer for UART
-#define UART_RXBUFLEN                          128                              // 128 Bytes ringbuffer for UART
+#include "ring.h"
 
-static volatile uint_fast8_t    uart_txbuf[UART_TXBUFLEN];                      // tx ringbuffer
-static volatile uint_fast8_t    uart_txsize = 0;                                // tx size
-static volatile uint_fast8_t    uart_rxbuf[UART_RXBUFLEN];                      // rx ringbuffer
-static volatile uint_fast8_t    uart_rxsize = 0;                                // rx size
+#define UART_TXBUFLEN                          128                              // 128 Bytes ringbuffer for UART, power of 2
+#define UART_RXBUFLEN                          128                              // 128 Bytes ringbuffer for UART, power of 2
+
+RING_DEFINE (uart_txring, UART_TXBUFLEN);                                       // tx ringbuffer
+RING_DEFINE (uart_rxring, UART_RXBUFLEN);                                       // rx ringbuffer
 
 #define UART_NUMBER             MCURSES_UART_NUMBER
 #define BAUD                    MCURSES_BAUD
@@ -719,24 +749,11 @@ mcurses_phyio_done (void)
 static void
 mcurses_phyio_putc (uint_fast8_t ch)
 {
-    static uint_fast8_t uart_txstop  = 0;                                       // tail
-
-    while (uart_txsize >= UART_TXBUFLEN)                                        // buffer full?
+    while (! ring_put (&uart_txring, ch))                                       // buffer full?
     {                                                                           // yes
         ;                                                                       // wait
     }
 
-    uart_txbuf[uart_txstop++] = ch;                                             // store character
-
-    if (uart_txstop >= UART_TXBUFLEN)                                           // at end of ringbuffer?
-    {                                                                           // yes
-        uart_txstop = 0;                                                        // reset to beginning
-    }
-
-    __disable_irq();
-    uart_txsize++;                                                              // increment used size
-    __enable_irq();
-
     USART_ITConfig(UART_NAME, USART_IT_TXE, ENABLE);                           // enable TXE interrupt
 }
 
@@ -763,10 +780,9 @@ mcurses_phyio_putc (uint_fast8_t ch)
 static uint_fast8_t
 mcurses_phyio_getc (void)
 {
-    static uint_fast8_t  uart_rxstart = 0;                                      // head
-    uint_fast8_t         ch;
+    uint8_t              ch;
 
-    while (uart_rxsize == 0)                                                    // rx buffer empty?
+    while (! ring_get (&uart_rxring, &ch))                                      // rx buffer empty?
     {                                                                           // yes, wait
         if (mcurses_nodelay)
         {                                                                       // or if nodelay set, return ERR
@@ -774,17 +790,6 @@ mcurses_phyio_getc (void)
         }
     }
 
-    ch = uart_rxbuf[uart_rxstart++];                                            // get character from ringbuffer
-
-    if (uart_rxstart == UART_RXBUFLEN)                                          // at end of rx buffer?
-    {                                                                           // yes
-        uart_rxstart = 0;                                                       // reset to beginning
-    }
-
-    __disable_irq();
-    uart_rxsize--;                                                              // decrement size
-    __enable_irq();
-
     return (ch);
 }
 
@@ -838,7 +843,7 @@ mcurses_phyio_halfdelay (uint_fast8_t tenths)
 static void
 mcurses_phyio_flush_output ()
 {
-    while (uart_txsize > 0)                                                     // tx buffer empty?
+    while (! ring_empty (&uart_txring))                                         // tx buffer empty?
     {
         ;                                                                       // no, wait
     }
@@ -850,9 +855,8 @@ mcurses_phyio_flush_output ()
  */
 void UART_IRQ_HANDLER (void)
 {
-    static uint_fast8_t     uart_rxstop  = 0;                                   // tail
     uint16_t                value;
-    uint_fast8_t            ch;
+    uint8_t                 ch;
 
     if (USART_GetITStatus (UART_NAME, USART_IT_RXNE) != RESET)
     {
@@ -861,37 +865,15 @@ void UART_IRQ_HANDLER (void)
 
         ch = value & 0xFF;
 
-        if (uart_rxsize < UART_RXBUFLEN)                                        // buffer full?
-        {                                                                       // no
-            uart_rxbuf[uart_rxstop++] = ch;                                     // store character
-
-            if (uart_rxstop >= UART_RXBUFLEN)                                   // at end of ringbuffer?
-            {                                                                   // yes
-                uart_rxstop = 0;                                                // reset to beginning
-            }
-
-            uart_rxsize++;                                                      // increment used size
-        }
+        (void) ring_put (&uart_rxring, ch);                                     // buffer full: character is lost
     }
 
     if (USART_GetITStatus (UART_NAME, USART_IT_TXE) != RESET)
     {
-        static uint_fast8_t  uart_txstart = 0;                                  // head
-        uint_fast8_t         ch;
-
         USART_ClearITPendingBit (UART_NAME, USART_IT_TXE);
 
-        if (uart_txsize > 0)                                                    // tx buffer empty?
+        if (ring_get (&uart_txring, &ch))                                       // tx buffer empty?
         {                                                                       // no
-            ch = uart_txbuf[uart_txstart++];                                    // get character to send, increment offset
-
-            if (uart_txstart == UART_TXBUFLEN)                                  // at end of tx buffer?
-            {                                                                   // yes
-                uart_txstart = 0;                                               // reset to beginning
-            }
-
-            uart_txsize--;                                                      // decrement size
-
             USART_SendData(UART_NAME, ch);
         }
         else
@@ -1325,6 +1307,7 @@ static void
 mcurses_putc (uint_fast8_t ch)
 {
     mcurses_phyio_putc (ch);
+    mcurses_nbytes++;
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -1372,50 +1355,157 @@ mcurses_puti (uint_fast8_t i)
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
- * INTERN: addch or insch a character
+ * INTERN: put a character, switch between G0 and G1 charset if necessary (raw)
  *---------------------------------------------------------------------------------------------------------------------------------------------------
  */
 #define CHARSET_G0      0
 #define CHARSET_G1      1
 
+#define IS_G1_CHAR(ch)  ((ch) >= 0x80 && (ch) <= 0x9F)
+
 static void
-mcurses_addch_or_insch (uint_fast8_t ch, uint_fast8_t insert)
+mcurses_putch (uint_fast8_t ch)
 {
-    static uint_fast8_t  charset = 0xff;
-    static uint_fast8_t  insert_mode = FALSE;
-
-    if (ch >= 0x80 && ch <= 0x9F)
+    if (IS_G1_CHAR(ch))
     {
-        if (charset != CHARSET_G1)
+        if (mcurses_charset != CHARSET_G1)
         {
             mcurses_putc ('\016');                                              // switch to G1 set
-            charset = CHARSET_G1;
+            mcurses_charset = CHARSET_G1;
         }
         ch -= 0x20;                                                             // subtract offset to G1 characters
     }
     else
     {
-        if (charset != CHARSET_G0)
+        if (mcurses_charset != CHARSET_G0)
         {
             mcurses_putc ('\017');                                              // switch to G0 set
-            charset = CHARSET_G0;
+            mcurses_charset = CHARSET_G0;
+        }
+    }
+
+    mcurses_putc (ch);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: set attributes of terminal (raw)
+ *
+ * If attributes are only added or colors changed, only the differences are sent, e.g. "\033[7m". Switching off an attribute or a color
+ * needs a reset, then all attributes are sent, e.g. "\033[0;34;1m".
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#define SGR_FLAGS               (A_REVERSE | A_UNDERLINE | A_BLINK | A_BOLD | A_DIM)
+#define SGR_FCOLOR(a)           (((a) & F_COLOR) >> 8)
+#define SGR_BCOLOR(a)           (((a) & B_COLOR) >> 12)
+#define SGR_IS_COLOR(idx)       ((idx) >= 1 && (idx) <= 8)
+
+static void
+mcurses_sgr_param (const char * seq, uint_fast8_t * firstp)
+{
+    if (*firstp)
+    {
+        seq++;                                                                  // skip ';' before first parameter
+        *firstp = FALSE;
+    }
+
+    mcurses_puts_P (seq);
+}
+
+static void
+mcurses_sgr (uint_fast16_t attr)
+{
+    uint_fast16_t           old = mcurses_phyattr;
+    uint_fast16_t           add;
+    uint_fast8_t            first = TRUE;
+    uint_fast8_t            idx;
+
+    if (attr != old)
+    {
+        if (old == 0xffff || (old & ~attr & SGR_FLAGS) ||
+            (SGR_FCOLOR(attr) != SGR_FCOLOR(old) && ! SGR_IS_COLOR(SGR_FCOLOR(attr))) ||
+            (SGR_BCOLOR(attr) != SGR_BCOLOR(old) && ! SGR_IS_COLOR(SGR_BCOLOR(attr))))
+        {
+            mcurses_puts_P (SEQ_ATTRSET);                                       // reset, then set all attributes
+            old     = A_NORMAL;
+            first   = FALSE;
+        }
+        else
+        {
+            mcurses_puts_P (SEQ_CSI);                                           // add attributes, change colors
+        }
+
+        idx = SGR_FCOLOR(attr);
+
+        if (SGR_IS_COLOR(idx) && idx != SGR_FCOLOR(old))
+        {
+            mcurses_sgr_param (SEQ_ATTRSET_FCOLOR, &first);
+            mcurses_putc (idx - 1 + '0');
+        }
+
+        idx = SGR_BCOLOR(attr);
+
+        if (SGR_IS_COLOR(idx) && idx != SGR_BCOLOR(old))
+        {
+            mcurses_sgr_param (SEQ_ATTRSET_BCOLOR, &first);
+            mcurses_putc (idx - 1 + '0');
+        }
+
+        add = attr & ~old;
+
+        if (add & A_REVERSE)
+        {
+            mcurses_sgr_param (SEQ_ATTRSET_REVERSE, &first);
+        }
+        if (add & A_UNDERLINE)
+        {
+            mcurses_sgr_param (SEQ_ATTRSET_UNDERLINE, &first);
+        }
+        if (add & A_BLINK)
+        {
+            mcurses_sgr_param (SEQ_ATTRSET_BLINK, &first);
+        }
+        if (add & A_BOLD)
+        {
+            mcurses_sgr_param (SEQ_ATTRSET_BOLD, &first);
         }
+        if (add & A_DIM)
+        {
+            mcurses_sgr_param (SEQ_ATTRSET_DIM, &first);
+        }
+        mcurses_putc ('m');
+        mcurses_phyattr = attr;
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: addch or insch a character
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+mcurses_addch_or_insch (uint_fast8_t ch, uint_fast8_t insert)
+{
+#if MCURSES_VSCREEN_CELLS > 0
+    if (mcurses_vs_on)
+    {
+        mcurses_vs_addch (ch, insert);
+        return;
     }
+#endif
 
     if (insert)
     {
-        if (! insert_mode)
+        if (! mcurses_insert_mode)
         {
             mcurses_puts_P (SEQ_INSERT_MODE);
-            insert_mode = TRUE;
+            mcurses_insert_mode = TRUE;
         }
     }
     else
     {
-        if (insert_mode)
+        if (mcurses_insert_mode)
         {
             mcurses_puts_P (SEQ_REPLACE_MODE);
-            insert_mode = FALSE;
+            mcurses_insert_mode = FALSE;
         }
     }
 
@@ -1423,6 +1513,7 @@ mcurses_addch_or_insch (uint_fast8_t ch, uint_fast8_t insert)
     {
         mcurses_putc (ch);
         mcurses_curx = 0;
+        mcurses_phy_x = 0;
     }
     else if (ch == '\n')
     {
@@ -1432,11 +1523,24 @@ mcurses_addch_or_insch (uint_fast8_t ch, uint_fast8_t insert)
         {
             mcurses_cury++;
         }
+        mcurses_phy_y = mcurses_cury;
+        mcurses_phy_x = 0xff;                                                   // driver may send CR LF
     }
     else if (mcurses_curx < COLS)
     {
-        mcurses_putc (ch);
+        mcurses_putch (ch);
         mcurses_curx++;
+
+        if (ch >= ' ' && mcurses_curx < COLS)
+        {
+            mcurses_phy_y = mcurses_cury;
+            mcurses_phy_x = mcurses_curx;
+        }
+        else
+        {
+            mcurses_phy_y = 0xff;                                               // pending wrap or control character
+            mcurses_phy_x = 0xff;
+        }
     }
 }
 
@@ -1462,207 +1566,813 @@ mysetscrreg (uint_fast8_t top, uint_fast8_t bottom)
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
- * move cursor (raw)
+ * move cursor (raw), parameters with value 1 are omitted, e.g. "\033[H" for home position
  *---------------------------------------------------------------------------------------------------------------------------------------------------
  */
 static void
 mymove (uint_fast8_t y, uint_fast8_t x)
 {
     mcurses_puts_P (SEQ_CSI);
-    mcurses_puti (y + 1);
-    mcurses_putc (';');
-    mcurses_puti (x + 1);
-    mcurses_putc ('H');
-}
-
-/*---------------------------------------------------------------------------------------------------------------------------------------------------
- * MCURSES: initialize
- *---------------------------------------------------------------------------------------------------------------------------------------------------
- */
-uint_fast8_t
-initscr (void)
-{
-    uint_fast8_t y;
-    uint_fast8_t x;
-    uint_fast8_t rtc;
 
-    if (mcurses_phyio_init ())
+    if (y > 0)
     {
-        mymove (254, 254);                                                          // 255 + 1 = 256 is too much for PuTTY
-
-        if (queryyx (&y, &x) == OK)
-        {
-            LINES = y + 1;
-            COLS  = x + 1;
-        }
-        else
-        {
-            LINES = MCURSES_LINES;
-            COLS  = MCURSES_COLS;
-        }
-
-        mcurses_scrl_end = LINES - 1;
-
-        mcurses_puts_P (SEQ_LOAD_G1);                                               // load graphic charset into G1
-        attrset (A_NORMAL);
-        clear ();
-        move (0, 0);
-        mcurses_is_up = 1;
-        rtc = OK;
+        mcurses_puti (y + 1);
     }
-    else
+
+    if (x > 0)
     {
-        rtc = ERR;
+        mcurses_putc (';');
+        mcurses_puti (x + 1);
     }
-    return rtc;
+
+    mcurses_putc ('H');
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
- * MCURSES: add character
+ * Cursor motion:
+ *
+ * mcurses_phy_y and mcurses_phy_x hold the position of the terminal cursor. mcurses_goto() computes the length of each way to the new
+ * position and sends the shortest one:
+ *
+ *   absolute   ESC [ y ; x H
+ *   relative   ESC [ n A/B/C/D, n omitted if 1, or n backspaces instead of ESC [ n D
+ *   CR/LF      CR to column 0, before that n LFs down. LF is always followed by CR, so it does not matter if a driver sends CR LF.
+ *   rewrite    send the characters between old and new position again, only with virtual screen and only if they look the same
+ *              with the current attributes and charset of the terminal
+ *
+ * If the position of the terminal cursor is unknown, e.g. after the last column has been written (pending wrap), the move is absolute.
  *---------------------------------------------------------------------------------------------------------------------------------------------------
  */
-void
-addch (uint_fast8_t ch)
-{
-    mcurses_addch_or_insch (ch, FALSE);
-}
+#define MCURSES_DIGITS(n)       (((n) < 10) ? 1 : (((n) < 100) ? 2 : 3))
+#define MCURSES_CSI_COST(n)     (((n) == 1) ? 3 : 3 + MCURSES_DIGITS(n))        // length of ESC [ n C
+
+#define MCURSES_H_NONE          0                                               // horizontal moves
+#define MCURSES_H_RIGHT         1
+#define MCURSES_H_LEFT          2
+#define MCURSES_H_BACKSPACE     3
+#define MCURSES_H_REWRITE       4
 
+#define MCURSES_GOTO_ABS        0                                               // ways to new position
+#define MCURSES_GOTO_REL        1
+#define MCURSES_GOTO_CR         2
+#define MCURSES_GOTO_LF         3
+
+#if MCURSES_VSCREEN_CELLS > 0
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
- * MCURSES: add string
+ * INTERN: check if character ch with attributes attr1 looks like ch with attr2: blanks without A_REVERSE don't show F_COLOR, A_BOLD, A_DIM
  *---------------------------------------------------------------------------------------------------------------------------------------------------
  */
-void
-addstr (const char * str)
+static uint_fast8_t
+mcurses_same_look (uint_fast8_t ch, uint_fast16_t attr1, uint_fast16_t attr2)
 {
-    while (*str)
+    if (attr1 == attr2)
     {
-        mcurses_addch_or_insch (*str++, FALSE);
+        return TRUE;
     }
+
+    return (ch == ' ' && attr1 != 0xffff && attr2 != 0xffff && ! ((attr1 | attr2) & A_REVERSE) &&
+            ! ((attr1 ^ attr2) & (B_COLOR | A_UNDERLINE | A_BLINK)));
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
- * MCURSES: add string
+ * INTERN: check if columns x0 - x1 - 1 of line y can be sent again without change of attributes or charset
  *---------------------------------------------------------------------------------------------------------------------------------------------------
  */
-void
-addstr_P (const char * str)
+static uint_fast8_t
+mcurses_rewrite_ok (uint_fast8_t y, uint_fast8_t x0, uint_fast8_t x1)
 {
-    uint_fast8_t ch;
+    uint_fast16_t   idx = MCURSES_VS_IDX(y, x0);
 
-    while ((ch = pgm_read_byte(str)) != '\0')
+    if (! mcurses_vs_on || mcurses_phyattr == 0xffff)
     {
-        mcurses_addch_or_insch (ch, FALSE);
-        str++;
+        return FALSE;
+    }
+
+    while (x0 < x1)
+    {
+        if (! mcurses_same_look (mcurses_ps_ch[idx], mcurses_ps_attr[idx], mcurses_phyattr) ||
+            (IS_G1_CHAR(mcurses_ps_ch[idx]) ? CHARSET_G1 : CHARSET_G0) != mcurses_charset)
+        {
+            return FALSE;
+        }
+        x0++;
+        idx++;
     }
+    return TRUE;
 }
+#else
+#define mcurses_rewrite_ok(y,x0,x1)     FALSE
+#endif // MCURSES_VSCREEN_CELLS > 0
 
-#if defined(unix) || defined(STM32F4XX)
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
- *  MCURSES: add formatted string (va_list)
+ * INTERN: send CSI sequence with one numeric parameter, 1 is omitted (raw)
  *---------------------------------------------------------------------------------------------------------------------------------------------------
  */
-void
-vprintw (const char * fmt, va_list ap)
+static void
+mcurses_csi (uint_fast8_t n, uint_fast8_t ch)
 {
-    static char str_buf[256];
+    mcurses_puts_P (SEQ_CSI);
 
-    (void) vsprintf ((char *) str_buf, fmt, ap);
-    (void) addstr (str_buf);
-} /* vprintw (fmt, ap) */
+    if (n != 1)
+    {
+        mcurses_puti (n);
+    }
 
+    mcurses_putc (ch);
+}
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
- *  MCURSES: add formatted string (variable numer of arguments)
+ * INTERN: get length and kind of shortest move from column from to column x on line y
  *---------------------------------------------------------------------------------------------------------------------------------------------------
  */
-void
-printw (const char * fmt, ...)
+static uint_fast8_t
+mcurses_hcost (uint_fast8_t y, uint_fast8_t from, uint_fast8_t x, uint_fast8_t * hmovep)
 {
-    va_list ap;
-
-    va_start (ap, fmt);
-    vprintw (fmt, ap);
-    va_end (ap);
-} /* printw (fmt, ...) */
+    uint_fast8_t    cost;
+    uint_fast8_t    n;
 
-#if defined(STM32F4XX)
-// (v)sprintf needs it
-caddr_t _sbrk(int increment)
-{
-    extern char end asm("end");
-    register char * pStack asm("sp");
-    static char *   s_pHeapEnd;
+#if MCURSES_VSCREEN_CELLS == 0
+    (void) y;                                                                   // only used by mcurses_rewrite_ok()
+#endif
 
-    if (!s_pHeapEnd)
+    if (x > from)
     {
-        s_pHeapEnd = &end;
+        n       = x - from;
+        cost    = MCURSES_CSI_COST(n);
+        *hmovep = MCURSES_H_RIGHT;
+
+        if (n < cost && mcurses_rewrite_ok (y, from, x))
+        {
+            cost    = n;
+            *hmovep = MCURSES_H_REWRITE;
+        }
     }
+    else if (x < from)
+    {
+        n       = from - x;
+        cost    = MCURSES_CSI_COST(n);
+        *hmovep = MCURSES_H_LEFT;
 
-    if (s_pHeapEnd + increment > pStack)
+        if (n < cost)
+        {
+            cost    = n;
+            *hmovep = MCURSES_H_BACKSPACE;
+        }
+    }
+    else
     {
-        return (caddr_t) -1;
+        cost    = 0;
+        *hmovep = MCURSES_H_NONE;
     }
 
-    char * pOldHeapEnd = s_pHeapEnd;
-    s_pHeapEnd += increment;
-    return (caddr_t) pOldHeapEnd;
+    return cost;
 }
-#endif
-#endif
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
- * MCURSES: set attribute(s)
+ * INTERN: move from column from to column x on line y (raw)
  *---------------------------------------------------------------------------------------------------------------------------------------------------
  */
-void
-attrset (uint_fast16_t attr)
+static void
+mcurses_hmove (uint_fast8_t y, uint_fast8_t from, uint_fast8_t x, uint_fast8_t hmove)
 {
-    static uint_fast16_t    mcurses_attr = 0xffff;                    // current attributes
-    uint_fast8_t            idx;
-
-    if (attr != mcurses_attr)
+    switch (hmove)
     {
-        mcurses_puts_P (SEQ_ATTRSET);
-
-        idx = (attr & F_COLOR) >> 8;
-
-        if (idx >= 1 && idx <= 8)
+        case MCURSES_H_RIGHT:
+            mcurses_csi (x - from, 'C');
+            break;
+        case MCURSES_H_LEFT:
+            mcurses_csi (from - x, 'D');
+            break;
+        case MCURSES_H_BACKSPACE:
+            while (from-- > x)
+            {
+                mcurses_putc ('\b');
+            }
+            break;
+#if MCURSES_VSCREEN_CELLS > 0
+        case MCURSES_H_REWRITE:
         {
-            mcurses_puts_P (SEQ_ATTRSET_FCOLOR);
-            mcurses_putc (idx - 1 + '0');
-        }
+            uint_fast16_t idx = MCURSES_VS_IDX(y, from);
 
-        idx = (attr & B_COLOR) >> 12;
-
-        if (idx >= 1 && idx <= 8)
-        {
-            mcurses_puts_P (SEQ_ATTRSET_BCOLOR);
-            mcurses_putc (idx - 1 + '0');
+            while (from++ < x)
+            {
+                mcurses_putch (mcurses_ps_ch[idx++]);
+            }
+            break;
         }
+#endif
+    }
+    (void) y;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: move terminal cursor the shortest way (raw)
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+mcurses_goto (uint_fast8_t y, uint_fast8_t x)
+{
+    uint_fast8_t    py      = mcurses_phy_y;
+    uint_fast8_t    px      = mcurses_phy_x;
+    uint_fast8_t    way     = MCURSES_GOTO_ABS;
+    uint_fast16_t   best;
+    uint_fast16_t   vcost;                                                      // ESC [ n A/B
+    uint_fast16_t   lfcost  = 0xffff;                                           // n LFs
+    uint_fast16_t   hcost;                                                      // horizontal move from px
+    uint_fast16_t   crcost;                                                     // CR and horizontal move from column 0
+    uint_fast8_t    hmove   = MCURSES_H_NONE;
+    uint_fast8_t    crmove  = MCURSES_H_NONE;
+
+    if (py == y && px == x)
+    {
+        return;
+    }
 
-        if (attr & A_REVERSE)
+    if (y >= LINES || x >= COLS)                                                // terminal limits position, which is then unknown
+    {
+        mymove (y, x);
+        mcurses_phy_y = 0xff;
+        mcurses_phy_x = 0xff;
+        return;
+    }
+
+    best = 3 + ((y > 0) ? MCURSES_DIGITS(y + 1) : 0) + ((x > 0) ? 1 + MCURSES_DIGITS(x + 1) : 0);
+
+    if (py < LINES && px < COLS)
+    {
+        if (y > py)
+        {
+            vcost   = MCURSES_CSI_COST(y - py);
+            lfcost  = y - py;
+        }
+        else if (y < py)
         {
-            mcurses_puts_P (SEQ_ATTRSET_REVERSE);
+            vcost   = MCURSES_CSI_COST(py - y);
         }
-        if (attr & A_UNDERLINE)
+        else
         {
-            mcurses_puts_P (SEQ_ATTRSET_UNDERLINE);
+            vcost   = 0;
         }
-        if (attr & A_BLINK)
+
+        hcost   = mcurses_hcost (y, px, x, &hmove);
+        crcost  = 1 + mcurses_hcost (y, 0, x, &crmove);
+
+        if (vcost + hcost < best)
         {
-            mcurses_puts_P (SEQ_ATTRSET_BLINK);
+            best    = vcost + hcost;
+            way     = MCURSES_GOTO_REL;
         }
-        if (attr & A_BOLD)
+
+        if (vcost + crcost < best)
         {
-            mcurses_puts_P (SEQ_ATTRSET_BOLD);
+            best    = vcost + crcost;
+            way     = MCURSES_GOTO_CR;
         }
-        if (attr & A_DIM)
+
+        if (lfcost + crcost < best)
         {
-            mcurses_puts_P (SEQ_ATTRSET_DIM);
+            way     = MCURSES_GOTO_LF;
         }
-        mcurses_putc ('m');
-        mcurses_attr = attr;
     }
+
+    switch (way)
+    {
+        case MCURSES_GOTO_ABS:
+            mymove (y, x);
+            break;
+        case MCURSES_GOTO_LF:
+            while (py++ < y)
+            {
+                mcurses_putc ('\n');
+            }
+            mcurses_putc ('\r');
+            mcurses_hmove (y, 0, x, crmove);
+            break;
+        default:                                                                // MCURSES_GOTO_REL or MCURSES_GOTO_CR
+            if (y > py)
+            {
+                mcurses_csi (y - py, 'B');
+            }
+            else if (y < py)
+            {
+                mcurses_csi (py - y, 'A');
+            }
+
+            if (way == MCURSES_GOTO_CR)
+            {
+                mcurses_putc ('\r');
+                mcurses_hmove (y, 0, x, crmove);
+            }
+            else
+            {
+                mcurses_hmove (y, px, x, hmove);
+            }
+            break;
+    }
+
+    mcurses_phy_y = y;
+    mcurses_phy_x = x;
+}
+
+#if MCURSES_VSCREEN_CELLS > 0
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Virtual screen:
+ *
+ * If LINES * COLS fits into MCURSES_VSCREEN_CELLS, addch(), move(), attrset(), clear() etc. only change the virtual screen. refresh()
+ * compares it with the physical screen - a copy of what the terminal shows - and sends the changed cells only. Unchanged cells are
+ * skipped, attributes are sent only if they differ from those of the terminal and trailing blanks are cleared by one "clear to end
+ * of line". Only lines changed since the last refresh are compared. getch() calls refresh(), so programs without refresh() work as
+ * before. deleteln(), insertln() and scroll() are sent to the terminal at once, both screens are scrolled the same way.
+ *
+ * Both screens are in SRAM, CCM RAM is left to the RAM disk. initscr() clears the virtual screen, the first refresh() the terminal.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: mark columns x0 - x1 of line y as changed
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+mcurses_vs_touch (uint_fast8_t y, uint_fast8_t x0, uint_fast8_t x1)
+{
+    if (mcurses_vs_first[y] > x0)
+    {
+        mcurses_vs_first[y] = x0;
+    }
+
+    if (mcurses_vs_last[y] < x1)
+    {
+        mcurses_vs_last[y] = x1;
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: fill columns x0 - x1 of line y of virtual screen with blanks
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+mcurses_vs_fill (uint_fast8_t y, uint_fast8_t x0, uint_fast8_t x1)
+{
+    uint_fast16_t   idx = MCURSES_VS_IDX(y, x0);
+    uint_fast8_t    x;
+
+    for (x = x0; x <= x1; x++, idx++)
+    {
+        mcurses_vs_ch[idx]      = ' ';
+        mcurses_vs_attr[idx]    = mcurses_attr;
+    }
+
+    mcurses_vs_touch (y, x0, x1);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: addch or insch a character into virtual screen, control characters except CR and LF are ignored
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+mcurses_vs_addch (uint_fast8_t ch, uint_fast8_t insert)
+{
+    uint_fast16_t   idx;
+    uint_fast8_t    n;
+
+    if (ch == '\r')
+    {
+        mcurses_curx = 0;
+    }
+    else if (ch == '\n')
+    {
+        if (mcurses_cury < LINES - 1)
+        {
+            mcurses_cury++;
+        }
+    }
+    else if (ch >= ' ' && mcurses_curx < COLS)
+    {
+        idx = MCURSES_VS_IDX(mcurses_cury, mcurses_curx);
+
+        if (insert)
+        {
+            n = COLS - 1 - mcurses_curx;
+            memmove (mcurses_vs_ch + idx + 1, mcurses_vs_ch + idx, n);
+            memmove (mcurses_vs_attr + idx + 1, mcurses_vs_attr + idx, n * sizeof (uint16_t));
+            mcurses_vs_touch (mcurses_cury, mcurses_curx, COLS - 1);
+        }
+        else
+        {
+            mcurses_vs_touch (mcurses_cury, mcurses_curx, mcurses_curx);
+        }
+
+        mcurses_vs_ch[idx]      = ch;
+        mcurses_vs_attr[idx]    = mcurses_attr;
+        mcurses_curx++;
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: delete character at cursor position of virtual screen
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+mcurses_vs_delch (void)
+{
+    uint_fast16_t   idx;
+    uint_fast8_t    n;
+
+    if (mcurses_curx < COLS)
+    {
+        idx = MCURSES_VS_IDX(mcurses_cury, mcurses_curx);
+        n   = COLS - 1 - mcurses_curx;
+        memmove (mcurses_vs_ch + idx, mcurses_vs_ch + idx + 1, n);
+        memmove (mcurses_vs_attr + idx, mcurses_vs_attr + idx + 1, n * sizeof (uint16_t));
+        mcurses_vs_fill (mcurses_cury, COLS - 1, COLS - 1);
+        mcurses_vs_touch (mcurses_cury, mcurses_curx, COLS - 1);
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: scroll lines top - bottom of both screens one line up or down, the terminal has already done it
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+mcurses_vs_scroll (uint_fast8_t top, uint_fast8_t bottom, uint_fast8_t up)
+{
+    uint_fast16_t   from    = MCURSES_VS_IDX(top, 0);
+    uint_fast16_t   to      = from;
+    uint_fast16_t   n       = MCURSES_VS_IDX(bottom - top, 0);
+    uint_fast8_t    blank;
+    uint_fast16_t   idx;
+    uint_fast8_t    x;
+    uint_fast8_t    y;
+
+    if (up)
+    {
+        from   += COLS;
+        blank   = bottom;
+    }
+    else
+    {
+        to     += COLS;
+        blank   = top;
+    }
+
+    memmove (mcurses_vs_ch + to, mcurses_vs_ch + from, n);
+    memmove (mcurses_vs_attr + to, mcurses_vs_attr + from, n * sizeof (uint16_t));
+    memmove (mcurses_ps_ch + to, mcurses_ps_ch + from, n);
+    memmove (mcurses_ps_attr + to, mcurses_ps_attr + from, n * sizeof (uint16_t));
+
+    idx = MCURSES_VS_IDX(blank, 0);
+
+    for (x = 0; x < COLS; x++, idx++)
+    {
+        mcurses_ps_ch[idx]      = ' ';                                          // terminal uses its current attributes
+        mcurses_ps_attr[idx]    = mcurses_phyattr;
+    }
+
+    mcurses_vs_fill (blank, 0, COLS - 1);
+
+    for (y = top; y <= bottom; y++)
+    {
+        mcurses_vs_touch (y, 0, COLS - 1);
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: the terminal has deleted (up = TRUE) or inserted a line at line y within scrolling region t - b, do the same on both screens
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+mcurses_vs_scrreg (uint_fast8_t t, uint_fast8_t b, uint_fast8_t y, uint_fast8_t up)
+{
+    if (t >= b)                                                                 // reset or invalid scrolling region: whole screen
+    {
+        t = 0;
+        b = LINES - 1;
+    }
+
+    if (y >= t && y <= b)                                                       // outside of scrolling region: terminal ignores it
+    {
+        mcurses_vs_scroll (y, b, up);
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: send changed cells of line y
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+mcurses_vs_refresh_line (uint_fast8_t y)
+{
+    uint_fast16_t   row     = MCURSES_VS_IDX(y, 0);
+    uint_fast16_t   idx;
+    uint_fast16_t   attr    = mcurses_vs_attr[row + COLS - 1];
+    uint_fast8_t    last    = mcurses_vs_last[y];
+    uint_fast8_t    eol     = COLS;                                             // start of trailing blanks
+    uint_fast8_t    n;
+    uint_fast8_t    x;
+
+    while (eol > 0 && mcurses_vs_ch[row + eol - 1] == ' ' && mcurses_vs_attr[row + eol - 1] == attr)
+    {
+        eol--;
+    }
+
+    for (x = mcurses_vs_first[y]; x <= last; x++)
+    {
+        idx = row + x;
+
+        if (mcurses_vs_ch[idx] == mcurses_ps_ch[idx] && mcurses_same_look (mcurses_vs_ch[idx], mcurses_vs_attr[idx], mcurses_ps_attr[idx]))
+        {
+            continue;
+        }
+
+        if (x >= eol)                                                           // only blanks follow
+        {
+            for (n = 0; idx < row + COLS; idx++)
+            {
+                if (mcurses_ps_ch[idx] != ' ' || ! mcurses_same_look (' ', mcurses_ps_attr[idx], attr))
+                {
+                    n++;
+                }
+            }
+
+            if (n > 3)                                                          // more than length of SEQ_CLRTOEOL
+            {
+                mcurses_goto (y, x);
+
+                if (! mcurses_same_look (' ', attr, mcurses_phyattr))
+                {
+                    mcurses_sgr (attr);
+                }
+
+                mcurses_puts_P (SEQ_CLRTOEOL);
+
+                for (idx = row + x; idx < row + COLS; idx++)
+                {
+                    mcurses_ps_ch[idx]      = ' ';
+                    mcurses_ps_attr[idx]    = mcurses_phyattr;
+                }
+                break;
+            }
+
+            idx = row + x;
+        }
+
+        mcurses_goto (y, x);
+
+        if (! mcurses_same_look (mcurses_vs_ch[idx], mcurses_vs_attr[idx], mcurses_phyattr))
+        {
+            mcurses_sgr (mcurses_vs_attr[idx]);
+        }
+
+        mcurses_putch (mcurses_vs_ch[idx]);
+        mcurses_ps_ch[idx]      = mcurses_vs_ch[idx];
+        mcurses_ps_attr[idx]    = mcurses_phyattr;
+
+        if (x < COLS - 1)
+        {
+            mcurses_phy_x++;
+        }
+        else
+        {
+            mcurses_phy_x = 0xff;                                               // terminal cursor is in pending wrap state
+        }
+    }
+
+    mcurses_vs_first[y] = 0xff;
+    mcurses_vs_last[y]  = 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: send differences of virtual and physical screen to terminal
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+mcurses_vs_refresh (void)
+{
+    uint_fast16_t   idx;
+    uint_fast16_t   cells = MCURSES_VS_IDX(LINES, 0);
+    uint_fast8_t    y;
+
+    if (mcurses_vs_clear)
+    {
+        mcurses_sgr (A_NORMAL);
+        mcurses_puts_P (SEQ_CLEAR);
+
+        for (idx = 0; idx < cells; idx++)
+        {
+            mcurses_ps_ch[idx]      = ' ';
+            mcurses_ps_attr[idx]    = A_NORMAL;
+        }
+        mcurses_vs_clear = FALSE;
+    }
+
+    if (mcurses_insert_mode)
+    {
+        mcurses_puts_P (SEQ_REPLACE_MODE);
+        mcurses_insert_mode = FALSE;
+    }
+
+    for (y = 0; y < LINES; y++)
+    {
+        if (mcurses_vs_first[y] <= mcurses_vs_last[y])
+        {
+            mcurses_vs_refresh_line (y);
+        }
+    }
+
+    mcurses_goto (mcurses_cury, (mcurses_curx < COLS) ? mcurses_curx : COLS - 1);
+}
+#endif // MCURSES_VSCREEN_CELLS > 0
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * MCURSES: initialize
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast8_t
+initscr (void)
+{
+    uint_fast8_t y;
+    uint_fast8_t x;
+    uint_fast8_t rtc;
+
+    if (mcurses_phyio_init ())
+    {
+        mymove (254, 254);                                                          // 255 + 1 = 256 is too much for PuTTY
+
+        if (queryyx (&y, &x) == OK)
+        {
+            LINES = y + 1;
+            COLS  = x + 1;
+        }
+#if defined (STM32F4XX)
+        else if (console_get_size (&y, &x))                                         // no answer, but console output goes to TFT
+        {
+            LINES = y;
+            COLS  = x;
+        }
+#endif
+        else
+        {
+            LINES = MCURSES_LINES;
+            COLS  = MCURSES_COLS;
+        }
+
+#if defined (STM32F4XX)
+        if (console_get_size (&y, &x))                                              // use the smaller size of terminal and TFT
+        {
+            if (LINES > y)
+            {
+                LINES = y;
+            }
+
+            if (COLS > x)
+            {
+                COLS = x;
+            }
+        }
+#endif
+
+        mcurses_scrl_end = LINES - 1;
+
+        mcurses_puts_P (SEQ_LOAD_G1);                                               // load graphic charset into G1
+        mcurses_phy_y   = 0xff;                                                     // terminal cursor: see queryyx()
+        mcurses_phy_x   = 0xff;
+#if MCURSES_VSCREEN_CELLS > 0
+        mcurses_vs_on   = ((uint_fast16_t) LINES * COLS <= MCURSES_VSCREEN_CELLS);
+        memset (mcurses_vs_first, 0xff, sizeof (mcurses_vs_first));
+        memset (mcurses_vs_last, 0, sizeof (mcurses_vs_last));
+#endif
+        attrset (A_NORMAL);
+        clear ();
+#if MCURSES_VSCREEN_CELLS > 0
+        mcurses_vs_clear = TRUE;                                                    // contents of terminal unknown: clear it on refresh
+#endif
+        move (0, 0);
+        mcurses_is_up = 1;
+        rtc = OK;
+    }
+    else
+    {
+        rtc = ERR;
+    }
+    return rtc;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * MCURSES: add character
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+addch (uint_fast8_t ch)
+{
+    mcurses_addch_or_insch (ch, FALSE);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * MCURSES: add string
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+addstr (const char * str)
+{
+    while (*str)
+    {
+        mcurses_addch_or_insch (*str++, FALSE);
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * MCURSES: add string
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+addstr_P (const char * str)
+{
+    uint_fast8_t ch;
+
+    while ((ch = pgm_read_byte(str)) != '\0')
+    {
+        mcurses_addch_or_insch (ch, FALSE);
+        str++;
+    }
+}
+
+#if defined(unix) || defined(STM32F4XX)
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  MCURSES: add formatted string (va_list)
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+vprintw (const char * fmt, va_list ap)
+{
+    static char str_buf[256];
+
+    (void) vsprintf ((char *) str_buf, fmt, ap);
+    (void) addstr (str_buf);
+} /* vprintw (fmt, ap) */
+
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ *  MCURSES: add formatted string (variable numer of arguments)
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+printw (const char * fmt, ...)
+{
+    va_list ap;
+
+    va_start (ap, fmt);
+    vprintw (fmt, ap);
+    va_end (ap);
+} /* printw (fmt, ...) */
+
+#if defined(STM32F4XX)
+// (v)sprintf needs it
+caddr_t _sbrk(int increment)
+{
+    extern char end asm("end");
+    register char * pStack asm("sp");
+    static char *   s_pHeapEnd;
+    char *          pLimit = coro_main_sp ();                                   // stack of a coroutine is on the heap: limit by main stack
+
+    if (!pLimit)
+    {
+        pLimit = pStack;
+    }
+
+    if (!s_pHeapEnd)
+    {
+        s_pHeapEnd = &end;
+    }
+
+    if (s_pHeapEnd + increment > pLimit)
+    {
+        return (caddr_t) -1;
+    }
+
+    char * pOldHeapEnd = s_pHeapEnd;
+    s_pHeapEnd += increment;
+    return (caddr_t) pOldHeapEnd;
+}
+#endif
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * MCURSES: set attribute(s)
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+attrset (uint_fast16_t attr)
+{
+    mcurses_attr = attr;
+
+#if MCURSES_VSCREEN_CELLS > 0
+    if (mcurses_vs_on)
+    {
+        return;                                                                 // see refresh()
+    }
+#endif
+
+    mcurses_sgr (attr);
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -1672,11 +2382,20 @@ attrset (uint_fast16_t attr)
 void
 move (uint_fast8_t y, uint_fast8_t x)
 {
+#if MCURSES_VSCREEN_CELLS > 0
+    if (mcurses_vs_on)
+    {
+        mcurses_cury = y;                                                       // see refresh()
+        mcurses_curx = x;
+        return;
+    }
+#endif
+
     if (mcurses_cury != y || mcurses_curx != x)
     {
         mcurses_cury = y;
         mcurses_curx = x;
-        mymove (y, x);
+        mcurses_goto (y, x);
     }
 }
 
@@ -1692,6 +2411,15 @@ deleteln (void)
     mcurses_puts_P (SEQ_DELETELINE);                                            // delete line
     mysetscrreg (0, 0);                                                         // reset scrolling region
     mymove (mcurses_cury, mcurses_curx);                                        // restore position
+    mcurses_phy_y = mcurses_cury;
+    mcurses_phy_x = (mcurses_curx < COLS) ? mcurses_curx : 0xff;
+
+#if MCURSES_VSCREEN_CELLS > 0
+    if (mcurses_vs_on)
+    {
+        mcurses_vs_scrreg (mcurses_scrl_start, mcurses_scrl_end, mcurses_cury, TRUE);
+    }
+#endif
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -1706,6 +2434,15 @@ insertln (void)
     mcurses_puts_P (SEQ_INSERTLINE);                                            // insert line
     mysetscrreg (0, 0);                                                         // reset scrolling region
     mymove (mcurses_cury, mcurses_curx);                                        // restore position
+    mcurses_phy_y = mcurses_cury;
+    mcurses_phy_x = (mcurses_curx < COLS) ? mcurses_curx : 0xff;
+
+#if MCURSES_VSCREEN_CELLS > 0
+    if (mcurses_vs_on)
+    {
+        mcurses_vs_scrreg (mcurses_cury, mcurses_scrl_end, mcurses_cury, FALSE);
+    }
+#endif
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -1720,6 +2457,22 @@ scroll (void)
     mcurses_puts_P (SEQ_NEXTLINE);                                              // next line
     mysetscrreg (0, 0);                                                         // reset scrolling region
     mymove (mcurses_cury, mcurses_curx);                                        // restore position
+    mcurses_phy_y = mcurses_cury;
+    mcurses_phy_x = (mcurses_curx < COLS) ? mcurses_curx : 0xff;
+
+#if MCURSES_VSCREEN_CELLS > 0
+    if (mcurses_vs_on)
+    {
+        if (mcurses_scrl_start < mcurses_scrl_end)                              // next line on last line of region scrolls
+        {
+            mcurses_vs_scrreg (mcurses_scrl_start, mcurses_scrl_end, mcurses_scrl_start, TRUE);
+        }
+        else if (mcurses_scrl_end == LINES - 1)                                 // whole screen
+        {
+            mcurses_vs_scrreg (0, 0, 0, TRUE);
+        }
+    }
+#endif
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -1729,6 +2482,20 @@ scroll (void)
 void
 clear (void)
 {
+#if MCURSES_VSCREEN_CELLS > 0
+    uint_fast8_t    y;
+
+    if (mcurses_vs_on)
+    {
+        for (y = 0; y < LINES; y++)
+        {
+            mcurses_vs_fill (y, 0, COLS - 1);
+        }
+
+        return;
+    }
+#endif
+
     mcurses_puts_P (SEQ_CLEAR);
 }
 
@@ -1739,6 +2506,21 @@ clear (void)
 void
 clrtobot (void)
 {
+#if MCURSES_VSCREEN_CELLS > 0
+    uint_fast8_t    y;
+
+    if (mcurses_vs_on)
+    {
+        clrtoeol ();
+
+        for (y = mcurses_cury + 1; y < LINES; y++)
+        {
+            mcurses_vs_fill (y, 0, COLS - 1);
+        }
+        return;
+    }
+#endif
+
     mcurses_puts_P (SEQ_CLRTOBOT);
 }
 
@@ -1751,6 +2533,13 @@ clrtoeol (void)
 {
     if (mcurses_curx < COLS)
     {
+#if MCURSES_VSCREEN_CELLS > 0
+        if (mcurses_vs_on)
+        {
+            mcurses_vs_fill (mcurses_cury, mcurses_curx, COLS - 1);
+            return;
+        }
+#endif
         mcurses_puts_P (SEQ_CLRTOEOL);
     }
 }
@@ -1762,6 +2551,14 @@ clrtoeol (void)
 void
 delch (void)
 {
+#if MCURSES_VSCREEN_CELLS > 0
+    if (mcurses_vs_on)
+    {
+        mcurses_vs_delch ();
+        return;
+    }
+#endif
+
     mcurses_puts_P (SEQ_DELCH);
 }
 
@@ -1803,12 +2600,19 @@ curs_set (uint_fast8_t visibility)
 
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
- * MCURSES: refresh: flush output
+ * MCURSES: refresh: send changes of virtual screen, flush output
  *---------------------------------------------------------------------------------------------------------------------------------------------------
  */
 void
 refresh (void)
 {
+#if MCURSES_VSCREEN_CELLS > 0
+    if (mcurses_vs_on)
+    {
+        mcurses_vs_refresh ();
+    }
+#endif
+
     mcurses_phyio_flush_output ();
 }
 
@@ -2163,12 +2967,23 @@ getnstr (char * str, uint_fast8_t maxlen)
 void
 endwin (void)
 {
+#if MCURSES_VSCREEN_CELLS > 0
+    if (mcurses_vs_on)
+    {
+        refresh ();                                                             // show pending changes, cursor is up to date
+        mcurses_vs_on = FALSE;
+    }
+#endif
+
     mcurses_puts_P(SEQ_ATTRIBUTES_OFF);                                        // reset attributes
+    mcurses_phyattr = A_NORMAL;
     move (LINES - 1, 0);                                                        // move cursor to last line
     clrtoeol ();                                                                // clear this line
     mcurses_putc ('\017');                                                      // switch to G0 set
+    mcurses_charset = CHARSET_G0;
     curs_set (TRUE);                                                            // show cursor
     mcurses_puts_P(SEQ_REPLACE_MODE);                                           // reset insert mode
+    mcurses_insert_mode = FALSE;
     refresh ();                                                                 // flush output
     mcurses_phyio_done ();                                                      // end of physical I/O
     mcurses_is_up = 0;
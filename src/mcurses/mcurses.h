@@ -99,6 +99,7 @@ extern uint_fast8_t             COLS;
 extern uint_fast8_t             mcurses_is_up;                                      // flag: mcurses is up
 extern uint_fast8_t             mcurses_cury;                                       // do not use, use getyx() instead!
 extern uint_fast8_t             mcurses_curx;                                       // do not use, use getyx() instead!
+extern uint32_t                 mcurses_nbytes;                                     // number of bytes sent to terminal, may be reset
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
  * mcurses functions
@@ -130,7 +131,7 @@ extern void                     nodelay (uint_fast8_t);
 extern void                     halfdelay (uint_fast8_t);                           // set/reset halfdelay
 extern uint_fast8_t             getch (void);                                       // read key
 extern void                     curs_set(uint_fast8_t);                             // set cursor to: 0=invisible 1=normal 2=very visible
-extern void                     refresh (void);                                     // flush output
+extern void                     refresh (void);                                     // update terminal, flush output
 extern int                      queryyx (uint_fast8_t *, uint_fast8_t *);           // query cursor position from terminal
 extern void                     endwin (void);                                      // end mcurses
 
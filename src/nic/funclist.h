@@ -174,6 +174,12 @@ char * nici_functions[] =
     ITEM(nici_file_eof,                 "file.eof",                 1,      1,      FUNCTION_TYPE_INT),
     ITEM(nici_file_close,               "file.close",               1,      1,      FUNCTION_TYPE_VOID),
 
+    ITEM(nici_log_open,                 "log.open",                 2,      2,      FUNCTION_TYPE_INT),
+    ITEM(nici_log_write,                "log.write",                2,      2,      FUNCTION_TYPE_INT),
+    ITEM(nici_log_writeln,              "log.writeln",              2,      2,      FUNCTION_TYPE_INT),
+    ITEM(nici_log_sync,                 "log.sync",                 1,      1,      FUNCTION_TYPE_INT),
+    ITEM(nici_log_close,                "log.close",                1,      1,      FUNCTION_TYPE_VOID),
+
     ITEM(nici_tft_init,                 "tft.init",                 1,      1,      FUNCTION_TYPE_VOID),
     ITEM(nici_tft_rgb64_to_color565,    "tft.rgb64_to_color565",    3,      3,      FUNCTION_TYPE_INT),
     ITEM(nici_tft_rgb256_to_color565,   "tft.rgb256_to_color565",   3,      3,      FUNCTION_TYPE_INT),
@@ -190,12 +196,25 @@ char * nici_functions[] =
     ITEM(nici_tft_draw_thick_line,      "tft.draw_thick_line",      5,      5,      FUNCTION_TYPE_VOID),
     ITEM(nici_tft_draw_circle,          "tft.draw_circle",          4,      4,      FUNCTION_TYPE_VOID),
     ITEM(nici_tft_draw_thick_circle,    "tft.draw_thick_circle",    4,      4,      FUNCTION_TYPE_VOID),
+    ITEM(nici_tft_draw_wide_line,       "tft.draw_wide_line",       6,      6,      FUNCTION_TYPE_VOID),
+    ITEM(nici_tft_fill_circle,          "tft.fill_circle",          4,      4,      FUNCTION_TYPE_VOID),
+    ITEM(nici_tft_fill_ellipse,         "tft.fill_ellipse",         5,      5,      FUNCTION_TYPE_VOID),
+    ITEM(nici_tft_fill_triangle,        "tft.fill_triangle",        7,      7,      FUNCTION_TYPE_VOID),
+    ITEM(nici_tft_fill_polygon,         "tft.fill_polygon",         7,      33,     FUNCTION_TYPE_VOID),
     ITEM(nici_tft_draw_image,           "tft.draw_image",           4,      4,      FUNCTION_TYPE_VOID),
     ITEM(nici_tft_fonts,                "tft.fonts",                0,      0,      FUNCTION_TYPE_INT),
     ITEM(nici_tft_set_font,             "tft.set_font",             1,      1,      FUNCTION_TYPE_VOID),
     ITEM(nici_tft_font_height,          "tft.font_height",          0,      0,      FUNCTION_TYPE_INT),
     ITEM(nici_tft_font_width,           "tft.font_width",           0,      0,      FUNCTION_TYPE_INT),
     ITEM(nici_tft_draw_string,          "tft.draw_string",          5,      5,      FUNCTION_TYPE_VOID),
+    ITEM(nici_tft_comp_start,           "tft.comp_start",           1,      1,      FUNCTION_TYPE_VOID),
+    ITEM(nici_tft_comp_stop,            "tft.comp_stop",            0,      0,      FUNCTION_TYPE_VOID),
+    ITEM(nici_tft_comp_flush,           "tft.comp_flush",           0,      0,      FUNCTION_TYPE_INT),
+    ITEM(nici_tft_wait_vblank,          "tft.wait_vblank",          0,      0,      FUNCTION_TYPE_VOID),
+    ITEM(nici_tft_frame_sync,           "tft.frame_sync",           1,      1,      FUNCTION_TYPE_INT),
+    ITEM(nici_tft_frame_count,          "tft.frame_count",          0,      0,      FUNCTION_TYPE_INT),
+    ITEM(nici_tft_draw_file,            "tft.draw_file",            3,      3,      FUNCTION_TYPE_INT),
+    ITEM(nici_tft_profile,              "tft.profile",              2,      2,      FUNCTION_TYPE_INT),
 
     ITEM(flash_device_id,               "flash.device_id",          0,      0,      FUNCTION_TYPE_INT),
     ITEM(flash_statusreg1,              "flash.statusreg1",         0,      0,      FUNCTION_TYPE_INT),
@@ -53,6 +53,7 @@
 #include "w25qxx.h"
 #include "base.h"
 #include "timer2.h"
+#include "fs.h"
 #endif
 
 #include "font.h"
@@ -629,7 +630,13 @@ nici_time_delay (FIP_RUN * fip)
     }
 #else
     int msec = get_argument_int (fip, 0);
-    delay_msec (msec);
+
+    while (msec > 0)                                                            // slices of 10 msec, the display may switch to low power
+    {
+        tft_power_poll ();
+        delay_msec (msec > 10 ? 10 : msec);
+        msec -= 10;
+    }
 #endif
     return FUNCTION_TYPE_VOID;
 }
@@ -1323,7 +1330,7 @@ nici_uart_print (FIP_RUN * fip)
     int     uart_number = get_argument_int (fip, 0);
     char *  str         = (char *) get_argument_string (fip, 1);
 
-    uart_puts (uart_number, str);
+    uart_write (uart_number, str, strlen (str));
     return FUNCTION_TYPE_VOID;
 }
 
@@ -1337,9 +1344,8 @@ nici_uart_println (FIP_RUN * fip)
     int     uart_number = get_argument_int (fip, 0);
     char * str = (char *) get_argument_string (fip, 1);
 
-    uart_puts (uart_number, str);
-    uart_putc (uart_number, '\r');
-    uart_putc (uart_number, '\n');
+    uart_write (uart_number, str, strlen (str));
+    uart_write (uart_number, "\r\n", 2);
     return FUNCTION_TYPE_VOID;
 }
 
@@ -2035,7 +2041,14 @@ nici_file_open (FIP_RUN * fip)
 
     if (idx < MAX_OPEN_FILES)
     {
-        fp = fopen ((char *) fname, (char *) mode);
+        if (! strcmp ((char *) fname, "-"))                                     // stdin, e.g. right command of a pipeline
+        {
+            fp = stdin;
+        }
+        else
+        {
+            fp = fopen ((char *) fname, (char *) mode);
+        }
 
         if (fp)
         {
@@ -2241,13 +2254,189 @@ nici_file_close (FIP_RUN * fip)
 
     if (hdl >= 0 && hdl < MAX_OPEN_FILES && openfp[hdl])
     {
-        fclose (openfp[hdl]);
+        if (openfp[hdl] != stdin)
+        {
+            fclose (openfp[hdl]);
+        }
         openfp[hdl] = (FILE *) NULL;
     }
 
     return FUNCTION_TYPE_VOID;
 }
 
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * LOG routines - append only files with preallocated contiguous extent
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if defined (unix) || defined (WIN32)
+#define FS_MAX_LOG_FILES    2                                                   // same limit as fs.h on the target
+static FILE * openlogfp[FS_MAX_LOG_FILES];
+#else
+static int    openlog[FS_MAX_LOG_FILES];                                        // fs_log handle + 1, 0 = closed
+#endif
+
+static int
+log_is_open (int hdl)
+{
+#if defined (unix) || defined (WIN32)
+    return (hdl >= 0 && hdl < FS_MAX_LOG_FILES && openlogfp[hdl]);
+#else
+    return (hdl >= 0 && hdl < FS_MAX_LOG_FILES && openlog[hdl] > 0);
+#endif
+}
+
+static int
+log_write (int hdl, unsigned char * str, int len)                               // returns number of bytes written or -1
+{
+#if defined (unix) || defined (WIN32)
+    return (fwrite (str, 1, len, openlogfp[hdl]) == (size_t) len) ? len : -1;
+#else
+    return fs_log_write (openlog[hdl] - 1, str, len);                           // less than len if the log is full
+#endif
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * nici_log_open ()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+nici_log_open (FIP_RUN * fip)
+{
+    unsigned char * fname   = get_argument_string (fip, 0);
+    int             size    = get_argument_int (fip, 1);
+    int             idx;
+    int             rtc     = -1;
+
+    for (idx = 0; idx < FS_MAX_LOG_FILES; idx++)
+    {
+        if (! log_is_open (idx))
+        {
+            break;
+        }
+    }
+
+    if (idx < FS_MAX_LOG_FILES && size > 0)
+    {
+#if defined (unix) || defined (WIN32)
+        FILE * fp = fopen ((char *) fname, "w");
+
+        if (fp)
+        {
+            openlogfp[idx] = fp;
+            rtc = idx;
+        }
+#else
+        int fd = fs_log_open ((char *) fname, size);
+
+        if (fd >= 0)
+        {
+            openlog[idx] = fd + 1;
+            rtc = idx;
+        }
+#endif
+    }
+
+    fip->reti = rtc;
+    return FUNCTION_TYPE_INT;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * nici_log_write () - returns number of bytes written, less if the log is full, or -1
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+nici_log_write (FIP_RUN * fip)
+{
+    int             hdl = get_argument_int (fip, 0);
+    unsigned char * str = get_argument_string (fip, 1);
+    int             rtc = -1;
+
+    if (log_is_open (hdl))
+    {
+        rtc = log_write (hdl, str, strlen ((char *) str));
+    }
+
+    fip->reti = rtc;
+    return FUNCTION_TYPE_INT;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * nici_log_writeln () - returns number of bytes written including the newline, less if the log is full, or -1
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+nici_log_writeln (FIP_RUN * fip)
+{
+    int             hdl = get_argument_int (fip, 0);
+    unsigned char * str = get_argument_string (fip, 1);
+    int             len = strlen ((char *) str);
+    int             rtc = -1;
+
+    if (log_is_open (hdl))
+    {
+        rtc = log_write (hdl, str, len);
+
+        if (rtc == len)
+        {
+            rtc = log_write (hdl, (unsigned char *) "\n", 1);
+
+            if (rtc >= 0)
+            {
+                rtc += len;
+            }
+        }
+    }
+
+    fip->reti = rtc;
+    return FUNCTION_TYPE_INT;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * nici_log_sync ()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+nici_log_sync (FIP_RUN * fip)
+{
+    int     hdl = get_argument_int (fip, 0);
+    int     rtc = -1;
+
+    if (log_is_open (hdl))
+    {
+#if defined (unix) || defined (WIN32)
+        rtc = fflush (openlogfp[hdl]);
+#else
+        rtc = fs_log_sync (openlog[hdl] - 1);
+#endif
+    }
+
+    fip->reti = rtc;
+    return FUNCTION_TYPE_INT;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * nici_log_close ()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+nici_log_close (FIP_RUN * fip)
+{
+    int     hdl = get_argument_int (fip, 0);
+
+    if (log_is_open (hdl))
+    {
+#if defined (unix) || defined (WIN32)
+        fclose (openlogfp[hdl]);
+        openlogfp[hdl] = (FILE *) NULL;
+#else
+        fs_log_close (openlog[hdl] - 1);
+        openlog[hdl] = 0;
+#endif
+    }
+
+    return FUNCTION_TYPE_VOID;
+}
+
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
  * nici_file_close_all_open_files ()
  *---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -2262,10 +2451,29 @@ nici_file_close_all_open_files (void)
         if (openfp[idx])
         {
             fprintf (stderr, "file #%d automatically closed\n", idx);
-            fclose (openfp[idx]);
+
+            if (openfp[idx] != stdin)
+            {
+                fclose (openfp[idx]);
+            }
             openfp[idx] = (FILE *) NULL;
         }
     }
+
+    for (idx = 0; idx < FS_MAX_LOG_FILES; idx++)
+    {
+        if (log_is_open (idx))
+        {
+            fprintf (stderr, "log #%d automatically closed\n", idx);
+#if defined (unix) || defined (WIN32)
+            fclose (openlogfp[idx]);
+            openlogfp[idx] = (FILE *) NULL;
+#else
+            fs_log_close (openlog[idx] - 1);
+            openlog[idx] = 0;
+#endif
+        }
+    }
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -3014,6 +3222,125 @@ nici_tft_draw_thick_circle (FIP_RUN * fip)
     return FUNCTION_TYPE_VOID;
 }
 
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * nici_tft_draw_wide_line () - draw line of given width
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+nici_tft_draw_wide_line (FIP_RUN * fip)
+{
+    int             x0          = get_argument_int (fip, 0);
+    int             y0          = get_argument_int (fip, 1);
+    int             x1          = get_argument_int (fip, 2);
+    int             y1          = get_argument_int (fip, 3);
+    int             width       = get_argument_int (fip, 4);
+    uint_fast16_t   color565    = get_argument_int (fip, 5);
+
+#if defined (unix) || defined (WIN32)
+    printf ("tft_draw_wide_line (%3d, %3d, %3d, %3d, %3d, 0x%04x)\n", x0, y0, x1, y1, width, color565);
+#else
+    tft_draw_wide_line (x0, y0, x1, y1, width, color565);
+#endif
+    return FUNCTION_TYPE_VOID;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * nici_tft_fill_circle () - draw filled circle
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+nici_tft_fill_circle (FIP_RUN * fip)
+{
+    int             x0          = get_argument_int (fip, 0);
+    int             y0          = get_argument_int (fip, 1);
+    int             radius      = get_argument_int (fip, 2);
+    uint_fast16_t   color565    = get_argument_int (fip, 3);
+
+#if defined (unix) || defined (WIN32)
+    printf ("tft_fill_circle (%3d, %3d, %3d, 0x%04x)\n", x0, y0, radius, color565);
+#else
+    tft_fill_circle (x0, y0, radius, color565);
+#endif
+    return FUNCTION_TYPE_VOID;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * nici_tft_fill_ellipse () - draw filled ellipse
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+nici_tft_fill_ellipse (FIP_RUN * fip)
+{
+    int             x0          = get_argument_int (fip, 0);
+    int             y0          = get_argument_int (fip, 1);
+    int             rx          = get_argument_int (fip, 2);
+    int             ry          = get_argument_int (fip, 3);
+    uint_fast16_t   color565    = get_argument_int (fip, 4);
+
+#if defined (unix) || defined (WIN32)
+    printf ("tft_fill_ellipse (%3d, %3d, %3d, %3d, 0x%04x)\n", x0, y0, rx, ry, color565);
+#else
+    tft_fill_ellipse (x0, y0, rx, ry, color565);
+#endif
+    return FUNCTION_TYPE_VOID;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * nici_tft_fill_triangle () - draw filled triangle
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+nici_tft_fill_triangle (FIP_RUN * fip)
+{
+    int             x0          = get_argument_int (fip, 0);
+    int             y0          = get_argument_int (fip, 1);
+    int             x1          = get_argument_int (fip, 2);
+    int             y1          = get_argument_int (fip, 3);
+    int             x2          = get_argument_int (fip, 4);
+    int             y2          = get_argument_int (fip, 5);
+    uint_fast16_t   color565    = get_argument_int (fip, 6);
+
+#if defined (unix) || defined (WIN32)
+    printf ("tft_fill_triangle (%3d, %3d, %3d, %3d, %3d, %3d, 0x%04x)\n", x0, y0, x1, y1, x2, y2, color565);
+#else
+    tft_fill_triangle (x0, y0, x1, y1, x2, y2, color565);
+#endif
+    return FUNCTION_TYPE_VOID;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * nici_tft_fill_polygon () - draw filled polygon: tft.fill_polygon (color, x0, y0, x1, y1, x2, y2, ...)
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+nici_tft_fill_polygon (FIP_RUN * fip)
+{
+    uint_fast16_t   color565    = get_argument_int (fip, 0);
+    int             n           = (fip->argc - 1) / 2;                 // max. 16 points, see funclist.h
+#if ! defined (unix) && ! defined (WIN32)
+    int             xy[2 * TFT_POLYGON_MAX_POINTS];
+    int             i;
+#endif
+
+    if ((fip->argc - 1) % 2 != 0)
+    {
+        fprintf (stderr, "tft.fill_polygon: invalid number of coordinates\n");
+        return FUNCTION_TYPE_VOID;
+    }
+
+#if defined (unix) || defined (WIN32)
+    printf ("tft_fill_polygon (0x%04x, %d points)\n", color565, n);
+#else
+    for (i = 0; i < 2 * n; i++)
+    {
+        xy[i] = get_argument_int (fip, i + 1);
+    }
+
+    tft_fill_polygon (xy, n, color565);
+#endif
+    return FUNCTION_TYPE_VOID;
+}
+
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
  * nici_tft_draw_image () - draw an image
  *---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -3033,6 +3360,7 @@ nici_tft_draw_image (FIP_RUN * fip)
     printf ("tft_draw_image (%d, %d, %d, %d, %ld)\n", x, y, l, h, (long) image);
 #else
     tft_draw_image (x, y, l, h, image);
+    tft_dma_wait ();                                                    // string argument may be freed after return
 #endif
     return FUNCTION_TYPE_VOID;
 }
@@ -3121,6 +3449,142 @@ nici_tft_draw_string (FIP_RUN * fip)
     return FUNCTION_TYPE_VOID;
 }
 
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * nici_tft_comp_start () - start compositor: draw functions are recorded until tft.comp_flush()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+nici_tft_comp_start (FIP_RUN * fip)
+{
+    uint_fast16_t   bcolor565   = get_argument_int (fip, 0);
+
+#if defined (unix) || defined (WIN32)
+    printf ("tft_comp_start (0x%04x)\n", bcolor565);
+#else
+    tft_comp_start (bcolor565);
+#endif
+    return FUNCTION_TYPE_VOID;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * nici_tft_comp_stop () - flush and stop compositor
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+nici_tft_comp_stop (FIP_RUN * UNUSED(fip))
+{
+#if defined (unix) || defined (WIN32)
+    printf ("tft_comp_stop ()\n");
+#else
+    tft_comp_stop ();
+#endif
+    return FUNCTION_TYPE_VOID;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * nici_tft_comp_flush () - send dirty tiles, returns number of tiles sent
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+nici_tft_comp_flush (FIP_RUN * fip)
+{
+#if defined (unix) || defined (WIN32)
+    printf ("tft_comp_flush ()\n");
+    fip->reti = 0;
+#else
+    fip->reti = tft_comp_flush ();
+#endif
+    return FUNCTION_TYPE_INT;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * nici_tft_wait_vblank () - wait for next vertical blanking of the display
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+nici_tft_wait_vblank (FIP_RUN * UNUSED(fip))
+{
+#if defined (unix) || defined (WIN32)
+    printf ("tft_frame_wait_vblank ()\n");
+#else
+    tft_frame_wait_vblank ();
+#endif
+    return FUNCTION_TYPE_VOID;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * nici_tft_frame_sync () - wait until n frames have passed since last call, returns number of frames passed
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+nici_tft_frame_sync (FIP_RUN * fip)
+{
+    uint_fast16_t   n   = get_argument_int (fip, 0);
+
+#if defined (unix) || defined (WIN32)
+    printf ("tft_frame_sync (%d)\n", n);
+    fip->reti = n;
+#else
+    fip->reti = tft_frame_sync (n);
+#endif
+    return FUNCTION_TYPE_INT;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * nici_tft_frame_count () - number of display frames
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+nici_tft_frame_count (FIP_RUN * fip)
+{
+#if defined (unix) || defined (WIN32)
+    printf ("tft_frame_count ()\n");
+    fip->reti = 0;
+#else
+    fip->reti = tft_frame_count ();
+#endif
+    return FUNCTION_TYPE_INT;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * nici_tft_draw_file () - draw BMP or RLE565 file, returns 0 on success, -1 on error
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+nici_tft_draw_file (FIP_RUN * fip)
+{
+    unsigned char * fname   = get_argument_string (fip, 0);
+    uint_fast16_t   x       = get_argument_int (fip, 1);
+    uint_fast16_t   y       = get_argument_int (fip, 2);
+
+#if defined (unix) || defined (WIN32)
+    printf ("tft_draw_file (\"%s\", %d, %d)\n", fname, x, y);
+    fip->reti = 0;
+#else
+    fip->reti = tft_draw_file ((char *) fname, x, y);
+#endif
+    return FUNCTION_TYPE_INT;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * nici_tft_profile () - set display power profile 0 - 3 and idle time in msec, returns profile set
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+nici_tft_profile (FIP_RUN * fip)
+{
+    uint_fast8_t    profile = get_argument_int (fip, 0);
+    uint32_t        idle_ms = get_argument_int (fip, 1);
+
+#if defined (unix) || defined (WIN32)
+    printf ("tft_profile (%d, %d)\n", profile, idle_ms);
+    fip->reti = profile;
+#else
+    fip->reti = tft_profile_set (profile, idle_ms);
+#endif
+    return FUNCTION_TYPE_INT;
+}
+
 static int
 flash_device_id (FIP_RUN * fip)
 {
@@ -100,6 +100,7 @@ static const char **                main_argv;
 
 STATEMENT *                         statementp;
 static int                          statements_used = 0;
+uint32_t                            nic_statements;                         // executed statements, see bench
 
 static POSTFIX_ELEMENT **           postfix_slots;
 static int *                        postfix_depth;
@@ -1586,6 +1587,8 @@ nici (int func_idx, FIP_RUN * fip)
 
     while (st_idx < statements_used)
     {
+        nic_statements++;
+
         if (alarm_slots_used)
         {
             update_alarm_timers ();
@@ -33,6 +33,8 @@
 #define                 RESULT_CSTRING_ARRAY    0x08
 #define                 RESULT_BYTE_ARRAY       0x10
 
+extern uint32_t         nic_statements;
+
 extern int              get_argument (FIP_RUN *, int argi, unsigned char **, int *);
 extern int              get_argument_int (FIP_RUN *, int);
 extern int              get_argument_byte (FIP_RUN *, int);
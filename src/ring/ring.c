@@ -0,0 +1,192 @@
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * ring.c - single producer / single consumer ringbuffer
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ * MIT License
+ *
+ * Copyright (c) 2018-2021 Frank Meyer - frank(at)fli4l.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#include <string.h>
+#include "ring.h"
+
+#ifdef unix
+#define RING_BARRIER()          __sync_synchronize ()
+#else
+#include "stm32f4xx.h"
+#define RING_BARRIER()          __DMB ()                                        // data before index, index before data
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * ring_init () - initialize ring with buffer, size must be a power of 2
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+ring_init (RING * r, uint8_t * buf, uint_fast16_t size)
+{
+    r->buf  = buf;
+    r->mask = size - 1;
+    r->head = 0;
+    r->tail = 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * ring_reset () - discard contents, neither producer nor consumer may be active
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+ring_reset (RING * r)
+{
+    r->tail = r->head;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * ring_put () - producer: store one byte, returns 0 if ring is full
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast8_t
+ring_put (RING * r, uint_fast8_t ch)
+{
+    uint_fast16_t   head = r->head;
+
+    if ((uint_fast16_t) (head - r->tail) > r->mask)
+    {
+        return 0;
+    }
+
+    r->buf[head & r->mask] = ch;
+    RING_BARRIER ();
+    r->head = head + 1;
+    return 1;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * ring_get () - consumer: fetch one byte, returns 0 if ring is empty
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast8_t
+ring_get (RING * r, uint8_t * chp)
+{
+    uint_fast16_t   tail = r->tail;
+
+    if (tail == r->head)
+    {
+        return 0;
+    }
+
+    RING_BARRIER ();
+    *chp = r->buf[tail & r->mask];
+    RING_BARRIER ();
+    r->tail = tail + 1;
+    return 1;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * ring_write () - producer: store up to n bytes, returns number of bytes stored
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast16_t
+ring_write (RING * r, const uint8_t * data, uint_fast16_t n)
+{
+    uint_fast16_t   head    = r->head;
+    uint_fast16_t   pos     = head & r->mask;
+    uint_fast16_t   space   = (r->mask + 1) - (uint_fast16_t) (head - r->tail);
+    uint_fast16_t   len;
+
+    if (n > space)
+    {
+        n = space;
+    }
+
+    len = r->mask + 1 - pos;                                                    // up to end of buffer
+
+    if (len > n)
+    {
+        len = n;
+    }
+
+    memcpy (r->buf + pos, data, len);
+    memcpy (r->buf, data + len, n - len);                                       // wrapped part
+    RING_BARRIER ();
+    r->head = head + n;
+    return n;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * ring_read () - consumer: fetch up to n bytes, returns number of bytes fetched
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast16_t
+ring_read (RING * r, uint8_t * data, uint_fast16_t n)
+{
+    uint_fast16_t   tail    = r->tail;
+    uint_fast16_t   pos     = tail & r->mask;
+    uint_fast16_t   used    = (uint_fast16_t) (r->head - tail);
+    uint_fast16_t   len;
+
+    if (n > used)
+    {
+        n = used;
+    }
+
+    len = r->mask + 1 - pos;
+
+    if (len > n)
+    {
+        len = n;
+    }
+
+    RING_BARRIER ();
+    memcpy (data, r->buf + pos, len);
+    memcpy (data + len, r->buf, n - len);
+    RING_BARRIER ();
+    r->tail = tail + n;
+    return n;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * ring_linear () - consumer: get contiguous used part at tail, e.g. for a DMA transfer, returns its length
+ *
+ * The part stays in the ring until ring_skip() is called.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast16_t
+ring_linear (RING * r, uint8_t ** datap)
+{
+    uint_fast16_t   tail    = r->tail;
+    uint_fast16_t   pos     = tail & r->mask;
+    uint_fast16_t   used    = (uint_fast16_t) (r->head - tail);
+    uint_fast16_t   len     = r->mask + 1 - pos;
+
+    RING_BARRIER ();
+    *datap = r->buf + pos;
+    return (len > used) ? used : len;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * ring_skip () - consumer: remove n bytes at tail
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+ring_skip (RING * r, uint_fast16_t n)
+{
+    RING_BARRIER ();
+    r->tail += n;
+}
@@ -0,0 +1,69 @@
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * ring.h - single producer / single consumer ringbuffer
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ * MIT License
+ *
+ * Copyright (c) 2018-2021 Frank Meyer - frank(at)fli4l.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#ifndef RING_H
+#define RING_H
+
+#include <stdint.h>
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * head is written by the producer only, tail by the consumer only. Both count free running, the buffer index is
+ * masked, so the size must be a power of 2 and all size bytes can be used. One side may be an ISR, no interrupts
+ * have to be blocked.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+typedef struct
+{
+    uint8_t *                   buf;
+    uint_fast16_t               mask;                                           // size - 1
+    volatile uint_fast16_t      head;                                           // producer: next write position
+    volatile uint_fast16_t      tail;                                           // consumer: next read position
+} RING;
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * RING_DEFINE (name, size) - define static ring with buffer, size must be a power of 2
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#define RING_DEFINE(name, size)                                                                             \
+    typedef char                name##_size_check[((size) & ((size) - 1)) == 0 ? 1 : -1];                   \
+    static uint8_t              name##_buf[size];                                                           \
+    static RING                 name = { name##_buf, (size) - 1, 0, 0 }
+
+#define ring_size(r)            ((r)->mask + 1)
+#define ring_used(r)            ((uint_fast16_t) ((r)->head - (r)->tail))
+#define ring_free(r)            (ring_size(r) - ring_used(r))
+#define ring_empty(r)           ((r)->head == (r)->tail)
+
+extern void                     ring_init (RING *, uint8_t *, uint_fast16_t);
+extern void                     ring_reset (RING *);
+extern uint_fast8_t             ring_put (RING *, uint_fast8_t);
+extern uint_fast8_t             ring_get (RING *, uint8_t *);
+extern uint_fast16_t            ring_write (RING *, const uint8_t *, uint_fast16_t);
+extern uint_fast16_t            ring_read (RING *, uint8_t *, uint_fast16_t);
+extern uint_fast16_t            ring_linear (RING *, uint8_t **);
+extern void                     ring_skip (RING *, uint_fast16_t);
+
+#endif // RING_H
@@ -30,7 +30,10 @@
 
 #include "stm32_sdcard.h"
 #include <stdio.h>
+#include <string.h>
 #include "delay.h"
+#include "coro.h"
+#include "boot.h"
 
 #ifdef __GNUC__
 #  define UNUSED(x)         UNUSED_ ## x __attribute__((__unused__))
@@ -50,6 +53,12 @@ static SDIO_InitTypeDef         SDIO_InitStructure;
 static SDIO_CmdInitTypeDef      SDIO_CmdInitStructure;
 static SDIO_DataInitTypeDef     SDIO_DataInitStructure;
 
+#define SDCARD_EARLY_NONE           0                                           // no early identification
+#define SDCARD_EARLY_STARTED        1                                           // sdcard_identify() called, result not used yet
+
+static uint_fast8_t             sdcard_early;
+static int                      sdcard_early_rtc;
+
 static void                     NVIC_Configuration(void);
 //000 static void               SD_DeInit(void);
 static SD_Error                 SD_Init(void);
@@ -127,7 +136,13 @@ MMC_disk_initialize(void)
 {
     int         rtc;
 
-    if (SD_Init () == SD_OK)
+    if (sdcard_early == SDCARD_EARLY_STARTED)                               // card identified during boot?
+    {
+        boot_finish ();                                                     // yes, wait until sdcard_identify() returned
+        sdcard_early = SDCARD_EARLY_NONE;                                   // retry with SD_Init() if it failed
+        rtc = sdcard_early_rtc;
+    }
+    else if (SD_Init () == SD_OK)
     {
         rtc = 0;
     }
@@ -139,6 +154,20 @@ MMC_disk_initialize(void)
     return rtc;
 }
 
+//--------------------------------------------------------------
+// sdcard_identify - power up and identify the card at boot
+//
+// Called by the boot sequencer in a coroutine: SD_PowerON()
+// yields while the card is busy. The result is returned by
+// the next MMC_disk_initialize(), i.e. on first file access.
+//--------------------------------------------------------------
+void
+sdcard_identify (void)
+{
+    sdcard_early = SDCARD_EARLY_STARTED;
+    sdcard_early_rtc = (SD_Init () == SD_OK) ? 0 : -1;
+}
+
 //--------------------------------------------------------------
 // MMC_disk_status
 //--------------------------------------------------------------
@@ -162,14 +191,20 @@ MMC_disk_status(void)
 
 //--------------------------------------------------------------
 // MMC_disk_read
+//
+// The SDIO DMA stream transfers 32 bit words in bursts, so the
+// buffer must be word aligned. FatFs passes the caller's buffer
+// for whole-sector runs, therefore unaligned buffers are bounced
+// sector by sector through an aligned buffer.
 //--------------------------------------------------------------
-int
-MMC_disk_read (BYTE *buff, DWORD sector, BYTE UNUSED(count))                                // fm: TODO
+static uint32_t                 mmc_bounce_buf[512 / sizeof (uint32_t)];
+
+static int
+mmc_read_blocks (BYTE *buff, DWORD sector, UINT count)
 {
     SD_Error    status;
-    int         rtc;
 
-    SD_ReadMultiBlocks (buff, sector << 9, 512, 1);
+    SD_ReadMultiBlocks (buff, (uint64_t) sector << 9, 512, count);
 
     status = SD_WaitReadOperation ();                                                       // check if the Transfer is finished
 
@@ -178,13 +213,26 @@ MMC_disk_read (BYTE *buff, DWORD sector, BYTE UNUSED(count))
         ;
     }
 
-    if (status == SD_OK)
+    return (status == SD_OK) ? 0 : -1;
+}
+
+int
+MMC_disk_read (BYTE *buff, DWORD sector, UINT count)
+{
+    int         rtc = 0;
+
+    if (((uint32_t) buff & 0x03) == 0)
     {
-        rtc = 0;
+        rtc = mmc_read_blocks (buff, sector, count);                                        // read all sectors with one CMD18
     }
     else
     {
-        rtc = -1;
+        while (count-- && rtc == 0)
+        {
+            rtc = mmc_read_blocks ((BYTE *) mmc_bounce_buf, sector++, 1);
+            memcpy (buff, mmc_bounce_buf, 512);
+            buff += 512;
+        }
     }
 
     return rtc;
@@ -194,13 +242,12 @@ MMC_disk_read (BYTE *buff, DWORD sector, BYTE UNUSED(count))
 //--------------------------------------------------------------
 // MMC_disk_write
 //--------------------------------------------------------------
-int
-MMC_disk_write (const BYTE *buff, DWORD sector, BYTE UNUSED(count))                             // fm: TODO
+static int
+mmc_write_blocks (const BYTE *buff, DWORD sector, UINT count)
 {
     SD_Error    status;
-    int         rtc;
 
-    SD_WriteMultiBlocks ((BYTE *)buff, sector << 9, 512, 1);
+    SD_WriteMultiBlocks ((BYTE *)buff, (uint64_t) sector << 9, 512, count);
 
     status = SD_WaitWriteOperation();                                                           /* Check if the Transfer is finished */
 
@@ -209,13 +256,26 @@ MMC_disk_write (const BYTE *buff, DWORD sector, BYTE UNUSED(count))
         ;
     }
 
-    if (status == SD_OK)
+    return (status == SD_OK) ? 0 : -1;
+}
+
+int
+MMC_disk_write (const BYTE *buff, DWORD sector, UINT count)
+{
+    int         rtc = 0;
+
+    if (((uint32_t) buff & 0x03) == 0)
     {
-        rtc = 0;
+        rtc = mmc_write_blocks (buff, sector, count);                                           // write all sectors with one CMD25
     }
     else
     {
-        rtc = -1;
+        while (count-- && rtc == 0)
+        {
+            memcpy (mmc_bounce_buf, buff, 512);
+            rtc = mmc_write_blocks ((BYTE *) mmc_bounce_buf, sector++, 1);
+            buff += 512;
+        }
     }
 
     return rtc;
@@ -525,6 +585,11 @@ SD_PowerON (void)
             response = SDIO_GetResponse(SDIO_RESP1);
             validvoltage = (((response >> 31) == 1) ? 1 : 0);
             count++;
+
+            if (! validvoltage)                                                 // card still busy powering up
+            {
+                coro_yield ();                                                  // run boot sequencer caller, no-op outside of coroutine
+            }
         }
 
         if (count >= SD_MAX_VOLT_TRIAL)
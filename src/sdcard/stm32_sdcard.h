@@ -401,10 +401,11 @@ typedef struct
 
 extern void         sdcard_init (void);
 extern uint8_t      sdcard_checkmedia (void);
+extern void         sdcard_identify (void);
 extern int          MMC_disk_initialize (void);
 extern int          MMC_disk_status (void);
-extern int          MMC_disk_read (BYTE *, DWORD, BYTE);
-extern int          MMC_disk_write (const BYTE *, DWORD, BYTE);
+extern int          MMC_disk_read (BYTE *, DWORD, UINT);
+extern int          MMC_disk_write (const BYTE *, DWORD, UINT);
 extern int          MMC_disk_ioctl (BYTE, void *);
 
 #endif
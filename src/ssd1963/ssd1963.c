@@ -564,6 +564,7 @@ SSD1963_GLOBALS  ssd1963 =
     SSD1963_GLOBAL_FLAGS_RGB_ORDER | SSD1963_GLOBAL_FLAGS_FLIP_HORIZONTAL               // default: rgb, flip horizontal
 };
 
+#ifndef unix                                                                                            // host build: no FSMC, see tft_sim.c
 /*-------------------------------------------------------------------------------------------------------------------------------------------
  * ssd1963_reset_ctrl_lines () - reset control lines, set them to input to allow auto-init
  *-------------------------------------------------------------------------------------------------------------------------------------------
@@ -714,6 +715,8 @@ ssd1963_init_fsmc (void)
     FSMC_NORSRAMCmd(FSMC_Bank1_NORSRAM1, ENABLE);
 }
 
+#endif // !unix
+
 /*-------------------------------------------------------------------------------------------------------------------------------------------
  * ssd1963_nop () - No operation
  *-------------------------------------------------------------------------------------------------------------------------------------------
@@ -2084,9 +2087,11 @@ ssd1963_init (void)
     uint_fast8_t    lcd_mode_b;
     uint_fast8_t    seq;
 
+#ifndef unix
     ssd1963_reset_ctrl_lines ();                                                                                    // control lines as input
     ssd1963_init_ctrl_lines ();
     ssd1963_init_fsmc ();
+#endif
     ssd1963_soft_reset ();
 
     ssd1963_set_pll_mn (PLL_MULTIPLIER, PLL_DIVIDER, SSD1963_PLL_MN_EFFECTUATE_MULTIPLIER_AND_DIVIDER);
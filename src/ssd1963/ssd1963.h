@@ -48,12 +48,22 @@
  * SSD1963 API:
  *-------------------------------------------------------------------------------------------------------------------------------------------
  */
+#ifdef unix                                                                                     // host build: bus goes to tft_sim.c
+extern void                             tft_sim_write_command (uint_fast16_t);
+extern void                             tft_sim_write_data (uint_fast16_t);
+extern uint_fast16_t                    tft_sim_read_data (void);
+
+#define ssd1963_write_command(cmd)              tft_sim_write_command (cmd)
+#define ssd1963_write_data(val)                 tft_sim_write_data (val)
+#define ssd1963_read_data()                     tft_sim_read_data ()
+#else
 #define TFT_REG                                 (*((volatile uint16_t *) 0x60000000))
 #define TFT_RAM                                 (*((volatile uint16_t *) 0x60080000))   // 0x80000 for FSMC18 = /RD (SSD1963: D/C)
 
 #define ssd1963_write_command(cmd)              do { TFT_REG = (cmd); } while (0)
 #define ssd1963_write_data(val)                 do { TFT_RAM = (val); } while (0)
 #define ssd1963_read_data()                     (TFT_RAM)
+#endif
 
 #define SSD1963_GLOBAL_FLAGS_RGB_ORDER          0x01
 #define SSD1963_GLOBAL_FLAGS_FLIP_HORIZONTAL    0x02
@@ -0,0 +1,350 @@
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * png2rle.c - convert PNG image to RLE565 file for tft_draw_file() (unix only)
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Build and run on linux:
+ *
+ *   cc -o png2rle src/tft/png2rle.c -lz && ./png2rle image.png IMAGE.RLE
+ *
+ * Supported: all non-interlaced PNG color types, bit depth 1 - 8 and 16 (only the high byte is used). Alpha is composed
+ * onto black. Format of the output file see tft_file.c: runs are stored if 3 or more pixels are equal, else literals.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ * MIT License
+ *
+ * Copyright (c) 2018-2021 Frank Meyer - frank(at)fli4l.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#ifdef unix
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+#define RLE_MAX_COUNT       0x8000                                          // max pixels per packet
+
+static unsigned char *      idat;
+static unsigned long        idat_len;
+static unsigned char        palette[256][4];
+
+static unsigned long
+be32 (const unsigned char * p)
+{
+    return ((unsigned long) p[0] << 24) | ((unsigned long) p[1] << 16) | ((unsigned long) p[2] << 8) | p[3];
+}
+
+static void
+put16 (FILE * fp, unsigned int v)
+{
+    putc (v & 0xFF, fp);
+    putc ((v >> 8) & 0xFF, fp);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * paeth () - paeth predictor of PNG filter type 4
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+paeth (int a, int b, int c)
+{
+    int p   = a + b - c;
+    int pa  = abs (p - a);
+    int pb  = abs (p - b);
+    int pc  = abs (p - c);
+
+    if (pa <= pb && pa <= pc)
+    {
+        return a;
+    }
+    return (pb <= pc) ? b : c;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * unfilter () - undo PNG row filters in place, bpp = bytes per complete pixel (at least 1)
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+unfilter (unsigned char * data, unsigned long h, unsigned long rowbytes, int bpp)
+{
+    unsigned char * prev = NULL;
+    unsigned char * row;
+    unsigned long   y;
+    unsigned long   x;
+    int             a, b, c;
+
+    for (y = 0; y < h; y++)
+    {
+        row = data + y * (rowbytes + 1) + 1;
+
+        for (x = 0; x < rowbytes; x++)
+        {
+            a = (x >= (unsigned long) bpp) ? row[x - bpp] : 0;
+            b = prev ? prev[x] : 0;
+            c = (prev && x >= (unsigned long) bpp) ? prev[x - bpp] : 0;
+
+            switch (row[-1])
+            {
+                case 0:                                         break;
+                case 1: row[x] += a;                            break;
+                case 2: row[x] += b;                            break;
+                case 3: row[x] += (a + b) / 2;                  break;
+                case 4: row[x] += paeth (a, b, c);              break;
+                default: return -1;
+            }
+        }
+        prev = row;
+    }
+    return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * sample () - get sample n of a row, scaled to 0 - 255 (or palette index for color type 3)
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+sample (const unsigned char * row, unsigned long n, int depth, int colortype)
+{
+    int v;
+
+    switch (depth)
+    {
+        case 16:    return row[2 * n];
+        case 8:     return row[n];
+        default:    v = (row[n * depth / 8] >> (8 - depth - (n * depth) % 8)) & ((1 << depth) - 1);
+                    return (colortype == 3) ? v : v * 255 / ((1 << depth) - 1);
+    }
+}
+
+int
+main (int argc, char ** argv)
+{
+    static const unsigned char  sig[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    static const int            channels[7] = { 1, 0, 3, 1, 2, 0, 4 };
+    unsigned char               hdr[8];
+    unsigned char *             chunk;
+    unsigned char *             data;
+    unsigned short *            pix;
+    unsigned long               len;
+    unsigned long               w = 0;
+    unsigned long               h = 0;
+    unsigned long               rowbytes;
+    unsigned long               datalen;
+    unsigned long               i;
+    unsigned long               j;
+    unsigned long               n;
+    unsigned long               x;
+    unsigned long               y;
+    unsigned long               packets = 0;
+    int                         depth = 0;
+    int                         colortype = 0;
+    int                         ch;
+    int                         r, g, b, a;
+    FILE *                      fp;
+
+    if (argc != 3)
+    {
+        fprintf (stderr, "usage: %s image.png image.rle\n", argv[0]);
+        return 1;
+    }
+
+    if (! (fp = fopen (argv[1], "rb")) || fread (hdr, 1, 8, fp) != 8 || memcmp (hdr, sig, 8))
+    {
+        fprintf (stderr, "%s: no PNG file\n", argv[1]);
+        return 1;
+    }
+
+    while (fread (hdr, 1, 8, fp) == 8)
+    {
+        len     = be32 (hdr);
+        chunk   = malloc (len + 4);
+
+        if (! chunk || fread (chunk, 1, len + 4, fp) != len + 4)                    // data + crc
+        {
+            fprintf (stderr, "%s: read error\n", argv[1]);
+            return 1;
+        }
+
+        if (! memcmp (hdr + 4, "IHDR", 4))
+        {
+            w           = be32 (chunk);
+            h           = be32 (chunk + 4);
+            depth       = chunk[8];
+            colortype   = chunk[9];
+
+            if (chunk[12] != 0)
+            {
+                fprintf (stderr, "%s: interlaced PNG not supported\n", argv[1]);
+                return 1;
+            }
+
+            if (w == 0 || h == 0 || w > 0xFFFF || h > 0xFFFF || colortype > 6 || channels[colortype] == 0)
+            {
+                fprintf (stderr, "%s: unsupported image format\n", argv[1]);
+                return 1;
+            }
+        }
+        else if (! memcmp (hdr + 4, "PLTE", 4))
+        {
+            for (i = 0; i < len / 3 && i < 256; i++)
+            {
+                palette[i][0] = chunk[3 * i];
+                palette[i][1] = chunk[3 * i + 1];
+                palette[i][2] = chunk[3 * i + 2];
+                palette[i][3] = 255;
+            }
+        }
+        else if (! memcmp (hdr + 4, "tRNS", 4) && colortype == 3)
+        {
+            for (i = 0; i < len && i < 256; i++)
+            {
+                palette[i][3] = chunk[i];
+            }
+        }
+        else if (! memcmp (hdr + 4, "IDAT", 4))
+        {
+            idat = realloc (idat, idat_len + len);
+            memcpy (idat + idat_len, chunk, len);
+            idat_len += len;
+        }
+        else if (! memcmp (hdr + 4, "IEND", 4))
+        {
+            free (chunk);
+            break;
+        }
+        free (chunk);
+    }
+
+    fclose (fp);
+
+    if (w == 0 || ! idat)
+    {
+        fprintf (stderr, "%s: no image data\n", argv[1]);
+        return 1;
+    }
+
+    ch          = channels[colortype];
+    rowbytes    = (w * ch * depth + 7) / 8;
+    datalen     = h * (rowbytes + 1);
+    data        = malloc (datalen);
+    pix         = malloc (w * h * sizeof (unsigned short));
+
+    if (! data || ! pix || uncompress (data, &datalen, idat, idat_len) != Z_OK || datalen != h * (rowbytes + 1) ||
+        unfilter (data, h, rowbytes, (ch * depth + 7) / 8) != 0)
+    {
+        fprintf (stderr, "%s: corrupt image data\n", argv[1]);
+        return 1;
+    }
+
+    for (y = 0; y < h; y++)
+    {
+        const unsigned char * row = data + y * (rowbytes + 1) + 1;
+
+        for (x = 0; x < w; x++)
+        {
+            a = 255;
+
+            switch (colortype)
+            {
+                case 0:                                                             // gray
+                    r = g = b = sample (row, x, depth, colortype);
+                    break;
+                case 2:                                                             // RGB
+                    r = sample (row, 3 * x, depth, colortype);
+                    g = sample (row, 3 * x + 1, depth, colortype);
+                    b = sample (row, 3 * x + 2, depth, colortype);
+                    break;
+                case 3:                                                             // palette
+                    i = sample (row, x, depth, colortype);
+                    r = palette[i][0];
+                    g = palette[i][1];
+                    b = palette[i][2];
+                    a = palette[i][3];
+                    break;
+                case 4:                                                             // gray + alpha
+                    r = g = b = sample (row, 2 * x, depth, colortype);
+                    a = sample (row, 2 * x + 1, depth, colortype);
+                    break;
+                default:                                                            // RGB + alpha
+                    r = sample (row, 4 * x, depth, colortype);
+                    g = sample (row, 4 * x + 1, depth, colortype);
+                    b = sample (row, 4 * x + 2, depth, colortype);
+                    a = sample (row, 4 * x + 3, depth, colortype);
+                    break;
+            }
+
+            r = r * a / 255;
+            g = g * a / 255;
+            b = b * a / 255;
+
+            pix[y * w + x] = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+        }
+    }
+
+    if (! (fp = fopen (argv[2], "wb")))
+    {
+        perror (argv[2]);
+        return 1;
+    }
+
+    fputs ("R565", fp);
+    put16 (fp, w);
+    put16 (fp, h);
+
+    n = w * h;
+
+    for (i = 0; i < n; )
+    {
+        for (j = i + 1; j < n && j - i < RLE_MAX_COUNT && pix[j] == pix[i]; j++)
+        {
+            ;
+        }
+
+        if (j - i >= 3)                                                             // run
+        {
+            put16 (fp, 0x8000 | (j - i - 1));
+            put16 (fp, pix[i]);
+            i = j;
+        }
+        else                                                                        // literals up to next run of 3
+        {
+            for (j = i; j < n && j - i < RLE_MAX_COUNT; j++)
+            {
+                if (j + 2 < n && pix[j] == pix[j + 1] && pix[j] == pix[j + 2])
+                {
+                    break;
+                }
+            }
+
+            put16 (fp, j - i - 1);
+
+            while (i < j)
+            {
+                put16 (fp, pix[i++]);
+            }
+        }
+        packets++;
+    }
+
+    fclose (fp);
+    printf ("%s: %lux%lu, %lu packets\n", argv[2], w, h, packets);
+    return 0;
+}
+
+#endif // unix
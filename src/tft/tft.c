@@ -24,7 +24,7 @@
  * SOFTWARE.
  *-------------------------------------------------------------------------------------------------------------------------------------------
  */
-#ifdef STM32F407VE                                                              // TFT & SSD1963 only for STM32F407
+#if defined STM32F407VE || defined unix                                         // TFT & SSD1963 only for STM32F407, unix: see tft_sim.c
 
 #include <stdint.h>
 #include <stdlib.h>
@@ -34,6 +34,262 @@
 
 #if defined ILI9341 || defined SSD1963
 
+#ifndef unix
+#include "stm32f4xx_dma.h"
+#include "misc.h"
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * DMA engine: DMA2 memory-to-memory into the FSMC data address
+ *
+ * Only DMA2 can do memory-to-memory. The source is the peripheral port (PAR), the destination TFT_RAM is the memory port (M0AR)
+ * with fixed address. Fills use a fixed source, images an incrementing source. Each DMA transfer is limited to 65535 items,
+ * the transfer complete interrupt starts the next chunk. Sources in CCM RAM are not reachable by DMA and are copied by the CPU.
+ *
+ * Every function which sends commands to the controller must call tft_dma_wait() first, tft_set_area() does so.
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#define TFT_DMA_CLOCK_CMD       RCC_AHB1PeriphClockCmd
+#define TFT_DMA_CLOCK           RCC_AHB1Periph_DMA2
+#define TFT_DMA_STREAM          DMA2_Stream4                                    // not used by SDIO, SPI1 (W25QXX) or USART1
+#define TFT_DMA_CHANNEL         DMA_Channel_0
+#define TFT_DMA_IRQn            DMA2_Stream4_IRQn
+#define TFT_DMA_ISR             DMA2_Stream4_IRQHandler
+#define TFT_DMA_IRQ_FLAG        DMA_IT_TCIF4
+#define TFT_DMA_FLAGS           (DMA_FLAG_TCIF4 | DMA_FLAG_HTIF4 | DMA_FLAG_TEIF4 | DMA_FLAG_DMEIF4 | DMA_FLAG_FEIF4)
+
+#define TFT_DMA_MAX_XFER        65535                                           // max. value of NDTR
+#define TFT_DMA_MIN_XFER        32                                              // below this a CPU loop is faster than the DMA setup
+
+#define TFT_IS_CCM(p)           (((uint32_t) (p) & 0xFFFF0000) == 0x10000000)
+
+static volatile uint_fast8_t    tft_dma_active;                                 // 1: transfer running
+static volatile uint32_t        tft_dma_src;                                    // source address of next chunk
+static volatile uint32_t        tft_dma_remaining;                              // pixels not yet started
+static volatile uint_fast8_t    tft_dma_src_inc;                                // 1: image, 0: fill
+static uint16_t                 tft_dma_color;                                  // source of fills
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: start next chunk
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_dma_next (void)
+{
+    uint32_t    n = (tft_dma_remaining > TFT_DMA_MAX_XFER) ? TFT_DMA_MAX_XFER : tft_dma_remaining;
+
+    TFT_DMA_STREAM->PAR     = tft_dma_src;
+    TFT_DMA_STREAM->NDTR    = n;
+    tft_dma_remaining      -= n;
+
+    if (tft_dma_src_inc)
+    {
+        tft_dma_src += n * sizeof (uint16_t);
+    }
+
+    DMA_ClearFlag (TFT_DMA_STREAM, TFT_DMA_FLAGS);
+    DMA_Cmd (TFT_DMA_STREAM, ENABLE);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * ISR DMA (will be called, when a chunk has been transferred)
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void TFT_DMA_ISR (void);
+void
+TFT_DMA_ISR (void)
+{
+    if (DMA_GetITStatus (TFT_DMA_STREAM, TFT_DMA_IRQ_FLAG))
+    {
+        DMA_ClearITPendingBit (TFT_DMA_STREAM, TFT_DMA_IRQ_FLAG);
+
+        if (tft_dma_remaining > 0)
+        {
+            tft_dma_next ();
+        }
+        else
+        {
+            tft_dma_active = 0;
+        }
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: start transfer of count pixels
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_dma_start (uint32_t src, uint_fast8_t src_inc, uint32_t count)
+{
+    tft_dma_active      = 1;
+    tft_dma_src         = src;
+    tft_dma_src_inc     = src_inc;
+    tft_dma_remaining   = count;
+
+    if (src_inc)
+    {
+        TFT_DMA_STREAM->CR |= DMA_SxCR_PINC;
+    }
+    else
+    {
+        TFT_DMA_STREAM->CR &= ~DMA_SxCR_PINC;
+    }
+
+    tft_dma_next ();
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_dma_busy () - returns 1 while a fill or image transfer is running
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast8_t
+tft_dma_busy (void)
+{
+    return tft_dma_active;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_dma_wait () - wait until DMA transfer has finished
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+tft_dma_wait (void)
+{
+    while (tft_dma_active)
+    {
+        ;
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_dma_fill () - write count pixels of one color into the area set by tft_set_area(), returns before completion
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+tft_dma_fill (uint_fast16_t color565, uint32_t count)
+{
+    tft_dma_wait ();
+
+    if (count < TFT_DMA_MIN_XFER)
+    {
+        while (count--)
+        {
+            tft_write_data (color565);
+        }
+    }
+    else
+    {
+        tft_dma_color = color565;
+        tft_dma_start ((uint32_t) &tft_dma_color, 0, count);
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_dma_write () - write count pixels into the area set by tft_set_area(), returns before completion.
+ * data must stay unchanged until tft_dma_busy() returns 0.
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+tft_dma_write (const uint16_t * data, uint32_t count)
+{
+    tft_dma_wait ();
+
+    if (count < TFT_DMA_MIN_XFER || TFT_IS_CCM(data))
+    {
+        while (count--)
+        {
+            tft_write_data (*data);
+            data++;
+        }
+    }
+    else
+    {
+        tft_dma_start ((uint32_t) data, 1, count);
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: initialize DMA
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_dma_init (void)
+{
+    DMA_InitTypeDef     dma;
+    NVIC_InitTypeDef    nvic;
+
+    TFT_DMA_CLOCK_CMD (TFT_DMA_CLOCK, ENABLE);
+
+    DMA_Cmd (TFT_DMA_STREAM, DISABLE);
+    DMA_DeInit (TFT_DMA_STREAM);
+    DMA_StructInit (&dma);
+
+    dma.DMA_Channel             = TFT_DMA_CHANNEL;
+    dma.DMA_DIR                 = DMA_DIR_MemoryToMemory;
+    dma.DMA_PeripheralBaseAddr  = (uint32_t) &tft_dma_color;                    // source
+    dma.DMA_Memory0BaseAddr     = (uint32_t) &TFT_RAM;                          // destination
+    dma.DMA_BufferSize          = 1;
+    dma.DMA_PeripheralInc       = DMA_PeripheralInc_Disable;
+    dma.DMA_MemoryInc           = DMA_MemoryInc_Disable;
+    dma.DMA_PeripheralDataSize  = DMA_PeripheralDataSize_HalfWord;
+    dma.DMA_MemoryDataSize      = DMA_MemoryDataSize_HalfWord;
+    dma.DMA_Mode                = DMA_Mode_Normal;
+    dma.DMA_Priority            = DMA_Priority_Medium;
+    dma.DMA_FIFOMode            = DMA_FIFOMode_Enable;                          // direct mode is not allowed for memory-to-memory
+    dma.DMA_FIFOThreshold       = DMA_FIFOThreshold_HalfFull;
+    dma.DMA_MemoryBurst         = DMA_MemoryBurst_Single;
+    dma.DMA_PeripheralBurst     = DMA_PeripheralBurst_Single;
+    DMA_Init (TFT_DMA_STREAM, &dma);
+
+    DMA_ITConfig (TFT_DMA_STREAM, DMA_IT_TC, ENABLE);
+
+    nvic.NVIC_IRQChannel                    = TFT_DMA_IRQn;
+    nvic.NVIC_IRQChannelPreemptionPriority  = 1;
+    nvic.NVIC_IRQChannelSubPriority         = 0;
+    nvic.NVIC_IRQChannelCmd                 = ENABLE;
+    NVIC_Init (&nvic);
+
+    tft_dma_active = 0;
+}
+
+#else // unix: no DMA, the CPU writes to the simulated controller
+
+uint_fast8_t
+tft_dma_busy (void)
+{
+    return 0;
+}
+
+void
+tft_dma_wait (void)
+{
+}
+
+void
+tft_dma_fill (uint_fast16_t color565, uint32_t count)
+{
+    while (count--)
+    {
+        tft_write_data (color565);
+    }
+}
+
+void
+tft_dma_write (const uint16_t * data, uint32_t count)
+{
+    while (count--)
+    {
+        tft_write_data (*data);
+        data++;
+    }
+}
+
+static void
+tft_dma_init (void)
+{
+}
+
+#endif // !unix
+
 /*-------------------------------------------------------------------------------------------------------------------------------------------
  * tft_fadein_backlight ()  - fade in backlight
  *-------------------------------------------------------------------------------------------------------------------------------------------
@@ -51,6 +307,8 @@ tft_fadein_backlight (uint32_t delay_ms)
     uint_fast8_t    backlight_duty_cycle;
     int             idx;
 
+    tft_dma_wait ();
+
     ssd1963_get_pwm_conf (&pwmf, &pwm, &pwm_conf_mask, &man_br, &min_br, &prescaler, &backlight_duty_cycle);
 
     for (idx = pwm; idx <= 0xFF; idx++)
@@ -80,6 +338,8 @@ tft_fadeout_backlight (uint32_t delay_ms)
     uint_fast8_t    backlight_duty_cycle;
     signed int      idx;
 
+    tft_dma_wait ();
+
     ssd1963_get_pwm_conf (&pwmf, &pwm, &pwm_conf_mask, &man_br, &min_br, &prescaler, &backlight_duty_cycle);
 
     for (idx = pwm; idx >= 0; idx--)
@@ -108,6 +368,8 @@ tft_backlight_on (void)
     uint_fast8_t    prescaler;
     uint_fast8_t    backlight_duty_cycle;
 
+    tft_dma_wait ();
+
     ssd1963_get_pwm_conf (&pwmf, &pwm, &pwm_conf_mask, &man_br, &min_br, &prescaler, &backlight_duty_cycle);
     pwm     = 0xFF;
     man_br  = 0xFF;
@@ -131,6 +393,8 @@ tft_backlight_off (void)
     uint_fast8_t    prescaler;
     uint_fast8_t    backlight_duty_cycle;
 
+    tft_dma_wait ();
+
     ssd1963_get_pwm_conf (&pwmf, &pwm, &pwm_conf_mask, &man_br, &min_br, &prescaler, &backlight_duty_cycle);
     pwm     = 0x00;
     man_br  = 0x00;
@@ -138,12 +402,201 @@ tft_backlight_off (void)
 #endif
 }
 
+#if defined (SSD1963) && ! defined (unix)
 /*-------------------------------------------------------------------------------------------------------------------------------------------
- * tft_set_area ()  - set area
+ * Power profiles: if nothing has been drawn for idle_ms, tft_power_poll() switches the display into a state which needs
+ * less power. The first draw afterwards (tft_set_area() or tft_frame_blit()) restores the full state before the area
+ * is written.
+ *
+ *   TFT_PROFILE_FULL       no switching (default)
+ *   TFT_PROFILE_BALANCED   inactive: pixel clock (LSHIFT) / 2
+ *   TFT_PROFILE_SAVE       inactive: pixel clock / 4, partial mode on the rows drawn since the last tft_fill_screen (BLACK565)
+ *   TFT_PROFILE_MINIMUM    like TFT_PROFILE_SAVE, additionally idle mode (8 colors)
+ *
+ * The PLL is not changed, it also clocks the memory interface. Outside of the partial area the panel shows black, which
+ * is what these rows contain anyway. With the hardware-scrolled terminal active, the rows are not fixed, so partial mode
+ * is not used then.
+ *
+ * tft_power_poll() sends commands and must not be called by an interrupt, it is called by time.delay().
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#include "timer2.h"
+
+#define TFT_POWER_ROWS_NONE     0xFFFF                                          // no row drawn since last black screen
+
+static uint_fast8_t     tft_power_profile;                                      // TFT_PROFILE_xxx
+static uint32_t         tft_power_idle_ms;
+static uint_fast8_t     tft_power_low;                                          // 1: inactive state switched on
+static uint_fast8_t     tft_power_partial;                                      // 1: partial mode switched on
+static uint32_t         tft_power_last;                                         // milliseconds of last draw
+static uint_fast32_t    tft_power_lshift;                                       // LSHIFT setting of ssd1963_init()
+static uint_fast16_t    tft_power_y0 = 0;                                       // rows drawn since last black screen
+static uint_fast16_t    tft_power_y1 = TFT_HEIGHT - 1;
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: restore full state, DMA must be idle
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_power_wake (void)
+{
+    ssd1963_set_lshift_freq (tft_power_lshift);
+
+    if (tft_power_profile == TFT_PROFILE_MINIMUM)
+    {
+        ssd1963_exit_idle_mode ();
+    }
+
+    if (tft_power_partial)
+    {
+        ssd1963_enter_normal_mode ();
+        tft_power_partial = 0;
+    }
+
+    tft_power_low = 0;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: note drawing into rows y0 - y1, DMA must be idle
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_power_draw (uint_fast16_t y0, uint_fast16_t y1)
+{
+    if (tft_power_y0 == TFT_POWER_ROWS_NONE)                                   // rows are tracked in all profiles
+    {
+        tft_power_y0 = y0;
+        tft_power_y1 = y1;
+    }
+    else
+    {
+        if (tft_power_y0 > y0)
+        {
+            tft_power_y0 = y0;
+        }
+
+        if (tft_power_y1 < y1)
+        {
+            tft_power_y1 = y1;
+        }
+    }
+
+    if (tft_power_profile != TFT_PROFILE_FULL)
+    {
+        tft_power_last = milliseconds;
+
+        if (tft_power_low)
+        {
+            tft_power_wake ();
+        }
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_power_poll () - switch to inactive state of current profile if nothing has been drawn for idle_ms
  *-------------------------------------------------------------------------------------------------------------------------------------------
  */
 void
-tft_set_area (uint_fast16_t x0, uint_fast16_t x1, uint_fast16_t y0, uint_fast16_t y1)
+tft_power_poll (void)
+{
+    if (tft_power_profile != TFT_PROFILE_FULL && ! tft_power_low && milliseconds - tft_power_last >= tft_power_idle_ms && ! tft_dma_busy ())
+    {
+        if (tft_power_profile == TFT_PROFILE_BALANCED)
+        {
+            ssd1963_set_lshift_freq (tft_power_lshift / 2);
+        }
+        else
+        {
+            ssd1963_set_lshift_freq (tft_power_lshift / 4);
+
+            if (! tft_term_active () && tft_power_y0 != TFT_POWER_ROWS_NONE && (tft_power_y0 > 0 || tft_power_y1 < TFT_HEIGHT - 1))
+            {
+                ssd1963_set_partial_area (tft_power_y0, tft_power_y1);
+                ssd1963_enter_partial_mode ();
+                tft_power_partial = 1;
+            }
+
+            if (tft_power_profile == TFT_PROFILE_MINIMUM)
+            {
+                ssd1963_enter_idle_mode ();
+            }
+        }
+
+        tft_power_low = 1;
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_profile_set () - set power profile and idle time in msec, returns profile set
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast8_t
+tft_profile_set (uint_fast8_t profile, uint32_t idle_ms)
+{
+    if (profile > TFT_PROFILE_MINIMUM)
+    {
+        profile = TFT_PROFILE_MINIMUM;
+    }
+
+    tft_dma_wait ();
+
+    if (tft_power_low)
+    {
+        tft_power_wake ();
+    }
+
+    tft_power_profile   = profile;
+    tft_power_idle_ms   = idle_ms;
+    tft_power_last      = milliseconds;
+    return profile;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: forget drawn rows after screen has been filled black
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_power_black_screen (void)
+{
+    tft_power_y0 = TFT_POWER_ROWS_NONE;
+    tft_power_y1 = 0;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: save LSHIFT setting of ssd1963_init()
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_power_init (void)
+{
+    ssd1963_get_lshift_freq (&tft_power_lshift);
+}
+
+#else // ILI9341 or unix: no power profiles
+
+#define tft_power_draw(y0, y1)
+#define tft_power_black_screen()
+
+void
+tft_power_poll (void)
+{
+}
+
+uint_fast8_t
+tft_profile_set (uint_fast8_t profile, uint32_t idle_ms)
+{
+    (void) profile, (void) idle_ms;
+    return TFT_PROFILE_FULL;
+}
+
+#endif // SSD1963 && !unix
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_set_area ()  - set area
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_set_area_nowait (uint_fast16_t x0, uint_fast16_t x1, uint_fast16_t y0, uint_fast16_t y1)
 {
 #if defined (SSD1963)
     ssd1963_set_column_address (x0, x1);
@@ -162,6 +615,302 @@ tft_set_area (uint_fast16_t x0, uint_fast16_t x1, uint_fast16_t y0, uint_fast16_
 #endif
 }
 
+void
+tft_set_area (uint_fast16_t x0, uint_fast16_t x1, uint_fast16_t y0, uint_fast16_t y1)
+{
+    tft_dma_wait ();
+    tft_power_draw (y0, y1);
+    tft_set_area_nowait (x0, x1, y0, y1);
+}
+
+#if defined (SSD1963) && ! defined (unix)
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * Frame pacing: the tearing effect output (TE) of the SSD1963 is wired to PC5 (T_PEN of the TFT connector, unused) and
+ * triggers EXTI5. TE is set to the scanline where the next event is wanted: the first line after the display period
+ * for vertical blanking, or the first line of an area for a scheduled blit.
+ *
+ * A scheduled blit reserves the DMA engine (tft_dma_active = 1) until the TE interrupt has started it, so all functions
+ * which wait for the DMA also wait for the scheduled blit. The blit starts just behind the refresh, which is faster than
+ * the FSMC: the refresh cannot overtake the written lines if the blit takes less than one frame (~15 msec).
+ *
+ * If no TE pulse is seen at initialization, the scanline register is polled instead.
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#include "stm32f4xx_exti.h"
+#include "stm32f4xx_syscfg.h"
+
+#define TFT_TE_PERIPH           RCC_AHB1Periph_GPIOC
+#define TFT_TE_PORT             GPIOC
+#define TFT_TE_PIN              GPIO_Pin_5
+#define TFT_TE_EXTI_PORT        EXTI_PortSourceGPIOC
+#define TFT_TE_EXTI_PIN         EXTI_PinSource5
+#define TFT_TE_EXTI_LINE        EXTI_Line5
+#define TFT_TE_IRQn             EXTI9_5_IRQn
+#define TFT_TE_ISR              EXTI9_5_IRQHandler
+
+#define TFT_SCANLINE_OFFSET     24                                              // scanline of row 0 = VSYNC_VPS in ssd1963.c
+#define TFT_SCANLINE_VBLANK     (TFT_SCANLINE_OFFSET + TFT_HEIGHT)              // first scanline after display period
+#define TFT_SCANLINE_WINDOW     8                                               // start blit at once if refresh is that close behind
+
+static volatile uint32_t        tft_frame_counter;                              // incremented by TE
+static uint32_t                 tft_frame_last;                                 // counter at last tft_frame_sync()
+static uint_fast8_t             tft_frame_te_ok;                                // 1: TE pulses seen
+static uint_fast16_t            tft_frame_te_line;                              // current TE scanline
+
+static volatile uint_fast8_t    tft_frame_pending;                              // scheduled blit:
+static uint_fast16_t            tft_frame_x0;
+static uint_fast16_t            tft_frame_x1;
+static uint_fast16_t            tft_frame_y0;
+static uint_fast16_t            tft_frame_y1;
+static const uint16_t *         tft_frame_image;
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * ISR TE (will be called once per frame, when the refresh reaches the TE scanline)
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void TFT_TE_ISR (void);
+void
+TFT_TE_ISR (void)
+{
+    if (EXTI_GetITStatus (TFT_TE_EXTI_LINE) != RESET)
+    {
+        EXTI_ClearITPendingBit (TFT_TE_EXTI_LINE);
+        tft_frame_counter++;
+
+        if (tft_frame_pending)
+        {
+            tft_frame_pending = 0;
+            tft_set_area_nowait (tft_frame_x0, tft_frame_x1, tft_frame_y0, tft_frame_y1);
+            tft_dma_start ((uint32_t) tft_frame_image, 1, (tft_frame_x1 - tft_frame_x0 + 1) * (tft_frame_y1 - tft_frame_y0 + 1));
+        }
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: set TE scanline, DMA must be idle
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_frame_set_te_line (uint_fast16_t line)
+{
+    if (tft_frame_te_line != line)
+    {
+        ssd1963_set_tear_scanline (line);
+        tft_frame_te_line = line;
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: current scanline, DMA must be idle
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast16_t
+tft_frame_scanline (void)
+{
+    uint_fast16_t   scanline;
+
+    ssd1963_get_scanline (&scanline);
+    return scanline;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: poll scanline until the refresh passes line (no TE)
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_frame_poll_line (uint_fast16_t line)
+{
+    while (tft_frame_scanline () >= line)
+    {
+        ;
+    }
+
+    while (tft_frame_scanline () < line)
+    {
+        ;
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: initialize TE input and interrupt, check if TE is connected
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_frame_init (void)
+{
+    GPIO_InitTypeDef    gpio;
+    EXTI_InitTypeDef    exti;
+    NVIC_InitTypeDef    nvic;
+    uint32_t            counter;
+
+    RCC_AHB1PeriphClockCmd (TFT_TE_PERIPH, ENABLE);
+    RCC_APB2PeriphClockCmd (RCC_APB2Periph_SYSCFG, ENABLE);
+
+    GPIO_StructInit (&gpio);
+    gpio.GPIO_Pin   = TFT_TE_PIN;
+    gpio.GPIO_Mode  = GPIO_Mode_IN;
+    gpio.GPIO_PuPd  = GPIO_PuPd_DOWN;
+    GPIO_Init (TFT_TE_PORT, &gpio);
+
+    SYSCFG_EXTILineConfig (TFT_TE_EXTI_PORT, TFT_TE_EXTI_PIN);
+
+    exti.EXTI_Line      = TFT_TE_EXTI_LINE;
+    exti.EXTI_Mode      = EXTI_Mode_Interrupt;
+    exti.EXTI_Trigger   = EXTI_Trigger_Rising;
+    exti.EXTI_LineCmd   = ENABLE;
+    EXTI_Init (&exti);
+
+    nvic.NVIC_IRQChannel                    = TFT_TE_IRQn;
+    nvic.NVIC_IRQChannelPreemptionPriority  = 2;                                // below DMA, DMA ISR may interrupt TE ISR
+    nvic.NVIC_IRQChannelSubPriority         = 0;
+    nvic.NVIC_IRQChannelCmd                 = ENABLE;
+    NVIC_Init (&nvic);
+
+    tft_frame_pending   = 0;
+    tft_frame_te_line   = 0xFFFF;
+    ssd1963_set_tear_on (0);                                                    // mode 0: V-blanking only
+    tft_frame_set_te_line (TFT_SCANLINE_VBLANK);
+
+    counter = tft_frame_counter;
+    delay_msec (50);                                                            // 3 frames at 65 Hz
+    tft_frame_te_ok     = (tft_frame_counter != counter);
+    tft_frame_last      = tft_frame_counter;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_frame_wait_vblank () - wait for next vertical blanking, sleeps until TE interrupt
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+tft_frame_wait_vblank (void)
+{
+    uint32_t    counter;
+
+    tft_dma_wait ();
+
+    if (tft_frame_te_ok)
+    {
+        tft_frame_set_te_line (TFT_SCANLINE_VBLANK);
+        counter = tft_frame_counter;
+
+        while (tft_frame_counter == counter)
+        {
+            __WFI ();
+        }
+    }
+    else
+    {
+        tft_frame_poll_line (TFT_SCANLINE_VBLANK);
+        tft_frame_counter++;
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_frame_sync () - wait until n frames have passed since the last call, returns number of frames passed
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint32_t
+tft_frame_sync (uint_fast16_t n)
+{
+    uint32_t    passed;
+
+    while (tft_frame_counter - tft_frame_last < n)
+    {
+        if (tft_frame_te_ok)
+        {
+            __WFI ();
+        }
+        else
+        {
+            tft_frame_wait_vblank ();
+        }
+    }
+
+    passed          = tft_frame_counter - tft_frame_last;
+    tft_frame_last  = tft_frame_counter;
+    return passed;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_frame_count () - number of frames since initialization (with TE), or number of waits for vertical blanking
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint32_t
+tft_frame_count (void)
+{
+    return tft_frame_counter;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_frame_blit () - schedule image transfer into area, starts when the refresh has passed the first line of the area.
+ * Returns before the transfer starts, the image must stay unchanged until tft_dma_busy() returns 0.
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+tft_frame_blit (uint_fast16_t x0, uint_fast16_t y0, uint_fast16_t x1, uint_fast16_t y1, const uint16_t * image)
+{
+    uint_fast16_t   line    = TFT_SCANLINE_OFFSET + y0;
+    uint_fast16_t   scanline;
+
+    tft_dma_wait ();
+    tft_power_draw (y0, y1);
+
+    scanline = tft_frame_scanline ();
+
+    if (scanline < line || scanline >= line + TFT_SCANLINE_WINDOW)
+    {
+        if (tft_frame_te_ok && ! TFT_IS_CCM(image))
+        {
+            tft_frame_set_te_line (line);
+            EXTI_ClearITPendingBit (TFT_TE_EXTI_LINE);
+
+            tft_frame_x0        = x0;
+            tft_frame_x1        = x1;
+            tft_frame_y0        = y0;
+            tft_frame_y1        = y1;
+            tft_frame_image     = image;
+            tft_dma_active      = 1;                                            // reserve DMA until TE ISR starts the blit
+            tft_frame_pending   = 1;
+            return;
+        }
+
+        tft_frame_poll_line (line);
+    }
+
+    tft_set_area_nowait (x0, x1, y0, y1);
+    tft_dma_write (image, (x1 - x0 + 1) * (y1 - y0 + 1));
+}
+
+#else // ILI9341 or unix: no frame pacing
+
+void
+tft_frame_wait_vblank (void)
+{
+    tft_dma_wait ();
+}
+
+uint32_t
+tft_frame_sync (uint_fast16_t n)
+{
+    (void) n;
+    return 0;
+}
+
+uint32_t
+tft_frame_count (void)
+{
+    return 0;
+}
+
+void
+tft_frame_blit (uint_fast16_t x0, uint_fast16_t y0, uint_fast16_t x1, uint_fast16_t y1, const uint16_t * image)
+{
+    tft_set_area (x0, x1, y0, y1);
+    tft_dma_write (image, (x1 - x0 + 1) * (y1 - y0 + 1));
+}
+
+#endif // SSD1963 && !unix
+
 /*-------------------------------------------------------------------------------------------------------------------------------------------
  * tft_draw_pixel () - draw pixel
  *-------------------------------------------------------------------------------------------------------------------------------------------
@@ -169,6 +918,11 @@ tft_set_area (uint_fast16_t x0, uint_fast16_t x1, uint_fast16_t y0, uint_fast16_
 void
 tft_draw_pixel (uint_fast16_t x, uint_fast16_t y, uint_fast16_t color565)
 {
+    if (tft_comp_fill (x, y, x, y, color565))
+    {
+        return;
+    }
+
     tft_set_area (x, x, y, y);
     tft_write_data (color565);
 }
@@ -180,14 +934,13 @@ tft_draw_pixel (uint_fast16_t x, uint_fast16_t y, uint_fast16_t color565)
 void
 tft_draw_horizontal_line (uint_fast16_t x0, uint_fast16_t y0, uint_fast16_t len, uint_fast16_t color565)
 {
-    uint_fast16_t   l;
-
-    tft_set_area (x0, x0 + len - 1, y0, y0);
-
-    for (l = 0; l < len; l++)
+    if (tft_comp_fill (x0, y0, x0 + len - 1, y0, color565))
     {
-        tft_write_data (color565);
+        return;
     }
+
+    tft_set_area (x0, x0 + len - 1, y0, y0);
+    tft_dma_fill (color565, len);
 }
 
 /*-------------------------------------------------------------------------------------------------------------------------------------------
@@ -197,14 +950,13 @@ tft_draw_horizontal_line (uint_fast16_t x0, uint_fast16_t y0, uint_fast16_t len,
 void
 tft_draw_vertical_line (uint_fast16_t x0, uint_fast16_t y0, uint_fast16_t height, uint_fast16_t color565)
 {
-    uint_fast16_t   h;
-
-    tft_set_area (x0, x0, y0, y0 + height - 1);
-
-    for (h = 0; h < height; h++)
+    if (tft_comp_fill (x0, y0, x0, y0 + height - 1, color565))
     {
-        tft_write_data (color565);
+        return;
     }
+
+    tft_set_area (x0, x0, y0, y0 + height - 1);
+    tft_dma_fill (color565, height);
 }
 
 /*-------------------------------------------------------------------------------------------------------------------------------------------
@@ -231,17 +983,17 @@ tft_draw_rectangle (uint_fast16_t x0, uint_fast16_t y0, uint_fast16_t x1, uint_f
 void
 tft_fill_rectangle (uint_fast16_t x0, uint_fast16_t y0, uint_fast16_t x1, uint_fast16_t y1, uint_fast16_t color565)
 {
-    uint_fast16_t   n;
-    uint_fast16_t   i;
+    uint32_t        n;
+
+    if (tft_comp_fill (x0, y0, x1, y1, color565))
+    {
+        return;
+    }
 
     n = (x1 - x0 + 1) * (y1 - y0 + 1);
 
     tft_set_area (x0, x1, y0, y1);
-
-    for (i = 0; i < n; i++)
-    {
-        tft_write_data (color565);
-    }
+    tft_dma_fill (color565, n);
 }
 
 /*-------------------------------------------------------------------------------------------------------------------------------------------
@@ -251,37 +1003,78 @@ tft_fill_rectangle (uint_fast16_t x0, uint_fast16_t y0, uint_fast16_t x1, uint_f
 void
 tft_fill_screen (uint_fast16_t color565)
 {
-    unsigned int x, y;
+    if (tft_comp_fill (0, 0, TFT_WIDTH - 1, TFT_HEIGHT - 1, color565))
+    {
+        return;
+    }
 
     tft_set_area (0, TFT_WIDTH - 1 , 0, TFT_HEIGHT - 1);
+    tft_dma_fill (color565, (uint32_t) TFT_WIDTH * TFT_HEIGHT);
 
-    for (x = 0; x < TFT_WIDTH; x++)
+    if (color565 == BLACK565)
     {
-        for (y = 0; y < TFT_HEIGHT; y++)
-        {
-            tft_write_data (color565);
-        }
+        tft_power_black_screen ();
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: draw horizontal or vertical span clipped to the screen, one window per span
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_hspan (int y, int x0, int x1, uint_fast16_t color565)
+{
+    if (y >= 0 && y < TFT_HEIGHT && x1 >= 0 && x0 < TFT_WIDTH && x0 <= x1)
+    {
+        x0 = x0 < 0 ? 0 : x0;
+        x1 = x1 >= TFT_WIDTH ? TFT_WIDTH - 1 : x1;
+        tft_draw_horizontal_line (x0, y, x1 - x0 + 1, color565);
+    }
+}
+
+static void
+tft_vspan (int x, int y0, int y1, uint_fast16_t color565)
+{
+    if (x >= 0 && x < TFT_WIDTH && y1 >= 0 && y0 < TFT_HEIGHT && y0 <= y1)
+    {
+        y0 = y0 < 0 ? 0 : y0;
+        y1 = y1 >= TFT_HEIGHT ? TFT_HEIGHT - 1 : y1;
+        tft_draw_vertical_line (x, y0, y1 - y0 + 1, color565);
     }
 }
 
+static void
+tft_span_direct (int y, int x0, int x1, void * ctx)
+{
+    tft_hspan (y, x0, x1, *(uint_fast16_t *) ctx);
+}
+
 /*-------------------------------------------------------------------------------------------------------------------------------------------
  * tft_draw_line () - draw a line using a compact variant of Bresenham algorithm
+ *
+ * Pixels in the same row (flat lines) or in the same column (steep lines) are collected to one span.
  *-------------------------------------------------------------------------------------------------------------------------------------------
  */
 void
 tft_draw_line (int x0, int y0, int x1, int y1, uint_fast16_t color565)
 {
-    int     dx  =  abs (x1 - x0);
-    int     dy  = -abs (y1 - y0);
-    int     sx  = x0 < x1 ? 1 : -1;
-    int     sy  = y0 < y1 ? 1 : -1;
-    int     err = dx + dy;
+    int     dx      =  abs (x1 - x0);
+    int     dy      = -abs (y1 - y0);
+    int     sx      = x0 < x1 ? 1 : -1;
+    int     sy      = y0 < y1 ? 1 : -1;
+    int     err     = dx + dy;
+    int     flat    = dx >= -dy;
+    int     run_x   = x0;                                                       // start of current span
+    int     run_y   = y0;
     int     e2;
 
-    while(1)
+    if (tft_comp_line (x0, y0, x1, y1, color565))
     {
-        tft_draw_pixel (x0, y0, color565);
+        return;
+    }
 
+    while(1)
+    {
         if (x0 == x1 && y0 == y1)
         {
             break;
@@ -299,21 +1092,64 @@ tft_draw_line (int x0, int y0, int x1, int y1, uint_fast16_t color565)
         {
             err += dx;
             y0 += sy;
+
+            if (flat)
+            {
+                tft_hspan (run_y, run_x < x0 - sx ? run_x : x0 - sx, run_x < x0 - sx ? x0 - sx : run_x, color565);
+                run_x = x0;
+                run_y = y0;
+            }
+        }
+
+        if (! flat && x0 != run_x)
+        {
+            tft_vspan (run_x, run_y < y0 - sy ? run_y : y0 - sy, run_y < y0 - sy ? y0 - sy : run_y, color565);
+            run_x = x0;
+            run_y = y0;
         }
     }
+
+    if (flat)
+    {
+        tft_hspan (run_y, run_x < x0 ? run_x : x0, run_x < x0 ? x0 : run_x, color565);
+    }
+    else
+    {
+        tft_vspan (run_x, run_y < y0 ? run_y : y0, run_y < y0 ? y0 : run_y, color565);
+    }
 }
 
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_draw_thick_line () - draw a line of 2 pixels width
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
 void
 tft_draw_thick_line (int x0, int y0, int x1, int y1, uint_fast16_t color565)
 {
-    tft_draw_line (x0 + 0, y0 + 0, x1 + 0, y1 + 0, color565);
-    tft_draw_line (x0 + 0, y0 + 1, x1 + 0, y1 + 1, color565);
-    tft_draw_line (x0 + 1, y0 + 0, x1 + 1, y1 + 0, color565);
-    tft_draw_line (x0 + 1, y0 + 1, x1 + 1, y1 + 1, color565);
+    tft_draw_wide_line (x0, y0, x1, y1, 2, color565);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: draw the spans of 8 octants for all points (xs..xe, y) of a circle
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_circle_spans (int x0, int y0, int xs, int xe, int y, uint_fast16_t color565)
+{
+    tft_hspan (y0 + y, x0 + xs, x0 + xe, color565);
+    tft_hspan (y0 + y, x0 - xe, x0 - xs, color565);
+    tft_hspan (y0 - y, x0 + xs, x0 + xe, color565);
+    tft_hspan (y0 - y, x0 - xe, x0 - xs, color565);
+    tft_vspan (x0 + y, y0 + xs, y0 + xe, color565);
+    tft_vspan (x0 + y, y0 - xe, y0 - xs, color565);
+    tft_vspan (x0 - y, y0 + xs, y0 + xe, color565);
+    tft_vspan (x0 - y, y0 - xe, y0 - xs, color565);
 }
 
 /*-------------------------------------------------------------------------------------------------------------------------------------------
  * tft_draw_circle () - draw a circle using a variant of Bresenham algorithm
+ *
+ * Points with equal y are collected to spans: horizontal in the octants near top and bottom, vertical near left and right.
  *-------------------------------------------------------------------------------------------------------------------------------------------
  */
 void
@@ -324,16 +1160,19 @@ tft_draw_circle (int x0, int y0, int radius, uint_fast16_t color565)
     int     ddF_y   = -2 * radius;
     int     x       = 0;
     int     y       = radius;
+    int     xs      = 0;                                                        // start of current span
 
-    tft_draw_pixel (x0, y0 + radius, color565);
-    tft_draw_pixel (x0, y0 - radius, color565);
-    tft_draw_pixel (x0 + radius, y0, color565);
-    tft_draw_pixel (x0 - radius, y0, color565);
+    if (tft_comp_circle (x0, y0, radius, color565))
+    {
+        return;
+    }
 
     while (x < y)
     {
         if (f >= 0)
         {
+            tft_circle_spans (x0, y0, xs, x, y, color565);
+            xs = x + 1;
             y--;
             ddF_y += 2;
             f += ddF_y;
@@ -342,45 +1181,312 @@ tft_draw_circle (int x0, int y0, int radius, uint_fast16_t color565)
         x++;
         ddF_x += 2;
         f += ddF_x + 1;
-
-        tft_draw_pixel (x0 + x, y0 + y, color565);
-        tft_draw_pixel (x0 - x, y0 + y, color565);
-        tft_draw_pixel (x0 + x, y0 - y, color565);
-        tft_draw_pixel (x0 - x, y0 - y, color565);
-        tft_draw_pixel (x0 + y, y0 + x, color565);
-        tft_draw_pixel (x0 - y, y0 + x, color565);
-        tft_draw_pixel (x0 + y, y0 - x, color565);
-        tft_draw_pixel (x0 - y, y0 - x, color565);
     }
+
+    tft_circle_spans (x0, y0, xs, x, y, color565);
 }
 
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_draw_thick_circle () - draw a ring of 2 pixels width
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
 void
 tft_draw_thick_circle (int x0, int y0, int radius, uint_fast16_t color565)
 {
-    tft_draw_circle (x0 + 0, y0 + 0, radius, color565);
-    tft_draw_circle (x0 + 0, y0 + 1, radius, color565);
-    tft_draw_circle (x0 + 1, y0 + 0, radius, color565);
-    tft_draw_circle (x0 + 1, y0 + 1, radius, color565);
+    if (tft_comp_ellipse (x0, y0, radius + 1, radius + 1, radius - 1, radius - 1, color565))
+    {
+        return;
+    }
+
+    tft_spans_ellipse (x0, y0, radius + 1, radius + 1, radius - 1, radius - 1, 0, TFT_HEIGHT - 1, tft_span_direct, &color565);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: half width of ellipse in row dy, -1 if outside. Pixel centers within the ellipse with radii rx + 0.5, ry + 0.5 are inside.
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+tft_ellipse_half_width (int rx, int ry, int dy)
+{
+    float   a = rx + 0.5f;
+    float   b = ry + 0.5f;
+    float   t = 1.0f - ((float) dy * dy) / (b * b);
+
+    if (rx < 0 || ry < 0 || t < 0.0f)
+    {
+        return -1;
+    }
+
+    return (int) (a * sqrtf (t));
 }
 
 /*-------------------------------------------------------------------------------------------------------------------------------------------
- * tft_draw_image () - draw an image
+ * tft_spans_ellipse () - call func for all spans of a filled ellipse in rows ymin..ymax
+ *
+ * If hrx and hry are not negative, the ellipse has a hole with these radii: two spans per row.
  *-------------------------------------------------------------------------------------------------------------------------------------------
  */
 void
-tft_draw_image (uint_fast16_t x, uint_fast16_t y, uint_fast16_t l, uint_fast16_t h, uint16_t * image)
+tft_spans_ellipse (int x0, int y0, int rx, int ry, int hrx, int hry, int ymin, int ymax, TFT_SPAN_FUNC func, void * ctx)
 {
-    tft_set_area (x, x + l - 1, y, y + h - 1);
+    int     y;
+    int     hw;
+    int     hi;
+
+    if (ymin < y0 - ry)
+    {
+        ymin = y0 - ry;
+    }
+
+    if (ymax > y0 + ry)
+    {
+        ymax = y0 + ry;
+    }
+
+    for (y = ymin; y <= ymax; y++)
+    {
+        hw = tft_ellipse_half_width (rx, ry, y - y0);
+
+        if (hw >= 0)
+        {
+            hi = (hrx >= 0 && hry >= 0) ? tft_ellipse_half_width (hrx, hry, y - y0) : -1;
+
+            if (hi < 0)
+            {
+                (*func) (y, x0 - hw, x0 + hw, ctx);
+            }
+            else if (hi < hw)
+            {
+                (*func) (y, x0 - hw, x0 - hi - 1, ctx);
+                (*func) (y, x0 + hi + 1, x0 + hw, ctx);
+            }
+        }
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_spans_polygon () - call func for all spans of a filled polygon in rows ymin..ymax
+ *
+ * Coordinates are in 1/TFT_SUBPIXEL pixels, a pixel center has integer pixel coordinates. Pixels whose center is inside
+ * are filled (even-odd rule), an edge on the left or top is inside, on the right or bottom outside.
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+tft_spans_polygon (const int * xy, int n, int ymin, int ymax, TFT_SPAN_FUNC func, void * ctx)
+{
+    int     xs[TFT_POLYGON_MAX_POINTS];
+    int     pymin   = xy[1];
+    int     pymax   = xy[1];
+    int     y;
+    int     sy;
+    int     cnt;
+    int     i;
+    int     j;
+
+    if (n < 3 || n > TFT_POLYGON_MAX_POINTS)
+    {
+        return;
+    }
+
+    for (i = 1; i < n; i++)
+    {
+        pymin = xy[2 * i + 1] < pymin ? xy[2 * i + 1] : pymin;
+        pymax = xy[2 * i + 1] > pymax ? xy[2 * i + 1] : pymax;
+    }
+
+    pymin = (pymin + TFT_SUBPIXEL - 1) >> TFT_SUBPIXEL_SHIFT;                   // first row with center >= pymin
+    pymax = (pymax + TFT_SUBPIXEL - 1) >> TFT_SUBPIXEL_SHIFT;                   // first row with center >= pymax: outside
+
+    ymin = ymin > pymin ? ymin : pymin;
+    ymax = ymax < pymax - 1 ? ymax : pymax - 1;
+
+    for (y = ymin; y <= ymax; y++)
+    {
+        sy  = y << TFT_SUBPIXEL_SHIFT;
+        cnt = 0;
+
+        for (i = 0, j = n - 1; i < n; j = i++)
+        {
+            int xa = xy[2 * j];
+            int ya = xy[2 * j + 1];
+            int xb = xy[2 * i];
+            int yb = xy[2 * i + 1];
+
+            if ((ya <= sy && sy < yb) || (yb <= sy && sy < ya))
+            {
+                int num = xa * (yb - ya) + (sy - ya) * (xb - xa);               // intersection is num / den
+                int den = (yb - ya) * TFT_SUBPIXEL;                             // in pixels
+                int x;
+                int k;
+
+                if (den < 0)
+                {
+                    num = -num;
+                    den = -den;
+                }
+
+                x = num / den + (num % den > 0);                                // first pixel center right of intersection
+
+                for (k = cnt++; k > 0 && xs[k - 1] > x; k--)                   // insertion sort
+                {
+                    xs[k] = xs[k - 1];
+                }
+                xs[k] = x;
+            }
+        }
+
+        for (i = 0; i + 1 < cnt; i += 2)
+        {
+            if (xs[i] < xs[i + 1])
+            {
+                (*func) (y, xs[i], xs[i + 1] - 1, ctx);
+            }
+        }
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: fill polygon with coordinates in 1/TFT_SUBPIXEL pixels
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_fill_polygon_sub (const int * xy, int n, uint_fast16_t color565)
+{
+    if (tft_comp_polygon (xy, n, color565))
+    {
+        return;
+    }
+
+    tft_spans_polygon (xy, n, 0, TFT_HEIGHT - 1, tft_span_direct, &color565);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_fill_circle () - draw a filled circle, one window per row
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+tft_fill_circle (int x0, int y0, int radius, uint_fast16_t color565)
+{
+    tft_fill_ellipse (x0, y0, radius, radius, color565);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_fill_ellipse () - draw a filled ellipse, one window per row
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+tft_fill_ellipse (int x0, int y0, int rx, int ry, uint_fast16_t color565)
+{
+    if (tft_comp_ellipse (x0, y0, rx, ry, -1, -1, color565))
+    {
+        return;
+    }
+
+    tft_spans_ellipse (x0, y0, rx, ry, -1, -1, 0, TFT_HEIGHT - 1, tft_span_direct, &color565);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_fill_triangle () - draw a filled triangle, one window per row
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+tft_fill_triangle (int x0, int y0, int x1, int y1, int x2, int y2, uint_fast16_t color565)
+{
+    int     xy[6];
+
+    xy[0] = x0 << TFT_SUBPIXEL_SHIFT;
+    xy[1] = y0 << TFT_SUBPIXEL_SHIFT;
+    xy[2] = x1 << TFT_SUBPIXEL_SHIFT;
+    xy[3] = y1 << TFT_SUBPIXEL_SHIFT;
+    xy[4] = x2 << TFT_SUBPIXEL_SHIFT;
+    xy[5] = y2 << TFT_SUBPIXEL_SHIFT;
+    tft_fill_polygon_sub (xy, 3, color565);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_fill_polygon () - draw a filled polygon of n points (x, y), max. TFT_POLYGON_MAX_POINTS, one window per span
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+tft_fill_polygon (const int * xy, int n, uint_fast16_t color565)
+{
+    int     sub[2 * TFT_POLYGON_MAX_POINTS];
+    int     i;
 
-    while (h--)
+    if (n >= 3 && n <= TFT_POLYGON_MAX_POINTS)
     {
-        while (l--)
+        for (i = 0; i < 2 * n; i++)
         {
-            tft_write_data (*image);
-            image++;
+            sub[i] = xy[i] << TFT_SUBPIXEL_SHIFT;
         }
+
+        tft_fill_polygon_sub (sub, n, color565);
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_draw_wide_line () - draw a line of given width as a filled quad, the end points are included
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+tft_draw_wide_line (int x0, int y0, int x1, int y1, int width, uint_fast16_t color565)
+{
+    float   dx  = x1 - x0;
+    float   dy  = y1 - y0;
+    float   len = sqrtf (dx * dx + dy * dy);
+    float   ux;                                                                 // half a pixel along the line
+    float   uy;
+    float   nx;                                                                 // half the width across the line
+    float   ny;
+    int     xy[8];
+
+    if (width <= 1)
+    {
+        tft_draw_line (x0, y0, x1, y1, color565);
+        return;
+    }
+
+    if (len == 0.0f)                                                            // square of width x width
+    {
+        ux = 0.5f * width;
+        uy = 0.0f;
+        nx = 0.0f;
+        ny = 0.5f * width;
+    }
+    else
+    {
+        ux = 0.5f * dx / len;
+        uy = 0.5f * dy / len;
+        nx = -uy * width;
+        ny =  ux * width;
+    }
+
+    xy[0] = lroundf ((x0 - ux + nx) * TFT_SUBPIXEL);
+    xy[1] = lroundf ((y0 - uy + ny) * TFT_SUBPIXEL);
+    xy[2] = lroundf ((x1 + ux + nx) * TFT_SUBPIXEL);
+    xy[3] = lroundf ((y1 + uy + ny) * TFT_SUBPIXEL);
+    xy[4] = lroundf ((x1 + ux - nx) * TFT_SUBPIXEL);
+    xy[5] = lroundf ((y1 + uy - ny) * TFT_SUBPIXEL);
+    xy[6] = lroundf ((x0 - ux - nx) * TFT_SUBPIXEL);
+    xy[7] = lroundf ((y0 - uy - ny) * TFT_SUBPIXEL);
+    tft_fill_polygon_sub (xy, 4, color565);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_draw_image () - draw an image, returns before completion, see tft_dma_write()
+ * With the compositor started, the image is copied into the display list, see tft_comp.c
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+tft_draw_image (uint_fast16_t x, uint_fast16_t y, uint_fast16_t l, uint_fast16_t h, uint16_t * image)
+{
+    if (tft_comp_image (x, y, l, h, image))
+    {
+        return;
     }
 
+    tft_set_area (x, x + l - 1, y, y + h - 1);
+    tft_dma_write (image, (uint32_t) l * h);
 }
 
 /*-------------------------------------------------------------------------------------------------------------------------------------------
@@ -475,14 +1581,44 @@ tft_init (uint_fast8_t orientation)
     ili9341_init ();
 #endif
 
+    tft_dma_init ();
+
     if (orientation)
     {
         tft_set_flags (orientation);
     }
+
+#if defined (SSD1963) && ! defined (unix)
+    tft_frame_init ();
+    tft_power_init ();
+#endif
 }
 
 #else // no TFT, define stubs:
 
+uint_fast8_t
+tft_dma_busy (void)
+{
+    return 0;
+}
+
+void
+tft_dma_wait (void)
+{
+}
+
+void
+tft_dma_fill (uint_fast16_t color565, uint32_t count)
+{
+    (void) color565, (void) count;
+}
+
+void
+tft_dma_write (const uint16_t * data, uint32_t count)
+{
+    (void) data, (void) count;
+}
+
 void
 tft_fadein_backlight (uint32_t delay_ms)
 {
@@ -571,6 +1707,36 @@ tft_draw_thick_circle (int x0, int y0, int radius, uint_fast16_t color565)
     (void) x0, (void) y0, (void) radius, (void) color565;
 }
 
+void
+tft_fill_circle (int x0, int y0, int radius, uint_fast16_t color565)
+{
+    (void) x0, (void) y0, (void) radius, (void) color565;
+}
+
+void
+tft_fill_ellipse (int x0, int y0, int rx, int ry, uint_fast16_t color565)
+{
+    (void) x0, (void) y0, (void) rx, (void) ry, (void) color565;
+}
+
+void
+tft_fill_triangle (int x0, int y0, int x1, int y1, int x2, int y2, uint_fast16_t color565)
+{
+    (void) x0, (void) y0, (void) x1, (void) y1, (void) x2, (void) y2, (void) color565;
+}
+
+void
+tft_fill_polygon (const int * xy, int n, uint_fast16_t color565)
+{
+    (void) xy, (void) n, (void) color565;
+}
+
+void
+tft_draw_wide_line (int x0, int y0, int x1, int y1, int width, uint_fast16_t color565)
+{
+    (void) x0, (void) y0, (void) x1, (void) y1, (void) width, (void) color565;
+}
+
 void
 tft_draw_image (uint_fast16_t x, uint_fast16_t y, uint_fast16_t l, uint_fast16_t h, uint16_t * image)
 {
@@ -597,6 +1763,36 @@ tft_init (uint_fast8_t orientation)
     (void) orientation;
 }
 
+void
+tft_frame_wait_vblank (void)
+{
+}
+
+uint32_t
+tft_frame_sync (uint_fast16_t n)
+{
+    (void) n;
+    return 0;
+}
+
+uint32_t
+tft_frame_count (void)
+{
+    return 0;
+}
+
+void
+tft_power_poll (void)
+{
+}
+
+uint_fast8_t
+tft_profile_set (uint_fast8_t profile, uint32_t idle_ms)
+{
+    (void) profile, (void) idle_ms;
+    return 0;
+}
+
 #endif // ILI9341 || SSD1963
 
-#endif // STM32F407VE
+#endif // STM32F407VE || unix
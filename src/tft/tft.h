@@ -51,11 +51,22 @@
 #define GRAY565         (DARK_RED565 | DARK_GREEN565 | DARK_BLUE565)
 #define WHITE565        0xFFFF
 
+#define TFT_SUBPIXEL_SHIFT      4                                               // polygon coordinates in 1/16 pixels
+#define TFT_SUBPIXEL            (1 << TFT_SUBPIXEL_SHIFT)
+#define TFT_POLYGON_MAX_POINTS  16
+
+typedef void (* TFT_SPAN_FUNC) (int, int, int, void *);                         // y, x0, x1, context
+
 extern void             tft_fadein_backlight (uint32_t);
 extern void             tft_fadeout_backlight (uint32_t);
 extern void             tft_backlight_on (void);
 extern void             tft_backlight_off (void);
 
+extern uint_fast8_t     tft_dma_busy (void);
+extern void             tft_dma_wait (void);
+extern void             tft_dma_fill (uint_fast16_t, uint32_t);
+extern void             tft_dma_write (const uint16_t *, uint32_t);
+
 extern void             tft_set_area (uint_fast16_t, uint_fast16_t, uint_fast16_t, uint_fast16_t);
 extern void             tft_draw_pixel (uint_fast16_t, uint_fast16_t, uint_fast16_t);
 extern void             tft_draw_horizontal_line (uint_fast16_t, uint_fast16_t, uint_fast16_t, uint_fast16_t);
@@ -67,9 +78,75 @@ extern void             tft_draw_line (int, int, int, int, uint_fast16_t);
 extern void             tft_draw_thick_line (int, int, int, int, uint_fast16_t);
 extern void             tft_draw_circle (int, int, int, uint_fast16_t);
 extern void             tft_draw_thick_circle (int, int, int, uint_fast16_t);
+extern void             tft_fill_circle (int, int, int, uint_fast16_t);
+extern void             tft_fill_ellipse (int, int, int, int, uint_fast16_t);
+extern void             tft_fill_triangle (int, int, int, int, int, int, uint_fast16_t);
+extern void             tft_fill_polygon (const int *, int, uint_fast16_t);
+extern void             tft_draw_wide_line (int, int, int, int, int, uint_fast16_t);
+extern void             tft_spans_ellipse (int, int, int, int, int, int, int, int, TFT_SPAN_FUNC, void *);
+extern void             tft_spans_polygon (const int *, int, int, int, TFT_SPAN_FUNC, void *);
 extern void             tft_draw_image (uint_fast16_t, uint_fast16_t, uint_fast16_t, uint_fast16_t, uint16_t *);
 extern uint_fast16_t    tft_rgb64_to_color565 (uint_fast8_t, uint_fast8_t, uint_fast8_t);
 extern uint_fast16_t    tft_rgb256_to_color565 (uint_fast8_t, uint_fast8_t, uint_fast8_t);
 extern void             tft_init (uint_fast8_t);
 
+extern void             tft_frame_wait_vblank (void);
+extern uint32_t         tft_frame_sync (uint_fast16_t);
+extern uint32_t         tft_frame_count (void);
+extern void             tft_frame_blit (uint_fast16_t, uint_fast16_t, uint_fast16_t, uint_fast16_t, const uint16_t *);
+
+extern int              tft_draw_file (const char *, uint_fast16_t, uint_fast16_t);
+
+#define TFT_PROFILE_FULL        0                                               // power profiles, see tft_profile_set()
+#define TFT_PROFILE_BALANCED    1
+#define TFT_PROFILE_SAVE        2
+#define TFT_PROFILE_MINIMUM     3
+
+extern uint_fast8_t     tft_profile_set (uint_fast8_t, uint32_t);
+extern void             tft_power_poll (void);
+
+extern uint_fast8_t     tft_comp_active (void);
+extern uint_fast8_t     tft_comp_fill (int, int, int, int, uint_fast16_t);
+extern uint_fast8_t     tft_comp_line (int, int, int, int, uint_fast16_t);
+extern uint_fast8_t     tft_comp_circle (int, int, int, uint_fast16_t);
+extern uint_fast8_t     tft_comp_ellipse (int, int, int, int, int, int, uint_fast16_t);
+extern uint_fast8_t     tft_comp_polygon (const int *, int, uint_fast16_t);
+extern uint_fast8_t     tft_comp_image (int, int, int, int, const uint16_t *);
+extern uint_fast8_t     tft_comp_glyph (int, unsigned char, int, int, int, int, uint_fast16_t, uint_fast16_t);
+extern int              tft_comp_flush (void);
+extern void             tft_comp_start (uint_fast16_t);
+extern void             tft_comp_stop (void);
+extern int              tft_comp_entries_used (void);
+
+extern void             tft_term_putc (uint_fast8_t);
+extern void             tft_term_start (int);
+extern void             tft_term_stop (void);
+extern uint_fast8_t     tft_term_active (void);
+extern uint_fast8_t     tft_term_get_rows (void);
+extern uint_fast8_t     tft_term_get_cols (void);
+
+#ifdef unix
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * simulated controller for host builds, see tft_sim.c
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#define TFT_SIM_WRITE_NSEC      173                                             // FSMC mode A: ADDSET 15 + DATAST 13 + 1 HCLK at 168 MHz
+
+typedef struct
+{
+    unsigned long   commands;                                                   // counters
+    unsigned long   data_words;                                                 // parameters and pixels
+    unsigned long   pixels;                                                     // data words written to display memory
+    unsigned long   windows;                                                    // column/page address commands which changed the window
+    unsigned long   reads;                                                      // data words read
+    unsigned long   clipped;                                                    // pixels written outside of display memory
+    unsigned long   bus_nsec;                                                   // simulated bus time
+} TFT_SIM;
+
+extern TFT_SIM          tft_sim;
+extern void             tft_sim_reset_counters (void);
+extern uint_fast16_t    tft_sim_get_pixel (uint_fast16_t, uint_fast16_t);
+extern int              tft_sim_write_ppm (const char *);
+#endif
+
 #endif // TFT_H
@@ -0,0 +1,822 @@
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_comp.c - tile based compositor for TFT
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ * While the compositor is started, the tft_draw_* functions and draw_letter()/draw_string() do not write to the display.
+ * They append a primitive to a display list and mark the tiles touched by its bounding box dirty. tft_comp_flush()
+ * renders only the dirty tiles: each tile is rendered from the display list into a tile buffer which is sent by DMA,
+ * while the next tile is rendered into the second buffer. Nothing flickers and the cost is proportional to the changed area.
+ *
+ * The display list and the tile buffers are in SRAM, CCM RAM is left to the RAM disk. The tile buffers must be DMA reachable anyway.
+ * An opaque primitive (filled rectangle, image) removes all older primitives which it covers completely, so redrawing
+ * the background of a widget keeps the list short. tft_fill_screen() empties the list.
+ *
+ * Images are copied into a pool of TFT_COMP_IMAGE_PIXELS pixels, so the caller may free its image after tft_draw_image().
+ *
+ * If the display list overflows, the dirty tiles are flushed and the following primitives are drawn directly until
+ * the next tft_fill_screen().
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ * MIT License
+ *
+ * Copyright (c) 2018-2021 Frank Meyer - frank(at)fli4l.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if defined STM32F407VE || defined unix                                         // TFT & SSD1963 only for STM32F407, unix: see tft_sim.c
+
+#include <stdint.h>
+#include <string.h>
+#include "tft.h"
+
+#if defined ILI9341 || defined SSD1963
+
+#include "font.h"
+
+#define TFT_COMP_TILE_WIDTH     32
+#define TFT_COMP_TILE_HEIGHT    32
+#define TFT_COMP_TILES_X        ((TFT_WIDTH  + TFT_COMP_TILE_WIDTH  - 1) / TFT_COMP_TILE_WIDTH)
+#define TFT_COMP_TILES_Y        ((TFT_HEIGHT + TFT_COMP_TILE_HEIGHT - 1) / TFT_COMP_TILE_HEIGHT)
+#define TFT_COMP_TILES          (TFT_COMP_TILES_X * TFT_COMP_TILES_Y)
+#define TFT_COMP_MAX_ENTRIES    256                                             // 32 bytes each
+#define TFT_COMP_IMAGE_PIXELS   4096                                            // images are copied, e.g. one 64x64 image
+
+#define TFT_COMP_FILL           1                                               // filled rectangle, also pixels and h/v lines
+#define TFT_COMP_LINE           2                                               // line, p[] = end points
+#define TFT_COMP_CIRCLE         3                                               // circle, p[] = center and radius
+#define TFT_COMP_IMAGE          4                                               // image
+#define TFT_COMP_GLYPH          5                                               // glyph of a font
+#define TFT_COMP_ELLIPSE        6                                               // filled ellipse, p[] = center, radii, radii of hole
+#define TFT_COMP_POLYGON        7                                               // filled polygon, p[] = 3 or 4 points in 1/TFT_SUBPIXEL
+#define TFT_COMP_POLYGON_POINTS 4
+
+typedef struct
+{
+    uint8_t             type;
+    uint8_t             font;                                                   // GLYPH: font
+    uint8_t             ch;                                                     // GLYPH: character
+    uint8_t             n;                                                      // POLYGON: number of points
+    uint16_t            color565;                                               // foreground
+    uint16_t            bcolor565;                                              // GLYPH: background
+    int16_t             x0;                                                     // bounding box, clipped to screen
+    int16_t             y0;
+    int16_t             x1;
+    int16_t             y1;
+    union
+    {
+        int16_t             p[2 * TFT_COMP_POLYGON_POINTS];                     // LINE, CIRCLE, ELLIPSE, POLYGON: parameters
+        const uint16_t *    image;                                              // IMAGE: copy in tft_comp_images, width is x1 - x0 + 1
+    } u;
+} TFT_COMP_ENTRY;
+
+static TFT_COMP_ENTRY           tft_comp_list[TFT_COMP_MAX_ENTRIES];            // SRAM: CCM RAM is reserved for the RAM disk
+static uint_fast16_t            tft_comp_entries;
+static uint32_t                 tft_comp_dirty[(TFT_COMP_TILES + 31) / 32];
+static uint16_t                 tft_comp_bcolor565;                             // background below all entries
+static uint_fast8_t             tft_comp_started;
+static uint_fast8_t             tft_comp_overflow;                              // list overflowed, draw directly
+static uint16_t                 tft_comp_images[TFT_COMP_IMAGE_PIXELS];         // pixels of IMAGE entries
+static uint_fast16_t            tft_comp_images_used;
+
+static uint16_t                 tft_comp_tile[2][TFT_COMP_TILE_WIDTH * TFT_COMP_TILE_HEIGHT]; // SRAM: DMA reachable
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: mark tiles touched by a rectangle dirty
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_comp_mark (int x0, int y0, int x1, int y1)
+{
+    int     tx;
+    int     ty;
+    int     t;
+
+    for (ty = y0 / TFT_COMP_TILE_HEIGHT; ty <= y1 / TFT_COMP_TILE_HEIGHT; ty++)
+    {
+        for (tx = x0 / TFT_COMP_TILE_WIDTH; tx <= x1 / TFT_COMP_TILE_WIDTH; tx++)
+        {
+            t = ty * TFT_COMP_TILES_X + tx;
+            tft_comp_dirty[t / 32] |= 1UL << (t % 32);
+        }
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: close the gaps of removed images in tft_comp_images. The images are stored in the order of their entries.
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_comp_images_compact (void)
+{
+    uint_fast32_t   used = 0;
+    uint_fast32_t   pixels;
+    uint_fast16_t   i;
+
+    for (i = 0; i < tft_comp_entries; i++)
+    {
+        TFT_COMP_ENTRY * e = tft_comp_list + i;
+
+        if (e->type == TFT_COMP_IMAGE)
+        {
+            pixels = (uint_fast32_t) (e->x1 - e->x0 + 1) * (e->y1 - e->y0 + 1);
+
+            if (e->u.image != tft_comp_images + used)
+            {
+                memmove (tft_comp_images + used, e->u.image, pixels * sizeof (uint16_t));
+                e->u.image = tft_comp_images + used;
+            }
+
+            used += pixels;
+        }
+    }
+
+    tft_comp_images_used = used;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: append entry, returns 0 if the caller has to draw directly
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast8_t
+tft_comp_add (const TFT_COMP_ENTRY * e)
+{
+    uint_fast8_t    opaque = (e->type == TFT_COMP_FILL || e->type == TFT_COMP_IMAGE);
+    uint_fast32_t   pixels = 0;
+    uint_fast8_t    images_removed = 0;
+    uint_fast16_t   i;
+    uint_fast16_t   n;
+
+    if (opaque)
+    {
+        if (e->x0 == 0 && e->y0 == 0 && e->x1 == TFT_WIDTH - 1 && e->y1 == TFT_HEIGHT - 1)
+        {
+            tft_comp_overflow = 0;                                              // full screen: the list can be used again
+        }
+
+        if (! tft_comp_overflow)
+        {
+            for (i = 0, n = 0; i < tft_comp_entries; i++)                       // remove entries which are covered completely
+            {
+                const TFT_COMP_ENTRY * old = tft_comp_list + i;
+
+                if (old->x0 < e->x0 || old->y0 < e->y0 || old->x1 > e->x1 || old->y1 > e->y1)
+                {
+                    if (n != i)
+                    {
+                        tft_comp_list[n] = *old;
+                    }
+                    n++;
+                }
+                else if (old->type == TFT_COMP_IMAGE)
+                {
+                    images_removed = 1;
+                }
+            }
+            tft_comp_entries = n;
+
+            if (images_removed)
+            {
+                tft_comp_images_compact ();                                     // e.g. a redrawn icon reuses the pool
+            }
+        }
+    }
+
+    if (tft_comp_overflow)
+    {
+        return 0;
+    }
+
+    if (e->type == TFT_COMP_IMAGE)
+    {
+        pixels = (uint_fast32_t) (e->x1 - e->x0 + 1) * (e->y1 - e->y0 + 1);
+    }
+
+    if (tft_comp_entries == TFT_COMP_MAX_ENTRIES || tft_comp_images_used + pixels > TFT_COMP_IMAGE_PIXELS)
+    {
+        tft_comp_flush ();
+        tft_comp_overflow = 1;
+        return 0;
+    }
+
+    tft_comp_list[tft_comp_entries] = *e;
+
+    if (pixels)                                                                 // the caller may free or change its image
+    {
+        memcpy (tft_comp_images + tft_comp_images_used, e->u.image, pixels * sizeof (uint16_t));
+        tft_comp_list[tft_comp_entries].u.image = tft_comp_images + tft_comp_images_used;
+        tft_comp_images_used += pixels;
+    }
+
+    tft_comp_entries++;
+    tft_comp_mark (e->x0, e->y0, e->x1, e->y1);
+    return 1;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: clip bounding box to screen, returns 0 if invisible
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast8_t
+tft_comp_clip (TFT_COMP_ENTRY * e, int x0, int y0, int x1, int y1)
+{
+    if (x1 < 0 || y1 < 0 || x0 >= TFT_WIDTH || y0 >= TFT_HEIGHT || x0 > x1 || y0 > y1)
+    {
+        return 0;
+    }
+
+    e->x0 = x0 < 0 ? 0 : x0;
+    e->y0 = y0 < 0 ? 0 : y0;
+    e->x1 = x1 >= TFT_WIDTH  ? TFT_WIDTH  - 1 : x1;
+    e->y1 = y1 >= TFT_HEIGHT ? TFT_HEIGHT - 1 : y1;
+    return 1;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_comp_active () - check if primitives are recorded
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast8_t
+tft_comp_active (void)
+{
+    return tft_comp_started && ! tft_comp_overflow;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_comp_fill () - record filled rectangle, returns 0 if the caller has to draw directly
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast8_t
+tft_comp_fill (int x0, int y0, int x1, int y1, uint_fast16_t color565)
+{
+    TFT_COMP_ENTRY  e;
+
+    if (! tft_comp_started)                                                     // after overflow a full screen fill restarts
+    {
+        return 0;
+    }
+
+    if (! tft_comp_clip (&e, x0, y0, x1, y1))
+    {
+        return 1;
+    }
+
+    e.type      = TFT_COMP_FILL;
+    e.color565  = color565;
+    return tft_comp_add (&e);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_comp_line () - record line, returns 0 if the caller has to draw directly
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast8_t
+tft_comp_line (int x0, int y0, int x1, int y1, uint_fast16_t color565)
+{
+    TFT_COMP_ENTRY  e;
+
+    if (! tft_comp_started || tft_comp_overflow)
+    {
+        return 0;
+    }
+
+    if (! tft_comp_clip (&e, x0 < x1 ? x0 : x1, y0 < y1 ? y0 : y1, x0 < x1 ? x1 : x0, y0 < y1 ? y1 : y0))
+    {
+        return 1;
+    }
+
+    e.type      = TFT_COMP_LINE;
+    e.color565  = color565;
+    e.u.p[0]    = x0;
+    e.u.p[1]    = y0;
+    e.u.p[2]    = x1;
+    e.u.p[3]    = y1;
+    return tft_comp_add (&e);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_comp_circle () - record circle, returns 0 if the caller has to draw directly
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast8_t
+tft_comp_circle (int x0, int y0, int radius, uint_fast16_t color565)
+{
+    TFT_COMP_ENTRY  e;
+
+    if (! tft_comp_started || tft_comp_overflow)
+    {
+        return 0;
+    }
+
+    if (! tft_comp_clip (&e, x0 - radius, y0 - radius, x0 + radius, y0 + radius))
+    {
+        return 1;
+    }
+
+    e.type      = TFT_COMP_CIRCLE;
+    e.color565  = color565;
+    e.u.p[0]    = x0;
+    e.u.p[1]    = y0;
+    e.u.p[2]    = radius;
+    return tft_comp_add (&e);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_comp_ellipse () - record filled ellipse with optional hole, returns 0 if the caller has to draw directly
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast8_t
+tft_comp_ellipse (int x0, int y0, int rx, int ry, int hrx, int hry, uint_fast16_t color565)
+{
+    TFT_COMP_ENTRY  e;
+
+    if (! tft_comp_started || tft_comp_overflow)
+    {
+        return 0;
+    }
+
+    if (! tft_comp_clip (&e, x0 - rx, y0 - ry, x0 + rx, y0 + ry))
+    {
+        return 1;
+    }
+
+    e.type      = TFT_COMP_ELLIPSE;
+    e.color565  = color565;
+    e.u.p[0]    = x0;
+    e.u.p[1]    = y0;
+    e.u.p[2]    = rx;
+    e.u.p[3]    = ry;
+    e.u.p[4]    = hrx;
+    e.u.p[5]    = hry;
+    return tft_comp_add (&e);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_comp_polygon () - record filled polygon, coordinates in 1/TFT_SUBPIXEL pixels, returns 0 if the caller has to draw directly.
+ * Polygons with more than TFT_COMP_POLYGON_POINTS points are drawn directly, so their spans get recorded as fills.
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast8_t
+tft_comp_polygon (const int * xy, int n, uint_fast16_t color565)
+{
+    TFT_COMP_ENTRY  e;
+    int             x0 = xy[0];
+    int             y0 = xy[1];
+    int             x1 = xy[0];
+    int             y1 = xy[1];
+    int             i;
+
+    if (! tft_comp_started || tft_comp_overflow || n > TFT_COMP_POLYGON_POINTS)
+    {
+        return 0;
+    }
+
+    for (i = 0; i < 2 * n; i += 2)
+    {
+        if (xy[i] < INT16_MIN || xy[i] > INT16_MAX || xy[i + 1] < INT16_MIN || xy[i + 1] > INT16_MAX)
+        {
+            return 0;
+        }
+
+        x0 = xy[i]     < x0 ? xy[i]     : x0;
+        x1 = xy[i]     > x1 ? xy[i]     : x1;
+        y0 = xy[i + 1] < y0 ? xy[i + 1] : y0;
+        y1 = xy[i + 1] > y1 ? xy[i + 1] : y1;
+        e.u.p[i]     = xy[i];
+        e.u.p[i + 1] = xy[i + 1];
+    }
+
+    if (! tft_comp_clip (&e, x0 >> TFT_SUBPIXEL_SHIFT, y0 >> TFT_SUBPIXEL_SHIFT, (x1 >> TFT_SUBPIXEL_SHIFT) + 1, (y1 >> TFT_SUBPIXEL_SHIFT) + 1))
+    {
+        return 1;
+    }
+
+    e.type      = TFT_COMP_POLYGON;
+    e.n         = n;
+    e.color565  = color565;
+    return tft_comp_add (&e);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_comp_image () - record image, returns 0 if the caller has to draw directly. The image is copied, if the images in the
+ * display list need more than TFT_COMP_IMAGE_PIXELS in total, the list overflows. Covered images free their pixels.
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast8_t
+tft_comp_image (int x, int y, int l, int h, const uint16_t * image)
+{
+    TFT_COMP_ENTRY  e;
+
+    if (! tft_comp_started || tft_comp_overflow)
+    {
+        return 0;
+    }
+
+    if (x < 0 || y < 0 || x + l > TFT_WIDTH || y + h > TFT_HEIGHT || l <= 0 || h <= 0)
+    {
+        return 1;                                                               // tft_draw_image() does not clip either
+    }
+
+    e.type      = TFT_COMP_IMAGE;
+    e.x0        = x;
+    e.y0        = y;
+    e.x1        = x + l - 1;
+    e.y1        = y + h - 1;
+    e.u.image   = image;
+    return tft_comp_add (&e);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_comp_glyph () - record glyph, returns 0 if the caller has to draw directly
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast8_t
+tft_comp_glyph (int font, unsigned char ch, int x, int y, int width, int height, uint_fast16_t fcolor565, uint_fast16_t bcolor565)
+{
+    TFT_COMP_ENTRY  e;
+
+    if (! tft_comp_started || tft_comp_overflow)
+    {
+        return 0;
+    }
+
+    if (! tft_comp_clip (&e, x, y, x + width - 1, y + height - 1))
+    {
+        return 1;
+    }
+
+    e.type      = TFT_COMP_GLYPH;
+    e.font      = font;
+    e.ch        = ch;
+    e.color565  = fcolor565;
+    e.bcolor565 = bcolor565;
+    e.u.p[0]    = x;
+    e.u.p[1]    = y;
+    return tft_comp_add (&e);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: render entry into tile (tx0, ty0) of size tw x th
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+typedef struct
+{
+    uint16_t *      buf;
+    int             tx0;
+    int             ty0;
+    int             tw;
+    uint16_t        color565;
+} TFT_COMP_SPAN_CTX;
+
+static void
+tft_comp_span (int y, int x0, int x1, void * ctx)
+{
+    TFT_COMP_SPAN_CTX * c = ctx;
+    uint16_t *          p;
+
+    x0 = x0 < c->tx0 ? c->tx0 : x0;
+    x1 = x1 > c->tx0 + c->tw - 1 ? c->tx0 + c->tw - 1 : x1;
+
+    for (p = c->buf + (y - c->ty0) * c->tw + x0 - c->tx0; x0 <= x1; x0++)
+    {
+        *p++ = c->color565;
+    }
+}
+
+#define TFT_COMP_PLOT(px,py)                                                                                        \
+    do                                                                                                              \
+    {                                                                                                               \
+        if ((px) >= tx0 && (px) < tx0 + tw && (py) >= ty0 && (py) < ty0 + th)                                       \
+        {                                                                                                           \
+            buf[((py) - ty0) * tw + (px) - tx0] = color565;                                                         \
+        }                                                                                                           \
+    } while (0)
+
+static void
+tft_comp_render (const TFT_COMP_ENTRY * e, uint16_t * buf, int tx0, int ty0, int tw, int th)
+{
+    uint16_t        color565 = e->color565;
+    int             x0       = e->x0 > tx0 ? e->x0 : tx0;                       // intersection of bounding box and tile
+    int             y0       = e->y0 > ty0 ? e->y0 : ty0;
+    int             x1       = e->x1 < tx0 + tw - 1 ? e->x1 : tx0 + tw - 1;
+    int             y1       = e->y1 < ty0 + th - 1 ? e->y1 : ty0 + th - 1;
+    int             x;
+    int             y;
+
+    switch (e->type)
+    {
+        case TFT_COMP_FILL:
+        {
+            for (y = y0; y <= y1; y++)
+            {
+                uint16_t * p = buf + (y - ty0) * tw + x0 - tx0;
+
+                for (x = x0; x <= x1; x++)
+                {
+                    *p++ = color565;
+                }
+            }
+            break;
+        }
+
+        case TFT_COMP_IMAGE:
+        {
+            int l = e->x1 - e->x0 + 1;
+
+            for (y = y0; y <= y1; y++)
+            {
+                memcpy (buf + (y - ty0) * tw + x0 - tx0, e->u.image + (y - e->y0) * l + x0 - e->x0, (x1 - x0 + 1) * sizeof (uint16_t));
+            }
+            break;
+        }
+
+        case TFT_COMP_LINE:                                                     // same Bresenham variant as tft_draw_line()
+        {
+            int     lx0 = e->u.p[0];
+            int     ly0 = e->u.p[1];
+            int     lx1 = e->u.p[2];
+            int     ly1 = e->u.p[3];
+            int     dx  =  (lx1 > lx0) ? lx1 - lx0 : lx0 - lx1;
+            int     dy  = -((ly1 > ly0) ? ly1 - ly0 : ly0 - ly1);
+            int     sx  = lx0 < lx1 ? 1 : -1;
+            int     sy  = ly0 < ly1 ? 1 : -1;
+            int     err = dx + dy;
+            int     e2;
+
+            while (1)
+            {
+                TFT_COMP_PLOT (lx0, ly0);
+
+                if (lx0 == lx1 && ly0 == ly1)
+                {
+                    break;
+                }
+
+                e2 = 2 * err;
+
+                if (e2 > dy)
+                {
+                    err += dy;
+                    lx0 += sx;
+                }
+
+                if (e2 < dx)
+                {
+                    err += dx;
+                    ly0 += sy;
+                }
+            }
+            break;
+        }
+
+        case TFT_COMP_CIRCLE:                                                   // same Bresenham variant as tft_draw_circle()
+        {
+            int     cx      = e->u.p[0];
+            int     cy      = e->u.p[1];
+            int     radius  = e->u.p[2];
+            int     f       = 1 - radius;
+            int     ddF_x   = 0;
+            int     ddF_y   = -2 * radius;
+
+            x = 0;
+            y = radius;
+
+            TFT_COMP_PLOT (cx, cy + radius);
+            TFT_COMP_PLOT (cx, cy - radius);
+            TFT_COMP_PLOT (cx + radius, cy);
+            TFT_COMP_PLOT (cx - radius, cy);
+
+            while (x < y)
+            {
+                if (f >= 0)
+                {
+                    y--;
+                    ddF_y += 2;
+                    f += ddF_y;
+                }
+
+                x++;
+                ddF_x += 2;
+                f += ddF_x + 1;
+
+                TFT_COMP_PLOT (cx + x, cy + y);
+                TFT_COMP_PLOT (cx - x, cy + y);
+                TFT_COMP_PLOT (cx + x, cy - y);
+                TFT_COMP_PLOT (cx - x, cy - y);
+                TFT_COMP_PLOT (cx + y, cy + x);
+                TFT_COMP_PLOT (cx - y, cy + x);
+                TFT_COMP_PLOT (cx + y, cy - x);
+                TFT_COMP_PLOT (cx - y, cy - x);
+            }
+            break;
+        }
+
+        case TFT_COMP_ELLIPSE:
+        case TFT_COMP_POLYGON:
+        {
+            TFT_COMP_SPAN_CTX   c;
+
+            c.buf       = buf;
+            c.tx0       = tx0;
+            c.ty0       = ty0;
+            c.tw        = tw;
+            c.color565  = color565;
+
+            if (e->type == TFT_COMP_ELLIPSE)
+            {
+                tft_spans_ellipse (e->u.p[0], e->u.p[1], e->u.p[2], e->u.p[3], e->u.p[4], e->u.p[5], y0, y1, tft_comp_span, &c);
+            }
+            else
+            {
+                int     xy[2 * TFT_COMP_POLYGON_POINTS];
+                int     i;
+
+                for (i = 0; i < 2 * e->n; i++)
+                {
+                    xy[i] = e->u.p[i];
+                }
+
+                tft_spans_polygon (xy, e->n, y0, y1, tft_comp_span, &c);
+            }
+            break;
+        }
+
+        case TFT_COMP_GLYPH:
+        {
+            uint32_t        rows[FONT_MAX_HEIGHT];
+            uint_fast8_t    width;
+            int             gx = e->u.p[0];
+            int             gy = e->u.p[1];
+
+            font_glyph_rows (e->font, e->ch, rows, &width);
+
+            for (y = y0; y <= y1; y++)
+            {
+                uint32_t    row = rows[y - gy];
+                uint16_t *  p   = buf + (y - ty0) * tw + x0 - tx0;
+
+                for (x = x0; x <= x1; x++)
+                {
+                    *p++ = (row & (1UL << (width - 1 - (x - gx)))) ? color565 : e->bcolor565;
+                }
+            }
+            break;
+        }
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_comp_flush () - render and send all dirty tiles, returns number of tiles sent
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+int
+tft_comp_flush (void)
+{
+    uint_fast8_t    b = 0;
+    int             sent = 0;
+    int             t;
+
+    tft_dma_wait ();                                                            // DMA of the last flush may still read tft_comp_tile[0]
+
+    for (t = 0; t < TFT_COMP_TILES; t++)
+    {
+        if (tft_comp_dirty[t / 32] & (1UL << (t % 32)))
+        {
+            int         tx0     = (t % TFT_COMP_TILES_X) * TFT_COMP_TILE_WIDTH;
+            int         ty0     = (t / TFT_COMP_TILES_X) * TFT_COMP_TILE_HEIGHT;
+            int         tw      = TFT_WIDTH  - tx0 < TFT_COMP_TILE_WIDTH  ? TFT_WIDTH  - tx0 : TFT_COMP_TILE_WIDTH;
+            int         th      = TFT_HEIGHT - ty0 < TFT_COMP_TILE_HEIGHT ? TFT_HEIGHT - ty0 : TFT_COMP_TILE_HEIGHT;
+            uint16_t *  buf     = tft_comp_tile[b];
+            int         first   = -1;
+            int         i;
+
+            for (i = tft_comp_entries - 1; i >= 0; i--)                                 // topmost opaque entry covering the tile
+            {
+                const TFT_COMP_ENTRY * e = tft_comp_list + i;
+
+                if ((e->type == TFT_COMP_FILL || e->type == TFT_COMP_IMAGE) &&
+                    e->x0 <= tx0 && e->y0 <= ty0 && e->x1 >= tx0 + tw - 1 && e->y1 >= ty0 + th - 1)
+                {
+                    first = i;
+                    break;
+                }
+            }
+
+            if (first < 0)
+            {
+                for (i = 0; i < tw * th; i++)
+                {
+                    buf[i] = tft_comp_bcolor565;
+                }
+                first = 0;
+            }
+
+            for (i = first; i < (int) tft_comp_entries; i++)
+            {
+                const TFT_COMP_ENTRY * e = tft_comp_list + i;
+
+                if (e->x0 < tx0 + tw && e->x1 >= tx0 && e->y0 < ty0 + th && e->y1 >= ty0)
+                {
+                    tft_comp_render (e, buf, tx0, ty0, tw, th);
+                }
+            }
+
+            tft_set_area (tx0, tx0 + tw - 1, ty0, ty0 + th - 1);                        // waits for the other buffer
+            tft_dma_write (buf, tw * th);
+            b ^= 1;
+            sent++;
+        }
+    }
+
+    memset (tft_comp_dirty, 0, sizeof (tft_comp_dirty));
+    return sent;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_comp_start () - start compositor with an empty display list and background color, the screen is redrawn by the next flush
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+tft_comp_start (uint_fast16_t bcolor565)
+{
+    tft_comp_entries        = 0;
+    tft_comp_images_used    = 0;
+    tft_comp_bcolor565      = bcolor565;
+    tft_comp_overflow       = 0;
+    tft_comp_started        = 1;
+    tft_comp_mark (0, 0, TFT_WIDTH - 1, TFT_HEIGHT - 1);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_comp_stop () - flush and stop compositor, draw directly again
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+tft_comp_stop (void)
+{
+    if (tft_comp_started)
+    {
+        tft_comp_flush ();
+        tft_comp_started = 0;
+        tft_comp_entries = 0;
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_comp_entries_used () - number of entries in display list
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+int
+tft_comp_entries_used (void)
+{
+    return tft_comp_entries;
+}
+
+#else // no TFT, define stubs:
+
+uint_fast8_t
+tft_comp_active (void)
+{
+    return 0;
+}
+
+int
+tft_comp_flush (void)
+{
+    return 0;
+}
+
+void
+tft_comp_start (uint_fast16_t bcolor565)
+{
+    (void) bcolor565;
+}
+
+void
+tft_comp_stop (void)
+{
+}
+
+int
+tft_comp_entries_used (void)
+{
+    return 0;
+}
+
+#endif // ILI9341 || SSD1963
+
+#endif // STM32F407VE || unix
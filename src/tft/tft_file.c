@@ -0,0 +1,360 @@
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_file.c - draw BMP and RLE565 image files
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ * The image is streamed row by row from the file to the display, there is no buffer for the whole image: while the DMA
+ * sends one row, the next row is read and converted into the second row buffer. The buffers are allocated for the
+ * duration of the call only.
+ *
+ * Formats:
+ *
+ *   BMP      16 bit (RGB555 or RGB565 bitfields) or 24 bit, uncompressed, bottom-up or top-down
+ *   RLE565   "R565", width and height (uint16), then packets until all pixels are described:
+ *              uint16 n with bit 15 set:      run of (n & 0x7FFF) + 1 pixels, one uint16 pixel follows
+ *              uint16 n with bit 15 cleared:  (n & 0x7FFF) + 1 literal uint16 pixels follow
+ *            All values are little endian. A packet may continue in the next row. See png2rle.c.
+ *
+ * Parts of the image right of or below the display are clipped. With the compositor started, the image is drawn directly.
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ * MIT License
+ *
+ * Copyright (c) 2018-2021 Frank Meyer - frank(at)fli4l.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if defined STM32F407VE || defined unix                                         // TFT & SSD1963 only for STM32F407, unix: see tft_sim.c
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tft.h"
+
+#if defined ILI9341 || defined SSD1963
+
+#include "ff.h"
+
+#define TFT_FILE_BUFSIZE        512                                             // RLE input buffer, one sector
+
+#define TFT_FILE_LE16(p)        ((uint_fast16_t) ((p)[0] | ((p)[1] << 8)))
+#define TFT_FILE_LE32(p)        ((uint32_t) ((p)[0] | ((p)[1] << 8) | ((uint32_t) (p)[2] << 16) | ((uint32_t) (p)[3] << 24)))
+
+#define TFT_FILE_BMP16_555      1
+#define TFT_FILE_BMP16_565      2
+#define TFT_FILE_BMP24          3
+#define TFT_FILE_RLE565         4
+
+typedef struct
+{
+    FIL             fil;
+    uint_fast8_t    format;
+    int             width;
+    int             height;
+    uint_fast8_t    bottom_up;                                                  // BMP: first row in file is the bottom row
+    uint32_t        stride;                                                     // BMP: bytes per row in file
+    uint8_t *       raw;                                                        // BMP: row as read from file
+    uint8_t *       in;                                                         // RLE: input buffer
+    UINT            in_pos;
+    UINT            in_len;
+    uint_fast16_t   count;                                                      // RLE: pixels left in packet
+    uint_fast8_t    is_run;
+    uint_fast16_t   run_color;
+} TFT_FILE;
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: read header of BMP or RLE565 file, returns 0 on success
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+tft_file_header (TFT_FILE * tf)
+{
+    uint8_t         hdr[70];
+    UINT            n;
+    uint32_t        offset;
+    int32_t         h;
+    uint_fast16_t   bpp;
+    uint32_t        compression;
+
+    if (f_read (&tf->fil, hdr, sizeof (hdr), &n) != FR_OK || n < 8)
+    {
+        return -1;
+    }
+
+    if (! memcmp (hdr, "R565", 4))
+    {
+        tf->format  = TFT_FILE_RLE565;
+        tf->width   = TFT_FILE_LE16(hdr + 4);
+        tf->height  = TFT_FILE_LE16(hdr + 6);
+        tf->in_pos  = 0;
+        tf->in_len  = 0;
+        tf->count   = 0;
+        return (f_lseek (&tf->fil, 8) == FR_OK) ? 0 : -1;                      // RLE data follows header
+    }
+
+    if (n < 54 || hdr[0] != 'B' || hdr[1] != 'M')
+    {
+        return -1;
+    }
+
+    offset          = TFT_FILE_LE32(hdr + 10);
+    tf->width       = (int32_t) TFT_FILE_LE32(hdr + 18);
+    h               = (int32_t) TFT_FILE_LE32(hdr + 22);
+    bpp             = TFT_FILE_LE16(hdr + 28);
+    compression     = TFT_FILE_LE32(hdr + 30);
+    tf->bottom_up   = (h > 0);
+    tf->height      = (h > 0) ? h : -h;
+
+    if (bpp == 24 && compression == 0)                                          // BI_RGB
+    {
+        tf->format = TFT_FILE_BMP24;
+    }
+    else if (bpp == 16 && compression == 0)
+    {
+        tf->format = TFT_FILE_BMP16_555;
+    }
+    else if (bpp == 16 && compression == 3 && n >= 58)                          // BI_BITFIELDS, red mask follows header of 40 bytes
+    {
+        tf->format = (TFT_FILE_LE32(hdr + 54) == 0xF800) ? TFT_FILE_BMP16_565 : TFT_FILE_BMP16_555;
+    }
+    else
+    {
+        return -1;
+    }
+
+    tf->stride = ((tf->width * bpp + 31) / 32) * 4;
+
+    if (tf->width <= 0 || f_lseek (&tf->fil, offset) != FR_OK)
+    {
+        return -1;
+    }
+    return 0;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: get next uint16 of RLE stream, returns -1 at end of file
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int32_t
+tft_file_rle_get16 (TFT_FILE * tf)
+{
+    uint8_t     b[2];
+    int         i;
+
+    for (i = 0; i < 2; i++)
+    {
+        if (tf->in_pos >= tf->in_len)
+        {
+            if (f_read (&tf->fil, tf->in, TFT_FILE_BUFSIZE, &tf->in_len) != FR_OK || tf->in_len == 0)
+            {
+                return -1;
+            }
+            tf->in_pos = 0;
+        }
+        b[i] = tf->in[tf->in_pos++];
+    }
+    return TFT_FILE_LE16(b);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: read next row of file, store the first l pixels, returns 0 on success
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+tft_file_row (TFT_FILE * tf, uint16_t * row, int l)
+{
+    const uint8_t * p;
+    int32_t         v;
+    UINT            n;
+    int             x;
+
+    if (tf->format == TFT_FILE_RLE565)
+    {
+        for (x = 0; x < tf->width; x++)
+        {
+            if (tf->count == 0)
+            {
+                if ((v = tft_file_rle_get16 (tf)) < 0)
+                {
+                    return -1;
+                }
+
+                tf->count   = (v & 0x7FFF) + 1;
+                tf->is_run  = (v & 0x8000) ? 1 : 0;
+
+                if (tf->is_run)
+                {
+                    if ((v = tft_file_rle_get16 (tf)) < 0)
+                    {
+                        return -1;
+                    }
+                    tf->run_color = v;
+                }
+            }
+
+            if (tf->is_run)
+            {
+                v = tf->run_color;
+            }
+            else if ((v = tft_file_rle_get16 (tf)) < 0)
+            {
+                return -1;
+            }
+
+            tf->count--;
+
+            if (x < l)
+            {
+                row[x] = v;
+            }
+        }
+        return 0;
+    }
+
+    if (f_read (&tf->fil, tf->raw, tf->stride, &n) != FR_OK || n != tf->stride)
+    {
+        return -1;
+    }
+
+    p = tf->raw;
+
+    switch (tf->format)
+    {
+        case TFT_FILE_BMP24:                                                    // B G R
+            for (x = 0; x < l; x++, p += 3)
+            {
+                row[x] = ((p[2] & 0xF8) << 8) | ((p[1] & 0xFC) << 3) | (p[0] >> 3);
+            }
+            break;
+        case TFT_FILE_BMP16_565:
+            for (x = 0; x < l; x++, p += 2)
+            {
+                row[x] = TFT_FILE_LE16(p);
+            }
+            break;
+        default:                                                                // X1R5G5B5
+            for (x = 0; x < l; x++, p += 2)
+            {
+                v = TFT_FILE_LE16(p);
+                row[x] = ((v & 0x7FE0) << 1) | ((v & 0x0200) >> 4) | (v & 0x001F);
+            }
+            break;
+    }
+    return 0;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_draw_file () - draw BMP or RLE565 image file at x, y, returns 0 on success, -1 on error
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+int
+tft_draw_file (const char * fname, uint_fast16_t x, uint_fast16_t y)
+{
+    TFT_FILE *      tf;
+    uint16_t *      rows[2];
+    uint_fast8_t    cur = 0;
+    int             l;                                                          // visible width
+    int             i;
+    int             yy;
+    int             rtc = -1;
+
+    if (x >= TFT_WIDTH || y >= TFT_HEIGHT || ! (tf = calloc (1, sizeof (TFT_FILE))))
+    {
+        return -1;
+    }
+
+    if (f_open (&tf->fil, fname, FA_READ) != FR_OK)
+    {
+        free (tf);
+        return -1;
+    }
+
+    if (tft_file_header (tf) == 0)
+    {
+        l       = ((int) x + tf->width > TFT_WIDTH) ? (int) (TFT_WIDTH - x) : tf->width;
+        rows[0] = malloc (2 * l * sizeof (uint16_t));                           // both row buffers, DMA reachable
+        rows[1] = rows[0] + l;
+
+        if (tf->format == TFT_FILE_RLE565)
+        {
+            tf->raw = (uint8_t *) 0;
+            tf->in  = malloc (TFT_FILE_BUFSIZE);
+        }
+        else
+        {
+            tf->raw = malloc (tf->stride);
+            tf->in  = (uint8_t *) 0;
+        }
+
+        if (rows[0] && (tf->raw || tf->in))
+        {
+            rtc = 0;
+
+            for (i = 0; i < tf->height; i++)
+            {
+                yy = y + (tf->bottom_up ? tf->height - 1 - i : i);
+
+                if (yy >= TFT_HEIGHT)
+                {
+                    if (tf->bottom_up && tf->format != TFT_FILE_RLE565)         // skip rows below the display
+                    {
+                        if (f_lseek (&tf->fil, f_tell (&tf->fil) + tf->stride) != FR_OK)
+                        {
+                            rtc = -1;
+                            break;
+                        }
+                        continue;
+                    }
+                    break;                                                      // top-down: rest is below the display
+                }
+
+                if (tft_file_row (tf, rows[cur], l) != 0)                       // DMA of previous row is still running
+                {
+                    rtc = -1;
+                    break;
+                }
+
+                tft_set_area (x, x + l - 1, yy, yy);                            // waits for previous row
+                tft_dma_write (rows[cur], l);
+                cur ^= 1;
+            }
+
+            tft_dma_wait ();                                                    // before the row buffers are freed
+        }
+
+        free (tf->in);
+        free (tf->raw);
+        free (rows[0]);
+    }
+
+    f_close (&tf->fil);
+    free (tf);
+    return rtc;
+}
+
+#else // no TFT, define stubs:
+
+int
+tft_draw_file (const char * fname, uint_fast16_t x, uint_fast16_t y)
+{
+    (void) fname, (void) x, (void) y;
+    return -1;
+}
+
+#endif // ILI9341 || SSD1963
+
+#endif // STM32F407VE || unix
@@ -0,0 +1,358 @@
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_sim.c - simulated SSD1963/ILI9341 for host builds (unix only)
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ * On unix, ssd1963_write_command(), ssd1963_write_data() and ssd1963_read_data() (ili9341_... resp.) end here instead of on the
+ * FSMC bus. The simulator interprets the DCS commands both controllers share:
+ *
+ *   0x2A/0x2B      column/page address (window)
+ *   0x2C/0x3C      write memory start/continue: following data words are pixels, the address wraps inside the window
+ *   0x2E/0x3E      read memory start/continue
+ *   0x33/0x37      vertical scroll area/start, applied by tft_sim_get_pixel() and tft_sim_write_ppm()
+ *   0x36           address mode: only row/column exchange is evaluated, mirroring is ignored
+ *
+ * All other commands and their parameters are only counted. The display memory has the size of the panel, for the ILI9341
+ * tft.c uses the portrait panel in landscape mode: x is the page, y the column address.
+ *
+ * The counters in tft_sim are never reset by the simulator, see tft_sim_reset_counters(). bus_nsec assumes that every
+ * command and data word costs one FSMC write cycle, see TFT_SIM_WRITE_NSEC.
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ * MIT License
+ *
+ * Copyright (c) 2018-2021 Frank Meyer - frank(at)fli4l.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#ifdef unix
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "tft.h"
+
+#if defined ILI9341 || defined SSD1963
+
+#define TFT_SIM_SET_COLUMN_ADDRESS      0x2A
+#define TFT_SIM_SET_PAGE_ADDRESS        0x2B
+#define TFT_SIM_WRITE_MEMORY_START      0x2C
+#define TFT_SIM_READ_MEMORY_START       0x2E
+#define TFT_SIM_SET_SCROLL_AREA         0x33
+#define TFT_SIM_SET_ADDRESS_MODE        0x36
+#define TFT_SIM_SET_SCROLL_START        0x37
+#define TFT_SIM_WRITE_MEMORY_CONTINUE   0x3C
+#define TFT_SIM_READ_MEMORY_CONTINUE    0x3E
+
+#define TFT_SIM_ADDRESS_MODE_EXCHANGE   0x20                                    // row/column exchange
+
+#if defined (SSD1963)
+#define TFT_SIM_COLUMNS                 TFT_WIDTH
+#define TFT_SIM_PAGES                   TFT_HEIGHT
+#define TFT_SIM_MEM(x,y)                tft_sim_mem[(y)][(x)]
+#else // ILI9341: landscape mode, see tft_set_area()
+#define TFT_SIM_COLUMNS                 TFT_HEIGHT
+#define TFT_SIM_PAGES                   TFT_WIDTH
+#define TFT_SIM_MEM(x,y)                tft_sim_mem[(x)][(y)]
+#endif
+
+#define TFT_SIM_MEM_NONE                0
+#define TFT_SIM_MEM_WRITE               1
+#define TFT_SIM_MEM_READ                2
+
+TFT_SIM                                 tft_sim;
+
+static uint16_t                         tft_sim_mem[TFT_SIM_PAGES][TFT_SIM_COLUMNS];
+static uint_fast16_t                    tft_sim_cmd;
+static uint8_t                          tft_sim_param[6];
+static uint_fast8_t                     tft_sim_nparams;
+static uint_fast8_t                     tft_sim_mem_access;
+static uint_fast8_t                     tft_sim_address_mode;
+
+static uint_fast16_t                    tft_sim_sc;                             // window
+static uint_fast16_t                    tft_sim_ec      = TFT_SIM_COLUMNS - 1;
+static uint_fast16_t                    tft_sim_sp;
+static uint_fast16_t                    tft_sim_ep      = TFT_SIM_PAGES - 1;
+static uint_fast16_t                    tft_sim_column;                         // current address
+static uint_fast16_t                    tft_sim_page;
+
+static uint_fast16_t                    tft_sim_tfa;                            // scroll area
+static uint_fast16_t                    tft_sim_vsa     = TFT_SIM_PAGES;
+static uint_fast16_t                    tft_sim_vsp;
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: get pointer to memory cell at current address, NULL if outside of display memory
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint16_t *
+tft_sim_cell (void)
+{
+    uint_fast16_t   column  = tft_sim_column;
+    uint_fast16_t   page    = tft_sim_page;
+
+    if (tft_sim_address_mode & TFT_SIM_ADDRESS_MODE_EXCHANGE)
+    {
+        column  = tft_sim_page;
+        page    = tft_sim_column;
+    }
+
+    if (column >= TFT_SIM_COLUMNS || page >= TFT_SIM_PAGES)
+    {
+        return (uint16_t *) 0;
+    }
+    return &tft_sim_mem[page][column];
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: advance address inside window
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_sim_next (void)
+{
+    if (tft_sim_column < tft_sim_ec)
+    {
+        tft_sim_column++;
+    }
+    else
+    {
+        tft_sim_column = tft_sim_sc;
+
+        if (tft_sim_page < tft_sim_ep)
+        {
+            tft_sim_page++;
+        }
+        else
+        {
+            tft_sim_page = tft_sim_sp;
+        }
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: set window, count real changes
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_sim_set_window (uint_fast16_t * startp, uint_fast16_t * endp)
+{
+    uint_fast16_t   start   = (tft_sim_param[0] << 8) | tft_sim_param[1];
+    uint_fast16_t   end     = (tft_sim_param[2] << 8) | tft_sim_param[3];
+
+    if (start != *startp || end != *endp)
+    {
+        *startp = start;
+        *endp   = end;
+        tft_sim.windows++;
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_sim_write_command () - write command to simulated controller
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+tft_sim_write_command (uint_fast16_t cmd)
+{
+    tft_sim.commands++;
+    tft_sim.bus_nsec   += TFT_SIM_WRITE_NSEC;
+    tft_sim_cmd         = cmd;
+    tft_sim_nparams     = 0;
+
+    switch (cmd)
+    {
+        case TFT_SIM_WRITE_MEMORY_START:
+        case TFT_SIM_READ_MEMORY_START:
+            tft_sim_column  = tft_sim_sc;
+            tft_sim_page    = tft_sim_sp;
+            tft_sim_mem_access = (cmd == TFT_SIM_WRITE_MEMORY_START) ? TFT_SIM_MEM_WRITE : TFT_SIM_MEM_READ;
+            break;
+        case TFT_SIM_WRITE_MEMORY_CONTINUE:
+            tft_sim_mem_access = TFT_SIM_MEM_WRITE;
+            break;
+        case TFT_SIM_READ_MEMORY_CONTINUE:
+            tft_sim_mem_access = TFT_SIM_MEM_READ;
+            break;
+        default:
+            tft_sim_mem_access = TFT_SIM_MEM_NONE;
+            break;
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_sim_write_data () - write parameter or pixel to simulated controller
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+tft_sim_write_data (uint_fast16_t value)
+{
+    uint16_t *  cell;
+
+    tft_sim.data_words++;
+    tft_sim.bus_nsec += TFT_SIM_WRITE_NSEC;
+
+    if (tft_sim_mem_access == TFT_SIM_MEM_WRITE)
+    {
+        tft_sim.pixels++;
+
+        if ((cell = tft_sim_cell ()) != (uint16_t *) 0)
+        {
+            *cell = value;
+        }
+        else
+        {
+            tft_sim.clipped++;
+        }
+        tft_sim_next ();
+        return;
+    }
+
+    if (tft_sim_nparams >= sizeof (tft_sim_param))
+    {
+        return;
+    }
+
+    tft_sim_param[tft_sim_nparams++] = value & 0xFF;
+
+    switch (tft_sim_cmd)
+    {
+        case TFT_SIM_SET_COLUMN_ADDRESS:
+            if (tft_sim_nparams == 4)
+            {
+                tft_sim_set_window (&tft_sim_sc, &tft_sim_ec);
+            }
+            break;
+        case TFT_SIM_SET_PAGE_ADDRESS:
+            if (tft_sim_nparams == 4)
+            {
+                tft_sim_set_window (&tft_sim_sp, &tft_sim_ep);
+            }
+            break;
+        case TFT_SIM_SET_ADDRESS_MODE:
+            tft_sim_address_mode = tft_sim_param[0];
+            break;
+        case TFT_SIM_SET_SCROLL_AREA:
+            if (tft_sim_nparams == 6)
+            {
+                tft_sim_tfa = (tft_sim_param[0] << 8) | tft_sim_param[1];
+                tft_sim_vsa = (tft_sim_param[2] << 8) | tft_sim_param[3];
+            }
+            break;
+        case TFT_SIM_SET_SCROLL_START:
+            if (tft_sim_nparams == 2)
+            {
+                tft_sim_vsp = (tft_sim_param[0] << 8) | tft_sim_param[1];
+            }
+            break;
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_sim_read_data () - read data word from simulated controller, only memory reads return data
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast16_t
+tft_sim_read_data (void)
+{
+    uint16_t *      cell;
+    uint_fast16_t   value = 0;
+
+    tft_sim.reads++;
+    tft_sim.bus_nsec += TFT_SIM_WRITE_NSEC;
+
+    if (tft_sim_mem_access == TFT_SIM_MEM_READ)
+    {
+        if ((cell = tft_sim_cell ()) != (uint16_t *) 0)
+        {
+            value = *cell;
+        }
+        tft_sim_next ();
+    }
+    return value;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_sim_reset_counters () - reset all counters
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+tft_sim_reset_counters (void)
+{
+    memset (&tft_sim, 0, sizeof (tft_sim));
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_sim_get_pixel () - get pixel as displayed, i.e. with vertical scrolling applied
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast16_t
+tft_sim_get_pixel (uint_fast16_t x, uint_fast16_t y)
+{
+#if defined (SSD1963)
+    uint_fast16_t * linep = &y;
+#else
+    uint_fast16_t * linep = &x;
+#endif
+
+    if (x >= TFT_WIDTH || y >= TFT_HEIGHT)
+    {
+        return 0;
+    }
+
+    if (tft_sim_vsa > 0 && *linep >= tft_sim_tfa && *linep < tft_sim_tfa + tft_sim_vsa && tft_sim_vsp >= tft_sim_tfa)
+    {
+        *linep = tft_sim_tfa + (*linep - tft_sim_tfa + tft_sim_vsp - tft_sim_tfa) % tft_sim_vsa;
+    }
+    return TFT_SIM_MEM(x, y);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_sim_write_ppm () - dump display as binary PPM, returns 0 on success, -1 on error
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+int
+tft_sim_write_ppm (const char * fname)
+{
+    FILE *          fp;
+    uint_fast16_t   x;
+    uint_fast16_t   y;
+    uint_fast16_t   c;
+
+    if (! (fp = fopen (fname, "wb")))
+    {
+        return -1;
+    }
+
+    fprintf (fp, "P6\n%d %d\n255\n", TFT_WIDTH, TFT_HEIGHT);
+
+    for (y = 0; y < TFT_HEIGHT; y++)
+    {
+        for (x = 0; x < TFT_WIDTH; x++)
+        {
+            c = tft_sim_get_pixel (x, y);
+            putc (((c >> 8) & 0xF8) | (c >> 13), fp);                          // 5/6/5 bits to 8 bits
+            putc (((c >> 3) & 0xFC) | ((c >> 9) & 0x03), fp);
+            putc (((c << 3) & 0xF8) | ((c >> 2) & 0x07), fp);
+        }
+    }
+
+    return (fclose (fp) == 0) ? 0 : -1;
+}
+
+#endif // ILI9341 || SSD1963
+
+#endif // unix
@@ -0,0 +1,1045 @@
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_term.c - text terminal on TFT, renders the console output stream (VT100 subset as used by mcurses)
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ * The screen is a grid of character cells. A shadow buffer holds character and attribute of each cell, a cell is only
+ * redrawn if its content changes. Erasing is done by one filled rectangle per run of changed cells.
+ *
+ * On the SSD1963 scrolling the whole screen does not copy anything: the cell rows are used as a ring in the frame memory
+ * and the display start line is moved by ssd1963_set_scroll_start(). The shadow buffer is indexed by frame memory row,
+ * so only the new blank line has to be drawn. Scrolling a part of the screen (scrolling region, insert/delete line)
+ * and scrolling on the ILI9341 copies the rows in the shadow buffer and redraws the changed cells.
+ *
+ * Supported: CR, LF, BS, TAB, SO/SI (DEC graphics are mapped to ISO 8859-1), ESC E/D/M/7/8/c, ESC ( and ESC ),
+ * CSI A/B/C/D/H/f/J/K/L/M/P/@/X/m/r, CSI 4h/4l (insert mode), CSI ?25h/?25l (cursor). Other sequences are ignored.
+ * SGR: bold (bright foreground), reverse, 8 foreground and background colors. Underline, blink and dim are ignored.
+ *
+ * While the terminal is active, other drawing on the TFT uses frame memory coordinates, which are shifted by the
+ * hardware scroll offset.
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ * MIT License
+ *
+ * Copyright (c) 2018-2021 Frank Meyer - frank(at)fli4l.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#if defined STM32F407VE || defined unix                                         // TFT & SSD1963 only for STM32F407, unix: see tft_sim.c
+
+#include <stdint.h>
+#include "tft.h"
+
+#if defined ILI9341 || defined SSD1963
+
+#include "font.h"
+
+#define TFT_TERM_MAX_COLS       100
+#define TFT_TERM_MAX_ROWS       60
+#define TFT_TERM_MAX_PARAMS     8
+#define TFT_TERM_TABSIZE        8
+#define TFT_TERM_CURSOR_HEIGHT  2                                               // cursor is a bar at the bottom of the cell
+
+#define TFT_TERM_WANTED_COLS    80                                              // font selection if no font given
+#define TFT_TERM_WANTED_ROWS    24
+
+#define TFT_TERM_ATTR_FCOLOR    0x0F                                            // bits 0-3: foreground color
+#define TFT_TERM_ATTR_BOLD      0x08                                            // bold = bright foreground color
+#define TFT_TERM_ATTR_BCOLOR    0x70                                            // bits 4-6: background color
+#define TFT_TERM_ATTR_REVERSE   0x80
+#define TFT_TERM_ATTR_DEFAULT   0x07                                            // light gray on black
+
+#define TFT_TERM_CELL(ch,attr)  ((uint16_t) (((attr) << 8) | (ch)))
+
+#define TFT_TERM_STATE_NORMAL   0
+#define TFT_TERM_STATE_ESC      1
+#define TFT_TERM_STATE_CSI      2
+#define TFT_TERM_STATE_CHARSET  3                                               // ESC ( or ESC ): designator follows
+
+static uint16_t                 tft_term_cells[TFT_TERM_MAX_ROWS * TFT_TERM_MAX_COLS];  // shadow buffer, indexed by frame memory row
+
+static const uint16_t           tft_term_palette[16] =
+{
+    0x0000, 0xA800, 0x0540, 0xAD40, 0x0015, 0xA815, 0x0555, 0xAD55,             // black red green yellow blue magenta cyan white
+    0x52AA, 0xFAAA, 0x57EA, 0xFFEA, 0x52BF, 0xFABF, 0x57FF, 0xFFFF              // same, bright
+};
+
+static const unsigned char      tft_term_graphics[32] =                         // DEC special graphics 0x5F - 0x7E
+{
+    ' ', '*', ':', ' ', ' ', ' ', ' ', 0xB0, 0xB1, '#', '#', '+', '+', '+', '+', '+',
+    '-', '-', '-', '-', '-', '+', '+', '+', '+', '|', '<', '>', '*', '#', 0xA3, 0xB7
+};
+
+static uint_fast8_t             tft_term_started;
+static int                      tft_term_font;
+static int                      tft_term_fwidth;
+static int                      tft_term_fheight;
+static int                      tft_term_cols;
+static int                      tft_term_rows;
+static int                      tft_term_top;                                   // frame memory row of screen row 0
+
+static int                      tft_term_y;                                     // cursor position
+static int                      tft_term_x;
+static uint_fast8_t             tft_term_wrap_pending;                          // last column written, wrap before next char
+static uint_fast8_t             tft_term_attr;
+static int                      tft_term_saved_y;
+static int                      tft_term_saved_x;
+static uint_fast8_t             tft_term_saved_attr;
+static int                      tft_term_scroll_top;                            // scrolling region
+static int                      tft_term_scroll_bottom;
+static uint_fast8_t             tft_term_insert_mode;
+static uint_fast8_t             tft_term_cursor_visible;
+
+static uint_fast8_t             tft_term_g0_graphics;                           // charsets
+static uint_fast8_t             tft_term_g1_graphics;
+static uint_fast8_t             tft_term_shift_out;
+static uint_fast8_t             tft_term_designate;                             // '(' or ')'
+
+static uint_fast8_t             tft_term_state;
+static int                      tft_term_params[TFT_TERM_MAX_PARAMS];
+static int                      tft_term_n_params;
+static uint_fast8_t             tft_term_private;                               // CSI ? ...
+
+static uint_fast8_t             tft_term_cursor_drawn;
+static int                      tft_term_cursor_prow;                           // frame memory row of drawn cursor
+static int                      tft_term_cursor_col;
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: frame memory row of a screen row
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+tft_term_prow (int row)
+{
+    row += tft_term_top;
+
+    if (row >= tft_term_rows)
+    {
+        row -= tft_term_rows;
+    }
+    return row;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: colors of a cell attribute
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_term_colors (uint_fast8_t attr, uint_fast16_t * fcolorp, uint_fast16_t * bcolorp)
+{
+    uint_fast16_t   fcolor565 = tft_term_palette[attr & TFT_TERM_ATTR_FCOLOR];
+    uint_fast16_t   bcolor565 = tft_term_palette[(attr & TFT_TERM_ATTR_BCOLOR) >> 4];
+
+    if (attr & TFT_TERM_ATTR_REVERSE)
+    {
+        *fcolorp = bcolor565;
+        *bcolorp = fcolor565;
+    }
+    else
+    {
+        *fcolorp = fcolor565;
+        *bcolorp = bcolor565;
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: draw cell from shadow buffer
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_term_draw_cell (int prow, int col)
+{
+    uint_fast16_t   cell = tft_term_cells[prow * TFT_TERM_MAX_COLS + col];
+    uint_fast16_t   fcolor565;
+    uint_fast16_t   bcolor565;
+
+    tft_term_colors (cell >> 8, &fcolor565, &bcolor565);
+    draw_letter (cell & 0xFF, prow * tft_term_fheight, col * tft_term_fwidth, fcolor565, bcolor565);
+
+    if (tft_term_cursor_drawn && prow == tft_term_cursor_prow && col == tft_term_cursor_col)
+    {
+        tft_term_cursor_drawn = 0;
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: set cell, draw it if changed
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_term_set (int row, int col, uint_fast16_t cell)
+{
+    int         prow    = tft_term_prow (row);
+    uint16_t *  p       = tft_term_cells + prow * TFT_TERM_MAX_COLS + col;
+
+    if (*p != cell)
+    {
+        *p = cell;
+        tft_term_draw_cell (prow, col);
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: get cell
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast16_t
+tft_term_get (int row, int col)
+{
+    return tft_term_cells[tft_term_prow (row) * TFT_TERM_MAX_COLS + col];
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: erase cells col0 - col1 of a row with the current background color, one rectangle per run of changed cells
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_term_erase (int row, int col0, int col1)
+{
+    uint_fast8_t    attr    = (tft_term_attr & TFT_TERM_ATTR_BCOLOR) | TFT_TERM_ATTR_DEFAULT;
+    uint_fast16_t   blank   = TFT_TERM_CELL(' ', attr);
+    int             prow    = tft_term_prow (row);
+    uint16_t *      p       = tft_term_cells + prow * TFT_TERM_MAX_COLS;
+    int             y0      = prow * tft_term_fheight;
+    int             col     = col0;
+    int             start;
+
+    while (col <= col1)
+    {
+        if (p[col] == blank)
+        {
+            col++;
+            continue;
+        }
+
+        start = col;
+
+        while (col <= col1 && p[col] != blank)
+        {
+            p[col] = blank;
+            col++;
+        }
+
+        tft_fill_rectangle (start * tft_term_fwidth, y0, col * tft_term_fwidth - 1, y0 + tft_term_fheight - 1,
+                            tft_term_palette[(attr & TFT_TERM_ATTR_BCOLOR) >> 4]);
+
+        if (tft_term_cursor_drawn && prow == tft_term_cursor_prow && tft_term_cursor_col >= start && tft_term_cursor_col < col)
+        {
+            tft_term_cursor_drawn = 0;
+        }
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: copy row src to row dst, redraw changed cells only
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_term_copy_row (int dst, int src)
+{
+    int col;
+
+    for (col = 0; col < tft_term_cols; col++)
+    {
+        tft_term_set (dst, col, tft_term_get (src, col));
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: scroll rows top - bottom up by n rows
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_term_scroll_up (int top, int bottom, int n)
+{
+    int row;
+
+    if (n > bottom - top + 1)
+    {
+        n = bottom - top + 1;
+    }
+
+#if defined (SSD1963)
+    if (top == 0 && bottom == tft_term_rows - 1)
+    {
+        tft_term_top = tft_term_prow (n);
+        ssd1963_set_scroll_start (tft_term_top * tft_term_fheight);
+
+        for (row = bottom - n + 1; row <= bottom; row++)
+        {
+            tft_term_erase (row, 0, tft_term_cols - 1);
+        }
+        return;
+    }
+#endif
+
+    for (row = top; row <= bottom - n; row++)
+    {
+        tft_term_copy_row (row, row + n);
+    }
+
+    for ( ; row <= bottom; row++)
+    {
+        tft_term_erase (row, 0, tft_term_cols - 1);
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: scroll rows top - bottom down by n rows
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_term_scroll_down (int top, int bottom, int n)
+{
+    int row;
+
+    if (n > bottom - top + 1)
+    {
+        n = bottom - top + 1;
+    }
+
+#if defined (SSD1963)
+    if (top == 0 && bottom == tft_term_rows - 1)
+    {
+        tft_term_top = tft_term_prow (tft_term_rows - n);
+        ssd1963_set_scroll_start (tft_term_top * tft_term_fheight);
+
+        for (row = 0; row < n; row++)
+        {
+            tft_term_erase (row, 0, tft_term_cols - 1);
+        }
+        return;
+    }
+#endif
+
+    for (row = bottom; row >= top + n; row--)
+    {
+        tft_term_copy_row (row, row - n);
+    }
+
+    for ( ; row >= top; row--)
+    {
+        tft_term_erase (row, 0, tft_term_cols - 1);
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: line feed, scroll at end of scrolling region
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_term_linefeed (void)
+{
+    if (tft_term_y == tft_term_scroll_bottom)
+    {
+        tft_term_scroll_up (tft_term_scroll_top, tft_term_scroll_bottom, 1);
+    }
+    else if (tft_term_y < tft_term_rows - 1)
+    {
+        tft_term_y++;
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: reverse line feed, scroll down at start of scrolling region
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_term_reverse_linefeed (void)
+{
+    if (tft_term_y == tft_term_scroll_top)
+    {
+        tft_term_scroll_down (tft_term_scroll_top, tft_term_scroll_bottom, 1);
+    }
+    else if (tft_term_y > 0)
+    {
+        tft_term_y--;
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: insert n blank cells at cursor position
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_term_insert_chars (int n)
+{
+    int col;
+
+    if (n > tft_term_cols - tft_term_x)
+    {
+        n = tft_term_cols - tft_term_x;
+    }
+
+    for (col = tft_term_cols - 1; col >= tft_term_x + n; col--)
+    {
+        tft_term_set (tft_term_y, col, tft_term_get (tft_term_y, col - n));
+    }
+
+    tft_term_erase (tft_term_y, tft_term_x, tft_term_x + n - 1);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: delete n cells at cursor position
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_term_delete_chars (int n)
+{
+    int col;
+
+    if (n > tft_term_cols - tft_term_x)
+    {
+        n = tft_term_cols - tft_term_x;
+    }
+
+    for (col = tft_term_x; col < tft_term_cols - n; col++)
+    {
+        tft_term_set (tft_term_y, col, tft_term_get (tft_term_y, col + n));
+    }
+
+    tft_term_erase (tft_term_y, tft_term_cols - n, tft_term_cols - 1);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: move cursor, clip to screen
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_term_move (int y, int x)
+{
+    if (y < 0)
+    {
+        y = 0;
+    }
+    else if (y >= tft_term_rows)
+    {
+        y = tft_term_rows - 1;
+    }
+
+    if (x < 0)
+    {
+        x = 0;
+    }
+    else if (x >= tft_term_cols)
+    {
+        x = tft_term_cols - 1;
+    }
+
+    tft_term_y              = y;
+    tft_term_x              = x;
+    tft_term_wrap_pending   = 0;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: print a character at cursor position
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_term_print (uint_fast8_t ch)
+{
+    if (ch >= 0x5F && ch <= 0x7E && (tft_term_shift_out ? tft_term_g1_graphics : tft_term_g0_graphics))
+    {
+        ch = tft_term_graphics[ch - 0x5F];
+    }
+
+    if (tft_term_wrap_pending)
+    {
+        tft_term_wrap_pending = 0;
+        tft_term_x = 0;
+        tft_term_linefeed ();
+    }
+
+    if (tft_term_insert_mode)
+    {
+        tft_term_insert_chars (1);
+    }
+
+    tft_term_set (tft_term_y, tft_term_x, TFT_TERM_CELL(ch, tft_term_attr));
+
+    if (tft_term_x < tft_term_cols - 1)
+    {
+        tft_term_x++;
+    }
+    else
+    {
+        tft_term_wrap_pending = 1;
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: get CSI parameter, 0 or missing: default value
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+tft_term_param (int idx, int def)
+{
+    if (idx < tft_term_n_params && tft_term_params[idx] > 0)
+    {
+        return tft_term_params[idx];
+    }
+    return def;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: select graphic rendition
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_term_sgr (void)
+{
+    int idx;
+    int p;
+
+    for (idx = 0; idx < tft_term_n_params; idx++)
+    {
+        p = tft_term_params[idx];
+
+        if (p == 0)
+        {
+            tft_term_attr = TFT_TERM_ATTR_DEFAULT;
+        }
+        else if (p == 1)
+        {
+            tft_term_attr |= TFT_TERM_ATTR_BOLD;
+        }
+        else if (p == 2 || p == 22)
+        {
+            tft_term_attr &= ~TFT_TERM_ATTR_BOLD;
+        }
+        else if (p == 7)
+        {
+            tft_term_attr |= TFT_TERM_ATTR_REVERSE;
+        }
+        else if (p == 27)
+        {
+            tft_term_attr &= ~TFT_TERM_ATTR_REVERSE;
+        }
+        else if (p >= 30 && p <= 37)
+        {
+            tft_term_attr = (tft_term_attr & ~0x07) | (p - 30);
+        }
+        else if (p == 39)
+        {
+            tft_term_attr = (tft_term_attr & ~0x07) | (TFT_TERM_ATTR_DEFAULT & 0x07);
+        }
+        else if (p >= 40 && p <= 47)
+        {
+            tft_term_attr = (tft_term_attr & ~TFT_TERM_ATTR_BCOLOR) | ((p - 40) << 4);
+        }
+        else if (p == 49)
+        {
+            tft_term_attr = (tft_term_attr & ~TFT_TERM_ATTR_BCOLOR) | (TFT_TERM_ATTR_DEFAULT & TFT_TERM_ATTR_BCOLOR);
+        }
+    }                                                                           // 4 (underline), 5 (blink): ignored
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: execute CSI sequence
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_term_csi (uint_fast8_t ch)
+{
+    int     n = tft_term_param (0, 1);
+    int     row;
+
+    if (tft_term_private)
+    {
+        if (tft_term_param (0, 0) == 25 && (ch == 'h' || ch == 'l'))
+        {
+            tft_term_cursor_visible = (ch == 'h');
+        }
+        return;
+    }
+
+    switch (ch)
+    {
+        case 'A':                                                               // cursor up
+            tft_term_move (tft_term_y - n, tft_term_x);
+            break;
+        case 'B':                                                               // cursor down
+            tft_term_move (tft_term_y + n, tft_term_x);
+            break;
+        case 'C':                                                               // cursor right
+            tft_term_move (tft_term_y, tft_term_x + n);
+            break;
+        case 'D':                                                               // cursor left
+            tft_term_move (tft_term_y, tft_term_x - n);
+            break;
+        case 'H':                                                               // cursor position
+        case 'f':
+            tft_term_move (tft_term_param (0, 1) - 1, tft_term_param (1, 1) - 1);
+            break;
+        case 'J':                                                               // erase in display
+            switch (tft_term_param (0, 0))
+            {
+                case 0:
+                    tft_term_erase (tft_term_y, tft_term_x, tft_term_cols - 1);
+
+                    for (row = tft_term_y + 1; row < tft_term_rows; row++)
+                    {
+                        tft_term_erase (row, 0, tft_term_cols - 1);
+                    }
+                    break;
+                case 1:
+                    for (row = 0; row < tft_term_y; row++)
+                    {
+                        tft_term_erase (row, 0, tft_term_cols - 1);
+                    }
+
+                    tft_term_erase (tft_term_y, 0, tft_term_x);
+                    break;
+                default:
+                    for (row = 0; row < tft_term_rows; row++)
+                    {
+                        tft_term_erase (row, 0, tft_term_cols - 1);
+                    }
+                    break;
+            }
+            break;
+        case 'K':                                                               // erase in line
+            switch (tft_term_param (0, 0))
+            {
+                case 0:
+                    tft_term_erase (tft_term_y, tft_term_x, tft_term_cols - 1);
+                    break;
+                case 1:
+                    tft_term_erase (tft_term_y, 0, tft_term_x);
+                    break;
+                default:
+                    tft_term_erase (tft_term_y, 0, tft_term_cols - 1);
+                    break;
+            }
+            break;
+        case 'L':                                                               // insert lines
+            if (tft_term_y >= tft_term_scroll_top && tft_term_y <= tft_term_scroll_bottom)
+            {
+                tft_term_scroll_down (tft_term_y, tft_term_scroll_bottom, n);
+            }
+            break;
+        case 'M':                                                               // delete lines
+            if (tft_term_y >= tft_term_scroll_top && tft_term_y <= tft_term_scroll_bottom)
+            {
+                tft_term_scroll_up (tft_term_y, tft_term_scroll_bottom, n);
+            }
+            break;
+        case 'P':                                                               // delete characters
+            tft_term_delete_chars (n);
+            break;
+        case '@':                                                               // insert characters
+            tft_term_insert_chars (n);
+            break;
+        case 'X':                                                               // erase characters
+            tft_term_erase (tft_term_y, tft_term_x, (tft_term_x + n <= tft_term_cols) ? tft_term_x + n - 1 : tft_term_cols - 1);
+            break;
+        case 'm':                                                               // select graphic rendition
+            tft_term_sgr ();
+            break;
+        case 'r':                                                               // set scrolling region
+        {
+            int top     = tft_term_param (0, 1) - 1;
+            int bottom  = tft_term_param (1, tft_term_rows) - 1;
+
+            if (bottom >= tft_term_rows)
+            {
+                bottom = tft_term_rows - 1;
+            }
+
+            if (top < bottom)
+            {
+                tft_term_scroll_top     = top;
+                tft_term_scroll_bottom  = bottom;
+            }
+
+            tft_term_move (0, 0);
+            break;
+        }
+        case 'h':                                                               // set mode
+        case 'l':                                                               // reset mode
+            if (tft_term_param (0, 0) == 4)
+            {
+                tft_term_insert_mode = (ch == 'h');
+            }
+            break;
+        default:                                                                // e.g. 'n' (status report): ignored
+            break;
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: redraw cursor if moved or hidden
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_term_update_cursor (void)
+{
+    int             prow = tft_term_prow (tft_term_y);
+    uint_fast16_t   fcolor565;
+    uint_fast16_t   bcolor565;
+    int             x0;
+    int             y1;
+
+    if (tft_term_cursor_drawn && (! tft_term_cursor_visible || prow != tft_term_cursor_prow || tft_term_x != tft_term_cursor_col))
+    {
+        tft_term_draw_cell (tft_term_cursor_prow, tft_term_cursor_col);
+    }
+
+    if (tft_term_cursor_visible && ! tft_term_cursor_drawn)
+    {
+        tft_term_colors (tft_term_cells[prow * TFT_TERM_MAX_COLS + tft_term_x] >> 8, &fcolor565, &bcolor565);
+
+        x0 = tft_term_x * tft_term_fwidth;
+        y1 = (prow + 1) * tft_term_fheight - 1;
+        tft_fill_rectangle (x0, y1 - TFT_TERM_CURSOR_HEIGHT + 1, x0 + tft_term_fwidth - 1, y1, fcolor565);
+
+        tft_term_cursor_drawn   = 1;
+        tft_term_cursor_prow    = prow;
+        tft_term_cursor_col     = tft_term_x;
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: reset terminal state, clear screen
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+tft_term_reset (void)
+{
+    int idx;
+
+    for (idx = 0; idx < TFT_TERM_MAX_ROWS * TFT_TERM_MAX_COLS; idx++)
+    {
+        tft_term_cells[idx] = TFT_TERM_CELL(' ', TFT_TERM_ATTR_DEFAULT);
+    }
+
+    tft_term_top            = 0;
+    tft_term_y              = 0;
+    tft_term_x              = 0;
+    tft_term_wrap_pending   = 0;
+    tft_term_attr           = TFT_TERM_ATTR_DEFAULT;
+    tft_term_saved_y        = 0;
+    tft_term_saved_x        = 0;
+    tft_term_saved_attr     = TFT_TERM_ATTR_DEFAULT;
+    tft_term_scroll_top     = 0;
+    tft_term_scroll_bottom  = tft_term_rows - 1;
+    tft_term_insert_mode    = 0;
+    tft_term_cursor_visible = 1;
+    tft_term_cursor_drawn   = 0;
+    tft_term_g0_graphics    = 0;
+    tft_term_g1_graphics    = 0;
+    tft_term_shift_out      = 0;
+    tft_term_state          = TFT_TERM_STATE_NORMAL;
+
+#if defined (SSD1963)
+    ssd1963_set_scroll_area (0, tft_term_rows * tft_term_fheight, TFT_HEIGHT - tft_term_rows * tft_term_fheight);
+    ssd1963_set_scroll_start (0);
+#endif
+
+    tft_fill_screen (tft_term_palette[(TFT_TERM_ATTR_DEFAULT & TFT_TERM_ATTR_BCOLOR) >> 4]);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_term_putc () - output a character on the terminal
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+tft_term_putc (uint_fast8_t ch)
+{
+    int     save_font;
+
+    if (! tft_term_started)
+    {
+        return;
+    }
+
+    save_font = get_font ();
+    set_font (tft_term_font);
+
+    switch (tft_term_state)
+    {
+        case TFT_TERM_STATE_NORMAL:
+            switch (ch)
+            {
+                case '\033':
+                    tft_term_state = TFT_TERM_STATE_ESC;
+                    break;
+                case '\r':
+                    tft_term_move (tft_term_y, 0);
+                    break;
+                case '\n':
+                case '\013':
+                case '\014':
+                    tft_term_linefeed ();
+                    tft_term_wrap_pending = 0;
+                    break;
+                case '\b':
+                    tft_term_move (tft_term_y, tft_term_x - 1);
+                    break;
+                case '\t':
+                    tft_term_move (tft_term_y, (tft_term_x / TFT_TERM_TABSIZE + 1) * TFT_TERM_TABSIZE);
+                    break;
+                case '\016':                                                    // SO: G1
+                    tft_term_shift_out = 1;
+                    break;
+                case '\017':                                                    // SI: G0
+                    tft_term_shift_out = 0;
+                    break;
+                default:
+                    if ((ch >= 0x20 && ch < 0x7F) || ch >= 0xA0)
+                    {
+                        tft_term_print (ch);
+                    }
+                    break;
+            }
+            break;
+
+        case TFT_TERM_STATE_ESC:
+            tft_term_state = TFT_TERM_STATE_NORMAL;
+
+            switch (ch)
+            {
+                case '[':
+                    tft_term_params[0]  = 0;
+                    tft_term_n_params   = 1;
+                    tft_term_private    = 0;
+                    tft_term_state      = TFT_TERM_STATE_CSI;
+                    break;
+                case '(':
+                case ')':
+                    tft_term_designate  = ch;
+                    tft_term_state      = TFT_TERM_STATE_CHARSET;
+                    break;
+                case 'E':                                                       // next line
+                    tft_term_move (tft_term_y, 0);
+                    tft_term_linefeed ();
+                    break;
+                case 'D':                                                       // index
+                    tft_term_linefeed ();
+                    tft_term_wrap_pending = 0;
+                    break;
+                case 'M':                                                       // reverse index
+                    tft_term_reverse_linefeed ();
+                    tft_term_wrap_pending = 0;
+                    break;
+                case '7':                                                       // save cursor
+                    tft_term_saved_y    = tft_term_y;
+                    tft_term_saved_x    = tft_term_x;
+                    tft_term_saved_attr = tft_term_attr;
+                    break;
+                case '8':                                                       // restore cursor
+                    tft_term_move (tft_term_saved_y, tft_term_saved_x);
+                    tft_term_attr = tft_term_saved_attr;
+                    break;
+                case 'c':                                                       // reset
+                    tft_term_reset ();
+                    break;
+                default:
+                    break;
+            }
+            break;
+
+        case TFT_TERM_STATE_CSI:
+            if (ch >= '0' && ch <= '9')
+            {
+                tft_term_params[tft_term_n_params - 1] = tft_term_params[tft_term_n_params - 1] * 10 + (ch - '0');
+            }
+            else if (ch == ';')
+            {
+                if (tft_term_n_params < TFT_TERM_MAX_PARAMS)
+                {
+                    tft_term_params[tft_term_n_params++] = 0;
+                }
+            }
+            else if (ch == '?')
+            {
+                tft_term_private = 1;
+            }
+            else if (ch >= 0x40 && ch <= 0x7E)
+            {
+                tft_term_state = TFT_TERM_STATE_NORMAL;
+                tft_term_csi (ch);
+            }
+            else if (ch < 0x20 || ch > 0x7E)                                    // invalid, cancel sequence
+            {
+                tft_term_state = TFT_TERM_STATE_NORMAL;
+            }
+            break;
+
+        case TFT_TERM_STATE_CHARSET:
+            if (tft_term_designate == '(')
+            {
+                tft_term_g0_graphics = (ch == '0');
+            }
+            else
+            {
+                tft_term_g1_graphics = (ch == '0');
+            }
+            tft_term_state = TFT_TERM_STATE_NORMAL;
+            break;
+    }
+
+    if (tft_term_state == TFT_TERM_STATE_NORMAL)
+    {
+        tft_term_update_cursor ();
+    }
+
+    set_font (save_font);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_term_start () - start terminal with font, font < 0: largest font with at least 80 x 24 cells
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+tft_term_start (int font)
+{
+    int     save_font = get_font ();
+    int     best_area = 0;
+    int     f;
+
+    tft_comp_stop ();
+
+    if (font < 0 || font >= number_of_fonts ())
+    {
+        font = 0;
+
+        for (f = 0; f < number_of_fonts (); f++)
+        {
+            set_font (f);
+
+            if (TFT_WIDTH / font_width () >= TFT_TERM_WANTED_COLS && TFT_HEIGHT / font_height () >= TFT_TERM_WANTED_ROWS &&
+                font_width () * font_height () > best_area)
+            {
+                best_area   = font_width () * font_height ();
+                font        = f;
+            }
+        }
+    }
+
+    set_font (font);
+    tft_term_font       = font;
+    tft_term_fwidth     = font_width ();
+    tft_term_fheight    = font_height ();
+    tft_term_cols       = TFT_WIDTH / tft_term_fwidth;
+    tft_term_rows       = TFT_HEIGHT / tft_term_fheight;
+
+    if (tft_term_cols > TFT_TERM_MAX_COLS)
+    {
+        tft_term_cols = TFT_TERM_MAX_COLS;
+    }
+
+    if (tft_term_rows > TFT_TERM_MAX_ROWS)
+    {
+        tft_term_rows = TFT_TERM_MAX_ROWS;
+    }
+
+    tft_term_reset ();
+    tft_term_update_cursor ();
+    tft_term_started = 1;
+    set_font (save_font);
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_term_stop () - stop terminal, reset hardware scrolling and clear screen
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+tft_term_stop (void)
+{
+    if (tft_term_started)
+    {
+        tft_term_started = 0;
+
+#if defined (SSD1963)
+        ssd1963_set_scroll_area (0, TFT_HEIGHT, 0);
+        ssd1963_set_scroll_start (0);
+#endif
+        tft_fill_screen (BLACK565);
+    }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_term_active () - check if terminal is started
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast8_t
+tft_term_active (void)
+{
+    return tft_term_started;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_term_get_rows () - number of rows
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast8_t
+tft_term_get_rows (void)
+{
+    return tft_term_started ? tft_term_rows : 0;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tft_term_get_cols () - number of columns
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast8_t
+tft_term_get_cols (void)
+{
+    return tft_term_started ? tft_term_cols : 0;
+}
+
+#else // no TFT, define stubs:
+
+void
+tft_term_putc (uint_fast8_t ch)
+{
+    (void) ch;
+}
+
+void
+tft_term_start (int font)
+{
+    (void) font;
+}
+
+void
+tft_term_stop (void)
+{
+}
+
+uint_fast8_t
+tft_term_active (void)
+{
+    return 0;
+}
+
+uint_fast8_t
+tft_term_get_rows (void)
+{
+    return 0;
+}
+
+uint_fast8_t
+tft_term_get_cols (void)
+{
+    return 0;
+}
+
+#endif // ILI9341 || SSD1963
+
+#endif // STM32F407VE || unix
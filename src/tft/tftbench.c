@@ -0,0 +1,210 @@
+/*-------------------------------------------------------------------------------------------------------------------------------------------
+ * tftbench.c - bus traffic of the TFT primitives on the simulated controller (unix only)
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ * Build on linux (-DILI9341 and src/ili9341 instead of SSD1963 for the small display):
+ *
+ *   cc -O2 -DSSD1963 -Isrc/tft -Isrc/ssd1963 -Isrc/font -Isrc/delay -o tftbench src/tft/tftbench.c src/tft/tft_sim.c \
+ *      src/tft/tft.c src/tft/tft_comp.c src/tft/tft_term.c src/font/font.c src/ssd1963/ssd1963.c src/delay/delay.c -lm
+ *
+ * Usage:
+ *
+ *   tftbench [-p prefix]
+ *
+ *   -p prefix  write display after each test to prefix-NN.ppm, e.g. for comparison with a reference
+ *
+ * For each test the commands, data words, pixels, window changes and the bus time (see TFT_SIM_WRITE_NSEC) are printed.
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ * MIT License
+ *
+ * Copyright (c) 2018-2021 Frank Meyer - frank(at)fli4l.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *-------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#ifdef unix
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "tft.h"
+#include "font.h"
+
+static const char *             prefix;
+static int                      test_no;
+static uint16_t                 image[64 * 64];
+
+static void
+bench_start (void)
+{
+    tft_sim_reset_counters ();
+}
+
+static void
+bench_stop (const char * name)
+{
+    char    fname[256];
+
+    printf ("%-24s %8lu %10lu %10lu %8lu %10.3f\n", name, tft_sim.commands, tft_sim.data_words, tft_sim.pixels, tft_sim.windows,
+            tft_sim.bus_nsec / 1000000.0);
+
+    if (prefix)
+    {
+        snprintf (fname, sizeof (fname), "%s-%02d.ppm", prefix, test_no);
+
+        if (tft_sim_write_ppm (fname) != 0)
+        {
+            perror (fname);
+        }
+    }
+    test_no++;
+}
+
+static void
+bench_puts (const char * str)
+{
+    while (*str)
+    {
+        tft_term_putc (*str);
+        str++;
+    }
+}
+
+int
+main (int argc, char ** argv)
+{
+    static const int    star[] = { 0, -80, 24, -24, 80, 0, 24, 24, 0, 80, -24, 24, -80, 0, -24, -24 };
+    int                 xy[16];
+    int                 opt;
+    int                 i;
+    int                 x;
+    int                 y;
+
+    while ((opt = getopt (argc, argv, "p:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'p':   prefix = optarg;                                break;
+            default:    fprintf (stderr, "usage: %s [-p prefix]\n", argv[0]);
+                        return 1;
+        }
+    }
+
+    for (y = 0; y < 64; y++)
+    {
+        for (x = 0; x < 64; x++)
+        {
+            image[y * 64 + x] = tft_rgb256_to_color565 (x * 4, y * 4, 128);
+        }
+    }
+
+    for (i = 0; i < 16; i += 2)
+    {
+        xy[i]       = TFT_WIDTH / 2 + star[i];
+        xy[i + 1]   = TFT_HEIGHT / 2 + star[i + 1];
+    }
+
+    bench_start ();
+    tft_init (0);
+    bench_stop ("init");
+
+    printf ("%-24s %8s %10s %10s %8s %10s\n", "test", "commands", "data", "pixels", "windows", "bus ms");
+
+    bench_start ();
+    tft_fill_screen (BLACK565);
+    bench_stop ("fill_screen");
+
+    bench_start ();
+    for (i = 0; i < 100; i++)
+    {
+        tft_fill_rectangle (i, i, i + 40, i + 30, i * 0x0841);
+    }
+    bench_stop ("fill_rectangle x100");
+
+    bench_start ();
+    for (i = 0; i < TFT_WIDTH; i += 8)
+    {
+        tft_draw_line (i, 0, TFT_WIDTH - 1 - i, TFT_HEIGHT - 1, YELLOW565);
+    }
+    bench_stop ("draw_line");
+
+    bench_start ();
+    for (i = 10; i < TFT_HEIGHT / 2; i += 10)
+    {
+        tft_draw_circle (TFT_WIDTH / 2, TFT_HEIGHT / 2, i, CYAN565);
+    }
+    bench_stop ("draw_circle");
+
+    bench_start ();
+    tft_fill_circle (TFT_WIDTH / 4, TFT_HEIGHT / 2, TFT_HEIGHT / 4, RED565);
+    tft_fill_ellipse (3 * TFT_WIDTH / 4, TFT_HEIGHT / 2, TFT_WIDTH / 5, TFT_HEIGHT / 5, GREEN565);
+    bench_stop ("fill_circle/ellipse");
+
+    bench_start ();
+    tft_fill_polygon (xy, 8, MAGENTA565);
+    bench_stop ("fill_polygon");
+
+    bench_start ();
+    tft_draw_wide_line (10, 10, TFT_WIDTH - 10, TFT_HEIGHT / 2, 7, WHITE565);
+    bench_stop ("draw_wide_line");
+
+    bench_start ();
+    for (i = 0; i + 64 <= TFT_WIDTH; i += 64)
+    {
+        tft_draw_image (i, TFT_HEIGHT - 64, 64, 64, image);
+    }
+    bench_stop ("draw_image");
+
+    set_font (4);
+    bench_start ();
+    for (y = 0; y + font_height () <= TFT_HEIGHT; y += font_height ())
+    {
+        draw_string ((unsigned char *) "The quick brown fox jumps over the lazy dog 0123456789", y, 0, WHITE565, BLUE565);
+    }
+    bench_stop ("draw_string");
+
+    bench_start ();
+    tft_comp_start (BLACK565);
+    tft_comp_fill (20, 20, 200, 100, BLUE565);
+    tft_comp_circle (150, 120, 60, RED565);
+    tft_comp_line (0, 0, TFT_WIDTH - 1, TFT_HEIGHT - 1, WHITE565);
+    tft_comp_flush ();
+    bench_stop ("compositor first frame");
+
+    bench_start ();
+    tft_comp_circle (160, 120, 60, RED565);
+    tft_comp_flush ();
+    bench_stop ("compositor update");
+    tft_comp_stop ();
+
+    bench_start ();
+    tft_term_start (-1);
+
+    for (i = 0; i < 100; i++)
+    {
+        bench_puts ("Lorem ipsum dolor sit amet, consectetur adipiscing elit\r\n");
+    }
+    bench_stop ("terminal 100 lines");
+    tft_term_stop ();
+
+    return 0;
+}
+
+#endif // unix
@@ -7,12 +7,13 @@
  *     #undef UART_PREFIX
  *     #define UART_PREFIX          console             // prefix for all USART functions, e.g. console_puts()
  *     #include "uart.h"
+#include "ring.h"
  *
  * console.c:
  *      #define UART_NUMBER         3                   // UART number
  *      #define UART_ALTERNATE      0                   // ALTERNATE pin number, see below for possible values
- *      #define UART_TXBUFLEN       64                  // ringbuffer size for UART TX
- *      #define UART_RXBUFLEN       64                  // ringbuffer size for UART RX
+ *      #define UART_TXBUFLEN       64                  // ringbuffer size for UART TX, power of 2
+ *      #define UART_RXBUFLEN       64                  // ringbuffer size for UART RX, power of 2
  *      #include "uart-driver.h"                        // at least include this file
  *
  * Possible UARTs of STM32F4x1:
@@ -74,15 +75,12 @@
 #include "misc.h"
 
 #include "uart.h"
+#include "ring.h"
 
 #define STRBUF_SIZE                 256                                         // (v)printf buffer size
 
-static volatile uint8_t             uart_txbuf[UART_TXBUFLEN];                  // tx ringbuffer
-static volatile uint_fast16_t       uart_txsize = 0;                            // tx size
-static volatile uint8_t             uart_rxbuf[UART_RXBUFLEN];                  // rx ringbuffer
-static volatile uint_fast16_t       uart_rxsize = 0;                            // rx size
-
-static uint_fast8_t                 uart_rxstart = 0;                           // head, not volatile
+RING_DEFINE (uart_txring, UART_TXBUFLEN);                                       // tx ringbuffer
+RING_DEFINE (uart_rxring, UART_RXBUFLEN);                                       // rx ringbuffer
 
 #define INTERRUPT_CHAR              0x03                                        // CTRL-C
 static volatile uint_fast8_t        uart_rawmode = 1;                           // raw mode: no interrupts
@@ -393,24 +391,11 @@ UART_PREFIX_INIT (uint32_t baudrate)
 void
 UART_PREFIX_PUTC (uint_fast8_t ch)
 {
-    static uint_fast8_t uart_txstop  = 0;                                       // tail
-
-    while (uart_txsize >= UART_TXBUFLEN)                                        // buffer full?
+    while (! ring_put (&uart_txring, ch))                                       // buffer full?
     {                                                                           // yes
         ;                                                                       // wait
     }
 
-    uart_txbuf[uart_txstop++] = ch;                                             // store character
-
-    if (uart_txstop >= UART_TXBUFLEN)                                           // at end of ringbuffer?
-    {                                                                           // yes
-        uart_txstop = 0;                                                        // reset to beginning
-    }
-
-    __disable_irq();
-    uart_txsize++;                                                              // increment used size
-    __enable_irq();
-
     USART_ITConfig(UART_NAME, USART_IT_TXE, ENABLE);                           // enable TXE interrupt
 }
 
@@ -469,24 +454,13 @@ UART_PREFIX_PRINTF (const char * fmt, ...)
 uint_fast8_t
 UART_PREFIX_GETC (void)
 {
-    uint_fast8_t         ch;
+    uint8_t         ch;
 
-    while (uart_rxsize == 0)                                                    // rx buffer empty?
+    while (! ring_get (&uart_rxring, &ch))                                      // rx buffer empty?
     {                                                                           // yes, wait
         ;
     }
 
-    ch = uart_rxbuf[uart_rxstart++];                                            // get character from ringbuffer
-
-    if (uart_rxstart == UART_RXBUFLEN)                                          // at end of rx buffer?
-    {                                                                           // yes
-        uart_rxstart = 0;                                                       // reset to beginning
-    }
-
-    __disable_irq();
-    uart_rxsize--;                                                              // decrement size
-    __enable_irq();
-
     return (ch);
 }
 
@@ -534,24 +508,13 @@ UART_PREFIX_INTERRUPTED (void)
 uint_fast8_t
 UART_PREFIX_POLL (uint_fast8_t * chp)
 {
-    uint_fast8_t        ch;
+    uint8_t             ch;
 
-    if (uart_rxsize == 0)                                                       // rx buffer empty?
+    if (! ring_get (&uart_rxring, &ch))                                         // rx buffer empty?
     {                                                                           // yes, return 0
         return 0;
     }
 
-    ch = uart_rxbuf[uart_rxstart++];                                            // get character from ringbuffer
-
-    if (uart_rxstart == UART_RXBUFLEN)                                          // at end of rx buffer?
-    {                                                                           // yes
-        uart_rxstart = 0;                                                       // reset to beginning
-    }
-
-    __disable_irq();
-    uart_rxsize--;                                                              // decrement size
-    __enable_irq();
-
     *chp = ch;
     return 1;
 }
@@ -563,7 +526,7 @@ UART_PREFIX_POLL (uint_fast8_t * chp)
 uint_fast16_t
 UART_PREFIX_RXSIZE (void)
 {
-    return uart_rxsize;
+    return ring_used (&uart_rxring);
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -573,7 +536,7 @@ UART_PREFIX_RXSIZE (void)
 void
 UART_PREFIX_FLUSH (void)
 {
-    while (uart_txsize > 0)                                                     // tx buffer empty?
+    while (! ring_empty (&uart_txring))                                         // tx buffer empty?
     {
         ;                                                                       // no, wait
     }
@@ -587,9 +550,8 @@ void UART_IRQ_HANDLER (void);
 
 void UART_IRQ_HANDLER (void)
 {
-    static uint_fast8_t     uart_rxstop  = 0;                                   // tail
     uint16_t                value;
-    uint_fast8_t            ch;
+    uint8_t                 ch;
 
     if (USART_GetITStatus (UART_NAME, USART_IT_RXNE) != RESET)
     {
@@ -603,36 +565,15 @@ void UART_IRQ_HANDLER (void)
             uart_interrupted = 1;
         }
 
-        if (uart_rxsize < UART_RXBUFLEN)                                        // buffer full?
-        {                                                                       // no
-            uart_rxbuf[uart_rxstop++] = ch;                                     // store character
-
-            if (uart_rxstop >= UART_RXBUFLEN)                                   // at end of ringbuffer?
-            {                                                                   // yes
-                uart_rxstop = 0;                                                // reset to beginning
-            }
-
-            uart_rxsize++;                                                      // increment used size
-        }
+        (void) ring_put (&uart_rxring, ch);                                     // buffer full: character is lost
     }
 
     if (USART_GetITStatus (UART_NAME, USART_IT_TXE) != RESET)
     {
-        static uint_fast8_t  uart_txstart = 0;                                  // head
-
         USART_ClearITPendingBit (UART_NAME, USART_IT_TXE);
 
-        if (uart_txsize > 0)                                                    // tx buffer empty?
+        if (ring_get (&uart_txring, &ch))                                       // tx buffer empty?
         {                                                                       // no
-            ch = uart_txbuf[uart_txstart++];                                    // get character to send, increment offset
-
-            if (uart_txstart == UART_TXBUFLEN)                                  // at end of tx buffer?
-            {                                                                   // yes
-                uart_txstart = 0;                                               // reset to beginning
-            }
-
-            uart_txsize--;                                                      // decrement size
-
             USART_SendData(UART_NAME, ch);
         }
         else
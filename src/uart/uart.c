@@ -48,22 +48,35 @@
 #include "stm32f4xx_gpio.h"
 #include "stm32f4xx_usart.h"
 #include "stm32f4xx_rcc.h"
+#include "stm32f4xx_dma.h"
 #include "misc.h"
 
 #include "uart.h"
+#include "ring.h"
 
 #define STRBUF_SIZE                 256                                         // (v)printf buffer size
-#define UART_TXBUFLEN               64
-#define UART_RXBUFLEN               64
+#define UART_TXBUFLEN               64                                          // UART4 - UART6, must be power of 2
+#define UART_RXBUFLEN               64                                          // UART4 - UART6, must be power of 2
+#define UART_DMA_TXBUFLEN           1024                                        // UART1 - UART3, must be power of 2
+#define UART_DMA_RXBUFLEN           1024                                        // UART1 - UART3, must be power of 2
+#define UART_DMA_RXMASK             (UART_DMA_RXBUFLEN - 1)
+#define N_DMA_UARTS                 3                                           // UART_NUMBER_1 - UART_NUMBER_3 use DMA
 
 #define INTERRUPT_CHAR              0x03                                        // CTRL-C
 
-static volatile uint8_t             uart_txbuf[N_UARTS][UART_TXBUFLEN];         // tx ringbuffer
-static volatile uint_fast16_t       uart_txsize[N_UARTS];                       // tx size
-static volatile uint8_t             uart_rxbuf[N_UARTS][UART_RXBUFLEN];         // rx ringbuffer
-static volatile uint_fast16_t       uart_rxsize[N_UARTS];                       // rx size
+RING_DEFINE (uart1_txring, UART_DMA_TXBUFLEN);                                  // tx ringbuffers
+RING_DEFINE (uart2_txring, UART_DMA_TXBUFLEN);
+RING_DEFINE (uart3_txring, UART_DMA_TXBUFLEN);
+RING_DEFINE (uart4_txring, UART_TXBUFLEN);
+RING_DEFINE (uart5_txring, UART_TXBUFLEN);
+RING_DEFINE (uart6_txring, UART_TXBUFLEN);
+RING_DEFINE (uart4_rxring, UART_RXBUFLEN);                                      // rx ringbuffers, UART1 - UART3: see DMA
+RING_DEFINE (uart5_rxring, UART_RXBUFLEN);
+RING_DEFINE (uart6_rxring, UART_RXBUFLEN);
 
-static uint_fast8_t                 uart_rxstart[N_UARTS];                      // head, not volatile
+static RING * const                 uart_txring[N_UARTS] = { &uart1_txring, &uart2_txring, &uart3_txring, &uart4_txring, &uart5_txring, &uart6_txring };
+static RING * const                 uart_rxring[N_UARTS] = { (RING *) 0, (RING *) 0, (RING *) 0, &uart4_rxring, &uart5_rxring, &uart6_rxring };
+static USART_TypeDef * const        uart_usart[N_UARTS]  = { USART1, USART2, USART3, UART4, UART5, USART6 };
 
 static volatile uint_fast8_t        uart_raw[N_UARTS];                          // raw mode: no interrupts
 static volatile uint_fast8_t        uart_int[N_UARTS];                          // flag: user pressed CTRL-C
@@ -495,6 +508,271 @@ uart6_init (uint_fast8_t alternate, uint32_t baudrate)
     NVIC_Init (&nvic);
 }
 
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * DMA for UART1 - UART3:
+ *
+ *   TX: uart_putc(), uart_puts() and uart_write() copy into the tx ring and start a DMA transfer of the contiguous part
+ *       at its tail, if no transfer is running. The transfer complete interrupt removes the part from the ring and starts
+ *       the next one. So there is one interrupt per block instead of one per character.
+ *   RX: a circular DMA transfer fills a ring of UART_DMA_RXBUFLEN bytes, the write position is computed from NDTR. The
+ *       interrupts of the USART (idle line) and of the DMA (half and full transfer) only look for CTRL-C in the new
+ *       characters. If the ring is not read in time, the oldest characters are overwritten.
+ *
+ * UART4 - UART6 still use the interrupt per character:
+ *   UART4:  TX DMA1 Stream4 collides with WS2812.
+ *   UART5:  DMA1 Stream7 (TX) and Stream0 (RX), channel 4, are free. It is left on interrupts because the DMA code above
+ *           expects the DMA UARTs to be UART_NUMBER_1 - UART_NUMBER_3 (uart_number < N_DMA_UARTS).
+ *   USART6: TX DMA2 Stream6 collides with SDIO and Stream7 with UART1, so there is no free TX stream.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+typedef struct
+{
+    DMA_Stream_TypeDef *    tx_stream;
+    DMA_Stream_TypeDef *    rx_stream;
+    uint32_t                dma_clock;                                          // RCC_AHB1Periph_DMAx
+    uint32_t                channel;
+    uint32_t                tx_flags;                                           // all flags of TX stream
+    uint32_t                tx_it;                                              // transfer complete of TX stream
+    uint32_t                rx_ht_it;                                           // half transfer of RX stream
+    uint32_t                rx_tc_it;                                           // transfer complete of RX stream
+    uint8_t                 tx_irqn;
+    uint8_t                 rx_irqn;
+} UART_DMA_CONF;
+
+static const UART_DMA_CONF          uart_dma_conf[N_DMA_UARTS] =
+{
+    {                                                                           // UART1: DMA2 Stream7 (TX), Stream2 (RX)
+        DMA2_Stream7, DMA2_Stream2, RCC_AHB1Periph_DMA2, DMA_Channel_4,
+        DMA_FLAG_TCIF7 | DMA_FLAG_HTIF7 | DMA_FLAG_TEIF7 | DMA_FLAG_DMEIF7 | DMA_FLAG_FEIF7,
+        DMA_IT_TCIF7, DMA_IT_HTIF2, DMA_IT_TCIF2, DMA2_Stream7_IRQn, DMA2_Stream2_IRQn
+    },
+    {                                                                           // UART2: DMA1 Stream6 (TX), Stream5 (RX)
+        DMA1_Stream6, DMA1_Stream5, RCC_AHB1Periph_DMA1, DMA_Channel_4,
+        DMA_FLAG_TCIF6 | DMA_FLAG_HTIF6 | DMA_FLAG_TEIF6 | DMA_FLAG_DMEIF6 | DMA_FLAG_FEIF6,
+        DMA_IT_TCIF6, DMA_IT_HTIF5, DMA_IT_TCIF5, DMA1_Stream6_IRQn, DMA1_Stream5_IRQn
+    },
+    {                                                                           // UART3: DMA1 Stream3 (TX), Stream1 (RX)
+        DMA1_Stream3, DMA1_Stream1, RCC_AHB1Periph_DMA1, DMA_Channel_4,
+        DMA_FLAG_TCIF3 | DMA_FLAG_HTIF3 | DMA_FLAG_TEIF3 | DMA_FLAG_DMEIF3 | DMA_FLAG_FEIF3,
+        DMA_IT_TCIF3, DMA_IT_HTIF1, DMA_IT_TCIF1, DMA1_Stream3_IRQn, DMA1_Stream1_IRQn
+    }
+};
+
+static volatile uint_fast16_t       uart_dma_txlen[N_DMA_UARTS];                        // length of running transfer
+static volatile uint_fast8_t        uart_dma_txbusy[N_DMA_UARTS];                       // 1: transfer running
+static volatile uint8_t             uart_dma_rxbuf[N_DMA_UARTS][UART_DMA_RXBUFLEN];     // rx ringbuffer, written by DMA
+static uint_fast16_t                uart_dma_rxtail[N_DMA_UARTS];                       // read position, not volatile
+static uint_fast16_t                uart_dma_rxscan[N_DMA_UARTS];                       // CTRL-C scan position of ISRs
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: start transfer of next contiguous part of tx ring, called with no transfer running
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+uart_dma_tx_next (uint_fast8_t uart_number)
+{
+    const UART_DMA_CONF *   conf = &uart_dma_conf[uart_number];
+    uint8_t *               data;
+    uint_fast16_t           len;
+
+    len = ring_linear (uart_txring[uart_number], &data);
+
+    if (len == 0)
+    {
+        uart_dma_txbusy[uart_number] = 0;
+        return;
+    }
+
+    uart_dma_txlen[uart_number] = len;
+    conf->tx_stream->M0AR       = (uint32_t) data;
+    conf->tx_stream->NDTR       = len;
+
+    DMA_ClearFlag (conf->tx_stream, conf->tx_flags);
+    DMA_Cmd (conf->tx_stream, ENABLE);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: copy n bytes into tx ring, waits while the ring is full
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+uart_dma_write (uint_fast8_t uart_number, const char * buf, uint_fast16_t n)
+{
+    uint_fast16_t   len;
+
+    while (n > 0)
+    {
+        len = ring_write (uart_txring[uart_number], (const uint8_t *) buf, n);      // 0 if full, transfer is running
+        buf += len;
+        n   -= len;
+
+        if (len > 0 && ! uart_dma_txbusy[uart_number])                          // ISR only runs while busy
+        {
+            uart_dma_txbusy[uart_number] = 1;
+            uart_dma_tx_next (uart_number);
+        }
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: number of received characters in rx ring
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast16_t
+uart_dma_rxsize (uint_fast8_t uart_number)
+{
+    uint_fast16_t   head = UART_DMA_RXBUFLEN - uart_dma_conf[uart_number].rx_stream->NDTR;
+
+    return (head - uart_dma_rxtail[uart_number]) & UART_DMA_RXMASK;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: get character from rx ring, ring must not be empty
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint_fast8_t
+uart_dma_getc (uint_fast8_t uart_number)
+{
+    uint_fast8_t    ch = uart_dma_rxbuf[uart_number][uart_dma_rxtail[uart_number]];
+
+    uart_dma_rxtail[uart_number] = (uart_dma_rxtail[uart_number] + 1) & UART_DMA_RXMASK;
+    return ch;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: look for CTRL-C in characters received since last call, called by ISRs only
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+uart_dma_rx_scan (uint_fast8_t uart_number)
+{
+    uint_fast16_t   head = (UART_DMA_RXBUFLEN - uart_dma_conf[uart_number].rx_stream->NDTR) & UART_DMA_RXMASK;
+    uint_fast16_t   pos  = uart_dma_rxscan[uart_number];
+
+    if (! uart_raw[uart_number])
+    {
+        while (pos != head)
+        {
+            if (uart_dma_rxbuf[uart_number][pos] == INTERRUPT_CHAR)
+            {
+                uart_int[uart_number] = 1;
+            }
+            pos = (pos + 1) & UART_DMA_RXMASK;
+        }
+    }
+
+    uart_dma_rxscan[uart_number] = head;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: TX DMA ISR, transfer of one part complete
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+uart_dma_tx_isr (uint_fast8_t uart_number)
+{
+    const UART_DMA_CONF *   conf = &uart_dma_conf[uart_number];
+
+    if (DMA_GetITStatus (conf->tx_stream, conf->tx_it))
+    {
+        DMA_ClearITPendingBit (conf->tx_stream, conf->tx_it);
+        ring_skip (uart_txring[uart_number], uart_dma_txlen[uart_number]);
+        uart_dma_tx_next (uart_number);
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: RX DMA ISR, half or full rx ring written
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+uart_dma_rx_isr (uint_fast8_t uart_number)
+{
+    const UART_DMA_CONF *   conf = &uart_dma_conf[uart_number];
+
+    if (DMA_GetITStatus (conf->rx_stream, conf->rx_ht_it))
+    {
+        DMA_ClearITPendingBit (conf->rx_stream, conf->rx_ht_it);
+    }
+
+    if (DMA_GetITStatus (conf->rx_stream, conf->rx_tc_it))
+    {
+        DMA_ClearITPendingBit (conf->rx_stream, conf->rx_tc_it);
+    }
+
+    uart_dma_rx_scan (uart_number);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: initialize DMA of UART, called after uartN_init()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+uart_dma_init (uint_fast8_t uart_number)
+{
+    const UART_DMA_CONF *   conf    = &uart_dma_conf[uart_number];
+    USART_TypeDef *         usart   = uart_usart[uart_number];
+    DMA_InitTypeDef         dma;
+    NVIC_InitTypeDef        nvic;
+
+    while (uart_dma_txbusy[uart_number])                                        // in case of re-initialization
+    {
+        ;
+    }
+
+    RCC_AHB1PeriphClockCmd (conf->dma_clock, ENABLE);
+
+    DMA_Cmd (conf->tx_stream, DISABLE);
+    DMA_DeInit (conf->tx_stream);
+    DMA_StructInit (&dma);
+
+    dma.DMA_Channel             = conf->channel;
+    dma.DMA_DIR                 = DMA_DIR_MemoryToPeripheral;
+    dma.DMA_PeripheralBaseAddr  = (uint32_t) &usart->DR;
+    dma.DMA_Memory0BaseAddr     = (uint32_t) uart_txring[uart_number]->buf;
+    dma.DMA_BufferSize          = 1;
+    dma.DMA_PeripheralInc       = DMA_PeripheralInc_Disable;
+    dma.DMA_MemoryInc           = DMA_MemoryInc_Enable;
+    dma.DMA_PeripheralDataSize  = DMA_PeripheralDataSize_Byte;
+    dma.DMA_MemoryDataSize      = DMA_MemoryDataSize_Byte;
+    dma.DMA_Mode                = DMA_Mode_Normal;
+    dma.DMA_Priority            = DMA_Priority_Low;
+    dma.DMA_FIFOMode            = DMA_FIFOMode_Disable;
+    dma.DMA_FIFOThreshold       = DMA_FIFOThreshold_HalfFull;
+    dma.DMA_MemoryBurst         = DMA_MemoryBurst_Single;
+    dma.DMA_PeripheralBurst     = DMA_PeripheralBurst_Single;
+    DMA_Init (conf->tx_stream, &dma);
+    DMA_ITConfig (conf->tx_stream, DMA_IT_TC, ENABLE);
+
+    DMA_Cmd (conf->rx_stream, DISABLE);
+    DMA_DeInit (conf->rx_stream);
+
+    dma.DMA_DIR                 = DMA_DIR_PeripheralToMemory;
+    dma.DMA_Memory0BaseAddr     = (uint32_t) uart_dma_rxbuf[uart_number];
+    dma.DMA_BufferSize          = UART_DMA_RXBUFLEN;
+    dma.DMA_Mode                = DMA_Mode_Circular;
+    DMA_Init (conf->rx_stream, &dma);
+    DMA_ITConfig (conf->rx_stream, DMA_IT_HT | DMA_IT_TC, ENABLE);
+
+    ring_reset (uart_txring[uart_number]);
+    uart_dma_rxtail[uart_number]    = 0;
+    uart_dma_rxscan[uart_number]    = 0;
+
+    DMA_Cmd (conf->rx_stream, ENABLE);
+
+    USART_ITConfig (usart, USART_IT_RXNE, DISABLE);                             // characters are fetched by DMA
+    USART_ITConfig (usart, USART_IT_IDLE, ENABLE);                              // idle line: look for CTRL-C
+    USART_DMACmd (usart, USART_DMAReq_Tx | USART_DMAReq_Rx, ENABLE);
+
+    nvic.NVIC_IRQChannel                    = conf->tx_irqn;
+    nvic.NVIC_IRQChannelPreemptionPriority  = 0;
+    nvic.NVIC_IRQChannelSubPriority         = 0;
+    nvic.NVIC_IRQChannelCmd                 = ENABLE;
+    NVIC_Init (&nvic);
+
+    nvic.NVIC_IRQChannel                    = conf->rx_irqn;
+    NVIC_Init (&nvic);
+}
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
  * uart_init () - initialize UART
  *---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -514,6 +792,11 @@ uart_init (uint_fast8_t uart_number, uint_fast8_t alternate, uint32_t baudrate)
         case UART_NUMBER_5:     uart5_init (alternate, baudrate);   break;
         case UART_NUMBER_6:     uart6_init (alternate, baudrate);   break;
     }
+
+    if (uart_number < N_DMA_UARTS)
+    {
+        uart_dma_init (uart_number);
+    }
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -523,34 +806,21 @@ uart_init (uint_fast8_t uart_number, uint_fast8_t alternate, uint32_t baudrate)
 void
 uart_putc (uint_fast8_t uart_number, uint_fast8_t ch)
 {
-    static uint_fast8_t uart_txstop[N_UARTS];                                   // tail
+    char                c;
 
-    while (uart_txsize[uart_number] >= UART_TXBUFLEN)                                        // buffer full?
-    {                                                                           // yes
-        ;                                                                       // wait
+    if (uart_number < N_DMA_UARTS)
+    {
+        c = ch;
+        uart_dma_write (uart_number, &c, 1);
+        return;
     }
 
-    uart_txbuf[uart_number][uart_txstop[uart_number]++] = ch;                   // store character
-
-    if (uart_txstop[uart_number] >= UART_TXBUFLEN)                              // at end of ringbuffer?
+    while (! ring_put (uart_txring[uart_number], ch))                           // buffer full?
     {                                                                           // yes
-        uart_txstop[uart_number] = 0;                                           // reset to beginning
-    }
-
-    __disable_irq();
-    uart_txsize[uart_number]++;                                                 // increment used size
-    __enable_irq();
-
-    switch (uart_number)
-    {
-        case UART_NUMBER_1: USART_ITConfig(USART1, USART_IT_TXE, ENABLE); break;    // enable TXE interrupt
-        case UART_NUMBER_2: USART_ITConfig(USART2, USART_IT_TXE, ENABLE); break;    // enable TXE interrupt
-        case UART_NUMBER_3: USART_ITConfig(USART3, USART_IT_TXE, ENABLE); break;    // enable TXE interrupt
-        case UART_NUMBER_4: USART_ITConfig(UART4,  USART_IT_TXE, ENABLE); break;    // enable TXE interrupt
-        case UART_NUMBER_5: USART_ITConfig(UART5,  USART_IT_TXE, ENABLE); break;    // enable TXE interrupt
-        case UART_NUMBER_6: USART_ITConfig(USART6, USART_IT_TXE, ENABLE); break;    // enable TXE interrupt
+        ;                                                                       // wait
     }
 
+    USART_ITConfig (uart_usart[uart_number], USART_IT_TXE, ENABLE);             // enable TXE interrupt
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -560,13 +830,30 @@ uart_putc (uint_fast8_t uart_number, uint_fast8_t ch)
 void
 uart_puts (uint_fast8_t uart_number, const char * s)
 {
-    uint_fast8_t ch;
+    (void) uart_write (uart_number, (char *) s, strlen (s));
+}
 
-    while ((ch = (uint_fast8_t) *s) != '\0')
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * uart_write () - write n bytes, returns n
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast16_t
+uart_write (uint_fast8_t uart_number, char * buf, uint_fast16_t n)
+{
+    uint_fast16_t   cnt = 0;
+
+    if (uart_number < N_DMA_UARTS)
+    {
+        uart_dma_write (uart_number, buf, n);
+        return n;
+    }
+
+    while (cnt < n)
     {
-        uart_putc (uart_number, ch);
-        s++;
+        cnt += ring_write (uart_txring[uart_number], (const uint8_t *) buf + cnt, n - cnt);    // 0 if full, wait for ISR
+        USART_ITConfig (uart_usart[uart_number], USART_IT_TXE, ENABLE);         // enable TXE interrupt
     }
+    return n;
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -608,25 +895,73 @@ uart_printf (uint_fast8_t uart_number, const char * fmt, ...)
 uint_fast8_t
 uart_getc (uint_fast8_t uart_number)
 {
-    uint_fast8_t         ch;
+    uint8_t         ch;
 
-    while (uart_rxsize[uart_number] == 0)                                       // rx buffer empty?
+    if (uart_number < N_DMA_UARTS)
+    {
+        while (uart_dma_rxsize (uart_number) == 0)                              // rx buffer empty?
+        {                                                                       // yes, wait
+            ;
+        }
+        return uart_dma_getc (uart_number);
+    }
+
+    while (! ring_get (uart_rxring[uart_number], &ch))                          // rx buffer empty?
     {                                                                           // yes, wait
         ;
     }
 
-    ch = uart_rxbuf[uart_number][uart_rxstart[uart_number]++];                  // get character from ringbuffer
+    return (ch);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * uart_read () - wait for at least one character, then read up to n characters, returns number of characters read
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint_fast16_t
+uart_read (uint_fast8_t uart_number, char * buf, uint_fast16_t n)
+{
+    uint_fast16_t   cnt = 0;
+    uint_fast16_t   len;
+    uint_fast16_t   tail;
 
-    if (uart_rxstart[uart_number] == UART_RXBUFLEN)                             // at end of rx buffer?
-    {                                                                           // yes
-        uart_rxstart[uart_number] = 0;                                          // reset to beginning
+    if (n == 0)
+    {
+        return 0;
     }
 
-    __disable_irq();
-    uart_rxsize[uart_number]--;                                                 // decrement size
-    __enable_irq();
+    if (uart_number < N_DMA_UARTS)
+    {
+        while ((len = uart_dma_rxsize (uart_number)) == 0)
+        {
+            ;
+        }
 
-    return (ch);
+        while (cnt < n && len > 0)                                              // at most two contiguous parts
+        {
+            tail = uart_dma_rxtail[uart_number];
+
+            if (len > n - cnt)
+            {
+                len = n - cnt;
+            }
+
+            if (len > UART_DMA_RXBUFLEN - tail)
+            {
+                len = UART_DMA_RXBUFLEN - tail;
+            }
+
+            memcpy (buf + cnt, (const uint8_t *) &uart_dma_rxbuf[uart_number][tail], len);
+            uart_dma_rxtail[uart_number] = (tail + len) & UART_DMA_RXMASK;
+            cnt += len;
+            len = uart_dma_rxsize (uart_number);
+        }
+        return cnt;
+    }
+
+    buf[cnt++] = uart_getc (uart_number);
+    cnt += ring_read (uart_rxring[uart_number], (uint8_t *) buf + cnt, n - cnt);
+    return cnt;
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -673,23 +1008,23 @@ uart_interrupted (uint_fast8_t uart_number)
 uint_fast8_t
 uart_poll (uint_fast8_t uart_number, uint_fast8_t * chp)
 {
-    uint_fast8_t        ch;
-
-    if (uart_rxsize[uart_number] == 0)                                          // rx buffer empty?
-    {                                                                           // yes, return 0
-        return 0;
-    }
+    uint8_t             ch;
 
-    ch = uart_rxbuf[uart_number][uart_rxstart[uart_number]++];                  // get character from ringbuffer
+    if (uart_number < N_DMA_UARTS)
+    {
+        if (uart_dma_rxsize (uart_number) == 0)                                 // rx buffer empty?
+        {                                                                       // yes, return 0
+            return 0;
+        }
 
-    if (uart_rxstart[uart_number] == UART_RXBUFLEN)                             // at end of rx buffer?
-    {                                                                           // yes
-        uart_rxstart[uart_number] = 0;                                          // reset to beginning
+        *chp = uart_dma_getc (uart_number);
+        return 1;
     }
 
-    __disable_irq();
-    uart_rxsize[uart_number]--;                                                 // decrement size
-    __enable_irq();
+    if (! ring_get (uart_rxring[uart_number], &ch))                             // rx buffer empty?
+    {                                                                           // yes, return 0
+        return 0;
+    }
 
     *chp = ch;
     return 1;
@@ -702,7 +1037,11 @@ uart_poll (uint_fast8_t uart_number, uint_fast8_t * chp)
 uint_fast16_t
 uart_get_rxsize (uint_fast8_t uart_number)
 {
-    return uart_rxsize[uart_number];
+    if (uart_number < N_DMA_UARTS)
+    {
+        return uart_dma_rxsize (uart_number);
+    }
+    return ring_used (uart_rxring[uart_number]);
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -712,80 +1051,82 @@ uart_get_rxsize (uint_fast8_t uart_number)
 void
 uart_flush (uint_fast8_t uart_number)
 {
-    while (uart_txsize[uart_number] > 0)                                        // tx buffer empty?
+    if (uart_number < N_DMA_UARTS)
+    {
+        while (uart_dma_txbusy[uart_number])                                    // tx transfer running?
+        {
+            ;                                                                   // yes, wait
+        }
+        return;
+    }
+
+    while (! ring_empty (uart_txring[uart_number]))                             // tx buffer empty?
     {
         ;                                                                       // no, wait
     }
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
- * USART1_IRQHandler ()
+ * INTERN: common part of USARTx_IRQHandler ()
  *---------------------------------------------------------------------------------------------------------------------------------------------------
  */
-void USART1_IRQHandler (void);
-
-void
-USART1_IRQHandler (void)
+static void
+uart_isr (uint_fast8_t uart_number, USART_TypeDef * usart)
 {
-    static uint_fast8_t     uart_rxstop  = 0;                                   // tail
     uint16_t                value;
-    uint_fast8_t            ch;
+    uint8_t                 ch;
 
-    if (USART_GetITStatus (USART1, USART_IT_RXNE) != RESET)
+    if (uart_number < N_DMA_UARTS)
     {
-        USART_ClearITPendingBit (USART1, USART_IT_RXNE);
-        value = USART_ReceiveData (USART1);
-
-        ch = value & 0xFF;
-
-        if (! uart_raw[UART_NUMBER_1] && ch == INTERRUPT_CHAR)                  // no raw mode & user pressed CTRL-C
+        if (USART_GetITStatus (usart, USART_IT_IDLE) != RESET)                  // DMA: line idle after reception
         {
-            uart_int[UART_NUMBER_1] = 1;
+            (void) USART_ReceiveData (usart);                                   // read SR, then DR: clears IDLE
+            uart_dma_rx_scan (uart_number);
         }
+        return;
+    }
 
-        if (uart_rxsize[UART_NUMBER_1] < UART_RXBUFLEN)                         // buffer full?
-        {                                                                       // no
-            uart_rxbuf[UART_NUMBER_1][uart_rxstop++] = ch;                      // store character
+    if (USART_GetITStatus (usart, USART_IT_RXNE) != RESET)
+    {
+        USART_ClearITPendingBit (usart, USART_IT_RXNE);
+        value = USART_ReceiveData (usart);
 
-            if (uart_rxstop >= UART_RXBUFLEN)                                   // at end of ringbuffer?
-            {                                                                   // yes
-                uart_rxstop = 0;                                                // reset to beginning
-            }
+        ch = value & 0xFF;
 
-            uart_rxsize[UART_NUMBER_1]++;                                       // increment used size
+        if (! uart_raw[uart_number] && ch == INTERRUPT_CHAR)                    // no raw mode & user pressed CTRL-C
+        {
+            uart_int[uart_number] = 1;
         }
+
+        (void) ring_put (uart_rxring[uart_number], ch);                         // buffer full: character is lost
     }
 
-    if (USART_GetITStatus (USART1, USART_IT_TXE) != RESET)
+    if (USART_GetITStatus (usart, USART_IT_TXE) != RESET)
     {
-        static uint_fast8_t  uart_txstart = 0;                                  // head
-
-        USART_ClearITPendingBit (USART1, USART_IT_TXE);
+        USART_ClearITPendingBit (usart, USART_IT_TXE);
 
-        if (uart_txsize[UART_NUMBER_1] > 0)                                     // tx buffer empty?
+        if (ring_get (uart_txring[uart_number], &ch))                           // tx buffer empty?
         {                                                                       // no
-            ch = uart_txbuf[UART_NUMBER_1][uart_txstart++];                     // get character to send, increment offset
-
-            if (uart_txstart == UART_TXBUFLEN)                                  // at end of tx buffer?
-            {                                                                   // yes
-                uart_txstart = 0;                                               // reset to beginning
-            }
-
-            uart_txsize[UART_NUMBER_1]--;                                       // decrement size
-
-            USART_SendData(USART1, ch);
+            USART_SendData (usart, ch);
         }
         else
         {
-            USART_ITConfig(USART1, USART_IT_TXE, DISABLE);                      // disable TXE interrupt
+            USART_ITConfig (usart, USART_IT_TXE, DISABLE);                      // disable TXE interrupt
         }
     }
-    else
-    {
-        ;
-    }
 }
 
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * USART1_IRQHandler ()
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void USART1_IRQHandler (void);
+
+void
+USART1_IRQHandler (void)
+{
+    uart_isr (UART_NUMBER_1, USART1);
+}
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
  * USART2_IRQHandler ()
@@ -796,63 +1137,7 @@ void USART2_IRQHandler (void);
 void
 USART2_IRQHandler (void)
 {
-    static uint_fast8_t     uart_rxstop  = 0;                                   // tail
-    uint16_t                value;
-    uint_fast8_t            ch;
-
-    if (USART_GetITStatus (USART2, USART_IT_RXNE) != RESET)
-    {
-        USART_ClearITPendingBit (USART2, USART_IT_RXNE);
-        value = USART_ReceiveData (USART2);
-
-        ch = value & 0xFF;
-
-        if (! uart_raw[UART_NUMBER_2] && ch == INTERRUPT_CHAR)                  // no raw mode & user pressed CTRL-C
-        {
-            uart_int[UART_NUMBER_2] = 1;
-        }
-
-        if (uart_rxsize[UART_NUMBER_2] < UART_RXBUFLEN)                         // buffer full?
-        {                                                                       // no
-            uart_rxbuf[UART_NUMBER_2][uart_rxstop++] = ch;                      // store character
-
-            if (uart_rxstop >= UART_RXBUFLEN)                                   // at end of ringbuffer?
-            {                                                                   // yes
-                uart_rxstop = 0;                                                // reset to beginning
-            }
-
-            uart_rxsize[UART_NUMBER_2]++;                                       // increment used size
-        }
-    }
-
-    if (USART_GetITStatus (USART2, USART_IT_TXE) != RESET)
-    {
-        static uint_fast8_t  uart_txstart = 0;                                  // head
-
-        USART_ClearITPendingBit (USART2, USART_IT_TXE);
-
-        if (uart_txsize[UART_NUMBER_2] > 0)                                     // tx buffer empty?
-        {                                                                       // no
-            ch = uart_txbuf[UART_NUMBER_2][uart_txstart++];                     // get character to send, increment offset
-
-            if (uart_txstart == UART_TXBUFLEN)                                  // at end of tx buffer?
-            {                                                                   // yes
-                uart_txstart = 0;                                               // reset to beginning
-            }
-
-            uart_txsize[UART_NUMBER_2]--;                                       // decrement size
-
-            USART_SendData(USART2, ch);
-        }
-        else
-        {
-            USART_ITConfig(USART2, USART_IT_TXE, DISABLE);                      // disable TXE interrupt
-        }
-    }
-    else
-    {
-        ;
-    }
+    uart_isr (UART_NUMBER_2, USART2);
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -864,63 +1149,7 @@ void USART3_IRQHandler (void);
 void
 USART3_IRQHandler (void)
 {
-    static uint_fast8_t     uart_rxstop  = 0;                                   // tail
-    uint16_t                value;
-    uint_fast8_t            ch;
-
-    if (USART_GetITStatus (USART3, USART_IT_RXNE) != RESET)
-    {
-        USART_ClearITPendingBit (USART3, USART_IT_RXNE);
-        value = USART_ReceiveData (USART3);
-
-        ch = value & 0xFF;
-
-        if (! uart_raw[UART_NUMBER_3] && ch == INTERRUPT_CHAR)                  // no raw mode & user pressed CTRL-C
-        {
-            uart_int[UART_NUMBER_3] = 1;
-        }
-
-        if (uart_rxsize[UART_NUMBER_3] < UART_RXBUFLEN)                         // buffer full?
-        {                                                                       // no
-            uart_rxbuf[UART_NUMBER_3][uart_rxstop++] = ch;                      // store character
-
-            if (uart_rxstop >= UART_RXBUFLEN)                                   // at end of ringbuffer?
-            {                                                                   // yes
-                uart_rxstop = 0;                                                // reset to beginning
-            }
-
-            uart_rxsize[UART_NUMBER_3]++;                                       // increment used size
-        }
-    }
-
-    if (USART_GetITStatus (USART3, USART_IT_TXE) != RESET)
-    {
-        static uint_fast8_t  uart_txstart = 0;                                  // head
-
-        USART_ClearITPendingBit (USART3, USART_IT_TXE);
-
-        if (uart_txsize[UART_NUMBER_3] > 0)                                     // tx buffer empty?
-        {                                                                       // no
-            ch = uart_txbuf[UART_NUMBER_3][uart_txstart++];                     // get character to send, increment offset
-
-            if (uart_txstart == UART_TXBUFLEN)                                  // at end of tx buffer?
-            {                                                                   // yes
-                uart_txstart = 0;                                               // reset to beginning
-            }
-
-            uart_txsize[UART_NUMBER_3]--;                                       // decrement size
-
-            USART_SendData(USART3, ch);
-        }
-        else
-        {
-            USART_ITConfig(USART3, USART_IT_TXE, DISABLE);                      // disable TXE interrupt
-        }
-    }
-    else
-    {
-        ;
-    }
+    uart_isr (UART_NUMBER_3, USART3);
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -932,63 +1161,7 @@ void UART4_IRQHandler (void);
 void
 UART4_IRQHandler (void)
 {
-    static uint_fast8_t     uart_rxstop  = 0;                                   // tail
-    uint16_t                value;
-    uint_fast8_t            ch;
-
-    if (USART_GetITStatus (UART4, USART_IT_RXNE) != RESET)
-    {
-        USART_ClearITPendingBit (UART4, USART_IT_RXNE);
-        value = USART_ReceiveData (UART4);
-
-        ch = value & 0xFF;
-
-        if (! uart_raw[UART_NUMBER_4] && ch == INTERRUPT_CHAR)                  // no raw mode & user pressed CTRL-C
-        {
-            uart_int[UART_NUMBER_4] = 1;
-        }
-
-        if (uart_rxsize[UART_NUMBER_4] < UART_RXBUFLEN)                         // buffer full?
-        {                                                                       // no
-            uart_rxbuf[UART_NUMBER_4][uart_rxstop++] = ch;                      // store character
-
-            if (uart_rxstop >= UART_RXBUFLEN)                                   // at end of ringbuffer?
-            {                                                                   // yes
-                uart_rxstop = 0;                                                // reset to beginning
-            }
-
-            uart_rxsize[UART_NUMBER_4]++;                                       // increment used size
-        }
-    }
-
-    if (USART_GetITStatus (UART4, USART_IT_TXE) != RESET)
-    {
-        static uint_fast8_t  uart_txstart = 0;                                  // head
-
-        USART_ClearITPendingBit (UART4, USART_IT_TXE);
-
-        if (uart_txsize[UART_NUMBER_4] > 0)                                     // tx buffer empty?
-        {                                                                       // no
-            ch = uart_txbuf[UART_NUMBER_4][uart_txstart++];                     // get character to send, increment offset
-
-            if (uart_txstart == UART_TXBUFLEN)                                  // at end of tx buffer?
-            {                                                                   // yes
-                uart_txstart = 0;                                               // reset to beginning
-            }
-
-            uart_txsize[UART_NUMBER_4]--;                                       // decrement size
-
-            USART_SendData(UART4, ch);
-        }
-        else
-        {
-            USART_ITConfig(UART4, USART_IT_TXE, DISABLE);                       // disable TXE interrupt
-        }
-    }
-    else
-    {
-        ;
-    }
+    uart_isr (UART_NUMBER_4, UART4);
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -1000,63 +1173,7 @@ void UART5_IRQHandler (void);
 void
 UART5_IRQHandler (void)
 {
-    static uint_fast8_t     uart_rxstop  = 0;                                   // tail
-    uint16_t                value;
-    uint_fast8_t            ch;
-
-    if (USART_GetITStatus (UART5, USART_IT_RXNE) != RESET)
-    {
-        USART_ClearITPendingBit (UART5, USART_IT_RXNE);
-        value = USART_ReceiveData (UART5);
-
-        ch = value & 0xFF;
-
-        if (! uart_raw[UART_NUMBER_5] && ch == INTERRUPT_CHAR)                  // no raw mode & user pressed CTRL-C
-        {
-            uart_int[UART_NUMBER_5] = 1;
-        }
-
-        if (uart_rxsize[UART_NUMBER_5] < UART_RXBUFLEN)                         // buffer full?
-        {                                                                       // no
-            uart_rxbuf[UART_NUMBER_5][uart_rxstop++] = ch;                      // store character
-
-            if (uart_rxstop >= UART_RXBUFLEN)                                   // at end of ringbuffer?
-            {                                                                   // yes
-                uart_rxstop = 0;                                                // reset to beginning
-            }
-
-            uart_rxsize[UART_NUMBER_5]++;                                       // increment used size
-        }
-    }
-
-    if (USART_GetITStatus (UART5, USART_IT_TXE) != RESET)
-    {
-        static uint_fast8_t  uart_txstart = 0;                                  // head
-
-        USART_ClearITPendingBit (UART5, USART_IT_TXE);
-
-        if (uart_txsize[UART_NUMBER_5] > 0)                                     // tx buffer empty?
-        {                                                                       // no
-            ch = uart_txbuf[UART_NUMBER_5][uart_txstart++];                     // get character to send, increment offset
-
-            if (uart_txstart == UART_TXBUFLEN)                                  // at end of tx buffer?
-            {                                                                   // yes
-                uart_txstart = 0;                                               // reset to beginning
-            }
-
-            uart_txsize[UART_NUMBER_5]--;                                       // decrement size
-
-            USART_SendData(UART5, ch);
-        }
-        else
-        {
-            USART_ITConfig(UART5, USART_IT_TXE, DISABLE);                       // disable TXE interrupt
-        }
-    }
-    else
-    {
-        ;
-    }
+    uart_isr (UART_NUMBER_5, UART5);
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -1068,61 +1185,52 @@ void USART6_IRQHandler (void);
 void
 USART6_IRQHandler (void)
 {
-    static uint_fast8_t     uart_rxstop  = 0;                                   // tail
-    uint16_t                value;
-    uint_fast8_t            ch;
-
-    if (USART_GetITStatus (USART6, USART_IT_RXNE) != RESET)
-    {
-        USART_ClearITPendingBit (USART6, USART_IT_RXNE);
-        value = USART_ReceiveData (USART6);
-
-        ch = value & 0xFF;
-
-        if (! uart_raw[UART_NUMBER_6] && ch == INTERRUPT_CHAR)                  // no raw mode & user pressed CTRL-C
-        {
-            uart_int[UART_NUMBER_6] = 1;
-        }
-
-        if (uart_rxsize[UART_NUMBER_6] < UART_RXBUFLEN)                         // buffer full?
-        {                                                                       // no
-            uart_rxbuf[UART_NUMBER_6][uart_rxstop++] = ch;                      // store character
-
-            if (uart_rxstop >= UART_RXBUFLEN)                                   // at end of ringbuffer?
-            {                                                                   // yes
-                uart_rxstop = 0;                                                // reset to beginning
-            }
+    uart_isr (UART_NUMBER_6, USART6);
+}
 
-            uart_rxsize[UART_NUMBER_6]++;                                       // increment used size
-        }
-    }
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * DMA ISRs of UART1 - UART3
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void DMA2_Stream7_IRQHandler (void);
+void DMA2_Stream2_IRQHandler (void);
+void DMA1_Stream6_IRQHandler (void);
+void DMA1_Stream5_IRQHandler (void);
+void DMA1_Stream3_IRQHandler (void);
+void DMA1_Stream1_IRQHandler (void);
 
-    if (USART_GetITStatus (USART6, USART_IT_TXE) != RESET)
-    {
-        static uint_fast8_t  uart_txstart = 0;                                  // head
+void
+DMA2_Stream7_IRQHandler (void)
+{
+    uart_dma_tx_isr (UART_NUMBER_1);
+}
 
-        USART_ClearITPendingBit (USART6, USART_IT_TXE);
+void
+DMA2_Stream2_IRQHandler (void)
+{
+    uart_dma_rx_isr (UART_NUMBER_1);
+}
 
-        if (uart_txsize[UART_NUMBER_6] > 0)                                     // tx buffer empty?
-        {                                                                       // no
-            ch = uart_txbuf[UART_NUMBER_6][uart_txstart++];                     // get character to send, increment offset
+void
+DMA1_Stream6_IRQHandler (void)
+{
+    uart_dma_tx_isr (UART_NUMBER_2);
+}
 
-            if (uart_txstart == UART_TXBUFLEN)                                  // at end of tx buffer?
-            {                                                                   // yes
-                uart_txstart = 0;                                               // reset to beginning
-            }
+void
+DMA1_Stream5_IRQHandler (void)
+{
+    uart_dma_rx_isr (UART_NUMBER_2);
+}
 
-            uart_txsize[UART_NUMBER_6]--;                                       // decrement size
+void
+DMA1_Stream3_IRQHandler (void)
+{
+    uart_dma_tx_isr (UART_NUMBER_3);
+}
 
-            USART_SendData(USART6, ch);
-        }
-        else
-        {
-            USART_ITConfig(USART6, USART_IT_TXE, DISABLE);                      // disable TXE interrupt
-        }
-    }
-    else
-    {
-        ;
-    }
+void
+DMA1_Stream1_IRQHandler (void)
+{
+    uart_dma_rx_isr (UART_NUMBER_3);
 }
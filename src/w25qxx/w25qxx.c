@@ -32,7 +32,11 @@
  *---------------------------------------------------------------------------------------------------------------------------------------------------
  */
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "w25qxx.h"
+
+#ifndef unix
 #include "io.h"
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -79,8 +83,20 @@
 #define W25QXX_BUFLEN                  (256 + 256)
 
 static volatile uint32_t                w25qxx_dma_status;                              // DMA status
+static volatile uint_fast8_t            w25qxx_dma_release_cs;                          // 1: set /CS to High when transfer is complete
 static volatile uint8_t                 w25qxx_in[W25QXX_BUFLEN];                       // 16bit DMA buffer, must be aligned to 16 bit
 static volatile uint8_t                 w25qxx_out[W25QXX_BUFLEN];                      // 16bit DMA buffer, must be aligned to 16 bit
+static volatile uint8_t                 w25qxx_dummy = 0xFF;                            // TX source while reading data
+
+#define W25QXX_CMD_WRITE_ENABLE         0x06
+#define W25QXX_CMD_PAGE_PROGRAM         0x02
+#define W25QXX_CMD_FAST_READ            0x0B
+#define W25QXX_CMD_SECTOR_ERASE         0x20                                            // 4 KiB
+#define W25QXX_CMD_BLOCK_ERASE          0xD8                                            // 64 KiB
+#define W25QXX_CMD_JEDEC_ID             0x9F
+#define W25QXX_SR1_BUSY                 0x01
+
+#define W25QXX_DMA_MAX_XFER             65535                                           // max. value of DMA NDTR
 
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -88,7 +104,7 @@ static volatile uint8_t                 w25qxx_out[W25QXX_BUFLEN];
  *---------------------------------------------------------------------------------------------------------------------------------------------------
  */
 static void
-w25qxx_dma_init (void)
+w25qxx_dma_init (volatile uint8_t * out, uint_fast8_t out_inc, volatile uint8_t * in, int buffersize)
 {
     DMA_InitTypeDef dma;
 
@@ -103,7 +119,7 @@ w25qxx_dma_init (void)
     dma.DMA_PeripheralBaseAddr  = (uint32_t)&W25QXX_SPI_DEVICE->DR;         // base addr of periph
     dma.DMA_PeripheralDataSize  = DMA_PeripheralDataSize_Byte;              // use 8 bit, 16 bit: DMA_PeripheralDataSize_HalfWord
     dma.DMA_MemoryDataSize      = DMA_MemoryDataSize_Byte;                  // use 8 bit, 16 bit: DMA_MemoryDataSize_HalfWord
-    dma.DMA_BufferSize          = W25QXX_BUFLEN;                            // buffer size
+    dma.DMA_BufferSize          = buffersize;                               // buffer size
     dma.DMA_PeripheralInc       = DMA_PeripheralInc_Disable;                // disable periph inc
     dma.DMA_MemoryInc           = DMA_MemoryInc_Enable;                     // enable memory inc
     dma.DMA_Priority            = DMA_Priority_High;                        // or DMA_Priority_VeryHigh;
@@ -115,22 +131,28 @@ w25qxx_dma_init (void)
     // DMA TX
     dma.DMA_DIR                 = DMA_DIR_MemoryToPeripheral;
     dma.DMA_Channel             = W25QXX_DMA_CHANNEL;
-    dma.DMA_Memory0BaseAddr     = (uint32_t) w25qxx_out;
+    dma.DMA_Memory0BaseAddr     = (uint32_t) out;
+    dma.DMA_MemoryInc           = out_inc ? DMA_MemoryInc_Enable : DMA_MemoryInc_Disable;
     DMA_Init(W25QXX_DMA_TX_STREAM, &dma);
 
     // DMA RX
     dma.DMA_DIR                 = DMA_DIR_PeripheralToMemory;
     dma.DMA_Channel             = W25QXX_DMA_CHANNEL;
-    dma.DMA_Memory0BaseAddr     = (uint32_t) w25qxx_in;
+    dma.DMA_Memory0BaseAddr     = (uint32_t) in;
+    dma.DMA_MemoryInc           = DMA_MemoryInc_Enable;
     DMA_Init(W25QXX_DMA_RX_STREAM, &dma);
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
  * start DMA (stopped when Transfer-Complete-Interrupt arrives)
+ *
+ * out:         TX data, if out_inc is 0 the same byte is sent buffersize times
+ * in:          RX buffer, must not be located in CCM RAM
+ * release_cs:  0: keep /CS Low after transfer, next transfer continues the same command
  *---------------------------------------------------------------------------------------------------------------------------------------------------
  */
 static void
-w25qxx_dma_start (int buffersize)
+w25qxx_dma_xfer (volatile uint8_t * out, uint_fast8_t out_inc, volatile uint8_t * in, int buffersize, uint_fast8_t release_cs)
 {
     while (w25qxx_dma_status != 0)
     {
@@ -138,23 +160,32 @@ w25qxx_dma_start (int buffersize)
     }
 
     w25qxx_dma_status = 1;                                                          // set status to "busy"
+    w25qxx_dma_release_cs = release_cs;
 
-#if 1
-    w25qxx_dma_init ();                                                             // TODO!
-#else
     DMA_Cmd (W25QXX_DMA_TX_STREAM, DISABLE);                                        // disable DMA TX
     DMA_Cmd (W25QXX_DMA_RX_STREAM, DISABLE);                                        // disable DMA RX
-    DMA_DeInit(W25QXX_DMA_TX_STREAM);
-    DMA_DeInit(W25QXX_DMA_RX_STREAM);
-#endif
+    w25qxx_dma_init (out, out_inc, in, buffersize);                                 // set addresses, increment modes and size
 
-    DMA_SetCurrDataCounter(W25QXX_DMA_TX_STREAM, buffersize);                       // set new buffer size for TX
-    DMA_SetCurrDataCounter(W25QXX_DMA_RX_STREAM, buffersize);                       // set new buffer size for RX
     DMA_ITConfig(W25QXX_DMA_RX_STREAM, DMA_IT_TC, ENABLE);                          // enable transfer complete interrupt (only for RX)
     GPIO_RESET_BIT(W25QXX_GPIO_PORT, W25QXX_GPIO_CS_PIN);                           // set /CS to Low
 
-    DMA_Cmd(W25QXX_DMA_TX_STREAM, ENABLE);                                          // DMA enable TX
     DMA_Cmd(W25QXX_DMA_RX_STREAM, ENABLE);                                          // DMA enable RX
+    DMA_Cmd(W25QXX_DMA_TX_STREAM, ENABLE);                                          // DMA enable TX
+}
+
+static void
+w25qxx_dma_start (int buffersize)
+{
+    w25qxx_dma_xfer (w25qxx_out, 1, w25qxx_in, buffersize, 1);
+}
+
+static void
+w25qxx_dma_wait (void)
+{
+    while (w25qxx_dma_status != 0)
+    {
+        ;
+    }
 }
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -169,7 +200,11 @@ W25QXX_DMA_RX_ISR (void)
     {
         DMA_ClearITPendingBit (W25QXX_DMA_RX_STREAM, W25QXX_DMA_RX_IRQ_FLAG);       // reset flag
         w25qxx_dma_status = 0;                                                      // set status to ready
-        GPIO_SET_BIT(W25QXX_GPIO_PORT, W25QXX_GPIO_CS_PIN);                         // set /CS to High
+
+        if (w25qxx_dma_release_cs)
+        {
+            GPIO_SET_BIT(W25QXX_GPIO_PORT, W25QXX_GPIO_CS_PIN);                     // set /CS to High
+        }
     }
 }
 
@@ -287,6 +322,141 @@ w25qxx_unique_id (void)
     return unique_id;
 }
 
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * read capacity in bytes from JEDEC id, 0 if unknown
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint32_t
+w25qxx_capacity (void)
+{
+    static uint32_t capacity;
+
+    if (capacity == 0)
+    {
+        w25qxx_out[0] = W25QXX_CMD_JEDEC_ID;
+        w25qxx_out[1] = 0x00;
+        w25qxx_out[2] = 0x00;
+        w25qxx_out[3] = 0x00;
+
+        w25qxx_dma_start(4);
+        w25qxx_dma_wait ();
+
+        if (w25qxx_in[3] >= 0x11 && w25qxx_in[3] <= 0x19)                           // 128 KiB (W25Q10) ... 32 MiB (W25Q256)
+        {
+            capacity = 1UL << w25qxx_in[3];
+        }
+    }
+
+    return capacity;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: wait until program or erase has finished
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+w25qxx_wait_ready (void)
+{
+    while (w25qxx_statusreg1 () & W25QXX_SR1_BUSY)
+    {
+        ;
+    }
+
+    return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: send command with 24 bit address
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+w25qxx_set_cmd (uint_fast8_t cmd, uint32_t addr)
+{
+    w25qxx_out[0] = cmd;
+    w25qxx_out[1] = (addr >> 16) & 0xFF;
+    w25qxx_out[2] = (addr >>  8) & 0xFF;
+    w25qxx_out[3] = addr & 0xFF;
+}
+
+static void
+w25qxx_write_enable (void)
+{
+    w25qxx_out[0] = W25QXX_CMD_WRITE_ENABLE;
+    w25qxx_dma_start(1);
+    w25qxx_dma_wait ();
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * fast read: command and address are sent from the DMA buffer, then data goes directly into buf, /CS stays Low in between
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+int
+w25qxx_read (uint32_t addr, uint8_t * buf, uint32_t len)
+{
+    uint32_t    n;
+
+    if (len == 0)
+    {
+        return 0;
+    }
+
+    w25qxx_set_cmd (W25QXX_CMD_FAST_READ, addr);
+    w25qxx_out[4] = 0x00;                                                           // dummy byte
+    w25qxx_dma_xfer (w25qxx_out, 1, w25qxx_in, 5, 0);
+
+    while (len > 0)
+    {
+        n = (len > W25QXX_DMA_MAX_XFER) ? W25QXX_DMA_MAX_XFER : len;
+        len -= n;
+        w25qxx_dma_xfer (&w25qxx_dummy, 0, buf, n, len == 0);
+        buf += n;
+    }
+
+    w25qxx_dma_wait ();
+    return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: program up to one page, must not cross a page boundary
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+w25qxx_page_program (uint32_t addr, const uint8_t * buf, uint32_t len)
+{
+    w25qxx_write_enable ();
+    w25qxx_set_cmd (W25QXX_CMD_PAGE_PROGRAM, addr);
+    memcpy ((uint8_t *) w25qxx_out + 4, buf, len);
+    w25qxx_dma_start(4 + len);
+    w25qxx_dma_wait ();
+    return w25qxx_wait_ready ();
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: erase sector or block
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+w25qxx_erase (uint_fast8_t cmd, uint32_t addr)
+{
+    w25qxx_write_enable ();
+    w25qxx_set_cmd (cmd, addr);
+    w25qxx_dma_start(4);
+    w25qxx_dma_wait ();
+    return w25qxx_wait_ready ();
+}
+
+int
+w25qxx_sector_erase (uint32_t addr)
+{
+    return w25qxx_erase (W25QXX_CMD_SECTOR_ERASE, addr);
+}
+
+int
+w25qxx_block_erase (uint32_t addr)
+{
+    return w25qxx_erase (W25QXX_CMD_BLOCK_ERASE, addr);
+}
+
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
  * initialize W25QXX
  *---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -367,5 +537,231 @@ w25qxx_init (void)
      * initialize DMA
      *---------------------------------------------------------------------------------------------------------------------------------------------------
      */
-    w25qxx_dma_init ();
+    w25qxx_dma_init (w25qxx_out, 1, w25qxx_in, W25QXX_BUFLEN);
+}
+
+#else // unix
+
+W25QXX_SIM                              w25qxx_sim = { W25QXX_SIM_CAPACITY, -1, 0, 0, 0, 0, 0, 0, 0 };
+static uint8_t *                        w25qxx_sim_mem;
+static uint32_t *                       w25qxx_sim_erase_cnt;
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: number of bytes the current program/erase may change before power is lost, see w25qxx_sim.fail_after
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static uint32_t
+w25qxx_sim_budget (uint32_t len)
+{
+    if (w25qxx_sim.fail_after < 0)
+    {
+        return len;
+    }
+
+    if (w25qxx_sim.fail_after == 0)                                                 // power already lost
+    {
+        return 0;
+    }
+
+    if (--w25qxx_sim.fail_after == 0)                                               // power lost during this operation
+    {
+        return len / 2;
+    }
+
+    return len;
+}
+
+uint_fast8_t
+w25qxx_device_id (void)
+{
+    return 0x14;                                                                    // W25Q16
+}
+
+uint_fast8_t
+w25qxx_statusreg1 (void)
+{
+    return 0x00;
+}
+
+uint_fast8_t
+w25qxx_statusreg2 (void)
+{
+    return 0x00;
+}
+
+char *
+w25qxx_unique_id (void)
+{
+    return "0000000000000000";
+}
+
+uint32_t
+w25qxx_capacity (void)
+{
+    return w25qxx_sim.capacity;
+}
+
+int
+w25qxx_read (uint32_t addr, uint8_t * buf, uint32_t len)
+{
+    if (! w25qxx_sim_mem || addr + len > w25qxx_sim.capacity)
+    {
+        return -1;
+    }
+
+    memcpy (buf, w25qxx_sim_mem + addr, len);
+    w25qxx_sim.reads++;
+    w25qxx_sim.bytes_read += len;
+    w25qxx_sim.busy_usec += ((5 + len) * 1000) / W25QXX_SIM_BYTES_PER_MS;
+    return 0;
+}
+
+static int
+w25qxx_page_program (uint32_t addr, const uint8_t * buf, uint32_t len)
+{
+    uint8_t *   p;
+    uint32_t    n;
+    uint32_t    idx;
+
+    if (! w25qxx_sim_mem || addr + len > w25qxx_sim.capacity)
+    {
+        return -1;
+    }
+
+    p = w25qxx_sim_mem + addr;
+    n = w25qxx_sim_budget (len);
+
+    for (idx = 0; idx < n; idx++)
+    {
+        if ((p[idx] & buf[idx]) != buf[idx])
+        {
+            w25qxx_sim.violations++;
+            break;
+        }
+    }
+
+    for (idx = 0; idx < n; idx++)
+    {
+        p[idx] &= buf[idx];                                                         // NOR: bits can only go from 1 to 0
+    }
+
+    w25qxx_sim.programs++;
+    w25qxx_sim.bytes_programmed += n;
+    w25qxx_sim.busy_usec += W25QXX_SIM_PROGRAM_USEC;
+    return (n == len) ? 0 : -1;
+}
+
+static int
+w25qxx_erase (uint32_t addr, uint32_t size)
+{
+    uint32_t    n;
+    uint32_t    idx;
+
+    addr &= ~(size - 1);
+
+    if (! w25qxx_sim_mem || addr + size > w25qxx_sim.capacity)
+    {
+        return -1;
+    }
+
+    n = w25qxx_sim_budget (size);
+    memset (w25qxx_sim_mem + addr, 0xFF, n);
+
+    for (idx = addr; idx < addr + size; idx += W25QXX_SECTOR_SIZE)
+    {
+        w25qxx_sim_erase_cnt[idx / W25QXX_SECTOR_SIZE]++;
+    }
+
+    w25qxx_sim.erases++;
+    w25qxx_sim.busy_usec += W25QXX_SIM_ERASE_USEC;
+    return (n == size) ? 0 : -1;
+}
+
+int
+w25qxx_sector_erase (uint32_t addr)
+{
+    return w25qxx_erase (addr, W25QXX_SECTOR_SIZE);
+}
+
+int
+w25qxx_block_erase (uint32_t addr)
+{
+    return w25qxx_erase (addr, W25QXX_BLOCK_SIZE);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * min/max erase count of all sectors
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+w25qxx_sim_wear (uint32_t * min, uint32_t * max)
+{
+    uint32_t    idx;
+
+    *min = 0xFFFFFFFF;
+    *max = 0;
+
+    for (idx = 0; w25qxx_sim_erase_cnt && idx < w25qxx_sim.capacity / W25QXX_SECTOR_SIZE; idx++)
+    {
+        if (*min > w25qxx_sim_erase_cnt[idx])
+        {
+            *min = w25qxx_sim_erase_cnt[idx];
+        }
+        if (*max < w25qxx_sim_erase_cnt[idx])
+        {
+            *max = w25qxx_sim_erase_cnt[idx];
+        }
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * initialize simulated W25QXX: a new device is completely erased, contents survive further calls
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+w25qxx_init (void)
+{
+    if (! w25qxx_sim_mem)
+    {
+        w25qxx_sim_mem          = malloc (w25qxx_sim.capacity);
+        w25qxx_sim_erase_cnt    = calloc (w25qxx_sim.capacity / W25QXX_SECTOR_SIZE, sizeof (uint32_t));
+
+        if (w25qxx_sim_mem)
+        {
+            memset (w25qxx_sim_mem, 0xFF, w25qxx_sim.capacity);
+        }
+    }
+}
+
+#endif // unix
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * program any number of bytes, split into page programs. Bits can only be cleared, erase first!
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+int
+w25qxx_write (uint32_t addr, const uint8_t * buf, uint32_t len)
+{
+    uint32_t    n;
+
+    while (len > 0)
+    {
+        n = W25QXX_PAGE_SIZE - (addr % W25QXX_PAGE_SIZE);
+
+        if (n > len)
+        {
+            n = len;
+        }
+
+        if (w25qxx_page_program (addr, buf, n) != 0)
+        {
+            return -1;
+        }
+
+        addr    += n;
+        buf     += n;
+        len     -= n;
+    }
+
+    return 0;
 }
@@ -27,6 +27,9 @@
 #ifndef W25QXX_H
 #define W25QXX_H
 
+#include <stdint.h>
+
+#ifndef unix
 #include "stm32f4xx.h"
 #include "stm32f4xx_gpio.h"
 #include "stm32f4xx_rcc.h"
@@ -34,6 +37,11 @@
 #include "stm32f4xx_dma.h"
 
 #include "misc.h"
+#endif
+
+#define W25QXX_PAGE_SIZE        256                                             // program granularity
+#define W25QXX_SECTOR_SIZE      4096                                            // smallest erase unit
+#define W25QXX_BLOCK_SIZE       65536                                           // large erase unit
 
 /*---------------------------------------------------------------------------------------------------------------------------------------------------
  * W25QXX interface definition
@@ -44,5 +52,37 @@ extern uint_fast8_t     w25qxx_device_id (void);
 extern uint_fast8_t     w25qxx_statusreg1 (void);
 extern uint_fast8_t     w25qxx_statusreg2 (void);
 extern char *           w25qxx_unique_id (void);
+extern uint32_t         w25qxx_capacity (void);
+extern int              w25qxx_read (uint32_t, uint8_t *, uint32_t);
+extern int              w25qxx_write (uint32_t, const uint8_t *, uint32_t);
+extern int              w25qxx_sector_erase (uint32_t);
+extern int              w25qxx_block_erase (uint32_t);
+
+#ifdef unix
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * simulated NOR device for host builds: programming can only clear bits, erase sets a whole sector to 0xFF
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#define W25QXX_SIM_CAPACITY     (2 * 1024 * 1024)                               // W25Q16 as on the STM32F407VET6 black board
+#define W25QXX_SIM_PROGRAM_USEC 700                                             // typical page program time
+#define W25QXX_SIM_ERASE_USEC   45000                                           // typical sector erase time
+#define W25QXX_SIM_BYTES_PER_MS 5250                                            // SPI at 42 MHz
+
+typedef struct
+{
+    uint32_t        capacity;                                                   // size of device, set before w25qxx_init()
+    long            fail_after;                                                 // simulate power fail at n-th program/erase, -1: never
+    unsigned long   reads;                                                      // counters
+    unsigned long   bytes_read;
+    unsigned long   programs;
+    unsigned long   bytes_programmed;
+    unsigned long   erases;
+    unsigned long   violations;                                                 // programs which tried to turn a 0 bit into 1
+    unsigned long   busy_usec;                                                  // simulated device time
+} W25QXX_SIM;
+
+extern W25QXX_SIM       w25qxx_sim;
+extern void             w25qxx_sim_wear (uint32_t *, uint32_t *);
+#endif
 
 #endif
@@ -0,0 +1,638 @@
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * w25qxx_ftl.c - flash translation layer for W25QXX: 512 byte sectors with wear levelling
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ * Layout of each 4 KiB erase block:
+ *
+ *   0x000  header     magic, erase count, check
+ *   0x010  7 tags     logical sector, sequence number, check - one per data slot
+ *   0x100  7 slots    512 bytes each
+ *
+ * Sectors are never overwritten in place. A write goes to the next free slot of the current block: data first, then the tag.
+ * A tag is only valid if its check matches, so a sector interrupted by power loss is simply not there and the older copy
+ * stays in effect. On mount all tags are scanned, the copy with the highest sequence number wins.
+ *
+ * Garbage collection copies the live slots of the block with the fewest live slots and erases it at once, the free block
+ * with the lowest erase count is used first. Every FTL_WL_INTERVAL erases the coldest block is collected if its erase count
+ * lags too far behind (static wear levelling).
+ *
+ * An interrupted erase can leave a block that looks clean, so after mount every block without live tags is erased again
+ * before it is reused. Slots after the last written tag of a block are not reused either.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ * MIT License
+ *
+ * Copyright (c) 2018-2021 Frank Meyer - frank(at)fli4l.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "w25qxx.h"
+#include "w25qxx_ftl.h"
+
+#define FTL_BLOCK_SIZE          W25QXX_SECTOR_SIZE                              // erase unit
+#define FTL_SLOTS               7                                               // data slots per block
+#define FTL_TAG_OFFSET          16                                              // tags follow the block header
+#define FTL_DATA_OFFSET         W25QXX_PAGE_SIZE                                // data slots start at 2nd page
+#define FTL_SPARE_MIN           4                                               // min. number of spare blocks
+#define FTL_GC_RESERVE          1                                               // free blocks kept for garbage collection
+#define FTL_WL_INTERVAL         32                                              // check static wear levelling every n erases
+#define FTL_WL_THRESHOLD        64                                              // move cold data if erase counts differ more
+
+#define FTL_MAGIC               0x314C5446                                      // "FTL1"
+#define FTL_TAG_CHECK           0x5AA5C33C
+#define FTL_UNMAPPED            0xFFFF
+#define FTL_NO_BLOCK            0xFFFFFFFF
+
+#define FTL_BLK_DIRTY           0                                               // must be erased before use
+#define FTL_BLK_FREE            1                                               // erased, header written
+#define FTL_BLK_USED            2                                               // contains tags
+
+#define FTL_BLOCK_ADDR(b)       ((b) * FTL_BLOCK_SIZE)
+#define FTL_TAG_ADDR(p)         (FTL_BLOCK_ADDR((p) / FTL_SLOTS) + FTL_TAG_OFFSET + ((p) % FTL_SLOTS) * sizeof (FTL_TAG))
+#define FTL_DATA_ADDR(p)        (FTL_BLOCK_ADDR((p) / FTL_SLOTS) + FTL_DATA_OFFSET + ((p) % FTL_SLOTS) * W25QXX_FTL_SECTOR_SIZE)
+
+typedef struct
+{
+    uint32_t    magic;
+    uint32_t    erase_count;
+    uint32_t    check;                                                          // ~erase_count
+    uint32_t    reserved;
+} FTL_HEADER;
+
+typedef struct
+{
+    uint32_t    lsn;                                                            // logical sector number
+    uint32_t    seq;                                                            // sequence number, highest wins
+    uint32_t    check;                                                          // lsn ^ seq ^ FTL_TAG_CHECK
+    uint32_t    reserved;
+} FTL_TAG;
+
+typedef struct
+{
+    FTL_HEADER  hdr;
+    FTL_TAG     tag[FTL_SLOTS];
+} FTL_META;
+
+static uint16_t *           ftl_map;                                            // logical sector -> slot (block * FTL_SLOTS + slot)
+static uint32_t *           ftl_erase_cnt;                                      // erase count per block
+static uint8_t *            ftl_valid;                                          // live slots per block
+static uint8_t *            ftl_state;                                          // FTL_BLK_xxx per block
+
+static uint32_t             ftl_blocks;
+static uint32_t             ftl_sectors;                                        // 0: not mounted
+static uint32_t             ftl_free_blocks;                                    // dirty or free blocks
+static uint32_t             ftl_seq;                                            // last used sequence number
+static uint32_t             ftl_cur_block = FTL_NO_BLOCK;                       // block being filled
+static uint32_t             ftl_cur_slot;                                       // next slot in ftl_cur_block
+static uint32_t             ftl_wl_count;                                       // erases since last wear levelling check
+
+static W25QXX_FTL_STATS     ftl_stats;
+static FTL_META             ftl_meta;                                           // DMA buffer, must not be in CCM RAM
+static uint32_t             ftl_buf[W25QXX_FTL_SECTOR_SIZE / sizeof (uint32_t)];    // DMA buffer for garbage collection
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: check tag
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+ftl_tag_valid (const FTL_TAG * tag)
+{
+    return tag->check == (tag->lsn ^ tag->seq ^ FTL_TAG_CHECK) && tag->lsn < ftl_sectors;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: point logical sector to new slot
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static void
+ftl_remap (uint32_t lsn, uint32_t phys)
+{
+    uint32_t    old = ftl_map[lsn];
+
+    if (old != FTL_UNMAPPED)
+    {
+        ftl_valid[old / FTL_SLOTS]--;
+    }
+
+    if (phys != FTL_UNMAPPED)
+    {
+        ftl_valid[phys / FTL_SLOTS]++;
+    }
+
+    ftl_map[lsn] = phys;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: erase block and write header
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+ftl_erase_block (uint32_t block)
+{
+    FTL_HEADER  hdr;
+
+    ftl_state[block] = FTL_BLK_DIRTY;
+
+    if (w25qxx_sector_erase (FTL_BLOCK_ADDR(block)) != 0)
+    {
+        return -1;
+    }
+
+    ftl_erase_cnt[block]++;
+    ftl_stats.erases++;
+    ftl_wl_count++;
+
+    hdr.magic       = FTL_MAGIC;
+    hdr.erase_count = ftl_erase_cnt[block];
+    hdr.check       = ~ftl_erase_cnt[block];
+    hdr.reserved    = 0xFFFFFFFF;
+
+    if (w25qxx_write (FTL_BLOCK_ADDR(block), (uint8_t *) &hdr, sizeof (hdr)) != 0)
+    {
+        return -1;
+    }
+
+    ftl_state[block] = FTL_BLK_FREE;
+    return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: make the free block with the lowest erase count the current block
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+ftl_take_block (void)
+{
+    uint32_t    best = FTL_NO_BLOCK;
+    uint32_t    block;
+
+    for (block = 0; block < ftl_blocks; block++)
+    {
+        if (ftl_state[block] != FTL_BLK_USED && (best == FTL_NO_BLOCK || ftl_erase_cnt[block] < ftl_erase_cnt[best]))
+        {
+            best = block;
+        }
+    }
+
+    if (best == FTL_NO_BLOCK)
+    {
+        return -1;
+    }
+
+    if (ftl_state[best] == FTL_BLK_DIRTY && ftl_erase_block (best) != 0)
+    {
+        return -1;
+    }
+
+    ftl_state[best] = FTL_BLK_USED;
+    ftl_free_blocks--;
+    ftl_cur_block   = best;
+    ftl_cur_slot    = 0;
+    return 0;
+}
+
+static int  ftl_gc (void);
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: write count consecutive sectors into the current block(s)
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+ftl_program (const uint8_t * buf, uint32_t lsn, uint32_t count, uint_fast8_t in_gc)
+{
+    FTL_TAG     tags[FTL_SLOTS];
+    uint32_t    phys;
+    uint32_t    n;
+    uint32_t    idx;
+
+    while (count > 0)
+    {
+        if (ftl_cur_block == FTL_NO_BLOCK || ftl_cur_slot == FTL_SLOTS)
+        {
+            while (! in_gc && ftl_free_blocks <= FTL_GC_RESERVE)
+            {
+                if (ftl_gc () != 0)
+                {
+                    return -1;
+                }
+            }
+
+            if (ftl_take_block () != 0)
+            {
+                return -1;
+            }
+        }
+
+        n = FTL_SLOTS - ftl_cur_slot;
+
+        if (n > count)
+        {
+            n = count;
+        }
+
+        phys = ftl_cur_block * FTL_SLOTS + ftl_cur_slot;
+        ftl_cur_slot += n;                                                      // slots are used even if programming fails
+
+        for (idx = 0; idx < n; idx++)
+        {
+            tags[idx].lsn       = lsn + idx;
+            tags[idx].seq       = ++ftl_seq;
+            tags[idx].check     = tags[idx].lsn ^ tags[idx].seq ^ FTL_TAG_CHECK;
+            tags[idx].reserved  = 0xFFFFFFFF;
+        }
+
+        if (w25qxx_write (FTL_DATA_ADDR(phys), buf, n * W25QXX_FTL_SECTOR_SIZE) != 0 ||
+            w25qxx_write (FTL_TAG_ADDR(phys), (uint8_t *) tags, n * sizeof (FTL_TAG)) != 0)
+        {
+            return -1;
+        }
+
+        for (idx = 0; idx < n; idx++)
+        {
+            ftl_remap (lsn + idx, phys + idx);
+        }
+
+        ftl_stats.flash_writes += n;
+        buf     += n * W25QXX_FTL_SECTOR_SIZE;
+        lsn     += n;
+        count   -= n;
+    }
+
+    return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * INTERN: garbage collection - move live slots of one block and mark it dirty
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+static int
+ftl_gc (void)
+{
+    uint32_t    victim = FTL_NO_BLOCK;
+    uint32_t    block;
+    uint32_t    phys;
+    uint32_t    slot;
+
+    if (ftl_wl_count >= FTL_WL_INTERVAL)
+    {
+        uint32_t    erase_max = 0;
+
+        ftl_wl_count = 0;
+
+        for (block = 0; block < ftl_blocks; block++)
+        {
+            if (erase_max < ftl_erase_cnt[block])
+            {
+                erase_max = ftl_erase_cnt[block];
+            }
+
+            if (ftl_state[block] == FTL_BLK_USED && block != ftl_cur_block &&
+                (victim == FTL_NO_BLOCK || ftl_erase_cnt[block] < ftl_erase_cnt[victim]))
+            {
+                victim = block;
+            }
+        }
+
+        if (victim != FTL_NO_BLOCK && erase_max - ftl_erase_cnt[victim] <= FTL_WL_THRESHOLD)
+        {
+            victim = FTL_NO_BLOCK;
+        }
+    }
+
+    if (victim == FTL_NO_BLOCK)
+    {
+        for (block = 0; block < ftl_blocks; block++)
+        {
+            if (ftl_state[block] == FTL_BLK_USED && block != ftl_cur_block && ftl_valid[block] < FTL_SLOTS &&
+                (victim == FTL_NO_BLOCK || ftl_valid[block] < ftl_valid[victim] ||
+                 (ftl_valid[block] == ftl_valid[victim] && ftl_erase_cnt[block] < ftl_erase_cnt[victim])))
+            {
+                victim = block;
+            }
+        }
+
+        if (victim == FTL_NO_BLOCK)
+        {
+            return -1;                                                          // no space left
+        }
+    }
+
+    if (ftl_valid[victim] > 0)
+    {
+        if (w25qxx_read (FTL_BLOCK_ADDR(victim), (uint8_t *) &ftl_meta, sizeof (ftl_meta)) != 0)
+        {
+            return -1;
+        }
+
+        for (slot = 0; slot < FTL_SLOTS; slot++)
+        {
+            FTL_TAG * tag = &ftl_meta.tag[slot];
+
+            phys = victim * FTL_SLOTS + slot;
+
+            if (ftl_tag_valid (tag) && ftl_map[tag->lsn] == phys)
+            {
+                if (w25qxx_read (FTL_DATA_ADDR(phys), (uint8_t *) ftl_buf, W25QXX_FTL_SECTOR_SIZE) != 0 ||
+                    ftl_program ((uint8_t *) ftl_buf, tag->lsn, 1, 1) != 0)
+                {
+                    return -1;
+                }
+            }
+        }
+    }
+
+    ftl_free_blocks++;
+    return ftl_erase_block (victim);                                            // erase now, see w25qxx_ftl_trim()
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * w25qxx_ftl_umount () - free mapping tables
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+w25qxx_ftl_umount (void)
+{
+    free (ftl_map);
+    free (ftl_erase_cnt);
+    free (ftl_valid);
+    free (ftl_state);
+
+    ftl_map         = (uint16_t *) NULL;
+    ftl_erase_cnt   = (uint32_t *) NULL;
+    ftl_valid       = (uint8_t *) NULL;
+    ftl_state       = (uint8_t *) NULL;
+    ftl_sectors     = 0;
+    ftl_blocks      = 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * w25qxx_ftl_mount () - scan flash and build mapping tables, returns 0 on success, -1 on error
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+int
+w25qxx_ftl_mount (void)
+{
+    uint32_t *  seq;                                                            // sequence number of mapped slot, only while scanning
+    uint32_t    erase_max = 0;
+    uint32_t    spare;
+    uint32_t    block;
+    uint32_t    slot;
+    uint32_t    lsn;
+    uint_fast8_t live;
+
+    w25qxx_ftl_umount ();
+
+    ftl_blocks = w25qxx_capacity () / FTL_BLOCK_SIZE;
+
+    if (ftl_blocks < 2 * FTL_SPARE_MIN || ftl_blocks * FTL_SLOTS >= FTL_UNMAPPED)
+    {
+        ftl_blocks = 0;
+        return -1;
+    }
+
+    spare = ftl_blocks / 8;                                                     // over-provisioning keeps garbage collection cheap
+
+    if (spare < FTL_SPARE_MIN)
+    {
+        spare = FTL_SPARE_MIN;
+    }
+
+    ftl_sectors     = (ftl_blocks - spare) * FTL_SLOTS;
+    ftl_map         = malloc (ftl_sectors * sizeof (uint16_t));
+    ftl_erase_cnt   = malloc (ftl_blocks * sizeof (uint32_t));
+    ftl_valid       = calloc (ftl_blocks, sizeof (uint8_t));
+    ftl_state       = malloc (ftl_blocks * sizeof (uint8_t));
+    seq             = malloc (ftl_sectors * sizeof (uint32_t));
+
+    if (! ftl_map || ! ftl_erase_cnt || ! ftl_valid || ! ftl_state || ! seq)
+    {
+        free (seq);
+        w25qxx_ftl_umount ();
+        return -1;
+    }
+
+    memset (ftl_map, 0xFF, ftl_sectors * sizeof (uint16_t));                    // FTL_UNMAPPED
+    ftl_seq         = 0;
+    ftl_free_blocks = 0;
+    ftl_cur_block   = FTL_NO_BLOCK;
+    ftl_wl_count    = 0;
+    memset (&ftl_stats, 0, sizeof (ftl_stats));
+
+    for (block = 0; block < ftl_blocks; block++)
+    {
+        if (w25qxx_read (FTL_BLOCK_ADDR(block), (uint8_t *) &ftl_meta, sizeof (ftl_meta)) != 0)
+        {
+            free (seq);
+            w25qxx_ftl_umount ();
+            return -1;
+        }
+
+        if (ftl_meta.hdr.magic == FTL_MAGIC && ftl_meta.hdr.check == ~ftl_meta.hdr.erase_count)
+        {
+            ftl_erase_cnt[block] = ftl_meta.hdr.erase_count;
+
+            if (erase_max < ftl_erase_cnt[block])
+            {
+                erase_max = ftl_erase_cnt[block];
+            }
+        }
+        else
+        {
+            ftl_erase_cnt[block] = FTL_NO_BLOCK;                                // unknown, fixed below
+        }
+
+        live = 0;
+
+        for (slot = 0; slot < FTL_SLOTS; slot++)
+        {
+            FTL_TAG * tag = &ftl_meta.tag[slot];
+
+            if (ftl_tag_valid (tag))
+            {
+                live = 1;
+
+                if (ftl_map[tag->lsn] == FTL_UNMAPPED || seq[tag->lsn] < tag->seq)
+                {
+                    ftl_map[tag->lsn]   = block * FTL_SLOTS + slot;
+                    seq[tag->lsn]       = tag->seq;
+                }
+
+                if (ftl_seq < tag->seq)
+                {
+                    ftl_seq = tag->seq;
+                }
+            }
+        }
+
+        if (live)
+        {
+            ftl_state[block] = FTL_BLK_USED;
+        }
+        else
+        {
+            ftl_state[block] = FTL_BLK_DIRTY;
+            ftl_free_blocks++;
+        }
+    }
+
+    free (seq);
+
+    for (block = 0; block < ftl_blocks; block++)
+    {
+        if (ftl_erase_cnt[block] == FTL_NO_BLOCK)
+        {
+            ftl_erase_cnt[block] = erase_max;
+        }
+    }
+
+    for (lsn = 0; lsn < ftl_sectors; lsn++)
+    {
+        if (ftl_map[lsn] != FTL_UNMAPPED)
+        {
+            ftl_valid[ftl_map[lsn] / FTL_SLOTS]++;
+        }
+    }
+
+    return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * w25qxx_ftl_sectors () - number of logical sectors, 0 if not mounted
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+uint32_t
+w25qxx_ftl_sectors (void)
+{
+    return ftl_sectors;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * w25qxx_ftl_read () - read sectors, consecutive slots are read with one command. Unwritten sectors read as 0.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+int
+w25qxx_ftl_read (uint8_t * buf, uint32_t sector, uint32_t count)
+{
+    uint32_t    phys;
+    uint32_t    n;
+
+    if (sector + count > ftl_sectors)
+    {
+        return -1;
+    }
+
+    while (count > 0)
+    {
+        phys    = ftl_map[sector];
+        n       = 1;
+
+        if (phys == FTL_UNMAPPED)
+        {
+            memset (buf, 0, W25QXX_FTL_SECTOR_SIZE);
+        }
+        else
+        {
+            while (n < count && ftl_map[sector + n] == phys + n && (phys + n) % FTL_SLOTS != 0)
+            {
+                n++;
+            }
+
+            if (w25qxx_read (FTL_DATA_ADDR(phys), buf, n * W25QXX_FTL_SECTOR_SIZE) != 0)
+            {
+                return -1;
+            }
+        }
+
+        buf     += n * W25QXX_FTL_SECTOR_SIZE;
+        sector  += n;
+        count   -= n;
+    }
+
+    return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * w25qxx_ftl_write () - write sectors
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+int
+w25qxx_ftl_write (const uint8_t * buf, uint32_t sector, uint32_t count)
+{
+    if (sector + count > ftl_sectors)
+    {
+        return -1;
+    }
+
+    ftl_stats.host_writes += count;
+    return ftl_program (buf, sector, count, 0);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * w25qxx_ftl_trim () - sectors start ... end (inclusive) are no longer used, they need not be copied by garbage collection.
+ * Trimming is not recorded on flash, old contents may reappear after the next mount. Because garbage collection erases its
+ * victims at once, the free blocks kept at runtime contain no tags and are free again after the mount, so garbage collection
+ * always finds a block for its copies, even if trimmed sectors have become live again.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+int
+w25qxx_ftl_trim (uint32_t start, uint32_t end)
+{
+    if (start > end || end >= ftl_sectors)
+    {
+        return -1;
+    }
+
+    while (start <= end)
+    {
+        ftl_remap (start++, FTL_UNMAPPED);
+    }
+
+    return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * w25qxx_ftl_stats () - get statistics
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+void
+w25qxx_ftl_stats (W25QXX_FTL_STATS * stats)
+{
+    uint32_t    block;
+
+    *stats              = ftl_stats;
+    stats->blocks       = ftl_blocks;
+    stats->sectors      = ftl_sectors;
+    stats->free_blocks  = ftl_free_blocks;
+    stats->erase_min    = ftl_blocks ? 0xFFFFFFFF : 0;
+    stats->erase_max    = 0;
+
+    for (block = 0; block < ftl_blocks; block++)
+    {
+        if (stats->erase_min > ftl_erase_cnt[block])
+        {
+            stats->erase_min = ftl_erase_cnt[block];
+        }
+
+        if (stats->erase_max < ftl_erase_cnt[block])
+        {
+            stats->erase_max = ftl_erase_cnt[block];
+        }
+    }
+}
@@ -0,0 +1,54 @@
+/*---------------------------------------------------------------------------------------------------------------------------------------------------
+ * w25qxx_ftl.h - flash translation layer for W25QXX
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ * MIT License
+ *
+ * Copyright (c) 2018-2021 Frank Meyer - frank(at)fli4l.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *---------------------------------------------------------------------------------------------------------------------------------------------------
+ */
+#ifndef W25QXX_FTL_H
+#define W25QXX_FTL_H
+
+#include <stdint.h>
+
+#define W25QXX_FTL_SECTOR_SIZE  512                                             // size of a logical sector
+
+typedef struct
+{
+    uint32_t    blocks;                                                         // erase blocks of 4 KiB
+    uint32_t    sectors;                                                        // logical sectors
+    uint32_t    free_blocks;                                                    // erased or erasable blocks
+    uint32_t    erase_min;                                                      // min. erase count of all blocks
+    uint32_t    erase_max;                                                      // max. erase count of all blocks
+    uint32_t    host_writes;                                                    // sectors written by FatFs since mount
+    uint32_t    flash_writes;                                                   // sectors programmed incl. garbage collection
+    uint32_t    erases;                                                         // blocks erased since mount
+} W25QXX_FTL_STATS;
+
+extern int              w25qxx_ftl_mount (void);
+extern void             w25qxx_ftl_umount (void);
+extern uint32_t         w25qxx_ftl_sectors (void);
+extern int              w25qxx_ftl_read (uint8_t *, uint32_t, uint32_t);
+extern int              w25qxx_ftl_write (const uint8_t *, uint32_t, uint32_t);
+extern int              w25qxx_ftl_trim (uint32_t, uint32_t);
+extern void             w25qxx_ftl_stats (W25QXX_FTL_STATS *);
+
+#endif